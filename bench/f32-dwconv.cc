@@ -123,11 +123,14 @@ static void f32_dwconv(benchmark::State& state,
   xnn_f32_minmax_params params;
   init_params(&params, -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
 
+  benchmark::utils::PerfCounters perf_counters;
   size_t buffer_index = 0;
   for (auto _ : state) {
     state.PauseTiming();
+    perf_counters.Stop();
     benchmark::utils::PrefetchToL1(a.data(), a.size() * sizeof(float));
     buffer_index = (buffer_index + 1) % num_buffers;
+    perf_counters.Start();
     state.ResumeTiming();
 
     for (size_t y = 0; y < output_height; y++) {
@@ -139,19 +142,23 @@ static void f32_dwconv(benchmark::State& state,
         0, z.data(), &params);
     }
   }
+  perf_counters.Stop();
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
   if (cpu_frequency != 0) {
     state.counters["cpufreq"] = cpu_frequency;
   }
+  perf_counters.Report(state);
 
+  const uint64_t flops_per_iteration = 2 * output_size * channels * kernel_size;
   state.counters["FLOPS"] = benchmark::Counter(
-    uint64_t(state.iterations()) * 2 * output_size * channels * kernel_size,
-    benchmark::Counter::kIsRate);
+    uint64_t(state.iterations()) * flops_per_iteration, benchmark::Counter::kIsRate);
 
+  const uint64_t bytes_per_iteration =
+    (output_size + input_height * input_width + kernel_size + 1 /* bias */) * channels * sizeof(float);
   state.counters["bytes"] = benchmark::Counter(
-    uint64_t(state.iterations()) * (output_size + input_height * input_width + kernel_size + 1 /* bias */) * channels * sizeof(float),
-    benchmark::Counter::kIsRate);
+    uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+  benchmark::utils::ReportRoofline(state, flops_per_iteration, bytes_per_iteration);
 }
 
 static void f32_dwconv(
@@ -264,11 +271,14 @@ static void f32_dwconv(
 
   const int input_advanced = tile_size - last_pass_tile;
   const int input_stride_elements = kernel_height * step_width - input_advanced;
+  benchmark::utils::PerfCounters perf_counters;
   size_t buffer_index = 0;
   for (auto _ : state) {
     state.PauseTiming();
+    perf_counters.Stop();
     benchmark::utils::PrefetchToL1(a.data(), a.size() * sizeof(float));
     buffer_index = (buffer_index + 1) % num_buffers;
+    perf_counters.Start();
     state.ResumeTiming();
 
     for (size_t y = 0; y < output_height; y++) {
@@ -280,19 +290,23 @@ static void f32_dwconv(
         0, z.data(), kernel_size, buffer.data(), &params);
     }
   }
+  perf_counters.Stop();
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
   if (cpu_frequency != 0) {
     state.counters["cpufreq"] = cpu_frequency;
   }
+  perf_counters.Report(state);
 
+  const uint64_t flops_per_iteration = 2 * output_size * channels * kernel_size;
   state.counters["FLOPS"] = benchmark::Counter(
-    uint64_t(state.iterations()) * 2 * output_size * channels * kernel_size,
-    benchmark::Counter::kIsRate);
+    uint64_t(state.iterations()) * flops_per_iteration, benchmark::Counter::kIsRate);
 
+  const uint64_t bytes_per_iteration =
+    (output_size + input_height * input_width + kernel_size + 1 /* bias */) * channels * sizeof(float);
   state.counters["bytes"] = benchmark::Counter(
-    uint64_t(state.iterations()) * (output_size + input_height * input_width + kernel_size + 1 /* bias */) * channels * sizeof(float),
-    benchmark::Counter::kIsRate);
+    uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+  benchmark::utils::ReportRoofline(state, flops_per_iteration, bytes_per_iteration);
 }
 
 
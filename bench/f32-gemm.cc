@@ -78,6 +78,7 @@ static void GEMMBenchmark(benchmark::State& state,
   init_params(&params,
     -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
 
+  benchmark::utils::PerfCounters perf_counters;
   size_t buffer_index = 0;
   for (auto _ : state) {
     // Use circular buffers (exceeding cache size) and prefetch to control cache state:
@@ -85,8 +86,10 @@ static void GEMMBenchmark(benchmark::State& state,
     // - W is not in cache (for any cache level)
     // - C is not in cache (for any cache level)
     state.PauseTiming();
+    perf_counters.Stop();
     benchmark::utils::PrefetchToL1(a.data(), a.size() * sizeof(float));
     buffer_index = (buffer_index + 1) % num_buffers;
+    perf_counters.Start();
     state.ResumeTiming();
 
     for (uint32_t m = 0; m < mc; m += mr) {
@@ -99,14 +102,23 @@ static void GEMMBenchmark(benchmark::State& state,
         &params);
     }
   }
+  perf_counters.Stop();
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
   if (cpu_frequency != 0) {
     state.counters["cpufreq"] = cpu_frequency;
   }
+  perf_counters.Report(state);
 
+  const uint64_t flops_per_iteration = 2 * mc * nc * kc;
   state.counters["FLOPS"] = benchmark::Counter(
-    uint64_t(state.iterations()) * 2 * mc * nc * kc, benchmark::Counter::kIsRate);
+    uint64_t(state.iterations()) * flops_per_iteration, benchmark::Counter::kIsRate);
+
+  // A is in cache, packed weights are read and C is written to memory.
+  const uint64_t bytes_per_iteration = (w_elements + c_elements) * sizeof(float);
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+  benchmark::utils::ReportRoofline(state, flops_per_iteration, bytes_per_iteration);
 }
 
 static void PPMM1PBenchmark(benchmark::State& state,
@@ -42,14 +42,18 @@ static void f32_vhswish(
 
   union xnn_f32_hswish_params params;
   init_params(&params);
+  benchmark::utils::PerfCounters perf_counters;
+  perf_counters.Start();
   for (auto _ : state) {
     hswish(num_elements * sizeof(float), input.data(), output.data(), &params);
   }
+  perf_counters.Stop();
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
   if (cpu_frequency != 0) {
     state.counters["cpufreq"] = cpu_frequency;
   }
+  perf_counters.Report(state);
 
   const size_t elements_per_iteration = num_elements;
   state.counters["elements"] =
@@ -58,6 +62,7 @@ static void f32_vhswish(
   const size_t bytes_per_iteration = 2 * num_elements * sizeof(float);
   state.counters["bytes"] =
     benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+  benchmark::utils::ReportRoofline(state, 0.0 /* FLOPs */, bytes_per_iteration);
 }
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
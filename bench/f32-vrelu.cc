@@ -38,14 +38,18 @@ static void f32_vrelu(
   std::vector<float, AlignedAllocator<float, 64>> y(num_elements);
   std::generate(x.begin(), x.end(), std::ref(f32rng));
 
+  benchmark::utils::PerfCounters perf_counters;
+  perf_counters.Start();
   for (auto _ : state) {
     f32_vrelu(num_elements * sizeof(float), x.data(), y.data(), nullptr);
   }
+  perf_counters.Stop();
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
   if (cpu_frequency != 0) {
     state.counters["cpufreq"] = cpu_frequency;
   }
+  perf_counters.Report(state);
 
   const size_t elements_per_iteration = num_elements;
   state.counters["elements"] =
@@ -54,6 +58,7 @@ static void f32_vrelu(
   const size_t bytes_per_iteration = 2 * num_elements * sizeof(float);
   state.counters["bytes"] =
     benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+  benchmark::utils::ReportRoofline(state, 0.0 /* FLOPs */, bytes_per_iteration);
 }
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -43,14 +43,18 @@ static void f32_vsigmoid(
 
   xnn_f32_sigmoid_params params;
   init_params(&params);
+  benchmark::utils::PerfCounters perf_counters;
+  perf_counters.Start();
   for (auto _ : state) {
     sigmoid(num_elements * sizeof(float), x.data(), y.data(), &params);
   }
+  perf_counters.Stop();
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
   if (cpu_frequency != 0) {
     state.counters["cpufreq"] = cpu_frequency;
   }
+  perf_counters.Report(state);
 
   const size_t elements_per_iteration = num_elements;
   state.counters["elements"] =
@@ -59,6 +63,7 @@ static void f32_vsigmoid(
   const size_t bytes_per_iteration = 2 * num_elements * sizeof(float);
   state.counters["bytes"] =
     benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+  benchmark::utils::ReportRoofline(state, 0.0 /* FLOPs */, bytes_per_iteration);
 }
 
 #if XNN_ARCH_ARM64
@@ -0,0 +1,287 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+
+
+namespace {
+
+// Subgraph with external input and output Values, and static weights which must outlive the runtime created from it.
+struct Model {
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph{nullptr, xnn_delete_subgraph};
+  std::vector<std::unique_ptr<std::vector<float>>> weights;
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  size_t input_size = 0;
+  size_t output_size = 0;
+};
+
+typedef std::function<bool(Model&)> ModelFactory;
+
+const float* RandomWeights(Model& model, size_t size) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-0.1f, 0.1f), std::ref(rng));
+
+  model.weights.emplace_back(new std::vector<float>(size));
+  std::generate(model.weights.back()->begin(), model.weights.back()->end(), std::ref(f32rng));
+  return model.weights.back()->data();
+}
+
+uint32_t DefineTensor(Model& model, const std::vector<size_t>& dims, const float* data, uint32_t flags) {
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  if (xnn_define_tensor_value(
+        model.subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), data, XNN_INVALID_VALUE_ID, flags,
+        &id) != xnn_status_success)
+  {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return id;
+}
+
+// Multi-layer perceptron with a single row of inputs: every operator is cheap to run, so setup is relatively expensive.
+bool DefineMLP(Model& model, size_t num_layers, size_t channels) {
+  xnn_subgraph_t subgraph = nullptr;
+  if (xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph) != xnn_status_success) {
+    return false;
+  }
+  model.subgraph.reset(subgraph);
+  model.input_id = 0;
+  model.output_id = 1;
+  model.input_size = channels;
+  model.output_size = channels;
+
+  const std::vector<size_t> dims = {1, channels};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  if (xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, model.input_id,
+        XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id) != xnn_status_success)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < num_layers; i++) {
+    const uint32_t filter_id =
+      DefineTensor(model, {channels, channels}, RandomWeights(model, channels * channels), /*flags=*/0);
+    const uint32_t bias_id = DefineTensor(model, {channels}, RandomWeights(model, channels), /*flags=*/0);
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    if (i + 1 == num_layers) {
+      if (xnn_define_tensor_value(
+            subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, model.output_id,
+            XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id) != xnn_status_success)
+      {
+        return false;
+      }
+    } else {
+      output_id = DefineTensor(model, dims, nullptr, /*flags=*/0);
+    }
+    if (filter_id == XNN_INVALID_VALUE_ID || bias_id == XNN_INVALID_VALUE_ID || output_id == XNN_INVALID_VALUE_ID) {
+      return false;
+    }
+    if (xnn_define_fully_connected(
+          subgraph, 0.0f, std::numeric_limits<float>::infinity(), input_id, filter_id, bias_id, output_id,
+          /*flags=*/0) != xnn_status_success)
+    {
+      return false;
+    }
+    input_id = output_id;
+  }
+  return true;
+}
+
+// Stack of depthwise separable convolution blocks, as in MobileNet.
+bool DefineConvNet(Model& model, size_t num_blocks, size_t size, size_t channels) {
+  xnn_subgraph_t subgraph = nullptr;
+  if (xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph) != xnn_status_success) {
+    return false;
+  }
+  model.subgraph.reset(subgraph);
+  model.input_id = 0;
+  model.output_id = 1;
+  model.input_size = size * size * channels;
+  model.output_size = size * size * channels;
+
+  const std::vector<size_t> dims = {1, size, size, channels};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  if (xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, model.input_id,
+        XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id) != xnn_status_success)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < num_blocks; i++) {
+    const uint32_t dw_filter_id =
+      DefineTensor(model, {1, 3, 3, channels}, RandomWeights(model, 9 * channels), /*flags=*/0);
+    const uint32_t dw_bias_id = DefineTensor(model, {channels}, RandomWeights(model, channels), /*flags=*/0);
+    const uint32_t dw_output_id = DefineTensor(model, dims, nullptr, /*flags=*/0);
+    if (dw_filter_id == XNN_INVALID_VALUE_ID || dw_bias_id == XNN_INVALID_VALUE_ID ||
+        dw_output_id == XNN_INVALID_VALUE_ID)
+    {
+      return false;
+    }
+    if (xnn_define_depthwise_convolution_2d(
+          subgraph,
+          /*input_padding_top=*/1, /*input_padding_right=*/1, /*input_padding_bottom=*/1, /*input_padding_left=*/1,
+          /*kernel_height=*/3, /*kernel_width=*/3,
+          /*subsampling_height=*/1, /*subsampling_width=*/1,
+          /*dilation_height=*/1, /*dilation_width=*/1,
+          /*depth_multiplier=*/1, /*input_channels=*/channels,
+          0.0f, 6.0f, input_id, dw_filter_id, dw_bias_id, dw_output_id, /*flags=*/0) != xnn_status_success)
+    {
+      return false;
+    }
+
+    const uint32_t pw_filter_id =
+      DefineTensor(model, {channels, 1, 1, channels}, RandomWeights(model, channels * channels), /*flags=*/0);
+    const uint32_t pw_bias_id = DefineTensor(model, {channels}, RandomWeights(model, channels), /*flags=*/0);
+    uint32_t pw_output_id = XNN_INVALID_VALUE_ID;
+    if (i + 1 == num_blocks) {
+      if (xnn_define_tensor_value(
+            subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, model.output_id,
+            XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &pw_output_id) != xnn_status_success)
+      {
+        return false;
+      }
+    } else {
+      pw_output_id = DefineTensor(model, dims, nullptr, /*flags=*/0);
+    }
+    if (pw_filter_id == XNN_INVALID_VALUE_ID || pw_bias_id == XNN_INVALID_VALUE_ID ||
+        pw_output_id == XNN_INVALID_VALUE_ID)
+    {
+      return false;
+    }
+    if (xnn_define_convolution_2d(
+          subgraph,
+          /*input_padding_top=*/0, /*input_padding_right=*/0, /*input_padding_bottom=*/0, /*input_padding_left=*/0,
+          /*kernel_height=*/1, /*kernel_width=*/1,
+          /*subsampling_height=*/1, /*subsampling_width=*/1,
+          /*dilation_height=*/1, /*dilation_width=*/1,
+          /*groups=*/1, /*group_input_channels=*/channels, /*group_output_channels=*/channels,
+          0.0f, 6.0f, dw_output_id, pw_filter_id, pw_bias_id, pw_output_id, /*flags=*/0) != xnn_status_success)
+    {
+      return false;
+    }
+    input_id = pw_output_id;
+  }
+  return true;
+}
+
+// Measures xnn_setup_runtime, and optionally xnn_invoke_runtime, in a loop. With move_external_values, every iteration
+// alternates between two pairs of input and output buffers, as a caller reusing a runtime for different requests does.
+void RuntimeSetupBenchmark(
+  benchmark::State& state,
+  ModelFactory model_factory,
+  bool move_external_values,
+  bool invoke)
+{
+  if (xnn_initialize(nullptr /* allocator */) != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  const size_t num_threads = state.range(0);
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  Model model;
+  if (!model_factory(model)) {
+    state.SkipWithError("failed to define a model");
+    return;
+  }
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  if (xnn_create_runtime_v2(model.subgraph.get(), threadpool.get(), 0 /* flags */, &runtime_ptr) != xnn_status_success) {
+    state.SkipWithError("failed to create a runtime");
+    return;
+  }
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  std::array<std::vector<float>, 2> inputs;
+  std::array<std::vector<float>, 2> outputs;
+  for (size_t i = 0; i < 2; i++) {
+    inputs[i].resize(model.input_size + XNN_EXTRA_BYTES / sizeof(float), 1.0f);
+    outputs[i].resize(model.output_size);
+  }
+
+  size_t iteration = 0;
+  for (auto _ : state) {
+    const size_t buffer_index = move_external_values ? iteration++ % 2 : 0;
+    const std::array<xnn_external_value, 2> external = {
+      xnn_external_value{model.input_id, inputs[buffer_index].data()},
+      xnn_external_value{model.output_id, outputs[buffer_index].data()},
+    };
+    if (xnn_setup_runtime(runtime.get(), external.size(), external.data()) != xnn_status_success) {
+      state.SkipWithError("failed to setup a runtime");
+      return;
+    }
+    if (invoke && xnn_invoke_runtime(runtime.get()) != xnn_status_success) {
+      state.SkipWithError("failed to invoke a runtime");
+      return;
+    }
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+}
+
+bool MLP(Model& model) {
+  return DefineMLP(model, /*num_layers=*/16, /*channels=*/64);
+}
+
+bool ConvNet(Model& model) {
+  return DefineConvNet(model, /*num_blocks=*/13, /*size=*/7, /*channels=*/64);
+}
+
+}  // namespace
+
+static void MLPSetup(benchmark::State& state) {
+  RuntimeSetupBenchmark(state, MLP, /*move_external_values=*/false, /*invoke=*/false);
+}
+
+static void MLPSetupMoved(benchmark::State& state) {
+  RuntimeSetupBenchmark(state, MLP, /*move_external_values=*/true, /*invoke=*/false);
+}
+
+static void MLPSetupInvoke(benchmark::State& state) {
+  RuntimeSetupBenchmark(state, MLP, /*move_external_values=*/true, /*invoke=*/true);
+}
+
+static void ConvNetSetup(benchmark::State& state) {
+  RuntimeSetupBenchmark(state, ConvNet, /*move_external_values=*/false, /*invoke=*/false);
+}
+
+static void ConvNetSetupMoved(benchmark::State& state) {
+  RuntimeSetupBenchmark(state, ConvNet, /*move_external_values=*/true, /*invoke=*/false);
+}
+
+static void ConvNetSetupInvoke(benchmark::State& state) {
+  RuntimeSetupBenchmark(state, ConvNet, /*move_external_values=*/true, /*invoke=*/true);
+}
+
+BENCHMARK(MLPSetup)->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(MLPSetupMoved)->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(MLPSetupInvoke)->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(ConvNetSetup)->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(ConvNetSetupMoved)->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(ConvNetSetupInvoke)->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
@@ -0,0 +1,231 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/cache.h>
+#include <xnnpack/subgraph.h>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+#include "models/subgraph/models.h"
+
+
+namespace {
+
+typedef std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> RuntimePtr;
+typedef std::unique_ptr<xnn_weights_cache, decltype(&xnn_delete_weights_cache)> WeightsCachePtr;
+
+bool Initialize(benchmark::State& state) {
+  if (xnn_initialize(nullptr /* allocator */) != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return false;
+  }
+  return true;
+}
+
+bool DefineModel(benchmark::State& state, models::subgraph::ModelFactory model_factory, models::subgraph::Model& model) {
+  if (!model_factory(model)) {
+    state.SkipWithError("failed to define the model");
+    return false;
+  }
+  return true;
+}
+
+RuntimePtr CreateRuntime(
+  benchmark::State& state, const models::subgraph::Model& model, xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool)
+{
+  xnn_runtime_t runtime = nullptr;
+  if (xnn_create_runtime_v3(model.subgraph.get(), weights_cache, threadpool, 0 /* flags */, &runtime)
+      != xnn_status_success)
+  {
+    state.SkipWithError("failed to create a runtime");
+  }
+  return RuntimePtr(runtime, xnn_delete_runtime);
+}
+
+// Input and output buffers for a model, with two alternate sets of buffers to make every setup rebind the external
+// Values.
+class Buffers {
+ public:
+  explicit Buffers(const models::subgraph::Model& model) {
+    for (size_t i = 0; i < inputs_.size(); i++) {
+      inputs_[i].assign(model.input_size + XNN_EXTRA_BYTES / sizeof(float), 0.5f);
+      outputs_[i].resize(model.output_size);
+    }
+  }
+
+  bool Setup(benchmark::State& state, xnn_runtime_t runtime, size_t index) {
+    const std::array<xnn_external_value, 2> external = {
+      xnn_external_value{models::subgraph::kInputId, inputs_[index % 2].data()},
+      xnn_external_value{models::subgraph::kOutputId, outputs_[index % 2].data()},
+    };
+    if (xnn_setup_runtime(runtime, external.size(), external.data()) != xnn_status_success) {
+      state.SkipWithError("failed to setup a runtime");
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  std::array<std::vector<float>, 2> inputs_;
+  std::array<std::vector<float>, 2> outputs_;
+};
+
+void ReportCpuFrequency(benchmark::State& state) {
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+}
+
+// Runtime creation: subgraph optimization, operator creation with weight packing, and memory planning. Every
+// iteration starts from a freshly defined subgraph, as creation rewrites the subgraph in place.
+void CreateRuntimeBenchmark(benchmark::State& state, models::subgraph::ModelFactory model_factory) {
+  if (!Initialize(state)) {
+    return;
+  }
+
+  const size_t num_threads = state.range(0);
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    models::subgraph::Model model;
+    if (!DefineModel(state, model_factory, model)) {
+      return;
+    }
+    state.ResumeTiming();
+
+    RuntimePtr runtime = CreateRuntime(state, model, nullptr /* weights cache */, threadpool.get());
+    if (runtime == nullptr) {
+      return;
+    }
+
+    state.PauseTiming();
+    runtime.reset();
+    model.subgraph.reset();
+    state.ResumeTiming();
+  }
+
+  ReportCpuFrequency(state);
+}
+
+// Setup of a runtime with moved external Values: shape propagation and binding of every operator to its buffers.
+void SetupRuntimeBenchmark(benchmark::State& state, models::subgraph::ModelFactory model_factory) {
+  if (!Initialize(state)) {
+    return;
+  }
+
+  const size_t num_threads = state.range(0);
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  models::subgraph::Model model;
+  if (!DefineModel(state, model_factory, model)) {
+    return;
+  }
+  RuntimePtr runtime = CreateRuntime(state, model, nullptr /* weights cache */, threadpool.get());
+  if (runtime == nullptr) {
+    return;
+  }
+
+  Buffers buffers(model);
+  size_t iteration = 0;
+  for (auto _ : state) {
+    if (!buffers.Setup(state, runtime.get(), iteration++)) {
+      return;
+    }
+  }
+
+  ReportCpuFrequency(state);
+}
+
+// Steady-state inference of a runtime which shares its packed weights through a weights cache, as deployed models
+// do. Also reports the size of the workspace for intermediate tensors and the size of the packed weights.
+void InvokeRuntimeBenchmark(benchmark::State& state, models::subgraph::ModelFactory model_factory) {
+  if (!Initialize(state)) {
+    return;
+  }
+
+  const size_t num_threads = state.range(0);
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  models::subgraph::Model model;
+  if (!DefineModel(state, model_factory, model)) {
+    return;
+  }
+
+  xnn_weights_cache_t weights_cache_ptr = nullptr;
+  if (xnn_create_weights_cache(&weights_cache_ptr) != xnn_status_success) {
+    state.SkipWithError("failed to create a weights cache");
+    return;
+  }
+  WeightsCachePtr weights_cache(weights_cache_ptr, xnn_delete_weights_cache);
+
+  RuntimePtr runtime = CreateRuntime(state, model, weights_cache.get(), threadpool.get());
+  if (runtime == nullptr) {
+    return;
+  }
+  if (xnn_finalize_weights_cache(weights_cache.get(), xnn_weights_cache_finalization_kind_hard)
+      != xnn_status_success)
+  {
+    state.SkipWithError("failed to finalize the weights cache");
+    return;
+  }
+
+  Buffers buffers(model);
+  if (!buffers.Setup(state, runtime.get(), 0)) {
+    return;
+  }
+
+  for (auto _ : state) {
+    if (xnn_invoke_runtime(runtime.get()) != xnn_status_success) {
+      state.SkipWithError("failed to invoke a runtime");
+      return;
+    }
+  }
+
+  ReportCpuFrequency(state);
+  state.counters["workspace_bytes"] = benchmark::Counter(
+    runtime->workspace->size, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.counters["packed_weights_bytes"] = benchmark::Counter(
+    weights_cache->cache.weights.size, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+}  // namespace
+
+#define BENCHMARK_SUBGRAPH_MODEL(model_name)                                                              \
+  static void model_name##Create(benchmark::State& state) {                                               \
+    CreateRuntimeBenchmark(state, models::subgraph::model_name);                                          \
+  }                                                                                                       \
+  static void model_name##Setup(benchmark::State& state) {                                                \
+    SetupRuntimeBenchmark(state, models::subgraph::model_name);                                           \
+  }                                                                                                       \
+  static void model_name##Invoke(benchmark::State& state) {                                               \
+    InvokeRuntimeBenchmark(state, models::subgraph::model_name);                                          \
+  }                                                                                                       \
+  BENCHMARK(model_name##Create)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();            \
+  BENCHMARK(model_name##Setup)->Arg(1)->Unit(benchmark::kMicrosecond)->UseRealTime();                     \
+  BENCHMARK(model_name##Invoke)                                                                           \
+    ->Apply(benchmark::utils::MultiThreadingParameters)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_SUBGRAPH_MODEL(FP32MobileNetV1)
+BENCHMARK_SUBGRAPH_MODEL(FP32MobileNetV2)
+BENCHMARK_SUBGRAPH_MODEL(FP32MobileNetV3Small)
+BENCHMARK_SUBGRAPH_MODEL(FP32TransformerEncoderBlock)
+BENCHMARK_SUBGRAPH_MODEL(FP32TransformerDecoderStep)
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
@@ -3,13 +3,20 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <mutex>
+#include <vector>
 
 #ifdef __linux__
+  #include <linux/perf_event.h>
   #include <sched.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
 #endif
 #if defined(__ANDROID__) || defined(_WIN32) || defined(__CYGWIN__)
   #include <malloc.h>
@@ -17,6 +24,12 @@
 #if defined(__SSE__) || defined(__x86_64__)
   #include <xmmintrin.h>
 #endif
+#if (defined(__i386__) || defined(__x86_64__)) && defined(__GNUC__)
+  #include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__aarch64__)
+  #include <arm_neon.h>
+#endif
 
 #include <cpuinfo.h>
 
@@ -140,6 +153,343 @@ size_t GetMaxCacheSize() {
   return cpuinfo_get_max_cache_size();
 }
 
+#ifdef __linux__
+namespace {
+
+struct PerfEventConfig {
+  const char* name;
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr uint64_t HardwareCacheEvent(uint64_t cache, uint64_t op, uint64_t result) {
+  return cache | (op << 8) | (result << 16);
+}
+
+std::vector<PerfEventConfig> GetPerfEventConfigs() {
+  std::vector<PerfEventConfig> configs = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"L1D_misses", PERF_TYPE_HW_CACHE,
+      HardwareCacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"LLC_misses", PERF_TYPE_HW_CACHE,
+      HardwareCacheEvent(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+  };
+  // There is no generic L2 cache event, use the raw event of the processor where its encoding is known.
+  #if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    // L2D_CACHE_REFILL, a common architectural event of the ARMv8 PMU.
+    configs.push_back({"L2_misses", PERF_TYPE_RAW, 0x17});
+  #elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    if (cpuinfo_initialize() && cpuinfo_get_processors_count() != 0) {
+      switch (cpuinfo_get_processor(0)->core->vendor) {
+        case cpuinfo_vendor_intel:
+          // L2_RQSTS.MISS
+          configs.push_back({"L2_misses", PERF_TYPE_RAW, 0x3F24});
+          break;
+        case cpuinfo_vendor_amd:
+          // L2_CACHE_REQ_STAT.LS_RD_BLK_C: data cache requests which miss in L2.
+          configs.push_back({"L2_misses", PERF_TYPE_RAW, 0x0864});
+          break;
+        default:
+          break;
+      }
+    }
+  #endif
+  return configs;
+}
+
+bool PerfCountersEnabled() {
+  const char* value = getenv("XNN_BENCHMARK_PERF_COUNTERS");
+  return value != nullptr && value[0] != '\0' && strcmp(value, "0") != 0;
+}
+
+}  // namespace
+#endif  // __linux__
+
+PerfCounters::PerfCounters() {
+#ifdef __linux__
+  if (!PerfCountersEnabled()) {
+    return;
+  }
+  for (const PerfEventConfig& config : GetPerfEventConfigs()) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = config.type;
+    attr.config = config.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // Events can be multiplexed if there are more events than hardware counters, scale them by the enabled time.
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    const int fd = static_cast<int>(syscall(
+      __NR_perf_event_open, &attr, 0 /* calling thread */, -1 /* any cpu */, -1 /* no group */, 0 /* flags */));
+    if (fd >= 0) {
+      events_.push_back(Event{config.name, fd, 0.0});
+    }
+  }
+#endif  // __linux__
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+  for (const Event& event : events_) {
+    close(event.fd);
+  }
+#endif  // __linux__
+}
+
+void PerfCounters::Start() {
+  running_ = true;
+#ifdef __linux__
+  for (const Event& event : events_) {
+    ioctl(event.fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(event.fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif  // __linux__
+}
+
+void PerfCounters::Stop() {
+  if (!running_) {
+    return;
+  }
+  running_ = false;
+#ifdef __linux__
+  for (Event& event : events_) {
+    ioctl(event.fd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t values[3] = { 0 };  // value, time enabled, time running
+    if (read(event.fd, values, sizeof(values)) == sizeof(values) && values[2] != 0) {
+      event.count += double(values[0]) * double(values[1]) / double(values[2]);
+    }
+  }
+#endif  // __linux__
+}
+
+void PerfCounters::Report(benchmark::State& state) const {
+  double cycles = 0.0;
+  double instructions = 0.0;
+  for (const Event& event : events_) {
+    state.counters[event.name] = benchmark::Counter(event.count, benchmark::Counter::kAvgIterations);
+    if (strcmp(event.name, "cycles") == 0) {
+      cycles = event.count;
+    } else if (strcmp(event.name, "instructions") == 0) {
+      instructions = event.count;
+    }
+  }
+  if (cycles != 0.0 && instructions != 0.0) {
+    state.counters["IPC"] = instructions / cycles;
+  }
+}
+
+namespace {
+
+#if (defined(__i386__) || defined(__x86_64__)) && defined(__GNUC__)
+// Each of the multiply-add loops below keeps 12 independent accumulators to hide the latency of the arithmetic
+// instructions, and returns the number of floating-point operations it did.
+
+__attribute__((target("avx512f")))
+uint64_t MultiplyAddAVX512F(size_t iterations, float* result) {
+  const __m512 va = _mm512_set1_ps(result[0]);
+  const __m512 vb = _mm512_set1_ps(result[1]);
+  __m512 vacc[12];
+  for (size_t i = 0; i < 12; i++) {
+    vacc[i] = _mm512_set1_ps(float(i));
+  }
+  for (size_t n = 0; n < iterations; n++) {
+    for (size_t i = 0; i < 12; i++) {
+      vacc[i] = _mm512_fmadd_ps(vacc[i], va, vb);
+    }
+  }
+  for (size_t i = 1; i < 12; i++) {
+    vacc[0] = _mm512_add_ps(vacc[0], vacc[i]);
+  }
+  float sum[16];
+  _mm512_storeu_ps(sum, vacc[0]);
+  result[0] = 0.0f;
+  for (size_t i = 0; i < 16; i++) {
+    result[0] += sum[i];
+  }
+  return uint64_t(iterations) * 12 * 16 * 2;
+}
+
+__attribute__((target("avx2,fma")))
+uint64_t MultiplyAddFMA3(size_t iterations, float* result) {
+  const __m256 va = _mm256_set1_ps(result[0]);
+  const __m256 vb = _mm256_set1_ps(result[1]);
+  __m256 vacc[12];
+  for (size_t i = 0; i < 12; i++) {
+    vacc[i] = _mm256_set1_ps(float(i));
+  }
+  for (size_t n = 0; n < iterations; n++) {
+    for (size_t i = 0; i < 12; i++) {
+      vacc[i] = _mm256_fmadd_ps(vacc[i], va, vb);
+    }
+  }
+  for (size_t i = 1; i < 12; i++) {
+    vacc[0] = _mm256_add_ps(vacc[0], vacc[i]);
+  }
+  float sum[8];
+  _mm256_storeu_ps(sum, vacc[0]);
+  result[0] = sum[0] + sum[1] + sum[2] + sum[3] + sum[4] + sum[5] + sum[6] + sum[7];
+  return uint64_t(iterations) * 12 * 8 * 2;
+}
+
+uint64_t MultiplyAddSSE(size_t iterations, float* result) {
+  const __m128 va = _mm_set1_ps(result[0]);
+  const __m128 vb = _mm_set1_ps(result[1]);
+  __m128 vacc[12];
+  for (size_t i = 0; i < 12; i++) {
+    vacc[i] = _mm_set1_ps(float(i));
+  }
+  for (size_t n = 0; n < iterations; n++) {
+    for (size_t i = 0; i < 12; i++) {
+      vacc[i] = _mm_add_ps(_mm_mul_ps(vacc[i], va), vb);
+    }
+  }
+  for (size_t i = 1; i < 12; i++) {
+    vacc[0] = _mm_add_ps(vacc[0], vacc[i]);
+  }
+  float sum[4];
+  _mm_storeu_ps(sum, vacc[0]);
+  result[0] = sum[0] + sum[1] + sum[2] + sum[3];
+  return uint64_t(iterations) * 12 * 4 * 2;
+}
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+uint64_t MultiplyAddNEON(size_t iterations, float* result) {
+  const float32x4_t va = vdupq_n_f32(result[0]);
+  const float32x4_t vb = vdupq_n_f32(result[1]);
+  float32x4_t vacc[12];
+  for (size_t i = 0; i < 12; i++) {
+    vacc[i] = vdupq_n_f32(float(i));
+  }
+  for (size_t n = 0; n < iterations; n++) {
+    for (size_t i = 0; i < 12; i++) {
+      #if defined(__aarch64__)
+        vacc[i] = vfmaq_f32(vb, vacc[i], va);
+      #else
+        vacc[i] = vmlaq_f32(vb, vacc[i], va);
+      #endif
+    }
+  }
+  for (size_t i = 1; i < 12; i++) {
+    vacc[0] = vaddq_f32(vacc[0], vacc[i]);
+  }
+  result[0] = vgetq_lane_f32(vacc[0], 0) + vgetq_lane_f32(vacc[0], 1) +
+    vgetq_lane_f32(vacc[0], 2) + vgetq_lane_f32(vacc[0], 3);
+  return uint64_t(iterations) * 12 * 4 * 2;
+}
+#else
+uint64_t MultiplyAddScalar(size_t iterations, float* result) {
+  const float a = result[0];
+  const float b = result[1];
+  float acc[12];
+  for (size_t i = 0; i < 12; i++) {
+    acc[i] = float(i);
+  }
+  for (size_t n = 0; n < iterations; n++) {
+    for (size_t i = 0; i < 12; i++) {
+      acc[i] = acc[i] * a + b;
+    }
+  }
+  for (size_t i = 1; i < 12; i++) {
+    acc[0] += acc[i];
+  }
+  result[0] = acc[0];
+  return uint64_t(iterations) * 12 * 2;
+}
+#endif
+
+typedef uint64_t (*MultiplyAddFunction)(size_t iterations, float* result);
+
+MultiplyAddFunction GetMultiplyAddFunction() {
+#if (defined(__i386__) || defined(__x86_64__)) && defined(__GNUC__)
+  const xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config != nullptr && hardware_config->use_x86_avx512f) {
+    return MultiplyAddAVX512F;
+  } else if (hardware_config != nullptr && hardware_config->use_x86_fma3 && hardware_config->use_x86_avx2) {
+    return MultiplyAddFMA3;
+  } else {
+    return MultiplyAddSSE;
+  }
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+  return MultiplyAddNEON;
+#else
+  return MultiplyAddScalar;
+#endif
+}
+
+// Best of several repetitions of a measurement which returns a rate.
+template <class F>
+double MaxRate(F measure, size_t repetitions = 5) {
+  double max_rate = 0.0;
+  for (size_t i = 0; i < repetitions; i++) {
+    max_rate = std::max(max_rate, measure());
+  }
+  return max_rate;
+}
+
+double MeasurePeakFlops() {
+  const MultiplyAddFunction multiply_add = GetMultiplyAddFunction();
+  // Keep the accumulators bounded, and the loop opaque to the compiler.
+  volatile float parameters[2] = { 0.999f, 0.001f };
+  return MaxRate([&]() {
+    float result[2] = { parameters[0], parameters[1] };
+    const auto start = std::chrono::steady_clock::now();
+    const uint64_t flops = multiply_add(1000000, result);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    parameters[0] = std::min(result[0], 0.999f);
+    return double(flops) / elapsed.count();
+  });
+}
+
+double MeasurePeakBandwidth() {
+  // Stream through a buffer larger than the caches, up to a limit to keep memory usage reasonable.
+  const size_t buffer_size = std::min<size_t>(
+    std::max<size_t>(2 * GetMaxCacheSize(), 64 * 1024 * 1024), 512 * 1024 * 1024);
+  std::vector<uint64_t> buffer(buffer_size / sizeof(uint64_t), 1);
+  volatile uint64_t checksum = 0;
+  return MaxRate([&]() {
+    uint64_t acc[8] = { 0 };
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < buffer.size(); i += 8) {
+      for (size_t j = 0; j < 8; j++) {
+        acc[j] += buffer[i + j];
+      }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    checksum = acc[0] + acc[1] + acc[2] + acc[3] + acc[4] + acc[5] + acc[6] + acc[7];
+    return double(buffer.size() * sizeof(uint64_t)) / elapsed.count();
+  }, /*repetitions=*/3);
+}
+
+}  // namespace
+
+double GetPeakFlops() {
+  static std::once_flag once;
+  static double peak_flops = 0.0;
+  std::call_once(once, []() { peak_flops = MeasurePeakFlops(); });
+  return peak_flops;
+}
+
+double GetPeakBandwidth() {
+  static std::once_flag once;
+  static double peak_bandwidth = 0.0;
+  std::call_once(once, []() { peak_bandwidth = MeasurePeakBandwidth(); });
+  return peak_bandwidth;
+}
+
+void ReportRoofline(benchmark::State& state, double flops_per_iteration, double bytes_per_iteration) {
+  const double peak_flops = GetPeakFlops();
+  const double peak_bandwidth = GetPeakBandwidth();
+  state.counters["peak_bytes"] = peak_bandwidth;
+  if (flops_per_iteration != 0.0 && bytes_per_iteration != 0.0) {
+    const double arithmetic_intensity = flops_per_iteration / bytes_per_iteration;
+    state.counters["peak_FLOPS"] = peak_flops;
+    state.counters["intensity"] = arithmetic_intensity;
+    state.counters["roofline_FLOPS"] = std::min(peak_flops, arithmetic_intensity * peak_bandwidth);
+  }
+}
+
 void MultiThreadingParameters(benchmark::internal::Benchmark* benchmark) {
   benchmark->ArgName("T");
 
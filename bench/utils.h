@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <xnnpack.h>
 #include <xnnpack/common.h>
@@ -30,6 +31,45 @@ uint64_t GetCurrentCpuFrequency();
 // Can overestimate, but not underestimate LLC size.
 size_t GetMaxCacheSize();
 
+// Hardware performance counters of the calling thread, read with perf_event_open on Linux. Counting is opt-in through
+// the XNN_BENCHMARK_PERF_COUNTERS environment variable. Events which the system does not expose, e.g. in virtual
+// machines or with a restrictive perf_event_paranoid setting, are silently omitted.
+class PerfCounters {
+ public:
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // Counts accumulate over all Start/Stop intervals. Stop is a no-op if counters are not running.
+  void Start();
+  void Stop();
+
+  // Report cycles, instructions, IPC, and L1 data, L2, and last level cache misses per benchmark iteration.
+  void Report(benchmark::State& state) const;
+
+ private:
+  struct Event {
+    const char* name;
+    int fd;
+    double count;
+  };
+  std::vector<Event> events_;
+  bool running_ = false;
+};
+
+// Return peak single-threaded floating-point throughput, in FLOP/s, and memory read bandwidth, in bytes/s, of the
+// processor. Peaks are measured on the calling thread on the first call.
+double GetPeakFlops();
+double GetPeakBandwidth();
+
+// Report the measured peaks next to the achieved rates of a benchmark which does the given number of floating-point
+// operations and moves the given number of bytes to or from memory per iteration: peak bandwidth ("peak_bytes", to
+// compare with "bytes"), and, unless the operation count is zero, peak throughput ("peak_FLOPS"), arithmetic
+// intensity, and the roofline bound min(peak FLOP/s, arithmetic intensity * peak bandwidth) ("roofline_FLOPS", to
+// compare with "FLOPS").
+void ReportRoofline(benchmark::State& state, double flops_per_iteration, double bytes_per_iteration);
+
 // Set number of elements for a unary elementwise microkernel such that:
 // - It is divisible by 2, 3, 4, 5, 6.
 // - It is divisible by AVX512 width.
@@ -72,9 +72,32 @@ extern "C" {
 /// Align corners of input and output images in resize operations.
 #define XNN_FLAG_ALIGN_CORNERS 0x00000008
 
+/// Use the tanh-based approximation of GELU instead of the exact erf-based formula.
+#define XNN_FLAG_TANH_APPROXIMATION 0x00000001
+
 /// Yield worker threads of the thread pool to the system scheduler after the inference.
 #define XNN_FLAG_YIELD_WORKERS 0x00000010
 
+/// Quantize FP32 inputs of Fully Connected and 1x1 Convolution Nodes with channelwise quantized static weights to
+/// INT8 at runtime, with per-row scales, and compute these Nodes with INT8 GEMM micro-kernels.
+///
+/// Note: without this flag, channelwise quantized weights of Nodes with FP32 inputs are dequantized at Runtime creation.
+#define XNN_FLAG_DYNAMIC_QUANTIZATION 0x00000020
+
+/// Retain reduced dimensions with length 1.
+#define XNN_FLAG_KEEP_DIMS 0x00000040
+
+/// Back memory of a weights cache or workspace with explicit huge pages (MAP_HUGETLB) if the system has free huge
+/// pages, and fall back to regular pages otherwise. Only supported on Linux.
+#define XNN_FLAG_HUGE_PAGES 0x00000080
+
+/// Advise the system to back regular pages of a weights cache or workspace with transparent huge pages
+/// (MADV_HUGEPAGE). Only supported on Linux.
+#define XNN_FLAG_TRANSPARENT_HUGE_PAGES 0x00000100
+
+/// Pre-fault memory of a weights cache or workspace when it is allocated, rather than on first access.
+#define XNN_FLAG_PREFAULT_MEMORY 0x00000200
+
 /// Status code for any XNNPACK function call.
 enum xnn_status {
   /// The call succeeded, and all output arguments now contain valid data.
@@ -204,6 +227,11 @@ enum xnn_datatype {
   xnn_datatype_qcint8 = 6,
   /// Quantized 32-bit signed integer with shared per-channel quantization parameters.
   xnn_datatype_qcint32 = 7,
+  /// Quantized 4-bit signed integer with shared per-channel quantization parameters. Two elements are packed per byte,
+  /// the first element in the low nibble, and every row along the innermost dimension starts on a byte boundary.
+  xnn_datatype_qcint4 = 8,
+  /// 32-bit signed integer, e.g. indices.
+  xnn_datatype_int32 = 9,
 };
 
 /// Define a tensor-type Value and add it to a Subgraph.
@@ -499,6 +527,38 @@ enum xnn_status xnn_define_depth_to_space(
   uint32_t block_size,
   uint32_t flags);
 
+/// Pooling of the rows gathered by Embedding Lookup Nodes and operators.
+enum xnn_embedding_pooling {
+  /// Every index produces its own output row.
+  xnn_embedding_pooling_none = 0,
+  /// Rows selected by a bag of indices are summed into one output row.
+  xnn_embedding_pooling_sum,
+  /// Rows selected by a bag of indices are averaged into one output row.
+  xnn_embedding_pooling_mean,
+};
+
+/// Define an Embedding Lookup Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param pooling - pooling of the gathered rows.
+/// @param table_id - Value ID for the embedding table. The table must be a static 2D tensor defined in the @a subgraph
+///                   with [num_embeddings, embedding_dim] dimensions and FP32, FP16, QCINT8, or QCINT4 datatype.
+///                   Quantized tables must have per-embedding scales, i.e. channel dimension 0.
+/// @param indices_id - Value ID for the indices tensor. The indices tensor must be an INT32 tensor defined in the
+///                     @a subgraph. With pooling, the innermost dimension enumerates the indices of a bag. All indices
+///                     must be in [0, num_embeddings) range.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an FP32 tensor defined in the
+///                    @a subgraph with the dimensions of the indices tensor followed by embedding_dim, or, with
+///                    pooling, with the innermost dimension of the indices tensor replaced by embedding_dim.
+/// @param flags - binary features of the Embedding Lookup Node. No supported flags are currently defined.
+enum xnn_status xnn_define_embedding_lookup(
+  xnn_subgraph_t subgraph,
+  enum xnn_embedding_pooling pooling,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 1D Global Average Pooling Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1239,6 +1299,19 @@ enum xnn_status xnn_define_elu(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define an Exp Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Exp Node. No supported flags are currently defined.
+enum xnn_status xnn_define_exp(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Floor Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1252,6 +1325,20 @@ enum xnn_status xnn_define_floor(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a GELU Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the GELU Node. The only currently supported flag is
+///                XNN_FLAG_TANH_APPROXIMATION.
+enum xnn_status xnn_define_gelu(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a HardSwish Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1265,6 +1352,36 @@ enum xnn_status xnn_define_hardswish(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Layer Normalization Node and add it to a Subgraph.
+///
+/// The Node normalizes the input tensor to zero mean and unit variance over the reduction axes, and then scales and
+/// offsets the result element-wise: output = (input - mean) / sqrt(variance + epsilon) * gamma + beta.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which normalization statistics are computed.
+/// @param reduction_axes - axes along which normalization statistics are computed. The axes must be sorted in
+///                         increasing order and, ignoring dimensions of size 1, must be the innermost dimensions of the
+///                         input tensor.
+/// @param epsilon - non-negative constant added to the variance for numerical stability.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param gamma_id - Value ID for the scale tensor. The scale tensor must be a static FP32 tensor defined in the
+///                   @a subgraph, with as many elements as there are in the reduced dimensions of the input tensor.
+/// @param beta_id - Value ID for the offset tensor, or XNN_INVALID_VALUE_ID if the Node has no offset. If present, the
+///                  offset tensor must be a static FP32 tensor with the same number of elements as the scale tensor.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Layer Normalization Node. No supported flags are currently defined.
+enum xnn_status xnn_define_layer_norm(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Leaky ReLU Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1293,6 +1410,33 @@ enum xnn_status xnn_define_negate(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Root-Mean-Square Normalization Node and add it to a Subgraph.
+///
+/// The Node scales the input tensor to unit root-mean-square over the reduction axes, and then scales the result
+/// element-wise: output = input / sqrt(mean(input * input) + epsilon) * gamma.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which normalization statistics are computed.
+/// @param reduction_axes - axes along which normalization statistics are computed. The axes must be sorted in
+///                         increasing order and, ignoring dimensions of size 1, must be the innermost dimensions of the
+///                         input tensor.
+/// @param epsilon - non-negative constant added to the mean square for numerical stability.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param gamma_id - Value ID for the scale tensor. The scale tensor must be a static FP32 tensor defined in the
+///                   @a subgraph, with as many elements as there are in the reduced dimensions of the input tensor.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the RMS Normalization Node. No supported flags are currently defined.
+enum xnn_status xnn_define_rms_norm(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Sigmoid Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1306,6 +1450,19 @@ enum xnn_status xnn_define_sigmoid(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a SiLU Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the SiLU Node. No supported flags are currently defined.
+enum xnn_status xnn_define_silu(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a SoftMax Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1367,6 +1524,19 @@ enum xnn_status xnn_define_square_root(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Tanh Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Tanh Node. No supported flags are currently defined.
+enum xnn_status xnn_define_tanh(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Static Slice Node add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1386,6 +1556,42 @@ enum xnn_status xnn_define_static_slice(
   uint32_t output_id,
   uint32_t flags);
 
+/// Type of the reduction applied by Static Reduce Nodes and Reduce operators.
+enum xnn_reduce_operator {
+  xnn_reduce_invalid = -1,
+  /// Sum of the elements.
+  xnn_reduce_sum,
+  /// Arithmetic mean of the elements.
+  xnn_reduce_mean,
+  /// Maximum of the elements.
+  xnn_reduce_max,
+  /// Minimum of the elements.
+  xnn_reduce_min,
+  /// Square root of the sum of squared elements.
+  xnn_reduce_l2,
+};
+
+/// Define a Static Reduce Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param reduce_operator - type of reduction to apply.
+/// @param num_reduction_axes - number of axes along which the reduction is computed.
+/// @param reduction_axes - axes along which the reduction is computed. This array must have @a num_reduction_axes
+///                         elements, sorted in ascending order, without duplicates.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph. With the
+///                    XNN_FLAG_KEEP_DIMS flag the reduced dimensions are retained with length 1, otherwise they are
+///                    removed from the output shape.
+/// @param flags - binary features of the Static Reduce Node. The only currently supported value is XNN_FLAG_KEEP_DIMS.
+enum xnn_status xnn_define_static_reduce(
+  xnn_subgraph_t subgraph,
+  enum xnn_reduce_operator reduce_operator,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Static Transpose Node and add it to a Subgraph.
 ///
 /// The Static Transpose Node applies a generalized transpose to the input tensor using the permuation in perm.
@@ -1419,6 +1625,34 @@ enum xnn_status xnn_create_weights_cache(xnn_weights_cache_t* weights_cache_out)
 ///                            different Runtime objects.
 enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cache_t* weights_cache_out);
 
+/// Create a weights cache object specifying the initial size of weights cache (in bytes) and its memory policy.
+/// @size - initial capacity of the weights cache (in bytes), i.e. it can hold size bytes without growing.
+/// @param memory_flags - memory policy of the weights cache. Supported values are any combination of
+///                       XNN_FLAG_HUGE_PAGES, XNN_FLAG_TRANSPARENT_HUGE_PAGES, and XNN_FLAG_PREFAULT_MEMORY.
+/// @param weights_cache_out - pointer to the variable that will be initialized to a handle to the weights cache object
+///                            upon successful return. Once created, the weights cache object can be shared between
+///                            different Runtime objects.
+enum xnn_status xnn_create_weights_cache_with_memory_flags(
+  size_t size,
+  uint32_t memory_flags,
+  xnn_weights_cache_t* weights_cache_out);
+
+/// Memory usage of a weights cache or workspace.
+struct xnn_memory_stats {
+  /// Size of memory (in bytes) allocated.
+  size_t allocated_bytes;
+  /// Size of allocated memory (in bytes) backed by huge pages, explicit or transparent. Transparent huge pages are
+  /// counted as reported by the system at the time of the query.
+  size_t huge_page_bytes;
+};
+
+/// Query memory usage of a weights cache.
+/// @param weights_cache - the weights cache object to query.
+/// @param stats_out - pointer to the structure that will be filled with memory usage of the weights cache.
+enum xnn_status xnn_get_weights_cache_memory_stats(
+  xnn_weights_cache_t weights_cache,
+  struct xnn_memory_stats* stats_out);
+
 
 /// Weights cache can be finalized in these ways:
 enum xnn_weights_cache_finalization_kind {
@@ -1449,6 +1683,17 @@ typedef struct xnn_workspace* xnn_workspace_t;
 ///                        successful return. Once created, the workspace can be shared between different Runtime
 ///                        objects.
 enum xnn_status xnn_create_workspace(xnn_workspace_t* workspace_out);
+/// Create a workspace object with a memory policy.
+/// @param memory_flags - memory policy of the workspace. Supported values are any combination of XNN_FLAG_HUGE_PAGES,
+///                       XNN_FLAG_TRANSPARENT_HUGE_PAGES, and XNN_FLAG_PREFAULT_MEMORY.
+/// @param workspace_out - pointer to the variable that will be initialized to a handle to the workspace object upon
+///                        successful return. Once created, the workspace can be shared between different Runtime
+///                        objects.
+enum xnn_status xnn_create_workspace_with_memory_flags(uint32_t memory_flags, xnn_workspace_t* workspace_out);
+/// Query memory usage of a workspace.
+/// @param workspace - the workspace object to query.
+/// @param stats_out - pointer to the structure that will be filled with memory usage of the workspace.
+enum xnn_status xnn_get_workspace_memory_stats(xnn_workspace_t workspace, struct xnn_memory_stats* stats_out);
 /// Destroy a workspace object, as well as memory used by the workspace. Object destruction can be deferred until all
 /// Runtime objects created with this workspace are destroyed.
 /// @param workspace - the workspace object to destroy.
@@ -1903,6 +2148,96 @@ enum xnn_status xnn_run_elu_nc_f32(
   uint32_t flags,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_embedding_lookup_nc_f16_f32(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const void* table,
+  enum xnn_embedding_pooling pooling,
+  uint32_t flags,
+  xnn_operator_t* embedding_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_f16_f32(
+  xnn_operator_t embedding_op,
+  size_t batch_size,
+  size_t bag_size,
+  const int32_t* indices,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_embedding_lookup_nc_f32(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const float* table,
+  enum xnn_embedding_pooling pooling,
+  uint32_t flags,
+  xnn_operator_t* embedding_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_f32(
+  xnn_operator_t embedding_op,
+  size_t batch_size,
+  size_t bag_size,
+  const int32_t* indices,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_embedding_lookup_nc_qc4_f32(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const void* table,
+  const float* table_scale,
+  enum xnn_embedding_pooling pooling,
+  uint32_t flags,
+  xnn_operator_t* embedding_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_qc4_f32(
+  xnn_operator_t embedding_op,
+  size_t batch_size,
+  size_t bag_size,
+  const int32_t* indices,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_embedding_lookup_nc_qc8_f32(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const int8_t* table,
+  const float* table_scale,
+  enum xnn_embedding_pooling pooling,
+  uint32_t flags,
+  xnn_operator_t* embedding_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_qc8_f32(
+  xnn_operator_t embedding_op,
+  size_t batch_size,
+  size_t bag_size,
+  const int32_t* indices,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_exp_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* exp_op_out);
+
+enum xnn_status xnn_setup_exp_nc_f32(
+  xnn_operator_t exp_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_run_exp_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_floor_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1947,6 +2282,59 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+/// Create a Fully Connected operator with FP32 inputs and outputs and channelwise quantized INT8 weights.
+///
+/// Every row of inputs is quantized to INT8 with its own scale and zero point when the operator runs, and the INT32
+/// accumulators are dequantized with the row scale times the channel scale.
+///
+/// @param kernel_scale - per-output-channel scales of the INT8 kernel, output_channels elements.
+/// @param kernel - INT8 kernel in [output_channels, input_channels] layout. XNN_FLAG_TRANSPOSE_WEIGHTS is not supported.
+/// @param bias - optional FP32 bias, output_channels elements.
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_gelu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* gelu_op_out);
+
+enum xnn_status xnn_setup_gelu_nc_f32(
+  xnn_operator_t gelu_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_run_gelu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f32(
   size_t channels,
   size_t input_stride,
@@ -1988,6 +2376,24 @@ enum xnn_status xnn_run_hardswish_nc_f32(
   uint32_t flags,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_layer_norm_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const float* gamma,
+  const float* beta,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* layer_norm_op_out);
+
+enum xnn_status xnn_setup_layer_norm_nc_f32(
+  xnn_operator_t layer_norm_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_leaky_relu_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2168,6 +2574,32 @@ enum xnn_status xnn_setup_prelu_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_reduce_nd_f32(
+  enum xnn_reduce_operator reduce_operator,
+  uint32_t flags,
+  xnn_operator_t* reduce_op_out);
+
+enum xnn_status xnn_setup_reduce_nd_f32(
+  xnn_operator_t reduce_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_run_reduce_nd_f32(
+  enum xnn_reduce_operator reduce_operator,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_resize_bilinear2d_nhwc_f32(
   size_t channels,
   size_t input_pixel_stride,
@@ -2186,6 +2618,23 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_rms_norm_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const float* gamma,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* rms_norm_op_out);
+
+enum xnn_status xnn_setup_rms_norm_nc_f32(
+  xnn_operator_t rms_norm_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_sigmoid_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2210,6 +2659,30 @@ enum xnn_status xnn_run_sigmoid_nc_f32(
   uint32_t flags,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_silu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* silu_op_out);
+
+enum xnn_status xnn_setup_silu_nc_f32(
+  xnn_operator_t silu_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_run_silu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_softmax_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2330,6 +2803,30 @@ enum xnn_status xnn_run_subtract_nd_f32(
   uint32_t flags,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_tanh_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* tanh_op_out);
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+  xnn_operator_t tanh_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_run_tanh_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_truncation_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2818,6 +3315,20 @@ enum xnn_status xnn_setup_elu_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_exp_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* exp_op_out);
+
+enum xnn_status xnn_setup_exp_nc_f16(
+  xnn_operator_t exp_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_floor_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -2852,6 +3363,20 @@ enum xnn_status xnn_setup_fully_connected_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_gelu_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* gelu_op_out);
+
+enum xnn_status xnn_setup_gelu_nc_f16(
+  xnn_operator_t gelu_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f16(
   size_t channels,
   size_t input_stride,
@@ -2883,6 +3408,24 @@ enum xnn_status xnn_setup_hardswish_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_layer_norm_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const void* gamma,
+  const void* beta,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* layer_norm_op_out);
+
+enum xnn_status xnn_setup_layer_norm_nc_f16(
+  xnn_operator_t layer_norm_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_leaky_relu_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -3021,6 +3564,23 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_rms_norm_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const void* gamma,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* rms_norm_op_out);
+
+enum xnn_status xnn_setup_rms_norm_nc_f16(
+  xnn_operator_t rms_norm_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_sigmoid_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -3035,6 +3595,20 @@ enum xnn_status xnn_setup_sigmoid_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_silu_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* silu_op_out);
+
+enum xnn_status xnn_setup_silu_nc_f16(
+  xnn_operator_t silu_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_softmax_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -3109,6 +3683,20 @@ enum xnn_status xnn_setup_subtract_nd_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_tanh_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* tanh_op_out);
+
+enum xnn_status xnn_setup_tanh_nc_f16(
+  xnn_operator_t tanh_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_truncation_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -3599,6 +4187,30 @@ enum xnn_status xnn_run_multiply_nd_qs8(
   uint32_t flags,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_layer_norm_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  int8_t input_zero_point,
+  float input_scale,
+  const float* gamma,
+  const float* beta,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* layer_norm_op_out);
+
+enum xnn_status xnn_setup_layer_norm_nc_qs8(
+  xnn_operator_t layer_norm_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_leaky_relu_nc_qs8(
   size_t channels,
   size_t input_stride,
@@ -3618,6 +4230,29 @@ enum xnn_status xnn_setup_leaky_relu_nc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_rms_norm_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  int8_t input_zero_point,
+  float input_scale,
+  const float* gamma,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* rms_norm_op_out);
+
+enum xnn_status xnn_setup_rms_norm_nc_qs8(
+  xnn_operator_t rms_norm_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_sigmoid_nc_qs8(
   size_t channels,
   size_t input_stride,
@@ -108,7 +108,17 @@ ALL_AVX_MICROKERNEL_SRCS = [
     "src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-x16.c",
     "src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-x24.c",
     "src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-x32.c",
+    "src/f32-reduce/gen/f32-rdmax-avx-c32.c",
+    "src/f32-reduce/gen/f32-rdmin-avx-c32.c",
+    "src/f32-reduce/gen/f32-rdsum-avx-c32.c",
+    "src/f32-reduce/gen/f32-rdsumsq-avx-c32.c",
+    "src/f32-reduce/gen/f32-rmax-avx-x32.c",
+    "src/f32-reduce/gen/f32-rmin-avx-x32.c",
+    "src/f32-reduce/gen/f32-rminmax-avx-x32.c",
+    "src/f32-reduce/gen/f32-rsum-avx-x32.c",
+    "src/f32-reduce/gen/f32-rsumsq-avx-x32.c",
     "src/f32-rmax/f32-rmax-avx.c",
+    "src/f32-rnorm/f32-rnorm-avx-x16.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-avx-x8.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-avx-x16.c",
     "src/f32-vbinary/gen/f32-vaddc-minmax-avx-x8.c",
@@ -517,8 +527,14 @@ ALL_AVX2_MICROKERNEL_SRCS = [
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-x96-acc3.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-x96-acc6.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-x96.c",
+    "src/f16-vapproxgelu/gen/f16-vapproxgelu-avx2-rational-13-6-div-x8.c",
+    "src/f16-vapproxgelu/gen/f16-vapproxgelu-avx2-rational-13-6-div-x16.c",
     "src/f16-velu/gen/f16-velu-avx2-rr1-p3-x8.c",
     "src/f16-velu/gen/f16-velu-avx2-rr1-p3-x16.c",
+    "src/f16-vexp/gen/f16-vexp-avx2-rr2-p5-x8.c",
+    "src/f16-vexp/gen/f16-vexp-avx2-rr2-p5-x16.c",
+    "src/f16-vgelu/gen/f16-vgelu-avx2-rational-13-8-div-x8.c",
+    "src/f16-vgelu/gen/f16-vgelu-avx2-rational-13-8-div-x16.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-div-x8.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-div-x16.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-div-x24.c",
@@ -535,6 +551,10 @@ ALL_AVX2_MICROKERNEL_SRCS = [
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-rcp-x48.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-rcp-x56.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-rcp-x64.c",
+    "src/f16-vsilu/gen/f16-vsilu-avx2-rr2-p5-div-x8.c",
+    "src/f16-vsilu/gen/f16-vsilu-avx2-rr2-p5-div-x16.c",
+    "src/f16-vtanh/gen/f16-vtanh-avx2-rational-13-6-div-x8.c",
+    "src/f16-vtanh/gen/f16-vtanh-avx2-rational-13-6-div-x16.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-avx2-x16.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-avx2-x32.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-avx2-x48.c",
@@ -619,6 +639,8 @@ ALL_AVX2_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-avx2-rr1-p6-x64.c",
     "src/f32-velu/gen/f32-velu-avx2-rr1-p6-x72.c",
     "src/f32-velu/gen/f32-velu-avx2-rr1-p6-x80.c",
+    "src/f32-vexp/gen/f32-vexp-avx2-rr2-p5-x8.c",
+    "src/f32-vexp/gen/f32-vexp-avx2-rr2-p5-x16.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-x8.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-x16.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-x24.c",
@@ -673,6 +695,8 @@ ALL_AVX2_MICROKERNEL_SRCS = [
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx2-rr1-p5-nr2fma-x64.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx2-rr1-p5-nr2fma-x72.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx2-rr1-p5-nr2fma-x80.c",
+    "src/f32-vsilu/gen/f32-vsilu-avx2-rr2-p5-div-x8.c",
+    "src/f32-vsilu/gen/f32-vsilu-avx2-rr2-p5-div-x16.c",
     "src/math/f16-expm1minus-avx2-rr1-p2.c",
     "src/math/f16-expm1minus-avx2-rr1-p3.c",
     "src/math/f16-expminus-avx2-rr1-p2.c",
@@ -898,7 +922,18 @@ ALL_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr1-p5-scalef-x192-acc3.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr1-p5-scalef-x192-acc6.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr1-p5-scalef-x192.c",
+    "src/f32-reduce/gen/f32-rdmax-avx512f-c64.c",
+    "src/f32-reduce/gen/f32-rdmin-avx512f-c64.c",
+    "src/f32-reduce/gen/f32-rdsum-avx512f-c64.c",
+    "src/f32-reduce/gen/f32-rdsumsq-avx512f-c64.c",
+    "src/f32-reduce/gen/f32-rmax-avx512f-x64.c",
+    "src/f32-reduce/gen/f32-rmin-avx512f-x64.c",
+    "src/f32-reduce/gen/f32-rsum-avx512f-x64.c",
+    "src/f32-reduce/gen/f32-rsumsq-avx512f-x64.c",
     "src/f32-rmax/f32-rmax-avx512f.c",
+    "src/f32-rnorm/f32-rnorm-avx512f-x32.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-avx512f-rational-13-6-div-x16.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-avx512f-rational-13-6-div-x32.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-avx512f-x16.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-avx512f-x32.c",
     "src/f32-vbinary/gen/f32-vaddc-minmax-avx512f-x16.c",
@@ -949,6 +984,10 @@ ALL_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-avx512f-rr1-p6-x96.c",
     "src/f32-velu/gen/f32-velu-avx512f-rr1-p6-x112.c",
     "src/f32-velu/gen/f32-velu-avx512f-rr1-p6-x128.c",
+    "src/f32-vexp/gen/f32-vexp-avx512f-rr2-p5-scalef-x16.c",
+    "src/f32-vexp/gen/f32-vexp-avx512f-rr2-p5-scalef-x32.c",
+    "src/f32-vgelu/gen/f32-vgelu-avx512f-rational-13-8-div-x16.c",
+    "src/f32-vgelu/gen/f32-vgelu-avx512f-rational-13-8-div-x32.c",
     "src/f32-vhswish/gen/f32-vhswish-avx512f-x16.c",
     "src/f32-vhswish/gen/f32-vhswish-avx512f-x32.c",
     "src/f32-vlrelu/gen/f32-vlrelu-avx512f-x16.c",
@@ -1035,6 +1074,8 @@ ALL_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx512f-rr2-lut32-p2-perm2-scalef-nr1fma-x96.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx512f-rr2-lut32-p2-perm2-scalef-nr1fma-x112.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx512f-rr2-lut32-p2-perm2-scalef-nr1fma-x128.c",
+    "src/f32-vsilu/gen/f32-vsilu-avx512f-rr1-p5-scalef-div-x16.c",
+    "src/f32-vsilu/gen/f32-vsilu-avx512f-rr1-p5-scalef-div-x32.c",
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-nr1fma1adj-x16.c",
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-nr1fma1adj-x32.c",
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-nr1fma1adj-x48.c",
@@ -1043,6 +1084,8 @@ ALL_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-nr1fma1adj-x96.c",
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-nr1fma1adj-x112.c",
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-nr1fma1adj-x128.c",
+    "src/f32-vtanh/gen/f32-vtanh-avx512f-rational-13-6-div-x16.c",
+    "src/f32-vtanh/gen/f32-vtanh-avx512f-rational-13-6-div-x32.c",
     "src/f32-vunary/gen/f32-vabs-avx512f-x16.c",
     "src/f32-vunary/gen/f32-vabs-avx512f-x32.c",
     "src/f32-vunary/gen/f32-vneg-avx512f-x16.c",
@@ -1175,6 +1218,7 @@ ALL_AVX512VBMI_MICROKERNEL_SRCS = [
 ALL_F16C_MICROKERNEL_SRCS = [
     "src/f16-avgpool/f16-avgpool-9p8x-minmax-f16c-c8.c",
     "src/f16-avgpool/f16-avgpool-9x-minmax-f16c-c8.c",
+    "src/f16-f32-embedding/f16-f32-embedding-f16c-c16.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-f16c-x8.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-f16c-x16.c",
     "src/f16-gavgpool/gen/f16-gavgpool-7p7x-minmax-f16c-c8.c",
@@ -1189,6 +1233,7 @@ ALL_F16C_MICROKERNEL_SRCS = [
     "src/f16-prelu/gen/f16-prelu-f16c-2x8.c",
     "src/f16-prelu/gen/f16-prelu-f16c-2x16.c",
     "src/f16-rmax/f16-rmax-f16c.c",
+    "src/f16-rnorm/f16-rnorm-f16c-x16.c",
     "src/f16-vbinary/gen/f16-vadd-minmax-f16c-x8.c",
     "src/f16-vbinary/gen/f16-vadd-minmax-f16c-x16.c",
     "src/f16-vbinary/gen/f16-vaddc-minmax-f16c-x8.c",
@@ -1374,6 +1419,10 @@ ALL_FMA3_MICROKERNEL_SRCS = [
     "src/f32-igemm/gen/f32-igemm-6x8-minmax-fma3-broadcast.c",
     "src/f32-igemm/gen/f32-igemm-7x8-minmax-fma3-broadcast.c",
     "src/f32-igemm/gen/f32-igemm-8x8-minmax-fma3-broadcast.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-fma3-rational-13-6-div-x8.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-fma3-rational-13-6-div-x16.c",
+    "src/f32-vgelu/gen/f32-vgelu-fma3-rational-13-8-div-x8.c",
+    "src/f32-vgelu/gen/f32-vgelu-fma3-rational-13-8-div-x16.c",
     "src/f32-vhswish/gen/f32-vhswish-fma3-x8.c",
     "src/f32-vhswish/gen/f32-vhswish-fma3-x16.c",
     "src/f32-vsqrt/gen/f32-vsqrt-fma3-nr1fma1adj-x8.c",
@@ -1384,6 +1433,8 @@ ALL_FMA3_MICROKERNEL_SRCS = [
     "src/f32-vsqrt/gen/f32-vsqrt-fma3-nr1fma1adj-x48.c",
     "src/f32-vsqrt/gen/f32-vsqrt-fma3-nr1fma1adj-x56.c",
     "src/f32-vsqrt/gen/f32-vsqrt-fma3-nr1fma1adj-x64.c",
+    "src/f32-vtanh/gen/f32-vtanh-fma3-rational-13-6-div-x8.c",
+    "src/f32-vtanh/gen/f32-vtanh-fma3-rational-13-6-div-x16.c",
     "src/math/f16-tanh-fma3-p17.c",
     "src/math/f16-tanh-fma3-p19.c",
     "src/math/f32-sqrt-fma3-nr1fma1adj.c",
@@ -1571,6 +1622,7 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/f32-dwconv/gen/f32-dwconv-25p8c-minmax-neon.c",
     "src/f32-dwconv/gen/f32-dwconv-25p16c-minmax-neon-acc2.c",
     "src/f32-dwconv/gen/f32-dwconv-25p16c-minmax-neon.c",
+    "src/f32-embedding/f32-embedding-neon-c16.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-neon-x8.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-neon-x16.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-neon-x24.c",
@@ -1678,7 +1730,17 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-neon-rr2-p5-x20-acc2.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-neon-rr2-p5-x20-acc5.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-neon-rr2-p5-x20.c",
+    "src/f32-reduce/gen/f32-rdmax-neon-c16.c",
+    "src/f32-reduce/gen/f32-rdmin-neon-c16.c",
+    "src/f32-reduce/gen/f32-rdsum-neon-c16.c",
+    "src/f32-reduce/gen/f32-rdsumsq-neon-c16.c",
+    "src/f32-reduce/gen/f32-rmax-neon-x16.c",
+    "src/f32-reduce/gen/f32-rmin-neon-x16.c",
+    "src/f32-reduce/gen/f32-rminmax-neon-x16.c",
+    "src/f32-reduce/gen/f32-rsum-neon-x16.c",
+    "src/f32-reduce/gen/f32-rsumsq-neon-x16.c",
     "src/f32-rmax/f32-rmax-neon.c",
+    "src/f32-rnorm/f32-rnorm-neon-x8.c",
     "src/f32-spmm/gen/f32-spmm-4x1-minmax-neon-pipelined.c",
     "src/f32-spmm/gen/f32-spmm-4x1-minmax-neon-x2.c",
     "src/f32-spmm/gen/f32-spmm-4x1-minmax-neon.c",
@@ -1692,6 +1754,8 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/f32-spmm/gen/f32-spmm-32x1-minmax-neon-pipelined.c",
     "src/f32-spmm/gen/f32-spmm-32x1-minmax-neon-x2.c",
     "src/f32-spmm/gen/f32-spmm-32x1-minmax-neon.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-neon-rational-13-6-nr2recps-x4.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-neon-rational-13-6-nr2recps-x8.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-neon-x4.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-neon-x8.c",
     "src/f32-vbinary/gen/f32-vaddc-minmax-neon-x4.c",
@@ -1732,6 +1796,10 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-neon-rr2-p6-x16.c",
     "src/f32-velu/gen/f32-velu-neon-rr2-p6-x20.c",
     "src/f32-velu/gen/f32-velu-neon-rr2-p6-x24.c",
+    "src/f32-vexp/gen/f32-vexp-neon-rr2-p5-x4.c",
+    "src/f32-vexp/gen/f32-vexp-neon-rr2-p5-x8.c",
+    "src/f32-vgelu/gen/f32-vgelu-neon-rational-13-8-nr2recps-x4.c",
+    "src/f32-vgelu/gen/f32-vgelu-neon-rational-13-8-nr2recps-x8.c",
     "src/f32-vhswish/gen/f32-vhswish-neon-x4.c",
     "src/f32-vhswish/gen/f32-vhswish-neon-x8.c",
     "src/f32-vhswish/gen/f32-vhswish-neon-x16.c",
@@ -1767,6 +1835,10 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-p5-nr2recps-x16.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-p5-nr2recps-x20.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-p5-nr2recps-x24.c",
+    "src/f32-vsilu/gen/f32-vsilu-neon-rr2-p5-nr2recps-x4.c",
+    "src/f32-vsilu/gen/f32-vsilu-neon-rr2-p5-nr2recps-x8.c",
+    "src/f32-vtanh/gen/f32-vtanh-neon-rational-13-6-nr2recps-x4.c",
+    "src/f32-vtanh/gen/f32-vtanh-neon-rational-13-6-nr2recps-x8.c",
     "src/f32-vunary/gen/f32-vabs-neon-x4.c",
     "src/f32-vunary/gen/f32-vabs-neon-x8.c",
     "src/f32-vunary/gen/f32-vneg-neon-x4.c",
@@ -1799,6 +1871,7 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/math/f32-sqrt-neon-nr3rsqrts.c",
     "src/math/f32-tanh-neon-expm1-rr1-p6-nr2recps.c",
     "src/math/f32-tanh-neon-expm1-rr2-p6-nr2recps.c",
+    "src/qc4-f32-embedding/qc4-f32-embedding-neon-c16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p8c-minmax-fp32-neon-mla8-ld64.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p16c-minmax-fp32-neon-mla8-ld64.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p16c-minmax-fp32-neon-mla8-ld128.c",
@@ -1822,6 +1895,7 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/qc8-dwconv/gen/qc8-dwconv-25p16c-minmax-fp32-neon-mul16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-25p24c-minmax-fp32-neon-mul16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-25p32c-minmax-fp32-neon-mul16.c",
+    "src/qc8-f32-embedding/qc8-f32-embedding-neon-c16.c",
     "src/qc8-gemm/gen/qc8-gemm-1x8-minmax-fp32-neon-mlal-lane-prfm.c",
     "src/qc8-gemm/gen/qc8-gemm-1x8-minmax-fp32-neon-mlal-lane.c",
     "src/qc8-gemm/gen/qc8-gemm-1x8c2-minmax-fp32-neon-mlal-dup.c",
@@ -1902,6 +1976,8 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/qc8-igemm/gen/qc8-igemm-6x8-minmax-fp32-neon-mlal-lane.c",
     "src/qc8-igemm/gen/qc8-igemm-6x16-minmax-fp32-neon-mlal-lane-prfm.c",
     "src/qc8-igemm/gen/qc8-igemm-6x16-minmax-fp32-neon-mlal-lane.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x8c8-minmax-neon-mull.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-2x8c8-minmax-neon-mull.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-fp32-neon-mul16.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-rndnu-neon-mla8-ld64.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-rndnu-neon-mul8-ld64.c",
@@ -2391,6 +2467,7 @@ ALL_NEON_MICROKERNEL_SRCS = [
     "src/qs8-requantization/qs8-requantization-rndna-neon.c",
     "src/qs8-requantization/qs8-requantization-rndnu-neon-mull.c",
     "src/qs8-requantization/qs8-requantization-rndnu-neon-qdmulh.c",
+    "src/qs8-rnorm/qs8-rnorm-neon-x16.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-neon-ld64-x8.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-neon-ld64-x16.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-neon-ld64-x24.c",
@@ -2870,6 +2947,8 @@ ALL_NEONFMA_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-neonfma-rr1-p6-x16.c",
     "src/f32-velu/gen/f32-velu-neonfma-rr1-p6-x20.c",
     "src/f32-velu/gen/f32-velu-neonfma-rr1-p6-x24.c",
+    "src/f32-vexp/gen/f32-vexp-neonfma-rr2-p5-x4.c",
+    "src/f32-vexp/gen/f32-vexp-neonfma-rr2-p5-x8.c",
     "src/f32-vmulcaddc/gen/f32-vmulcaddc-c4-minmax-neonfma-2x.c",
     "src/f32-vmulcaddc/gen/f32-vmulcaddc-c8-minmax-neonfma-2x.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-neonfma-rr1-lut64-p2-nr1recps1fma-x4.c",
@@ -3064,6 +3143,10 @@ ALL_NEONFMA_AARCH64_MICROKERNEL_SRCS = [
     "src/f32-spmm/gen/f32-spmm-16x4-minmax-aarch64-neonfma.c",
     "src/f32-spmm/gen/f32-spmm-32x2-minmax-aarch64-neonfma.c",
     "src/f32-spmm/gen/f32-spmm-32x4-minmax-aarch64-neonfma.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-aarch64-neonfma-rational-13-6-div-x4.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-aarch64-neonfma-rational-13-6-div-x8.c",
+    "src/f32-vgelu/gen/f32-vgelu-aarch64-neonfma-rational-13-8-div-x4.c",
+    "src/f32-vgelu/gen/f32-vgelu-aarch64-neonfma-rational-13-8-div-x8.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-aarch64-neonfma-rr1-lut64-p2-div-x4.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-aarch64-neonfma-rr1-lut64-p2-div-x8.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-aarch64-neonfma-rr1-lut64-p2-div-x12.c",
@@ -3082,6 +3165,10 @@ ALL_NEONFMA_AARCH64_MICROKERNEL_SRCS = [
     "src/f32-vsigmoid/gen/f32-vsigmoid-aarch64-neonfma-rr1-p5-div-x16.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-aarch64-neonfma-rr1-p5-div-x20.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-aarch64-neonfma-rr1-p5-div-x24.c",
+    "src/f32-vsilu/gen/f32-vsilu-aarch64-neonfma-rr2-p5-div-x4.c",
+    "src/f32-vsilu/gen/f32-vsilu-aarch64-neonfma-rr2-p5-div-x8.c",
+    "src/f32-vtanh/gen/f32-vtanh-aarch64-neonfma-rational-13-6-div-x4.c",
+    "src/f32-vtanh/gen/f32-vtanh-aarch64-neonfma-rational-13-6-div-x8.c",
     "src/math/f32-sigmoid-aarch64-neonfma-rr1-lut64-p2-div.c",
     "src/math/f32-sigmoid-aarch64-neonfma-rr1-lut2048-p1-div.c",
     "src/math/f32-sigmoid-aarch64-neonfma-rr1-p5-div.c",
@@ -3092,6 +3179,7 @@ ALL_NEONFMA_AARCH64_MICROKERNEL_SRCS = [
 ]
 
 ALL_NEONFP16_MICROKERNEL_SRCS = [
+    "src/f16-f32-embedding/f16-f32-embedding-neonfp16-c16.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-neonfp16-x8.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-neonfp16-x16.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-neonfp16-x8.c",
@@ -3234,6 +3322,7 @@ ALL_NEONFP16ARITH_MICROKERNEL_SRCS = [
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-neonfp16arith-rr2-p2-x96-acc6.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-neonfp16arith-rr2-p2-x96.c",
     "src/f16-rmax/f16-rmax-neonfp16arith.c",
+    "src/f16-rnorm/f16-rnorm-neonfp16arith-x16.c",
     "src/f16-spmm/gen/f16-spmm-8x1-minmax-neonfp16arith-pipelined.c",
     "src/f16-spmm/gen/f16-spmm-8x1-minmax-neonfp16arith-x2.c",
     "src/f16-spmm/gen/f16-spmm-8x1-minmax-neonfp16arith.c",
@@ -3246,6 +3335,8 @@ ALL_NEONFP16ARITH_MICROKERNEL_SRCS = [
     "src/f16-spmm/gen/f16-spmm-32x1-minmax-neonfp16arith-pipelined.c",
     "src/f16-spmm/gen/f16-spmm-32x1-minmax-neonfp16arith-x2.c",
     "src/f16-spmm/gen/f16-spmm-32x1-minmax-neonfp16arith.c",
+    "src/f16-vapproxgelu/gen/f16-vapproxgelu-neonfp16arith-rational-13-6-nr1recps-x8.c",
+    "src/f16-vapproxgelu/gen/f16-vapproxgelu-neonfp16arith-rational-13-6-nr1recps-x16.c",
     "src/f16-vbinary/gen/f16-vadd-minmax-neonfp16arith-x8.c",
     "src/f16-vbinary/gen/f16-vadd-minmax-neonfp16arith-x16.c",
     "src/f16-vbinary/gen/f16-vaddc-minmax-neonfp16arith-x8.c",
@@ -3276,6 +3367,10 @@ ALL_NEONFP16ARITH_MICROKERNEL_SRCS = [
     "src/f16-vclamp/gen/f16-vclamp-neonfp16arith-x16.c",
     "src/f16-velu/gen/f16-velu-neonfp16arith-rr1-p3-x8.c",
     "src/f16-velu/gen/f16-velu-neonfp16arith-rr1-p3-x16.c",
+    "src/f16-vexp/gen/f16-vexp-neonfp16arith-rr2-p5-x8.c",
+    "src/f16-vexp/gen/f16-vexp-neonfp16arith-rr2-p5-x16.c",
+    "src/f16-vgelu/gen/f16-vgelu-neonfp16arith-rational-13-8-nr1recps-x8.c",
+    "src/f16-vgelu/gen/f16-vgelu-neonfp16arith-rational-13-8-nr1recps-x16.c",
     "src/f16-vhswish/gen/f16-vhswish-neonfp16arith-x8.c",
     "src/f16-vhswish/gen/f16-vhswish-neonfp16arith-x16.c",
     "src/f16-vlrelu/gen/f16-vlrelu-neonfp16arith-x8.c",
@@ -3306,10 +3401,14 @@ ALL_NEONFP16ARITH_MICROKERNEL_SRCS = [
     "src/f16-vsigmoid/gen/f16-vsigmoid-neonfp16arith-rr2-p2-nr1recps-x48.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-neonfp16arith-rr2-p2-nr1recps-x56.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-neonfp16arith-rr2-p2-nr1recps-x64.c",
+    "src/f16-vsilu/gen/f16-vsilu-neonfp16arith-rr2-p5-nr1recps-x8.c",
+    "src/f16-vsilu/gen/f16-vsilu-neonfp16arith-rr2-p5-nr1recps-x16.c",
     "src/f16-vsqrt/gen/f16-vsqrt-neonfp16arith-nr1fma1adj-x8.c",
     "src/f16-vsqrt/gen/f16-vsqrt-neonfp16arith-nr1fma1adj-x16.c",
     "src/f16-vsqrt/gen/f16-vsqrt-neonfp16arith-nr1fma1adj-x24.c",
     "src/f16-vsqrt/gen/f16-vsqrt-neonfp16arith-nr1fma1adj-x32.c",
+    "src/f16-vtanh/gen/f16-vtanh-neonfp16arith-rational-13-6-nr1recps-x8.c",
+    "src/f16-vtanh/gen/f16-vtanh-neonfp16arith-rational-13-6-nr1recps-x16.c",
     "src/f16-vunary/gen/f16-vabs-neonfp16arith-x8.c",
     "src/f16-vunary/gen/f16-vabs-neonfp16arith-x16.c",
     "src/f16-vunary/gen/f16-vneg-neonfp16arith-x8.c",
@@ -3622,6 +3721,7 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/cs16-vsquareabs/gen/cs16-vsquareabs-scalar-x2.c",
     "src/cs16-vsquareabs/gen/cs16-vsquareabs-scalar-x3.c",
     "src/cs16-vsquareabs/gen/cs16-vsquareabs-scalar-x4.c",
+    "src/f16-f32-embedding/f16-f32-embedding-scalar-c4.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-scalar-x1.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-scalar-x2.c",
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-scalar-x3.c",
@@ -3724,6 +3824,7 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/f32-dwconv/gen/f32-dwconv-25p2c-minmax-scalar.c",
     "src/f32-dwconv/gen/f32-dwconv-25p2c-scalar-acc2.c",
     "src/f32-dwconv/gen/f32-dwconv-25p2c-scalar.c",
+    "src/f32-embedding/f32-embedding-scalar-c4.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-scalar-bitcast-x1.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-scalar-bitcast-x2.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-scalar-bitcast-x3.c",
@@ -3813,7 +3914,17 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-x4-acc2.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-x4-acc4.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-x4.c",
+    "src/f32-reduce/gen/f32-rdmax-scalar-c4.c",
+    "src/f32-reduce/gen/f32-rdmin-scalar-c4.c",
+    "src/f32-reduce/gen/f32-rdsum-scalar-c4.c",
+    "src/f32-reduce/gen/f32-rdsumsq-scalar-c4.c",
+    "src/f32-reduce/gen/f32-rmax-scalar-x4.c",
+    "src/f32-reduce/gen/f32-rmin-scalar-x4.c",
+    "src/f32-reduce/gen/f32-rminmax-scalar-x4.c",
+    "src/f32-reduce/gen/f32-rsum-scalar-x4.c",
+    "src/f32-reduce/gen/f32-rsumsq-scalar-x4.c",
     "src/f32-rmax/f32-rmax-scalar.c",
+    "src/f32-rnorm/f32-rnorm-scalar-x4.c",
     "src/f32-spmm/gen/f32-spmm-1x1-minmax-scalar-pipelined.c",
     "src/f32-spmm/gen/f32-spmm-1x1-minmax-scalar.c",
     "src/f32-spmm/gen/f32-spmm-2x1-minmax-scalar-pipelined.c",
@@ -3824,6 +3935,9 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/f32-spmm/gen/f32-spmm-8x1-minmax-scalar.c",
     "src/f32-spmm/gen/f32-spmm-8x2-minmax-scalar.c",
     "src/f32-spmm/gen/f32-spmm-8x4-minmax-scalar.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-scalar-rational-13-6-div-x1.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-scalar-rational-13-6-div-x2.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-scalar-rational-13-6-div-x4.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-scalar-x1.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-scalar-x2.c",
     "src/f32-vbinary/gen/f32-vadd-minmax-scalar-x4.c",
@@ -3983,6 +4097,12 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-scalar-rr2-p6-x4.c",
     "src/f32-velu/gen/f32-velu-scalar-rr2-p6-x5.c",
     "src/f32-velu/gen/f32-velu-scalar-rr2-p6-x6.c",
+    "src/f32-vexp/gen/f32-vexp-scalar-rr2-p5-x1.c",
+    "src/f32-vexp/gen/f32-vexp-scalar-rr2-p5-x2.c",
+    "src/f32-vexp/gen/f32-vexp-scalar-rr2-p5-x4.c",
+    "src/f32-vgelu/gen/f32-vgelu-scalar-rational-13-8-div-x1.c",
+    "src/f32-vgelu/gen/f32-vgelu-scalar-rational-13-8-div-x2.c",
+    "src/f32-vgelu/gen/f32-vgelu-scalar-rational-13-8-div-x4.c",
     "src/f32-vhswish/gen/f32-vhswish-scalar-x1.c",
     "src/f32-vhswish/gen/f32-vhswish-scalar-x2.c",
     "src/f32-vhswish/gen/f32-vhswish-scalar-x4.c",
@@ -4017,9 +4137,15 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/f32-vsigmoid/gen/f32-vsigmoid-scalar-rr2-p5-div-x1.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-scalar-rr2-p5-div-x2.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-scalar-rr2-p5-div-x4.c",
+    "src/f32-vsilu/gen/f32-vsilu-scalar-rr2-p5-div-x1.c",
+    "src/f32-vsilu/gen/f32-vsilu-scalar-rr2-p5-div-x2.c",
+    "src/f32-vsilu/gen/f32-vsilu-scalar-rr2-p5-div-x4.c",
     "src/f32-vsqrt/gen/f32-vsqrt-scalar-sqrt-x1.c",
     "src/f32-vsqrt/gen/f32-vsqrt-scalar-sqrt-x2.c",
     "src/f32-vsqrt/gen/f32-vsqrt-scalar-sqrt-x4.c",
+    "src/f32-vtanh/gen/f32-vtanh-scalar-rational-13-6-div-x1.c",
+    "src/f32-vtanh/gen/f32-vtanh-scalar-rational-13-6-div-x2.c",
+    "src/f32-vtanh/gen/f32-vtanh-scalar-rational-13-6-div-x4.c",
     "src/f32-vunary/gen/f32-vabs-scalar-x1.c",
     "src/f32-vunary/gen/f32-vabs-scalar-x2.c",
     "src/f32-vunary/gen/f32-vabs-scalar-x4.c",
@@ -4084,6 +4210,7 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/math/u64-sqrt-scalar-cvtu32-sqrt-cvtsatu32f64.c",
     "src/math/u64-sqrt-scalar-cvtu32-sqrt-llrint.c",
     "src/math/u64-sqrt-scalar-cvtu64-sqrt-llrint.c",
+    "src/qc4-f32-embedding/qc4-f32-embedding-scalar-c4.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p1c-minmax-fp32-scalar-fmagic.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p2c-minmax-fp32-scalar-imagic.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p2c-minmax-fp32-scalar-lrintf.c",
@@ -4105,6 +4232,7 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/qc8-dwconv/gen/qc8-dwconv-25p4c-minmax-fp32-scalar-fmagic.c",
     "src/qc8-dwconv/gen/qc8-dwconv-25p4c-minmax-fp32-scalar-imagic.c",
     "src/qc8-dwconv/gen/qc8-dwconv-25p4c-minmax-fp32-scalar-lrintf.c",
+    "src/qc8-f32-embedding/qc8-f32-embedding-scalar-c4.c",
     "src/qc8-gemm/gen/qc8-gemm-1x2-minmax-fp32-scalar-fmagic.c",
     "src/qc8-gemm/gen/qc8-gemm-1x2-minmax-fp32-scalar-imagic.c",
     "src/qc8-gemm/gen/qc8-gemm-1x2-minmax-fp32-scalar-lrintf.c",
@@ -4153,6 +4281,9 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/qc8-igemm/gen/qc8-igemm-4x4-minmax-fp32-scalar-fmagic.c",
     "src/qc8-igemm/gen/qc8-igemm-4x4-minmax-fp32-scalar-imagic.c",
     "src/qc8-igemm/gen/qc8-igemm-4x4-minmax-fp32-scalar-lrintf.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x4-minmax-scalar.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-2x4-minmax-scalar.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-4x4-minmax-scalar.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p1c-minmax-fp32-scalar-fmagic.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p1c-minmax-fp32-scalar-imagic.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p1c-minmax-fp32-scalar-lrintf.c",
@@ -4267,6 +4398,7 @@ ALL_SCALAR_MICROKERNEL_SRCS = [
     "src/qs8-requantization/qs8-requantization-rndna-scalar-unsigned32.c",
     "src/qs8-requantization/qs8-requantization-rndna-scalar-unsigned64.c",
     "src/qs8-requantization/qs8-requantization-rndnu-scalar.c",
+    "src/qs8-rnorm/qs8-rnorm-scalar-x4.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-scalar-x1.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-scalar-x2.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-scalar-x4.c",
@@ -4593,6 +4725,7 @@ ALL_SSE_MICROKERNEL_SRCS = [
     "src/f32-dwconv/gen/f32-dwconv-25p4c-minmax-sse.c",
     "src/f32-dwconv/gen/f32-dwconv-25p8c-minmax-sse-acc2.c",
     "src/f32-dwconv/gen/f32-dwconv-25p8c-minmax-sse.c",
+    "src/f32-embedding/f32-embedding-sse-c16.c",
     "src/f32-gavgpool-cw/f32-gavgpool-cw-sse-x4.c",
     "src/f32-gavgpool/f32-gavgpool-7p7x-minmax-sse-c4.c",
     "src/f32-gavgpool/f32-gavgpool-7x-minmax-sse-c4.c",
@@ -4644,7 +4777,17 @@ ALL_SSE_MICROKERNEL_SRCS = [
     "src/f32-ppmm/gen/f32-ppmm-4x8-minmax-sse.c",
     "src/f32-prelu/gen/f32-prelu-sse-2x4.c",
     "src/f32-prelu/gen/f32-prelu-sse-2x8.c",
+    "src/f32-reduce/gen/f32-rdmax-sse-c16.c",
+    "src/f32-reduce/gen/f32-rdmin-sse-c16.c",
+    "src/f32-reduce/gen/f32-rdsum-sse-c16.c",
+    "src/f32-reduce/gen/f32-rdsumsq-sse-c16.c",
+    "src/f32-reduce/gen/f32-rmax-sse-x16.c",
+    "src/f32-reduce/gen/f32-rmin-sse-x16.c",
+    "src/f32-reduce/gen/f32-rminmax-sse-x16.c",
+    "src/f32-reduce/gen/f32-rsum-sse-x16.c",
+    "src/f32-reduce/gen/f32-rsumsq-sse-x16.c",
     "src/f32-rmax/f32-rmax-sse.c",
+    "src/f32-rnorm/f32-rnorm-sse-x8.c",
     "src/f32-spmm/gen/f32-spmm-4x1-minmax-sse.c",
     "src/f32-spmm/gen/f32-spmm-8x1-minmax-sse.c",
     "src/f32-spmm/gen/f32-spmm-16x1-minmax-sse.c",
@@ -4764,6 +4907,8 @@ ALL_SSE2_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-x20-acc2.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-x20-acc5.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-x20.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-sse2-rational-13-6-div-x4.c",
+    "src/f32-vapproxgelu/gen/f32-vapproxgelu-sse2-rational-13-6-div-x8.c",
     "src/f32-velu/gen/f32-velu-sse2-rr2-lut16-p3-x4.c",
     "src/f32-velu/gen/f32-velu-sse2-rr2-lut16-p3-x8.c",
     "src/f32-velu/gen/f32-velu-sse2-rr2-lut16-p3-x12.c",
@@ -4776,6 +4921,10 @@ ALL_SSE2_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-sse2-rr2-p6-x16.c",
     "src/f32-velu/gen/f32-velu-sse2-rr2-p6-x20.c",
     "src/f32-velu/gen/f32-velu-sse2-rr2-p6-x24.c",
+    "src/f32-vexp/gen/f32-vexp-sse2-rr2-p5-x4.c",
+    "src/f32-vexp/gen/f32-vexp-sse2-rr2-p5-x8.c",
+    "src/f32-vgelu/gen/f32-vgelu-sse2-rational-13-8-div-x4.c",
+    "src/f32-vgelu/gen/f32-vgelu-sse2-rational-13-8-div-x8.c",
     "src/f32-vlrelu/gen/f32-vlrelu-sse2-x4.c",
     "src/f32-vlrelu/gen/f32-vlrelu-sse2-x8.c",
     "src/f32-vrnd/gen/f32-vrndd-sse2-x4.c",
@@ -4798,6 +4947,10 @@ ALL_SSE2_MICROKERNEL_SRCS = [
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-p5-div-x16.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-p5-div-x20.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-p5-div-x24.c",
+    "src/f32-vsilu/gen/f32-vsilu-sse2-rr2-p5-div-x4.c",
+    "src/f32-vsilu/gen/f32-vsilu-sse2-rr2-p5-div-x8.c",
+    "src/f32-vtanh/gen/f32-vtanh-sse2-rational-13-6-div-x4.c",
+    "src/f32-vtanh/gen/f32-vtanh-sse2-rational-13-6-div-x8.c",
     "src/math/f16-f32-cvt-sse2-int16.c",
     "src/math/f16-f32-cvt-sse2-int32.c",
     "src/math/f32-exp-sse2-rr2-lut64-p2.c",
@@ -4872,6 +5025,8 @@ ALL_SSE2_MICROKERNEL_SRCS = [
     "src/qc8-igemm/gen/qc8-igemm-4x4c2-minmax-fp32-sse2-ld128.c",
     "src/qc8-igemm/gen/qc8-igemm-4x4c2s4-minmax-fp32-sse2-ld64.c",
     "src/qc8-igemm/gen/qc8-igemm-4x4c2s4-minmax-fp32-sse2-ld128.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x4c8-minmax-sse2-ld64.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-3x4c8-minmax-sse2-ld64.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-fp32-sse2-mul16-add16.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-fp32-sse2-mul16.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p16c-minmax-fp32-sse2-mul16-add16.c",
@@ -5143,6 +5298,7 @@ ALL_SSE41_MICROKERNEL_SRCS = [
     "src/math/f32-roundne-sse41.c",
     "src/math/f32-roundu-sse41.c",
     "src/math/f32-roundz-sse41.c",
+    "src/qc4-f32-embedding/qc4-f32-embedding-sse41-c16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-3p8c-minmax-fp32-sse41-mul16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-9p8c-minmax-fp32-sse41-mul16-add16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-9p8c-minmax-fp32-sse41-mul16.c",
@@ -5160,6 +5316,7 @@ ALL_SSE41_MICROKERNEL_SRCS = [
     "src/qc8-dwconv/gen/qc8-dwconv-25p16c-minmax-fp32-sse41-mul32.c",
     "src/qc8-dwconv/gen/qc8-dwconv-25p24c-minmax-fp32-sse41-mul16.c",
     "src/qc8-dwconv/gen/qc8-dwconv-25p24c-minmax-fp32-sse41-mul32.c",
+    "src/qc8-f32-embedding/qc8-f32-embedding-sse41-c16.c",
     "src/qc8-gemm/gen/qc8-gemm-1x4c2-minmax-fp32-sse41-ld64.c",
     "src/qc8-gemm/gen/qc8-gemm-1x4c2-minmax-fp32-sse41-ld128.c",
     "src/qc8-gemm/gen/qc8-gemm-1x4c2s4-minmax-fp32-sse41-ld64.c",
@@ -5204,6 +5361,8 @@ ALL_SSE41_MICROKERNEL_SRCS = [
     "src/qc8-igemm/gen/qc8-igemm-4x4c2-minmax-fp32-sse41-ld128.c",
     "src/qc8-igemm/gen/qc8-igemm-4x4c2s4-minmax-fp32-sse41-ld64.c",
     "src/qc8-igemm/gen/qc8-igemm-4x4c2s4-minmax-fp32-sse41-ld128.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x4c8-minmax-sse41-ld64.c",
+    "src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-3x4c8-minmax-sse41-ld64.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-fp32-sse41-mul16-add16.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-fp32-sse41-mul16.c",
     "src/qs8-dwconv/gen/qs8-dwconv-9p8c-minmax-fp32-sse41-mul32.c",
@@ -5290,6 +5449,7 @@ ALL_SSE41_MICROKERNEL_SRCS = [
     "src/qs8-requantization/qs8-requantization-rndna-sse41.c",
     "src/qs8-requantization/qs8-requantization-rndnu-sse41-sra.c",
     "src/qs8-requantization/qs8-requantization-rndnu-sse41-srl.c",
+    "src/qs8-rnorm/qs8-rnorm-sse41-x16.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-sse41-mul16-ld64-x8.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-sse41-mul16-ld64-x16.c",
     "src/qs8-vadd/gen/qs8-vadd-minmax-sse41-mul16-ld64-x24.c",
@@ -0,0 +1,376 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "models/subgraph/builder.h"
+
+#include <xnnpack.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "models/subgraph/models.h"
+
+namespace models {
+namespace subgraph {
+
+namespace {
+
+size_t NumElements(const std::vector<size_t>& dims) {
+  return std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+}
+
+}  // namespace
+
+Builder::Builder(Model& model) : model_(model), rng_(/*seed=*/42) {
+  xnn_subgraph_t subgraph = nullptr;
+  ok_ = xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph) == xnn_status_success;
+  model_.subgraph.reset(subgraph);
+  model_.weights.clear();
+}
+
+uint32_t Builder::Check(enum xnn_status status, uint32_t output_id) {
+  if (status != xnn_status_success) {
+    ok_ = false;
+  }
+  return ok_ ? output_id : XNN_INVALID_VALUE_ID;
+}
+
+uint32_t Builder::Input(const std::vector<size_t>& dims) {
+  if (!ok_) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  const enum xnn_status status = xnn_define_tensor_value(
+    model_.subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), /*data=*/nullptr, kInputId,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &id);
+  model_.input_size = NumElements(dims);
+  dims_[id] = dims;
+  return Check(status, id);
+}
+
+uint32_t Builder::Output(const std::vector<size_t>& dims) {
+  if (!ok_) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  enum xnn_status status;
+  if (next_is_output_) {
+    next_is_output_ = false;
+    status = xnn_define_tensor_value(
+      model_.subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), /*data=*/nullptr, kOutputId,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &id);
+    model_.output_size = NumElements(dims);
+  } else {
+    status = xnn_define_tensor_value(
+      model_.subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), /*data=*/nullptr, XNN_INVALID_VALUE_ID,
+      /*flags=*/0, &id);
+  }
+  dims_[id] = dims;
+  return Check(status, id);
+}
+
+bool Builder::Finish() {
+  return ok_ && model_.input_size != 0 && model_.output_size != 0;
+}
+
+uint32_t Builder::Static(const std::vector<size_t>& dims, float scale) {
+  std::unique_ptr<float[]> data(new float[NumElements(dims)]);
+  std::uniform_real_distribution<float> distribution(-scale, scale);
+  std::generate(data.get(), data.get() + NumElements(dims), [&]() { return distribution(rng_); });
+  return Define(dims, std::move(data));
+}
+
+uint32_t Builder::Constant(const std::vector<size_t>& dims, float value) {
+  std::unique_ptr<float[]> data(new float[NumElements(dims)]);
+  std::fill(data.get(), data.get() + NumElements(dims), value);
+  return Define(dims, std::move(data));
+}
+
+uint32_t Builder::Define(const std::vector<size_t>& dims, std::unique_ptr<float[]> data) {
+  if (!ok_) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  const enum xnn_status status = xnn_define_tensor_value(
+    model_.subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), data.get(), XNN_INVALID_VALUE_ID,
+    /*flags=*/0, &id);
+  model_.weights.push_back(std::move(data));
+  dims_[id] = dims;
+  return Check(status, id);
+}
+
+uint32_t Builder::Conv2D(
+  uint32_t input_id, size_t kernel_size, size_t stride, size_t output_channels,
+  float output_min, float output_max, float weights_scale, float bias)
+{
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t> input_dims = Dims(input_id);
+  assert(input_dims.size() == 4);
+  const size_t input_channels = input_dims[3];
+  const size_t padding = kernel_size / 2;
+  const uint32_t filter_id = Static(
+    {output_channels, kernel_size, kernel_size, input_channels},
+    weights_scale / std::sqrt(float(kernel_size * kernel_size * input_channels)));
+  const uint32_t bias_id = Constant({output_channels}, bias);
+  const uint32_t output_id = Output({
+    input_dims[0],
+    (input_dims[1] + 2 * padding - kernel_size) / stride + 1,
+    (input_dims[2] + 2 * padding - kernel_size) / stride + 1,
+    output_channels});
+  if (Failed(filter_id) || Failed(bias_id) || Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_convolution_2d(
+      model_.subgraph.get(), padding, padding, padding, padding, kernel_size, kernel_size, stride, stride,
+      /*dilation_height=*/1, /*dilation_width=*/1, /*groups=*/1, input_channels, output_channels,
+      output_min, output_max, input_id, filter_id, bias_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::DepthwiseConv2D(
+  uint32_t input_id, size_t kernel_size, size_t stride, float output_min, float output_max)
+{
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t> input_dims = Dims(input_id);
+  assert(input_dims.size() == 4);
+  const size_t channels = input_dims[3];
+  const size_t padding = kernel_size / 2;
+  const uint32_t filter_id =
+    Static({1, kernel_size, kernel_size, channels}, 1.0f / std::sqrt(float(kernel_size * kernel_size)));
+  const uint32_t bias_id = Constant({channels}, 0.0f);
+  const uint32_t output_id = Output({
+    input_dims[0],
+    (input_dims[1] + 2 * padding - kernel_size) / stride + 1,
+    (input_dims[2] + 2 * padding - kernel_size) / stride + 1,
+    channels});
+  if (Failed(filter_id) || Failed(bias_id) || Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_depthwise_convolution_2d(
+      model_.subgraph.get(), padding, padding, padding, padding, kernel_size, kernel_size, stride, stride,
+      /*dilation_height=*/1, /*dilation_width=*/1, /*depth_multiplier=*/1, channels,
+      output_min, output_max, input_id, filter_id, bias_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::GlobalAveragePooling2D(uint32_t input_id) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t> input_dims = Dims(input_id);
+  assert(input_dims.size() == 4);
+  const uint32_t output_id = Output({input_dims[0], 1, 1, input_dims[3]});
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_global_average_pooling_2d(
+      model_.subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::FullyConnected(uint32_t input_id, size_t output_channels, bool has_bias, float weights_scale) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  std::vector<size_t> output_dims = Dims(input_id);
+  const size_t input_channels = output_dims.back();
+  output_dims.back() = output_channels;
+  const uint32_t filter_id =
+    Static({output_channels, input_channels}, weights_scale / std::sqrt(float(input_channels)));
+  const uint32_t bias_id = has_bias ? Constant({output_channels}, 0.0f) : XNN_INVALID_VALUE_ID;
+  const uint32_t output_id = Output(output_dims);
+  if (Failed(filter_id) || (has_bias && Failed(bias_id)) || Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_fully_connected(
+      model_.subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, filter_id, bias_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::Add(uint32_t input1_id, uint32_t input2_id) {
+  if (Failed(input1_id) || Failed(input2_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  std::vector<size_t> output_dims = Dims(input1_id);
+  const std::vector<size_t>& input2_dims = Dims(input2_id);
+  assert(output_dims.size() == input2_dims.size());
+  std::transform(output_dims.begin(), output_dims.end(), input2_dims.begin(), output_dims.begin(),
+    [](size_t a, size_t b) { return std::max(a, b); });
+  const uint32_t output_id = Output(output_dims);
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_add2(
+      model_.subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input1_id, input2_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::Multiply(uint32_t input1_id, uint32_t input2_id) {
+  if (Failed(input1_id) || Failed(input2_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  std::vector<size_t> output_dims = Dims(input1_id);
+  const std::vector<size_t>& input2_dims = Dims(input2_id);
+  assert(output_dims.size() == input2_dims.size());
+  std::transform(output_dims.begin(), output_dims.end(), input2_dims.begin(), output_dims.begin(),
+    [](size_t a, size_t b) { return std::max(a, b); });
+  const uint32_t output_id = Output(output_dims);
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_multiply2(
+      model_.subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input1_id, input2_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::HardSwish(uint32_t input_id) {
+  const uint32_t output_id = Failed(input_id) ? XNN_INVALID_VALUE_ID : Output(Dims(input_id));
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(xnn_define_hardswish(model_.subgraph.get(), input_id, output_id, /*flags=*/0), output_id);
+}
+
+uint32_t Builder::GELU(uint32_t input_id) {
+  const uint32_t output_id = Failed(input_id) ? XNN_INVALID_VALUE_ID : Output(Dims(input_id));
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(xnn_define_gelu(model_.subgraph.get(), input_id, output_id, /*flags=*/0), output_id);
+}
+
+uint32_t Builder::SiLU(uint32_t input_id) {
+  const uint32_t output_id = Failed(input_id) ? XNN_INVALID_VALUE_ID : Output(Dims(input_id));
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(xnn_define_silu(model_.subgraph.get(), input_id, output_id, /*flags=*/0), output_id);
+}
+
+uint32_t Builder::Softmax(uint32_t input_id) {
+  const uint32_t output_id = Failed(input_id) ? XNN_INVALID_VALUE_ID : Output(Dims(input_id));
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(xnn_define_softmax(model_.subgraph.get(), input_id, output_id, /*flags=*/0), output_id);
+}
+
+uint32_t Builder::LayerNorm(uint32_t input_id) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t> dims = Dims(input_id);
+  const uint32_t gamma_id = Constant({dims.back()}, 1.0f);
+  const uint32_t beta_id = Constant({dims.back()}, 0.0f);
+  const uint32_t output_id = Output(dims);
+  if (Failed(gamma_id) || Failed(beta_id) || Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const size_t reduction_axis = dims.size() - 1;
+  return Check(
+    xnn_define_layer_norm(
+      model_.subgraph.get(), /*num_reduction_axes=*/1, &reduction_axis, /*epsilon=*/1.0e-5f,
+      input_id, gamma_id, beta_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::RMSNorm(uint32_t input_id) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t> dims = Dims(input_id);
+  const uint32_t gamma_id = Constant({dims.back()}, 1.0f);
+  const uint32_t output_id = Output(dims);
+  if (Failed(gamma_id) || Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const size_t reduction_axis = dims.size() - 1;
+  return Check(
+    xnn_define_rms_norm(
+      model_.subgraph.get(), /*num_reduction_axes=*/1, &reduction_axis, /*epsilon=*/1.0e-6f,
+      input_id, gamma_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::Sum(uint32_t input_id, const std::vector<size_t>& reduction_axes) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t>& input_dims = Dims(input_id);
+  std::vector<size_t> output_dims;
+  for (size_t i = 0; i < input_dims.size(); i++) {
+    if (std::find(reduction_axes.begin(), reduction_axes.end(), i) == reduction_axes.end()) {
+      output_dims.push_back(input_dims[i]);
+    }
+  }
+  const uint32_t output_id = Output(output_dims);
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_static_reduce(
+      model_.subgraph.get(), xnn_reduce_sum, reduction_axes.size(), reduction_axes.data(),
+      input_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::Reshape(uint32_t input_id, const std::vector<size_t>& dims) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  assert(NumElements(dims) == NumElements(Dims(input_id)));
+  const uint32_t output_id = Output(dims);
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_static_reshape(model_.subgraph.get(), dims.size(), dims.data(), input_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+uint32_t Builder::Transpose(uint32_t input_id, const std::vector<size_t>& perm) {
+  if (Failed(input_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const std::vector<size_t>& input_dims = Dims(input_id);
+  assert(perm.size() == input_dims.size());
+  std::vector<size_t> output_dims(perm.size());
+  for (size_t i = 0; i < perm.size(); i++) {
+    output_dims[i] = input_dims[perm[i]];
+  }
+  const uint32_t output_id = Output(output_dims);
+  if (Failed(output_id)) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  return Check(
+    xnn_define_static_transpose(model_.subgraph.get(), perm.size(), perm.data(), input_id, output_id, /*flags=*/0),
+    output_id);
+}
+
+}  // namespace subgraph
+}  // namespace models
@@ -0,0 +1,87 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <xnnpack.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "models/subgraph/models.h"
+
+namespace models {
+namespace subgraph {
+
+// Helper for defining FP32 models: infers the shapes of intermediate Values and creates random static weights.
+// Every method returns the ID of the output Value, or XNN_INVALID_VALUE_ID once any definition has failed, in which
+// case Finish() returns false.
+class Builder {
+ public:
+  explicit Builder(Model& model);
+
+  // Defines the external input Value.
+  uint32_t Input(const std::vector<size_t>& dims);
+  // Makes the output of the next Node the external output Value.
+  void NextIsOutput() { next_is_output_ = true; }
+  bool Finish();
+
+  // Static Values with elements uniformly distributed in [-scale, scale], or all equal to value.
+  uint32_t Static(const std::vector<size_t>& dims, float scale);
+  uint32_t Constant(const std::vector<size_t>& dims, float value);
+
+  // NHWC convolutions with "same" padding.
+  uint32_t Conv2D(
+    uint32_t input_id, size_t kernel_size, size_t stride, size_t output_channels,
+    float output_min = -std::numeric_limits<float>::infinity(),
+    float output_max = std::numeric_limits<float>::infinity(),
+    float weights_scale = 1.0f, float bias = 0.0f);
+  uint32_t DepthwiseConv2D(
+    uint32_t input_id, size_t kernel_size, size_t stride,
+    float output_min = -std::numeric_limits<float>::infinity(),
+    float output_max = std::numeric_limits<float>::infinity());
+  uint32_t GlobalAveragePooling2D(uint32_t input_id);
+
+  uint32_t FullyConnected(
+    uint32_t input_id, size_t output_channels, bool has_bias = true, float weights_scale = 1.0f);
+
+  uint32_t Add(uint32_t input1_id, uint32_t input2_id);
+  uint32_t Multiply(uint32_t input1_id, uint32_t input2_id);
+
+  uint32_t HardSwish(uint32_t input_id);
+  uint32_t GELU(uint32_t input_id);
+  uint32_t SiLU(uint32_t input_id);
+  uint32_t Softmax(uint32_t input_id);
+
+  // Normalization over the innermost dimension.
+  uint32_t LayerNorm(uint32_t input_id);
+  uint32_t RMSNorm(uint32_t input_id);
+
+  uint32_t Sum(uint32_t input_id, const std::vector<size_t>& reduction_axes);
+  uint32_t Reshape(uint32_t input_id, const std::vector<size_t>& dims);
+  uint32_t Transpose(uint32_t input_id, const std::vector<size_t>& perm);
+
+  const std::vector<size_t>& Dims(uint32_t id) const { return dims_.at(id); }
+
+ private:
+  uint32_t Define(const std::vector<size_t>& dims, std::unique_ptr<float[]> data);
+  uint32_t Output(const std::vector<size_t>& dims);
+  uint32_t Check(enum xnn_status status, uint32_t output_id);
+  bool Failed(uint32_t id) const { return !ok_ || id == XNN_INVALID_VALUE_ID; }
+
+  Model& model_;
+  std::mt19937 rng_;
+  std::unordered_map<uint32_t, std::vector<size_t>> dims_;
+  bool next_is_output_ = false;
+  bool ok_ = true;
+};
+
+}  // namespace subgraph
+}  // namespace models
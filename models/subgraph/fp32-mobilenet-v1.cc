@@ -0,0 +1,43 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <xnnpack.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "models/subgraph/builder.h"
+#include "models/subgraph/models.h"
+
+namespace models {
+namespace subgraph {
+
+bool FP32MobileNetV1(Model& model) {
+  struct Block {
+    size_t output_channels;
+    size_t stride;
+  };
+  static const std::array<Block, 13> blocks = {{
+    {64, 1}, {128, 2}, {128, 1}, {256, 2}, {256, 1}, {512, 2},
+    {512, 1}, {512, 1}, {512, 1}, {512, 1}, {512, 1},
+    {1024, 2}, {1024, 1},
+  }};
+
+  Builder builder(model);
+  uint32_t x = builder.Input({1, 224, 224, 3});
+  x = builder.Conv2D(x, /*kernel_size=*/3, /*stride=*/2, /*output_channels=*/32, 0.0f, 6.0f);
+  for (const Block& block : blocks) {
+    x = builder.DepthwiseConv2D(x, /*kernel_size=*/3, block.stride, 0.0f, 6.0f);
+    x = builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, block.output_channels, 0.0f, 6.0f);
+  }
+  x = builder.GlobalAveragePooling2D(x);
+  builder.NextIsOutput();
+  builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, /*output_channels=*/1001);
+  return builder.Finish();
+}
+
+}  // namespace subgraph
+}  // namespace models
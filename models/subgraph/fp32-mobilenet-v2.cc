@@ -0,0 +1,53 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <xnnpack.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "models/subgraph/builder.h"
+#include "models/subgraph/models.h"
+
+namespace models {
+namespace subgraph {
+
+bool FP32MobileNetV2(Model& model) {
+  struct Stage {
+    size_t expansion;
+    size_t output_channels;
+    size_t num_blocks;
+    size_t stride;
+  };
+  static const std::array<Stage, 7> stages = {{
+    {1, 16, 1, 1}, {6, 24, 2, 2}, {6, 32, 3, 2}, {6, 64, 4, 2}, {6, 96, 3, 1}, {6, 160, 3, 2}, {6, 320, 1, 1},
+  }};
+
+  Builder builder(model);
+  uint32_t x = builder.Input({1, 224, 224, 3});
+  x = builder.Conv2D(x, /*kernel_size=*/3, /*stride=*/2, /*output_channels=*/32, 0.0f, 6.0f);
+  for (const Stage& stage : stages) {
+    for (size_t i = 0; i < stage.num_blocks; i++) {
+      const size_t stride = i == 0 ? stage.stride : 1;
+      const size_t input_channels = builder.Dims(x)[3];
+      uint32_t y = x;
+      if (stage.expansion != 1) {
+        y = builder.Conv2D(y, /*kernel_size=*/1, /*stride=*/1, input_channels * stage.expansion, 0.0f, 6.0f);
+      }
+      y = builder.DepthwiseConv2D(y, /*kernel_size=*/3, stride, 0.0f, 6.0f);
+      y = builder.Conv2D(y, /*kernel_size=*/1, /*stride=*/1, stage.output_channels);
+      x = stride == 1 && input_channels == stage.output_channels ? builder.Add(x, y) : y;
+    }
+  }
+  x = builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, /*output_channels=*/1280, 0.0f, 6.0f);
+  x = builder.GlobalAveragePooling2D(x);
+  builder.NextIsOutput();
+  builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, /*output_channels=*/1001);
+  return builder.Finish();
+}
+
+}  // namespace subgraph
+}  // namespace models
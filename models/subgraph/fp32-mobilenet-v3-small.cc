@@ -0,0 +1,95 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <xnnpack.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "models/subgraph/builder.h"
+#include "models/subgraph/models.h"
+
+namespace models {
+namespace subgraph {
+
+namespace {
+
+size_t MakeDivisible(size_t channels) {
+  return std::max<size_t>(8, (channels + 4) / 8 * 8);
+}
+
+// Squeeze-and-excitation: scales channels by a hard sigmoid of a bottleneck over the spatially averaged input. The hard
+// sigmoid, clamp(x / 6 + 0.5, 0, 1), is folded into the weights, bias and output range of the expanding convolution.
+uint32_t SqueezeExcite(Builder& builder, uint32_t x) {
+  const size_t channels = builder.Dims(x)[3];
+  uint32_t y = builder.GlobalAveragePooling2D(x);
+  y = builder.Conv2D(y, /*kernel_size=*/1, /*stride=*/1, MakeDivisible(channels / 4), 0.0f);
+  y = builder.Conv2D(
+    y, /*kernel_size=*/1, /*stride=*/1, channels, 0.0f, 1.0f, /*weights_scale=*/1.0f / 6.0f, /*bias=*/0.5f);
+  return builder.Multiply(x, y);
+}
+
+}  // namespace
+
+bool FP32MobileNetV3Small(Model& model) {
+  struct Block {
+    size_t kernel_size;
+    size_t expanded_channels;
+    size_t output_channels;
+    bool squeeze_excite;
+    bool hardswish;
+    size_t stride;
+  };
+  static const std::array<Block, 11> blocks = {{
+    {3, 16, 16, true, false, 2},
+    {3, 72, 24, false, false, 2},
+    {3, 88, 24, false, false, 1},
+    {5, 96, 40, true, true, 2},
+    {5, 240, 40, true, true, 1},
+    {5, 240, 40, true, true, 1},
+    {5, 120, 48, true, true, 1},
+    {5, 144, 48, true, true, 1},
+    {5, 288, 96, true, true, 2},
+    {5, 576, 96, true, true, 1},
+    {5, 576, 96, true, true, 1},
+  }};
+
+  Builder builder(model);
+  uint32_t x = builder.Input({1, 224, 224, 3});
+  x = builder.HardSwish(builder.Conv2D(x, /*kernel_size=*/3, /*stride=*/2, /*output_channels=*/16));
+  for (const Block& block : blocks) {
+    const size_t input_channels = builder.Dims(x)[3];
+    // ReLU blocks clamp at zero in the convolutions, hard-swish blocks apply a separate activation.
+    const float output_min = block.hardswish ? -std::numeric_limits<float>::infinity() : 0.0f;
+    uint32_t y = x;
+    if (block.expanded_channels != input_channels) {
+      y = builder.Conv2D(y, /*kernel_size=*/1, /*stride=*/1, block.expanded_channels, output_min);
+      if (block.hardswish) {
+        y = builder.HardSwish(y);
+      }
+    }
+    y = builder.DepthwiseConv2D(y, block.kernel_size, block.stride, output_min);
+    if (block.hardswish) {
+      y = builder.HardSwish(y);
+    }
+    if (block.squeeze_excite) {
+      y = SqueezeExcite(builder, y);
+    }
+    y = builder.Conv2D(y, /*kernel_size=*/1, /*stride=*/1, block.output_channels);
+    x = block.stride == 1 && input_channels == block.output_channels ? builder.Add(x, y) : y;
+  }
+  x = builder.HardSwish(builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, /*output_channels=*/576));
+  x = builder.GlobalAveragePooling2D(x);
+  x = builder.HardSwish(builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, /*output_channels=*/1024));
+  builder.NextIsOutput();
+  builder.Conv2D(x, /*kernel_size=*/1, /*stride=*/1, /*output_channels=*/1001);
+  return builder.Finish();
+}
+
+}  // namespace subgraph
+}  // namespace models
@@ -0,0 +1,98 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <xnnpack.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "models/subgraph/builder.h"
+#include "models/subgraph/models.h"
+
+// Subgraphs have no batched matrix multiplication of two dynamic tensors, so attention scores and attention-weighted
+// values are computed as broadcasted products reduced over the shared dimension.
+
+namespace models {
+namespace subgraph {
+
+bool FP32TransformerEncoderBlock(Model& model) {
+  const size_t sequence_length = 64;
+  const size_t channels = 256;
+  const size_t num_heads = 4;
+  const size_t head_channels = channels / num_heads;
+  const size_t hidden_channels = 1024;
+
+  Builder builder(model);
+  const uint32_t x = builder.Input({sequence_length, channels});
+
+  // Multi-head self-attention, with the 1/sqrt(head_channels) scaling of the scores folded into the query projection.
+  uint32_t query = builder.FullyConnected(
+    x, channels, /*has_bias=*/true, /*weights_scale=*/1.0f / std::sqrt(float(head_channels)));
+  query = builder.Reshape(query, {sequence_length, 1, num_heads, head_channels});
+  uint32_t key = builder.FullyConnected(x, channels);
+  key = builder.Reshape(key, {1, sequence_length, num_heads, head_channels});
+  uint32_t value = builder.FullyConnected(x, channels);
+  value = builder.Reshape(value, {sequence_length, num_heads, head_channels});
+  value = builder.Transpose(value, {1, 0, 2});
+  value = builder.Reshape(value, {1, num_heads, sequence_length, head_channels});
+
+  // [query, key, head] -> [query, head, key]
+  uint32_t scores = builder.Sum(builder.Multiply(query, key), {3});
+  scores = builder.Transpose(scores, {0, 2, 1});
+  uint32_t probabilities = builder.Softmax(scores);
+  probabilities = builder.Reshape(probabilities, {sequence_length, num_heads, sequence_length, 1});
+  uint32_t attention = builder.Sum(builder.Multiply(probabilities, value), {2});
+  attention = builder.Reshape(attention, {sequence_length, channels});
+  attention = builder.FullyConnected(attention, channels);
+  const uint32_t y = builder.LayerNorm(builder.Add(x, attention));
+
+  uint32_t feed_forward = builder.GELU(builder.FullyConnected(y, hidden_channels));
+  feed_forward = builder.FullyConnected(feed_forward, channels);
+  const uint32_t z = builder.Add(y, feed_forward);
+  builder.NextIsOutput();
+  builder.LayerNorm(z);
+  return builder.Finish();
+}
+
+bool FP32TransformerDecoderStep(Model& model) {
+  const size_t context_length = 256;
+  const size_t channels = 512;
+  const size_t num_heads = 8;
+  const size_t head_channels = channels / num_heads;
+  const size_t hidden_channels = 1376;
+
+  Builder builder(model);
+  const uint32_t x = builder.Input({1, channels});
+
+  // Attention of the current token over a static cache of keys and values of the preceding context.
+  const uint32_t key_cache = builder.Static({context_length, num_heads, head_channels}, 1.0f);
+  const uint32_t value_cache = builder.Static({context_length, num_heads, head_channels}, 1.0f);
+  uint32_t query = builder.FullyConnected(
+    builder.RMSNorm(x), channels, /*has_bias=*/false, /*weights_scale=*/1.0f / std::sqrt(float(head_channels)));
+  query = builder.Reshape(query, {1, num_heads, head_channels});
+
+  // [context, head] -> [head, context]
+  uint32_t scores = builder.Sum(builder.Multiply(query, key_cache), {2});
+  scores = builder.Transpose(scores, {1, 0});
+  uint32_t probabilities = builder.Transpose(builder.Softmax(scores), {1, 0});
+  probabilities = builder.Reshape(probabilities, {context_length, num_heads, 1});
+  uint32_t attention = builder.Sum(builder.Multiply(probabilities, value_cache), {0});
+  attention = builder.Reshape(attention, {1, channels});
+  attention = builder.FullyConnected(attention, channels, /*has_bias=*/false);
+  const uint32_t y = builder.Add(x, attention);
+
+  // Gated feed-forward network.
+  const uint32_t normalized = builder.RMSNorm(y);
+  const uint32_t gate = builder.SiLU(builder.FullyConnected(normalized, hidden_channels, /*has_bias=*/false));
+  const uint32_t up = builder.FullyConnected(normalized, hidden_channels, /*has_bias=*/false);
+  const uint32_t feed_forward = builder.FullyConnected(builder.Multiply(gate, up), channels, /*has_bias=*/false);
+  builder.NextIsOutput();
+  builder.Add(y, feed_forward);
+  return builder.Finish();
+}
+
+}  // namespace subgraph
+}  // namespace models
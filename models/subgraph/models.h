@@ -0,0 +1,46 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <xnnpack.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace models {
+namespace subgraph {
+
+// External Value IDs of the model input and output.
+constexpr uint32_t kInputId = 0;
+constexpr uint32_t kOutputId = 1;
+
+// Subgraph with one external input and one external output. Static weights are owned by the Model, and must outlive
+// any Runtime created from the Subgraph.
+struct Model {
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph{nullptr, xnn_delete_subgraph};
+  std::vector<std::unique_ptr<float[]>> weights;
+  // Number of elements in the input and output tensors.
+  size_t input_size = 0;
+  size_t output_size = 0;
+};
+
+typedef bool (*ModelFactory)(Model& model);
+
+bool FP32MobileNetV1(Model& model);
+bool FP32MobileNetV2(Model& model);
+bool FP32MobileNetV3Small(Model& model);
+
+// Post-normalization encoder block over a sequence of 64 tokens with 256 channels, 4 attention heads and a GELU
+// feed-forward network.
+bool FP32TransformerEncoderBlock(Model& model);
+// Single-token decoder step with RMS normalization, 8 attention heads over a cached context of 256 tokens and a gated
+// SiLU feed-forward network.
+bool FP32TransformerDecoderStep(Model& model);
+
+}  // namespace subgraph
+}  // namespace models
@@ -0,0 +1,18 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################ ARM NEONFP16ARITH ################################
+tools/xngen src/f16-vsilu/neonfp16arith-rr2-p5-nr1recps.c.in -D BATCH_TILE=8 -o src/f16-vsilu/gen/f16-vsilu-neonfp16arith-rr2-p5-nr1recps-x8.c &
+tools/xngen src/f16-vsilu/neonfp16arith-rr2-p5-nr1recps.c.in -D BATCH_TILE=16 -o src/f16-vsilu/gen/f16-vsilu-neonfp16arith-rr2-p5-nr1recps-x16.c &
+
+################################# x86 256-bit #################################
+tools/xngen src/f16-vsilu/avx2-rr2-p5-div.c.in -D BATCH_TILE=8 -o src/f16-vsilu/gen/f16-vsilu-avx2-rr2-p5-div-x8.c &
+tools/xngen src/f16-vsilu/avx2-rr2-p5-div.c.in -D BATCH_TILE=16 -o src/f16-vsilu/gen/f16-vsilu-avx2-rr2-p5-div-x16.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f16-vsilu.yaml --output test/f16-vsilu.cc &
+
+wait
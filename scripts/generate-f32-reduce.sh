@@ -0,0 +1,61 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-reduce/rop-neon.c.in -D OP=MAX   -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rmax-neon-x16.c &
+tools/xngen src/f32-reduce/rop-neon.c.in -D OP=MIN   -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rmin-neon-x16.c &
+tools/xngen src/f32-reduce/rop-neon.c.in -D OP=SUM   -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rsum-neon-x16.c &
+tools/xngen src/f32-reduce/rop-neon.c.in -D OP=SUMSQ -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rsumsq-neon-x16.c &
+tools/xngen src/f32-reduce/rminmax-neon.c.in -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rminmax-neon-x16.c &
+tools/xngen src/f32-reduce/rdop-neon.c.in -D OP=MAX   -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdmax-neon-c16.c &
+tools/xngen src/f32-reduce/rdop-neon.c.in -D OP=MIN   -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdmin-neon-c16.c &
+tools/xngen src/f32-reduce/rdop-neon.c.in -D OP=SUM   -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdsum-neon-c16.c &
+tools/xngen src/f32-reduce/rdop-neon.c.in -D OP=SUMSQ -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdsumsq-neon-c16.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-reduce/rop-sse.c.in -D OP=MAX   -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rmax-sse-x16.c &
+tools/xngen src/f32-reduce/rop-sse.c.in -D OP=MIN   -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rmin-sse-x16.c &
+tools/xngen src/f32-reduce/rop-sse.c.in -D OP=SUM   -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rsum-sse-x16.c &
+tools/xngen src/f32-reduce/rop-sse.c.in -D OP=SUMSQ -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rsumsq-sse-x16.c &
+tools/xngen src/f32-reduce/rminmax-sse.c.in -D BATCH_TILE=16 -o src/f32-reduce/gen/f32-rminmax-sse-x16.c &
+tools/xngen src/f32-reduce/rdop-sse.c.in -D OP=MAX   -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdmax-sse-c16.c &
+tools/xngen src/f32-reduce/rdop-sse.c.in -D OP=MIN   -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdmin-sse-c16.c &
+tools/xngen src/f32-reduce/rdop-sse.c.in -D OP=SUM   -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdsum-sse-c16.c &
+tools/xngen src/f32-reduce/rdop-sse.c.in -D OP=SUMSQ -D CHANNEL_TILE=16 -o src/f32-reduce/gen/f32-rdsumsq-sse-c16.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-reduce/rop-avx.c.in -D OP=MAX   -D BATCH_TILE=32 -o src/f32-reduce/gen/f32-rmax-avx-x32.c &
+tools/xngen src/f32-reduce/rop-avx.c.in -D OP=MIN   -D BATCH_TILE=32 -o src/f32-reduce/gen/f32-rmin-avx-x32.c &
+tools/xngen src/f32-reduce/rop-avx.c.in -D OP=SUM   -D BATCH_TILE=32 -o src/f32-reduce/gen/f32-rsum-avx-x32.c &
+tools/xngen src/f32-reduce/rop-avx.c.in -D OP=SUMSQ -D BATCH_TILE=32 -o src/f32-reduce/gen/f32-rsumsq-avx-x32.c &
+tools/xngen src/f32-reduce/rminmax-avx.c.in -D BATCH_TILE=32 -o src/f32-reduce/gen/f32-rminmax-avx-x32.c &
+tools/xngen src/f32-reduce/rdop-avx.c.in -D OP=MAX   -D CHANNEL_TILE=32 -o src/f32-reduce/gen/f32-rdmax-avx-c32.c &
+tools/xngen src/f32-reduce/rdop-avx.c.in -D OP=MIN   -D CHANNEL_TILE=32 -o src/f32-reduce/gen/f32-rdmin-avx-c32.c &
+tools/xngen src/f32-reduce/rdop-avx.c.in -D OP=SUM   -D CHANNEL_TILE=32 -o src/f32-reduce/gen/f32-rdsum-avx-c32.c &
+tools/xngen src/f32-reduce/rdop-avx.c.in -D OP=SUMSQ -D CHANNEL_TILE=32 -o src/f32-reduce/gen/f32-rdsumsq-avx-c32.c &
+
+################################# x86 AVX512 ##################################
+tools/xngen src/f32-reduce/rop-avx512f.c.in -D OP=MAX   -D BATCH_TILE=64 -o src/f32-reduce/gen/f32-rmax-avx512f-x64.c &
+tools/xngen src/f32-reduce/rop-avx512f.c.in -D OP=MIN   -D BATCH_TILE=64 -o src/f32-reduce/gen/f32-rmin-avx512f-x64.c &
+tools/xngen src/f32-reduce/rop-avx512f.c.in -D OP=SUM   -D BATCH_TILE=64 -o src/f32-reduce/gen/f32-rsum-avx512f-x64.c &
+tools/xngen src/f32-reduce/rop-avx512f.c.in -D OP=SUMSQ -D BATCH_TILE=64 -o src/f32-reduce/gen/f32-rsumsq-avx512f-x64.c &
+tools/xngen src/f32-reduce/rdop-avx512f.c.in -D OP=MAX   -D CHANNEL_TILE=64 -o src/f32-reduce/gen/f32-rdmax-avx512f-c64.c &
+tools/xngen src/f32-reduce/rdop-avx512f.c.in -D OP=MIN   -D CHANNEL_TILE=64 -o src/f32-reduce/gen/f32-rdmin-avx512f-c64.c &
+tools/xngen src/f32-reduce/rdop-avx512f.c.in -D OP=SUM   -D CHANNEL_TILE=64 -o src/f32-reduce/gen/f32-rdsum-avx512f-c64.c &
+tools/xngen src/f32-reduce/rdop-avx512f.c.in -D OP=SUMSQ -D CHANNEL_TILE=64 -o src/f32-reduce/gen/f32-rdsumsq-avx512f-c64.c &
+
+################################### Scalar ####################################
+tools/xngen src/f32-reduce/rop-scalar.c.in -D OP=MAX   -D BATCH_TILE=4 -o src/f32-reduce/gen/f32-rmax-scalar-x4.c &
+tools/xngen src/f32-reduce/rop-scalar.c.in -D OP=MIN   -D BATCH_TILE=4 -o src/f32-reduce/gen/f32-rmin-scalar-x4.c &
+tools/xngen src/f32-reduce/rop-scalar.c.in -D OP=SUM   -D BATCH_TILE=4 -o src/f32-reduce/gen/f32-rsum-scalar-x4.c &
+tools/xngen src/f32-reduce/rop-scalar.c.in -D OP=SUMSQ -D BATCH_TILE=4 -o src/f32-reduce/gen/f32-rsumsq-scalar-x4.c &
+tools/xngen src/f32-reduce/rminmax-scalar.c.in -D BATCH_TILE=4 -o src/f32-reduce/gen/f32-rminmax-scalar-x4.c &
+tools/xngen src/f32-reduce/rdop-scalar.c.in -D OP=MAX   -D CHANNEL_TILE=4 -o src/f32-reduce/gen/f32-rdmax-scalar-c4.c &
+tools/xngen src/f32-reduce/rdop-scalar.c.in -D OP=MIN   -D CHANNEL_TILE=4 -o src/f32-reduce/gen/f32-rdmin-scalar-c4.c &
+tools/xngen src/f32-reduce/rdop-scalar.c.in -D OP=SUM   -D CHANNEL_TILE=4 -o src/f32-reduce/gen/f32-rdsum-scalar-c4.c &
+tools/xngen src/f32-reduce/rdop-scalar.c.in -D OP=SUMSQ -D CHANNEL_TILE=4 -o src/f32-reduce/gen/f32-rdsumsq-scalar-c4.c &
+
+wait
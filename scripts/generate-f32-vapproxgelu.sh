@@ -0,0 +1,34 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vapproxgelu/neon-rational-13-6.c.in -D BATCH_TILE=4 -D FMA=1 -D DIV_ALGO=div -o src/f32-vapproxgelu/gen/f32-vapproxgelu-aarch64-neonfma-rational-13-6-div-x4.c &
+tools/xngen src/f32-vapproxgelu/neon-rational-13-6.c.in -D BATCH_TILE=8 -D FMA=1 -D DIV_ALGO=div -o src/f32-vapproxgelu/gen/f32-vapproxgelu-aarch64-neonfma-rational-13-6-div-x8.c &
+
+tools/xngen src/f32-vapproxgelu/neon-rational-13-6.c.in -D BATCH_TILE=4 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vapproxgelu/gen/f32-vapproxgelu-neon-rational-13-6-nr2recps-x4.c &
+tools/xngen src/f32-vapproxgelu/neon-rational-13-6.c.in -D BATCH_TILE=8 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vapproxgelu/gen/f32-vapproxgelu-neon-rational-13-6-nr2recps-x8.c &
+
+################################# x86 128-bit #################################
+tools/xngen src/f32-vapproxgelu/sse2-rational-13-6-div.c.in -D BATCH_TILE=4 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-sse2-rational-13-6-div-x4.c &
+tools/xngen src/f32-vapproxgelu/sse2-rational-13-6-div.c.in -D BATCH_TILE=8 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-sse2-rational-13-6-div-x8.c &
+
+################################# x86 256-bit #################################
+tools/xngen src/f32-vapproxgelu/fma3-rational-13-6-div.c.in -D BATCH_TILE=8 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-fma3-rational-13-6-div-x8.c &
+tools/xngen src/f32-vapproxgelu/fma3-rational-13-6-div.c.in -D BATCH_TILE=16 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-fma3-rational-13-6-div-x16.c &
+
+################################# x86 512-bit #################################
+tools/xngen src/f32-vapproxgelu/avx512f-rational-13-6-div.c.in -D BATCH_TILE=16 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-avx512f-rational-13-6-div-x16.c &
+tools/xngen src/f32-vapproxgelu/avx512f-rational-13-6-div.c.in -D BATCH_TILE=32 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-avx512f-rational-13-6-div-x32.c &
+
+#################################### Scalar ###################################
+tools/xngen src/f32-vapproxgelu/scalar-rational-13-6-div.c.in -D BATCH_TILE=1 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-scalar-rational-13-6-div-x1.c &
+tools/xngen src/f32-vapproxgelu/scalar-rational-13-6-div.c.in -D BATCH_TILE=2 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-scalar-rational-13-6-div-x2.c &
+tools/xngen src/f32-vapproxgelu/scalar-rational-13-6-div.c.in -D BATCH_TILE=4 -o src/f32-vapproxgelu/gen/f32-vapproxgelu-scalar-rational-13-6-div-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vapproxgelu.yaml --output test/f32-vapproxgelu.cc &
+
+wait
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vsilu/neon-rr2-p5.c.in -D BATCH_TILE=4 -D FMA=1 -D DIV_ALGO=div -o src/f32-vsilu/gen/f32-vsilu-aarch64-neonfma-rr2-p5-div-x4.c &
+tools/xngen src/f32-vsilu/neon-rr2-p5.c.in -D BATCH_TILE=8 -D FMA=1 -D DIV_ALGO=div -o src/f32-vsilu/gen/f32-vsilu-aarch64-neonfma-rr2-p5-div-x8.c &
+
+tools/xngen src/f32-vsilu/neon-rr2-p5.c.in -D BATCH_TILE=4 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vsilu/gen/f32-vsilu-neon-rr2-p5-nr2recps-x4.c &
+tools/xngen src/f32-vsilu/neon-rr2-p5.c.in -D BATCH_TILE=8 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vsilu/gen/f32-vsilu-neon-rr2-p5-nr2recps-x8.c &
+
+################################# x86 128-bit #################################
+tools/xngen src/f32-vsilu/sse2-rr2-p5-div.c.in -D BATCH_TILE=4 -o src/f32-vsilu/gen/f32-vsilu-sse2-rr2-p5-div-x4.c &
+tools/xngen src/f32-vsilu/sse2-rr2-p5-div.c.in -D BATCH_TILE=8 -o src/f32-vsilu/gen/f32-vsilu-sse2-rr2-p5-div-x8.c &
+
+################################# x86 256-bit #################################
+tools/xngen src/f32-vsilu/avx2-rr2-p5-div.c.in -D BATCH_TILE=8 -o src/f32-vsilu/gen/f32-vsilu-avx2-rr2-p5-div-x8.c &
+tools/xngen src/f32-vsilu/avx2-rr2-p5-div.c.in -D BATCH_TILE=16 -o src/f32-vsilu/gen/f32-vsilu-avx2-rr2-p5-div-x16.c &
+
+################################# x86 512-bit #################################
+tools/xngen src/f32-vsilu/avx512f-rr1-p5-scalef-div.c.in -D BATCH_TILE=16 -o src/f32-vsilu/gen/f32-vsilu-avx512f-rr1-p5-scalef-div-x16.c &
+tools/xngen src/f32-vsilu/avx512f-rr1-p5-scalef-div.c.in -D BATCH_TILE=32 -o src/f32-vsilu/gen/f32-vsilu-avx512f-rr1-p5-scalef-div-x32.c &
+
+#################################### Scalar ###################################
+tools/xngen src/f32-vsilu/scalar-rr2-p5-div.c.in -D BATCH_TILE=1 -o src/f32-vsilu/gen/f32-vsilu-scalar-rr2-p5-div-x1.c &
+tools/xngen src/f32-vsilu/scalar-rr2-p5-div.c.in -D BATCH_TILE=2 -o src/f32-vsilu/gen/f32-vsilu-scalar-rr2-p5-div-x2.c &
+tools/xngen src/f32-vsilu/scalar-rr2-p5-div.c.in -D BATCH_TILE=4 -o src/f32-vsilu/gen/f32-vsilu-scalar-rr2-p5-div-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vsilu.yaml --output test/f32-vsilu.cc &
+
+wait
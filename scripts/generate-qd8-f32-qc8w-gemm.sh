@@ -0,0 +1,26 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x4-minmax-scalar.c &
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=2 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-2x4-minmax-scalar.c &
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-4x4-minmax-scalar.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/qd8-f32-qc8w-gemm/c8-neon-mull.c.in -D MR=1 -D NR=8 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x8c8-minmax-neon-mull.c &
+tools/xngen src/qd8-f32-qc8w-gemm/c8-neon-mull.c.in -D MR=2 -D NR=8 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-2x8c8-minmax-neon-mull.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=1 -D SSE=2 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x4c8-minmax-sse2-ld64.c &
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=3 -D SSE=2 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-3x4c8-minmax-sse2-ld64.c &
+
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=1 -D SSE=4 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-1x4c8-minmax-sse41-ld64.c &
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=3 -D SSE=4 -o src/qd8-f32-qc8w-gemm/gen/qd8-f32-qc8w-gemm-3x4c8-minmax-sse41-ld64.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/qd8-f32-qc8w-gemm-minmax.yaml --output test/qd8-f32-qc8w-gemm-minmax.cc &
+
+wait
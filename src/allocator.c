@@ -5,13 +5,18 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #ifdef __ANDROID__
   #include <malloc.h>
 #endif
 
 #include <xnnpack/allocator.h>
 #include <xnnpack/common.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/mutex.h>
 
 
 extern int posix_memalign(void **memptr, size_t alignment, size_t size);
@@ -65,3 +70,137 @@ const struct xnn_allocator xnn_default_allocator = {
   .aligned_allocate = xnn_aligned_allocate,
   .aligned_deallocate = xnn_aligned_deallocate,
 };
+
+struct xnn_arena_block {
+  struct xnn_arena_block* next;
+  // Size of the memory following the block header, in bytes.
+  size_t capacity;
+  // Number of bytes allocated from the block.
+  size_t used;
+};
+
+// Block headers and allocation headers are padded to keep allocations aligned to XNN_ALLOCATION_ALIGNMENT.
+#define XNN_ARENA_BLOCK_HEADER_SIZE round_up_po2(sizeof(struct xnn_arena_block), XNN_ALLOCATION_ALIGNMENT)
+// Every allocation is preceded by a header with its size, so that it can be grown in place.
+#define XNN_ARENA_ALLOCATION_HEADER_SIZE round_up_po2(sizeof(size_t), XNN_ALLOCATION_ALIGNMENT)
+
+static void* block_memory(struct xnn_arena_block* block) {
+  return (void*) ((uintptr_t) block + XNN_ARENA_BLOCK_HEADER_SIZE);
+}
+
+static size_t* allocation_header(void* pointer) {
+  return (size_t*) ((uintptr_t) pointer - XNN_ARENA_ALLOCATION_HEADER_SIZE);
+}
+
+static struct xnn_arena_block* allocate_block(struct xnn_arena* arena, size_t capacity) {
+  struct xnn_arena_block* block = xnn_allocate_zero_simd_memory(XNN_ARENA_BLOCK_HEADER_SIZE + capacity);
+  if (block == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for arena block", XNN_ARENA_BLOCK_HEADER_SIZE + capacity);
+    return NULL;
+  }
+  block->capacity = capacity;
+  if (arena->block != NULL && capacity > arena->block_size) {
+    // Oversized blocks are filled by a single allocation, and are kept behind the current block so that its remaining
+    // space is not abandoned.
+    block->next = arena->block->next;
+    arena->block->next = block;
+  } else {
+    block->next = arena->block;
+    arena->block = block;
+  }
+  arena->num_blocks += 1;
+  return block;
+}
+
+enum xnn_status xnn_init_arena(struct xnn_arena* arena, size_t initial_size)
+{
+  memset(arena, 0, sizeof(struct xnn_arena));
+  arena->block_size = round_up_po2(max(initial_size, XNN_ARENA_ALLOCATION_HEADER_SIZE), XNN_ALLOCATION_ALIGNMENT);
+  if (allocate_block(arena, arena->block_size) == NULL) {
+    memset(arena, 0, sizeof(struct xnn_arena));
+    return xnn_status_out_of_memory;
+  }
+  enum xnn_status status = xnn_mutex_init(&arena->mutex);
+  if (status != xnn_status_success) {
+    xnn_release_simd_memory(arena->block);
+    memset(arena, 0, sizeof(struct xnn_arena));
+  }
+  return status;
+}
+
+// Must be called with the mutex of the arena held.
+static void* allocate_locked(struct xnn_arena* arena, size_t size)
+{
+  const size_t allocation_size = XNN_ARENA_ALLOCATION_HEADER_SIZE + round_up_po2(size, XNN_ALLOCATION_ALIGNMENT);
+  struct xnn_arena_block* block = arena->block;
+  if (block == NULL || block->capacity - block->used < allocation_size) {
+    // Allocations larger than a block get a block of their own.
+    block = allocate_block(arena, max(arena->block_size, allocation_size));
+    if (block == NULL) {
+      return NULL;
+    }
+  }
+  void* pointer = (void*) ((uintptr_t) block_memory(block) + block->used + XNN_ARENA_ALLOCATION_HEADER_SIZE);
+  *allocation_header(pointer) = allocation_size - XNN_ARENA_ALLOCATION_HEADER_SIZE;
+  block->used += allocation_size;
+  arena->allocated_bytes += allocation_size;
+  return pointer;
+}
+
+void* xnn_arena_allocate(struct xnn_arena* arena, size_t size)
+{
+  xnn_mutex_lock(&arena->mutex);
+  void* pointer = allocate_locked(arena, size);
+  xnn_mutex_unlock(&arena->mutex);
+  return pointer;
+}
+
+void* xnn_arena_reallocate(struct xnn_arena* arena, void* pointer, size_t size)
+{
+  if (pointer == NULL) {
+    return xnn_arena_allocate(arena, size);
+  }
+
+  xnn_mutex_lock(&arena->mutex);
+  size_t* header = allocation_header(pointer);
+  const size_t old_size = *header;
+  if (size <= old_size) {
+    xnn_mutex_unlock(&arena->mutex);
+    return pointer;
+  }
+
+  // The most recent allocation in the current block grows in place if the block has room for it.
+  struct xnn_arena_block* block = arena->block;
+  const size_t new_size = round_up_po2(size, XNN_ALLOCATION_ALIGNMENT);
+  const uintptr_t block_end = (uintptr_t) block_memory(block) + block->used;
+  if ((uintptr_t) pointer + old_size == block_end && block->capacity - block->used >= new_size - old_size) {
+    block->used += new_size - old_size;
+    arena->allocated_bytes += new_size - old_size;
+    *header = new_size;
+    xnn_mutex_unlock(&arena->mutex);
+    return pointer;
+  }
+
+  void* new_pointer = allocate_locked(arena, size);
+  if (new_pointer != NULL) {
+    memcpy(new_pointer, pointer, old_size);
+  }
+  xnn_mutex_unlock(&arena->mutex);
+  return new_pointer;
+}
+
+void xnn_release_arena(struct xnn_arena* arena)
+{
+  if (arena->block_size == 0) {
+    // Never initialized.
+    return;
+  }
+  struct xnn_arena_block* block = arena->block;
+  while (block != NULL) {
+    struct xnn_arena_block* next = block->next;
+    xnn_release_simd_memory(block);
+    block = next;
+  }
+  xnn_mutex_destroy(&arena->mutex);
+  memset(arena, 0, sizeof(struct xnn_arena));
+}
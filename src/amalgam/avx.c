@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <immintrin.h>
 
@@ -15,6 +16,8 @@
 #include <xnnpack/lut.h>
 #include <xnnpack/math.h>
 #include <xnnpack/prelu.h>
+#include <xnnpack/reduce.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/transpose.h>
 #include <xnnpack/unaligned.h>
 #include <xnnpack/vadd.h>
@@ -2492,6 +2495,799 @@ void xnn_f32_qu8_vcvt_ukernel__avx_x32(
   }
 }
 
+void xnn_f32_rdmax_ukernel__avx_c32(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 32; channels -= 32) {
+    const float* i = input;
+    __m256 vacc0 = _mm256_loadu_ps(output + 0);
+    __m256 vacc1 = _mm256_loadu_ps(output + 8);
+    __m256 vacc2 = _mm256_loadu_ps(output + 16);
+    __m256 vacc3 = _mm256_loadu_ps(output + 24);
+    size_t r = rows;
+    do {
+      const __m256 vx0 = _mm256_loadu_ps(i + 0);
+      const __m256 vx1 = _mm256_loadu_ps(i + 8);
+      const __m256 vx2 = _mm256_loadu_ps(i + 16);
+      const __m256 vx3 = _mm256_loadu_ps(i + 24);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm256_max_ps(vacc0, vx0);
+      vacc1 = _mm256_max_ps(vacc1, vx1);
+      vacc2 = _mm256_max_ps(vacc2, vx2);
+      vacc3 = _mm256_max_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm256_storeu_ps(output + 0, vacc0);
+    _mm256_storeu_ps(output + 8, vacc1);
+    _mm256_storeu_ps(output + 16, vacc2);
+    _mm256_storeu_ps(output + 24, vacc3);
+    output += 32;
+    input += 32;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const float* i = input;
+    __m256 vacc = _mm256_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m256 vx = _mm256_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm256_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm256_storeu_ps(output, vacc);
+    output += 8;
+    input += 8;
+  }
+  if XNN_UNLIKELY(channels >= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+    channels -= 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_load_ss(output);
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_max_ss(vacc, vx);
+      } while (--r != 0);
+
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdmin_ukernel__avx_c32(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 32; channels -= 32) {
+    const float* i = input;
+    __m256 vacc0 = _mm256_loadu_ps(output + 0);
+    __m256 vacc1 = _mm256_loadu_ps(output + 8);
+    __m256 vacc2 = _mm256_loadu_ps(output + 16);
+    __m256 vacc3 = _mm256_loadu_ps(output + 24);
+    size_t r = rows;
+    do {
+      const __m256 vx0 = _mm256_loadu_ps(i + 0);
+      const __m256 vx1 = _mm256_loadu_ps(i + 8);
+      const __m256 vx2 = _mm256_loadu_ps(i + 16);
+      const __m256 vx3 = _mm256_loadu_ps(i + 24);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm256_min_ps(vacc0, vx0);
+      vacc1 = _mm256_min_ps(vacc1, vx1);
+      vacc2 = _mm256_min_ps(vacc2, vx2);
+      vacc3 = _mm256_min_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm256_storeu_ps(output + 0, vacc0);
+    _mm256_storeu_ps(output + 8, vacc1);
+    _mm256_storeu_ps(output + 16, vacc2);
+    _mm256_storeu_ps(output + 24, vacc3);
+    output += 32;
+    input += 32;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const float* i = input;
+    __m256 vacc = _mm256_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m256 vx = _mm256_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm256_min_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm256_storeu_ps(output, vacc);
+    output += 8;
+    input += 8;
+  }
+  if XNN_UNLIKELY(channels >= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_min_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+    channels -= 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_load_ss(output);
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_min_ss(vacc, vx);
+      } while (--r != 0);
+
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsum_ukernel__avx_c32(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vscale = _mm256_broadcast_ss(&params->scalar.scale);
+  for (; channels >= 32; channels -= 32) {
+    const float* i = input;
+    __m256 vacc0 = _mm256_setzero_ps();
+    __m256 vacc1 = _mm256_setzero_ps();
+    __m256 vacc2 = _mm256_setzero_ps();
+    __m256 vacc3 = _mm256_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m256 vx0 = _mm256_loadu_ps(i + 0);
+      const __m256 vx1 = _mm256_loadu_ps(i + 8);
+      const __m256 vx2 = _mm256_loadu_ps(i + 16);
+      const __m256 vx3 = _mm256_loadu_ps(i + 24);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm256_add_ps(vacc0, vx0);
+      vacc1 = _mm256_add_ps(vacc1, vx1);
+      vacc2 = _mm256_add_ps(vacc2, vx2);
+      vacc3 = _mm256_add_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    vacc0 = _mm256_add_ps(_mm256_loadu_ps(output + 0), _mm256_mul_ps(vacc0, vscale));
+    vacc1 = _mm256_add_ps(_mm256_loadu_ps(output + 8), _mm256_mul_ps(vacc1, vscale));
+    vacc2 = _mm256_add_ps(_mm256_loadu_ps(output + 16), _mm256_mul_ps(vacc2, vscale));
+    vacc3 = _mm256_add_ps(_mm256_loadu_ps(output + 24), _mm256_mul_ps(vacc3, vscale));
+    _mm256_storeu_ps(output + 0, vacc0);
+    _mm256_storeu_ps(output + 8, vacc1);
+    _mm256_storeu_ps(output + 16, vacc2);
+    _mm256_storeu_ps(output + 24, vacc3);
+    output += 32;
+    input += 32;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const float* i = input;
+    __m256 vacc = _mm256_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m256 vx = _mm256_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm256_add_ps(vacc, vx);
+    } while (--r != 0);
+
+    vacc = _mm256_add_ps(_mm256_loadu_ps(output), _mm256_mul_ps(vacc, vscale));
+    _mm256_storeu_ps(output, vacc);
+    output += 8;
+    input += 8;
+  }
+  if XNN_UNLIKELY(channels >= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_add_ps(vacc, vx);
+    } while (--r != 0);
+
+    vacc = _mm_add_ps(_mm_loadu_ps(output), _mm_mul_ps(vacc, _mm256_castps256_ps128(vscale)));
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+    channels -= 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_setzero_ps();
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_add_ss(vacc, vx);
+      } while (--r != 0);
+
+      vacc = _mm_add_ss(_mm_load_ss(output), _mm_mul_ss(vacc, _mm256_castps256_ps128(vscale)));
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsumsq_ukernel__avx_c32(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vscale = _mm256_broadcast_ss(&params->scalar.scale);
+  for (; channels >= 32; channels -= 32) {
+    const float* i = input;
+    __m256 vacc0 = _mm256_setzero_ps();
+    __m256 vacc1 = _mm256_setzero_ps();
+    __m256 vacc2 = _mm256_setzero_ps();
+    __m256 vacc3 = _mm256_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m256 vx0 = _mm256_loadu_ps(i + 0);
+      const __m256 vx1 = _mm256_loadu_ps(i + 8);
+      const __m256 vx2 = _mm256_loadu_ps(i + 16);
+      const __m256 vx3 = _mm256_loadu_ps(i + 24);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vx0, vx0));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vx1, vx1));
+      vacc2 = _mm256_add_ps(vacc2, _mm256_mul_ps(vx2, vx2));
+      vacc3 = _mm256_add_ps(vacc3, _mm256_mul_ps(vx3, vx3));
+    } while (--r != 0);
+
+    vacc0 = _mm256_add_ps(_mm256_loadu_ps(output + 0), _mm256_mul_ps(vacc0, vscale));
+    vacc1 = _mm256_add_ps(_mm256_loadu_ps(output + 8), _mm256_mul_ps(vacc1, vscale));
+    vacc2 = _mm256_add_ps(_mm256_loadu_ps(output + 16), _mm256_mul_ps(vacc2, vscale));
+    vacc3 = _mm256_add_ps(_mm256_loadu_ps(output + 24), _mm256_mul_ps(vacc3, vscale));
+    _mm256_storeu_ps(output + 0, vacc0);
+    _mm256_storeu_ps(output + 8, vacc1);
+    _mm256_storeu_ps(output + 16, vacc2);
+    _mm256_storeu_ps(output + 24, vacc3);
+    output += 32;
+    input += 32;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const float* i = input;
+    __m256 vacc = _mm256_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m256 vx = _mm256_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vx, vx));
+    } while (--r != 0);
+
+    vacc = _mm256_add_ps(_mm256_loadu_ps(output), _mm256_mul_ps(vacc, vscale));
+    _mm256_storeu_ps(output, vacc);
+    output += 8;
+    input += 8;
+  }
+  if XNN_UNLIKELY(channels >= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(vx, vx));
+    } while (--r != 0);
+
+    vacc = _mm_add_ps(_mm_loadu_ps(output), _mm_mul_ps(vacc, _mm256_castps256_ps128(vscale)));
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+    channels -= 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_setzero_ps();
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_add_ss(vacc, _mm_mul_ss(vx, vx));
+      } while (--r != 0);
+
+      vacc = _mm_add_ss(_mm_load_ss(output), _mm_mul_ss(vacc, _mm256_castps256_ps128(vscale)));
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rmax_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vacc0 = _mm256_broadcast_ss(output);
+  __m256 vacc1 = vacc0;
+  __m256 vacc2 = vacc0;
+  __m256 vacc3 = vacc0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vacc0 = _mm256_max_ps(vacc0, vx0);
+    vacc1 = _mm256_max_ps(vacc1, vx1);
+    vacc2 = _mm256_max_ps(vacc2, vx2);
+    vacc3 = _mm256_max_ps(vacc3, vx3);
+  }
+  vacc0 = _mm256_max_ps(vacc0, vacc1);
+  vacc2 = _mm256_max_ps(vacc2, vacc3);
+  vacc0 = _mm256_max_ps(vacc0, vacc2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vacc0 = _mm256_max_ps(vacc0, vx);
+  }
+  __m128 vacc = _mm_max_ps(_mm256_castps256_ps128(vacc0), _mm256_extractf128_ps(vacc0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_max_ps(vacc, vx);
+  }
+  vacc = _mm_max_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_max_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_max_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rmin_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vacc0 = _mm256_broadcast_ss(output);
+  __m256 vacc1 = vacc0;
+  __m256 vacc2 = vacc0;
+  __m256 vacc3 = vacc0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vacc0 = _mm256_min_ps(vacc0, vx0);
+    vacc1 = _mm256_min_ps(vacc1, vx1);
+    vacc2 = _mm256_min_ps(vacc2, vx2);
+    vacc3 = _mm256_min_ps(vacc3, vx3);
+  }
+  vacc0 = _mm256_min_ps(vacc0, vacc1);
+  vacc2 = _mm256_min_ps(vacc2, vacc3);
+  vacc0 = _mm256_min_ps(vacc0, vacc2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vacc0 = _mm256_min_ps(vacc0, vx);
+  }
+  __m128 vacc = _mm_min_ps(_mm256_castps256_ps128(vacc0), _mm256_extractf128_ps(vacc0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_min_ps(vacc, vx);
+  }
+  vacc = _mm_min_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_min_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_min_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rminmax_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vmin0 = _mm256_broadcast_ss(output);
+  __m256 vmax0 = _mm256_broadcast_ss(output + 1);
+  __m256 vmin1 = vmin0;
+  __m256 vmax1 = vmax0;
+  __m256 vmin2 = vmin0;
+  __m256 vmax2 = vmax0;
+  __m256 vmin3 = vmin0;
+  __m256 vmax3 = vmax0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vmin0 = _mm256_min_ps(vmin0, vx0);
+    vmax0 = _mm256_max_ps(vmax0, vx0);
+    vmin1 = _mm256_min_ps(vmin1, vx1);
+    vmax1 = _mm256_max_ps(vmax1, vx1);
+    vmin2 = _mm256_min_ps(vmin2, vx2);
+    vmax2 = _mm256_max_ps(vmax2, vx2);
+    vmin3 = _mm256_min_ps(vmin3, vx3);
+    vmax3 = _mm256_max_ps(vmax3, vx3);
+  }
+  vmin0 = _mm256_min_ps(vmin0, vmin1);
+  vmax0 = _mm256_max_ps(vmax0, vmax1);
+  vmin2 = _mm256_min_ps(vmin2, vmin3);
+  vmax2 = _mm256_max_ps(vmax2, vmax3);
+  vmin0 = _mm256_min_ps(vmin0, vmin2);
+  vmax0 = _mm256_max_ps(vmax0, vmax2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vmin0 = _mm256_min_ps(vmin0, vx);
+    vmax0 = _mm256_max_ps(vmax0, vx);
+  }
+  __m128 vmin = _mm_min_ps(_mm256_castps256_ps128(vmin0), _mm256_extractf128_ps(vmin0, 1));
+  __m128 vmax = _mm_max_ps(_mm256_castps256_ps128(vmax0), _mm256_extractf128_ps(vmax0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vmin = _mm_min_ps(vmin, vx);
+    vmax = _mm_max_ps(vmax, vx);
+  }
+  vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+  vmin = _mm_min_ss(vmin, _mm_movehdup_ps(vmin));
+  vmax = _mm_max_ss(vmax, _mm_movehdup_ps(vmax));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vmin = _mm_min_ss(vmin, vx);
+      vmax = _mm_max_ss(vmax, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vmin);
+  _mm_store_ss(output + 1, vmax);
+}
+
+void xnn_f32_rsum_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vacc0 = _mm256_setzero_ps();
+  __m256 vacc1 = vacc0;
+  __m256 vacc2 = vacc0;
+  __m256 vacc3 = vacc0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vacc0 = _mm256_add_ps(vacc0, vx0);
+    vacc1 = _mm256_add_ps(vacc1, vx1);
+    vacc2 = _mm256_add_ps(vacc2, vx2);
+    vacc3 = _mm256_add_ps(vacc3, vx3);
+  }
+  vacc0 = _mm256_add_ps(vacc0, vacc1);
+  vacc2 = _mm256_add_ps(vacc2, vacc3);
+  vacc0 = _mm256_add_ps(vacc0, vacc2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vacc0 = _mm256_add_ps(vacc0, vx);
+  }
+  __m128 vacc = _mm_add_ps(_mm256_castps256_ps128(vacc0), _mm256_extractf128_ps(vacc0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_add_ps(vacc, vx);
+  }
+  vacc = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_add_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_add_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vacc = _mm_mul_ss(vacc, _mm_load_ss(&params->scalar.scale));
+  vacc = _mm_add_ss(vacc, _mm_load_ss(output));
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rsumsq_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vacc0 = _mm256_setzero_ps();
+  __m256 vacc1 = vacc0;
+  __m256 vacc2 = vacc0;
+  __m256 vacc3 = vacc0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vx0, vx0));
+    vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vx1, vx1));
+    vacc2 = _mm256_add_ps(vacc2, _mm256_mul_ps(vx2, vx2));
+    vacc3 = _mm256_add_ps(vacc3, _mm256_mul_ps(vx3, vx3));
+  }
+  vacc0 = _mm256_add_ps(vacc0, vacc1);
+  vacc2 = _mm256_add_ps(vacc2, vacc3);
+  vacc0 = _mm256_add_ps(vacc0, vacc2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vx, vx));
+  }
+  __m128 vacc = _mm_add_ps(_mm256_castps256_ps128(vacc0), _mm256_extractf128_ps(vacc0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_add_ps(vacc, _mm_mul_ps(vx, vx));
+  }
+  vacc = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_add_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_add_ss(vacc, _mm_mul_ss(vx, vx));
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vacc = _mm_mul_ss(vacc, _mm_load_ss(&params->scalar.scale));
+  vacc = _mm_add_ss(vacc, _mm_load_ss(output));
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rnorm_ukernel__avx_x16(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const __m256 vshift8 = _mm256_set1_ps(vshift);
+  __m256 vsum0 = _mm256_setzero_ps();
+  __m256 vsum1 = _mm256_setzero_ps();
+  __m256 vsumsq0 = _mm256_setzero_ps();
+  __m256 vsumsq1 = _mm256_setzero_ps();
+  size_t c = channels;
+  for (; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m256 vd0 = _mm256_sub_ps(_mm256_loadu_ps(i), vshift8);
+    const __m256 vd1 = _mm256_sub_ps(_mm256_loadu_ps(i + 8), vshift8);
+    i += 16;
+
+    vsum0 = _mm256_add_ps(vsum0, vd0);
+    vsum1 = _mm256_add_ps(vsum1, vd1);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd0, vd0));
+    vsumsq1 = _mm256_add_ps(vsumsq1, _mm256_mul_ps(vd1, vd1));
+  }
+  if (c >= 8 * sizeof(float)) {
+    const __m256 vd = _mm256_sub_ps(_mm256_loadu_ps(i), vshift8);
+    i += 8;
+
+    vsum0 = _mm256_add_ps(vsum0, vd);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd, vd));
+    c -= 8 * sizeof(float);
+  }
+  const __m256 vsum8 = _mm256_add_ps(vsum0, vsum1);
+  const __m256 vsumsq8 = _mm256_add_ps(vsumsq0, vsumsq1);
+  __m128 vsum = _mm_add_ps(_mm256_castps256_ps128(vsum8), _mm256_extractf128_ps(vsum8, 1));
+  __m128 vsumsq = _mm_add_ps(_mm256_castps256_ps128(vsumsq8), _mm256_extractf128_ps(vsumsq8, 1));
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_movehdup_ps(vsum));
+  vsumsq = _mm_add_ss(vsumsq, _mm_movehdup_ps(vsumsq));
+  float vsum_tail = _mm_cvtss_f32(vsum);
+  float vsumsq_tail = _mm_cvtss_f32(vsumsq);
+  for (; c != 0; c -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m256 vmean8 = _mm256_set1_ps(vmean);
+  const __m256 vrstd8 = _mm256_set1_ps(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(i);
+    const __m256 vx1 = _mm256_loadu_ps(i + 8);
+    i += 16;
+    const __m256 vscale0 = _mm256_mul_ps(_mm256_loadu_ps(gamma), vrstd8);
+    const __m256 vscale1 = _mm256_mul_ps(_mm256_loadu_ps(gamma + 8), vrstd8);
+    gamma += 16;
+
+    const __m256 vy0 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx0, vmean8), vscale0), _mm256_loadu_ps(beta));
+    const __m256 vy1 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx1, vmean8), vscale1), _mm256_loadu_ps(beta + 8));
+    beta += 16;
+
+    _mm256_storeu_ps(o, vy0);
+    _mm256_storeu_ps(o + 8, vy1);
+    o += 16;
+  }
+  if (c >= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(i);
+    i += 8;
+    const __m256 vscale = _mm256_mul_ps(_mm256_loadu_ps(gamma), vrstd8);
+    gamma += 8;
+
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx, vmean8), vscale), _mm256_loadu_ps(beta));
+    beta += 8;
+
+    _mm256_storeu_ps(o, vy);
+    o += 8;
+    c -= 8 * sizeof(float);
+  }
+  for (; c != 0; c -= sizeof(float)) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
+
 void xnn_f32_vadd_minmax_ukernel__avx_x16(
     size_t batch,
     const float* input_a,
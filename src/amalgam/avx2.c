@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <immintrin.h>
 
@@ -1302,6 +1303,185 @@ void xnn_f16_raddstoreexpminusmax_ukernel__avx2_rr1_p2_x40(
   _mm256_zeroupper();
 }
 
+void xnn_f16_vapproxgelu_ukernel__avx2_rational_13_6_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vc3 = _mm256_set1_ps(0x1.2444F2p-5f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.988454p-1f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+  const __m256 vneg_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.3E4B80p-52f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.C266FCp-43f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.7A6FFEp-34f);
+  const __m256 valpha_7 = _mm256_set1_ps(0x1.B80082p-25f);
+  const __m256 valpha_5 = _mm256_set1_ps(0x1.F28694p-17f);
+  const __m256 valpha_3 = _mm256_set1_ps(0x1.4E1BDAp-11f);
+  const __m256 valpha_1 = _mm256_set1_ps(0x1.40B3B8p-8f);
+  const __m256 vbeta_6 = _mm256_set1_ps(0x1.41A7B0p-20f);
+  const __m256 vbeta_4 = _mm256_set1_ps(0x1.F12BACp-14f);
+  const __m256 vbeta_2 = _mm256_set1_ps(0x1.29540Ap-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    const __m256 vx20 = _mm256_mul_ps(vx0, vx0);
+    const __m256 vx21 = _mm256_mul_ps(vx1, vx1);
+
+    __m256 vu0 = _mm256_fmadd_ps(vx20, vc3, vc1);
+    __m256 vu1 = _mm256_fmadd_ps(vx21, vc3, vc1);
+
+    vu0 = _mm256_mul_ps(vx0, vu0);
+    vu1 = _mm256_mul_ps(vx1, vu1);
+
+    vu0 = _mm256_max_ps(vu0, vneg_sat_cutoff);
+    vu1 = _mm256_max_ps(vu1, vneg_sat_cutoff);
+
+    vu0 = _mm256_min_ps(vu0, vsat_cutoff);
+    vu1 = _mm256_min_ps(vu1, vsat_cutoff);
+
+    const __m256 vu20 = _mm256_mul_ps(vu0, vu0);
+    const __m256 vu21 = _mm256_mul_ps(vu1, vu1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vu20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vu21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vu0, vp0);
+    vp1 = _mm256_mul_ps(vu1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vu20, vbeta_6, vbeta_4);
+    __m256 vq1 = _mm256_fmadd_ps(vu21, vbeta_6, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vu20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vu21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vu20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vu21, vq1, vbeta_0);
+
+    const __m256 vt0 = _mm256_div_ps(vp0, vq0);
+    const __m256 vt1 = _mm256_div_ps(vp1, vq1);
+
+    const __m256 vhalfx0 = _mm256_mul_ps(vx0, vhalf);
+    const __m256 vhalfx1 = _mm256_mul_ps(vx1, vhalf);
+
+    const __m256 vy0 = _mm256_fmadd_ps(vhalfx0, vt0, vhalfx0);
+    const __m256 vy1 = _mm256_fmadd_ps(vhalfx1, vt1, vhalfx1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vu = _mm256_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm256_mul_ps(vx, vu);
+
+    vu = _mm256_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm256_min_ps(vu, vsat_cutoff);
+
+    const __m256 vu2 = _mm256_mul_ps(vu, vu);
+
+    __m256 vp = _mm256_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm256_mul_ps(vu, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m256 vt = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, vt, vhalfx);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vu = _mm256_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm256_mul_ps(vx, vu);
+
+    vu = _mm256_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm256_min_ps(vu, vsat_cutoff);
+
+    const __m256 vu2 = _mm256_mul_ps(vu, vu);
+
+    __m256 vp = _mm256_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm256_mul_ps(vu, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m256 vt = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, vt, vhalfx);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
 void xnn_f16_velu_ukernel__avx2_rr1_p3_x16(
     size_t batch,
     const void* input,
@@ -1431,6 +1611,349 @@ void xnn_f16_velu_ukernel__avx2_rr1_p3_x16(
   }
 }
 
+void xnn_f16_vexp_ukernel__avx2_rr2_p5_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vmagic_bias = _mm256_set1_ps(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m256 vzero_cutoff = _mm256_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m256 vinf_cutoff = _mm256_set1_ps(0x1.62E42Ep+6f);
+  const __m256 vlog2e = _mm256_set1_ps(0x1.715476p+0f);
+  const __m256 vminus_ln2_hi = _mm256_set1_ps(-0x1.62E43p-1f);
+  const __m256 vminus_ln2_lo = _mm256_set1_ps(0x1.05C61p-29f);
+  const __m256 vplus_inf = _mm256_set1_ps(INFINITY);
+  const __m256 vc5 = _mm256_set1_ps(0x1.0F9F9Cp-7f);
+  const __m256 vc4 = _mm256_set1_ps(0x1.573A1Ap-5f);
+  const __m256 vc3 = _mm256_set1_ps(0x1.555A80p-3f);
+  const __m256 vc2 = _mm256_set1_ps(0x1.FFFDC6p-2f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.FFFFF6p-1f);
+  const __m256i vmin_exponent = _mm256_set1_epi32(0xC1000000);
+  const __m256i vmax_exponent = _mm256_set1_epi32(0x3F800000);
+  const __m256i vdefault_exponent = vmax_exponent;
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    __m256 vn0 = _mm256_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vx1, vlog2e, vmagic_bias);
+
+    __m256i veo0 = _mm256_slli_epi32(_mm256_castps_si256(vn0), 23);
+    __m256i veo1 = _mm256_slli_epi32(_mm256_castps_si256(vn1), 23);
+
+    __m256i ven0 = _mm256_max_epi32(veo0, vmin_exponent);
+    __m256i ven1 = _mm256_max_epi32(veo1, vmin_exponent);
+
+    ven0 = _mm256_min_epi32(ven0, vmax_exponent);
+    ven1 = _mm256_min_epi32(ven1, vmax_exponent);
+
+    veo0 = _mm256_sub_epi32(veo0, ven0);
+    veo1 = _mm256_sub_epi32(veo1, ven1);
+
+    const __m256 vsn0 = _mm256_castsi256_ps(_mm256_add_epi32(ven0, vdefault_exponent));
+    const __m256 vsn1 = _mm256_castsi256_ps(_mm256_add_epi32(ven1, vdefault_exponent));
+
+    const __m256 vso0 = _mm256_castsi256_ps(_mm256_add_epi32(veo0, vdefault_exponent));
+    const __m256 vso1 = _mm256_castsi256_ps(_mm256_add_epi32(veo1, vdefault_exponent));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vso0);
+    vt1 = _mm256_mul_ps(vt1, vso1);
+
+    __m256 vy0 = _mm256_mul_ps(vsn0, _mm256_fmadd_ps(vt0, vp0, vso0));
+    __m256 vy1 = _mm256_mul_ps(vsn1, _mm256_fmadd_ps(vt1, vp1, vso1));
+
+    vy0 = _mm256_andnot_ps(_mm256_cmp_ps(vx0, vzero_cutoff, _CMP_LT_OS), vy0);
+    vy1 = _mm256_andnot_ps(_mm256_cmp_ps(vx1, vzero_cutoff, _CMP_LT_OS), vy1);
+
+    vy0 = _mm256_blendv_ps(vy0, vplus_inf, _mm256_cmp_ps(vx0, vinf_cutoff, _CMP_GT_OS));
+    vy1 = _mm256_blendv_ps(vy1, vplus_inf, _mm256_cmp_ps(vx1, vinf_cutoff, _CMP_GT_OS));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vdefault_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vdefault_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS));
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vgelu_ukernel__avx2_rational_13_8_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vsqrt1_2 = _mm256_set1_ps(0x1.6A09E6p-1f);
+  const __m256 vneg_erf_cutoff = _mm256_set1_ps(-0x1.000000p+2f);
+  const __m256 verf_cutoff = _mm256_set1_ps(0x1.000000p+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.2BBE16p-32f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.DBFFDCp-26f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.19FEA2p-19f);
+  const __m256 valpha_7 = _mm256_set1_ps(-0x1.DD85A4p-15f);
+  const __m256 valpha_5 = _mm256_set1_ps(-0x1.8158C6p-11f);
+  const __m256 valpha_3 = _mm256_set1_ps(-0x1.8343ECp-9f);
+  const __m256 valpha_1 = _mm256_set1_ps(-0x1.07B7A8p-6f);
+  const __m256 vbeta_8 = _mm256_set1_ps(-0x1.E8C19Ap-17f);
+  const __m256 vbeta_6 = _mm256_set1_ps(-0x1.BF7A52p-13f);
+  const __m256 vbeta_4 = _mm256_set1_ps(-0x1.B9249Cp-10f);
+  const __m256 vbeta_2 = _mm256_set1_ps(-0x1.E337F0p-8f);
+  const __m256 vbeta_0 = _mm256_set1_ps(-0x1.D36D4Ep-7f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    __m256 vz0 = _mm256_mul_ps(vx0, vsqrt1_2);
+    __m256 vz1 = _mm256_mul_ps(vx1, vsqrt1_2);
+
+    vz0 = _mm256_max_ps(vz0, vneg_erf_cutoff);
+    vz1 = _mm256_max_ps(vz1, vneg_erf_cutoff);
+
+    vz0 = _mm256_min_ps(vz0, verf_cutoff);
+    vz1 = _mm256_min_ps(vz1, verf_cutoff);
+
+    const __m256 vz20 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vz21 = _mm256_mul_ps(vz1, vz1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vz20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vz21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vz0, vp0);
+    vp1 = _mm256_mul_ps(vz1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vz20, vbeta_8, vbeta_6);
+    __m256 vq1 = _mm256_fmadd_ps(vz21, vbeta_8, vbeta_6);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_4);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_0);
+
+    const __m256 verf0 = _mm256_div_ps(vp0, vq0);
+    const __m256 verf1 = _mm256_div_ps(vp1, vq1);
+
+    const __m256 vhalfx0 = _mm256_mul_ps(vx0, vhalf);
+    const __m256 vhalfx1 = _mm256_mul_ps(vx1, vhalf);
+
+    const __m256 vy0 = _mm256_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m256 vy1 = _mm256_fmadd_ps(vhalfx1, verf1, vhalfx1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vz = _mm256_mul_ps(vx, vsqrt1_2);
+    vz = _mm256_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm256_min_ps(vz, verf_cutoff);
+
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm256_mul_ps(vz, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_0);
+
+    const __m256 verf = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vz = _mm256_mul_ps(vx, vsqrt1_2);
+    vz = _mm256_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm256_min_ps(vz, verf_cutoff);
+
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm256_mul_ps(vz, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_0);
+
+    const __m256 verf = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
 void xnn_f16_vsigmoid_ukernel__avx2_rr1_p2_rcp_x32(
     size_t batch,
     const void* input,
@@ -1560,28 +2083,336 @@ void xnn_f16_vsigmoid_ukernel__avx2_rr1_p2_rcp_x32(
   if XNN_UNLIKELY(batch != 0) {
     assert(batch >= 1 * sizeof(uint16_t));
     assert(batch <= 7 * sizeof(uint16_t));
-    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
-
-    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    const __m256 vp = _mm256_fmadd_ps(vc2, vt, vc1);
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    const __m256 vr = _mm256_rcp_ps(vd);
+    __m256 vf = _mm256_mul_ps(ve, vr);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    __m128i vh = _mm256_cvtps_ph(vf, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vsilu_ukernel__avx2_rr2_p5_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vsign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 vmagic_bias = _mm256_set1_ps(0x1.8000FEp23f);
+  const __m256 vlog2e = _mm256_set1_ps(0x1.715476p0f);
+  const __m256 vminus_ln2_hi = _mm256_set1_ps(-0x1.62E400p-1f);
+  const __m256 vminus_ln2_lo = _mm256_set1_ps(-0x1.7F7D1Cp-20f);
+  const __m256 vc5 = _mm256_set1_ps(0x1.0F9F9Cp-7f);
+  const __m256 vc4 = _mm256_set1_ps(0x1.573A1Ap-5f);
+  const __m256 vc3 = _mm256_set1_ps(0x1.555A80p-3f);
+  const __m256 vc2 = _mm256_set1_ps(0x1.FFFDC6p-2f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.FFFFF6p-1f);
+  const __m256 vone = _mm256_set1_ps(1.0f);
+  const __m256 vdenorm_cutoff = _mm256_set1_ps(-0x1.5D589Ep+6f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    const __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    const __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+
+    __m256 vn0 = _mm256_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vz1, vlog2e, vmagic_bias);
+
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vz0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vz1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+
+    const __m256 ve0 = _mm256_fmadd_ps(vt0, vp0, vs0);
+    const __m256 ve1 = _mm256_fmadd_ps(vt1, vp1, vs1);
+
+    const __m256 vd0 = _mm256_add_ps(ve0, vone);
+    const __m256 vd1 = _mm256_add_ps(ve1, vone);
+
+    __m256 vf0 = _mm256_div_ps(ve0, vd0);
+    __m256 vf1 = _mm256_div_ps(ve1, vd1);
+
+    vf0 = _mm256_andnot_ps(_mm256_cmp_ps(vz0, vdenorm_cutoff, _CMP_LT_OS), vf0);
+    vf1 = _mm256_andnot_ps(_mm256_cmp_ps(vz1, vdenorm_cutoff, _CMP_LT_OS), vf1);
+
+    vf0 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf0), vf0, vx0);
+    vf1 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf1), vf1, vx1);
+
+    const __m256 vy0 = _mm256_mul_ps(vx0, vf0);
+    const __m256 vy1 = _mm256_mul_ps(vx1, vf1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vz);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+    const __m256 vd = _mm256_add_ps(ve, vone);
+
+    __m256 vf = _mm256_div_ps(ve, vd);
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vz);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+    const __m256 vd = _mm256_add_ps(ve, vone);
+
+    __m256 vf = _mm256_div_ps(ve, vd);
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vtanh_ukernel__avx2_rational_13_6_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vneg_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.3E4B80p-52f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.C266FCp-43f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.7A6FFEp-34f);
+  const __m256 valpha_7 = _mm256_set1_ps(0x1.B80082p-25f);
+  const __m256 valpha_5 = _mm256_set1_ps(0x1.F28694p-17f);
+  const __m256 valpha_3 = _mm256_set1_ps(0x1.4E1BDAp-11f);
+  const __m256 valpha_1 = _mm256_set1_ps(0x1.40B3B8p-8f);
+  const __m256 vbeta_6 = _mm256_set1_ps(0x1.41A7B0p-20f);
+  const __m256 vbeta_4 = _mm256_set1_ps(0x1.F12BACp-14f);
+  const __m256 vbeta_2 = _mm256_set1_ps(0x1.29540Ap-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    vx0 = _mm256_max_ps(vx0, vneg_sat_cutoff);
+    vx1 = _mm256_max_ps(vx1, vneg_sat_cutoff);
+
+    vx0 = _mm256_min_ps(vx0, vsat_cutoff);
+    vx1 = _mm256_min_ps(vx1, vsat_cutoff);
+
+    const __m256 vx20 = _mm256_mul_ps(vx0, vx0);
+    const __m256 vx21 = _mm256_mul_ps(vx1, vx1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vx20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vx21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vx0, vp0);
+    vp1 = _mm256_mul_ps(vx1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vx20, vbeta_6, vbeta_4);
+    __m256 vq1 = _mm256_fmadd_ps(vx21, vbeta_6, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vx20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vx21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vx20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vx21, vq1, vbeta_0);
+
+    const __m256 vy0 = _mm256_div_ps(vp0, vq0);
+    const __m256 vy1 = _mm256_div_ps(vp1, vq1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    vx = _mm256_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm256_min_ps(vx, vsat_cutoff);
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vp = _mm256_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm256_mul_ps(vx, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m256 vy = _mm256_div_ps(vp, vq);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
 
-    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
-    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
-    vn = _mm256_sub_ps(vn, vmagic_bias);
+    vx = _mm256_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm256_min_ps(vx, vsat_cutoff);
 
-    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
 
-    const __m256 vp = _mm256_fmadd_ps(vc2, vt, vc1);
-    vt = _mm256_mul_ps(vt, vs);
-    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+    __m256 vp = _mm256_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm256_mul_ps(vx, vp);
 
-    const __m256 vd = _mm256_add_ps(ve, vone);
-    const __m256 vr = _mm256_rcp_ps(vd);
-    __m256 vf = _mm256_mul_ps(ve, vr);
+    __m256 vq = _mm256_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_0);
 
-    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
-    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+    const __m256 vy = _mm256_div_ps(vp, vq);
 
-    __m128i vh = _mm256_cvtps_ph(vf, _MM_FROUND_TO_NEAREST_INT);
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
     if (batch & (4 * sizeof(uint16_t))) {
       _mm_storel_epi64((__m128i*) o, vh);
       vh = _mm_unpackhi_epi64(vh, vh);
@@ -2089,6 +2920,179 @@ void xnn_f32_velu_ukernel__avx2_rr1_lut4_p4_perm_x56(
   }
 }
 
+void xnn_f32_vexp_ukernel__avx2_rr2_p5_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vmagic_bias = _mm256_set1_ps(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m256 vzero_cutoff = _mm256_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m256 vinf_cutoff = _mm256_set1_ps(0x1.62E42Ep+6f);
+  const __m256 vlog2e = _mm256_set1_ps(0x1.715476p+0f);
+  const __m256 vminus_ln2_hi = _mm256_set1_ps(-0x1.62E43p-1f);
+  const __m256 vminus_ln2_lo = _mm256_set1_ps(0x1.05C61p-29f);
+  const __m256 vplus_inf = _mm256_set1_ps(INFINITY);
+  const __m256 vc5 = _mm256_set1_ps(0x1.0F9F9Cp-7f);
+  const __m256 vc4 = _mm256_set1_ps(0x1.573A1Ap-5f);
+  const __m256 vc3 = _mm256_set1_ps(0x1.555A80p-3f);
+  const __m256 vc2 = _mm256_set1_ps(0x1.FFFDC6p-2f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.FFFFF6p-1f);
+  const __m256i vmin_exponent = _mm256_set1_epi32(0xC1000000);
+  const __m256i vmax_exponent = _mm256_set1_epi32(0x3F800000);
+  const __m256i vdefault_exponent = vmax_exponent;
+
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    __m256 vn0 = _mm256_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vx1, vlog2e, vmagic_bias);
+
+    __m256i veo0 = _mm256_slli_epi32(_mm256_castps_si256(vn0), 23);
+    __m256i veo1 = _mm256_slli_epi32(_mm256_castps_si256(vn1), 23);
+
+    __m256i ven0 = _mm256_max_epi32(veo0, vmin_exponent);
+    __m256i ven1 = _mm256_max_epi32(veo1, vmin_exponent);
+
+    ven0 = _mm256_min_epi32(ven0, vmax_exponent);
+    ven1 = _mm256_min_epi32(ven1, vmax_exponent);
+
+    veo0 = _mm256_sub_epi32(veo0, ven0);
+    veo1 = _mm256_sub_epi32(veo1, ven1);
+
+    const __m256 vsn0 = _mm256_castsi256_ps(_mm256_add_epi32(ven0, vdefault_exponent));
+    const __m256 vsn1 = _mm256_castsi256_ps(_mm256_add_epi32(ven1, vdefault_exponent));
+
+    const __m256 vso0 = _mm256_castsi256_ps(_mm256_add_epi32(veo0, vdefault_exponent));
+    const __m256 vso1 = _mm256_castsi256_ps(_mm256_add_epi32(veo1, vdefault_exponent));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vso0);
+    vt1 = _mm256_mul_ps(vt1, vso1);
+
+    __m256 vy0 = _mm256_mul_ps(vsn0, _mm256_fmadd_ps(vt0, vp0, vso0));
+    __m256 vy1 = _mm256_mul_ps(vsn1, _mm256_fmadd_ps(vt1, vp1, vso1));
+
+    vy0 = _mm256_andnot_ps(_mm256_cmp_ps(vx0, vzero_cutoff, _CMP_LT_OS), vy0);
+    vy1 = _mm256_andnot_ps(_mm256_cmp_ps(vx1, vzero_cutoff, _CMP_LT_OS), vy1);
+
+    vy0 = _mm256_blendv_ps(vy0, vplus_inf, _mm256_cmp_ps(vx0, vinf_cutoff, _CMP_GT_OS));
+    vy1 = _mm256_blendv_ps(vy1, vplus_inf, _mm256_cmp_ps(vx1, vinf_cutoff, _CMP_GT_OS));
+
+    _mm256_storeu_ps(output, vy0);
+    _mm256_storeu_ps(output + 8, vy1);
+    output += 16;
+  }
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vdefault_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS));
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - batch));
+
+    const __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vdefault_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (batch & (4 * sizeof(float))) {
+      _mm_storeu_ps(output, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      output += 4;
+    }
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy_lo);
+    }
+  }
+}
+
 void xnn_f32_vsigmoid_ukernel__avx2_rr1_p5_div_x40(
     size_t batch,
     const float* input,
@@ -2292,6 +3296,169 @@ void xnn_f32_vsigmoid_ukernel__avx2_rr1_p5_div_x40(
   }
 }
 
+void xnn_f32_vsilu_ukernel__avx2_rr2_p5_div_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vsign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 vmagic_bias = _mm256_set1_ps(0x1.8000FEp23f);
+  const __m256 vlog2e = _mm256_set1_ps(0x1.715476p0f);
+  const __m256 vminus_ln2_hi = _mm256_set1_ps(-0x1.62E400p-1f);
+  const __m256 vminus_ln2_lo = _mm256_set1_ps(-0x1.7F7D1Cp-20f);
+  const __m256 vc5 = _mm256_set1_ps(0x1.0F9F9Cp-7f);
+  const __m256 vc4 = _mm256_set1_ps(0x1.573A1Ap-5f);
+  const __m256 vc3 = _mm256_set1_ps(0x1.555A80p-3f);
+  const __m256 vc2 = _mm256_set1_ps(0x1.FFFDC6p-2f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.FFFFF6p-1f);
+  const __m256 vone = _mm256_set1_ps(1.0f);
+  const __m256 vdenorm_cutoff = _mm256_set1_ps(-0x1.5D589Ep+6f);
+
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    const __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    const __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+
+    __m256 vn0 = _mm256_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vz1, vlog2e, vmagic_bias);
+
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vz0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vz1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+
+    const __m256 ve0 = _mm256_fmadd_ps(vt0, vp0, vs0);
+    const __m256 ve1 = _mm256_fmadd_ps(vt1, vp1, vs1);
+
+    const __m256 vd0 = _mm256_add_ps(ve0, vone);
+    const __m256 vd1 = _mm256_add_ps(ve1, vone);
+
+    __m256 vf0 = _mm256_div_ps(ve0, vd0);
+    __m256 vf1 = _mm256_div_ps(ve1, vd1);
+
+    vf0 = _mm256_andnot_ps(_mm256_cmp_ps(vz0, vdenorm_cutoff, _CMP_LT_OS), vf0);
+    vf1 = _mm256_andnot_ps(_mm256_cmp_ps(vz1, vdenorm_cutoff, _CMP_LT_OS), vf1);
+
+    vf0 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf0), vf0, vx0);
+    vf1 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf1), vf1, vx1);
+
+    const __m256 vy0 = _mm256_mul_ps(vx0, vf0);
+    const __m256 vy1 = _mm256_mul_ps(vx1, vf1);
+
+    _mm256_storeu_ps(output, vy0);
+    _mm256_storeu_ps(output + 8, vy1);
+    output += 16;
+  }
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vz);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+    const __m256 vd = _mm256_add_ps(ve, vone);
+
+    __m256 vf = _mm256_div_ps(ve, vd);
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - batch));
+
+    const __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vz);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+    const __m256 vd = _mm256_add_ps(ve, vone);
+
+    __m256 vf = _mm256_div_ps(ve, vd);
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (batch & (4 * sizeof(float))) {
+      _mm_storeu_ps(output, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      output += 4;
+    }
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy_lo);
+    }
+  }
+}
+
 void xnn_qc8_dwconv_minmax_fp32_ukernel_25p16c__avx2_mul32(
     size_t channels,
     size_t output_width,
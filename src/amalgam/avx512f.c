@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -16,6 +17,8 @@
 #include <xnnpack/intrinsics-polyfill.h>
 #include <xnnpack/math.h>
 #include <xnnpack/prelu.h>
+#include <xnnpack/reduce.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vunary.h>
 
@@ -1819,6 +1822,839 @@ void xnn_f32_prelu_ukernel__avx512f_2x16(
   } while (rows != 0);
 }
 
+void xnn_f32_rdmax_ukernel__avx512f_c64(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 64; channels -= 64) {
+    const float* i = input;
+    __m512 vacc0 = _mm512_loadu_ps(output + 0);
+    __m512 vacc1 = _mm512_loadu_ps(output + 16);
+    __m512 vacc2 = _mm512_loadu_ps(output + 32);
+    __m512 vacc3 = _mm512_loadu_ps(output + 48);
+    size_t r = rows;
+    do {
+      const __m512 vx0 = _mm512_loadu_ps(i + 0);
+      const __m512 vx1 = _mm512_loadu_ps(i + 16);
+      const __m512 vx2 = _mm512_loadu_ps(i + 32);
+      const __m512 vx3 = _mm512_loadu_ps(i + 48);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm512_max_ps(vacc0, vx0);
+      vacc1 = _mm512_max_ps(vacc1, vx1);
+      vacc2 = _mm512_max_ps(vacc2, vx2);
+      vacc3 = _mm512_max_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm512_storeu_ps(output + 0, vacc0);
+    _mm512_storeu_ps(output + 16, vacc1);
+    _mm512_storeu_ps(output + 32, vacc2);
+    _mm512_storeu_ps(output + 48, vacc3);
+    output += 64;
+    input += 64;
+  }
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m512 vacc = _mm512_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm512_storeu_ps(output, vacc);
+    output += 16;
+    input += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1);
+    assert(channels <= 15);
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << channels) - UINT32_C(1)));
+
+    const float* i = input;
+    __m512 vacc = _mm512_maskz_loadu_ps(vmask, output);
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm512_mask_storeu_ps(output, vmask, vacc);
+  }
+}
+
+void xnn_f32_rdmin_ukernel__avx512f_c64(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 64; channels -= 64) {
+    const float* i = input;
+    __m512 vacc0 = _mm512_loadu_ps(output + 0);
+    __m512 vacc1 = _mm512_loadu_ps(output + 16);
+    __m512 vacc2 = _mm512_loadu_ps(output + 32);
+    __m512 vacc3 = _mm512_loadu_ps(output + 48);
+    size_t r = rows;
+    do {
+      const __m512 vx0 = _mm512_loadu_ps(i + 0);
+      const __m512 vx1 = _mm512_loadu_ps(i + 16);
+      const __m512 vx2 = _mm512_loadu_ps(i + 32);
+      const __m512 vx3 = _mm512_loadu_ps(i + 48);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm512_min_ps(vacc0, vx0);
+      vacc1 = _mm512_min_ps(vacc1, vx1);
+      vacc2 = _mm512_min_ps(vacc2, vx2);
+      vacc3 = _mm512_min_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm512_storeu_ps(output + 0, vacc0);
+    _mm512_storeu_ps(output + 16, vacc1);
+    _mm512_storeu_ps(output + 32, vacc2);
+    _mm512_storeu_ps(output + 48, vacc3);
+    output += 64;
+    input += 64;
+  }
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m512 vacc = _mm512_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_min_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm512_storeu_ps(output, vacc);
+    output += 16;
+    input += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1);
+    assert(channels <= 15);
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << channels) - UINT32_C(1)));
+
+    const float* i = input;
+    __m512 vacc = _mm512_maskz_loadu_ps(vmask, output);
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_min_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm512_mask_storeu_ps(output, vmask, vacc);
+  }
+}
+
+void xnn_f32_rdsum_ukernel__avx512f_c64(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vscale = _mm512_set1_ps(params->scalar.scale);
+  for (; channels >= 64; channels -= 64) {
+    const float* i = input;
+    __m512 vacc0 = _mm512_setzero_ps();
+    __m512 vacc1 = _mm512_setzero_ps();
+    __m512 vacc2 = _mm512_setzero_ps();
+    __m512 vacc3 = _mm512_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m512 vx0 = _mm512_loadu_ps(i + 0);
+      const __m512 vx1 = _mm512_loadu_ps(i + 16);
+      const __m512 vx2 = _mm512_loadu_ps(i + 32);
+      const __m512 vx3 = _mm512_loadu_ps(i + 48);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm512_add_ps(vacc0, vx0);
+      vacc1 = _mm512_add_ps(vacc1, vx1);
+      vacc2 = _mm512_add_ps(vacc2, vx2);
+      vacc3 = _mm512_add_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    vacc0 = _mm512_fmadd_ps(vacc0, vscale, _mm512_loadu_ps(output + 0));
+    vacc1 = _mm512_fmadd_ps(vacc1, vscale, _mm512_loadu_ps(output + 16));
+    vacc2 = _mm512_fmadd_ps(vacc2, vscale, _mm512_loadu_ps(output + 32));
+    vacc3 = _mm512_fmadd_ps(vacc3, vscale, _mm512_loadu_ps(output + 48));
+    _mm512_storeu_ps(output + 0, vacc0);
+    _mm512_storeu_ps(output + 16, vacc1);
+    _mm512_storeu_ps(output + 32, vacc2);
+    _mm512_storeu_ps(output + 48, vacc3);
+    output += 64;
+    input += 64;
+  }
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m512 vacc = _mm512_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_add_ps(vacc, vx);
+    } while (--r != 0);
+
+    vacc = _mm512_fmadd_ps(vacc, vscale, _mm512_loadu_ps(output));
+    _mm512_storeu_ps(output, vacc);
+    output += 16;
+    input += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1);
+    assert(channels <= 15);
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << channels) - UINT32_C(1)));
+
+    const float* i = input;
+    __m512 vacc = _mm512_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_add_ps(vacc, vx);
+    } while (--r != 0);
+
+    vacc = _mm512_fmadd_ps(vacc, vscale, _mm512_maskz_loadu_ps(vmask, output));
+    _mm512_mask_storeu_ps(output, vmask, vacc);
+  }
+}
+
+void xnn_f32_rdsumsq_ukernel__avx512f_c64(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vscale = _mm512_set1_ps(params->scalar.scale);
+  for (; channels >= 64; channels -= 64) {
+    const float* i = input;
+    __m512 vacc0 = _mm512_setzero_ps();
+    __m512 vacc1 = _mm512_setzero_ps();
+    __m512 vacc2 = _mm512_setzero_ps();
+    __m512 vacc3 = _mm512_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m512 vx0 = _mm512_loadu_ps(i + 0);
+      const __m512 vx1 = _mm512_loadu_ps(i + 16);
+      const __m512 vx2 = _mm512_loadu_ps(i + 32);
+      const __m512 vx3 = _mm512_loadu_ps(i + 48);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm512_fmadd_ps(vx0, vx0, vacc0);
+      vacc1 = _mm512_fmadd_ps(vx1, vx1, vacc1);
+      vacc2 = _mm512_fmadd_ps(vx2, vx2, vacc2);
+      vacc3 = _mm512_fmadd_ps(vx3, vx3, vacc3);
+    } while (--r != 0);
+
+    vacc0 = _mm512_fmadd_ps(vacc0, vscale, _mm512_loadu_ps(output + 0));
+    vacc1 = _mm512_fmadd_ps(vacc1, vscale, _mm512_loadu_ps(output + 16));
+    vacc2 = _mm512_fmadd_ps(vacc2, vscale, _mm512_loadu_ps(output + 32));
+    vacc3 = _mm512_fmadd_ps(vacc3, vscale, _mm512_loadu_ps(output + 48));
+    _mm512_storeu_ps(output + 0, vacc0);
+    _mm512_storeu_ps(output + 16, vacc1);
+    _mm512_storeu_ps(output + 32, vacc2);
+    _mm512_storeu_ps(output + 48, vacc3);
+    output += 64;
+    input += 64;
+  }
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m512 vacc = _mm512_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_fmadd_ps(vx, vx, vacc);
+    } while (--r != 0);
+
+    vacc = _mm512_fmadd_ps(vacc, vscale, _mm512_loadu_ps(output));
+    _mm512_storeu_ps(output, vacc);
+    output += 16;
+    input += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1);
+    assert(channels <= 15);
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << channels) - UINT32_C(1)));
+
+    const float* i = input;
+    __m512 vacc = _mm512_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_fmadd_ps(vx, vx, vacc);
+    } while (--r != 0);
+
+    vacc = _mm512_fmadd_ps(vacc, vscale, _mm512_maskz_loadu_ps(vmask, output));
+    _mm512_mask_storeu_ps(output, vmask, vacc);
+  }
+}
+
+void xnn_f32_rmax_ukernel__avx512f_x64(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m512 vacc0 = _mm512_set1_ps(*output);
+  __m512 vacc1 = vacc0;
+  __m512 vacc2 = vacc0;
+  __m512 vacc3 = vacc0;
+  for (; batch >= 64 * sizeof(float); batch -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    const __m512 vx2 = _mm512_loadu_ps(input + 32);
+    const __m512 vx3 = _mm512_loadu_ps(input + 48);
+    input += 64;
+
+    vacc0 = _mm512_max_ps(vacc0, vx0);
+    vacc1 = _mm512_max_ps(vacc1, vx1);
+    vacc2 = _mm512_max_ps(vacc2, vx2);
+    vacc3 = _mm512_max_ps(vacc3, vx3);
+  }
+  vacc0 = _mm512_max_ps(vacc0, vacc1);
+  vacc2 = _mm512_max_ps(vacc2, vacc3);
+  vacc0 = _mm512_max_ps(vacc0, vacc2);
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    vacc0 = _mm512_max_ps(vacc0, vx);
+  }
+  const __m256 vacc_lo = _mm256_max_ps(_mm512_castps512_ps256(vacc0), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(vacc0), 1)));
+  __m128 vacc = _mm_max_ps(_mm256_castps256_ps128(vacc_lo), _mm256_extractf128_ps(vacc_lo, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_max_ps(vacc, vx);
+  }
+  vacc = _mm_max_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_max_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_max_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rmin_ukernel__avx512f_x64(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m512 vacc0 = _mm512_set1_ps(*output);
+  __m512 vacc1 = vacc0;
+  __m512 vacc2 = vacc0;
+  __m512 vacc3 = vacc0;
+  for (; batch >= 64 * sizeof(float); batch -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    const __m512 vx2 = _mm512_loadu_ps(input + 32);
+    const __m512 vx3 = _mm512_loadu_ps(input + 48);
+    input += 64;
+
+    vacc0 = _mm512_min_ps(vacc0, vx0);
+    vacc1 = _mm512_min_ps(vacc1, vx1);
+    vacc2 = _mm512_min_ps(vacc2, vx2);
+    vacc3 = _mm512_min_ps(vacc3, vx3);
+  }
+  vacc0 = _mm512_min_ps(vacc0, vacc1);
+  vacc2 = _mm512_min_ps(vacc2, vacc3);
+  vacc0 = _mm512_min_ps(vacc0, vacc2);
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    vacc0 = _mm512_min_ps(vacc0, vx);
+  }
+  const __m256 vacc_lo = _mm256_min_ps(_mm512_castps512_ps256(vacc0), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(vacc0), 1)));
+  __m128 vacc = _mm_min_ps(_mm256_castps256_ps128(vacc_lo), _mm256_extractf128_ps(vacc_lo, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_min_ps(vacc, vx);
+  }
+  vacc = _mm_min_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_min_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_min_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rsum_ukernel__avx512f_x64(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m512 vacc0 = _mm512_setzero_ps();
+  __m512 vacc1 = vacc0;
+  __m512 vacc2 = vacc0;
+  __m512 vacc3 = vacc0;
+  for (; batch >= 64 * sizeof(float); batch -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    const __m512 vx2 = _mm512_loadu_ps(input + 32);
+    const __m512 vx3 = _mm512_loadu_ps(input + 48);
+    input += 64;
+
+    vacc0 = _mm512_add_ps(vacc0, vx0);
+    vacc1 = _mm512_add_ps(vacc1, vx1);
+    vacc2 = _mm512_add_ps(vacc2, vx2);
+    vacc3 = _mm512_add_ps(vacc3, vx3);
+  }
+  vacc0 = _mm512_add_ps(vacc0, vacc1);
+  vacc2 = _mm512_add_ps(vacc2, vacc3);
+  vacc0 = _mm512_add_ps(vacc0, vacc2);
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    vacc0 = _mm512_add_ps(vacc0, vx);
+  }
+  const __m256 vacc_lo = _mm256_add_ps(_mm512_castps512_ps256(vacc0), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(vacc0), 1)));
+  __m128 vacc = _mm_add_ps(_mm256_castps256_ps128(vacc_lo), _mm256_extractf128_ps(vacc_lo, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_add_ps(vacc, vx);
+  }
+  vacc = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_add_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_add_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vacc = _mm_mul_ss(vacc, _mm_load_ss(&params->scalar.scale));
+  vacc = _mm_add_ss(vacc, _mm_load_ss(output));
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rsumsq_ukernel__avx512f_x64(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m512 vacc0 = _mm512_setzero_ps();
+  __m512 vacc1 = vacc0;
+  __m512 vacc2 = vacc0;
+  __m512 vacc3 = vacc0;
+  for (; batch >= 64 * sizeof(float); batch -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    const __m512 vx2 = _mm512_loadu_ps(input + 32);
+    const __m512 vx3 = _mm512_loadu_ps(input + 48);
+    input += 64;
+
+    vacc0 = _mm512_fmadd_ps(vx0, vx0, vacc0);
+    vacc1 = _mm512_fmadd_ps(vx1, vx1, vacc1);
+    vacc2 = _mm512_fmadd_ps(vx2, vx2, vacc2);
+    vacc3 = _mm512_fmadd_ps(vx3, vx3, vacc3);
+  }
+  vacc0 = _mm512_add_ps(vacc0, vacc1);
+  vacc2 = _mm512_add_ps(vacc2, vacc3);
+  vacc0 = _mm512_add_ps(vacc0, vacc2);
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    vacc0 = _mm512_fmadd_ps(vx, vx, vacc0);
+  }
+  const __m256 vacc_lo = _mm256_add_ps(_mm512_castps512_ps256(vacc0), _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(vacc0), 1)));
+  __m128 vacc = _mm_add_ps(_mm256_castps256_ps128(vacc_lo), _mm256_extractf128_ps(vacc_lo, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_add_ps(vacc, _mm_mul_ps(vx, vx));
+  }
+  vacc = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_add_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_add_ss(vacc, _mm_mul_ss(vx, vx));
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vacc = _mm_mul_ss(vacc, _mm_load_ss(&params->scalar.scale));
+  vacc = _mm_add_ss(vacc, _mm_load_ss(output));
+  _mm_store_ss(output, vacc);
+}
+
+void xnn_f32_rnorm_ukernel__avx512f_x32(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const __m512 vshift16 = _mm512_set1_ps(vshift);
+  __m512 vsum0 = _mm512_setzero_ps();
+  __m512 vsum1 = _mm512_setzero_ps();
+  __m512 vsumsq0 = _mm512_setzero_ps();
+  __m512 vsumsq1 = _mm512_setzero_ps();
+  size_t c = channels;
+  for (; c >= 32 * sizeof(float); c -= 32 * sizeof(float)) {
+    const __m512 vd0 = _mm512_sub_ps(_mm512_loadu_ps(i), vshift16);
+    const __m512 vd1 = _mm512_sub_ps(_mm512_loadu_ps(i + 16), vshift16);
+    i += 32;
+
+    vsum0 = _mm512_add_ps(vsum0, vd0);
+    vsum1 = _mm512_add_ps(vsum1, vd1);
+    vsumsq0 = _mm512_fmadd_ps(vd0, vd0, vsumsq0);
+    vsumsq1 = _mm512_fmadd_ps(vd1, vd1, vsumsq1);
+  }
+  for (; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m512 vd = _mm512_sub_ps(_mm512_loadu_ps(i), vshift16);
+    i += 16;
+
+    vsum0 = _mm512_add_ps(vsum0, vd);
+    vsumsq0 = _mm512_fmadd_ps(vd, vd, vsumsq0);
+  }
+  if XNN_UNLIKELY(c != 0) {
+    assert(c >= 1 * sizeof(float));
+    assert(c <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on c).
+    c >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << c) - UINT32_C(1)));
+
+    const __m512 vd = _mm512_maskz_sub_ps(vmask, _mm512_maskz_loadu_ps(vmask, i), vshift16);
+    vsum1 = _mm512_add_ps(vsum1, vd);
+    vsumsq1 = _mm512_fmadd_ps(vd, vd, vsumsq1);
+  }
+  const float vsum = _mm512_reduce_add_ps(_mm512_add_ps(vsum0, vsum1));
+  const float vsumsq = _mm512_reduce_add_ps(_mm512_add_ps(vsumsq0, vsumsq1));
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum * vinv_n;
+  const float vmeansq = vsumsq * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m512 vmean16 = _mm512_set1_ps(vmean);
+  const __m512 vrstd16 = _mm512_set1_ps(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 32 * sizeof(float); c -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(i);
+    const __m512 vx1 = _mm512_loadu_ps(i + 16);
+    i += 32;
+    const __m512 vscale0 = _mm512_mul_ps(_mm512_loadu_ps(gamma), vrstd16);
+    const __m512 vscale1 = _mm512_mul_ps(_mm512_loadu_ps(gamma + 16), vrstd16);
+    gamma += 32;
+
+    const __m512 vy0 = _mm512_fmadd_ps(_mm512_sub_ps(vx0, vmean16), vscale0, _mm512_loadu_ps(beta));
+    const __m512 vy1 = _mm512_fmadd_ps(_mm512_sub_ps(vx1, vmean16), vscale1, _mm512_loadu_ps(beta + 16));
+    beta += 32;
+
+    _mm512_storeu_ps(o, vy0);
+    _mm512_storeu_ps(o + 16, vy1);
+    o += 32;
+  }
+  for (; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(i);
+    i += 16;
+    const __m512 vscale = _mm512_mul_ps(_mm512_loadu_ps(gamma), vrstd16);
+    gamma += 16;
+
+    const __m512 vy = _mm512_fmadd_ps(_mm512_sub_ps(vx, vmean16), vscale, _mm512_loadu_ps(beta));
+    beta += 16;
+
+    _mm512_storeu_ps(o, vy);
+    o += 16;
+  }
+  if XNN_UNLIKELY(c != 0) {
+    assert(c >= 1 * sizeof(float));
+    assert(c <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on c).
+    c >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << c) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+    const __m512 vscale = _mm512_mul_ps(_mm512_maskz_loadu_ps(vmask, gamma), vrstd16);
+    const __m512 vy = _mm512_fmadd_ps(_mm512_sub_ps(vx, vmean16), vscale, _mm512_maskz_loadu_ps(vmask, beta));
+    _mm512_mask_storeu_ps(o, vmask, vy);
+  }
+}
+
+void xnn_f32_vapproxgelu_ukernel__avx512f_rational_13_6_div_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vc3 = _mm512_set1_ps(0x1.2444F2p-5f);
+  const __m512 vc1 = _mm512_set1_ps(0x1.988454p-1f);
+  const __m512 vhalf = _mm512_set1_ps(0.5f);
+  const __m512 vneg_sat_cutoff = _mm512_set1_ps(-0x1.F9F09Ep+2f);
+  const __m512 vsat_cutoff = _mm512_set1_ps(0x1.F9F09Ep+2f);
+  const __m512 valpha_13 = _mm512_set1_ps(-0x1.3E4B80p-52f);
+  const __m512 valpha_11 = _mm512_set1_ps(0x1.C266FCp-43f);
+  const __m512 valpha_9 = _mm512_set1_ps(-0x1.7A6FFEp-34f);
+  const __m512 valpha_7 = _mm512_set1_ps(0x1.B80082p-25f);
+  const __m512 valpha_5 = _mm512_set1_ps(0x1.F28694p-17f);
+  const __m512 valpha_3 = _mm512_set1_ps(0x1.4E1BDAp-11f);
+  const __m512 valpha_1 = _mm512_set1_ps(0x1.40B3B8p-8f);
+  const __m512 vbeta_6 = _mm512_set1_ps(0x1.41A7B0p-20f);
+  const __m512 vbeta_4 = _mm512_set1_ps(0x1.F12BACp-14f);
+  const __m512 vbeta_2 = _mm512_set1_ps(0x1.29540Ap-9f);
+  const __m512 vbeta_0 = _mm512_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    const __m512 vx20 = _mm512_mul_ps(vx0, vx0);
+    const __m512 vx21 = _mm512_mul_ps(vx1, vx1);
+
+    __m512 vu0 = _mm512_fmadd_ps(vx20, vc3, vc1);
+    __m512 vu1 = _mm512_fmadd_ps(vx21, vc3, vc1);
+
+    vu0 = _mm512_mul_ps(vx0, vu0);
+    vu1 = _mm512_mul_ps(vx1, vu1);
+
+    vu0 = _mm512_max_ps(vu0, vneg_sat_cutoff);
+    vu1 = _mm512_max_ps(vu1, vneg_sat_cutoff);
+
+    vu0 = _mm512_min_ps(vu0, vsat_cutoff);
+    vu1 = _mm512_min_ps(vu1, vsat_cutoff);
+
+    const __m512 vu20 = _mm512_mul_ps(vu0, vu0);
+    const __m512 vu21 = _mm512_mul_ps(vu1, vu1);
+
+    __m512 vp0 = _mm512_fmadd_ps(vu20, valpha_13, valpha_11);
+    __m512 vp1 = _mm512_fmadd_ps(vu21, valpha_13, valpha_11);
+
+    vp0 = _mm512_fmadd_ps(vu20, vp0, valpha_9);
+    vp1 = _mm512_fmadd_ps(vu21, vp1, valpha_9);
+
+    vp0 = _mm512_fmadd_ps(vu20, vp0, valpha_7);
+    vp1 = _mm512_fmadd_ps(vu21, vp1, valpha_7);
+
+    vp0 = _mm512_fmadd_ps(vu20, vp0, valpha_5);
+    vp1 = _mm512_fmadd_ps(vu21, vp1, valpha_5);
+
+    vp0 = _mm512_fmadd_ps(vu20, vp0, valpha_3);
+    vp1 = _mm512_fmadd_ps(vu21, vp1, valpha_3);
+
+    vp0 = _mm512_fmadd_ps(vu20, vp0, valpha_1);
+    vp1 = _mm512_fmadd_ps(vu21, vp1, valpha_1);
+
+    vp0 = _mm512_mul_ps(vu0, vp0);
+    vp1 = _mm512_mul_ps(vu1, vp1);
+
+    __m512 vq0 = _mm512_fmadd_ps(vu20, vbeta_6, vbeta_4);
+    __m512 vq1 = _mm512_fmadd_ps(vu21, vbeta_6, vbeta_4);
+
+    vq0 = _mm512_fmadd_ps(vu20, vq0, vbeta_2);
+    vq1 = _mm512_fmadd_ps(vu21, vq1, vbeta_2);
+
+    vq0 = _mm512_fmadd_ps(vu20, vq0, vbeta_0);
+    vq1 = _mm512_fmadd_ps(vu21, vq1, vbeta_0);
+
+    const __m512 vt0 = _mm512_div_ps(vp0, vq0);
+    const __m512 vt1 = _mm512_div_ps(vp1, vq1);
+
+    const __m512 vhalfx0 = _mm512_mul_ps(vx0, vhalf);
+    const __m512 vhalfx1 = _mm512_mul_ps(vx1, vhalf);
+
+    const __m512 vy0 = _mm512_fmadd_ps(vhalfx0, vt0, vhalfx0);
+    const __m512 vy1 = _mm512_fmadd_ps(vhalfx1, vt1, vhalfx1);
+
+    _mm512_storeu_ps(output, vy0);
+    _mm512_storeu_ps(output + 16, vy1);
+    output += 32;
+  }
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    const __m512 vx2 = _mm512_mul_ps(vx, vx);
+
+    __m512 vu = _mm512_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm512_mul_ps(vx, vu);
+
+    vu = _mm512_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm512_min_ps(vu, vsat_cutoff);
+
+    const __m512 vu2 = _mm512_mul_ps(vu, vu);
+
+    __m512 vp = _mm512_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm512_mul_ps(vu, vp);
+
+    __m512 vq = _mm512_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm512_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m512 vt = _mm512_div_ps(vp, vq);
+
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, vt, vhalfx);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on batch).
+    batch >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    const __m512 vx2 = _mm512_mul_ps(vx, vx);
+
+    __m512 vu = _mm512_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm512_mul_ps(vx, vu);
+
+    vu = _mm512_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm512_min_ps(vu, vsat_cutoff);
+
+    const __m512 vu2 = _mm512_mul_ps(vu, vu);
+
+    __m512 vp = _mm512_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm512_mul_ps(vu, vp);
+
+    __m512 vq = _mm512_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm512_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m512 vt = _mm512_div_ps(vp, vq);
+
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, vt, vhalfx);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
+
 void xnn_f32_vadd_minmax_ukernel__avx512f_x32(
     size_t batch,
     const float* input_a,
@@ -2828,115 +3664,390 @@ void xnn_f32_velu_ukernel__avx512f_rr1_lut16_p3_perm_x64(
   const __m512 vc2 = _mm512_set1_ps(params->avx512_rr1_lut16_p3.c2);
   const __m512i vtable = _mm512_load_si512(params->avx512_rr1_lut16_p3.table);
 
-  for (; batch >= 64 * sizeof(float); batch -= 64 * sizeof(float)) {
-    __m512 vx0 = _mm512_loadu_ps(input);
-    __m512 vx1 = _mm512_loadu_ps(input + 16);
-    __m512 vx2 = _mm512_loadu_ps(input + 32);
-    __m512 vx3 = _mm512_loadu_ps(input + 48);
-    input += 64;
+  for (; batch >= 64 * sizeof(float); batch -= 64 * sizeof(float)) {
+    __m512 vx0 = _mm512_loadu_ps(input);
+    __m512 vx1 = _mm512_loadu_ps(input + 16);
+    __m512 vx2 = _mm512_loadu_ps(input + 32);
+    __m512 vx3 = _mm512_loadu_ps(input + 48);
+    input += 64;
+
+    const __m512 vz0 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx0, vprescale));
+    const __m512 vz1 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx1, vprescale));
+    const __m512 vz2 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx2, vprescale));
+    const __m512 vz3 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx3, vprescale));
+
+    __m512 vn0 = _mm512_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m512 vn1 = _mm512_fmadd_ps(vz1, vlog2e, vmagic_bias);
+    __m512 vn2 = _mm512_fmadd_ps(vz2, vlog2e, vmagic_bias);
+    __m512 vn3 = _mm512_fmadd_ps(vz3, vlog2e, vmagic_bias);
+
+    const __m512i ven0 = _mm512_slli_epi32(_mm512_castps_si512(vn0), 19);
+    const __m512i vl0 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn0), vtable);
+    const __m512i ven1 = _mm512_slli_epi32(_mm512_castps_si512(vn1), 19);
+    const __m512i vl1 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn1), vtable);
+    const __m512i ven2 = _mm512_slli_epi32(_mm512_castps_si512(vn2), 19);
+    const __m512i vl2 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn2), vtable);
+    const __m512i ven3 = _mm512_slli_epi32(_mm512_castps_si512(vn3), 19);
+    const __m512i vl3 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn3), vtable);
+
+    __m512 vs0 = _mm512_castsi512_ps(_mm512_add_epi32(vl0, ven0));
+    vn0 = _mm512_sub_ps(vn0, vmagic_bias);
+    __m512 vs1 = _mm512_castsi512_ps(_mm512_add_epi32(vl1, ven1));
+    vn1 = _mm512_sub_ps(vn1, vmagic_bias);
+    __m512 vs2 = _mm512_castsi512_ps(_mm512_add_epi32(vl2, ven2));
+    vn2 = _mm512_sub_ps(vn2, vmagic_bias);
+    __m512 vs3 = _mm512_castsi512_ps(_mm512_add_epi32(vl3, ven3));
+    vn3 = _mm512_sub_ps(vn3, vmagic_bias);
+
+    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2, vz1);
+    __m512 vt2 = _mm512_fmadd_ps(vn2, vminus_ln2, vz2);
+    __m512 vt3 = _mm512_fmadd_ps(vn3, vminus_ln2, vz3);
+
+    __m512 vp0 = _mm512_fmadd_ps(vc3, vt0, vc2);
+    __m512 vp1 = _mm512_fmadd_ps(vc3, vt1, vc2);
+    __m512 vp2 = _mm512_fmadd_ps(vc3, vt2, vc2);
+    __m512 vp3 = _mm512_fmadd_ps(vc3, vt3, vc2);
+
+    vp0 = _mm512_mul_ps(vp0, vt0);
+    vt0 = _mm512_mul_ps(vt0, vs0);
+    vp1 = _mm512_mul_ps(vp1, vt1);
+    vt1 = _mm512_mul_ps(vt1, vs1);
+    vp2 = _mm512_mul_ps(vp2, vt2);
+    vt2 = _mm512_mul_ps(vt2, vs2);
+    vp3 = _mm512_mul_ps(vp3, vt3);
+    vt3 = _mm512_mul_ps(vt3, vs3);
+
+    vs0 = _mm512_fmsub_ps(vs0, valpha, valpha);
+    vs1 = _mm512_fmsub_ps(vs1, valpha, valpha);
+    vs2 = _mm512_fmsub_ps(vs2, valpha, valpha);
+    vs3 = _mm512_fmsub_ps(vs3, valpha, valpha);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vt0);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vt1);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vt2);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vt3);
+
+    const __m512 vzero = _mm512_setzero_ps();
+    __m512 vy0 = _mm512_fmadd_ps(vp0, valpha, vs0);
+    const __mmask16 vsign0 = _mm512_cmp_ps_mask(vx0, vzero, _CMP_NLT_US);
+    __m512 vy1 = _mm512_fmadd_ps(vp1, valpha, vs1);
+    const __mmask16 vsign1 = _mm512_cmp_ps_mask(vx1, vzero, _CMP_NLT_US);
+    __m512 vy2 = _mm512_fmadd_ps(vp2, valpha, vs2);
+    const __mmask16 vsign2 = _mm512_cmp_ps_mask(vx2, vzero, _CMP_NLT_US);
+    __m512 vy3 = _mm512_fmadd_ps(vp3, valpha, vs3);
+    const __mmask16 vsign3 = _mm512_cmp_ps_mask(vx3, vzero, _CMP_NLT_US);
+
+    vy0 = _mm512_mask_mul_ps(vy0, vsign0, vx0, vbeta);
+    vy1 = _mm512_mask_mul_ps(vy1, vsign1, vx1, vbeta);
+    vy2 = _mm512_mask_mul_ps(vy2, vsign2, vx2, vbeta);
+    vy3 = _mm512_mask_mul_ps(vy3, vsign3, vx3, vbeta);
+
+    _mm512_storeu_ps(output, vy0);
+    _mm512_storeu_ps(output + 16, vy1);
+    _mm512_storeu_ps(output + 32, vy2);
+    _mm512_storeu_ps(output + 48, vy3);
+    output += 64;
+  }
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    const __m512 vz = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx, vprescale));
+    const __mmask16 vsign = _mm512_cmp_ps_mask(vx, _mm512_setzero_ps(), _CMP_NLT_US);
+
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512i ven = _mm512_slli_epi32(_mm512_castps_si512(vn), 19);
+    const __m512i vl = _mm512_permutexvar_epi32(_mm512_castps_si512(vn), vtable);
+    __m512 vs = _mm512_castsi512_ps(_mm512_add_epi32(vl, ven));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc3, vt, vc2);
+    vp = _mm512_mul_ps(vp, vt);
+
+    vt = _mm512_mul_ps(vt, vs);
+    vs = _mm512_fmsub_ps(vs, valpha, valpha);
+    vp = _mm512_fmadd_ps(vp, vt, vt);
+    __m512 vy = _mm512_fmadd_ps(vp, valpha, vs);
+
+    vy = _mm512_mask_mul_ps(vy, vsign, vx, vbeta);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on batch).
+    batch >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    const __m512 vz = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx, vprescale));
+    const __mmask16 vsign = _mm512_cmp_ps_mask(vx, _mm512_setzero_ps(), _CMP_NLT_US);
+
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512i ven = _mm512_slli_epi32(_mm512_castps_si512(vn), 19);
+    const __m512i vl = _mm512_permutexvar_epi32(_mm512_castps_si512(vn), vtable);
+    __m512 vs = _mm512_castsi512_ps(_mm512_add_epi32(vl, ven));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc3, vt, vc2);
+    vp = _mm512_mul_ps(vp, vt);
+
+    vt = _mm512_mul_ps(vt, vs);
+    vs = _mm512_fmsub_ps(vs, valpha, valpha);
+    vp = _mm512_fmadd_ps(vp, vt, vt);
+    __m512 vy = _mm512_fmadd_ps(vp, valpha, vs);
+
+    vy = _mm512_mask_mul_ps(vy, vsign, vx, vbeta);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
+
+void xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vlog2e = _mm512_set1_ps(0x1.715476p+0f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m512 vzero_cutoff = _mm512_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m512 vinf_cutoff = _mm512_set1_ps(0x1.62E42Ep+6f);
+  const __m512 vminus_ln2_hi = _mm512_set1_ps(-0x1.62E43p-1f);
+  const __m512 vminus_ln2_lo = _mm512_set1_ps(0x1.05C61p-29f);
+  const __m512 vc5 = _mm512_set1_ps(0x1.0F9F9Cp-7f);
+  const __m512 vc4 = _mm512_set1_ps(0x1.573A1Ap-5f);
+  const __m512 vc3 = _mm512_set1_ps(0x1.555A80p-3f);
+  const __m512 vc2 = _mm512_set1_ps(0x1.FFFDC6p-2f);
+  const __m512 vc1 = _mm512_set1_ps(0x1.FFFFF6p-1f);
+  const __m512 vc0 = _mm512_set1_ps(1.0f);
+
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    const __m512 vn0 = _mm512_roundscale_ps(_mm512_mul_ps(vx0, vlog2e), 0);
+    const __m512 vn1 = _mm512_roundscale_ps(_mm512_mul_ps(vx1, vlog2e), 0);
+
+    const __mmask16 vinvof0 = _mm512_cmp_ps_mask(vx0, vinf_cutoff, _CMP_NGT_UQ);
+    const __mmask16 vinvof1 = _mm512_cmp_ps_mask(vx1, vinf_cutoff, _CMP_NGT_UQ);
+
+    const __mmask16 vinvuf0 = _mm512_cmp_ps_mask(vx0, vzero_cutoff, _CMP_NLT_UQ);
+    const __mmask16 vinvuf1 = _mm512_cmp_ps_mask(vx1, vzero_cutoff, _CMP_NLT_UQ);
+
+    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+
+    vt0 = _mm512_maskz_fmadd_ps(vinvof0, vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm512_maskz_fmadd_ps(vinvof1, vn1, vminus_ln2_lo, vt1);
+
+    __m512 vp0 = _mm512_fmadd_ps(vc5, vt0, vc4);
+    __m512 vp1 = _mm512_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc1);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc0);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc0);
+
+    const __m512 vy0 = _mm512_maskz_scalef_ps(vinvuf0, vp0, vn0);
+    const __m512 vy1 = _mm512_maskz_scalef_ps(vinvuf1, vp1, vn1);
+
+    _mm512_storeu_ps(output, vy0);
+    _mm512_storeu_ps(output + 16, vy1);
+    output += 32;
+  }
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    const __m512 vn = _mm512_roundscale_ps(_mm512_mul_ps(vx, vlog2e), 0);
+
+    const __mmask16 vinvof = _mm512_cmp_ps_mask(vx, vinf_cutoff, _CMP_NGT_UQ);
+    const __mmask16 vinvuf = _mm512_cmp_ps_mask(vx, vzero_cutoff, _CMP_NLT_UQ);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm512_maskz_fmadd_ps(vinvof, vn, vminus_ln2_lo, vt);
+
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+    vp = _mm512_fmadd_ps(vp, vt, vc0);
+
+    const __m512 vy = _mm512_maskz_scalef_ps(vinvuf, vp, vn);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on batch).
+    batch >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    const __m512 vn = _mm512_roundscale_ps(_mm512_mul_ps(vx, vlog2e), 0);
+
+    const __mmask16 vinvof = _mm512_cmp_ps_mask(vx, vinf_cutoff, _CMP_NGT_UQ);
+    const __mmask16 vinvuf = _mm512_cmp_ps_mask(vx, vzero_cutoff, _CMP_NLT_UQ);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm512_maskz_fmadd_ps(vinvof, vn, vminus_ln2_lo, vt);
+
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+    vp = _mm512_fmadd_ps(vp, vt, vc0);
+
+    const __m512 vy = _mm512_maskz_scalef_ps(vinvuf, vp, vn);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
+
+void xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vsqrt1_2 = _mm512_set1_ps(0x1.6A09E6p-1f);
+  const __m512 vneg_erf_cutoff = _mm512_set1_ps(-0x1.000000p+2f);
+  const __m512 verf_cutoff = _mm512_set1_ps(0x1.000000p+2f);
+  const __m512 valpha_13 = _mm512_set1_ps(-0x1.2BBE16p-32f);
+  const __m512 valpha_11 = _mm512_set1_ps(0x1.DBFFDCp-26f);
+  const __m512 valpha_9 = _mm512_set1_ps(-0x1.19FEA2p-19f);
+  const __m512 valpha_7 = _mm512_set1_ps(-0x1.DD85A4p-15f);
+  const __m512 valpha_5 = _mm512_set1_ps(-0x1.8158C6p-11f);
+  const __m512 valpha_3 = _mm512_set1_ps(-0x1.8343ECp-9f);
+  const __m512 valpha_1 = _mm512_set1_ps(-0x1.07B7A8p-6f);
+  const __m512 vbeta_8 = _mm512_set1_ps(-0x1.E8C19Ap-17f);
+  const __m512 vbeta_6 = _mm512_set1_ps(-0x1.BF7A52p-13f);
+  const __m512 vbeta_4 = _mm512_set1_ps(-0x1.B9249Cp-10f);
+  const __m512 vbeta_2 = _mm512_set1_ps(-0x1.E337F0p-8f);
+  const __m512 vbeta_0 = _mm512_set1_ps(-0x1.D36D4Ep-7f);
+  const __m512 vhalf = _mm512_set1_ps(0.5f);
+
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    __m512 vz0 = _mm512_mul_ps(vx0, vsqrt1_2);
+    __m512 vz1 = _mm512_mul_ps(vx1, vsqrt1_2);
+
+    vz0 = _mm512_max_ps(vz0, vneg_erf_cutoff);
+    vz1 = _mm512_max_ps(vz1, vneg_erf_cutoff);
+
+    vz0 = _mm512_min_ps(vz0, verf_cutoff);
+    vz1 = _mm512_min_ps(vz1, verf_cutoff);
 
-    const __m512 vz0 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx0, vprescale));
-    const __m512 vz1 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx1, vprescale));
-    const __m512 vz2 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx2, vprescale));
-    const __m512 vz3 = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx3, vprescale));
+    const __m512 vz20 = _mm512_mul_ps(vz0, vz0);
+    const __m512 vz21 = _mm512_mul_ps(vz1, vz1);
 
-    __m512 vn0 = _mm512_fmadd_ps(vz0, vlog2e, vmagic_bias);
-    __m512 vn1 = _mm512_fmadd_ps(vz1, vlog2e, vmagic_bias);
-    __m512 vn2 = _mm512_fmadd_ps(vz2, vlog2e, vmagic_bias);
-    __m512 vn3 = _mm512_fmadd_ps(vz3, vlog2e, vmagic_bias);
+    __m512 vp0 = _mm512_fmadd_ps(vz20, valpha_13, valpha_11);
+    __m512 vp1 = _mm512_fmadd_ps(vz21, valpha_13, valpha_11);
 
-    const __m512i ven0 = _mm512_slli_epi32(_mm512_castps_si512(vn0), 19);
-    const __m512i vl0 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn0), vtable);
-    const __m512i ven1 = _mm512_slli_epi32(_mm512_castps_si512(vn1), 19);
-    const __m512i vl1 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn1), vtable);
-    const __m512i ven2 = _mm512_slli_epi32(_mm512_castps_si512(vn2), 19);
-    const __m512i vl2 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn2), vtable);
-    const __m512i ven3 = _mm512_slli_epi32(_mm512_castps_si512(vn3), 19);
-    const __m512i vl3 = _mm512_permutexvar_epi32(_mm512_castps_si512(vn3), vtable);
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha_9);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha_9);
 
-    __m512 vs0 = _mm512_castsi512_ps(_mm512_add_epi32(vl0, ven0));
-    vn0 = _mm512_sub_ps(vn0, vmagic_bias);
-    __m512 vs1 = _mm512_castsi512_ps(_mm512_add_epi32(vl1, ven1));
-    vn1 = _mm512_sub_ps(vn1, vmagic_bias);
-    __m512 vs2 = _mm512_castsi512_ps(_mm512_add_epi32(vl2, ven2));
-    vn2 = _mm512_sub_ps(vn2, vmagic_bias);
-    __m512 vs3 = _mm512_castsi512_ps(_mm512_add_epi32(vl3, ven3));
-    vn3 = _mm512_sub_ps(vn3, vmagic_bias);
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha_7);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha_7);
 
-    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2, vz0);
-    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2, vz1);
-    __m512 vt2 = _mm512_fmadd_ps(vn2, vminus_ln2, vz2);
-    __m512 vt3 = _mm512_fmadd_ps(vn3, vminus_ln2, vz3);
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha_5);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha_5);
 
-    __m512 vp0 = _mm512_fmadd_ps(vc3, vt0, vc2);
-    __m512 vp1 = _mm512_fmadd_ps(vc3, vt1, vc2);
-    __m512 vp2 = _mm512_fmadd_ps(vc3, vt2, vc2);
-    __m512 vp3 = _mm512_fmadd_ps(vc3, vt3, vc2);
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha_3);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha_3);
 
-    vp0 = _mm512_mul_ps(vp0, vt0);
-    vt0 = _mm512_mul_ps(vt0, vs0);
-    vp1 = _mm512_mul_ps(vp1, vt1);
-    vt1 = _mm512_mul_ps(vt1, vs1);
-    vp2 = _mm512_mul_ps(vp2, vt2);
-    vt2 = _mm512_mul_ps(vt2, vs2);
-    vp3 = _mm512_mul_ps(vp3, vt3);
-    vt3 = _mm512_mul_ps(vt3, vs3);
+    vp0 = _mm512_fmadd_ps(vz20, vp0, valpha_1);
+    vp1 = _mm512_fmadd_ps(vz21, vp1, valpha_1);
 
-    vs0 = _mm512_fmsub_ps(vs0, valpha, valpha);
-    vs1 = _mm512_fmsub_ps(vs1, valpha, valpha);
-    vs2 = _mm512_fmsub_ps(vs2, valpha, valpha);
-    vs3 = _mm512_fmsub_ps(vs3, valpha, valpha);
+    vp0 = _mm512_mul_ps(vz0, vp0);
+    vp1 = _mm512_mul_ps(vz1, vp1);
 
-    vp0 = _mm512_fmadd_ps(vp0, vt0, vt0);
-    vp1 = _mm512_fmadd_ps(vp1, vt1, vt1);
-    vp2 = _mm512_fmadd_ps(vp2, vt2, vt2);
-    vp3 = _mm512_fmadd_ps(vp3, vt3, vt3);
+    __m512 vq0 = _mm512_fmadd_ps(vz20, vbeta_8, vbeta_6);
+    __m512 vq1 = _mm512_fmadd_ps(vz21, vbeta_8, vbeta_6);
 
-    const __m512 vzero = _mm512_setzero_ps();
-    __m512 vy0 = _mm512_fmadd_ps(vp0, valpha, vs0);
-    const __mmask16 vsign0 = _mm512_cmp_ps_mask(vx0, vzero, _CMP_NLT_US);
-    __m512 vy1 = _mm512_fmadd_ps(vp1, valpha, vs1);
-    const __mmask16 vsign1 = _mm512_cmp_ps_mask(vx1, vzero, _CMP_NLT_US);
-    __m512 vy2 = _mm512_fmadd_ps(vp2, valpha, vs2);
-    const __mmask16 vsign2 = _mm512_cmp_ps_mask(vx2, vzero, _CMP_NLT_US);
-    __m512 vy3 = _mm512_fmadd_ps(vp3, valpha, vs3);
-    const __mmask16 vsign3 = _mm512_cmp_ps_mask(vx3, vzero, _CMP_NLT_US);
+    vq0 = _mm512_fmadd_ps(vz20, vq0, vbeta_4);
+    vq1 = _mm512_fmadd_ps(vz21, vq1, vbeta_4);
 
-    vy0 = _mm512_mask_mul_ps(vy0, vsign0, vx0, vbeta);
-    vy1 = _mm512_mask_mul_ps(vy1, vsign1, vx1, vbeta);
-    vy2 = _mm512_mask_mul_ps(vy2, vsign2, vx2, vbeta);
-    vy3 = _mm512_mask_mul_ps(vy3, vsign3, vx3, vbeta);
+    vq0 = _mm512_fmadd_ps(vz20, vq0, vbeta_2);
+    vq1 = _mm512_fmadd_ps(vz21, vq1, vbeta_2);
+
+    vq0 = _mm512_fmadd_ps(vz20, vq0, vbeta_0);
+    vq1 = _mm512_fmadd_ps(vz21, vq1, vbeta_0);
+
+    const __m512 verf0 = _mm512_div_ps(vp0, vq0);
+    const __m512 verf1 = _mm512_div_ps(vp1, vq1);
+
+    const __m512 vhalfx0 = _mm512_mul_ps(vx0, vhalf);
+    const __m512 vhalfx1 = _mm512_mul_ps(vx1, vhalf);
+
+    const __m512 vy0 = _mm512_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m512 vy1 = _mm512_fmadd_ps(vhalfx1, verf1, vhalfx1);
 
     _mm512_storeu_ps(output, vy0);
     _mm512_storeu_ps(output + 16, vy1);
-    _mm512_storeu_ps(output + 32, vy2);
-    _mm512_storeu_ps(output + 48, vy3);
-    output += 64;
+    output += 32;
   }
   for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
-    __m512 vx = _mm512_loadu_ps(input);
+    const __m512 vx = _mm512_loadu_ps(input);
     input += 16;
 
-    const __m512 vz = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx, vprescale));
-    const __mmask16 vsign = _mm512_cmp_ps_mask(vx, _mm512_setzero_ps(), _CMP_NLT_US);
+    __m512 vz = _mm512_mul_ps(vx, vsqrt1_2);
+    vz = _mm512_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm512_min_ps(vz, verf_cutoff);
 
-    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
-    const __m512i ven = _mm512_slli_epi32(_mm512_castps_si512(vn), 19);
-    const __m512i vl = _mm512_permutexvar_epi32(_mm512_castps_si512(vn), vtable);
-    __m512 vs = _mm512_castsi512_ps(_mm512_add_epi32(vl, ven));
-    vn = _mm512_sub_ps(vn, vmagic_bias);
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
 
-    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+    __m512 vp = _mm512_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm512_mul_ps(vz, vp);
 
-    __m512 vp = _mm512_fmadd_ps(vc3, vt, vc2);
-    vp = _mm512_mul_ps(vp, vt);
+    __m512 vq = _mm512_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta_0);
 
-    vt = _mm512_mul_ps(vt, vs);
-    vs = _mm512_fmsub_ps(vs, valpha, valpha);
-    vp = _mm512_fmadd_ps(vp, vt, vt);
-    __m512 vy = _mm512_fmadd_ps(vp, valpha, vs);
+    const __m512 verf = _mm512_div_ps(vp, vq);
 
-    vy = _mm512_mask_mul_ps(vy, vsign, vx, vbeta);
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, verf, vhalfx);
 
     _mm512_storeu_ps(output, vy);
     output += 16;
@@ -2948,28 +4059,31 @@ void xnn_f32_velu_ukernel__avx512f_rr1_lut16_p3_perm_x64(
     batch >>= 2 /* log2(sizeof(float)) */;
     const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
 
-    __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
 
-    const __m512 vz = _mm512_max_ps(vsat_cutoff, _mm512_mul_ps(vx, vprescale));
-    const __mmask16 vsign = _mm512_cmp_ps_mask(vx, _mm512_setzero_ps(), _CMP_NLT_US);
+    __m512 vz = _mm512_mul_ps(vx, vsqrt1_2);
+    vz = _mm512_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm512_min_ps(vz, verf_cutoff);
 
-    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
-    const __m512i ven = _mm512_slli_epi32(_mm512_castps_si512(vn), 19);
-    const __m512i vl = _mm512_permutexvar_epi32(_mm512_castps_si512(vn), vtable);
-    __m512 vs = _mm512_castsi512_ps(_mm512_add_epi32(vl, ven));
-    vn = _mm512_sub_ps(vn, vmagic_bias);
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
 
-    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+    __m512 vp = _mm512_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm512_mul_ps(vz, vp);
 
-    __m512 vp = _mm512_fmadd_ps(vc3, vt, vc2);
-    vp = _mm512_mul_ps(vp, vt);
+    __m512 vq = _mm512_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vz2, vq, vbeta_0);
 
-    vt = _mm512_mul_ps(vt, vs);
-    vs = _mm512_fmsub_ps(vs, valpha, valpha);
-    vp = _mm512_fmadd_ps(vp, vt, vt);
-    __m512 vy = _mm512_fmadd_ps(vp, valpha, vs);
+    const __m512 verf = _mm512_div_ps(vp, vq);
 
-    vy = _mm512_mask_mul_ps(vy, vsign, vx, vbeta);
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, verf, vhalfx);
 
     _mm512_mask_storeu_ps(output, vmask, vy);
   }
@@ -3348,6 +4462,269 @@ void xnn_f32_vsigmoid_ukernel__avx512f_rr2_lut32_p2_perm2_scalef_div_x64(
   }
 }
 
+void xnn_f32_vsilu_ukernel__avx512f_rr1_p5_scalef_div_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512i vsign_mask = _mm512_set1_epi32((int) 0x80000000);
+  const __m512 vlog2e = _mm512_set1_ps(0x1.715476p0f);
+  const __m512 vminus_ln2 = _mm512_set1_ps(-0x1.62E430p-1f);
+  const __m512 vc5 = _mm512_set1_ps(0x1.0F9F9Cp-7f);
+  const __m512 vc4 = _mm512_set1_ps(0x1.573A1Ap-5f);
+  const __m512 vc3 = _mm512_set1_ps(0x1.555A80p-3f);
+  const __m512 vc2 = _mm512_set1_ps(0x1.FFFDC6p-2f);
+  const __m512 vc1 = _mm512_set1_ps(0x1.FFFFF6p-1f);
+  const __m512 vone = _mm512_set1_ps(1.0f);
+
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(input);
+    const __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    const __m512 vz0 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx0), vsign_mask));
+    const __m512 vz1 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx1), vsign_mask));
+
+    const __m512 vn0 = _mm512_roundscale_ps(_mm512_mul_ps(vz0, vlog2e), 0);
+    const __m512 vn1 = _mm512_roundscale_ps(_mm512_mul_ps(vz1, vlog2e), 0);
+
+    const __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2, vz0);
+    const __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2, vz1);
+
+    __m512 vp0 = _mm512_fmadd_ps(vc5, vt0, vc4);
+    __m512 vp1 = _mm512_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc1);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vone);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vone);
+
+    const __m512 ve0 = _mm512_scalef_ps(vp0, vn0);
+    const __m512 ve1 = _mm512_scalef_ps(vp1, vn1);
+
+    const __m512 vd0 = _mm512_add_ps(ve0, vone);
+    const __m512 vd1 = _mm512_add_ps(ve1, vone);
+
+    __m512 vf0 = _mm512_div_ps(ve0, vd0);
+    __m512 vf1 = _mm512_div_ps(ve1, vd1);
+
+    vf0 = _mm512_mask_sub_ps(vf0, _mm512_testn_epi32_mask(_mm512_castps_si512(vx0), vsign_mask), vone, vf0);
+    vf1 = _mm512_mask_sub_ps(vf1, _mm512_testn_epi32_mask(_mm512_castps_si512(vx1), vsign_mask), vone, vf1);
+
+    const __m512 vy0 = _mm512_mul_ps(vx0, vf0);
+    const __m512 vy1 = _mm512_mul_ps(vx1, vf1);
+
+    _mm512_storeu_ps(output, vy0);
+    _mm512_storeu_ps(output + 16, vy1);
+    output += 32;
+  }
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    const __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), vsign_mask));
+
+    const __m512 vn = _mm512_roundscale_ps(_mm512_mul_ps(vz, vlog2e), 0);
+
+    const __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+    vp = _mm512_fmadd_ps(vp, vt, vone);
+
+    const __m512 ve = _mm512_scalef_ps(vp, vn);
+    const __m512 vd = _mm512_add_ps(ve, vone);
+
+    __m512 vf = _mm512_div_ps(ve, vd);
+    vf = _mm512_mask_sub_ps(vf, _mm512_testn_epi32_mask(_mm512_castps_si512(vx), vsign_mask), vone, vf);
+
+    const __m512 vy = _mm512_mul_ps(vx, vf);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on batch).
+    batch >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    const __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), vsign_mask));
+
+    const __m512 vn = _mm512_roundscale_ps(_mm512_mul_ps(vz, vlog2e), 0);
+
+    const __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc5, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_fmadd_ps(vp, vt, vc1);
+    vp = _mm512_fmadd_ps(vp, vt, vone);
+
+    const __m512 ve = _mm512_scalef_ps(vp, vn);
+    const __m512 vd = _mm512_add_ps(ve, vone);
+
+    __m512 vf = _mm512_div_ps(ve, vd);
+    vf = _mm512_mask_sub_ps(vf, _mm512_testn_epi32_mask(_mm512_castps_si512(vx), vsign_mask), vone, vf);
+
+    const __m512 vy = _mm512_mul_ps(vx, vf);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
+
+void xnn_f32_vtanh_ukernel__avx512f_rational_13_6_div_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vneg_sat_cutoff = _mm512_set1_ps(-0x1.F9F09Ep+2f);
+  const __m512 vsat_cutoff = _mm512_set1_ps(0x1.F9F09Ep+2f);
+  const __m512 valpha_13 = _mm512_set1_ps(-0x1.3E4B80p-52f);
+  const __m512 valpha_11 = _mm512_set1_ps(0x1.C266FCp-43f);
+  const __m512 valpha_9 = _mm512_set1_ps(-0x1.7A6FFEp-34f);
+  const __m512 valpha_7 = _mm512_set1_ps(0x1.B80082p-25f);
+  const __m512 valpha_5 = _mm512_set1_ps(0x1.F28694p-17f);
+  const __m512 valpha_3 = _mm512_set1_ps(0x1.4E1BDAp-11f);
+  const __m512 valpha_1 = _mm512_set1_ps(0x1.40B3B8p-8f);
+  const __m512 vbeta_6 = _mm512_set1_ps(0x1.41A7B0p-20f);
+  const __m512 vbeta_4 = _mm512_set1_ps(0x1.F12BACp-14f);
+  const __m512 vbeta_2 = _mm512_set1_ps(0x1.29540Ap-9f);
+  const __m512 vbeta_0 = _mm512_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    __m512 vx0 = _mm512_loadu_ps(input);
+    __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    vx0 = _mm512_max_ps(vx0, vneg_sat_cutoff);
+    vx1 = _mm512_max_ps(vx1, vneg_sat_cutoff);
+
+    vx0 = _mm512_min_ps(vx0, vsat_cutoff);
+    vx1 = _mm512_min_ps(vx1, vsat_cutoff);
+
+    const __m512 vx20 = _mm512_mul_ps(vx0, vx0);
+    const __m512 vx21 = _mm512_mul_ps(vx1, vx1);
+
+    __m512 vp0 = _mm512_fmadd_ps(vx20, valpha_13, valpha_11);
+    __m512 vp1 = _mm512_fmadd_ps(vx21, valpha_13, valpha_11);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_9);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_9);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_7);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_7);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_5);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_5);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_3);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_3);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_1);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_1);
+
+    vp0 = _mm512_mul_ps(vx0, vp0);
+    vp1 = _mm512_mul_ps(vx1, vp1);
+
+    __m512 vq0 = _mm512_fmadd_ps(vx20, vbeta_6, vbeta_4);
+    __m512 vq1 = _mm512_fmadd_ps(vx21, vbeta_6, vbeta_4);
+
+    vq0 = _mm512_fmadd_ps(vx20, vq0, vbeta_2);
+    vq1 = _mm512_fmadd_ps(vx21, vq1, vbeta_2);
+
+    vq0 = _mm512_fmadd_ps(vx20, vq0, vbeta_0);
+    vq1 = _mm512_fmadd_ps(vx21, vq1, vbeta_0);
+
+    const __m512 vy0 = _mm512_div_ps(vp0, vq0);
+    const __m512 vy1 = _mm512_div_ps(vp1, vq1);
+
+    _mm512_storeu_ps(output, vy0);
+    _mm512_storeu_ps(output + 16, vy1);
+    output += 32;
+  }
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    vx = _mm512_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm512_min_ps(vx, vsat_cutoff);
+
+    const __m512 vx2 = _mm512_mul_ps(vx, vx);
+
+    __m512 vp = _mm512_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm512_mul_ps(vx, vp);
+
+    __m512 vq = _mm512_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m512 vy = _mm512_div_ps(vp, vq);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on batch).
+    batch >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    vx = _mm512_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm512_min_ps(vx, vsat_cutoff);
+
+    const __m512 vx2 = _mm512_mul_ps(vx, vx);
+
+    __m512 vp = _mm512_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm512_mul_ps(vx, vp);
+
+    __m512 vq = _mm512_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m512 vy = _mm512_div_ps(vp, vq);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
+
 void xnn_f32_vabs_ukernel__avx512f_x16(
     size_t batch,
     const float* input,
@@ -4,17 +4,21 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <immintrin.h>
 
 #include <xnnpack/avgpool.h>
 #include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
 #include <xnnpack/gavgpool.h>
 #include <xnnpack/intrinsics-polyfill.h>
 #include <xnnpack/math.h>
 #include <xnnpack/maxpool.h>
+#include <xnnpack/prefetch.h>
 #include <xnnpack/prelu.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vcvt.h>
 #include <xnnpack/vunary.h>
@@ -529,6 +533,67 @@ void xnn_f16_avgpool_minmax_ukernel_9x__f16c_c8(
   } while (--output_pixels != 0);
 }
 
+void xnn_f16_f32_embedding_ukernel__f16c_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m256 vscale = _mm256_broadcast_ss(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m256 vacc0 = _mm256_setzero_ps();
+    __m256 vacc1 = _mm256_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 = _mm256_add_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8))));
+    }
+    _mm256_storeu_ps(output, _mm256_mul_ps(vacc0, vscale));
+    _mm256_storeu_ps(output + 8, _mm256_mul_ps(vacc1, vscale));
+    output += 16;
+    offset += 16 * sizeof(uint16_t);
+  }
+  if (channels >= 8) {
+    __m256 vacc = _mm256_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = _mm256_add_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)));
+    }
+    _mm256_storeu_ps(output, _mm256_mul_ps(vacc, vscale));
+    output += 8;
+    offset += 8 * sizeof(uint16_t);
+    channels -= 8;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += _cvtsh_ss(*((const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset)));
+    }
+    *output++ = vacc * vscale_tail;
+    offset += sizeof(uint16_t);
+  }
+}
+
 void xnn_f16_f32_vcvt_ukernel__f16c_x16(
     size_t batch,
     const void* input,
@@ -1321,6 +1386,101 @@ void xnn_f16_rmax_ukernel__f16c(
   *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(_mm_cvtps_ph(vmax_lo, _MM_FROUND_TO_NEAREST_INT), 0);
 }
 
+void xnn_f16_rnorm_ukernel__f16c_x16(
+    size_t channels,
+    const void* input,
+    const void* weights,
+    void* output,
+    const union xnn_f16_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(uint16_t);
+  const uint16_t* i = (const uint16_t*) input;
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated in FP32, relative to the first element to avoid catastrophic cancellation.
+  const float vshift = vsubtract_mean ? _cvtsh_ss(*i) : 0.0f;
+
+  const __m256 vshift8 = _mm256_set1_ps(vshift);
+  __m256 vsum0 = _mm256_setzero_ps();
+  __m256 vsum1 = _mm256_setzero_ps();
+  __m256 vsumsq0 = _mm256_setzero_ps();
+  __m256 vsumsq1 = _mm256_setzero_ps();
+  size_t c = channels;
+  for (; c >= 16 * sizeof(uint16_t); c -= 16 * sizeof(uint16_t)) {
+    const __m256 vd0 = _mm256_sub_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)), vshift8);
+    const __m256 vd1 = _mm256_sub_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8))), vshift8);
+    i += 16;
+
+    vsum0 = _mm256_add_ps(vsum0, vd0);
+    vsum1 = _mm256_add_ps(vsum1, vd1);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd0, vd0));
+    vsumsq1 = _mm256_add_ps(vsumsq1, _mm256_mul_ps(vd1, vd1));
+  }
+  if (c >= 8 * sizeof(uint16_t)) {
+    const __m256 vd = _mm256_sub_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)), vshift8);
+    i += 8;
+
+    vsum0 = _mm256_add_ps(vsum0, vd);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd, vd));
+    c -= 8 * sizeof(uint16_t);
+  }
+  const __m256 vsum8 = _mm256_add_ps(vsum0, vsum1);
+  const __m256 vsumsq8 = _mm256_add_ps(vsumsq0, vsumsq1);
+  __m128 vsum = _mm_add_ps(_mm256_castps256_ps128(vsum8), _mm256_extractf128_ps(vsum8, 1));
+  __m128 vsumsq = _mm_add_ps(_mm256_castps256_ps128(vsumsq8), _mm256_extractf128_ps(vsumsq8, 1));
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_movehdup_ps(vsum));
+  vsumsq = _mm_add_ss(vsumsq, _mm_movehdup_ps(vsumsq));
+  float vsum_tail = _mm_cvtss_f32(vsum);
+  float vsumsq_tail = _mm_cvtss_f32(vsumsq);
+  for (; c != 0; c -= sizeof(uint16_t)) {
+    const float vd = _cvtsh_ss(*i++) - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m256 vmean8 = _mm256_set1_ps(vmean);
+  const __m256 vrstd8 = _mm256_set1_ps(vrstd);
+  const uint16_t* gamma = (const uint16_t*) weights;
+  const uint16_t* beta = gamma + n;
+  i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (c = channels; c >= 8 * sizeof(uint16_t); c -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+    const __m256 vscale = _mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) gamma)), vrstd8);
+    gamma += 8;
+    const __m256 vbeta = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) beta));
+    beta += 8;
+
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx, vmean8), vscale), vbeta);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  for (; c != 0; c -= sizeof(uint16_t)) {
+    const float vy = (_cvtsh_ss(*i++) - vmean) * (_cvtsh_ss(*gamma++) * vrstd) + _cvtsh_ss(*beta++);
+    *o++ = _cvtss_sh(vy, _MM_FROUND_TO_NEAREST_INT);
+  }
+}
+
 void xnn_f16_vadd_minmax_ukernel__f16c_x16(
     size_t batch,
     const void* restrict input_a,
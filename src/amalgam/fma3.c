@@ -4438,6 +4438,355 @@ void xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast(
   } while (nc != 0);
 }
 
+void xnn_f32_vapproxgelu_ukernel__fma3_rational_13_6_div_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vc3 = _mm256_set1_ps(0x1.2444F2p-5f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.988454p-1f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+  const __m256 vneg_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.3E4B80p-52f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.C266FCp-43f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.7A6FFEp-34f);
+  const __m256 valpha_7 = _mm256_set1_ps(0x1.B80082p-25f);
+  const __m256 valpha_5 = _mm256_set1_ps(0x1.F28694p-17f);
+  const __m256 valpha_3 = _mm256_set1_ps(0x1.4E1BDAp-11f);
+  const __m256 valpha_1 = _mm256_set1_ps(0x1.40B3B8p-8f);
+  const __m256 vbeta_6 = _mm256_set1_ps(0x1.41A7B0p-20f);
+  const __m256 vbeta_4 = _mm256_set1_ps(0x1.F12BACp-14f);
+  const __m256 vbeta_2 = _mm256_set1_ps(0x1.29540Ap-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    const __m256 vx20 = _mm256_mul_ps(vx0, vx0);
+    const __m256 vx21 = _mm256_mul_ps(vx1, vx1);
+
+    __m256 vu0 = _mm256_fmadd_ps(vx20, vc3, vc1);
+    __m256 vu1 = _mm256_fmadd_ps(vx21, vc3, vc1);
+
+    vu0 = _mm256_mul_ps(vx0, vu0);
+    vu1 = _mm256_mul_ps(vx1, vu1);
+
+    vu0 = _mm256_max_ps(vu0, vneg_sat_cutoff);
+    vu1 = _mm256_max_ps(vu1, vneg_sat_cutoff);
+
+    vu0 = _mm256_min_ps(vu0, vsat_cutoff);
+    vu1 = _mm256_min_ps(vu1, vsat_cutoff);
+
+    const __m256 vu20 = _mm256_mul_ps(vu0, vu0);
+    const __m256 vu21 = _mm256_mul_ps(vu1, vu1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vu20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vu21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vu20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vu21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vu0, vp0);
+    vp1 = _mm256_mul_ps(vu1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vu20, vbeta_6, vbeta_4);
+    __m256 vq1 = _mm256_fmadd_ps(vu21, vbeta_6, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vu20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vu21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vu20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vu21, vq1, vbeta_0);
+
+    const __m256 vt0 = _mm256_div_ps(vp0, vq0);
+    const __m256 vt1 = _mm256_div_ps(vp1, vq1);
+
+    const __m256 vhalfx0 = _mm256_mul_ps(vx0, vhalf);
+    const __m256 vhalfx1 = _mm256_mul_ps(vx1, vhalf);
+
+    const __m256 vy0 = _mm256_fmadd_ps(vhalfx0, vt0, vhalfx0);
+    const __m256 vy1 = _mm256_fmadd_ps(vhalfx1, vt1, vhalfx1);
+
+    _mm256_storeu_ps(output, vy0);
+    _mm256_storeu_ps(output + 8, vy1);
+    output += 16;
+  }
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vu = _mm256_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm256_mul_ps(vx, vu);
+
+    vu = _mm256_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm256_min_ps(vu, vsat_cutoff);
+
+    const __m256 vu2 = _mm256_mul_ps(vu, vu);
+
+    __m256 vp = _mm256_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm256_mul_ps(vu, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m256 vt = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, vt, vhalfx);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - batch));
+
+    const __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vu = _mm256_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm256_mul_ps(vx, vu);
+
+    vu = _mm256_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm256_min_ps(vu, vsat_cutoff);
+
+    const __m256 vu2 = _mm256_mul_ps(vu, vu);
+
+    __m256 vp = _mm256_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm256_mul_ps(vu, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m256 vt = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, vt, vhalfx);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (batch & (4 * sizeof(float))) {
+      _mm_storeu_ps(output, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      output += 4;
+    }
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy_lo);
+    }
+  }
+}
+
+void xnn_f32_vgelu_ukernel__fma3_rational_13_8_div_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vsqrt1_2 = _mm256_set1_ps(0x1.6A09E6p-1f);
+  const __m256 vneg_erf_cutoff = _mm256_set1_ps(-0x1.000000p+2f);
+  const __m256 verf_cutoff = _mm256_set1_ps(0x1.000000p+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.2BBE16p-32f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.DBFFDCp-26f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.19FEA2p-19f);
+  const __m256 valpha_7 = _mm256_set1_ps(-0x1.DD85A4p-15f);
+  const __m256 valpha_5 = _mm256_set1_ps(-0x1.8158C6p-11f);
+  const __m256 valpha_3 = _mm256_set1_ps(-0x1.8343ECp-9f);
+  const __m256 valpha_1 = _mm256_set1_ps(-0x1.07B7A8p-6f);
+  const __m256 vbeta_8 = _mm256_set1_ps(-0x1.E8C19Ap-17f);
+  const __m256 vbeta_6 = _mm256_set1_ps(-0x1.BF7A52p-13f);
+  const __m256 vbeta_4 = _mm256_set1_ps(-0x1.B9249Cp-10f);
+  const __m256 vbeta_2 = _mm256_set1_ps(-0x1.E337F0p-8f);
+  const __m256 vbeta_0 = _mm256_set1_ps(-0x1.D36D4Ep-7f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    __m256 vz0 = _mm256_mul_ps(vx0, vsqrt1_2);
+    __m256 vz1 = _mm256_mul_ps(vx1, vsqrt1_2);
+
+    vz0 = _mm256_max_ps(vz0, vneg_erf_cutoff);
+    vz1 = _mm256_max_ps(vz1, vneg_erf_cutoff);
+
+    vz0 = _mm256_min_ps(vz0, verf_cutoff);
+    vz1 = _mm256_min_ps(vz1, verf_cutoff);
+
+    const __m256 vz20 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vz21 = _mm256_mul_ps(vz1, vz1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vz20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vz21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vz0, vp0);
+    vp1 = _mm256_mul_ps(vz1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vz20, vbeta_8, vbeta_6);
+    __m256 vq1 = _mm256_fmadd_ps(vz21, vbeta_8, vbeta_6);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_4);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_0);
+
+    const __m256 verf0 = _mm256_div_ps(vp0, vq0);
+    const __m256 verf1 = _mm256_div_ps(vp1, vq1);
+
+    const __m256 vhalfx0 = _mm256_mul_ps(vx0, vhalf);
+    const __m256 vhalfx1 = _mm256_mul_ps(vx1, vhalf);
+
+    const __m256 vy0 = _mm256_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m256 vy1 = _mm256_fmadd_ps(vhalfx1, verf1, vhalfx1);
+
+    _mm256_storeu_ps(output, vy0);
+    _mm256_storeu_ps(output + 8, vy1);
+    output += 16;
+  }
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    __m256 vz = _mm256_mul_ps(vx, vsqrt1_2);
+    vz = _mm256_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm256_min_ps(vz, verf_cutoff);
+
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm256_mul_ps(vz, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_0);
+
+    const __m256 verf = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - batch));
+
+    const __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    __m256 vz = _mm256_mul_ps(vx, vsqrt1_2);
+    vz = _mm256_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm256_min_ps(vz, verf_cutoff);
+
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm256_mul_ps(vz, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_0);
+
+    const __m256 verf = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (batch & (4 * sizeof(float))) {
+      _mm_storeu_ps(output, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      output += 4;
+    }
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy_lo);
+    }
+  }
+}
+
 void xnn_f32_vhswish_ukernel__fma3_x16(
     size_t batch,
     const float* input,
@@ -4512,3 +4861,148 @@ void xnn_f32_vhswish_ukernel__fma3_x16(
     }
   }
 }
+
+void xnn_f32_vtanh_ukernel__fma3_rational_13_6_div_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vneg_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.3E4B80p-52f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.C266FCp-43f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.7A6FFEp-34f);
+  const __m256 valpha_7 = _mm256_set1_ps(0x1.B80082p-25f);
+  const __m256 valpha_5 = _mm256_set1_ps(0x1.F28694p-17f);
+  const __m256 valpha_3 = _mm256_set1_ps(0x1.4E1BDAp-11f);
+  const __m256 valpha_1 = _mm256_set1_ps(0x1.40B3B8p-8f);
+  const __m256 vbeta_6 = _mm256_set1_ps(0x1.41A7B0p-20f);
+  const __m256 vbeta_4 = _mm256_set1_ps(0x1.F12BACp-14f);
+  const __m256 vbeta_2 = _mm256_set1_ps(0x1.29540Ap-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    __m256 vx0 = _mm256_loadu_ps(input);
+    __m256 vx1 = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    vx0 = _mm256_max_ps(vx0, vneg_sat_cutoff);
+    vx1 = _mm256_max_ps(vx1, vneg_sat_cutoff);
+
+    vx0 = _mm256_min_ps(vx0, vsat_cutoff);
+    vx1 = _mm256_min_ps(vx1, vsat_cutoff);
+
+    const __m256 vx20 = _mm256_mul_ps(vx0, vx0);
+    const __m256 vx21 = _mm256_mul_ps(vx1, vx1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vx20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vx21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vx0, vp0);
+    vp1 = _mm256_mul_ps(vx1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vx20, vbeta_6, vbeta_4);
+    __m256 vq1 = _mm256_fmadd_ps(vx21, vbeta_6, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vx20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vx21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vx20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vx21, vq1, vbeta_0);
+
+    const __m256 vy0 = _mm256_div_ps(vp0, vq0);
+    const __m256 vy1 = _mm256_div_ps(vp1, vq1);
+
+    _mm256_storeu_ps(output, vy0);
+    _mm256_storeu_ps(output + 8, vy1);
+    output += 16;
+  }
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vx = _mm256_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm256_min_ps(vx, vsat_cutoff);
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vp = _mm256_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm256_mul_ps(vx, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m256 vy = _mm256_div_ps(vp, vq);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - batch));
+
+    __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    vx = _mm256_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm256_min_ps(vx, vsat_cutoff);
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vp = _mm256_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm256_mul_ps(vx, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m256 vy = _mm256_div_ps(vp, vq);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (batch & (4 * sizeof(float))) {
+      _mm_storeu_ps(output, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      output += 4;
+    }
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy_lo);
+    }
+  }
+}
@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <arm_neon.h>
 
@@ -12,6 +13,7 @@
 #include <xnnpack/common.h>
 #include <xnnpack/conv.h>
 #include <xnnpack/dwconv.h>
+#include <xnnpack/embedding.h>
 #include <xnnpack/fill.h>
 #include <xnnpack/gavgpool.h>
 #include <xnnpack/gemm.h>
@@ -26,7 +28,9 @@
 #include <xnnpack/prefetch.h>
 #include <xnnpack/prelu.h>
 #include <xnnpack/raddstoreexpminusmax.h>
+#include <xnnpack/reduce.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/transpose.h>
 #include <xnnpack/unpool.h>
@@ -4025,6 +4029,70 @@ void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__neon_1x4(
   } while (output_height != 0);
 }
 
+void xnn_f32_embedding_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 = vaddq_f32(vacc0, vld1q_f32(i)); i += 4;
+      vacc1 = vaddq_f32(vacc1, vld1q_f32(i)); i += 4;
+      vacc2 = vaddq_f32(vacc2, vld1q_f32(i)); i += 4;
+      vacc3 = vaddq_f32(vacc3, vld1q_f32(i));
+    }
+    vst1q_f32(output, vmulq_f32(vacc0, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc1, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc2, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc3, vscale)); output += 4;
+    offset += 16 * sizeof(float);
+  }
+  for (; channels >= 4; channels -= 4) {
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = vaddq_f32(vacc, vld1q_f32(i));
+    }
+    vst1q_f32(output, vmulq_f32(vacc, vscale)); output += 4;
+    offset += 4 * sizeof(float);
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += *((const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset));
+    }
+    *output++ = vacc * vscale_tail;
+    offset += sizeof(float);
+  }
+}
+
 void xnn_f32_f16_vcvt_ukernel__neon_x8(
     size_t batch,
     const float* input,
@@ -7361,89 +7429,763 @@ void xnn_f32_raddstoreexpminusmax_ukernel__neon_rr2_lut64_p2_x8(
 #endif
 }
 
-void xnn_f32_rmax_ukernel__neon(
+void xnn_f32_rdmax_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vacc0 = vld1q_f32(output + 0);
+    float32x4_t vacc1 = vld1q_f32(output + 4);
+    float32x4_t vacc2 = vld1q_f32(output + 8);
+    float32x4_t vacc3 = vld1q_f32(output + 12);
+    size_t r = rows;
+    do {
+      const float32x4_t vx0 = vld1q_f32(i + 0);
+      const float32x4_t vx1 = vld1q_f32(i + 4);
+      const float32x4_t vx2 = vld1q_f32(i + 8);
+      const float32x4_t vx3 = vld1q_f32(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = vmaxq_f32(vacc0, vx0);
+      vacc1 = vmaxq_f32(vacc1, vx1);
+      vacc2 = vmaxq_f32(vacc2, vx2);
+      vacc3 = vmaxq_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    vst1q_f32(output + 0, vacc0);
+    vst1q_f32(output + 4, vacc1);
+    vst1q_f32(output + 8, vacc2);
+    vst1q_f32(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vacc = vld1q_f32(output);
+    size_t r = rows;
+    do {
+      const float32x4_t vx = vld1q_f32(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = vmaxq_f32(vacc, vx);
+    } while (--r != 0);
+
+    vst1q_f32(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = *output;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = math_max_f32(vacc, vx);
+      } while (--r != 0);
+
+      *output++ = vacc;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdmin_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vacc0 = vld1q_f32(output + 0);
+    float32x4_t vacc1 = vld1q_f32(output + 4);
+    float32x4_t vacc2 = vld1q_f32(output + 8);
+    float32x4_t vacc3 = vld1q_f32(output + 12);
+    size_t r = rows;
+    do {
+      const float32x4_t vx0 = vld1q_f32(i + 0);
+      const float32x4_t vx1 = vld1q_f32(i + 4);
+      const float32x4_t vx2 = vld1q_f32(i + 8);
+      const float32x4_t vx3 = vld1q_f32(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = vminq_f32(vacc0, vx0);
+      vacc1 = vminq_f32(vacc1, vx1);
+      vacc2 = vminq_f32(vacc2, vx2);
+      vacc3 = vminq_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    vst1q_f32(output + 0, vacc0);
+    vst1q_f32(output + 4, vacc1);
+    vst1q_f32(output + 8, vacc2);
+    vst1q_f32(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vacc = vld1q_f32(output);
+    size_t r = rows;
+    do {
+      const float32x4_t vx = vld1q_f32(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = vminq_f32(vacc, vx);
+    } while (--r != 0);
+
+    vst1q_f32(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = *output;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = math_min_f32(vacc, vx);
+      } while (--r != 0);
+
+      *output++ = vacc;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsum_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    size_t r = rows;
+    do {
+      const float32x4_t vx0 = vld1q_f32(i + 0);
+      const float32x4_t vx1 = vld1q_f32(i + 4);
+      const float32x4_t vx2 = vld1q_f32(i + 8);
+      const float32x4_t vx3 = vld1q_f32(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = vaddq_f32(vacc0, vx0);
+      vacc1 = vaddq_f32(vacc1, vx1);
+      vacc2 = vaddq_f32(vacc2, vx2);
+      vacc3 = vaddq_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    vacc0 = vmlaq_f32(vld1q_f32(output + 0), vacc0, vscale);
+    vacc1 = vmlaq_f32(vld1q_f32(output + 4), vacc1, vscale);
+    vacc2 = vmlaq_f32(vld1q_f32(output + 8), vacc2, vscale);
+    vacc3 = vmlaq_f32(vld1q_f32(output + 12), vacc3, vscale);
+    vst1q_f32(output + 0, vacc0);
+    vst1q_f32(output + 4, vacc1);
+    vst1q_f32(output + 8, vacc2);
+    vst1q_f32(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    size_t r = rows;
+    do {
+      const float32x4_t vx = vld1q_f32(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = vaddq_f32(vacc, vx);
+    } while (--r != 0);
+
+    vacc = vmlaq_f32(vld1q_f32(output), vacc, vscale);
+    vst1q_f32(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float vscale_lane = vgetq_lane_f32(vscale, 0);
+    do {
+      const float* i = input;
+      float vacc = 0.0f;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc += vx;
+      } while (--r != 0);
+
+      *output++ += vacc * vscale_lane;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsumsq_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    size_t r = rows;
+    do {
+      const float32x4_t vx0 = vld1q_f32(i + 0);
+      const float32x4_t vx1 = vld1q_f32(i + 4);
+      const float32x4_t vx2 = vld1q_f32(i + 8);
+      const float32x4_t vx3 = vld1q_f32(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = vmlaq_f32(vacc0, vx0, vx0);
+      vacc1 = vmlaq_f32(vacc1, vx1, vx1);
+      vacc2 = vmlaq_f32(vacc2, vx2, vx2);
+      vacc3 = vmlaq_f32(vacc3, vx3, vx3);
+    } while (--r != 0);
+
+    vacc0 = vmlaq_f32(vld1q_f32(output + 0), vacc0, vscale);
+    vacc1 = vmlaq_f32(vld1q_f32(output + 4), vacc1, vscale);
+    vacc2 = vmlaq_f32(vld1q_f32(output + 8), vacc2, vscale);
+    vacc3 = vmlaq_f32(vld1q_f32(output + 12), vacc3, vscale);
+    vst1q_f32(output + 0, vacc0);
+    vst1q_f32(output + 4, vacc1);
+    vst1q_f32(output + 8, vacc2);
+    vst1q_f32(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    size_t r = rows;
+    do {
+      const float32x4_t vx = vld1q_f32(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = vmlaq_f32(vacc, vx, vx);
+    } while (--r != 0);
+
+    vacc = vmlaq_f32(vld1q_f32(output), vacc, vscale);
+    vst1q_f32(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float vscale_lane = vgetq_lane_f32(vscale, 0);
+    do {
+      const float* i = input;
+      float vacc = 0.0f;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc += vx * vx;
+      } while (--r != 0);
+
+      *output++ += vacc * vscale_lane;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rmax_ukernel__neon_x16(
     size_t batch,
     const float* input,
-    float* output)
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
 {
   assert(batch != 0);
   assert(batch % sizeof(float) == 0);
   assert(input != NULL);
   assert(output != NULL);
 
-  float32x4_t vmax0 = vld1q_dup_f32(input);
+  float32x4_t vacc0 = vld1q_dup_f32(output);
+  float32x4_t vacc1 = vacc0;
+  float32x4_t vacc2 = vacc0;
+  float32x4_t vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vacc0 = vmaxq_f32(vacc0, vx0);
+    vacc1 = vmaxq_f32(vacc1, vx1);
+    vacc2 = vmaxq_f32(vacc2, vx2);
+    vacc3 = vmaxq_f32(vacc3, vx3);
+  }
+  vacc0 = vmaxq_f32(vacc0, vacc1);
+  vacc2 = vmaxq_f32(vacc2, vacc3);
+  vacc0 = vmaxq_f32(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+
+    vacc0 = vmaxq_f32(vacc0, vx);
+  }
+  #if XNN_ARCH_ARM64
+    float vacc = vmaxvq_f32(vacc0);
+  #else
+    const float32x2_t vacc_lo = vmax_f32(vget_low_f32(vacc0), vget_high_f32(vacc0));
+    float vacc = vget_lane_f32(vpmax_f32(vacc_lo, vacc_lo), 0);
+  #endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc = math_max_f32(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output = vacc;
+}
+
+void xnn_f32_rmin_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vacc0 = vld1q_dup_f32(output);
+  float32x4_t vacc1 = vacc0;
+  float32x4_t vacc2 = vacc0;
+  float32x4_t vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vacc0 = vminq_f32(vacc0, vx0);
+    vacc1 = vminq_f32(vacc1, vx1);
+    vacc2 = vminq_f32(vacc2, vx2);
+    vacc3 = vminq_f32(vacc3, vx3);
+  }
+  vacc0 = vminq_f32(vacc0, vacc1);
+  vacc2 = vminq_f32(vacc2, vacc3);
+  vacc0 = vminq_f32(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+
+    vacc0 = vminq_f32(vacc0, vx);
+  }
+  #if XNN_ARCH_ARM64
+    float vacc = vminvq_f32(vacc0);
+  #else
+    const float32x2_t vacc_lo = vmin_f32(vget_low_f32(vacc0), vget_high_f32(vacc0));
+    float vacc = vget_lane_f32(vpmin_f32(vacc_lo, vacc_lo), 0);
+  #endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc = math_min_f32(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output = vacc;
+}
+
+void xnn_f32_rminmax_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vmin0 = vld1q_dup_f32(output);
+  float32x4_t vmax0 = vld1q_dup_f32(output + 1);
+  float32x4_t vmin1 = vmin0;
   float32x4_t vmax1 = vmax0;
+  float32x4_t vmin2 = vmin0;
   float32x4_t vmax2 = vmax0;
+  float32x4_t vmin3 = vmin0;
   float32x4_t vmax3 = vmax0;
-  for (; batch >= 64; batch -= 64) {
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
     const float32x4_t vx0 = vld1q_f32(input); input += 4;
     const float32x4_t vx1 = vld1q_f32(input); input += 4;
     const float32x4_t vx2 = vld1q_f32(input); input += 4;
     const float32x4_t vx3 = vld1q_f32(input); input += 4;
 
+    vmin0 = vminq_f32(vmin0, vx0);
     vmax0 = vmaxq_f32(vmax0, vx0);
+    vmin1 = vminq_f32(vmin1, vx1);
     vmax1 = vmaxq_f32(vmax1, vx1);
+    vmin2 = vminq_f32(vmin2, vx2);
     vmax2 = vmaxq_f32(vmax2, vx2);
+    vmin3 = vminq_f32(vmin3, vx3);
     vmax3 = vmaxq_f32(vmax3, vx3);
   }
-  float32x4_t vmax = vmaxq_f32(vmaxq_f32(vmax0, vmax1), vmaxq_f32(vmax2, vmax3));
-  for (; batch >= 16; batch -= 16) {
+  vmin0 = vminq_f32(vmin0, vmin1);
+  vmax0 = vmaxq_f32(vmax0, vmax1);
+  vmin2 = vminq_f32(vmin2, vmin3);
+  vmax2 = vmaxq_f32(vmax2, vmax3);
+  vmin0 = vminq_f32(vmin0, vmin2);
+  vmax0 = vmaxq_f32(vmax0, vmax2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
     const float32x4_t vx = vld1q_f32(input); input += 4;
-    vmax = vmaxq_f32(vmax, vx);
+
+    vmin0 = vminq_f32(vmin0, vx);
+    vmax0 = vmaxq_f32(vmax0, vx);
   }
-#if XNN_ARCH_ARM64
-  float32x2_t vmax_lo = vget_low_f32(vpmaxq_f32(vmax, vmax));
-#else
-  float32x2_t vmax_lo = vmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
-#endif
+  #if XNN_ARCH_ARM64
+    float vmin = vminvq_f32(vmin0);
+    float vmax = vmaxvq_f32(vmax0);
+  #else
+    const float32x2_t vmin_lo = vmin_f32(vget_low_f32(vmin0), vget_high_f32(vmin0));
+    const float32x2_t vmax_lo = vmax_f32(vget_low_f32(vmax0), vget_high_f32(vmax0));
+    float vmin = vget_lane_f32(vpmin_f32(vmin_lo, vmin_lo), 0);
+    float vmax = vget_lane_f32(vpmax_f32(vmax_lo, vmax_lo), 0);
+  #endif
   if XNN_UNLIKELY(batch != 0) {
     do {
-      const float32x2_t vx = vld1_dup_f32(input); input += 1;
-      vmax_lo = vmax_f32(vmax_lo, vx);
-      batch -= 4;
+      const float vx = *input++;
+      vmin = math_min_f32(vmin, vx);
+      vmax = math_max_f32(vmax, vx);
+      batch -= sizeof(float);
     } while (batch != 0);
   }
-#if XNN_ARCH_ARM64
-  *output = vmaxv_f32(vmax_lo);
-#else
-  vst1_lane_f32(output, vpmax_f32(vmax_lo, vmax_lo), 0);
-#endif
+  output[0] = vmin;
+  output[1] = vmax;
 }
 
-void xnn_f32_spmm_minmax_ukernel_32x1__neon(
-    size_t mc,
-    size_t nc,
+void xnn_f32_rsum_ukernel__neon_x16(
+    size_t batch,
     const float* input,
-    const float* weights,
-    const int32_t* widx_dmap,
-    const uint32_t* nidx_nnzmap,
     float* output,
-    size_t output_stride,
-    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
 {
-  assert(mc != 0);
-  assert(mc % sizeof(float) == 0);
-  assert(nc != 0);
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vacc0 = vmovq_n_f32(0.0f);
+  float32x4_t vacc1 = vacc0;
+  float32x4_t vacc2 = vacc0;
+  float32x4_t vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vacc0 = vaddq_f32(vacc0, vx0);
+    vacc1 = vaddq_f32(vacc1, vx1);
+    vacc2 = vaddq_f32(vacc2, vx2);
+    vacc3 = vaddq_f32(vacc3, vx3);
+  }
+  vacc0 = vaddq_f32(vacc0, vacc1);
+  vacc2 = vaddq_f32(vacc2, vacc3);
+  vacc0 = vaddq_f32(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
 
+    vacc0 = vaddq_f32(vacc0, vx);
+  }
   #if XNN_ARCH_ARM64
-    const float32x4x2_t vminmax = vld2q_dup_f32(&params->scalar.min);
-    const float32x4_t vmin = vminmax.val[0];
-    const float32x4_t vmax = vminmax.val[1];
+    float vacc = vaddvq_f32(vacc0);
   #else
-    const float32x2x2_t vminmax = vld2_dup_f32(&params->scalar.min);
-    const float32x4_t vmin = vcombine_f32(vminmax.val[0],vminmax.val[0]);
-    const float32x4_t vmax = vcombine_f32(vminmax.val[1],vminmax.val[1]);
+    const float32x2_t vacc_lo = vadd_f32(vget_low_f32(vacc0), vget_high_f32(vacc0));
+    float vacc = vget_lane_f32(vpadd_f32(vacc_lo, vacc_lo), 0);
   #endif
-
-  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
-  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
-    const float* w = weights;
-    const int32_t* dmap = widx_dmap;
-    const uint32_t* nnzmap = nidx_nnzmap;
-    size_t n = nc;
+  if XNN_UNLIKELY(batch != 0) {
     do {
-      uint32_t nnz = *nnzmap++;
-      float32x4_t vacc0123 = vld1q_dup_f32(w); w += 1;
+      const float vx = *input++;
+      vacc += vx;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output += vacc * params->scalar.scale;
+}
+
+void xnn_f32_rsumsq_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vacc0 = vmovq_n_f32(0.0f);
+  float32x4_t vacc1 = vacc0;
+  float32x4_t vacc2 = vacc0;
+  float32x4_t vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vacc0 = vmlaq_f32(vacc0, vx0, vx0);
+    vacc1 = vmlaq_f32(vacc1, vx1, vx1);
+    vacc2 = vmlaq_f32(vacc2, vx2, vx2);
+    vacc3 = vmlaq_f32(vacc3, vx3, vx3);
+  }
+  vacc0 = vaddq_f32(vacc0, vacc1);
+  vacc2 = vaddq_f32(vacc2, vacc3);
+  vacc0 = vaddq_f32(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+
+    vacc0 = vmlaq_f32(vacc0, vx, vx);
+  }
+  #if XNN_ARCH_ARM64
+    float vacc = vaddvq_f32(vacc0);
+  #else
+    const float32x2_t vacc_lo = vadd_f32(vget_low_f32(vacc0), vget_high_f32(vacc0));
+    float vacc = vget_lane_f32(vpadd_f32(vacc_lo, vacc_lo), 0);
+  #endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc += vx * vx;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output += vacc * params->scalar.scale;
+}
+
+void xnn_f32_rmax_ukernel__neon(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vmax0 = vld1q_dup_f32(input);
+  float32x4_t vmax1 = vmax0;
+  float32x4_t vmax2 = vmax0;
+  float32x4_t vmax3 = vmax0;
+  for (; batch >= 64; batch -= 64) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vmax0 = vmaxq_f32(vmax0, vx0);
+    vmax1 = vmaxq_f32(vmax1, vx1);
+    vmax2 = vmaxq_f32(vmax2, vx2);
+    vmax3 = vmaxq_f32(vmax3, vx3);
+  }
+  float32x4_t vmax = vmaxq_f32(vmaxq_f32(vmax0, vmax1), vmaxq_f32(vmax2, vmax3));
+  for (; batch >= 16; batch -= 16) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+    vmax = vmaxq_f32(vmax, vx);
+  }
+#if XNN_ARCH_ARM64
+  float32x2_t vmax_lo = vget_low_f32(vpmaxq_f32(vmax, vmax));
+#else
+  float32x2_t vmax_lo = vmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
+#endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float32x2_t vx = vld1_dup_f32(input); input += 1;
+      vmax_lo = vmax_f32(vmax_lo, vx);
+      batch -= 4;
+    } while (batch != 0);
+  }
+#if XNN_ARCH_ARM64
+  *output = vmaxv_f32(vmax_lo);
+#else
+  vst1_lane_f32(output, vpmax_f32(vmax_lo, vmax_lo), 0);
+#endif
+}
+
+void xnn_f32_rnorm_ukernel__neon_x8(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const float32x4_t vshift4 = vdupq_n_f32(vshift);
+  float32x4_t vsum0 = vmovq_n_f32(0.0f);
+  float32x4_t vsum1 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq0 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq1 = vmovq_n_f32(0.0f);
+  size_t c = channels;
+  for (; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const float32x4_t vd0 = vsubq_f32(vld1q_f32(i), vshift4); i += 4;
+    const float32x4_t vd1 = vsubq_f32(vld1q_f32(i), vshift4); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vd0);
+    vsum1 = vaddq_f32(vsum1, vd1);
+    vsumsq0 = vmlaq_f32(vsumsq0, vd0, vd0);
+    vsumsq1 = vmlaq_f32(vsumsq1, vd1, vd1);
+  }
+  if (c >= 4 * sizeof(float)) {
+    const float32x4_t vd = vsubq_f32(vld1q_f32(i), vshift4); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vd);
+    vsumsq0 = vmlaq_f32(vsumsq0, vd, vd);
+    c -= 4 * sizeof(float);
+  }
+  const float32x4_t vsum4 = vaddq_f32(vsum0, vsum1);
+  const float32x4_t vsumsq4 = vaddq_f32(vsumsq0, vsumsq1);
+  float32x2_t vsum2 = vadd_f32(vget_low_f32(vsum4), vget_high_f32(vsum4));
+  float32x2_t vsumsq2 = vadd_f32(vget_low_f32(vsumsq4), vget_high_f32(vsumsq4));
+  vsum2 = vpadd_f32(vsum2, vsum2);
+  vsumsq2 = vpadd_f32(vsumsq2, vsumsq2);
+  float vsum_tail = vget_lane_f32(vsum2, 0);
+  float vsumsq_tail = vget_lane_f32(vsumsq2, 0);
+  for (; c != 0; c -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const float32x4_t vmean4 = vdupq_n_f32(vmean);
+  const float32x4_t vrstd4 = vdupq_n_f32(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(i); i += 4;
+    const float32x4_t vx1 = vld1q_f32(i); i += 4;
+    const float32x4_t vscale0 = vmulq_f32(vld1q_f32(gamma), vrstd4); gamma += 4;
+    const float32x4_t vscale1 = vmulq_f32(vld1q_f32(gamma), vrstd4); gamma += 4;
+    const float32x4_t vbeta0 = vld1q_f32(beta); beta += 4;
+    const float32x4_t vbeta1 = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vy0 = vmlaq_f32(vbeta0, vsubq_f32(vx0, vmean4), vscale0);
+    const float32x4_t vy1 = vmlaq_f32(vbeta1, vsubq_f32(vx1, vmean4), vscale1);
+
+    vst1q_f32(o, vy0); o += 4;
+    vst1q_f32(o, vy1); o += 4;
+  }
+  if (c >= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(i); i += 4;
+    const float32x4_t vscale = vmulq_f32(vld1q_f32(gamma), vrstd4); gamma += 4;
+    const float32x4_t vbeta = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vy = vmlaq_f32(vbeta, vsubq_f32(vx, vmean4), vscale);
+
+    vst1q_f32(o, vy); o += 4;
+    c -= 4 * sizeof(float);
+  }
+  for (; c != 0; c -= sizeof(float)) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x1__neon(
+    size_t mc,
+    size_t nc,
+    const float* input,
+    const float* weights,
+    const int32_t* widx_dmap,
+    const uint32_t* nidx_nnzmap,
+    float* output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  #if XNN_ARCH_ARM64
+    const float32x4x2_t vminmax = vld2q_dup_f32(&params->scalar.min);
+    const float32x4_t vmin = vminmax.val[0];
+    const float32x4_t vmax = vminmax.val[1];
+  #else
+    const float32x2x2_t vminmax = vld2_dup_f32(&params->scalar.min);
+    const float32x4_t vmin = vcombine_f32(vminmax.val[0],vminmax.val[0]);
+    const float32x4_t vmax = vcombine_f32(vminmax.val[1],vminmax.val[1]);
+  #endif
+
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      float32x4_t vacc0123 = vld1q_dup_f32(w); w += 1;
       float32x4_t vacc4567 = vacc0123;
       float32x4_t vacc89AB = vacc0123;
       float32x4_t vaccCDEF = vacc0123;
@@ -7665,6 +8407,190 @@ void xnn_f32_spmm_minmax_ukernel_32x1__neon(
   }
 }
 
+void xnn_f32_vapproxgelu_ukernel__neon_rational_13_6_nr2recps_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vc3 = vmovq_n_f32(0x1.2444F2p-5f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.988454p-1f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vu0 = vmlaq_f32(vc1, vx20, vc3);
+    float32x4_t vu1 = vmlaq_f32(vc1, vx21, vc3);
+
+    vu0 = vmulq_f32(vx0, vu0);
+    vu1 = vmulq_f32(vx1, vu1);
+
+    vu0 = vmaxq_f32(vu0, vneg_sat_cutoff);
+    vu1 = vmaxq_f32(vu1, vneg_sat_cutoff);
+
+    vu0 = vminq_f32(vu0, vsat_cutoff);
+    vu1 = vminq_f32(vu1, vsat_cutoff);
+
+    const float32x4_t vu20 = vmulq_f32(vu0, vu0);
+    const float32x4_t vu21 = vmulq_f32(vu1, vu1);
+
+    float32x4_t vp0 = vmlaq_f32(valpha_11, vu20, valpha_13);
+    float32x4_t vp1 = vmlaq_f32(valpha_11, vu21, valpha_13);
+
+    vp0 = vmlaq_f32(valpha_9, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_9, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_7, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_7, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_5, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_5, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_3, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_3, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_1, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_1, vu21, vp1);
+
+    vp0 = vmulq_f32(vu0, vp0);
+    vp1 = vmulq_f32(vu1, vp1);
+
+    float32x4_t vq0 = vmlaq_f32(vbeta_4, vu20, vbeta_6);
+    float32x4_t vq1 = vmlaq_f32(vbeta_4, vu21, vbeta_6);
+
+    vq0 = vmlaq_f32(vbeta_2, vu20, vq0);
+    vq1 = vmlaq_f32(vbeta_2, vu21, vq1);
+
+    vq0 = vmlaq_f32(vbeta_0, vu20, vq0);
+    vq1 = vmlaq_f32(vbeta_0, vu21, vq1);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    const float32x4_t vt0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vt1 = vmulq_f32(vp1, vrq1);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+
+    const float32x4_t vy0 = vmlaq_f32(vhalfx0, vhalfx0, vt0);
+    const float32x4_t vy1 = vmlaq_f32(vhalfx1, vhalfx1, vt1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vmlaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vu2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vu2, vp);
+    vp = vmlaq_f32(valpha_7, vu2, vp);
+    vp = vmlaq_f32(valpha_5, vu2, vp);
+    vp = vmlaq_f32(valpha_3, vu2, vp);
+    vp = vmlaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vu2, vq);
+    vq = vmlaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, vt);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vmlaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vu2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vu2, vp);
+    vp = vmlaq_f32(valpha_7, vu2, vp);
+    vp = vmlaq_f32(valpha_5, vu2, vp);
+    vp = vmlaq_f32(valpha_3, vu2, vp);
+    vp = vmlaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vu2, vq);
+    vq = vmlaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, vt);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
 void xnn_f32_vadd_minmax_ukernel__neon_x8(
     size_t batch,
     const float* input_a,
@@ -8645,65 +9571,403 @@ void xnn_f32_velu_ukernel__neon_rr2_lut16_p3_x8(
   }
 }
 
-void xnn_f32_vhswish_ukernel__neon_x16(
+void xnn_f32_vexp_ukernel__neon_rr2_p5_x8(
     size_t batch,
     const float* input,
     float* output,
-    const union xnn_f32_hswish_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
 {
   assert(batch != 0);
   assert(batch % sizeof(float) == 0);
   assert(input != NULL);
   assert(output != NULL);
 
-  const float32x4_t vsixth = vld1q_dup_f32(&params->scalar.sixth);
-  const float32x4_t vthree = vld1q_dup_f32(&params->scalar.three);
-  const int32x4_t vsix = vreinterpretq_s32_f32(vld1q_dup_f32(&params->scalar.six));
-  const int32x4_t vzero = vdupq_n_s32(0);
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const float32x4_t vzero_cutoff = vmovq_n_f32(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const float32x4_t vinf_cutoff = vmovq_n_f32(0x1.62E42Ep+6f);
+  const float32x4_t vlog2e = vmovq_n_f32(0x1.715476p+0f);
+  const float32x4_t vminus_ln2_hi = vmovq_n_f32(-0x1.62E400p-1f);
+  const float32x4_t vminus_ln2_lo = vmovq_n_f32(-0x1.7F7D1Cp-20f);
+  const float32x4_t vplus_inf = vmovq_n_f32(INFINITY);
+  const float32x4_t vc5 = vmovq_n_f32(0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.FFFFF6p-1f);
+  const int32x4_t vmin_exponent = vmovq_n_s32(-INT32_C(0x3F000000));
+  const int32x4_t vmax_exponent = vmovq_n_s32(INT32_C(0x3F800000));
+  const int32x4_t vdefault_exponent = vmax_exponent;
 
-  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
-    float32x4_t vx0123 = vld1q_f32(input); input += 4;
-    float32x4_t vx4567 = vld1q_f32(input); input += 4;
-    float32x4_t vx89AB = vld1q_f32(input); input += 4;
-    float32x4_t vxCDEF = vld1q_f32(input); input += 4;
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
 
-    float32x4_t vacc0123 = vaddq_f32(vx0123, vthree);
-    vx0123 = vmulq_f32(vx0123, vsixth);
-    float32x4_t vacc4567 = vaddq_f32(vx4567, vthree);
-    vx4567 = vmulq_f32(vx4567, vsixth);
-    float32x4_t vacc89AB = vaddq_f32(vx89AB, vthree);
-    vx89AB = vmulq_f32(vx89AB, vsixth);
-    float32x4_t vaccCDEF = vaddq_f32(vxCDEF, vthree);
-    vxCDEF = vmulq_f32(vxCDEF, vsixth);
+    float32x4_t vn0 = vmlaq_f32(vmagic_bias, vx0, vlog2e);
+    float32x4_t vn1 = vmlaq_f32(vmagic_bias, vx1, vlog2e);
 
-    vacc0123 = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc0123), vzero));
-    vacc4567 = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc4567), vzero));
-    vacc89AB = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc89AB), vzero));
-    vaccCDEF = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vaccCDEF), vzero));
+    int32x4_t veo0 = vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23);
+    int32x4_t veo1 = vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23);
 
-    vacc0123 = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc0123), vsix));
-    vacc4567 = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc4567), vsix));
-    vacc89AB = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc89AB), vsix));
-    vaccCDEF = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vaccCDEF), vsix));
+    int32x4_t ven0 = vmaxq_s32(veo0, vmin_exponent);
+    int32x4_t ven1 = vmaxq_s32(veo1, vmin_exponent);
 
-    vacc0123 = vmulq_f32(vacc0123, vx0123);
-    vacc4567 = vmulq_f32(vacc4567, vx4567);
-    vacc89AB = vmulq_f32(vacc89AB, vx89AB);
-    vaccCDEF = vmulq_f32(vaccCDEF, vxCDEF);
+    ven0 = vminq_s32(ven0, vmax_exponent);
+    ven1 = vminq_s32(ven1, vmax_exponent);
 
-    vst1q_f32(output, vacc0123); output += 4;
-    vst1q_f32(output, vacc4567); output += 4;
-    vst1q_f32(output, vacc89AB); output += 4;
-    vst1q_f32(output, vaccCDEF); output += 4;
-  }
-  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
-    float32x4_t vx = vld1q_f32(input); input += 4;
-    float32x4_t vacc = vaddq_f32(vx, vthree);
-    vx = vmulq_f32(vx, vsixth);
-    vacc = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc), vzero));
-    vacc = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc), vsix));
-    vacc = vmulq_f32(vacc, vx);
-    vst1q_f32(output, vacc); output += 4;
+    veo0 = vsubq_s32(veo0, ven0);
+    veo1 = vsubq_s32(veo1, ven1);
+
+    const float32x4_t vsn0 = vreinterpretq_f32_s32(vaddq_s32(ven0, vdefault_exponent));
+    const float32x4_t vsn1 = vreinterpretq_f32_s32(vaddq_s32(ven1, vdefault_exponent));
+
+    const float32x4_t vso0 = vreinterpretq_f32_s32(vaddq_s32(veo0, vdefault_exponent));
+    const float32x4_t vso1 = vreinterpretq_f32_s32(vaddq_s32(veo1, vdefault_exponent));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+
+    float32x4_t vt0 = vmlaq_f32(vx0, vn0, vminus_ln2_hi);
+    float32x4_t vt1 = vmlaq_f32(vx1, vn1, vminus_ln2_hi);
+
+    vt0 = vmlaq_f32(vt0, vn0, vminus_ln2_lo);
+    vt1 = vmlaq_f32(vt1, vn1, vminus_ln2_lo);
+
+    float32x4_t vp0 = vmlaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vmlaq_f32(vc4, vc5, vt1);
+
+    vp0 = vmlaq_f32(vc3, vp0, vt0);
+    vp1 = vmlaq_f32(vc3, vp1, vt1);
+
+    vp0 = vmlaq_f32(vc2, vp0, vt0);
+    vp1 = vmlaq_f32(vc2, vp1, vt1);
+
+    vp0 = vmlaq_f32(vc1, vp0, vt0);
+    vp1 = vmlaq_f32(vc1, vp1, vt1);
+
+    vt0 = vmulq_f32(vt0, vso0);
+    vt1 = vmulq_f32(vt1, vso1);
+
+    float32x4_t vy0 = vmulq_f32(vsn0, vmlaq_f32(vso0, vt0, vp0));
+    float32x4_t vy1 = vmulq_f32(vsn1, vmlaq_f32(vso1, vt1, vp1));
+
+    vy0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy0), vcltq_f32(vx0, vzero_cutoff)));
+    vy1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy1), vcltq_f32(vx1, vzero_cutoff)));
+
+    vy0 = vbslq_f32(vcgtq_f32(vx0, vinf_cutoff), vplus_inf, vy0);
+    vy1 = vbslq_f32(vcgtq_f32(vx1, vinf_cutoff), vplus_inf, vy1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vmlaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vmlaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vmlaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vmlaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vmlaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vmlaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
+void xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vsqrt1_2 = vmovq_n_f32(0x1.6A09E6p-1f);
+  const float32x4_t vneg_erf_cutoff = vmovq_n_f32(-0x1.000000p+2f);
+  const float32x4_t verf_cutoff = vmovq_n_f32(0x1.000000p+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.2BBE16p-32f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.DBFFDCp-26f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.19FEA2p-19f);
+  const float32x4_t valpha_7 = vmovq_n_f32(-0x1.DD85A4p-15f);
+  const float32x4_t valpha_5 = vmovq_n_f32(-0x1.8158C6p-11f);
+  const float32x4_t valpha_3 = vmovq_n_f32(-0x1.8343ECp-9f);
+  const float32x4_t valpha_1 = vmovq_n_f32(-0x1.07B7A8p-6f);
+  const float32x4_t vbeta_8 = vmovq_n_f32(-0x1.E8C19Ap-17f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(-0x1.BF7A52p-13f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(-0x1.B9249Cp-10f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(-0x1.E337F0p-8f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(-0x1.D36D4Ep-7f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    float32x4_t vz0 = vmulq_f32(vx0, vsqrt1_2);
+    float32x4_t vz1 = vmulq_f32(vx1, vsqrt1_2);
+
+    vz0 = vmaxq_f32(vz0, vneg_erf_cutoff);
+    vz1 = vmaxq_f32(vz1, vneg_erf_cutoff);
+
+    vz0 = vminq_f32(vz0, verf_cutoff);
+    vz1 = vminq_f32(vz1, verf_cutoff);
+
+    const float32x4_t vz20 = vmulq_f32(vz0, vz0);
+    const float32x4_t vz21 = vmulq_f32(vz1, vz1);
+
+    float32x4_t vp0 = vmlaq_f32(valpha_11, vz20, valpha_13);
+    float32x4_t vp1 = vmlaq_f32(valpha_11, vz21, valpha_13);
+
+    vp0 = vmlaq_f32(valpha_9, vz20, vp0);
+    vp1 = vmlaq_f32(valpha_9, vz21, vp1);
+
+    vp0 = vmlaq_f32(valpha_7, vz20, vp0);
+    vp1 = vmlaq_f32(valpha_7, vz21, vp1);
+
+    vp0 = vmlaq_f32(valpha_5, vz20, vp0);
+    vp1 = vmlaq_f32(valpha_5, vz21, vp1);
+
+    vp0 = vmlaq_f32(valpha_3, vz20, vp0);
+    vp1 = vmlaq_f32(valpha_3, vz21, vp1);
+
+    vp0 = vmlaq_f32(valpha_1, vz20, vp0);
+    vp1 = vmlaq_f32(valpha_1, vz21, vp1);
+
+    vp0 = vmulq_f32(vz0, vp0);
+    vp1 = vmulq_f32(vz1, vp1);
+
+    float32x4_t vq0 = vmlaq_f32(vbeta_6, vz20, vbeta_8);
+    float32x4_t vq1 = vmlaq_f32(vbeta_6, vz21, vbeta_8);
+
+    vq0 = vmlaq_f32(vbeta_4, vz20, vq0);
+    vq1 = vmlaq_f32(vbeta_4, vz21, vq1);
+
+    vq0 = vmlaq_f32(vbeta_2, vz20, vq0);
+    vq1 = vmlaq_f32(vbeta_2, vz21, vq1);
+
+    vq0 = vmlaq_f32(vbeta_0, vz20, vq0);
+    vq1 = vmlaq_f32(vbeta_0, vz21, vq1);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    const float32x4_t verf0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t verf1 = vmulq_f32(vp1, vrq1);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+
+    const float32x4_t vy0 = vmlaq_f32(vhalfx0, vhalfx0, verf0);
+    const float32x4_t vy1 = vmlaq_f32(vhalfx1, vhalfx1, verf1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vz2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vz2, vp);
+    vp = vmlaq_f32(valpha_7, vz2, vp);
+    vp = vmlaq_f32(valpha_5, vz2, vp);
+    vp = vmlaq_f32(valpha_3, vz2, vp);
+    vp = vmlaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vmlaq_f32(vbeta_4, vz2, vq);
+    vq = vmlaq_f32(vbeta_2, vz2, vq);
+    vq = vmlaq_f32(vbeta_0, vz2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t verf = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, verf);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vz2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vz2, vp);
+    vp = vmlaq_f32(valpha_7, vz2, vp);
+    vp = vmlaq_f32(valpha_5, vz2, vp);
+    vp = vmlaq_f32(valpha_3, vz2, vp);
+    vp = vmlaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vmlaq_f32(vbeta_4, vz2, vq);
+    vq = vmlaq_f32(vbeta_2, vz2, vq);
+    vq = vmlaq_f32(vbeta_0, vz2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t verf = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, verf);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
+void xnn_f32_vhswish_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_hswish_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vsixth = vld1q_dup_f32(&params->scalar.sixth);
+  const float32x4_t vthree = vld1q_dup_f32(&params->scalar.three);
+  const int32x4_t vsix = vreinterpretq_s32_f32(vld1q_dup_f32(&params->scalar.six));
+  const int32x4_t vzero = vdupq_n_s32(0);
+
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    float32x4_t vx0123 = vld1q_f32(input); input += 4;
+    float32x4_t vx4567 = vld1q_f32(input); input += 4;
+    float32x4_t vx89AB = vld1q_f32(input); input += 4;
+    float32x4_t vxCDEF = vld1q_f32(input); input += 4;
+
+    float32x4_t vacc0123 = vaddq_f32(vx0123, vthree);
+    vx0123 = vmulq_f32(vx0123, vsixth);
+    float32x4_t vacc4567 = vaddq_f32(vx4567, vthree);
+    vx4567 = vmulq_f32(vx4567, vsixth);
+    float32x4_t vacc89AB = vaddq_f32(vx89AB, vthree);
+    vx89AB = vmulq_f32(vx89AB, vsixth);
+    float32x4_t vaccCDEF = vaddq_f32(vxCDEF, vthree);
+    vxCDEF = vmulq_f32(vxCDEF, vsixth);
+
+    vacc0123 = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc0123), vzero));
+    vacc4567 = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc4567), vzero));
+    vacc89AB = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc89AB), vzero));
+    vaccCDEF = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vaccCDEF), vzero));
+
+    vacc0123 = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc0123), vsix));
+    vacc4567 = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc4567), vsix));
+    vacc89AB = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc89AB), vsix));
+    vaccCDEF = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vaccCDEF), vsix));
+
+    vacc0123 = vmulq_f32(vacc0123, vx0123);
+    vacc4567 = vmulq_f32(vacc4567, vx4567);
+    vacc89AB = vmulq_f32(vacc89AB, vx89AB);
+    vaccCDEF = vmulq_f32(vaccCDEF, vxCDEF);
+
+    vst1q_f32(output, vacc0123); output += 4;
+    vst1q_f32(output, vacc4567); output += 4;
+    vst1q_f32(output, vacc89AB); output += 4;
+    vst1q_f32(output, vaccCDEF); output += 4;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    float32x4_t vx = vld1q_f32(input); input += 4;
+    float32x4_t vacc = vaddq_f32(vx, vthree);
+    vx = vmulq_f32(vx, vsixth);
+    vacc = vreinterpretq_f32_s32(vmaxq_s32(vreinterpretq_s32_f32(vacc), vzero));
+    vacc = vreinterpretq_f32_s32(vminq_s32(vreinterpretq_s32_f32(vacc), vsix));
+    vacc = vmulq_f32(vacc, vx);
+    vst1q_f32(output, vacc); output += 4;
   }
   if XNN_UNLIKELY(batch != 0) {
     float32x4_t vx = vld1q_f32(input);
@@ -9269,81 +10533,403 @@ void xnn_f32_vsigmoid_ukernel__neon_rr2_lut64_p2_nr2recps_x8(
     float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
     const int32x4_t ve = vshlq_n_s32(vreinterpretq_s32_f32(vn), 17);
 
-    const uint64x2_t vidx = vreinterpretq_u64_s32(vandq_s32(vreinterpretq_s32_f32(vn), vindex_mask));
-    const uint64_t vidx_lo = vgetq_lane_u64(vidx, 0);
-    const uint64_t vidx_hi = vgetq_lane_u64(vidx, 1);
-    float32x2_t vl_lo = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_lo]);
-    float32x2_t vl_hi = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_hi]);
-    vl_lo = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_lo >> 32)], vl_lo, 1);
-    vl_hi = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_hi >> 32)], vl_hi, 1);
-    const float32x4_t vl = vcombine_f32(vl_lo, vl_hi);
+    const uint64x2_t vidx = vreinterpretq_u64_s32(vandq_s32(vreinterpretq_s32_f32(vn), vindex_mask));
+    const uint64_t vidx_lo = vgetq_lane_u64(vidx, 0);
+    const uint64_t vidx_hi = vgetq_lane_u64(vidx, 1);
+    float32x2_t vl_lo = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_lo]);
+    float32x2_t vl_hi = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_hi]);
+    vl_lo = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_lo >> 32)], vl_lo, 1);
+    vl_hi = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_hi >> 32)], vl_hi, 1);
+    const float32x4_t vl = vcombine_f32(vl_lo, vl_hi);
+
+    const float32x4_t vs = vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(vl), ve));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
+    vt = vmlaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vmulq_f32(vt, vc2);
+    vp = vmlsq_f32(vt, vp, vt);
+
+    const float32x4_t vy = vmlsq_f32(vs, vs, vp);
+    const float32x4_t vd = vaddq_f32(vy, vone);
+
+    float32x4_t vr = vrecpeq_f32(vd);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+
+    float32x4_t vf = vmulq_f32(vy, vr);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    vst1q_f32(output, vf); output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
+    const int32x4_t ve = vshlq_n_s32(vreinterpretq_s32_f32(vn), 17);
+
+    const uint64x2_t vidx = vreinterpretq_u64_s32(vandq_s32(vreinterpretq_s32_f32(vn), vindex_mask));
+    const uint64_t vidx_lo = vgetq_lane_u64(vidx, 0);
+    const uint64_t vidx_hi = vgetq_lane_u64(vidx, 1);
+    float32x2_t vl_lo = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_lo]);
+    float32x2_t vl_hi = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_hi]);
+    vl_lo = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_lo >> 32)], vl_lo, 1);
+    vl_hi = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_hi >> 32)], vl_hi, 1);
+    const float32x4_t vl = vcombine_f32(vl_lo, vl_hi);
+
+    const float32x4_t vs = vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(vl), ve));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
+    vt = vmlaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vmulq_f32(vt, vc2);
+    vp = vmlsq_f32(vt, vp, vt);
+
+    const float32x4_t vy = vmlsq_f32(vs, vs, vp);
+    const float32x4_t vd = vaddq_f32(vy, vone);
+
+    float32x4_t vr = vrecpeq_f32(vd);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+
+    float32x4_t vf = vmulq_f32(vy, vr);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    float32x2_t vf_lo = vget_low_f32(vf);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vf_lo); output += 2;
+      vf_lo = vget_high_f32(vf);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vf_lo, 0);
+    }
+  }
+}
+
+void xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.8000FEp23f);
+  const float32x4_t vminus_log2e = vmovq_n_f32(-0x1.715476p0f);
+  const float32x4_t vln2_hi = vmovq_n_f32(0x1.62E400p-1f);
+  const float32x4_t vln2_lo = vmovq_n_f32(0x1.7F7D1Cp-20f);
+  const float32x4_t vc5 = vmovq_n_f32(-0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(-0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(-0x1.FFFFF6p-1f);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vdenorm_cutoff = vmovq_n_f32(0x1.5D589Ep+6f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    const float32x4_t vz0 = vabsq_f32(vx0);
+    const float32x4_t vz1 = vabsq_f32(vx1);
+
+    float32x4_t vn0 = vmlaq_f32(vmagic_bias, vz0, vminus_log2e);
+    float32x4_t vn1 = vmlaq_f32(vmagic_bias, vz1, vminus_log2e);
+
+    const float32x4_t vs0 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23));
+    const float32x4_t vs1 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+
+    float32x4_t vt0 = vmlaq_f32(vz0, vn0, vln2_hi);
+    float32x4_t vt1 = vmlaq_f32(vz1, vn1, vln2_hi);
+
+    vt0 = vmlaq_f32(vt0, vn0, vln2_lo);
+    vt1 = vmlaq_f32(vt1, vn1, vln2_lo);
+
+    float32x4_t vp0 = vmlaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vmlaq_f32(vc4, vc5, vt1);
+
+    vp0 = vmlaq_f32(vc3, vp0, vt0);
+    vp1 = vmlaq_f32(vc3, vp1, vt1);
+
+    vp0 = vmlaq_f32(vc2, vp0, vt0);
+    vp1 = vmlaq_f32(vc2, vp1, vt1);
+
+    vp0 = vmlaq_f32(vc1, vp0, vt0);
+    vp1 = vmlaq_f32(vc1, vp1, vt1);
+
+    vt0 = vmulq_f32(vt0, vs0);
+    vt1 = vmulq_f32(vt1, vs1);
+
+    const float32x4_t ve0 = vmlaq_f32(vs0, vp0, vt0);
+    const float32x4_t ve1 = vmlaq_f32(vs1, vp1, vt1);
+
+    const float32x4_t ve10 = vaddq_f32(ve0, vone);
+    const float32x4_t ve11 = vaddq_f32(ve1, vone);
+
+    float32x4_t vre10 = vrecpeq_f32(ve10);
+    float32x4_t vre11 = vrecpeq_f32(ve11);
+
+    vre10 = vmulq_f32(vre10, vrecpsq_f32(vre10, ve10));
+    vre11 = vmulq_f32(vre11, vrecpsq_f32(vre11, ve11));
+
+    vre10 = vmulq_f32(vre10, vrecpsq_f32(vre10, ve10));
+    vre11 = vmulq_f32(vre11, vrecpsq_f32(vre11, ve11));
+
+    float32x4_t vf0 = vmulq_f32(ve0, vre10);
+    float32x4_t vf1 = vmulq_f32(ve1, vre11);
+
+    vf0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf0), vcagtq_f32(vx0, vdenorm_cutoff)));
+    vf1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf1), vcagtq_f32(vx1, vdenorm_cutoff)));
+
+    const uint32x4_t vm0 = vcltq_f32(vx0, vmovq_n_f32(0.0f));
+    const uint32x4_t vm1 = vcltq_f32(vx1, vmovq_n_f32(0.0f));
+
+    vf0 = vbslq_f32(vm0, vf0, vsubq_f32(vone, vf0));
+    vf1 = vbslq_f32(vm1, vf1, vsubq_f32(vone, vf1));
+
+    const float32x4_t vy0 = vmulq_f32(vx0, vf0);
+    const float32x4_t vy1 = vmulq_f32(vx1, vf1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
+    vt = vmlaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vmlaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vre1 = vrecpeq_f32(ve1);
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    float32x4_t vf = vmulq_f32(ve, vre1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
+    vt = vmlaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vmlaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vre1 = vrecpeq_f32(ve1);
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    float32x4_t vf = vmulq_f32(ve, vre1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
+void xnn_f32_vtanh_ukernel__neon_rational_13_6_nr2recps_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    float32x4_t vx0 = vld1q_f32(input);
+    float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    vx0 = vmaxq_f32(vx0, vneg_sat_cutoff);
+    vx1 = vmaxq_f32(vx1, vneg_sat_cutoff);
+
+    vx0 = vminq_f32(vx0, vsat_cutoff);
+    vx1 = vminq_f32(vx1, vsat_cutoff);
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vp0 = vmlaq_f32(valpha_11, vx20, valpha_13);
+    float32x4_t vp1 = vmlaq_f32(valpha_11, vx21, valpha_13);
+
+    vp0 = vmlaq_f32(valpha_9, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_9, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_7, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_7, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_5, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_5, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_3, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_3, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_1, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_1, vx21, vp1);
+
+    vp0 = vmulq_f32(vx0, vp0);
+    vp1 = vmulq_f32(vx1, vp1);
+
+    float32x4_t vq0 = vmlaq_f32(vbeta_4, vx20, vbeta_6);
+    float32x4_t vq1 = vmlaq_f32(vbeta_4, vx21, vbeta_6);
+
+    vq0 = vmlaq_f32(vbeta_2, vx20, vq0);
+    vq1 = vmlaq_f32(vbeta_2, vx21, vq1);
 
-    const float32x4_t vs = vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(vl), ve));
-    vn = vsubq_f32(vn, vmagic_bias);
-    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
-    vt = vmlaq_f32(vt, vn, vln2_lo);
+    vq0 = vmlaq_f32(vbeta_0, vx20, vq0);
+    vq1 = vmlaq_f32(vbeta_0, vx21, vq1);
 
-    float32x4_t vp = vmulq_f32(vt, vc2);
-    vp = vmlsq_f32(vt, vp, vt);
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
 
-    const float32x4_t vy = vmlsq_f32(vs, vs, vp);
-    const float32x4_t vd = vaddq_f32(vy, vone);
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
 
-    float32x4_t vr = vrecpeq_f32(vd);
-    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
-    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
 
-    float32x4_t vf = vmulq_f32(vy, vr);
-    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
-    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
-    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+    const float32x4_t vy0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vy1 = vmulq_f32(vp1, vrq1);
 
-    vst1q_f32(output, vf); output += 4;
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
   }
-  if XNN_UNLIKELY(batch != 0) {
-    const float32x4_t vx = vld1q_f32(input);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    float32x4_t vx = vld1q_f32(input);
+    input += 4;
 
-    const float32x4_t vz = vabsq_f32(vx);
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
 
-    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
-    const int32x4_t ve = vshlq_n_s32(vreinterpretq_s32_f32(vn), 17);
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
 
-    const uint64x2_t vidx = vreinterpretq_u64_s32(vandq_s32(vreinterpretq_s32_f32(vn), vindex_mask));
-    const uint64_t vidx_lo = vgetq_lane_u64(vidx, 0);
-    const uint64_t vidx_hi = vgetq_lane_u64(vidx, 1);
-    float32x2_t vl_lo = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_lo]);
-    float32x2_t vl_hi = vld1_dup_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) vidx_hi]);
-    vl_lo = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_lo >> 32)], vl_lo, 1);
-    vl_hi = vld1_lane_f32(&xnn_table_exp2minus_k_over_64[(uint32_t) (vidx_hi >> 32)], vl_hi, 1);
-    const float32x4_t vl = vcombine_f32(vl_lo, vl_hi);
+    float32x4_t vp = vmlaq_f32(valpha_11, vx2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vx2, vp);
+    vp = vmlaq_f32(valpha_7, vx2, vp);
+    vp = vmlaq_f32(valpha_5, vx2, vp);
+    vp = vmlaq_f32(valpha_3, vx2, vp);
+    vp = vmlaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
 
-    const float32x4_t vs = vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(vl), ve));
-    vn = vsubq_f32(vn, vmagic_bias);
-    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
-    vt = vmlaq_f32(vt, vn, vln2_lo);
+    float32x4_t vq = vmlaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vx2, vq);
+    vq = vmlaq_f32(vbeta_0, vx2, vq);
 
-    float32x4_t vp = vmulq_f32(vt, vc2);
-    vp = vmlsq_f32(vt, vp, vt);
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
 
-    const float32x4_t vy = vmlsq_f32(vs, vs, vp);
-    const float32x4_t vd = vaddq_f32(vy, vone);
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    float32x4_t vx = vld1q_f32(input);
 
-    float32x4_t vr = vrecpeq_f32(vd);
-    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
-    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
 
-    float32x4_t vf = vmulq_f32(vy, vr);
-    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
-    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
-    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
 
-    float32x2_t vf_lo = vget_low_f32(vf);
+    float32x4_t vp = vmlaq_f32(valpha_11, vx2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vx2, vp);
+    vp = vmlaq_f32(valpha_7, vx2, vp);
+    vp = vmlaq_f32(valpha_5, vx2, vp);
+    vp = vmlaq_f32(valpha_3, vx2, vp);
+    vp = vmlaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vx2, vq);
+    vq = vmlaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
     if (batch & (2 * sizeof(float))) {
-      vst1_f32(output, vf_lo); output += 2;
-      vf_lo = vget_high_f32(vf);
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
     }
     if (batch & (1 * sizeof(float))) {
-      vst1_lane_f32(output, vf_lo, 0);
+      vst1_lane_f32(output, vy_lo, 0);
     }
   }
 }
@@ -9468,6 +11054,73 @@ void xnn_f32_vsqr_ukernel__neon_x8(
   }
 }
 
+void xnn_qc4_f32_embedding_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      // Extract the signed low and high nibbles with shifts and interleave them back into element order.
+      const int8x8_t vb = vld1_s8(i);
+      const int8x8x2_t vx = vzip_s8(vshr_n_s8(vshl_n_s8(vb, 4), 4), vshr_n_s8(vb, 4));
+      const int16x8_t vx_lo = vmovl_s8(vx.val[0]);
+      const int16x8_t vx_hi = vmovl_s8(vx.val[1]);
+
+      vacc0 = vmlaq_n_f32(vacc0, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx_lo))), vrow_scale);
+      vacc1 = vmlaq_n_f32(vacc1, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx_lo))), vrow_scale);
+      vacc2 = vmlaq_n_f32(vacc2, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx_hi))), vrow_scale);
+      vacc3 = vmlaq_n_f32(vacc3, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx_hi))), vrow_scale);
+    }
+    vst1q_f32(output, vmulq_f32(vacc0, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc1, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc2, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc3, vscale)); output += 4;
+    offset += 8;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (size_t c = 0; c < channels; c++) {
+    const uint32_t shift = (uint32_t) (c & 1) * 4;
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const uint8_t* i = (const uint8_t*) ((uintptr_t) table + index * table_stride + offset + (c >> 1));
+      const int32_t vx = math_asr_s32((int32_t) ((uint32_t) *i << (28 - shift)), 28);
+      vacc += (float) vx * row_scale[index];
+    }
+    *output++ = vacc * vscale_tail;
+  }
+}
+
 void xnn_qc8_dwconv_minmax_fp32_ukernel_25p16c__neon_mla8_ld64(
     size_t channels,
     size_t output_width,
@@ -11178,6 +12831,87 @@ void xnn_qc8_dwconv_minmax_fp32_ukernel_9p16c__neon_mla8_ld64(
   } while (--output_width != 0);
 }
 
+void xnn_qc8_f32_embedding_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      const int8x16_t vx = vld1q_s8(i);
+      const int16x8_t vx_lo = vmovl_s8(vget_low_s8(vx));
+      const int16x8_t vx_hi = vmovl_s8(vget_high_s8(vx));
+
+      vacc0 = vmlaq_n_f32(vacc0, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx_lo))), vrow_scale);
+      vacc1 = vmlaq_n_f32(vacc1, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx_lo))), vrow_scale);
+      vacc2 = vmlaq_n_f32(vacc2, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx_hi))), vrow_scale);
+      vacc3 = vmlaq_n_f32(vacc3, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx_hi))), vrow_scale);
+    }
+    vst1q_f32(output, vmulq_f32(vacc0, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc1, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc2, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc3, vscale)); output += 4;
+    offset += 16;
+  }
+  if (channels >= 8) {
+    float32x4_t vacc_lo = vmovq_n_f32(0.0f);
+    float32x4_t vacc_hi = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const float vrow_scale = row_scale[index];
+
+      const int16x8_t vx = vmovl_s8(vld1_s8(i));
+      vacc_lo = vmlaq_n_f32(vacc_lo, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx))), vrow_scale);
+      vacc_hi = vmlaq_n_f32(vacc_hi, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx))), vrow_scale);
+    }
+    vst1q_f32(output, vmulq_f32(vacc_lo, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc_hi, vscale)); output += 4;
+    offset += 8;
+    channels -= 8;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      vacc += (float) (int32_t) *i * row_scale[index];
+    }
+    *output++ = vacc * vscale_tail;
+    offset += 1;
+  }
+}
+
 void xnn_qc8_gemm_minmax_fp32_ukernel_1x8__neon_mlal_lane(
     size_t mr,
     size_t nc,
@@ -12481,6 +14215,392 @@ void xnn_qc8_igemm_minmax_fp32_ukernel_2x8c2s4__neon_mlal(
   } while (nc != 0);
 }
 
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x8c8__neon_mull(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const float32x4_t vinput_scale0 = vld1q_dup_f32(&quantization_params[0].scale);
+  const float32x4_t voutput_min = vld1q_dup_f32(&params->scalar.min);
+  const float32x4_t voutput_max = vld1q_dup_f32(&params->scalar.max);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    const int32_t vksum4 = ((const int32_t*) w)[4];
+    const int32_t vksum5 = ((const int32_t*) w)[5];
+    const int32_t vksum6 = ((const int32_t*) w)[6];
+    const int32_t vksum7 = ((const int32_t*) w)[7];
+    int32x4_t vacc0x0 = vsetq_lane_s32(vksum0 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x1 = vsetq_lane_s32(vksum1 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x2 = vsetq_lane_s32(vksum2 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x3 = vsetq_lane_s32(vksum3 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x4 = vsetq_lane_s32(vksum4 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x5 = vsetq_lane_s32(vksum5 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x6 = vsetq_lane_s32(vksum6 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x7 = vsetq_lane_s32(vksum7 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    w = (const void*) ((const int32_t*) w + 8);
+
+    size_t k = kc;
+    while (k != 0) {
+      const int8x8_t va0 = vld1_s8(a0); a0 += 8;
+
+      const int8x8_t vb0 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x0 = vmull_s8(vb0, va0);
+      vacc0x0 = vpadalq_s16(vacc0x0, vprod0x0);
+      const int8x8_t vb1 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x1 = vmull_s8(vb1, va0);
+      vacc0x1 = vpadalq_s16(vacc0x1, vprod0x1);
+      const int8x8_t vb2 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x2 = vmull_s8(vb2, va0);
+      vacc0x2 = vpadalq_s16(vacc0x2, vprod0x2);
+      const int8x8_t vb3 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x3 = vmull_s8(vb3, va0);
+      vacc0x3 = vpadalq_s16(vacc0x3, vprod0x3);
+      const int8x8_t vb4 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x4 = vmull_s8(vb4, va0);
+      vacc0x4 = vpadalq_s16(vacc0x4, vprod0x4);
+      const int8x8_t vb5 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x5 = vmull_s8(vb5, va0);
+      vacc0x5 = vpadalq_s16(vacc0x5, vprod0x5);
+      const int8x8_t vb6 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x6 = vmull_s8(vb6, va0);
+      vacc0x6 = vpadalq_s16(vacc0x6, vprod0x6);
+      const int8x8_t vb7 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x7 = vmull_s8(vb7, va0);
+      vacc0x7 = vpadalq_s16(vacc0x7, vprod0x7);
+
+      k -= 8 * sizeof(int8_t);
+    }
+
+#if XNN_ARCH_ARM64
+    const int32x4_t vsum0x01 = vpaddq_s32(vacc0x0, vacc0x1);
+    const int32x4_t vsum0x23 = vpaddq_s32(vacc0x2, vacc0x3);
+    const int32x4_t vsum0x45 = vpaddq_s32(vacc0x4, vacc0x5);
+    const int32x4_t vsum0x67 = vpaddq_s32(vacc0x6, vacc0x7);
+
+    int32x4_t vacc0x0123 = vpaddq_s32(vsum0x01, vsum0x23);
+    int32x4_t vacc0x4567 = vpaddq_s32(vsum0x45, vsum0x67);
+#else
+    const int32x2_t vpsum0x0 = vadd_s32(vget_low_s32(vacc0x0), vget_high_s32(vacc0x0));
+    const int32x2_t vpsum0x1 = vadd_s32(vget_low_s32(vacc0x1), vget_high_s32(vacc0x1));
+    const int32x2_t vpsum0x2 = vadd_s32(vget_low_s32(vacc0x2), vget_high_s32(vacc0x2));
+    const int32x2_t vpsum0x3 = vadd_s32(vget_low_s32(vacc0x3), vget_high_s32(vacc0x3));
+    const int32x2_t vsum0x01 = vpadd_s32(vpsum0x0, vpsum0x1);
+    const int32x2_t vsum0x23 = vpadd_s32(vpsum0x2, vpsum0x3);
+    int32x4_t vacc0x0123 = vcombine_s32(vsum0x01, vsum0x23);
+    const int32x2_t vpsum0x4 = vadd_s32(vget_low_s32(vacc0x4), vget_high_s32(vacc0x4));
+    const int32x2_t vpsum0x5 = vadd_s32(vget_low_s32(vacc0x5), vget_high_s32(vacc0x5));
+    const int32x2_t vpsum0x6 = vadd_s32(vget_low_s32(vacc0x6), vget_high_s32(vacc0x6));
+    const int32x2_t vpsum0x7 = vadd_s32(vget_low_s32(vacc0x7), vget_high_s32(vacc0x7));
+    const int32x2_t vsum0x45 = vpadd_s32(vpsum0x4, vpsum0x5);
+    const int32x2_t vsum0x67 = vpadd_s32(vpsum0x6, vpsum0x7);
+    int32x4_t vacc0x4567 = vcombine_s32(vsum0x45, vsum0x67);
+#endif
+
+    float32x4_t vout0x0123 = vmulq_f32(vcvtq_f32_s32(vacc0x0123), vinput_scale0);
+    float32x4_t vout0x4567 = vmulq_f32(vcvtq_f32_s32(vacc0x4567), vinput_scale0);
+
+    const float32x4_t vfilter_scale0123 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x0123 = vmulq_f32(vout0x0123, vfilter_scale0123);
+    const float32x4_t vfilter_scale4567 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x4567 = vmulq_f32(vout0x4567, vfilter_scale4567);
+    const float32x4_t vbias0123 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x0123 = vaddq_f32(vout0x0123, vbias0123);
+    const float32x4_t vbias4567 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x4567 = vaddq_f32(vout0x4567, vbias4567);
+
+    vout0x0123 = vmaxq_f32(vout0x0123, voutput_min);
+    vout0x4567 = vmaxq_f32(vout0x4567, voutput_min);
+
+    vout0x0123 = vminq_f32(vout0x0123, voutput_max);
+    vout0x4567 = vminq_f32(vout0x4567, voutput_max);
+
+    if XNN_LIKELY(nc >= 8) {
+      vst1q_f32(c0, vout0x0123);
+      vst1q_f32(c0 + 4, vout0x4567);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        vst1q_f32(c0, vout0x0123); c0 += 4;
+
+        vout0x0123 = vout0x4567;
+      }
+      float32x2_t vout0x01 = vget_low_f32(vout0x0123);
+      if (nc & 2) {
+        vst1_f32(c0, vout0x01); c0 += 2;
+
+        vout0x01 = vget_high_f32(vout0x0123);
+      }
+      if (nc & 1) {
+        vst1_lane_f32(c0, vout0x01, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_2x8c8__neon_mull(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 2);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+
+  // Rows beyond mr alias the previous row, so their quantization parameters must alias as well.
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const float32x4_t vinput_scale0 = vld1q_dup_f32(&quantization_params[0].scale);
+  const int32_t vinput_zero_point1 = quantization_params[min(mr - 1, 1)].zero_point;
+  const float32x4_t vinput_scale1 = vld1q_dup_f32(&quantization_params[min(mr - 1, 1)].scale);
+  const float32x4_t voutput_min = vld1q_dup_f32(&params->scalar.min);
+  const float32x4_t voutput_max = vld1q_dup_f32(&params->scalar.max);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    const int32_t vksum4 = ((const int32_t*) w)[4];
+    const int32_t vksum5 = ((const int32_t*) w)[5];
+    const int32_t vksum6 = ((const int32_t*) w)[6];
+    const int32_t vksum7 = ((const int32_t*) w)[7];
+    int32x4_t vacc0x0 = vsetq_lane_s32(vksum0 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x1 = vsetq_lane_s32(vksum1 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x2 = vsetq_lane_s32(vksum2 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x3 = vsetq_lane_s32(vksum3 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x4 = vsetq_lane_s32(vksum4 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x5 = vsetq_lane_s32(vksum5 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x6 = vsetq_lane_s32(vksum6 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x7 = vsetq_lane_s32(vksum7 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x0 = vsetq_lane_s32(vksum0 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x1 = vsetq_lane_s32(vksum1 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x2 = vsetq_lane_s32(vksum2 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x3 = vsetq_lane_s32(vksum3 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x4 = vsetq_lane_s32(vksum4 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x5 = vsetq_lane_s32(vksum5 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x6 = vsetq_lane_s32(vksum6 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    int32x4_t vacc1x7 = vsetq_lane_s32(vksum7 * vinput_zero_point1, vmovq_n_s32(0), 0);
+    w = (const void*) ((const int32_t*) w + 8);
+
+    size_t k = kc;
+    while (k != 0) {
+      const int8x8_t va0 = vld1_s8(a0); a0 += 8;
+      const int8x8_t va1 = vld1_s8(a1); a1 += 8;
+
+      const int8x8_t vb0 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x0 = vmull_s8(vb0, va0);
+      const int16x8_t vprod1x0 = vmull_s8(vb0, va1);
+      vacc0x0 = vpadalq_s16(vacc0x0, vprod0x0);
+      vacc1x0 = vpadalq_s16(vacc1x0, vprod1x0);
+      const int8x8_t vb1 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x1 = vmull_s8(vb1, va0);
+      const int16x8_t vprod1x1 = vmull_s8(vb1, va1);
+      vacc0x1 = vpadalq_s16(vacc0x1, vprod0x1);
+      vacc1x1 = vpadalq_s16(vacc1x1, vprod1x1);
+      const int8x8_t vb2 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x2 = vmull_s8(vb2, va0);
+      const int16x8_t vprod1x2 = vmull_s8(vb2, va1);
+      vacc0x2 = vpadalq_s16(vacc0x2, vprod0x2);
+      vacc1x2 = vpadalq_s16(vacc1x2, vprod1x2);
+      const int8x8_t vb3 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x3 = vmull_s8(vb3, va0);
+      const int16x8_t vprod1x3 = vmull_s8(vb3, va1);
+      vacc0x3 = vpadalq_s16(vacc0x3, vprod0x3);
+      vacc1x3 = vpadalq_s16(vacc1x3, vprod1x3);
+      const int8x8_t vb4 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x4 = vmull_s8(vb4, va0);
+      const int16x8_t vprod1x4 = vmull_s8(vb4, va1);
+      vacc0x4 = vpadalq_s16(vacc0x4, vprod0x4);
+      vacc1x4 = vpadalq_s16(vacc1x4, vprod1x4);
+      const int8x8_t vb5 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x5 = vmull_s8(vb5, va0);
+      const int16x8_t vprod1x5 = vmull_s8(vb5, va1);
+      vacc0x5 = vpadalq_s16(vacc0x5, vprod0x5);
+      vacc1x5 = vpadalq_s16(vacc1x5, vprod1x5);
+      const int8x8_t vb6 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x6 = vmull_s8(vb6, va0);
+      const int16x8_t vprod1x6 = vmull_s8(vb6, va1);
+      vacc0x6 = vpadalq_s16(vacc0x6, vprod0x6);
+      vacc1x6 = vpadalq_s16(vacc1x6, vprod1x6);
+      const int8x8_t vb7 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x7 = vmull_s8(vb7, va0);
+      const int16x8_t vprod1x7 = vmull_s8(vb7, va1);
+      vacc0x7 = vpadalq_s16(vacc0x7, vprod0x7);
+      vacc1x7 = vpadalq_s16(vacc1x7, vprod1x7);
+
+      k -= 8 * sizeof(int8_t);
+    }
+
+#if XNN_ARCH_ARM64
+    const int32x4_t vsum0x01 = vpaddq_s32(vacc0x0, vacc0x1);
+    const int32x4_t vsum0x23 = vpaddq_s32(vacc0x2, vacc0x3);
+    const int32x4_t vsum0x45 = vpaddq_s32(vacc0x4, vacc0x5);
+    const int32x4_t vsum0x67 = vpaddq_s32(vacc0x6, vacc0x7);
+    const int32x4_t vsum1x01 = vpaddq_s32(vacc1x0, vacc1x1);
+    const int32x4_t vsum1x23 = vpaddq_s32(vacc1x2, vacc1x3);
+    const int32x4_t vsum1x45 = vpaddq_s32(vacc1x4, vacc1x5);
+    const int32x4_t vsum1x67 = vpaddq_s32(vacc1x6, vacc1x7);
+
+    int32x4_t vacc0x0123 = vpaddq_s32(vsum0x01, vsum0x23);
+    int32x4_t vacc0x4567 = vpaddq_s32(vsum0x45, vsum0x67);
+    int32x4_t vacc1x0123 = vpaddq_s32(vsum1x01, vsum1x23);
+    int32x4_t vacc1x4567 = vpaddq_s32(vsum1x45, vsum1x67);
+#else
+    const int32x2_t vpsum0x0 = vadd_s32(vget_low_s32(vacc0x0), vget_high_s32(vacc0x0));
+    const int32x2_t vpsum0x1 = vadd_s32(vget_low_s32(vacc0x1), vget_high_s32(vacc0x1));
+    const int32x2_t vpsum0x2 = vadd_s32(vget_low_s32(vacc0x2), vget_high_s32(vacc0x2));
+    const int32x2_t vpsum0x3 = vadd_s32(vget_low_s32(vacc0x3), vget_high_s32(vacc0x3));
+    const int32x2_t vsum0x01 = vpadd_s32(vpsum0x0, vpsum0x1);
+    const int32x2_t vsum0x23 = vpadd_s32(vpsum0x2, vpsum0x3);
+    int32x4_t vacc0x0123 = vcombine_s32(vsum0x01, vsum0x23);
+    const int32x2_t vpsum0x4 = vadd_s32(vget_low_s32(vacc0x4), vget_high_s32(vacc0x4));
+    const int32x2_t vpsum0x5 = vadd_s32(vget_low_s32(vacc0x5), vget_high_s32(vacc0x5));
+    const int32x2_t vpsum0x6 = vadd_s32(vget_low_s32(vacc0x6), vget_high_s32(vacc0x6));
+    const int32x2_t vpsum0x7 = vadd_s32(vget_low_s32(vacc0x7), vget_high_s32(vacc0x7));
+    const int32x2_t vsum0x45 = vpadd_s32(vpsum0x4, vpsum0x5);
+    const int32x2_t vsum0x67 = vpadd_s32(vpsum0x6, vpsum0x7);
+    int32x4_t vacc0x4567 = vcombine_s32(vsum0x45, vsum0x67);
+    const int32x2_t vpsum1x0 = vadd_s32(vget_low_s32(vacc1x0), vget_high_s32(vacc1x0));
+    const int32x2_t vpsum1x1 = vadd_s32(vget_low_s32(vacc1x1), vget_high_s32(vacc1x1));
+    const int32x2_t vpsum1x2 = vadd_s32(vget_low_s32(vacc1x2), vget_high_s32(vacc1x2));
+    const int32x2_t vpsum1x3 = vadd_s32(vget_low_s32(vacc1x3), vget_high_s32(vacc1x3));
+    const int32x2_t vsum1x01 = vpadd_s32(vpsum1x0, vpsum1x1);
+    const int32x2_t vsum1x23 = vpadd_s32(vpsum1x2, vpsum1x3);
+    int32x4_t vacc1x0123 = vcombine_s32(vsum1x01, vsum1x23);
+    const int32x2_t vpsum1x4 = vadd_s32(vget_low_s32(vacc1x4), vget_high_s32(vacc1x4));
+    const int32x2_t vpsum1x5 = vadd_s32(vget_low_s32(vacc1x5), vget_high_s32(vacc1x5));
+    const int32x2_t vpsum1x6 = vadd_s32(vget_low_s32(vacc1x6), vget_high_s32(vacc1x6));
+    const int32x2_t vpsum1x7 = vadd_s32(vget_low_s32(vacc1x7), vget_high_s32(vacc1x7));
+    const int32x2_t vsum1x45 = vpadd_s32(vpsum1x4, vpsum1x5);
+    const int32x2_t vsum1x67 = vpadd_s32(vpsum1x6, vpsum1x7);
+    int32x4_t vacc1x4567 = vcombine_s32(vsum1x45, vsum1x67);
+#endif
+
+    float32x4_t vout0x0123 = vmulq_f32(vcvtq_f32_s32(vacc0x0123), vinput_scale0);
+    float32x4_t vout0x4567 = vmulq_f32(vcvtq_f32_s32(vacc0x4567), vinput_scale0);
+    float32x4_t vout1x0123 = vmulq_f32(vcvtq_f32_s32(vacc1x0123), vinput_scale1);
+    float32x4_t vout1x4567 = vmulq_f32(vcvtq_f32_s32(vacc1x4567), vinput_scale1);
+
+    const float32x4_t vfilter_scale0123 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x0123 = vmulq_f32(vout0x0123, vfilter_scale0123);
+    vout1x0123 = vmulq_f32(vout1x0123, vfilter_scale0123);
+    const float32x4_t vfilter_scale4567 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x4567 = vmulq_f32(vout0x4567, vfilter_scale4567);
+    vout1x4567 = vmulq_f32(vout1x4567, vfilter_scale4567);
+    const float32x4_t vbias0123 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x0123 = vaddq_f32(vout0x0123, vbias0123);
+    vout1x0123 = vaddq_f32(vout1x0123, vbias0123);
+    const float32x4_t vbias4567 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x4567 = vaddq_f32(vout0x4567, vbias4567);
+    vout1x4567 = vaddq_f32(vout1x4567, vbias4567);
+
+    vout0x0123 = vmaxq_f32(vout0x0123, voutput_min);
+    vout0x4567 = vmaxq_f32(vout0x4567, voutput_min);
+    vout1x0123 = vmaxq_f32(vout1x0123, voutput_min);
+    vout1x4567 = vmaxq_f32(vout1x4567, voutput_min);
+
+    vout0x0123 = vminq_f32(vout0x0123, voutput_max);
+    vout0x4567 = vminq_f32(vout0x4567, voutput_max);
+    vout1x0123 = vminq_f32(vout1x0123, voutput_max);
+    vout1x4567 = vminq_f32(vout1x4567, voutput_max);
+
+    if XNN_LIKELY(nc >= 8) {
+      vst1q_f32(c0, vout0x0123);
+      vst1q_f32(c0 + 4, vout0x4567);
+      vst1q_f32(c1, vout1x0123);
+      vst1q_f32(c1 + 4, vout1x4567);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const int8_t*) ((uintptr_t) a1 - kc);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        vst1q_f32(c0, vout0x0123); c0 += 4;
+        vst1q_f32(c1, vout1x0123); c1 += 4;
+
+        vout0x0123 = vout0x4567;
+        vout1x0123 = vout1x4567;
+      }
+      float32x2_t vout0x01 = vget_low_f32(vout0x0123);
+      float32x2_t vout1x01 = vget_low_f32(vout1x0123);
+      if (nc & 2) {
+        vst1_f32(c0, vout0x01); c0 += 2;
+        vst1_f32(c1, vout1x01); c1 += 2;
+
+        vout0x01 = vget_high_f32(vout0x0123);
+        vout1x01 = vget_high_f32(vout1x0123);
+      }
+      if (nc & 1) {
+        vst1_lane_f32(c0, vout0x01, 0);
+        vst1_lane_f32(c1, vout1x01, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_qs8_dwconv_minmax_rndnu_ukernel_25p16c__neon_mla8_ld64(
     size_t channels,
     size_t output_width,
@@ -16343,6 +18463,118 @@ void xnn_qs8_igemm_minmax_rndnu_ukernel_2x8c2s4__neon_mlal(
   } while (nc != 0);
 }
 
+void xnn_qs8_rnorm_ukernel__neon_x16(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const int8x8_t vinput_zero_point8 = vdup_n_s8((int8_t) vinput_zero_point);
+
+  // Statistics are exact: they are accumulated on zero-point-adjusted integers. The 32-bit sums of squares are
+  // flushed into 64-bit accumulators every 4096 iterations, before they could overflow.
+  const int8_t* i = input;
+  int64_t vsum = 0;
+  int64_t vsumsq = 0;
+  size_t c = channels;
+  while (c >= 16) {
+    int32x4_t vacc_sum = vmovq_n_s32(0);
+    int32x4_t vacc_sumsq = vmovq_n_s32(0);
+    size_t block = min(c >> 4, 4096);
+    c -= block << 4;
+    do {
+      const int8x16_t vx = vld1q_s8(i); i += 16;
+
+      const int16x8_t vd_lo = vsubl_s8(vget_low_s8(vx), vinput_zero_point8);
+      const int16x8_t vd_hi = vsubl_s8(vget_high_s8(vx), vinput_zero_point8);
+
+      vacc_sum = vpadalq_s16(vacc_sum, vaddq_s16(vd_lo, vd_hi));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_low_s16(vd_lo), vget_low_s16(vd_lo));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_high_s16(vd_lo), vget_high_s16(vd_lo));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_low_s16(vd_hi), vget_low_s16(vd_hi));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_high_s16(vd_hi), vget_high_s16(vd_hi));
+    } while (--block != 0);
+
+    const int64x2_t vsum2 = vpaddlq_s32(vacc_sum);
+    const uint64x2_t vsumsq2 = vpaddlq_u32(vreinterpretq_u32_s32(vacc_sumsq));
+    vsum += vgetq_lane_s64(vsum2, 0) + vgetq_lane_s64(vsum2, 1);
+    vsumsq += (int64_t) (vgetq_lane_u64(vsumsq2, 0) + vgetq_lane_u64(vsumsq2, 1));
+  }
+  for (; c != 0; c -= 1) {
+    const int32_t vd = (int32_t) *i++ - vinput_zero_point;
+    vsum += (int64_t) vd;
+    vsumsq += (int64_t) (vd * vd);
+  }
+
+  const float vinv_n = 1.0f / (float) channels;
+  float vmean = 0.0f;
+  float vvar = (float) vsumsq * vinv_n;
+  if (params->scalar.subtract_mean) {
+    // n^2 * variance = n * sum(d^2) - sum(d)^2 is computed exactly in 64-bit integers.
+    const int64_t vscaled_var = (int64_t) channels * vsumsq - vsum * vsum;
+    vmean = (float) vsum * vinv_n;
+    vvar = (float) vscaled_var * (vinv_n * vinv_n);
+  }
+  const float vscale = params->scalar.inv_output_scale / sqrtf(vvar + params->scalar.epsilon);
+
+  const float32x4_t vmean4 = vdupq_n_f32(vmean);
+  const float32x4_t vscale4 = vdupq_n_f32(vscale);
+  const float32x4_t voutput_min_less_zero_point = vdupq_n_f32(params->scalar.output_min_less_zero_point);
+  const float32x4_t voutput_max_less_zero_point = vdupq_n_f32(params->scalar.output_max_less_zero_point);
+  const float32x4_t vmagic_bias = vdupq_n_f32(params->scalar.magic_bias);
+  const int32x4_t vmagic_bias_less_output_zero_point = vdupq_n_s32(params->scalar.magic_bias_less_output_zero_point);
+  const float* gamma = weights;
+  const float* beta = weights + channels;
+  i = input;
+  int8_t* o = output;
+  for (c = channels; c >= 8; c -= 8) {
+    const int16x8_t vd = vsubl_s8(vld1_s8(i), vinput_zero_point8); i += 8;
+
+    const float32x4_t vgamma0 = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vgamma1 = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vbeta0 = vld1q_f32(beta); beta += 4;
+    const float32x4_t vbeta1 = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vd0 = vsubq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vd))), vmean4);
+    const float32x4_t vd1 = vsubq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vd))), vmean4);
+
+    float32x4_t vy0 = vmlaq_f32(vbeta0, vd0, vmulq_f32(vgamma0, vscale4));
+    float32x4_t vy1 = vmlaq_f32(vbeta1, vd1, vmulq_f32(vgamma1, vscale4));
+
+    vy0 = vmaxq_f32(vy0, voutput_min_less_zero_point);
+    vy1 = vmaxq_f32(vy1, voutput_min_less_zero_point);
+    vy0 = vminq_f32(vy0, voutput_max_less_zero_point);
+    vy1 = vminq_f32(vy1, voutput_max_less_zero_point);
+
+    const int32x4_t vq0 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy0, vmagic_bias)), vmagic_bias_less_output_zero_point);
+    const int32x4_t vq1 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy1, vmagic_bias)), vmagic_bias_less_output_zero_point);
+
+    const int8x8_t vy = vmovn_s16(vcombine_s16(vmovn_s32(vq0), vmovn_s32(vq1)));
+    vst1_s8(o, vy); o += 8;
+  }
+  if XNN_UNLIKELY(c != 0) {
+    const float voutput_min = params->scalar.output_min_less_zero_point;
+    const float voutput_max = params->scalar.output_max_less_zero_point;
+    const float vmagic = params->scalar.magic_bias;
+    const int32_t vmagic_less_zero_point = params->scalar.magic_bias_less_output_zero_point;
+    do {
+      const float vd = (float) ((int32_t) *i++ - vinput_zero_point) - vmean;
+      float vy = vd * (*gamma++ * vscale) + *beta++;
+      vy = math_max_f32(vy, voutput_min);
+      vy = math_min_f32(vy, voutput_max);
+      vy += vmagic;
+      *o++ = (int8_t) ((int32_t) float_as_uint32(vy) - vmagic_less_zero_point);
+    } while (--c != 0);
+  }
+}
+
 void xnn_qs8_vadd_minmax_ukernel__neon_ld64_x16(
     size_t batch,
     const int8_t* input_a,
@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <arm_neon.h>
 
@@ -3818,6 +3819,175 @@ void xnn_f32_spmm_minmax_ukernel_32x1__neonfma_pipelined(
   }
 }
 
+void xnn_f32_vapproxgelu_ukernel__aarch64_neonfma_rational_13_6_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vc3 = vmovq_n_f32(0x1.2444F2p-5f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.988454p-1f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vu0 = vfmaq_f32(vc1, vx20, vc3);
+    float32x4_t vu1 = vfmaq_f32(vc1, vx21, vc3);
+
+    vu0 = vmulq_f32(vx0, vu0);
+    vu1 = vmulq_f32(vx1, vu1);
+
+    vu0 = vmaxq_f32(vu0, vneg_sat_cutoff);
+    vu1 = vmaxq_f32(vu1, vneg_sat_cutoff);
+
+    vu0 = vminq_f32(vu0, vsat_cutoff);
+    vu1 = vminq_f32(vu1, vsat_cutoff);
+
+    const float32x4_t vu20 = vmulq_f32(vu0, vu0);
+    const float32x4_t vu21 = vmulq_f32(vu1, vu1);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vu20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vu21, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vu21, vp1);
+
+    vp0 = vfmaq_f32(valpha_7, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vu21, vp1);
+
+    vp0 = vfmaq_f32(valpha_5, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vu21, vp1);
+
+    vp0 = vfmaq_f32(valpha_3, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vu21, vp1);
+
+    vp0 = vfmaq_f32(valpha_1, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vu21, vp1);
+
+    vp0 = vmulq_f32(vu0, vp0);
+    vp1 = vmulq_f32(vu1, vp1);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_4, vu20, vbeta_6);
+    float32x4_t vq1 = vfmaq_f32(vbeta_4, vu21, vbeta_6);
+
+    vq0 = vfmaq_f32(vbeta_2, vu20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vu21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_0, vu20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vu21, vq1);
+
+    const float32x4_t vt0 = vdivq_f32(vp0, vq0);
+    const float32x4_t vt1 = vdivq_f32(vp1, vq1);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+
+    const float32x4_t vy0 = vfmaq_f32(vhalfx0, vhalfx0, vt0);
+    const float32x4_t vy1 = vfmaq_f32(vhalfx1, vhalfx1, vt1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vfmaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vu2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vu2, vp);
+    vp = vfmaq_f32(valpha_7, vu2, vp);
+    vp = vfmaq_f32(valpha_5, vu2, vp);
+    vp = vfmaq_f32(valpha_3, vu2, vp);
+    vp = vfmaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vu2, vq);
+    vq = vfmaq_f32(vbeta_0, vu2, vq);
+
+    const float32x4_t vt = vdivq_f32(vp, vq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, vt);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vfmaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vu2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vu2, vp);
+    vp = vfmaq_f32(valpha_7, vu2, vp);
+    vp = vfmaq_f32(valpha_5, vu2, vp);
+    vp = vfmaq_f32(valpha_3, vu2, vp);
+    vp = vfmaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vu2, vq);
+    vq = vfmaq_f32(vbeta_0, vu2, vq);
+
+    const float32x4_t vt = vdivq_f32(vp, vq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, vt);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
 extern XNN_INTERNAL const int32_t xnn_table_exp2minus_k_over_16[16];
 
 void xnn_f32_velu_ukernel__neonfma_rr1_lut16_p3_x16(
@@ -4185,6 +4355,329 @@ void xnn_f32_velu_ukernel__neonfma_rr1_p6_x8(
   }
 }
 
+void xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const float32x4_t vzero_cutoff = vmovq_n_f32(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const float32x4_t vinf_cutoff = vmovq_n_f32(0x1.62E42Ep+6f);
+  const float32x4_t vlog2e = vmovq_n_f32(0x1.715476p+0f);
+  const float32x4_t vminus_ln2_hi = vmovq_n_f32(-0x1.62E400p-1f);
+  const float32x4_t vminus_ln2_lo = vmovq_n_f32(-0x1.7F7D1Cp-20f);
+  const float32x4_t vplus_inf = vmovq_n_f32(INFINITY);
+  const float32x4_t vc5 = vmovq_n_f32(0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.FFFFF6p-1f);
+  const int32x4_t vmin_exponent = vmovq_n_s32(-INT32_C(0x3F000000));
+  const int32x4_t vmax_exponent = vmovq_n_s32(INT32_C(0x3F800000));
+  const int32x4_t vdefault_exponent = vmax_exponent;
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    float32x4_t vn0 = vfmaq_f32(vmagic_bias, vx0, vlog2e);
+    float32x4_t vn1 = vfmaq_f32(vmagic_bias, vx1, vlog2e);
+
+    int32x4_t veo0 = vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23);
+    int32x4_t veo1 = vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23);
+
+    int32x4_t ven0 = vmaxq_s32(veo0, vmin_exponent);
+    int32x4_t ven1 = vmaxq_s32(veo1, vmin_exponent);
+
+    ven0 = vminq_s32(ven0, vmax_exponent);
+    ven1 = vminq_s32(ven1, vmax_exponent);
+
+    veo0 = vsubq_s32(veo0, ven0);
+    veo1 = vsubq_s32(veo1, ven1);
+
+    const float32x4_t vsn0 = vreinterpretq_f32_s32(vaddq_s32(ven0, vdefault_exponent));
+    const float32x4_t vsn1 = vreinterpretq_f32_s32(vaddq_s32(ven1, vdefault_exponent));
+
+    const float32x4_t vso0 = vreinterpretq_f32_s32(vaddq_s32(veo0, vdefault_exponent));
+    const float32x4_t vso1 = vreinterpretq_f32_s32(vaddq_s32(veo1, vdefault_exponent));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+
+    float32x4_t vt0 = vfmaq_f32(vx0, vn0, vminus_ln2_hi);
+    float32x4_t vt1 = vfmaq_f32(vx1, vn1, vminus_ln2_hi);
+
+    vt0 = vfmaq_f32(vt0, vn0, vminus_ln2_lo);
+    vt1 = vfmaq_f32(vt1, vn1, vminus_ln2_lo);
+
+    float32x4_t vp0 = vfmaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vfmaq_f32(vc4, vc5, vt1);
+
+    vp0 = vfmaq_f32(vc3, vp0, vt0);
+    vp1 = vfmaq_f32(vc3, vp1, vt1);
+
+    vp0 = vfmaq_f32(vc2, vp0, vt0);
+    vp1 = vfmaq_f32(vc2, vp1, vt1);
+
+    vp0 = vfmaq_f32(vc1, vp0, vt0);
+    vp1 = vfmaq_f32(vc1, vp1, vt1);
+
+    vt0 = vmulq_f32(vt0, vso0);
+    vt1 = vmulq_f32(vt1, vso1);
+
+    float32x4_t vy0 = vmulq_f32(vsn0, vfmaq_f32(vso0, vt0, vp0));
+    float32x4_t vy1 = vmulq_f32(vsn1, vfmaq_f32(vso1, vt1, vp1));
+
+    vy0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy0), vcltq_f32(vx0, vzero_cutoff)));
+    vy1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy1), vcltq_f32(vx1, vzero_cutoff)));
+
+    vy0 = vbslq_f32(vcgtq_f32(vx0, vinf_cutoff), vplus_inf, vy0);
+    vy1 = vbslq_f32(vcgtq_f32(vx1, vinf_cutoff), vplus_inf, vy1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vfmaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vfmaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vfmaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vfmaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
+void xnn_f32_vgelu_ukernel__aarch64_neonfma_rational_13_8_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vsqrt1_2 = vmovq_n_f32(0x1.6A09E6p-1f);
+  const float32x4_t vneg_erf_cutoff = vmovq_n_f32(-0x1.000000p+2f);
+  const float32x4_t verf_cutoff = vmovq_n_f32(0x1.000000p+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.2BBE16p-32f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.DBFFDCp-26f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.19FEA2p-19f);
+  const float32x4_t valpha_7 = vmovq_n_f32(-0x1.DD85A4p-15f);
+  const float32x4_t valpha_5 = vmovq_n_f32(-0x1.8158C6p-11f);
+  const float32x4_t valpha_3 = vmovq_n_f32(-0x1.8343ECp-9f);
+  const float32x4_t valpha_1 = vmovq_n_f32(-0x1.07B7A8p-6f);
+  const float32x4_t vbeta_8 = vmovq_n_f32(-0x1.E8C19Ap-17f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(-0x1.BF7A52p-13f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(-0x1.B9249Cp-10f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(-0x1.E337F0p-8f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(-0x1.D36D4Ep-7f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    float32x4_t vz0 = vmulq_f32(vx0, vsqrt1_2);
+    float32x4_t vz1 = vmulq_f32(vx1, vsqrt1_2);
+
+    vz0 = vmaxq_f32(vz0, vneg_erf_cutoff);
+    vz1 = vmaxq_f32(vz1, vneg_erf_cutoff);
+
+    vz0 = vminq_f32(vz0, verf_cutoff);
+    vz1 = vminq_f32(vz1, verf_cutoff);
+
+    const float32x4_t vz20 = vmulq_f32(vz0, vz0);
+    const float32x4_t vz21 = vmulq_f32(vz1, vz1);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vz20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vz21, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_7, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_5, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_3, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_1, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vz21, vp1);
+
+    vp0 = vmulq_f32(vz0, vp0);
+    vp1 = vmulq_f32(vz1, vp1);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_6, vz20, vbeta_8);
+    float32x4_t vq1 = vfmaq_f32(vbeta_6, vz21, vbeta_8);
+
+    vq0 = vfmaq_f32(vbeta_4, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_4, vz21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_2, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vz21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_0, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vz21, vq1);
+
+    const float32x4_t verf0 = vdivq_f32(vp0, vq0);
+    const float32x4_t verf1 = vdivq_f32(vp1, vq1);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+
+    const float32x4_t vy0 = vfmaq_f32(vhalfx0, vhalfx0, verf0);
+    const float32x4_t vy1 = vfmaq_f32(vhalfx1, vhalfx1, verf1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vz2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vz2, vp);
+    vp = vfmaq_f32(valpha_7, vz2, vp);
+    vp = vfmaq_f32(valpha_5, vz2, vp);
+    vp = vfmaq_f32(valpha_3, vz2, vp);
+    vp = vfmaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vfmaq_f32(vbeta_4, vz2, vq);
+    vq = vfmaq_f32(vbeta_2, vz2, vq);
+    vq = vfmaq_f32(vbeta_0, vz2, vq);
+
+    const float32x4_t verf = vdivq_f32(vp, vq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vz2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vz2, vp);
+    vp = vfmaq_f32(valpha_7, vz2, vp);
+    vp = vfmaq_f32(valpha_5, vz2, vp);
+    vp = vfmaq_f32(valpha_3, vz2, vp);
+    vp = vfmaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vfmaq_f32(vbeta_4, vz2, vq);
+    vq = vfmaq_f32(vbeta_2, vz2, vq);
+    vq = vfmaq_f32(vbeta_0, vz2, vq);
+
+    const float32x4_t verf = vdivq_f32(vp, vq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
 void xnn_f32_vmulcaddc_minmax_ukernel_c4__neonfma_2x(
     size_t rows,
     size_t channels,
@@ -4515,3 +5008,295 @@ void xnn_f32_vsigmoid_ukernel__neonfma_rr1_lut64_p2_nr2recps_x16(
     }
   }
 }
+
+void xnn_f32_vsilu_ukernel__aarch64_neonfma_rr2_p5_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.8000FEp23f);
+  const float32x4_t vminus_log2e = vmovq_n_f32(-0x1.715476p0f);
+  const float32x4_t vln2_hi = vmovq_n_f32(0x1.62E400p-1f);
+  const float32x4_t vln2_lo = vmovq_n_f32(0x1.7F7D1Cp-20f);
+  const float32x4_t vc5 = vmovq_n_f32(-0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(-0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(-0x1.FFFFF6p-1f);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vdenorm_cutoff = vmovq_n_f32(0x1.5D589Ep+6f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    const float32x4_t vz0 = vabsq_f32(vx0);
+    const float32x4_t vz1 = vabsq_f32(vx1);
+
+    float32x4_t vn0 = vfmaq_f32(vmagic_bias, vz0, vminus_log2e);
+    float32x4_t vn1 = vfmaq_f32(vmagic_bias, vz1, vminus_log2e);
+
+    const float32x4_t vs0 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23));
+    const float32x4_t vs1 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+
+    float32x4_t vt0 = vfmaq_f32(vz0, vn0, vln2_hi);
+    float32x4_t vt1 = vfmaq_f32(vz1, vn1, vln2_hi);
+
+    vt0 = vfmaq_f32(vt0, vn0, vln2_lo);
+    vt1 = vfmaq_f32(vt1, vn1, vln2_lo);
+
+    float32x4_t vp0 = vfmaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vfmaq_f32(vc4, vc5, vt1);
+
+    vp0 = vfmaq_f32(vc3, vp0, vt0);
+    vp1 = vfmaq_f32(vc3, vp1, vt1);
+
+    vp0 = vfmaq_f32(vc2, vp0, vt0);
+    vp1 = vfmaq_f32(vc2, vp1, vt1);
+
+    vp0 = vfmaq_f32(vc1, vp0, vt0);
+    vp1 = vfmaq_f32(vc1, vp1, vt1);
+
+    vt0 = vmulq_f32(vt0, vs0);
+    vt1 = vmulq_f32(vt1, vs1);
+
+    const float32x4_t ve0 = vfmaq_f32(vs0, vp0, vt0);
+    const float32x4_t ve1 = vfmaq_f32(vs1, vp1, vt1);
+
+    const float32x4_t ve10 = vaddq_f32(ve0, vone);
+    const float32x4_t ve11 = vaddq_f32(ve1, vone);
+
+    float32x4_t vf0 = vdivq_f32(ve0, ve10);
+    float32x4_t vf1 = vdivq_f32(ve1, ve11);
+
+    vf0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf0), vcagtq_f32(vx0, vdenorm_cutoff)));
+    vf1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf1), vcagtq_f32(vx1, vdenorm_cutoff)));
+
+    const uint32x4_t vm0 = vcltq_f32(vx0, vmovq_n_f32(0.0f));
+    const uint32x4_t vm1 = vcltq_f32(vx1, vmovq_n_f32(0.0f));
+
+    vf0 = vbslq_f32(vm0, vf0, vsubq_f32(vone, vf0));
+    vf1 = vbslq_f32(vm1, vf1, vsubq_f32(vone, vf1));
+
+    const float32x4_t vy0 = vmulq_f32(vx0, vf0);
+    const float32x4_t vy1 = vmulq_f32(vx1, vf1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vz, vn, vln2_hi);
+    vt = vfmaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vfmaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vf = vdivq_f32(ve, ve1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vz, vn, vln2_hi);
+    vt = vfmaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vfmaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vf = vdivq_f32(ve, ve1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
+
+void xnn_f32_vtanh_ukernel__aarch64_neonfma_rational_13_6_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    float32x4_t vx0 = vld1q_f32(input);
+    float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    vx0 = vmaxq_f32(vx0, vneg_sat_cutoff);
+    vx1 = vmaxq_f32(vx1, vneg_sat_cutoff);
+
+    vx0 = vminq_f32(vx0, vsat_cutoff);
+    vx1 = vminq_f32(vx1, vsat_cutoff);
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vx20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vx21, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_7, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_5, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_3, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_1, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vx21, vp1);
+
+    vp0 = vmulq_f32(vx0, vp0);
+    vp1 = vmulq_f32(vx1, vp1);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_4, vx20, vbeta_6);
+    float32x4_t vq1 = vfmaq_f32(vbeta_4, vx21, vbeta_6);
+
+    vq0 = vfmaq_f32(vbeta_2, vx20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vx21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_0, vx20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vx21, vq1);
+
+    const float32x4_t vy0 = vdivq_f32(vp0, vq0);
+    const float32x4_t vy1 = vdivq_f32(vp1, vq1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vx2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vx2, vp);
+    vp = vfmaq_f32(valpha_7, vx2, vp);
+    vp = vfmaq_f32(valpha_5, vx2, vp);
+    vp = vfmaq_f32(valpha_3, vx2, vp);
+    vp = vfmaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vx2, vq);
+    vq = vfmaq_f32(vbeta_0, vx2, vq);
+
+    const float32x4_t vy = vdivq_f32(vp, vq);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    float32x4_t vx = vld1q_f32(input);
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vx2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vx2, vp);
+    vp = vfmaq_f32(valpha_7, vx2, vp);
+    vp = vfmaq_f32(valpha_5, vx2, vp);
+    vp = vfmaq_f32(valpha_3, vx2, vp);
+    vp = vfmaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vx2, vq);
+    vq = vfmaq_f32(vbeta_0, vx2, vq);
+
+    const float32x4_t vy = vdivq_f32(vp, vq);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
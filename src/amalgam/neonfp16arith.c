@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <arm_neon.h>
 
@@ -23,6 +24,7 @@
 #include <xnnpack/prelu.h>
 #include <xnnpack/raddstoreexpminusmax.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vmulcaddc.h>
@@ -7865,6 +7867,131 @@ void xnn_f16_rmax_ukernel__neonfp16arith(
   #endif
 }
 
+void xnn_f16_rnorm_ukernel__neonfp16arith_x16(
+    size_t channels,
+    const void* input,
+    const void* weights,
+    void* output,
+    const union xnn_f16_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(uint16_t);
+  const uint16_t* i = (const uint16_t*) input;
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated in FP32, relative to the first element to avoid catastrophic cancellation.
+  const float32x4_t vshift4 = vsubtract_mean ?
+    vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(i))) : vmovq_n_f32(0.0f);
+  const float vshift = vgetq_lane_f32(vshift4, 0);
+
+  float32x4_t vsum0 = vmovq_n_f32(0.0f);
+  float32x4_t vsum1 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq0 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq1 = vmovq_n_f32(0.0f);
+  size_t c = channels;
+  for (; c >= 16 * sizeof(uint16_t); c -= 16 * sizeof(uint16_t)) {
+    const float16x8_t vx01 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+    const float16x8_t vx23 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+
+    const float32x4_t vd0 = vsubq_f32(vcvt_f32_f16(vget_low_f16(vx01)), vshift4);
+    const float32x4_t vd1 = vsubq_f32(vcvt_f32_f16(vget_high_f16(vx01)), vshift4);
+    const float32x4_t vd2 = vsubq_f32(vcvt_f32_f16(vget_low_f16(vx23)), vshift4);
+    const float32x4_t vd3 = vsubq_f32(vcvt_f32_f16(vget_high_f16(vx23)), vshift4);
+
+    vsum0 = vaddq_f32(vsum0, vd0);
+    vsum1 = vaddq_f32(vsum1, vd1);
+    vsumsq0 = vfmaq_f32(vsumsq0, vd0, vd0);
+    vsumsq1 = vfmaq_f32(vsumsq1, vd1, vd1);
+    vsum0 = vaddq_f32(vsum0, vd2);
+    vsum1 = vaddq_f32(vsum1, vd3);
+    vsumsq0 = vfmaq_f32(vsumsq0, vd2, vd2);
+    vsumsq1 = vfmaq_f32(vsumsq1, vd3, vd3);
+  }
+  for (; c >= 4 * sizeof(uint16_t); c -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vd = vsubq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))), vshift4); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vd);
+    vsumsq0 = vfmaq_f32(vsumsq0, vd, vd);
+  }
+  if XNN_UNLIKELY(c != 0) {
+    // Load the remaining 1-3 elements into zeroed lanes, and cancel out the contribution of the padding lanes, which
+    // equals (0 - shift) for the sum and shift * shift for the sum of squares.
+    uint16x4_t vx = vmov_n_u16(0);
+    size_t num_padding = 4;
+    for (; c != 0; c -= sizeof(uint16_t)) {
+      vx = vext_u16(vx, vld1_dup_u16(i++), 1);
+      num_padding -= 1;
+    }
+    const float32x4_t vd = vsubq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vx)), vshift4);
+    vsum1 = vaddq_f32(vsum1, vd);
+    vsumsq1 = vfmaq_f32(vsumsq1, vd, vd);
+    vsum1 = vsetq_lane_f32(vgetq_lane_f32(vsum1, 0) + (float) num_padding * vshift, vsum1, 0);
+    vsumsq1 = vsetq_lane_f32(vgetq_lane_f32(vsumsq1, 0) - (float) num_padding * vshift * vshift, vsumsq1, 0);
+  }
+  const float32x4_t vsum4 = vaddq_f32(vsum0, vsum1);
+  const float32x4_t vsumsq4 = vaddq_f32(vsumsq0, vsumsq1);
+  float32x2_t vsum2 = vadd_f32(vget_low_f32(vsum4), vget_high_f32(vsum4));
+  float32x2_t vsumsq2 = vadd_f32(vget_low_f32(vsumsq4), vget_high_f32(vsumsq4));
+  vsum2 = vpadd_f32(vsum2, vsum2);
+  vsumsq2 = vpadd_f32(vsumsq2, vsumsq2);
+  const float vsum = vget_lane_f32(vsum2, 0);
+  const float vsumsq = vget_lane_f32(vsumsq2, 0);
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum * vinv_n;
+  const float vmeansq = vsumsq * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const float32x4_t vmean4 = vdupq_n_f32(vmean);
+  const float32x4_t vrstd4 = vdupq_n_f32(vrstd);
+  const uint16_t* gamma = (const uint16_t*) weights;
+  const uint16_t* beta = gamma + n;
+  i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (c = channels; c >= 8 * sizeof(uint16_t); c -= 8 * sizeof(uint16_t)) {
+    const float16x8_t vx = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+    const float16x8_t vgamma = vreinterpretq_f16_u16(vld1q_u16(gamma)); gamma += 8;
+    const float16x8_t vbeta = vreinterpretq_f16_u16(vld1q_u16(beta)); beta += 8;
+
+    const float32x4_t vscale_lo = vmulq_f32(vcvt_f32_f16(vget_low_f16(vgamma)), vrstd4);
+    const float32x4_t vscale_hi = vmulq_f32(vcvt_f32_f16(vget_high_f16(vgamma)), vrstd4);
+    const float32x4_t vy_lo = vfmaq_f32(
+      vcvt_f32_f16(vget_low_f16(vbeta)), vsubq_f32(vcvt_f32_f16(vget_low_f16(vx)), vmean4), vscale_lo);
+    const float32x4_t vy_hi = vfmaq_f32(
+      vcvt_f32_f16(vget_high_f16(vbeta)), vsubq_f32(vcvt_f32_f16(vget_high_f16(vx)), vmean4), vscale_hi);
+
+    vst1q_u16(o, vreinterpretq_u16_f16(vcombine_f16(vcvt_f16_f32(vy_lo), vcvt_f16_f32(vy_hi)))); o += 8;
+  }
+  for (; c >= 4 * sizeof(uint16_t); c -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))); i += 4;
+    const float32x4_t vscale = vmulq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(gamma))), vrstd4); gamma += 4;
+    const float32x4_t vbeta = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(beta))); beta += 4;
+
+    const float32x4_t vy = vfmaq_f32(vbeta, vsubq_f32(vx, vmean4), vscale);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy))); o += 4;
+  }
+  for (; c != 0; c -= sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(i++)));
+    const float32x4_t vgamma = vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(gamma++)));
+    const float32x4_t vbeta = vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(beta++)));
+
+    const float32x4_t vy = vfmaq_f32(vbeta, vsubq_f32(vx, vmean4), vmulq_f32(vgamma, vrstd4));
+
+    vst1_lane_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)), 0); o += 1;
+  }
+}
+
 void xnn_f16_spmm_minmax_ukernel_32x1__neonfp16arith_pipelined(
     size_t mc,
     size_t nc,
@@ -8088,6 +8215,233 @@ void xnn_f16_spmm_minmax_ukernel_32x1__neonfp16arith_pipelined(
   }
 }
 
+void xnn_f16_vapproxgelu_ukernel__neonfp16arith_rational_13_6_nr1recps_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vc3 = vmovq_n_f32(0x1.2444F2p-5f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.988454p-1f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    const float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    const float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+    const float32x4_t vx22 = vmulq_f32(vx2, vx2);
+    const float32x4_t vx23 = vmulq_f32(vx3, vx3);
+
+    float32x4_t vu0 = vfmaq_f32(vc1, vx20, vc3);
+    float32x4_t vu1 = vfmaq_f32(vc1, vx21, vc3);
+    float32x4_t vu2 = vfmaq_f32(vc1, vx22, vc3);
+    float32x4_t vu3 = vfmaq_f32(vc1, vx23, vc3);
+
+    vu0 = vmulq_f32(vx0, vu0);
+    vu1 = vmulq_f32(vx1, vu1);
+    vu2 = vmulq_f32(vx2, vu2);
+    vu3 = vmulq_f32(vx3, vu3);
+
+    vu0 = vmaxq_f32(vu0, vneg_sat_cutoff);
+    vu1 = vmaxq_f32(vu1, vneg_sat_cutoff);
+    vu2 = vmaxq_f32(vu2, vneg_sat_cutoff);
+    vu3 = vmaxq_f32(vu3, vneg_sat_cutoff);
+
+    vu0 = vminq_f32(vu0, vsat_cutoff);
+    vu1 = vminq_f32(vu1, vsat_cutoff);
+    vu2 = vminq_f32(vu2, vsat_cutoff);
+    vu3 = vminq_f32(vu3, vsat_cutoff);
+
+    const float32x4_t vu20 = vmulq_f32(vu0, vu0);
+    const float32x4_t vu21 = vmulq_f32(vu1, vu1);
+    const float32x4_t vu22 = vmulq_f32(vu2, vu2);
+    const float32x4_t vu23 = vmulq_f32(vu3, vu3);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vu20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vu21, valpha_13);
+    float32x4_t vp2 = vfmaq_f32(valpha_11, vu22, valpha_13);
+    float32x4_t vp3 = vfmaq_f32(valpha_11, vu23, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_9, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_9, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_7, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_7, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_7, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_5, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_5, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_5, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_3, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_3, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_3, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_1, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_1, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_1, vu23, vp3);
+
+    vp0 = vmulq_f32(vu0, vp0);
+    vp1 = vmulq_f32(vu1, vp1);
+    vp2 = vmulq_f32(vu2, vp2);
+    vp3 = vmulq_f32(vu3, vp3);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_4, vu20, vbeta_6);
+    float32x4_t vq1 = vfmaq_f32(vbeta_4, vu21, vbeta_6);
+    float32x4_t vq2 = vfmaq_f32(vbeta_4, vu22, vbeta_6);
+    float32x4_t vq3 = vfmaq_f32(vbeta_4, vu23, vbeta_6);
+
+    vq0 = vfmaq_f32(vbeta_2, vu20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vu21, vq1);
+    vq2 = vfmaq_f32(vbeta_2, vu22, vq2);
+    vq3 = vfmaq_f32(vbeta_2, vu23, vq3);
+
+    vq0 = vfmaq_f32(vbeta_0, vu20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vu21, vq1);
+    vq2 = vfmaq_f32(vbeta_0, vu22, vq2);
+    vq3 = vfmaq_f32(vbeta_0, vu23, vq3);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+    float32x4_t vrq2 = vrecpeq_f32(vq2);
+    float32x4_t vrq3 = vrecpeq_f32(vq3);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+    vrq2 = vmulq_f32(vrq2, vrecpsq_f32(vrq2, vq2));
+    vrq3 = vmulq_f32(vrq3, vrecpsq_f32(vrq3, vq3));
+
+    const float32x4_t vt0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vt1 = vmulq_f32(vp1, vrq1);
+    const float32x4_t vt2 = vmulq_f32(vp2, vrq2);
+    const float32x4_t vt3 = vmulq_f32(vp3, vrq3);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+    const float32x4_t vhalfx2 = vmulq_f32(vx2, vhalf);
+    const float32x4_t vhalfx3 = vmulq_f32(vx3, vhalf);
+
+    const float32x4_t vy0 = vfmaq_f32(vhalfx0, vhalfx0, vt0);
+    const float32x4_t vy1 = vfmaq_f32(vhalfx1, vhalfx1, vt1);
+    const float32x4_t vy2 = vfmaq_f32(vhalfx2, vhalfx2, vt2);
+    const float32x4_t vy3 = vfmaq_f32(vhalfx3, vhalfx3, vt3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vfmaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vu2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vu2, vp);
+    vp = vfmaq_f32(valpha_7, vu2, vp);
+    vp = vfmaq_f32(valpha_5, vu2, vp);
+    vp = vfmaq_f32(valpha_3, vu2, vp);
+    vp = vfmaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vu2, vq);
+    vq = vfmaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, vt);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vfmaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vu2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vu2, vp);
+    vp = vfmaq_f32(valpha_7, vu2, vp);
+    vp = vfmaq_f32(valpha_5, vu2, vp);
+    vp = vfmaq_f32(valpha_3, vu2, vp);
+    vp = vfmaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vu2, vq);
+    vq = vfmaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, vt);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
+
 void xnn_f16_vadd_minmax_ukernel__neonfp16arith_x16(
     size_t batch,
     const void* restrict input_a,
@@ -9142,6 +9496,427 @@ void xnn_f16_velu_ukernel__neonfp16arith_rr1_p3_x16(
   }
 }
 
+void xnn_f16_vexp_ukernel__neonfp16arith_rr2_p5_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const float32x4_t vzero_cutoff = vmovq_n_f32(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const float32x4_t vinf_cutoff = vmovq_n_f32(0x1.62E42Ep+6f);
+  const float32x4_t vlog2e = vmovq_n_f32(0x1.715476p+0f);
+  const float32x4_t vminus_ln2_hi = vmovq_n_f32(-0x1.62E400p-1f);
+  const float32x4_t vminus_ln2_lo = vmovq_n_f32(-0x1.7F7D1Cp-20f);
+  const float32x4_t vplus_inf = vmovq_n_f32(INFINITY);
+  const float32x4_t vc5 = vmovq_n_f32(0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.FFFFF6p-1f);
+  const int32x4_t vmin_exponent = vmovq_n_s32(-INT32_C(0x3F000000));
+  const int32x4_t vmax_exponent = vmovq_n_s32(INT32_C(0x3F800000));
+  const int32x4_t vdefault_exponent = vmax_exponent;
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    const float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    const float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    float32x4_t vn0 = vfmaq_f32(vmagic_bias, vx0, vlog2e);
+    float32x4_t vn1 = vfmaq_f32(vmagic_bias, vx1, vlog2e);
+    float32x4_t vn2 = vfmaq_f32(vmagic_bias, vx2, vlog2e);
+    float32x4_t vn3 = vfmaq_f32(vmagic_bias, vx3, vlog2e);
+
+    int32x4_t veo0 = vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23);
+    int32x4_t veo1 = vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23);
+    int32x4_t veo2 = vshlq_n_s32(vreinterpretq_s32_f32(vn2), 23);
+    int32x4_t veo3 = vshlq_n_s32(vreinterpretq_s32_f32(vn3), 23);
+
+    int32x4_t ven0 = vmaxq_s32(veo0, vmin_exponent);
+    int32x4_t ven1 = vmaxq_s32(veo1, vmin_exponent);
+    int32x4_t ven2 = vmaxq_s32(veo2, vmin_exponent);
+    int32x4_t ven3 = vmaxq_s32(veo3, vmin_exponent);
+
+    ven0 = vminq_s32(ven0, vmax_exponent);
+    ven1 = vminq_s32(ven1, vmax_exponent);
+    ven2 = vminq_s32(ven2, vmax_exponent);
+    ven3 = vminq_s32(ven3, vmax_exponent);
+
+    veo0 = vsubq_s32(veo0, ven0);
+    veo1 = vsubq_s32(veo1, ven1);
+    veo2 = vsubq_s32(veo2, ven2);
+    veo3 = vsubq_s32(veo3, ven3);
+
+    const float32x4_t vsn0 = vreinterpretq_f32_s32(vaddq_s32(ven0, vdefault_exponent));
+    const float32x4_t vsn1 = vreinterpretq_f32_s32(vaddq_s32(ven1, vdefault_exponent));
+    const float32x4_t vsn2 = vreinterpretq_f32_s32(vaddq_s32(ven2, vdefault_exponent));
+    const float32x4_t vsn3 = vreinterpretq_f32_s32(vaddq_s32(ven3, vdefault_exponent));
+
+    const float32x4_t vso0 = vreinterpretq_f32_s32(vaddq_s32(veo0, vdefault_exponent));
+    const float32x4_t vso1 = vreinterpretq_f32_s32(vaddq_s32(veo1, vdefault_exponent));
+    const float32x4_t vso2 = vreinterpretq_f32_s32(vaddq_s32(veo2, vdefault_exponent));
+    const float32x4_t vso3 = vreinterpretq_f32_s32(vaddq_s32(veo3, vdefault_exponent));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+    vn2 = vsubq_f32(vn2, vmagic_bias);
+    vn3 = vsubq_f32(vn3, vmagic_bias);
+
+    float32x4_t vt0 = vfmaq_f32(vx0, vn0, vminus_ln2_hi);
+    float32x4_t vt1 = vfmaq_f32(vx1, vn1, vminus_ln2_hi);
+    float32x4_t vt2 = vfmaq_f32(vx2, vn2, vminus_ln2_hi);
+    float32x4_t vt3 = vfmaq_f32(vx3, vn3, vminus_ln2_hi);
+
+    vt0 = vfmaq_f32(vt0, vn0, vminus_ln2_lo);
+    vt1 = vfmaq_f32(vt1, vn1, vminus_ln2_lo);
+    vt2 = vfmaq_f32(vt2, vn2, vminus_ln2_lo);
+    vt3 = vfmaq_f32(vt3, vn3, vminus_ln2_lo);
+
+    float32x4_t vp0 = vfmaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vfmaq_f32(vc4, vc5, vt1);
+    float32x4_t vp2 = vfmaq_f32(vc4, vc5, vt2);
+    float32x4_t vp3 = vfmaq_f32(vc4, vc5, vt3);
+
+    vp0 = vfmaq_f32(vc3, vp0, vt0);
+    vp1 = vfmaq_f32(vc3, vp1, vt1);
+    vp2 = vfmaq_f32(vc3, vp2, vt2);
+    vp3 = vfmaq_f32(vc3, vp3, vt3);
+
+    vp0 = vfmaq_f32(vc2, vp0, vt0);
+    vp1 = vfmaq_f32(vc2, vp1, vt1);
+    vp2 = vfmaq_f32(vc2, vp2, vt2);
+    vp3 = vfmaq_f32(vc2, vp3, vt3);
+
+    vp0 = vfmaq_f32(vc1, vp0, vt0);
+    vp1 = vfmaq_f32(vc1, vp1, vt1);
+    vp2 = vfmaq_f32(vc1, vp2, vt2);
+    vp3 = vfmaq_f32(vc1, vp3, vt3);
+
+    vt0 = vmulq_f32(vt0, vso0);
+    vt1 = vmulq_f32(vt1, vso1);
+    vt2 = vmulq_f32(vt2, vso2);
+    vt3 = vmulq_f32(vt3, vso3);
+
+    float32x4_t vy0 = vmulq_f32(vsn0, vfmaq_f32(vso0, vt0, vp0));
+    float32x4_t vy1 = vmulq_f32(vsn1, vfmaq_f32(vso1, vt1, vp1));
+    float32x4_t vy2 = vmulq_f32(vsn2, vfmaq_f32(vso2, vt2, vp2));
+    float32x4_t vy3 = vmulq_f32(vsn3, vfmaq_f32(vso3, vt3, vp3));
+
+    vy0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy0), vcltq_f32(vx0, vzero_cutoff)));
+    vy1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy1), vcltq_f32(vx1, vzero_cutoff)));
+    vy2 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy2), vcltq_f32(vx2, vzero_cutoff)));
+    vy3 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy3), vcltq_f32(vx3, vzero_cutoff)));
+
+    vy0 = vbslq_f32(vcgtq_f32(vx0, vinf_cutoff), vplus_inf, vy0);
+    vy1 = vbslq_f32(vcgtq_f32(vx1, vinf_cutoff), vplus_inf, vy1);
+    vy2 = vbslq_f32(vcgtq_f32(vx2, vinf_cutoff), vplus_inf, vy2);
+    vy3 = vbslq_f32(vcgtq_f32(vx3, vinf_cutoff), vplus_inf, vy3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vfmaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vfmaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vfmaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vfmaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vgelu_ukernel__neonfp16arith_rational_13_8_nr1recps_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vsqrt1_2 = vmovq_n_f32(0x1.6A09E6p-1f);
+  const float32x4_t vneg_erf_cutoff = vmovq_n_f32(-0x1.000000p+2f);
+  const float32x4_t verf_cutoff = vmovq_n_f32(0x1.000000p+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.2BBE16p-32f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.DBFFDCp-26f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.19FEA2p-19f);
+  const float32x4_t valpha_7 = vmovq_n_f32(-0x1.DD85A4p-15f);
+  const float32x4_t valpha_5 = vmovq_n_f32(-0x1.8158C6p-11f);
+  const float32x4_t valpha_3 = vmovq_n_f32(-0x1.8343ECp-9f);
+  const float32x4_t valpha_1 = vmovq_n_f32(-0x1.07B7A8p-6f);
+  const float32x4_t vbeta_8 = vmovq_n_f32(-0x1.E8C19Ap-17f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(-0x1.BF7A52p-13f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(-0x1.B9249Cp-10f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(-0x1.E337F0p-8f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(-0x1.D36D4Ep-7f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    const float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    const float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    float32x4_t vz0 = vmulq_f32(vx0, vsqrt1_2);
+    float32x4_t vz1 = vmulq_f32(vx1, vsqrt1_2);
+    float32x4_t vz2 = vmulq_f32(vx2, vsqrt1_2);
+    float32x4_t vz3 = vmulq_f32(vx3, vsqrt1_2);
+
+    vz0 = vmaxq_f32(vz0, vneg_erf_cutoff);
+    vz1 = vmaxq_f32(vz1, vneg_erf_cutoff);
+    vz2 = vmaxq_f32(vz2, vneg_erf_cutoff);
+    vz3 = vmaxq_f32(vz3, vneg_erf_cutoff);
+
+    vz0 = vminq_f32(vz0, verf_cutoff);
+    vz1 = vminq_f32(vz1, verf_cutoff);
+    vz2 = vminq_f32(vz2, verf_cutoff);
+    vz3 = vminq_f32(vz3, verf_cutoff);
+
+    const float32x4_t vz20 = vmulq_f32(vz0, vz0);
+    const float32x4_t vz21 = vmulq_f32(vz1, vz1);
+    const float32x4_t vz22 = vmulq_f32(vz2, vz2);
+    const float32x4_t vz23 = vmulq_f32(vz3, vz3);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vz20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vz21, valpha_13);
+    float32x4_t vp2 = vfmaq_f32(valpha_11, vz22, valpha_13);
+    float32x4_t vp3 = vfmaq_f32(valpha_11, vz23, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vz21, vp1);
+    vp2 = vfmaq_f32(valpha_9, vz22, vp2);
+    vp3 = vfmaq_f32(valpha_9, vz23, vp3);
+
+    vp0 = vfmaq_f32(valpha_7, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vz21, vp1);
+    vp2 = vfmaq_f32(valpha_7, vz22, vp2);
+    vp3 = vfmaq_f32(valpha_7, vz23, vp3);
+
+    vp0 = vfmaq_f32(valpha_5, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vz21, vp1);
+    vp2 = vfmaq_f32(valpha_5, vz22, vp2);
+    vp3 = vfmaq_f32(valpha_5, vz23, vp3);
+
+    vp0 = vfmaq_f32(valpha_3, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vz21, vp1);
+    vp2 = vfmaq_f32(valpha_3, vz22, vp2);
+    vp3 = vfmaq_f32(valpha_3, vz23, vp3);
+
+    vp0 = vfmaq_f32(valpha_1, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vz21, vp1);
+    vp2 = vfmaq_f32(valpha_1, vz22, vp2);
+    vp3 = vfmaq_f32(valpha_1, vz23, vp3);
+
+    vp0 = vmulq_f32(vz0, vp0);
+    vp1 = vmulq_f32(vz1, vp1);
+    vp2 = vmulq_f32(vz2, vp2);
+    vp3 = vmulq_f32(vz3, vp3);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_6, vz20, vbeta_8);
+    float32x4_t vq1 = vfmaq_f32(vbeta_6, vz21, vbeta_8);
+    float32x4_t vq2 = vfmaq_f32(vbeta_6, vz22, vbeta_8);
+    float32x4_t vq3 = vfmaq_f32(vbeta_6, vz23, vbeta_8);
+
+    vq0 = vfmaq_f32(vbeta_4, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_4, vz21, vq1);
+    vq2 = vfmaq_f32(vbeta_4, vz22, vq2);
+    vq3 = vfmaq_f32(vbeta_4, vz23, vq3);
+
+    vq0 = vfmaq_f32(vbeta_2, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vz21, vq1);
+    vq2 = vfmaq_f32(vbeta_2, vz22, vq2);
+    vq3 = vfmaq_f32(vbeta_2, vz23, vq3);
+
+    vq0 = vfmaq_f32(vbeta_0, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vz21, vq1);
+    vq2 = vfmaq_f32(vbeta_0, vz22, vq2);
+    vq3 = vfmaq_f32(vbeta_0, vz23, vq3);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+    float32x4_t vrq2 = vrecpeq_f32(vq2);
+    float32x4_t vrq3 = vrecpeq_f32(vq3);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+    vrq2 = vmulq_f32(vrq2, vrecpsq_f32(vrq2, vq2));
+    vrq3 = vmulq_f32(vrq3, vrecpsq_f32(vrq3, vq3));
+
+    const float32x4_t verf0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t verf1 = vmulq_f32(vp1, vrq1);
+    const float32x4_t verf2 = vmulq_f32(vp2, vrq2);
+    const float32x4_t verf3 = vmulq_f32(vp3, vrq3);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+    const float32x4_t vhalfx2 = vmulq_f32(vx2, vhalf);
+    const float32x4_t vhalfx3 = vmulq_f32(vx3, vhalf);
+
+    const float32x4_t vy0 = vfmaq_f32(vhalfx0, vhalfx0, verf0);
+    const float32x4_t vy1 = vfmaq_f32(vhalfx1, vhalfx1, verf1);
+    const float32x4_t vy2 = vfmaq_f32(vhalfx2, vhalfx2, verf2);
+    const float32x4_t vy3 = vfmaq_f32(vhalfx3, vhalfx3, verf3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vz2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vz2, vp);
+    vp = vfmaq_f32(valpha_7, vz2, vp);
+    vp = vfmaq_f32(valpha_5, vz2, vp);
+    vp = vfmaq_f32(valpha_3, vz2, vp);
+    vp = vfmaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vfmaq_f32(vbeta_4, vz2, vq);
+    vq = vfmaq_f32(vbeta_2, vz2, vq);
+    vq = vfmaq_f32(vbeta_0, vz2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t verf = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vz2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vz2, vp);
+    vp = vfmaq_f32(valpha_7, vz2, vp);
+    vp = vfmaq_f32(valpha_5, vz2, vp);
+    vp = vfmaq_f32(valpha_3, vz2, vp);
+    vp = vfmaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vfmaq_f32(vbeta_4, vz2, vq);
+    vq = vfmaq_f32(vbeta_2, vz2, vq);
+    vq = vfmaq_f32(vbeta_0, vz2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t verf = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
+
 void xnn_f16_vhswish_ukernel__neonfp16arith_x16(
     size_t batch,
     const void* restrict input,
@@ -9909,6 +10684,219 @@ void xnn_f16_vsigmoid_ukernel__neonfp16arith_rr2_p2_nr1recps_x16(
   }
 }
 
+void xnn_f16_vsilu_ukernel__neonfp16arith_rr2_p5_nr1recps_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.8000FEp23f);
+  const float32x4_t vminus_log2e = vmovq_n_f32(-0x1.715476p0f);
+  const float32x4_t vln2_hi = vmovq_n_f32(0x1.62E400p-1f);
+  const float32x4_t vln2_lo = vmovq_n_f32(0x1.7F7D1Cp-20f);
+  const float32x4_t vc5 = vmovq_n_f32(-0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(-0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(-0x1.FFFFF6p-1f);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vdenorm_cutoff = vmovq_n_f32(0x1.5D589Ep+6f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    const float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    const float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    const float32x4_t vz0 = vabsq_f32(vx0);
+    const float32x4_t vz1 = vabsq_f32(vx1);
+    const float32x4_t vz2 = vabsq_f32(vx2);
+    const float32x4_t vz3 = vabsq_f32(vx3);
+
+    float32x4_t vn0 = vfmaq_f32(vmagic_bias, vz0, vminus_log2e);
+    float32x4_t vn1 = vfmaq_f32(vmagic_bias, vz1, vminus_log2e);
+    float32x4_t vn2 = vfmaq_f32(vmagic_bias, vz2, vminus_log2e);
+    float32x4_t vn3 = vfmaq_f32(vmagic_bias, vz3, vminus_log2e);
+
+    const float32x4_t vs0 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23));
+    const float32x4_t vs1 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23));
+    const float32x4_t vs2 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn2), 23));
+    const float32x4_t vs3 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn3), 23));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+    vn2 = vsubq_f32(vn2, vmagic_bias);
+    vn3 = vsubq_f32(vn3, vmagic_bias);
+
+    float32x4_t vt0 = vfmaq_f32(vz0, vn0, vln2_hi);
+    float32x4_t vt1 = vfmaq_f32(vz1, vn1, vln2_hi);
+    float32x4_t vt2 = vfmaq_f32(vz2, vn2, vln2_hi);
+    float32x4_t vt3 = vfmaq_f32(vz3, vn3, vln2_hi);
+
+    vt0 = vfmaq_f32(vt0, vn0, vln2_lo);
+    vt1 = vfmaq_f32(vt1, vn1, vln2_lo);
+    vt2 = vfmaq_f32(vt2, vn2, vln2_lo);
+    vt3 = vfmaq_f32(vt3, vn3, vln2_lo);
+
+    float32x4_t vp0 = vfmaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vfmaq_f32(vc4, vc5, vt1);
+    float32x4_t vp2 = vfmaq_f32(vc4, vc5, vt2);
+    float32x4_t vp3 = vfmaq_f32(vc4, vc5, vt3);
+
+    vp0 = vfmaq_f32(vc3, vp0, vt0);
+    vp1 = vfmaq_f32(vc3, vp1, vt1);
+    vp2 = vfmaq_f32(vc3, vp2, vt2);
+    vp3 = vfmaq_f32(vc3, vp3, vt3);
+
+    vp0 = vfmaq_f32(vc2, vp0, vt0);
+    vp1 = vfmaq_f32(vc2, vp1, vt1);
+    vp2 = vfmaq_f32(vc2, vp2, vt2);
+    vp3 = vfmaq_f32(vc2, vp3, vt3);
+
+    vp0 = vfmaq_f32(vc1, vp0, vt0);
+    vp1 = vfmaq_f32(vc1, vp1, vt1);
+    vp2 = vfmaq_f32(vc1, vp2, vt2);
+    vp3 = vfmaq_f32(vc1, vp3, vt3);
+
+    vt0 = vmulq_f32(vt0, vs0);
+    vt1 = vmulq_f32(vt1, vs1);
+    vt2 = vmulq_f32(vt2, vs2);
+    vt3 = vmulq_f32(vt3, vs3);
+
+    const float32x4_t ve0 = vfmaq_f32(vs0, vp0, vt0);
+    const float32x4_t ve1 = vfmaq_f32(vs1, vp1, vt1);
+    const float32x4_t ve2 = vfmaq_f32(vs2, vp2, vt2);
+    const float32x4_t ve3 = vfmaq_f32(vs3, vp3, vt3);
+
+    const float32x4_t ve10 = vaddq_f32(ve0, vone);
+    const float32x4_t ve11 = vaddq_f32(ve1, vone);
+    const float32x4_t ve12 = vaddq_f32(ve2, vone);
+    const float32x4_t ve13 = vaddq_f32(ve3, vone);
+
+    float32x4_t vre10 = vrecpeq_f32(ve10);
+    float32x4_t vre11 = vrecpeq_f32(ve11);
+    float32x4_t vre12 = vrecpeq_f32(ve12);
+    float32x4_t vre13 = vrecpeq_f32(ve13);
+
+    vre10 = vmulq_f32(vre10, vrecpsq_f32(vre10, ve10));
+    vre11 = vmulq_f32(vre11, vrecpsq_f32(vre11, ve11));
+    vre12 = vmulq_f32(vre12, vrecpsq_f32(vre12, ve12));
+    vre13 = vmulq_f32(vre13, vrecpsq_f32(vre13, ve13));
+
+    float32x4_t vf0 = vmulq_f32(ve0, vre10);
+    float32x4_t vf1 = vmulq_f32(ve1, vre11);
+    float32x4_t vf2 = vmulq_f32(ve2, vre12);
+    float32x4_t vf3 = vmulq_f32(ve3, vre13);
+
+    vf0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf0), vcagtq_f32(vx0, vdenorm_cutoff)));
+    vf1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf1), vcagtq_f32(vx1, vdenorm_cutoff)));
+    vf2 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf2), vcagtq_f32(vx2, vdenorm_cutoff)));
+    vf3 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf3), vcagtq_f32(vx3, vdenorm_cutoff)));
+
+    const uint32x4_t vm0 = vcltq_f32(vx0, vmovq_n_f32(0.0f));
+    const uint32x4_t vm1 = vcltq_f32(vx1, vmovq_n_f32(0.0f));
+    const uint32x4_t vm2 = vcltq_f32(vx2, vmovq_n_f32(0.0f));
+    const uint32x4_t vm3 = vcltq_f32(vx3, vmovq_n_f32(0.0f));
+
+    vf0 = vbslq_f32(vm0, vf0, vsubq_f32(vone, vf0));
+    vf1 = vbslq_f32(vm1, vf1, vsubq_f32(vone, vf1));
+    vf2 = vbslq_f32(vm2, vf2, vsubq_f32(vone, vf2));
+    vf3 = vbslq_f32(vm3, vf3, vsubq_f32(vone, vf3));
+
+    const float32x4_t vy0 = vmulq_f32(vx0, vf0);
+    const float32x4_t vy1 = vmulq_f32(vx1, vf1);
+    const float32x4_t vy2 = vmulq_f32(vx2, vf2);
+    const float32x4_t vy3 = vmulq_f32(vx3, vf3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vz, vn, vln2_hi);
+    vt = vfmaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vfmaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vre1 = vrecpeq_f32(ve1);
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    float32x4_t vf = vmulq_f32(ve, vre1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vz, vn, vln2_hi);
+    vt = vfmaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vfmaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vre1 = vrecpeq_f32(ve1);
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    float32x4_t vf = vmulq_f32(ve, vre1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
+
 void xnn_f16_vsqrt_ukernel__neonfp16arith_nr1fma1adj_x8(
     size_t batch,
     const void* input,
@@ -10005,6 +10993,189 @@ void xnn_f16_vsqrt_ukernel__neonfp16arith_nr1fma1adj_x8(
   }
 }
 
+void xnn_f16_vtanh_ukernel__neonfp16arith_rational_13_6_nr1recps_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    vx0 = vmaxq_f32(vx0, vneg_sat_cutoff);
+    vx1 = vmaxq_f32(vx1, vneg_sat_cutoff);
+    vx2 = vmaxq_f32(vx2, vneg_sat_cutoff);
+    vx3 = vmaxq_f32(vx3, vneg_sat_cutoff);
+
+    vx0 = vminq_f32(vx0, vsat_cutoff);
+    vx1 = vminq_f32(vx1, vsat_cutoff);
+    vx2 = vminq_f32(vx2, vsat_cutoff);
+    vx3 = vminq_f32(vx3, vsat_cutoff);
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+    const float32x4_t vx22 = vmulq_f32(vx2, vx2);
+    const float32x4_t vx23 = vmulq_f32(vx3, vx3);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vx20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vx21, valpha_13);
+    float32x4_t vp2 = vfmaq_f32(valpha_11, vx22, valpha_13);
+    float32x4_t vp3 = vfmaq_f32(valpha_11, vx23, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vx21, vp1);
+    vp2 = vfmaq_f32(valpha_9, vx22, vp2);
+    vp3 = vfmaq_f32(valpha_9, vx23, vp3);
+
+    vp0 = vfmaq_f32(valpha_7, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vx21, vp1);
+    vp2 = vfmaq_f32(valpha_7, vx22, vp2);
+    vp3 = vfmaq_f32(valpha_7, vx23, vp3);
+
+    vp0 = vfmaq_f32(valpha_5, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vx21, vp1);
+    vp2 = vfmaq_f32(valpha_5, vx22, vp2);
+    vp3 = vfmaq_f32(valpha_5, vx23, vp3);
+
+    vp0 = vfmaq_f32(valpha_3, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vx21, vp1);
+    vp2 = vfmaq_f32(valpha_3, vx22, vp2);
+    vp3 = vfmaq_f32(valpha_3, vx23, vp3);
+
+    vp0 = vfmaq_f32(valpha_1, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vx21, vp1);
+    vp2 = vfmaq_f32(valpha_1, vx22, vp2);
+    vp3 = vfmaq_f32(valpha_1, vx23, vp3);
+
+    vp0 = vmulq_f32(vx0, vp0);
+    vp1 = vmulq_f32(vx1, vp1);
+    vp2 = vmulq_f32(vx2, vp2);
+    vp3 = vmulq_f32(vx3, vp3);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_4, vx20, vbeta_6);
+    float32x4_t vq1 = vfmaq_f32(vbeta_4, vx21, vbeta_6);
+    float32x4_t vq2 = vfmaq_f32(vbeta_4, vx22, vbeta_6);
+    float32x4_t vq3 = vfmaq_f32(vbeta_4, vx23, vbeta_6);
+
+    vq0 = vfmaq_f32(vbeta_2, vx20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vx21, vq1);
+    vq2 = vfmaq_f32(vbeta_2, vx22, vq2);
+    vq3 = vfmaq_f32(vbeta_2, vx23, vq3);
+
+    vq0 = vfmaq_f32(vbeta_0, vx20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vx21, vq1);
+    vq2 = vfmaq_f32(vbeta_0, vx22, vq2);
+    vq3 = vfmaq_f32(vbeta_0, vx23, vq3);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+    float32x4_t vrq2 = vrecpeq_f32(vq2);
+    float32x4_t vrq3 = vrecpeq_f32(vq3);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+    vrq2 = vmulq_f32(vrq2, vrecpsq_f32(vrq2, vq2));
+    vrq3 = vmulq_f32(vrq3, vrecpsq_f32(vrq3, vq3));
+
+    const float32x4_t vy0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vy1 = vmulq_f32(vp1, vrq1);
+    const float32x4_t vy2 = vmulq_f32(vp2, vrq2);
+    const float32x4_t vy3 = vmulq_f32(vp3, vrq3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vx2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vx2, vp);
+    vp = vfmaq_f32(valpha_7, vx2, vp);
+    vp = vfmaq_f32(valpha_5, vx2, vp);
+    vp = vfmaq_f32(valpha_3, vx2, vp);
+    vp = vfmaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vx2, vq);
+    vq = vfmaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vx2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vx2, vp);
+    vp = vfmaq_f32(valpha_7, vx2, vp);
+    vp = vfmaq_f32(valpha_5, vx2, vp);
+    vp = vfmaq_f32(valpha_3, vx2, vp);
+    vp = vfmaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vx2, vq);
+    vq = vfmaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
+
 void xnn_f16_vabs_ukernel__neonfp16arith_x16(
     size_t batch,
     const void* input,
@@ -5,15 +5,2129 @@
 
 #include <assert.h>
 #include <fxdiv.h>
+#include <math.h>
 #include <string.h>
 
 #include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/gemm.h>
 #include <xnnpack/lut.h>
 #include <xnnpack/math.h>
+#include <xnnpack/prefetch.h>
+#include <xnnpack/reduce.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/transpose.h>
 #include <xnnpack/vunary.h>
 
 
+XNN_INLINE static float cvt_f16_f32(uint16_t h) {
+  const uint32_t vw = (uint32_t) h << 16;
+  const uint32_t vsign = vw & UINT32_C(0x80000000);
+  const uint32_t v2w = vw + vw;
+  const uint32_t vnorm = float_as_uint32(uint32_as_float((v2w >> 4) + UINT32_C(0x70000000)) * 0x1.0p-112f);
+  const uint32_t vdenorm = float_as_uint32(uint32_as_float((v2w >> 17) | UINT32_C(0x3F000000)) - 0.5f);
+  return uint32_as_float(vsign | (XNN_UNPREDICTABLE(v2w < UINT32_C(0x08000000)) ? vdenorm : vnorm));
+}
+
+void xnn_f16_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 += cvt_f16_f32(i[0]);
+      vacc1 += cvt_f16_f32(i[1]);
+      vacc2 += cvt_f16_f32(i[2]);
+      vacc3 += cvt_f16_f32(i[3]);
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 4 * sizeof(uint16_t);
+  }
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += cvt_f16_f32(*((const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset)));
+    }
+    *output++ = vacc * vscale;
+    offset += sizeof(uint16_t);
+  }
+}
+
+void xnn_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 += i[0];
+      vacc1 += i[1];
+      vacc2 += i[2];
+      vacc3 += i[3];
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 4 * sizeof(float);
+  }
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += *((const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset));
+    }
+    *output++ = vacc * vscale;
+    offset += sizeof(float);
+  }
+}
+
+void xnn_f32_rdmax_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vacc0 = output[0];
+    float vacc1 = output[1];
+    float vacc2 = output[2];
+    float vacc3 = output[3];
+    size_t r = rows;
+    do {
+      const float vx0 = i[0];
+      const float vx1 = i[1];
+      const float vx2 = i[2];
+      const float vx3 = i[3];
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = math_max_f32(vacc0, vx0);
+      vacc1 = math_max_f32(vacc1, vx1);
+      vacc2 = math_max_f32(vacc2, vx2);
+      vacc3 = math_max_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    output[0] = vacc0;
+    output[1] = vacc1;
+    output[2] = vacc2;
+    output[3] = vacc3;
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = *output;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = math_max_f32(vacc, vx);
+      } while (--r != 0);
+
+      *output++ = vacc;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdmin_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vacc0 = output[0];
+    float vacc1 = output[1];
+    float vacc2 = output[2];
+    float vacc3 = output[3];
+    size_t r = rows;
+    do {
+      const float vx0 = i[0];
+      const float vx1 = i[1];
+      const float vx2 = i[2];
+      const float vx3 = i[3];
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = math_min_f32(vacc0, vx0);
+      vacc1 = math_min_f32(vacc1, vx1);
+      vacc2 = math_min_f32(vacc2, vx2);
+      vacc3 = math_min_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    output[0] = vacc0;
+    output[1] = vacc1;
+    output[2] = vacc2;
+    output[3] = vacc3;
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = *output;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = math_min_f32(vacc, vx);
+      } while (--r != 0);
+
+      *output++ = vacc;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsum_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vscale = params->scalar.scale;
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    size_t r = rows;
+    do {
+      const float vx0 = i[0];
+      const float vx1 = i[1];
+      const float vx2 = i[2];
+      const float vx3 = i[3];
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 += vx0;
+      vacc1 += vx1;
+      vacc2 += vx2;
+      vacc3 += vx3;
+    } while (--r != 0);
+
+    output[0] += vacc0 * vscale;
+    output[1] += vacc1 * vscale;
+    output[2] += vacc2 * vscale;
+    output[3] += vacc3 * vscale;
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = 0.0f;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc += vx;
+      } while (--r != 0);
+
+      *output++ += vacc * vscale;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsumsq_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vscale = params->scalar.scale;
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    size_t r = rows;
+    do {
+      const float vx0 = i[0];
+      const float vx1 = i[1];
+      const float vx2 = i[2];
+      const float vx3 = i[3];
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 += vx0 * vx0;
+      vacc1 += vx1 * vx1;
+      vacc2 += vx2 * vx2;
+      vacc3 += vx3 * vx3;
+    } while (--r != 0);
+
+    output[0] += vacc0 * vscale;
+    output[1] += vacc1 * vscale;
+    output[2] += vacc2 * vscale;
+    output[3] += vacc3 * vscale;
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = 0.0f;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc += vx * vx;
+      } while (--r != 0);
+
+      *output++ += vacc * vscale;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rmax_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vacc0 = *output;
+  float vacc1 = vacc0;
+  float vacc2 = vacc0;
+  float vacc3 = vacc0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vacc0 = math_max_f32(vacc0, vx0);
+    vacc1 = math_max_f32(vacc1, vx1);
+    vacc2 = math_max_f32(vacc2, vx2);
+    vacc3 = math_max_f32(vacc3, vx3);
+  }
+  vacc0 = math_max_f32(vacc0, vacc1);
+  vacc2 = math_max_f32(vacc2, vacc3);
+  vacc0 = math_max_f32(vacc0, vacc2);
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc0 = math_max_f32(vacc0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output = vacc0;
+}
+
+void xnn_f32_rmin_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vacc0 = *output;
+  float vacc1 = vacc0;
+  float vacc2 = vacc0;
+  float vacc3 = vacc0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vacc0 = math_min_f32(vacc0, vx0);
+    vacc1 = math_min_f32(vacc1, vx1);
+    vacc2 = math_min_f32(vacc2, vx2);
+    vacc3 = math_min_f32(vacc3, vx3);
+  }
+  vacc0 = math_min_f32(vacc0, vacc1);
+  vacc2 = math_min_f32(vacc2, vacc3);
+  vacc0 = math_min_f32(vacc0, vacc2);
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc0 = math_min_f32(vacc0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output = vacc0;
+}
+
+void xnn_f32_rminmax_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vmin0 = output[0];
+  float vmax0 = output[1];
+  float vmin1 = vmin0;
+  float vmax1 = vmax0;
+  float vmin2 = vmin0;
+  float vmax2 = vmax0;
+  float vmin3 = vmin0;
+  float vmax3 = vmax0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vmin0 = math_min_f32(vmin0, vx0);
+    vmax0 = math_max_f32(vmax0, vx0);
+    vmin1 = math_min_f32(vmin1, vx1);
+    vmax1 = math_max_f32(vmax1, vx1);
+    vmin2 = math_min_f32(vmin2, vx2);
+    vmax2 = math_max_f32(vmax2, vx2);
+    vmin3 = math_min_f32(vmin3, vx3);
+    vmax3 = math_max_f32(vmax3, vx3);
+  }
+  vmin0 = math_min_f32(vmin0, vmin1);
+  vmax0 = math_max_f32(vmax0, vmax1);
+  vmin2 = math_min_f32(vmin2, vmin3);
+  vmax2 = math_max_f32(vmax2, vmax3);
+  vmin0 = math_min_f32(vmin0, vmin2);
+  vmax0 = math_max_f32(vmax0, vmax2);
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vmin0 = math_min_f32(vmin0, vx);
+      vmax0 = math_max_f32(vmax0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  output[0] = vmin0;
+  output[1] = vmax0;
+}
+
+void xnn_f32_rsum_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vacc0 = 0.0f;
+  float vacc1 = vacc0;
+  float vacc2 = vacc0;
+  float vacc3 = vacc0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vacc0 += vx0;
+    vacc1 += vx1;
+    vacc2 += vx2;
+    vacc3 += vx3;
+  }
+  vacc0 += vacc1;
+  vacc2 += vacc3;
+  vacc0 += vacc2;
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc0 += vx;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output += vacc0 * params->scalar.scale;
+}
+
+void xnn_f32_rsumsq_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vacc0 = 0.0f;
+  float vacc1 = vacc0;
+  float vacc2 = vacc0;
+  float vacc3 = vacc0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vacc0 += vx0 * vx0;
+    vacc1 += vx1 * vx1;
+    vacc2 += vx2 * vx2;
+    vacc3 += vx3 * vx3;
+  }
+  vacc0 += vacc1;
+  vacc2 += vacc3;
+  vacc0 += vacc2;
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc0 += vx * vx;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output += vacc0 * params->scalar.scale;
+}
+
+void xnn_f32_rnorm_ukernel__scalar_x4(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  float vsum0 = 0.0f;
+  float vsum1 = 0.0f;
+  float vsumsq0 = 0.0f;
+  float vsumsq1 = 0.0f;
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const float vd0 = i[0] - vshift;
+    const float vd1 = i[1] - vshift;
+    const float vd2 = i[2] - vshift;
+    const float vd3 = i[3] - vshift;
+    i += 4;
+
+    vsum0 += vd0;
+    vsum1 += vd1;
+    vsumsq0 += vd0 * vd0;
+    vsumsq1 += vd1 * vd1;
+    vsum0 += vd2;
+    vsum1 += vd3;
+    vsumsq0 += vd2 * vd2;
+    vsumsq1 += vd3 * vd3;
+  }
+  for (; channels != 0; channels -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum0 += vd;
+    vsumsq0 += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = (vsum0 + vsum1) * vinv_n;
+  const float vmeansq = (vsumsq0 + vsumsq1) * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (; n >= 4; n -= 4) {
+    const float vx0 = i[0];
+    const float vx1 = i[1];
+    const float vx2 = i[2];
+    const float vx3 = i[3];
+    i += 4;
+
+    const float vscale0 = gamma[0] * vrstd;
+    const float vscale1 = gamma[1] * vrstd;
+    const float vscale2 = gamma[2] * vrstd;
+    const float vscale3 = gamma[3] * vrstd;
+    gamma += 4;
+
+    o[0] = (vx0 - vmean) * vscale0 + beta[0];
+    o[1] = (vx1 - vmean) * vscale1 + beta[1];
+    o[2] = (vx2 - vmean) * vscale2 + beta[2];
+    o[3] = (vx3 - vmean) * vscale3 + beta[3];
+    beta += 4;
+    o += 4;
+  }
+  for (; n != 0; n -= 1) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
+
+void xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vc3 = 0x1.2444F2p-5f;
+  const float vc1 = 0x1.988454p-1f;
+  const float vhalf = 0.5f;
+  const float vneg_sat_cutoff = -0x1.F9F09Ep+2f;
+  const float vsat_cutoff = 0x1.F9F09Ep+2f;
+  const float valpha_13 = -0x1.3E4B80p-52f;
+  const float valpha_11 = 0x1.C266FCp-43f;
+  const float valpha_9 = -0x1.7A6FFEp-34f;
+  const float valpha_7 = 0x1.B80082p-25f;
+  const float valpha_5 = 0x1.F28694p-17f;
+  const float valpha_3 = 0x1.4E1BDAp-11f;
+  const float valpha_1 = 0x1.40B3B8p-8f;
+  const float vbeta_6 = 0x1.41A7B0p-20f;
+  const float vbeta_4 = 0x1.F12BACp-14f;
+  const float vbeta_2 = 0x1.29540Ap-9f;
+  const float vbeta_0 = 0x1.40B3BAp-8f;
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    const float vx20 = vx0 * vx0;
+    const float vx21 = vx1 * vx1;
+    const float vx22 = vx2 * vx2;
+    const float vx23 = vx3 * vx3;
+
+    float vu0 = vx20 * vc3 + vc1;
+    float vu1 = vx21 * vc3 + vc1;
+    float vu2 = vx22 * vc3 + vc1;
+    float vu3 = vx23 * vc3 + vc1;
+
+    vu0 = vx0 * vu0;
+    vu1 = vx1 * vu1;
+    vu2 = vx2 * vu2;
+    vu3 = vx3 * vu3;
+
+    vu0 = math_max_f32(vu0, vneg_sat_cutoff);
+    vu1 = math_max_f32(vu1, vneg_sat_cutoff);
+    vu2 = math_max_f32(vu2, vneg_sat_cutoff);
+    vu3 = math_max_f32(vu3, vneg_sat_cutoff);
+
+    vu0 = math_min_f32(vu0, vsat_cutoff);
+    vu1 = math_min_f32(vu1, vsat_cutoff);
+    vu2 = math_min_f32(vu2, vsat_cutoff);
+    vu3 = math_min_f32(vu3, vsat_cutoff);
+
+    const float vu20 = vu0 * vu0;
+    const float vu21 = vu1 * vu1;
+    const float vu22 = vu2 * vu2;
+    const float vu23 = vu3 * vu3;
+
+    float vp0 = vu20 * valpha_13 + valpha_11;
+    float vp1 = vu21 * valpha_13 + valpha_11;
+    float vp2 = vu22 * valpha_13 + valpha_11;
+    float vp3 = vu23 * valpha_13 + valpha_11;
+
+    vp0 = vu20 * vp0 + valpha_9;
+    vp1 = vu21 * vp1 + valpha_9;
+    vp2 = vu22 * vp2 + valpha_9;
+    vp3 = vu23 * vp3 + valpha_9;
+
+    vp0 = vu20 * vp0 + valpha_7;
+    vp1 = vu21 * vp1 + valpha_7;
+    vp2 = vu22 * vp2 + valpha_7;
+    vp3 = vu23 * vp3 + valpha_7;
+
+    vp0 = vu20 * vp0 + valpha_5;
+    vp1 = vu21 * vp1 + valpha_5;
+    vp2 = vu22 * vp2 + valpha_5;
+    vp3 = vu23 * vp3 + valpha_5;
+
+    vp0 = vu20 * vp0 + valpha_3;
+    vp1 = vu21 * vp1 + valpha_3;
+    vp2 = vu22 * vp2 + valpha_3;
+    vp3 = vu23 * vp3 + valpha_3;
+
+    vp0 = vu20 * vp0 + valpha_1;
+    vp1 = vu21 * vp1 + valpha_1;
+    vp2 = vu22 * vp2 + valpha_1;
+    vp3 = vu23 * vp3 + valpha_1;
+
+    vp0 = vu0 * vp0;
+    vp1 = vu1 * vp1;
+    vp2 = vu2 * vp2;
+    vp3 = vu3 * vp3;
+
+    float vq0 = vu20 * vbeta_6 + vbeta_4;
+    float vq1 = vu21 * vbeta_6 + vbeta_4;
+    float vq2 = vu22 * vbeta_6 + vbeta_4;
+    float vq3 = vu23 * vbeta_6 + vbeta_4;
+
+    vq0 = vu20 * vq0 + vbeta_2;
+    vq1 = vu21 * vq1 + vbeta_2;
+    vq2 = vu22 * vq2 + vbeta_2;
+    vq3 = vu23 * vq3 + vbeta_2;
+
+    vq0 = vu20 * vq0 + vbeta_0;
+    vq1 = vu21 * vq1 + vbeta_0;
+    vq2 = vu22 * vq2 + vbeta_0;
+    vq3 = vu23 * vq3 + vbeta_0;
+
+    const float vt0 = vp0 / vq0;
+    const float vt1 = vp1 / vq1;
+    const float vt2 = vp2 / vq2;
+    const float vt3 = vp3 / vq3;
+
+    const float vhalfx0 = vx0 * vhalf;
+    const float vhalfx1 = vx1 * vhalf;
+    const float vhalfx2 = vx2 * vhalf;
+    const float vhalfx3 = vx3 * vhalf;
+
+    const float vy0 = vhalfx0 * vt0 + vhalfx0;
+    const float vy1 = vhalfx1 * vt1 + vhalfx1;
+    const float vy2 = vhalfx2 * vt2 + vhalfx2;
+    const float vy3 = vhalfx3 * vt3 + vhalfx3;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      const float vx2 = vx * vx;
+
+      float vu = vx2 * vc3 + vc1;
+      vu = vx * vu;
+
+      vu = math_max_f32(vu, vneg_sat_cutoff);
+      vu = math_min_f32(vu, vsat_cutoff);
+
+      const float vu2 = vu * vu;
+
+      float vp = vu2 * valpha_13 + valpha_11;
+      vp = vu2 * vp + valpha_9;
+      vp = vu2 * vp + valpha_7;
+      vp = vu2 * vp + valpha_5;
+      vp = vu2 * vp + valpha_3;
+      vp = vu2 * vp + valpha_1;
+      vp = vu * vp;
+
+      float vq = vu2 * vbeta_6 + vbeta_4;
+      vq = vu2 * vq + vbeta_2;
+      vq = vu2 * vq + vbeta_0;
+
+      const float vt = vp / vq;
+
+      const float vhalfx = vx * vhalf;
+      const float vy = vhalfx * vt + vhalfx;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
+
+void xnn_f32_vexp_ukernel__scalar_rr2_p5_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vmagic_bias = 0x1.800000p+23f;
+  // The smallest x for which expf(x) is non-zero.
+  const float vzero_cutoff = -0x1.9FE368p+6f;
+  // The largest x for which expf(x) is finite.
+  const float vinf_cutoff = 0x1.62E42Ep+6f;
+  const float vlog2e = 0x1.715476p+0f;
+  const float vminus_ln2_hi = -0x1.62E400p-1f;
+  const float vminus_ln2_lo = -0x1.7F7D1Cp-20f;
+  const float vplus_inf = INFINITY;
+  const float vc5 = 0x1.0F9F9Cp-7f;
+  const float vc4 = 0x1.573A1Ap-5f;
+  const float vc3 = 0x1.555A80p-3f;
+  const float vc2 = 0x1.FFFDC6p-2f;
+  const float vc1 = 0x1.FFFFF6p-1f;
+  const int32_t vmin_exponent = -INT32_C(0x3F000000);
+  const int32_t vmax_exponent = INT32_C(0x3F800000);
+  const uint32_t vdefault_exponent = UINT32_C(0x3F800000);
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    float vn0 = vx0 * vlog2e + vmagic_bias;
+    float vn1 = vx1 * vlog2e + vmagic_bias;
+    float vn2 = vx2 * vlog2e + vmagic_bias;
+    float vn3 = vx3 * vlog2e + vmagic_bias;
+
+    int32_t veo0 = (int32_t) (float_as_uint32(vn0) << 23);
+    int32_t veo1 = (int32_t) (float_as_uint32(vn1) << 23);
+    int32_t veo2 = (int32_t) (float_as_uint32(vn2) << 23);
+    int32_t veo3 = (int32_t) (float_as_uint32(vn3) << 23);
+
+    int32_t ven0 = math_max_s32(veo0, vmin_exponent);
+    int32_t ven1 = math_max_s32(veo1, vmin_exponent);
+    int32_t ven2 = math_max_s32(veo2, vmin_exponent);
+    int32_t ven3 = math_max_s32(veo3, vmin_exponent);
+
+    ven0 = math_min_s32(ven0, vmax_exponent);
+    ven1 = math_min_s32(ven1, vmax_exponent);
+    ven2 = math_min_s32(ven2, vmax_exponent);
+    ven3 = math_min_s32(ven3, vmax_exponent);
+
+    veo0 -= ven0;
+    veo1 -= ven1;
+    veo2 -= ven2;
+    veo3 -= ven3;
+
+    const float vsn0 = uint32_as_float((uint32_t) ven0 + vdefault_exponent);
+    const float vsn1 = uint32_as_float((uint32_t) ven1 + vdefault_exponent);
+    const float vsn2 = uint32_as_float((uint32_t) ven2 + vdefault_exponent);
+    const float vsn3 = uint32_as_float((uint32_t) ven3 + vdefault_exponent);
+
+    const float vso0 = uint32_as_float((uint32_t) veo0 + vdefault_exponent);
+    const float vso1 = uint32_as_float((uint32_t) veo1 + vdefault_exponent);
+    const float vso2 = uint32_as_float((uint32_t) veo2 + vdefault_exponent);
+    const float vso3 = uint32_as_float((uint32_t) veo3 + vdefault_exponent);
+
+    vn0 -= vmagic_bias;
+    vn1 -= vmagic_bias;
+    vn2 -= vmagic_bias;
+    vn3 -= vmagic_bias;
+
+    float vt0 = vn0 * vminus_ln2_hi + vx0;
+    float vt1 = vn1 * vminus_ln2_hi + vx1;
+    float vt2 = vn2 * vminus_ln2_hi + vx2;
+    float vt3 = vn3 * vminus_ln2_hi + vx3;
+
+    vt0 = vn0 * vminus_ln2_lo + vt0;
+    vt1 = vn1 * vminus_ln2_lo + vt1;
+    vt2 = vn2 * vminus_ln2_lo + vt2;
+    vt3 = vn3 * vminus_ln2_lo + vt3;
+
+    float vp0 = vc5 * vt0 + vc4;
+    float vp1 = vc5 * vt1 + vc4;
+    float vp2 = vc5 * vt2 + vc4;
+    float vp3 = vc5 * vt3 + vc4;
+
+    vp0 = vp0 * vt0 + vc3;
+    vp1 = vp1 * vt1 + vc3;
+    vp2 = vp2 * vt2 + vc3;
+    vp3 = vp3 * vt3 + vc3;
+
+    vp0 = vp0 * vt0 + vc2;
+    vp1 = vp1 * vt1 + vc2;
+    vp2 = vp2 * vt2 + vc2;
+    vp3 = vp3 * vt3 + vc2;
+
+    vp0 = vp0 * vt0 + vc1;
+    vp1 = vp1 * vt1 + vc1;
+    vp2 = vp2 * vt2 + vc1;
+    vp3 = vp3 * vt3 + vc1;
+
+    vt0 *= vso0;
+    vt1 *= vso1;
+    vt2 *= vso2;
+    vt3 *= vso3;
+
+    float vy0 = vsn0 * (vt0 * vp0 + vso0);
+    float vy1 = vsn1 * (vt1 * vp1 + vso1);
+    float vy2 = vsn2 * (vt2 * vp2 + vso2);
+    float vy3 = vsn3 * (vt3 * vp3 + vso3);
+
+    if XNN_UNPREDICTABLE(vx0 < vzero_cutoff) {
+      vy0 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx1 < vzero_cutoff) {
+      vy1 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx2 < vzero_cutoff) {
+      vy2 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx3 < vzero_cutoff) {
+      vy3 = 0.0f;
+    }
+
+    if XNN_UNPREDICTABLE(vx0 > vinf_cutoff) {
+      vy0 = vplus_inf;
+    }
+    if XNN_UNPREDICTABLE(vx1 > vinf_cutoff) {
+      vy1 = vplus_inf;
+    }
+    if XNN_UNPREDICTABLE(vx2 > vinf_cutoff) {
+      vy2 = vplus_inf;
+    }
+    if XNN_UNPREDICTABLE(vx3 > vinf_cutoff) {
+      vy3 = vplus_inf;
+    }
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      float vn = vx * vlog2e + vmagic_bias;
+
+      int32_t veo = (int32_t) (float_as_uint32(vn) << 23);
+      int32_t ven = math_max_s32(veo, vmin_exponent);
+      ven = math_min_s32(ven, vmax_exponent);
+      veo -= ven;
+      const float vsn = uint32_as_float((uint32_t) ven + vdefault_exponent);
+      const float vso = uint32_as_float((uint32_t) veo + vdefault_exponent);
+
+      vn -= vmagic_bias;
+
+      float vt = vn * vminus_ln2_hi + vx;
+      vt = vn * vminus_ln2_lo + vt;
+
+      float vp = vc5 * vt + vc4;
+      vp = vp * vt + vc3;
+      vp = vp * vt + vc2;
+      vp = vp * vt + vc1;
+
+      vt *= vso;
+      float vy = vsn * (vt * vp + vso);
+
+      if XNN_UNPREDICTABLE(vx < vzero_cutoff) {
+        vy = 0.0f;
+      }
+      if XNN_UNPREDICTABLE(vx > vinf_cutoff) {
+        vy = vplus_inf;
+      }
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
+
+void xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vsqrt1_2 = 0x1.6A09E6p-1f;
+  const float vneg_erf_cutoff = -0x1.000000p+2f;
+  const float verf_cutoff = 0x1.000000p+2f;
+  const float valpha_13 = -0x1.2BBE16p-32f;
+  const float valpha_11 = 0x1.DBFFDCp-26f;
+  const float valpha_9 = -0x1.19FEA2p-19f;
+  const float valpha_7 = -0x1.DD85A4p-15f;
+  const float valpha_5 = -0x1.8158C6p-11f;
+  const float valpha_3 = -0x1.8343ECp-9f;
+  const float valpha_1 = -0x1.07B7A8p-6f;
+  const float vbeta_8 = -0x1.E8C19Ap-17f;
+  const float vbeta_6 = -0x1.BF7A52p-13f;
+  const float vbeta_4 = -0x1.B9249Cp-10f;
+  const float vbeta_2 = -0x1.E337F0p-8f;
+  const float vbeta_0 = -0x1.D36D4Ep-7f;
+  const float vhalf = 0.5f;
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    float vz0 = vx0 * vsqrt1_2;
+    float vz1 = vx1 * vsqrt1_2;
+    float vz2 = vx2 * vsqrt1_2;
+    float vz3 = vx3 * vsqrt1_2;
+
+    vz0 = math_max_f32(vz0, vneg_erf_cutoff);
+    vz1 = math_max_f32(vz1, vneg_erf_cutoff);
+    vz2 = math_max_f32(vz2, vneg_erf_cutoff);
+    vz3 = math_max_f32(vz3, vneg_erf_cutoff);
+
+    vz0 = math_min_f32(vz0, verf_cutoff);
+    vz1 = math_min_f32(vz1, verf_cutoff);
+    vz2 = math_min_f32(vz2, verf_cutoff);
+    vz3 = math_min_f32(vz3, verf_cutoff);
+
+    const float vz20 = vz0 * vz0;
+    const float vz21 = vz1 * vz1;
+    const float vz22 = vz2 * vz2;
+    const float vz23 = vz3 * vz3;
+
+    float vp0 = vz20 * valpha_13 + valpha_11;
+    float vp1 = vz21 * valpha_13 + valpha_11;
+    float vp2 = vz22 * valpha_13 + valpha_11;
+    float vp3 = vz23 * valpha_13 + valpha_11;
+
+    vp0 = vz20 * vp0 + valpha_9;
+    vp1 = vz21 * vp1 + valpha_9;
+    vp2 = vz22 * vp2 + valpha_9;
+    vp3 = vz23 * vp3 + valpha_9;
+
+    vp0 = vz20 * vp0 + valpha_7;
+    vp1 = vz21 * vp1 + valpha_7;
+    vp2 = vz22 * vp2 + valpha_7;
+    vp3 = vz23 * vp3 + valpha_7;
+
+    vp0 = vz20 * vp0 + valpha_5;
+    vp1 = vz21 * vp1 + valpha_5;
+    vp2 = vz22 * vp2 + valpha_5;
+    vp3 = vz23 * vp3 + valpha_5;
+
+    vp0 = vz20 * vp0 + valpha_3;
+    vp1 = vz21 * vp1 + valpha_3;
+    vp2 = vz22 * vp2 + valpha_3;
+    vp3 = vz23 * vp3 + valpha_3;
+
+    vp0 = vz20 * vp0 + valpha_1;
+    vp1 = vz21 * vp1 + valpha_1;
+    vp2 = vz22 * vp2 + valpha_1;
+    vp3 = vz23 * vp3 + valpha_1;
+
+    vp0 = vz0 * vp0;
+    vp1 = vz1 * vp1;
+    vp2 = vz2 * vp2;
+    vp3 = vz3 * vp3;
+
+    float vq0 = vz20 * vbeta_8 + vbeta_6;
+    float vq1 = vz21 * vbeta_8 + vbeta_6;
+    float vq2 = vz22 * vbeta_8 + vbeta_6;
+    float vq3 = vz23 * vbeta_8 + vbeta_6;
+
+    vq0 = vz20 * vq0 + vbeta_4;
+    vq1 = vz21 * vq1 + vbeta_4;
+    vq2 = vz22 * vq2 + vbeta_4;
+    vq3 = vz23 * vq3 + vbeta_4;
+
+    vq0 = vz20 * vq0 + vbeta_2;
+    vq1 = vz21 * vq1 + vbeta_2;
+    vq2 = vz22 * vq2 + vbeta_2;
+    vq3 = vz23 * vq3 + vbeta_2;
+
+    vq0 = vz20 * vq0 + vbeta_0;
+    vq1 = vz21 * vq1 + vbeta_0;
+    vq2 = vz22 * vq2 + vbeta_0;
+    vq3 = vz23 * vq3 + vbeta_0;
+
+    const float verf0 = vp0 / vq0;
+    const float verf1 = vp1 / vq1;
+    const float verf2 = vp2 / vq2;
+    const float verf3 = vp3 / vq3;
+
+    const float vhalfx0 = vx0 * vhalf;
+    const float vhalfx1 = vx1 * vhalf;
+    const float vhalfx2 = vx2 * vhalf;
+    const float vhalfx3 = vx3 * vhalf;
+
+    const float vy0 = vhalfx0 * verf0 + vhalfx0;
+    const float vy1 = vhalfx1 * verf1 + vhalfx1;
+    const float vy2 = vhalfx2 * verf2 + vhalfx2;
+    const float vy3 = vhalfx3 * verf3 + vhalfx3;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      float vz = vx * vsqrt1_2;
+      vz = math_max_f32(vz, vneg_erf_cutoff);
+      vz = math_min_f32(vz, verf_cutoff);
+
+      const float vz2 = vz * vz;
+
+      float vp = vz2 * valpha_13 + valpha_11;
+      vp = vz2 * vp + valpha_9;
+      vp = vz2 * vp + valpha_7;
+      vp = vz2 * vp + valpha_5;
+      vp = vz2 * vp + valpha_3;
+      vp = vz2 * vp + valpha_1;
+      vp = vz * vp;
+
+      float vq = vz2 * vbeta_8 + vbeta_6;
+      vq = vz2 * vq + vbeta_4;
+      vq = vz2 * vq + vbeta_2;
+      vq = vz2 * vq + vbeta_0;
+
+      const float verf = vp / vq;
+
+      const float vhalfx = vx * vhalf;
+      const float vy = vhalfx * verf + vhalfx;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
+
+void xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vmagic_bias = 0x1.8000FEp23f;
+  const float vminus_log2e = -0x1.715476p0f;
+  const float vln2_hi = 0x1.62E400p-1f;
+  const float vln2_lo = 0x1.7F7D1Cp-20f;
+  const float vc5 = -0x1.0F9F9Cp-7f;
+  const float vc4 = 0x1.573A1Ap-5f;
+  const float vc3 = -0x1.555A80p-3f;
+  const float vc2 = 0x1.FFFDC6p-2f;
+  const float vc1 = -0x1.FFFFF6p-1f;
+  const float vone = 1.0f;
+  const float vdenorm_cutoff = 0x1.5D589Ep+6f;
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    const float vz0 = fabsf(vx0);
+    const float vz1 = fabsf(vx1);
+    const float vz2 = fabsf(vx2);
+    const float vz3 = fabsf(vx3);
+
+    float vn0 = vz0 * vminus_log2e + vmagic_bias;
+    float vn1 = vz1 * vminus_log2e + vmagic_bias;
+    float vn2 = vz2 * vminus_log2e + vmagic_bias;
+    float vn3 = vz3 * vminus_log2e + vmagic_bias;
+
+    const float vs0 = uint32_as_float(float_as_uint32(vn0) << 23);
+    const float vs1 = uint32_as_float(float_as_uint32(vn1) << 23);
+    const float vs2 = uint32_as_float(float_as_uint32(vn2) << 23);
+    const float vs3 = uint32_as_float(float_as_uint32(vn3) << 23);
+
+    vn0 -= vmagic_bias;
+    vn1 -= vmagic_bias;
+    vn2 -= vmagic_bias;
+    vn3 -= vmagic_bias;
+
+    float vt0 = vn0 * vln2_hi + vz0;
+    float vt1 = vn1 * vln2_hi + vz1;
+    float vt2 = vn2 * vln2_hi + vz2;
+    float vt3 = vn3 * vln2_hi + vz3;
+
+    vt0 = vn0 * vln2_lo + vt0;
+    vt1 = vn1 * vln2_lo + vt1;
+    vt2 = vn2 * vln2_lo + vt2;
+    vt3 = vn3 * vln2_lo + vt3;
+
+    float vp0 = vt0 * vc5 + vc4;
+    float vp1 = vt1 * vc5 + vc4;
+    float vp2 = vt2 * vc5 + vc4;
+    float vp3 = vt3 * vc5 + vc4;
+
+    vp0 = vt0 * vp0 + vc3;
+    vp1 = vt1 * vp1 + vc3;
+    vp2 = vt2 * vp2 + vc3;
+    vp3 = vt3 * vp3 + vc3;
+
+    vp0 = vt0 * vp0 + vc2;
+    vp1 = vt1 * vp1 + vc2;
+    vp2 = vt2 * vp2 + vc2;
+    vp3 = vt3 * vp3 + vc2;
+
+    vp0 = vt0 * vp0 + vc1;
+    vp1 = vt1 * vp1 + vc1;
+    vp2 = vt2 * vp2 + vc1;
+    vp3 = vt3 * vp3 + vc1;
+
+    vt0 *= vs0;
+    vt1 *= vs1;
+    vt2 *= vs2;
+    vt3 *= vs3;
+
+    const float ve0 = vt0 * vp0 + vs0;
+    const float ve1 = vt1 * vp1 + vs1;
+    const float ve2 = vt2 * vp2 + vs2;
+    const float ve3 = vt3 * vp3 + vs3;
+
+    const float vd0 = ve0 + vone;
+    const float vd1 = ve1 + vone;
+    const float vd2 = ve2 + vone;
+    const float vd3 = ve3 + vone;
+
+    float vf0 = ve0 / vd0;
+    float vf1 = ve1 / vd1;
+    float vf2 = ve2 / vd2;
+    float vf3 = ve3 / vd3;
+
+    if XNN_UNPREDICTABLE(vz0 > vdenorm_cutoff) {
+      vf0 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz1 > vdenorm_cutoff) {
+      vf1 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz2 > vdenorm_cutoff) {
+      vf2 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz3 > vdenorm_cutoff) {
+      vf3 = 0.0f;
+    }
+
+    if XNN_UNPREDICTABLE(vx0 > 0.0f) {
+      vf0 = vone - vf0;
+    }
+    if XNN_UNPREDICTABLE(vx1 > 0.0f) {
+      vf1 = vone - vf1;
+    }
+    if XNN_UNPREDICTABLE(vx2 > 0.0f) {
+      vf2 = vone - vf2;
+    }
+    if XNN_UNPREDICTABLE(vx3 > 0.0f) {
+      vf3 = vone - vf3;
+    }
+
+    const float vy0 = vx0 * vf0;
+    const float vy1 = vx1 * vf1;
+    const float vy2 = vx2 * vf2;
+    const float vy3 = vx3 * vf3;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      const float vz = fabsf(vx);
+
+      float vn = vz * vminus_log2e + vmagic_bias;
+      const float vs = uint32_as_float(float_as_uint32(vn) << 23);
+      vn -= vmagic_bias;
+
+      float vt = vn * vln2_hi + vz;
+      vt = vn * vln2_lo + vt;
+
+      float vp = vt * vc5 + vc4;
+      vp = vt * vp + vc3;
+      vp = vt * vp + vc2;
+      vp = vt * vp + vc1;
+
+      vt *= vs;
+      const float ve = vt * vp + vs;
+      const float vd = ve + vone;
+
+      float vf = ve / vd;
+      if XNN_UNPREDICTABLE(vz > vdenorm_cutoff) {
+        vf = 0.0f;
+      }
+      if XNN_UNPREDICTABLE(vx > 0.0f) {
+        vf = vone - vf;
+      }
+
+      const float vy = vx * vf;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
+
+void xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vneg_sat_cutoff = -0x1.F9F09Ep+2f;
+  const float vsat_cutoff = 0x1.F9F09Ep+2f;
+  const float valpha_13 = -0x1.3E4B80p-52f;
+  const float valpha_11 = 0x1.C266FCp-43f;
+  const float valpha_9 = -0x1.7A6FFEp-34f;
+  const float valpha_7 = 0x1.B80082p-25f;
+  const float valpha_5 = 0x1.F28694p-17f;
+  const float valpha_3 = 0x1.4E1BDAp-11f;
+  const float valpha_1 = 0x1.40B3B8p-8f;
+  const float vbeta_6 = 0x1.41A7B0p-20f;
+  const float vbeta_4 = 0x1.F12BACp-14f;
+  const float vbeta_2 = 0x1.29540Ap-9f;
+  const float vbeta_0 = 0x1.40B3BAp-8f;
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    float vx0 = input[0];
+    float vx1 = input[1];
+    float vx2 = input[2];
+    float vx3 = input[3];
+    input += 4;
+
+    vx0 = math_max_f32(vx0, vneg_sat_cutoff);
+    vx1 = math_max_f32(vx1, vneg_sat_cutoff);
+    vx2 = math_max_f32(vx2, vneg_sat_cutoff);
+    vx3 = math_max_f32(vx3, vneg_sat_cutoff);
+
+    vx0 = math_min_f32(vx0, vsat_cutoff);
+    vx1 = math_min_f32(vx1, vsat_cutoff);
+    vx2 = math_min_f32(vx2, vsat_cutoff);
+    vx3 = math_min_f32(vx3, vsat_cutoff);
+
+    const float vx20 = vx0 * vx0;
+    const float vx21 = vx1 * vx1;
+    const float vx22 = vx2 * vx2;
+    const float vx23 = vx3 * vx3;
+
+    float vp0 = vx20 * valpha_13 + valpha_11;
+    float vp1 = vx21 * valpha_13 + valpha_11;
+    float vp2 = vx22 * valpha_13 + valpha_11;
+    float vp3 = vx23 * valpha_13 + valpha_11;
+
+    vp0 = vx20 * vp0 + valpha_9;
+    vp1 = vx21 * vp1 + valpha_9;
+    vp2 = vx22 * vp2 + valpha_9;
+    vp3 = vx23 * vp3 + valpha_9;
+
+    vp0 = vx20 * vp0 + valpha_7;
+    vp1 = vx21 * vp1 + valpha_7;
+    vp2 = vx22 * vp2 + valpha_7;
+    vp3 = vx23 * vp3 + valpha_7;
+
+    vp0 = vx20 * vp0 + valpha_5;
+    vp1 = vx21 * vp1 + valpha_5;
+    vp2 = vx22 * vp2 + valpha_5;
+    vp3 = vx23 * vp3 + valpha_5;
+
+    vp0 = vx20 * vp0 + valpha_3;
+    vp1 = vx21 * vp1 + valpha_3;
+    vp2 = vx22 * vp2 + valpha_3;
+    vp3 = vx23 * vp3 + valpha_3;
+
+    vp0 = vx20 * vp0 + valpha_1;
+    vp1 = vx21 * vp1 + valpha_1;
+    vp2 = vx22 * vp2 + valpha_1;
+    vp3 = vx23 * vp3 + valpha_1;
+
+    vp0 = vx0 * vp0;
+    vp1 = vx1 * vp1;
+    vp2 = vx2 * vp2;
+    vp3 = vx3 * vp3;
+
+    float vq0 = vx20 * vbeta_6 + vbeta_4;
+    float vq1 = vx21 * vbeta_6 + vbeta_4;
+    float vq2 = vx22 * vbeta_6 + vbeta_4;
+    float vq3 = vx23 * vbeta_6 + vbeta_4;
+
+    vq0 = vx20 * vq0 + vbeta_2;
+    vq1 = vx21 * vq1 + vbeta_2;
+    vq2 = vx22 * vq2 + vbeta_2;
+    vq3 = vx23 * vq3 + vbeta_2;
+
+    vq0 = vx20 * vq0 + vbeta_0;
+    vq1 = vx21 * vq1 + vbeta_0;
+    vq2 = vx22 * vq2 + vbeta_0;
+    vq3 = vx23 * vq3 + vbeta_0;
+
+    const float vy0 = vp0 / vq0;
+    const float vy1 = vp1 / vq1;
+    const float vy2 = vp2 / vq2;
+    const float vy3 = vp3 / vq3;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      float vx = *input++;
+
+      vx = math_max_f32(vx, vneg_sat_cutoff);
+      vx = math_min_f32(vx, vsat_cutoff);
+
+      const float vx2 = vx * vx;
+
+      float vp = vx2 * valpha_13 + valpha_11;
+      vp = vx2 * vp + valpha_9;
+      vp = vx2 * vp + valpha_7;
+      vp = vx2 * vp + valpha_5;
+      vp = vx2 * vp + valpha_3;
+      vp = vx2 * vp + valpha_1;
+      vp = vx * vp;
+
+      float vq = vx2 * vbeta_6 + vbeta_4;
+      vq = vx2 * vq + vbeta_2;
+      vq = vx2 * vq + vbeta_0;
+
+      const float vy = vp / vq;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
+
+void xnn_qc4_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const uint8_t* i = (const uint8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      // Sign-extend each nibble by shifting it into the top bits of a 32-bit word and arithmetically shifting it back.
+      const uint32_t vx01 = (uint32_t) i[0];
+      const uint32_t vx23 = (uint32_t) i[1];
+      vacc0 += (float) math_asr_s32((int32_t) (vx01 << 28), 28) * vrow_scale;
+      vacc1 += (float) math_asr_s32((int32_t) (vx01 << 24), 28) * vrow_scale;
+      vacc2 += (float) math_asr_s32((int32_t) (vx23 << 28), 28) * vrow_scale;
+      vacc3 += (float) math_asr_s32((int32_t) (vx23 << 24), 28) * vrow_scale;
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 2;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const uint8_t* i = (const uint8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const float vrow_scale = row_scale[index];
+
+      const uint32_t vx01 = (uint32_t) i[0];
+      vacc0 += (float) math_asr_s32((int32_t) (vx01 << 28), 28) * vrow_scale;
+      if (channels >= 2) {
+        vacc1 += (float) math_asr_s32((int32_t) (vx01 << 24), 28) * vrow_scale;
+        if (channels == 3) {
+          vacc2 += (float) math_asr_s32((int32_t) ((uint32_t) i[1] << 28), 28) * vrow_scale;
+        }
+      }
+    }
+    output[0] = vacc0 * vscale;
+    if (channels >= 2) {
+      output[1] = vacc1 * vscale;
+      if (channels == 3) {
+        output[2] = vacc2 * vscale;
+      }
+    }
+  }
+}
+
+void xnn_qc8_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      vacc0 += (float) (int32_t) i[0] * vrow_scale;
+      vacc1 += (float) (int32_t) i[1] * vrow_scale;
+      vacc2 += (float) (int32_t) i[2] * vrow_scale;
+      vacc3 += (float) (int32_t) i[3] * vrow_scale;
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 4;
+  }
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      vacc += (float) (int32_t) *i * row_scale[index];
+    }
+    *output++ = vacc * vscale;
+    offset += 1;
+  }
+}
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+
+  const int8_t* a0 = a;
+  float* c0 = c;
+
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const float vinput_scale0 = quantization_params[0].scale;
+  const float voutput_min = params->scalar.min;
+  const float voutput_max = params->scalar.max;
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    int32_t vacc0x0 = vksum0 * vinput_zero_point0;
+    int32_t vacc0x1 = vksum1 * vinput_zero_point0;
+    int32_t vacc0x2 = vksum2 * vinput_zero_point0;
+    int32_t vacc0x3 = vksum3 * vinput_zero_point0;
+    w = (const void*) ((const int32_t*) w + 4);
+
+    size_t k = kc;
+    do {
+      const int32_t va0 = (int32_t) *a0++;
+
+      const int32_t vb0 = (int32_t) ((const int8_t*) w)[0];
+      const int32_t vb1 = (int32_t) ((const int8_t*) w)[1];
+      const int32_t vb2 = (int32_t) ((const int8_t*) w)[2];
+      const int32_t vb3 = (int32_t) ((const int8_t*) w)[3];
+      w = (const void*) ((const int8_t*) w + 4);
+
+      vacc0x0 += va0 * vb0;
+      vacc0x1 += va0 * vb1;
+      vacc0x2 += va0 * vb2;
+      vacc0x3 += va0 * vb3;
+
+      k -= sizeof(int8_t);
+    } while (k != 0);
+
+    float vout0x0 = (float) vacc0x0 * vinput_scale0;
+    float vout0x1 = (float) vacc0x1 * vinput_scale0;
+    float vout0x2 = (float) vacc0x2 * vinput_scale0;
+    float vout0x3 = (float) vacc0x3 * vinput_scale0;
+
+    const float vfilter_scale0 = ((const float*) w)[0];
+    vout0x0 *= vfilter_scale0;
+    const float vfilter_scale1 = ((const float*) w)[1];
+    vout0x1 *= vfilter_scale1;
+    const float vfilter_scale2 = ((const float*) w)[2];
+    vout0x2 *= vfilter_scale2;
+    const float vfilter_scale3 = ((const float*) w)[3];
+    vout0x3 *= vfilter_scale3;
+    const float vbias0 = ((const float*) w)[4];
+    vout0x0 += vbias0;
+    const float vbias1 = ((const float*) w)[5];
+    vout0x1 += vbias1;
+    const float vbias2 = ((const float*) w)[6];
+    vout0x2 += vbias2;
+    const float vbias3 = ((const float*) w)[7];
+    vout0x3 += vbias3;
+    w = (const void*) ((const float*) w + 8);
+
+    vout0x0 = math_max_f32(vout0x0, voutput_min);
+    vout0x1 = math_max_f32(vout0x1, voutput_min);
+    vout0x2 = math_max_f32(vout0x2, voutput_min);
+    vout0x3 = math_max_f32(vout0x3, voutput_min);
+
+    vout0x0 = math_min_f32(vout0x0, voutput_max);
+    vout0x1 = math_min_f32(vout0x1, voutput_max);
+    vout0x2 = math_min_f32(vout0x2, voutput_max);
+    vout0x3 = math_min_f32(vout0x3, voutput_max);
+
+    if XNN_LIKELY(nc >= 4) {
+      c0[0] = vout0x0;
+      c0[1] = vout0x1;
+      c0[2] = vout0x2;
+      c0[3] = vout0x3;
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c0[0] = vout0x0;
+        c0[1] = vout0x1;
+        vout0x0 = vout0x2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c0[0] = vout0x0;
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_4x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+
+  const int8_t* a0 = a;
+  float* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const int8_t* a2 = (const int8_t*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const int8_t* a3 = (const int8_t*) ((uintptr_t) a2 + a_stride);
+  float* c3 = (float*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  // Rows beyond mr alias the previous row, so their quantization parameters must alias as well.
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const float vinput_scale0 = quantization_params[0].scale;
+  const int32_t vinput_zero_point1 = quantization_params[min(mr - 1, 1)].zero_point;
+  const float vinput_scale1 = quantization_params[min(mr - 1, 1)].scale;
+  const int32_t vinput_zero_point2 = quantization_params[min(mr - 1, 2)].zero_point;
+  const float vinput_scale2 = quantization_params[min(mr - 1, 2)].scale;
+  const int32_t vinput_zero_point3 = quantization_params[min(mr - 1, 3)].zero_point;
+  const float vinput_scale3 = quantization_params[min(mr - 1, 3)].scale;
+  const float voutput_min = params->scalar.min;
+  const float voutput_max = params->scalar.max;
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    int32_t vacc0x0 = vksum0 * vinput_zero_point0;
+    int32_t vacc0x1 = vksum1 * vinput_zero_point0;
+    int32_t vacc0x2 = vksum2 * vinput_zero_point0;
+    int32_t vacc0x3 = vksum3 * vinput_zero_point0;
+    int32_t vacc1x0 = vksum0 * vinput_zero_point1;
+    int32_t vacc1x1 = vksum1 * vinput_zero_point1;
+    int32_t vacc1x2 = vksum2 * vinput_zero_point1;
+    int32_t vacc1x3 = vksum3 * vinput_zero_point1;
+    int32_t vacc2x0 = vksum0 * vinput_zero_point2;
+    int32_t vacc2x1 = vksum1 * vinput_zero_point2;
+    int32_t vacc2x2 = vksum2 * vinput_zero_point2;
+    int32_t vacc2x3 = vksum3 * vinput_zero_point2;
+    int32_t vacc3x0 = vksum0 * vinput_zero_point3;
+    int32_t vacc3x1 = vksum1 * vinput_zero_point3;
+    int32_t vacc3x2 = vksum2 * vinput_zero_point3;
+    int32_t vacc3x3 = vksum3 * vinput_zero_point3;
+    w = (const void*) ((const int32_t*) w + 4);
+
+    size_t k = kc;
+    do {
+      const int32_t va0 = (int32_t) *a0++;
+      const int32_t va1 = (int32_t) *a1++;
+      const int32_t va2 = (int32_t) *a2++;
+      const int32_t va3 = (int32_t) *a3++;
+
+      const int32_t vb0 = (int32_t) ((const int8_t*) w)[0];
+      const int32_t vb1 = (int32_t) ((const int8_t*) w)[1];
+      const int32_t vb2 = (int32_t) ((const int8_t*) w)[2];
+      const int32_t vb3 = (int32_t) ((const int8_t*) w)[3];
+      w = (const void*) ((const int8_t*) w + 4);
+
+      vacc0x0 += va0 * vb0;
+      vacc0x1 += va0 * vb1;
+      vacc0x2 += va0 * vb2;
+      vacc0x3 += va0 * vb3;
+      vacc1x0 += va1 * vb0;
+      vacc1x1 += va1 * vb1;
+      vacc1x2 += va1 * vb2;
+      vacc1x3 += va1 * vb3;
+      vacc2x0 += va2 * vb0;
+      vacc2x1 += va2 * vb1;
+      vacc2x2 += va2 * vb2;
+      vacc2x3 += va2 * vb3;
+      vacc3x0 += va3 * vb0;
+      vacc3x1 += va3 * vb1;
+      vacc3x2 += va3 * vb2;
+      vacc3x3 += va3 * vb3;
+
+      k -= sizeof(int8_t);
+    } while (k != 0);
+
+    float vout0x0 = (float) vacc0x0 * vinput_scale0;
+    float vout0x1 = (float) vacc0x1 * vinput_scale0;
+    float vout0x2 = (float) vacc0x2 * vinput_scale0;
+    float vout0x3 = (float) vacc0x3 * vinput_scale0;
+    float vout1x0 = (float) vacc1x0 * vinput_scale1;
+    float vout1x1 = (float) vacc1x1 * vinput_scale1;
+    float vout1x2 = (float) vacc1x2 * vinput_scale1;
+    float vout1x3 = (float) vacc1x3 * vinput_scale1;
+    float vout2x0 = (float) vacc2x0 * vinput_scale2;
+    float vout2x1 = (float) vacc2x1 * vinput_scale2;
+    float vout2x2 = (float) vacc2x2 * vinput_scale2;
+    float vout2x3 = (float) vacc2x3 * vinput_scale2;
+    float vout3x0 = (float) vacc3x0 * vinput_scale3;
+    float vout3x1 = (float) vacc3x1 * vinput_scale3;
+    float vout3x2 = (float) vacc3x2 * vinput_scale3;
+    float vout3x3 = (float) vacc3x3 * vinput_scale3;
+
+    const float vfilter_scale0 = ((const float*) w)[0];
+    vout0x0 *= vfilter_scale0;
+    vout1x0 *= vfilter_scale0;
+    vout2x0 *= vfilter_scale0;
+    vout3x0 *= vfilter_scale0;
+    const float vfilter_scale1 = ((const float*) w)[1];
+    vout0x1 *= vfilter_scale1;
+    vout1x1 *= vfilter_scale1;
+    vout2x1 *= vfilter_scale1;
+    vout3x1 *= vfilter_scale1;
+    const float vfilter_scale2 = ((const float*) w)[2];
+    vout0x2 *= vfilter_scale2;
+    vout1x2 *= vfilter_scale2;
+    vout2x2 *= vfilter_scale2;
+    vout3x2 *= vfilter_scale2;
+    const float vfilter_scale3 = ((const float*) w)[3];
+    vout0x3 *= vfilter_scale3;
+    vout1x3 *= vfilter_scale3;
+    vout2x3 *= vfilter_scale3;
+    vout3x3 *= vfilter_scale3;
+    const float vbias0 = ((const float*) w)[4];
+    vout0x0 += vbias0;
+    vout1x0 += vbias0;
+    vout2x0 += vbias0;
+    vout3x0 += vbias0;
+    const float vbias1 = ((const float*) w)[5];
+    vout0x1 += vbias1;
+    vout1x1 += vbias1;
+    vout2x1 += vbias1;
+    vout3x1 += vbias1;
+    const float vbias2 = ((const float*) w)[6];
+    vout0x2 += vbias2;
+    vout1x2 += vbias2;
+    vout2x2 += vbias2;
+    vout3x2 += vbias2;
+    const float vbias3 = ((const float*) w)[7];
+    vout0x3 += vbias3;
+    vout1x3 += vbias3;
+    vout2x3 += vbias3;
+    vout3x3 += vbias3;
+    w = (const void*) ((const float*) w + 8);
+
+    vout0x0 = math_max_f32(vout0x0, voutput_min);
+    vout0x1 = math_max_f32(vout0x1, voutput_min);
+    vout0x2 = math_max_f32(vout0x2, voutput_min);
+    vout0x3 = math_max_f32(vout0x3, voutput_min);
+    vout1x0 = math_max_f32(vout1x0, voutput_min);
+    vout1x1 = math_max_f32(vout1x1, voutput_min);
+    vout1x2 = math_max_f32(vout1x2, voutput_min);
+    vout1x3 = math_max_f32(vout1x3, voutput_min);
+    vout2x0 = math_max_f32(vout2x0, voutput_min);
+    vout2x1 = math_max_f32(vout2x1, voutput_min);
+    vout2x2 = math_max_f32(vout2x2, voutput_min);
+    vout2x3 = math_max_f32(vout2x3, voutput_min);
+    vout3x0 = math_max_f32(vout3x0, voutput_min);
+    vout3x1 = math_max_f32(vout3x1, voutput_min);
+    vout3x2 = math_max_f32(vout3x2, voutput_min);
+    vout3x3 = math_max_f32(vout3x3, voutput_min);
+
+    vout0x0 = math_min_f32(vout0x0, voutput_max);
+    vout0x1 = math_min_f32(vout0x1, voutput_max);
+    vout0x2 = math_min_f32(vout0x2, voutput_max);
+    vout0x3 = math_min_f32(vout0x3, voutput_max);
+    vout1x0 = math_min_f32(vout1x0, voutput_max);
+    vout1x1 = math_min_f32(vout1x1, voutput_max);
+    vout1x2 = math_min_f32(vout1x2, voutput_max);
+    vout1x3 = math_min_f32(vout1x3, voutput_max);
+    vout2x0 = math_min_f32(vout2x0, voutput_max);
+    vout2x1 = math_min_f32(vout2x1, voutput_max);
+    vout2x2 = math_min_f32(vout2x2, voutput_max);
+    vout2x3 = math_min_f32(vout2x3, voutput_max);
+    vout3x0 = math_min_f32(vout3x0, voutput_max);
+    vout3x1 = math_min_f32(vout3x1, voutput_max);
+    vout3x2 = math_min_f32(vout3x2, voutput_max);
+    vout3x3 = math_min_f32(vout3x3, voutput_max);
+
+    if XNN_LIKELY(nc >= 4) {
+      c0[0] = vout0x0;
+      c0[1] = vout0x1;
+      c0[2] = vout0x2;
+      c0[3] = vout0x3;
+      c1[0] = vout1x0;
+      c1[1] = vout1x1;
+      c1[2] = vout1x2;
+      c1[3] = vout1x3;
+      c2[0] = vout2x0;
+      c2[1] = vout2x1;
+      c2[2] = vout2x2;
+      c2[3] = vout2x3;
+      c3[0] = vout3x0;
+      c3[1] = vout3x1;
+      c3[2] = vout3x2;
+      c3[3] = vout3x3;
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const int8_t*) ((uintptr_t) a1 - kc);
+      a2 = (const int8_t*) ((uintptr_t) a2 - kc);
+      a3 = (const int8_t*) ((uintptr_t) a3 - kc);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+      c3 = (float*) ((uintptr_t) c3 + cn_stride);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c0[0] = vout0x0;
+        c0[1] = vout0x1;
+        vout0x0 = vout0x2;
+        c0 += 2;
+        c1[0] = vout1x0;
+        c1[1] = vout1x1;
+        vout1x0 = vout1x2;
+        c1 += 2;
+        c2[0] = vout2x0;
+        c2[1] = vout2x1;
+        vout2x0 = vout2x2;
+        c2 += 2;
+        c3[0] = vout3x0;
+        c3[1] = vout3x1;
+        vout3x0 = vout3x2;
+        c3 += 2;
+      }
+      if (nc & 1) {
+        c0[0] = vout0x0;
+        c1[0] = vout1x0;
+        c2[0] = vout2x0;
+        c3[0] = vout3x0;
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_qs8_rnorm_ukernel__scalar_x4(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+
+  // Statistics are exact: they are accumulated on zero-point-adjusted integers.
+  const int8_t* i = input;
+  int32_t vsum = 0;
+  int64_t vsumsq = 0;
+  size_t c = channels;
+  for (; c >= 4; c -= 4) {
+    const int32_t vd0 = (int32_t) i[0] - vinput_zero_point;
+    const int32_t vd1 = (int32_t) i[1] - vinput_zero_point;
+    const int32_t vd2 = (int32_t) i[2] - vinput_zero_point;
+    const int32_t vd3 = (int32_t) i[3] - vinput_zero_point;
+    i += 4;
+
+    vsum += vd0 + vd1 + vd2 + vd3;
+    vsumsq += (int64_t) (vd0 * vd0 + vd1 * vd1 + vd2 * vd2 + vd3 * vd3);
+  }
+  for (; c != 0; c -= 1) {
+    const int32_t vd = (int32_t) *i++ - vinput_zero_point;
+    vsum += vd;
+    vsumsq += (int64_t) (vd * vd);
+  }
+
+  const float vinv_n = 1.0f / (float) channels;
+  float vmean = 0.0f;
+  float vvar = (float) vsumsq * vinv_n;
+  if (params->scalar.subtract_mean) {
+    // n^2 * variance = n * sum(d^2) - sum(d)^2 is computed exactly in 64-bit integers.
+    const int64_t vscaled_var = (int64_t) channels * vsumsq - (int64_t) vsum * (int64_t) vsum;
+    vmean = (float) vsum * vinv_n;
+    vvar = (float) vscaled_var * (vinv_n * vinv_n);
+  }
+  const float vscale = params->scalar.inv_output_scale / sqrtf(vvar + params->scalar.epsilon);
+
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+  const float* gamma = weights;
+  const float* beta = weights + channels;
+  i = input;
+  int8_t* o = output;
+  for (c = channels; c >= 4; c -= 4) {
+    const float vd0 = (float) ((int32_t) i[0] - vinput_zero_point) - vmean;
+    const float vd1 = (float) ((int32_t) i[1] - vinput_zero_point) - vmean;
+    const float vd2 = (float) ((int32_t) i[2] - vinput_zero_point) - vmean;
+    const float vd3 = (float) ((int32_t) i[3] - vinput_zero_point) - vmean;
+    i += 4;
+
+    float vy0 = vd0 * (gamma[0] * vscale) + beta[0];
+    float vy1 = vd1 * (gamma[1] * vscale) + beta[1];
+    float vy2 = vd2 * (gamma[2] * vscale) + beta[2];
+    float vy3 = vd3 * (gamma[3] * vscale) + beta[3];
+    gamma += 4;
+    beta += 4;
+
+    vy0 = math_max_f32(vy0, voutput_min_less_zero_point);
+    vy1 = math_max_f32(vy1, voutput_min_less_zero_point);
+    vy2 = math_max_f32(vy2, voutput_min_less_zero_point);
+    vy3 = math_max_f32(vy3, voutput_min_less_zero_point);
+
+    vy0 = math_min_f32(vy0, voutput_max_less_zero_point);
+    vy1 = math_min_f32(vy1, voutput_max_less_zero_point);
+    vy2 = math_min_f32(vy2, voutput_max_less_zero_point);
+    vy3 = math_min_f32(vy3, voutput_max_less_zero_point);
+
+    vy0 += vmagic_bias;
+    vy1 += vmagic_bias;
+    vy2 += vmagic_bias;
+    vy3 += vmagic_bias;
+
+    o[0] = (int8_t) ((int32_t) float_as_uint32(vy0) - vmagic_bias_less_output_zero_point);
+    o[1] = (int8_t) ((int32_t) float_as_uint32(vy1) - vmagic_bias_less_output_zero_point);
+    o[2] = (int8_t) ((int32_t) float_as_uint32(vy2) - vmagic_bias_less_output_zero_point);
+    o[3] = (int8_t) ((int32_t) float_as_uint32(vy3) - vmagic_bias_less_output_zero_point);
+    o += 4;
+  }
+  for (; c != 0; c -= 1) {
+    const float vd = (float) ((int32_t) *i++ - vinput_zero_point) - vmean;
+    float vy = vd * (*gamma++ * vscale) + *beta++;
+    vy = math_max_f32(vy, voutput_min_less_zero_point);
+    vy = math_min_f32(vy, voutput_max_less_zero_point);
+    vy += vmagic_bias;
+    *o++ = (int8_t) ((int32_t) float_as_uint32(vy) - vmagic_bias_less_output_zero_point);
+  }
+}
+
 static inline uint32_t compute_sum(
     size_t n,
     const uint8_t* x,
@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <immintrin.h>
 
@@ -11,6 +12,7 @@
 #include <xnnpack/common.h>
 #include <xnnpack/conv.h>
 #include <xnnpack/dwconv.h>
+#include <xnnpack/embedding.h>
 #include <xnnpack/gavgpool.h>
 #include <xnnpack/gemm.h>
 #include <xnnpack/ibilinear.h>
@@ -20,7 +22,10 @@
 #include <xnnpack/maxpool.h>
 #include <xnnpack/packx.h>
 #include <xnnpack/pavgpool.h>
+#include <xnnpack/prefetch.h>
+#include <xnnpack/reduce.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/transpose.h>
 #include <xnnpack/vbinary.h>
@@ -4164,6 +4169,73 @@ void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__sse_2x4(
   } while (output_height != 0);
 }
 
+void xnn_f32_embedding_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 = _mm_add_ps(vacc0, _mm_loadu_ps(i + 0));
+      vacc1 = _mm_add_ps(vacc1, _mm_loadu_ps(i + 4));
+      vacc2 = _mm_add_ps(vacc2, _mm_loadu_ps(i + 8));
+      vacc3 = _mm_add_ps(vacc3, _mm_loadu_ps(i + 12));
+    }
+    _mm_storeu_ps(output + 0, _mm_mul_ps(vacc0, vscale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(vacc1, vscale));
+    _mm_storeu_ps(output + 8, _mm_mul_ps(vacc2, vscale));
+    _mm_storeu_ps(output + 12, _mm_mul_ps(vacc3, vscale));
+    output += 16;
+    offset += 16 * sizeof(float);
+  }
+  for (; channels >= 4; channels -= 4) {
+    __m128 vacc = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = _mm_add_ps(vacc, _mm_loadu_ps(i));
+    }
+    _mm_storeu_ps(output, _mm_mul_ps(vacc, vscale));
+    output += 4;
+    offset += 4 * sizeof(float);
+  }
+  for (; channels != 0; channels -= 1) {
+    __m128 vacc = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = _mm_add_ss(vacc, _mm_load_ss(i));
+    }
+    _mm_store_ss(output, _mm_mul_ss(vacc, vscale));
+    output += 1;
+    offset += sizeof(float);
+  }
+}
+
 void xnn_f32_gavgpool_cw_ukernel__sse_x4(
     size_t elements,
     size_t channels,
@@ -6498,6 +6570,586 @@ void xnn_f32_pavgpool_minmax_ukernel_9x__sse_c4(
   } while (--output_pixels != 0);
 }
 
+void xnn_f32_rdmax_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vacc0 = _mm_loadu_ps(output + 0);
+    __m128 vacc1 = _mm_loadu_ps(output + 4);
+    __m128 vacc2 = _mm_loadu_ps(output + 8);
+    __m128 vacc3 = _mm_loadu_ps(output + 12);
+    size_t r = rows;
+    do {
+      const __m128 vx0 = _mm_loadu_ps(i + 0);
+      const __m128 vx1 = _mm_loadu_ps(i + 4);
+      const __m128 vx2 = _mm_loadu_ps(i + 8);
+      const __m128 vx3 = _mm_loadu_ps(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm_max_ps(vacc0, vx0);
+      vacc1 = _mm_max_ps(vacc1, vx1);
+      vacc2 = _mm_max_ps(vacc2, vx2);
+      vacc3 = _mm_max_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output + 0, vacc0);
+    _mm_storeu_ps(output + 4, vacc1);
+    _mm_storeu_ps(output + 8, vacc2);
+    _mm_storeu_ps(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_load_ss(output);
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_max_ss(vacc, vx);
+      } while (--r != 0);
+
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdmin_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vacc0 = _mm_loadu_ps(output + 0);
+    __m128 vacc1 = _mm_loadu_ps(output + 4);
+    __m128 vacc2 = _mm_loadu_ps(output + 8);
+    __m128 vacc3 = _mm_loadu_ps(output + 12);
+    size_t r = rows;
+    do {
+      const __m128 vx0 = _mm_loadu_ps(i + 0);
+      const __m128 vx1 = _mm_loadu_ps(i + 4);
+      const __m128 vx2 = _mm_loadu_ps(i + 8);
+      const __m128 vx3 = _mm_loadu_ps(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm_min_ps(vacc0, vx0);
+      vacc1 = _mm_min_ps(vacc1, vx1);
+      vacc2 = _mm_min_ps(vacc2, vx2);
+      vacc3 = _mm_min_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output + 0, vacc0);
+    _mm_storeu_ps(output + 4, vacc1);
+    _mm_storeu_ps(output + 8, vacc2);
+    _mm_storeu_ps(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_min_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_load_ss(output);
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_min_ss(vacc, vx);
+      } while (--r != 0);
+
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsum_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx0 = _mm_loadu_ps(i + 0);
+      const __m128 vx1 = _mm_loadu_ps(i + 4);
+      const __m128 vx2 = _mm_loadu_ps(i + 8);
+      const __m128 vx3 = _mm_loadu_ps(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm_add_ps(vacc0, vx0);
+      vacc1 = _mm_add_ps(vacc1, vx1);
+      vacc2 = _mm_add_ps(vacc2, vx2);
+      vacc3 = _mm_add_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    vacc0 = _mm_add_ps(_mm_loadu_ps(output + 0), _mm_mul_ps(vacc0, vscale));
+    vacc1 = _mm_add_ps(_mm_loadu_ps(output + 4), _mm_mul_ps(vacc1, vscale));
+    vacc2 = _mm_add_ps(_mm_loadu_ps(output + 8), _mm_mul_ps(vacc2, vscale));
+    vacc3 = _mm_add_ps(_mm_loadu_ps(output + 12), _mm_mul_ps(vacc3, vscale));
+    _mm_storeu_ps(output + 0, vacc0);
+    _mm_storeu_ps(output + 4, vacc1);
+    _mm_storeu_ps(output + 8, vacc2);
+    _mm_storeu_ps(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_add_ps(vacc, vx);
+    } while (--r != 0);
+
+    vacc = _mm_add_ps(_mm_loadu_ps(output), _mm_mul_ps(vacc, vscale));
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_setzero_ps();
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_add_ss(vacc, vx);
+      } while (--r != 0);
+
+      vacc = _mm_add_ss(_mm_load_ss(output), _mm_mul_ss(vacc, vscale));
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rdsumsq_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx0 = _mm_loadu_ps(i + 0);
+      const __m128 vx1 = _mm_loadu_ps(i + 4);
+      const __m128 vx2 = _mm_loadu_ps(i + 8);
+      const __m128 vx3 = _mm_loadu_ps(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx0, vx0));
+      vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vx1, vx1));
+      vacc2 = _mm_add_ps(vacc2, _mm_mul_ps(vx2, vx2));
+      vacc3 = _mm_add_ps(vacc3, _mm_mul_ps(vx3, vx3));
+    } while (--r != 0);
+
+    vacc0 = _mm_add_ps(_mm_loadu_ps(output + 0), _mm_mul_ps(vacc0, vscale));
+    vacc1 = _mm_add_ps(_mm_loadu_ps(output + 4), _mm_mul_ps(vacc1, vscale));
+    vacc2 = _mm_add_ps(_mm_loadu_ps(output + 8), _mm_mul_ps(vacc2, vscale));
+    vacc3 = _mm_add_ps(_mm_loadu_ps(output + 12), _mm_mul_ps(vacc3, vscale));
+    _mm_storeu_ps(output + 0, vacc0);
+    _mm_storeu_ps(output + 4, vacc1);
+    _mm_storeu_ps(output + 8, vacc2);
+    _mm_storeu_ps(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(vx, vx));
+    } while (--r != 0);
+
+    vacc = _mm_add_ps(_mm_loadu_ps(output), _mm_mul_ps(vacc, vscale));
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_setzero_ps();
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_add_ss(vacc, _mm_mul_ss(vx, vx));
+      } while (--r != 0);
+
+      vacc = _mm_add_ss(_mm_load_ss(output), _mm_mul_ss(vacc, vscale));
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
+
+void xnn_f32_rmax_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m128 vacc0 = _mm_load1_ps(output);
+  __m128 vacc1 = vacc0;
+  __m128 vacc2 = vacc0;
+  __m128 vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    vacc0 = _mm_max_ps(vacc0, vx0);
+    vacc1 = _mm_max_ps(vacc1, vx1);
+    vacc2 = _mm_max_ps(vacc2, vx2);
+    vacc3 = _mm_max_ps(vacc3, vx3);
+  }
+  vacc0 = _mm_max_ps(vacc0, vacc1);
+  vacc2 = _mm_max_ps(vacc2, vacc3);
+  vacc0 = _mm_max_ps(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc0 = _mm_max_ps(vacc0, vx);
+  }
+  vacc0 = _mm_max_ps(vacc0, _mm_movehl_ps(vacc0, vacc0));
+  vacc0 = _mm_max_ss(vacc0, _mm_shuffle_ps(vacc0, vacc0, _MM_SHUFFLE(1, 1, 1, 1)));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc0 = _mm_max_ss(vacc0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc0);
+}
+
+void xnn_f32_rmin_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m128 vacc0 = _mm_load1_ps(output);
+  __m128 vacc1 = vacc0;
+  __m128 vacc2 = vacc0;
+  __m128 vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    vacc0 = _mm_min_ps(vacc0, vx0);
+    vacc1 = _mm_min_ps(vacc1, vx1);
+    vacc2 = _mm_min_ps(vacc2, vx2);
+    vacc3 = _mm_min_ps(vacc3, vx3);
+  }
+  vacc0 = _mm_min_ps(vacc0, vacc1);
+  vacc2 = _mm_min_ps(vacc2, vacc3);
+  vacc0 = _mm_min_ps(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc0 = _mm_min_ps(vacc0, vx);
+  }
+  vacc0 = _mm_min_ps(vacc0, _mm_movehl_ps(vacc0, vacc0));
+  vacc0 = _mm_min_ss(vacc0, _mm_shuffle_ps(vacc0, vacc0, _MM_SHUFFLE(1, 1, 1, 1)));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc0 = _mm_min_ss(vacc0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc0);
+}
+
+void xnn_f32_rminmax_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m128 vmin0 = _mm_load1_ps(output);
+  __m128 vmax0 = _mm_load1_ps(output + 1);
+  __m128 vmin1 = vmin0;
+  __m128 vmax1 = vmax0;
+  __m128 vmin2 = vmin0;
+  __m128 vmax2 = vmax0;
+  __m128 vmin3 = vmin0;
+  __m128 vmax3 = vmax0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    vmin0 = _mm_min_ps(vmin0, vx0);
+    vmax0 = _mm_max_ps(vmax0, vx0);
+    vmin1 = _mm_min_ps(vmin1, vx1);
+    vmax1 = _mm_max_ps(vmax1, vx1);
+    vmin2 = _mm_min_ps(vmin2, vx2);
+    vmax2 = _mm_max_ps(vmax2, vx2);
+    vmin3 = _mm_min_ps(vmin3, vx3);
+    vmax3 = _mm_max_ps(vmax3, vx3);
+  }
+  vmin0 = _mm_min_ps(vmin0, vmin1);
+  vmax0 = _mm_max_ps(vmax0, vmax1);
+  vmin2 = _mm_min_ps(vmin2, vmin3);
+  vmax2 = _mm_max_ps(vmax2, vmax3);
+  vmin0 = _mm_min_ps(vmin0, vmin2);
+  vmax0 = _mm_max_ps(vmax0, vmax2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vmin0 = _mm_min_ps(vmin0, vx);
+    vmax0 = _mm_max_ps(vmax0, vx);
+  }
+  vmin0 = _mm_min_ps(vmin0, _mm_movehl_ps(vmin0, vmin0));
+  vmax0 = _mm_max_ps(vmax0, _mm_movehl_ps(vmax0, vmax0));
+  vmin0 = _mm_min_ss(vmin0, _mm_shuffle_ps(vmin0, vmin0, _MM_SHUFFLE(1, 1, 1, 1)));
+  vmax0 = _mm_max_ss(vmax0, _mm_shuffle_ps(vmax0, vmax0, _MM_SHUFFLE(1, 1, 1, 1)));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vmin0 = _mm_min_ss(vmin0, vx);
+      vmax0 = _mm_max_ss(vmax0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vmin0);
+  _mm_store_ss(output + 1, vmax0);
+}
+
+void xnn_f32_rsum_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m128 vacc0 = _mm_setzero_ps();
+  __m128 vacc1 = vacc0;
+  __m128 vacc2 = vacc0;
+  __m128 vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    vacc0 = _mm_add_ps(vacc0, vx0);
+    vacc1 = _mm_add_ps(vacc1, vx1);
+    vacc2 = _mm_add_ps(vacc2, vx2);
+    vacc3 = _mm_add_ps(vacc3, vx3);
+  }
+  vacc0 = _mm_add_ps(vacc0, vacc1);
+  vacc2 = _mm_add_ps(vacc2, vacc3);
+  vacc0 = _mm_add_ps(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc0 = _mm_add_ps(vacc0, vx);
+  }
+  vacc0 = _mm_add_ps(vacc0, _mm_movehl_ps(vacc0, vacc0));
+  vacc0 = _mm_add_ss(vacc0, _mm_shuffle_ps(vacc0, vacc0, _MM_SHUFFLE(1, 1, 1, 1)));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc0 = _mm_add_ss(vacc0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vacc0 = _mm_mul_ss(vacc0, _mm_load_ss(&params->scalar.scale));
+  vacc0 = _mm_add_ss(vacc0, _mm_load_ss(output));
+  _mm_store_ss(output, vacc0);
+}
+
+void xnn_f32_rsumsq_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m128 vacc0 = _mm_setzero_ps();
+  __m128 vacc1 = vacc0;
+  __m128 vacc2 = vacc0;
+  __m128 vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx0, vx0));
+    vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vx1, vx1));
+    vacc2 = _mm_add_ps(vacc2, _mm_mul_ps(vx2, vx2));
+    vacc3 = _mm_add_ps(vacc3, _mm_mul_ps(vx3, vx3));
+  }
+  vacc0 = _mm_add_ps(vacc0, vacc1);
+  vacc2 = _mm_add_ps(vacc2, vacc3);
+  vacc0 = _mm_add_ps(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx, vx));
+  }
+  vacc0 = _mm_add_ps(vacc0, _mm_movehl_ps(vacc0, vacc0));
+  vacc0 = _mm_add_ss(vacc0, _mm_shuffle_ps(vacc0, vacc0, _MM_SHUFFLE(1, 1, 1, 1)));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc0 = _mm_add_ss(vacc0, _mm_mul_ss(vx, vx));
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vacc0 = _mm_mul_ss(vacc0, _mm_load_ss(&params->scalar.scale));
+  vacc0 = _mm_add_ss(vacc0, _mm_load_ss(output));
+  _mm_store_ss(output, vacc0);
+}
+
 void xnn_f32_rmax_ukernel__sse(
     size_t batch,
     const float* input,
@@ -6543,6 +7195,114 @@ void xnn_f32_rmax_ukernel__sse(
   _mm_store_ss(output, vmax_lo);
 }
 
+void xnn_f32_rnorm_ukernel__sse_x8(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const __m128 vshift4 = _mm_set1_ps(vshift);
+  __m128 vsum0 = _mm_setzero_ps();
+  __m128 vsum1 = _mm_setzero_ps();
+  __m128 vsumsq0 = _mm_setzero_ps();
+  __m128 vsumsq1 = _mm_setzero_ps();
+  size_t c = channels;
+  for (; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const __m128 vd0 = _mm_sub_ps(_mm_loadu_ps(i), vshift4);
+    const __m128 vd1 = _mm_sub_ps(_mm_loadu_ps(i + 4), vshift4);
+    i += 8;
+
+    vsum0 = _mm_add_ps(vsum0, vd0);
+    vsum1 = _mm_add_ps(vsum1, vd1);
+    vsumsq0 = _mm_add_ps(vsumsq0, _mm_mul_ps(vd0, vd0));
+    vsumsq1 = _mm_add_ps(vsumsq1, _mm_mul_ps(vd1, vd1));
+  }
+  if (c >= 4 * sizeof(float)) {
+    const __m128 vd = _mm_sub_ps(_mm_loadu_ps(i), vshift4);
+    i += 4;
+
+    vsum0 = _mm_add_ps(vsum0, vd);
+    vsumsq0 = _mm_add_ps(vsumsq0, _mm_mul_ps(vd, vd));
+    c -= 4 * sizeof(float);
+  }
+  __m128 vsum = _mm_add_ps(vsum0, vsum1);
+  __m128 vsumsq = _mm_add_ps(vsumsq0, vsumsq1);
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_shuffle_ps(vsum, vsum, _MM_SHUFFLE(1, 1, 1, 1)));
+  vsumsq = _mm_add_ss(vsumsq, _mm_shuffle_ps(vsumsq, vsumsq, _MM_SHUFFLE(1, 1, 1, 1)));
+  float vsum_tail = _mm_cvtss_f32(vsum);
+  float vsumsq_tail = _mm_cvtss_f32(vsumsq);
+  for (; c != 0; c -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m128 vmean4 = _mm_set1_ps(vmean);
+  const __m128 vrstd4 = _mm_set1_ps(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(i);
+    const __m128 vx1 = _mm_loadu_ps(i + 4);
+    i += 8;
+    const __m128 vscale0 = _mm_mul_ps(_mm_loadu_ps(gamma), vrstd4);
+    const __m128 vscale1 = _mm_mul_ps(_mm_loadu_ps(gamma + 4), vrstd4);
+    gamma += 8;
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx0, vmean4), vscale0), _mm_loadu_ps(beta));
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx1, vmean4), vscale1), _mm_loadu_ps(beta + 4));
+    beta += 8;
+
+    _mm_storeu_ps(o, vy0);
+    _mm_storeu_ps(o + 4, vy1);
+    o += 8;
+  }
+  if (c >= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(i);
+    i += 4;
+    const __m128 vscale = _mm_mul_ps(_mm_loadu_ps(gamma), vrstd4);
+    gamma += 4;
+
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx, vmean4), vscale), _mm_loadu_ps(beta));
+    beta += 4;
+
+    _mm_storeu_ps(o, vy);
+    o += 4;
+    c -= 4 * sizeof(float);
+  }
+  for (; c != 0; c -= sizeof(float)) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
+
 void xnn_f32_spmm_minmax_ukernel_32x1__sse(
     size_t mc,
     size_t nc,
@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <immintrin.h>
 
@@ -1881,6 +1882,176 @@ void xnn_f32_raddstoreexpminusmax_ukernel__sse2_rr2_p5_x20_acc2(
   _mm_store_ss(sum, vacc);
 }
 
+void xnn_f32_vapproxgelu_ukernel__sse2_rational_13_6_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vc3 = _mm_set1_ps(0x1.2444F2p-5f);
+  const __m128 vc1 = _mm_set1_ps(0x1.988454p-1f);
+  const __m128 vhalf = _mm_set1_ps(0.5f);
+  const __m128 vneg_sat_cutoff = _mm_set1_ps(-0x1.F9F09Ep+2f);
+  const __m128 vsat_cutoff = _mm_set1_ps(0x1.F9F09Ep+2f);
+  const __m128 valpha_13 = _mm_set1_ps(-0x1.3E4B80p-52f);
+  const __m128 valpha_11 = _mm_set1_ps(0x1.C266FCp-43f);
+  const __m128 valpha_9 = _mm_set1_ps(-0x1.7A6FFEp-34f);
+  const __m128 valpha_7 = _mm_set1_ps(0x1.B80082p-25f);
+  const __m128 valpha_5 = _mm_set1_ps(0x1.F28694p-17f);
+  const __m128 valpha_3 = _mm_set1_ps(0x1.4E1BDAp-11f);
+  const __m128 valpha_1 = _mm_set1_ps(0x1.40B3B8p-8f);
+  const __m128 vbeta_6 = _mm_set1_ps(0x1.41A7B0p-20f);
+  const __m128 vbeta_4 = _mm_set1_ps(0x1.F12BACp-14f);
+  const __m128 vbeta_2 = _mm_set1_ps(0x1.29540Ap-9f);
+  const __m128 vbeta_0 = _mm_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    const __m128 vx20 = _mm_mul_ps(vx0, vx0);
+    const __m128 vx21 = _mm_mul_ps(vx1, vx1);
+
+    __m128 vu0 = _mm_add_ps(_mm_mul_ps(vx20, vc3), vc1);
+    __m128 vu1 = _mm_add_ps(_mm_mul_ps(vx21, vc3), vc1);
+
+    vu0 = _mm_mul_ps(vx0, vu0);
+    vu1 = _mm_mul_ps(vx1, vu1);
+
+    vu0 = _mm_max_ps(vu0, vneg_sat_cutoff);
+    vu1 = _mm_max_ps(vu1, vneg_sat_cutoff);
+
+    vu0 = _mm_min_ps(vu0, vsat_cutoff);
+    vu1 = _mm_min_ps(vu1, vsat_cutoff);
+
+    const __m128 vu20 = _mm_mul_ps(vu0, vu0);
+    const __m128 vu21 = _mm_mul_ps(vu1, vu1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vu20, valpha_13), valpha_11);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vu21, valpha_13), valpha_11);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vu20, vp0), valpha_9);
+    vp1 = _mm_add_ps(_mm_mul_ps(vu21, vp1), valpha_9);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vu20, vp0), valpha_7);
+    vp1 = _mm_add_ps(_mm_mul_ps(vu21, vp1), valpha_7);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vu20, vp0), valpha_5);
+    vp1 = _mm_add_ps(_mm_mul_ps(vu21, vp1), valpha_5);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vu20, vp0), valpha_3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vu21, vp1), valpha_3);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vu20, vp0), valpha_1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vu21, vp1), valpha_1);
+
+    vp0 = _mm_mul_ps(vu0, vp0);
+    vp1 = _mm_mul_ps(vu1, vp1);
+
+    __m128 vq0 = _mm_add_ps(_mm_mul_ps(vu20, vbeta_6), vbeta_4);
+    __m128 vq1 = _mm_add_ps(_mm_mul_ps(vu21, vbeta_6), vbeta_4);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vu20, vq0), vbeta_2);
+    vq1 = _mm_add_ps(_mm_mul_ps(vu21, vq1), vbeta_2);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vu20, vq0), vbeta_0);
+    vq1 = _mm_add_ps(_mm_mul_ps(vu21, vq1), vbeta_0);
+
+    const __m128 vt0 = _mm_div_ps(vp0, vq0);
+    const __m128 vt1 = _mm_div_ps(vp1, vq1);
+
+    const __m128 vhalfx0 = _mm_mul_ps(vx0, vhalf);
+    const __m128 vhalfx1 = _mm_mul_ps(vx1, vhalf);
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(vhalfx0, vt0), vhalfx0);
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(vhalfx1, vt1), vhalfx1);
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    const __m128 vx2 = _mm_mul_ps(vx, vx);
+
+    __m128 vu = _mm_add_ps(_mm_mul_ps(vx2, vc3), vc1);
+    vu = _mm_mul_ps(vx, vu);
+
+    vu = _mm_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm_min_ps(vu, vsat_cutoff);
+
+    const __m128 vu2 = _mm_mul_ps(vu, vu);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vu2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_1);
+    vp = _mm_mul_ps(vu, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vu2, vbeta_6), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_0);
+
+    const __m128 vt = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, vt), vhalfx);
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    const __m128 vx2 = _mm_mul_ps(vx, vx);
+
+    __m128 vu = _mm_add_ps(_mm_mul_ps(vx2, vc3), vc1);
+    vu = _mm_mul_ps(vx, vu);
+
+    vu = _mm_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm_min_ps(vu, vsat_cutoff);
+
+    const __m128 vu2 = _mm_mul_ps(vu, vu);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vu2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_1);
+    vp = _mm_mul_ps(vu, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vu2, vbeta_6), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_0);
+
+    const __m128 vt = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, vt), vhalfx);
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
+
 extern XNN_INTERNAL const float xnn_table_exp2minus_k_over_16[16];
 
 void xnn_f32_velu_ukernel__sse2_rr2_lut16_p3_x12(
@@ -2151,6 +2322,336 @@ void xnn_f32_velu_ukernel__sse2_rr2_lut16_p3_x12(
   }
 }
 
+void xnn_f32_vexp_ukernel__sse2_rr2_p5_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vmagic_bias = _mm_set1_ps(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m128 vzero_cutoff = _mm_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m128 vinf_cutoff = _mm_set1_ps(0x1.62E42Ep+6f);
+  const __m128 vlog2e = _mm_set1_ps(0x1.715476p+0f);
+  const __m128 vminus_ln2_hi = _mm_set1_ps(-0x1.62E400p-1f);
+  const __m128 vminus_ln2_lo = _mm_set1_ps(-0x1.7F7D1Cp-20f);
+  const __m128 vplus_inf = _mm_set1_ps(INFINITY);
+  const __m128 vc5 = _mm_set1_ps(0x1.0F9F9Cp-7f);
+  const __m128 vc4 = _mm_set1_ps(0x1.573A1Ap-5f);
+  const __m128 vc3 = _mm_set1_ps(0x1.555A80p-3f);
+  const __m128 vc2 = _mm_set1_ps(0x1.FFFDC6p-2f);
+  const __m128 vc1 = _mm_set1_ps(0x1.FFFFF6p-1f);
+  const __m128i vmin_exponent = _mm_set1_epi32(0xC1000000);
+  const __m128i vmax_exponent = _mm_set1_epi32(0x3F800000);
+  const __m128i vdefault_exponent = vmax_exponent;
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    __m128 vn0 = _mm_add_ps(_mm_mul_ps(vx0, vlog2e), vmagic_bias);
+    __m128 vn1 = _mm_add_ps(_mm_mul_ps(vx1, vlog2e), vmagic_bias);
+
+    __m128i veo0 = _mm_slli_epi32(_mm_castps_si128(vn0), 23);
+    __m128i veo1 = _mm_slli_epi32(_mm_castps_si128(vn1), 23);
+
+    __m128i ven0 = _mm_max_epi16(veo0, vmin_exponent);
+    __m128i ven1 = _mm_max_epi16(veo1, vmin_exponent);
+
+    ven0 = _mm_min_epi16(ven0, vmax_exponent);
+    ven1 = _mm_min_epi16(ven1, vmax_exponent);
+
+    veo0 = _mm_sub_epi32(veo0, ven0);
+    veo1 = _mm_sub_epi32(veo1, ven1);
+
+    const __m128 vsn0 = _mm_castsi128_ps(_mm_add_epi32(ven0, vdefault_exponent));
+    const __m128 vsn1 = _mm_castsi128_ps(_mm_add_epi32(ven1, vdefault_exponent));
+
+    const __m128 vso0 = _mm_castsi128_ps(_mm_add_epi32(veo0, vdefault_exponent));
+    const __m128 vso1 = _mm_castsi128_ps(_mm_add_epi32(veo1, vdefault_exponent));
+
+    vn0 = _mm_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm_sub_ps(vn1, vmagic_bias);
+
+    __m128 vt0 = _mm_add_ps(_mm_mul_ps(vn0, vminus_ln2_hi), vx0);
+    __m128 vt1 = _mm_add_ps(_mm_mul_ps(vn1, vminus_ln2_hi), vx1);
+
+    vt0 = _mm_add_ps(_mm_mul_ps(vn0, vminus_ln2_lo), vt0);
+    vt1 = _mm_add_ps(_mm_mul_ps(vn1, vminus_ln2_lo), vt1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vc5, vt0), vc4);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vc5, vt1), vc4);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc3);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc2);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc2);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc1);
+
+    vt0 = _mm_mul_ps(vt0, vso0);
+    vt1 = _mm_mul_ps(vt1, vso1);
+
+    __m128 vy0 = _mm_mul_ps(vsn0, _mm_add_ps(_mm_mul_ps(vt0, vp0), vso0));
+    __m128 vy1 = _mm_mul_ps(vsn1, _mm_add_ps(_mm_mul_ps(vt1, vp1), vso1));
+
+    vy0 = _mm_andnot_ps(_mm_cmplt_ps(vx0, vzero_cutoff), vy0);
+    vy1 = _mm_andnot_ps(_mm_cmplt_ps(vx1, vzero_cutoff), vy1);
+
+    const __m128 vm0 = _mm_cmpgt_ps(vx0, vinf_cutoff);
+    const __m128 vm1 = _mm_cmpgt_ps(vx1, vinf_cutoff);
+
+    vy0 = _mm_or_ps(_mm_and_ps(vplus_inf, vm0), _mm_andnot_ps(vm0, vy0));
+    vy1 = _mm_or_ps(_mm_and_ps(vplus_inf, vm1), _mm_andnot_ps(vm1, vy1));
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vdefault_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vdefault_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
+
+void xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vsqrt1_2 = _mm_set1_ps(0x1.6A09E6p-1f);
+  const __m128 vneg_erf_cutoff = _mm_set1_ps(-0x1.000000p+2f);
+  const __m128 verf_cutoff = _mm_set1_ps(0x1.000000p+2f);
+  const __m128 valpha_13 = _mm_set1_ps(-0x1.2BBE16p-32f);
+  const __m128 valpha_11 = _mm_set1_ps(0x1.DBFFDCp-26f);
+  const __m128 valpha_9 = _mm_set1_ps(-0x1.19FEA2p-19f);
+  const __m128 valpha_7 = _mm_set1_ps(-0x1.DD85A4p-15f);
+  const __m128 valpha_5 = _mm_set1_ps(-0x1.8158C6p-11f);
+  const __m128 valpha_3 = _mm_set1_ps(-0x1.8343ECp-9f);
+  const __m128 valpha_1 = _mm_set1_ps(-0x1.07B7A8p-6f);
+  const __m128 vbeta_8 = _mm_set1_ps(-0x1.E8C19Ap-17f);
+  const __m128 vbeta_6 = _mm_set1_ps(-0x1.BF7A52p-13f);
+  const __m128 vbeta_4 = _mm_set1_ps(-0x1.B9249Cp-10f);
+  const __m128 vbeta_2 = _mm_set1_ps(-0x1.E337F0p-8f);
+  const __m128 vbeta_0 = _mm_set1_ps(-0x1.D36D4Ep-7f);
+  const __m128 vhalf = _mm_set1_ps(0.5f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    __m128 vz0 = _mm_mul_ps(vx0, vsqrt1_2);
+    __m128 vz1 = _mm_mul_ps(vx1, vsqrt1_2);
+
+    vz0 = _mm_max_ps(vz0, vneg_erf_cutoff);
+    vz1 = _mm_max_ps(vz1, vneg_erf_cutoff);
+
+    vz0 = _mm_min_ps(vz0, verf_cutoff);
+    vz1 = _mm_min_ps(vz1, verf_cutoff);
+
+    const __m128 vz20 = _mm_mul_ps(vz0, vz0);
+    const __m128 vz21 = _mm_mul_ps(vz1, vz1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vz20, valpha_13), valpha_11);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vz21, valpha_13), valpha_11);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_9);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_9);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_7);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_7);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_5);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_5);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_3);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_1);
+
+    vp0 = _mm_mul_ps(vz0, vp0);
+    vp1 = _mm_mul_ps(vz1, vp1);
+
+    __m128 vq0 = _mm_add_ps(_mm_mul_ps(vz20, vbeta_8), vbeta_6);
+    __m128 vq1 = _mm_add_ps(_mm_mul_ps(vz21, vbeta_8), vbeta_6);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vz20, vq0), vbeta_4);
+    vq1 = _mm_add_ps(_mm_mul_ps(vz21, vq1), vbeta_4);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vz20, vq0), vbeta_2);
+    vq1 = _mm_add_ps(_mm_mul_ps(vz21, vq1), vbeta_2);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vz20, vq0), vbeta_0);
+    vq1 = _mm_add_ps(_mm_mul_ps(vz21, vq1), vbeta_0);
+
+    const __m128 verf0 = _mm_div_ps(vp0, vq0);
+    const __m128 verf1 = _mm_div_ps(vp1, vq1);
+
+    const __m128 vhalfx0 = _mm_mul_ps(vx0, vhalf);
+    const __m128 vhalfx1 = _mm_mul_ps(vx1, vhalf);
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(vhalfx0, verf0), vhalfx0);
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(vhalfx1, verf1), vhalfx1);
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    __m128 vz = _mm_mul_ps(vx, vsqrt1_2);
+    vz = _mm_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm_min_ps(vz, verf_cutoff);
+
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vz2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_1);
+    vp = _mm_mul_ps(vz, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vz2, vbeta_8), vbeta_6);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_0);
+
+    const __m128 verf = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, verf), vhalfx);
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    __m128 vz = _mm_mul_ps(vx, vsqrt1_2);
+    vz = _mm_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm_min_ps(vz, verf_cutoff);
+
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vz2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_1);
+    vp = _mm_mul_ps(vz, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vz2, vbeta_8), vbeta_6);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_0);
+
+    const __m128 verf = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, verf), vhalfx);
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
+
 void xnn_f32_vlrelu_ukernel__sse2_x8(
     size_t batch,
     const float* input,
@@ -2629,76 +3130,371 @@ void xnn_f32_vsigmoid_ukernel__sse2_rr2_lut64_p2_div_x8(
     #endif  // XNN_ARCH_X86_64
     const __m128i vl = _mm_unpacklo_epi64(vl_lo, vl_hi);
 
-    const __m128 vs = _mm_castsi128_ps(_mm_add_epi32(vl, ve));
-    vn = _mm_sub_ps(vn, vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_add_epi32(vl, ve));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(vz, _mm_mul_ps(vn, vminus_ln2_hi));
+    vt = _mm_add_ps(vt, _mm_mul_ps(vn, vminus_ln2_lo));
+
+    __m128 vp = _mm_mul_ps(vt, vc2);
+    vp = _mm_add_ps(vt, _mm_mul_ps(vp, vt));
+
+    const __m128 vy = _mm_add_ps(vs, _mm_mul_ps(vs, vp));
+
+    __m128 vf = _mm_div_ps(vy, _mm_add_ps(vy, vone));
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    _mm_storeu_ps(output, vf);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    const __m128 vz = _mm_or_ps(vx, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128i ve = _mm_slli_epi32(_mm_castps_si128(vn), 17);
+
+    const __m128i vidx = _mm_slli_epi32(_mm_and_si128(_mm_castps_si128(vn), vindex_mask), 2);
+    #if XNN_ARCH_X86_64
+      const uint64_t vidx_lo = (uint64_t) _mm_cvtsi128_si64(vidx);
+      const uint64_t vidx_hi = (uint64_t) _mm_cvtsi128_si64(_mm_unpackhi_epi64(vidx, vidx));
+      const __m128i vl_ll   = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) vidx_lo)));
+      const __m128i vl_hl = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) vidx_hi)));
+      const __m128i vl_lh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) (vidx_lo >> 32))));
+      const __m128i vl_lo = _mm_unpacklo_epi32(vl_ll, vl_lh);
+      const __m128i vl_hh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) (vidx_hi >> 32))));
+      const __m128i vl_hi = _mm_unpacklo_epi32(vl_hl, vl_hh);
+    #else  // !XNN_ARCH_X86_64
+      const __m128i vl_ll = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_cvtsi128_si32(vidx))));
+      const __m128i vl_hl = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_extract_epi16(vidx, 4))));
+      const __m128i vl_lh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_extract_epi16(vidx, 2))));
+      const __m128i vl_lo = _mm_unpacklo_epi32(vl_ll, vl_lh);
+      const __m128i vl_hh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_extract_epi16(vidx, 6))));
+      const __m128i vl_hi = _mm_unpacklo_epi32(vl_hl, vl_hh);
+    #endif  // XNN_ARCH_X86_64
+    const __m128i vl = _mm_unpacklo_epi64(vl_lo, vl_hi);
+
+    const __m128 vs = _mm_castsi128_ps(_mm_add_epi32(vl, ve));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(vz, _mm_mul_ps(vn, vminus_ln2_hi));
+    vt = _mm_add_ps(vt, _mm_mul_ps(vn, vminus_ln2_lo));
+
+    __m128 vp = _mm_mul_ps(vt, vc2);
+    vp = _mm_add_ps(vt, _mm_mul_ps(vp, vt));
+
+    const __m128 vy = _mm_add_ps(vs, _mm_mul_ps(vs, vp));
+
+    __m128 vf = _mm_div_ps(vy, _mm_add_ps(vy, vone));
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vf);
+      vf = _mm_movehl_ps(vf, vf);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vf);
+    }
+  }
+}
+
+void xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vsign_mask = _mm_set1_ps(-0.0f);
+  const __m128 vmagic_bias = _mm_set1_ps(0x1.8000FEp23f);
+  const __m128 vlog2e = _mm_set1_ps(0x1.715476p0f);
+  const __m128 vminus_ln2_hi = _mm_set1_ps(-0x1.62E400p-1f);
+  const __m128 vminus_ln2_lo = _mm_set1_ps(-0x1.7F7D1Cp-20f);
+  const __m128 vc5 = _mm_set1_ps(0x1.0F9F9Cp-7f);
+  const __m128 vc4 = _mm_set1_ps(0x1.573A1Ap-5f);
+  const __m128 vc3 = _mm_set1_ps(0x1.555A80p-3f);
+  const __m128 vc2 = _mm_set1_ps(0x1.FFFDC6p-2f);
+  const __m128 vc1 = _mm_set1_ps(0x1.FFFFF6p-1f);
+  const __m128 vone = _mm_set1_ps(1.0f);
+  const __m128 vdenorm_cutoff = _mm_set1_ps(-0x1.5D589Ep+6f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    const __m128 vz0 = _mm_or_ps(vx0, vsign_mask);
+    const __m128 vz1 = _mm_or_ps(vx1, vsign_mask);
+
+    __m128 vn0 = _mm_add_ps(_mm_mul_ps(vz0, vlog2e), vmagic_bias);
+    __m128 vn1 = _mm_add_ps(_mm_mul_ps(vz1, vlog2e), vmagic_bias);
+
+    const __m128 vs0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn0), 23));
+    const __m128 vs1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn1), 23));
+
+    vn0 = _mm_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm_sub_ps(vn1, vmagic_bias);
+
+    __m128 vt0 = _mm_add_ps(_mm_mul_ps(vn0, vminus_ln2_hi), vz0);
+    __m128 vt1 = _mm_add_ps(_mm_mul_ps(vn1, vminus_ln2_hi), vz1);
+
+    vt0 = _mm_add_ps(_mm_mul_ps(vn0, vminus_ln2_lo), vt0);
+    vt1 = _mm_add_ps(_mm_mul_ps(vn1, vminus_ln2_lo), vt1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vc5, vt0), vc4);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vc5, vt1), vc4);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc3);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc2);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc2);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc1);
+
+    vt0 = _mm_mul_ps(vt0, vs0);
+    vt1 = _mm_mul_ps(vt1, vs1);
+
+    const __m128 ve0 = _mm_add_ps(_mm_mul_ps(vt0, vp0), vs0);
+    const __m128 ve1 = _mm_add_ps(_mm_mul_ps(vt1, vp1), vs1);
+
+    const __m128 vd0 = _mm_add_ps(ve0, vone);
+    const __m128 vd1 = _mm_add_ps(ve1, vone);
+
+    __m128 vf0 = _mm_div_ps(ve0, vd0);
+    __m128 vf1 = _mm_div_ps(ve1, vd1);
+
+    vf0 = _mm_andnot_ps(_mm_cmplt_ps(vz0, vdenorm_cutoff), vf0);
+    vf1 = _mm_andnot_ps(_mm_cmplt_ps(vz1, vdenorm_cutoff), vf1);
+
+    const __m128 vm0 = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx0)));
+    const __m128 vm1 = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx1)));
+
+    vf0 = _mm_or_ps(_mm_and_ps(vf0, vm0), _mm_andnot_ps(vm0, _mm_sub_ps(vone, vf0)));
+    vf1 = _mm_or_ps(_mm_and_ps(vf1, vm1), _mm_andnot_ps(vm1, _mm_sub_ps(vone, vf1)));
+
+    const __m128 vy0 = _mm_mul_ps(vx0, vf0);
+    const __m128 vy1 = _mm_mul_ps(vx1, vf1);
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    const __m128 vz = _mm_or_ps(vx, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vs);
+    const __m128 ve = _mm_add_ps(_mm_mul_ps(vt, vp), vs);
+    const __m128 vd = _mm_add_ps(ve, vone);
+
+    __m128 vf = _mm_div_ps(ve, vd);
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    const __m128 vy = _mm_mul_ps(vx, vf);
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    const __m128 vz = _mm_or_ps(vx, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vs);
+    const __m128 ve = _mm_add_ps(_mm_mul_ps(vt, vp), vs);
+    const __m128 vd = _mm_add_ps(ve, vone);
+
+    __m128 vf = _mm_div_ps(ve, vd);
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    const __m128 vy = _mm_mul_ps(vx, vf);
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
+
+void xnn_f32_vtanh_ukernel__sse2_rational_13_6_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vneg_sat_cutoff = _mm_set1_ps(-0x1.F9F09Ep+2f);
+  const __m128 vsat_cutoff = _mm_set1_ps(0x1.F9F09Ep+2f);
+  const __m128 valpha_13 = _mm_set1_ps(-0x1.3E4B80p-52f);
+  const __m128 valpha_11 = _mm_set1_ps(0x1.C266FCp-43f);
+  const __m128 valpha_9 = _mm_set1_ps(-0x1.7A6FFEp-34f);
+  const __m128 valpha_7 = _mm_set1_ps(0x1.B80082p-25f);
+  const __m128 valpha_5 = _mm_set1_ps(0x1.F28694p-17f);
+  const __m128 valpha_3 = _mm_set1_ps(0x1.4E1BDAp-11f);
+  const __m128 valpha_1 = _mm_set1_ps(0x1.40B3B8p-8f);
+  const __m128 vbeta_6 = _mm_set1_ps(0x1.41A7B0p-20f);
+  const __m128 vbeta_4 = _mm_set1_ps(0x1.F12BACp-14f);
+  const __m128 vbeta_2 = _mm_set1_ps(0x1.29540Ap-9f);
+  const __m128 vbeta_0 = _mm_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    __m128 vx0 = _mm_loadu_ps(input);
+    __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    vx0 = _mm_max_ps(vx0, vneg_sat_cutoff);
+    vx1 = _mm_max_ps(vx1, vneg_sat_cutoff);
+
+    vx0 = _mm_min_ps(vx0, vsat_cutoff);
+    vx1 = _mm_min_ps(vx1, vsat_cutoff);
+
+    const __m128 vx20 = _mm_mul_ps(vx0, vx0);
+    const __m128 vx21 = _mm_mul_ps(vx1, vx1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vx20, valpha_13), valpha_11);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vx21, valpha_13), valpha_11);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vx20, vp0), valpha_9);
+    vp1 = _mm_add_ps(_mm_mul_ps(vx21, vp1), valpha_9);
 
-    __m128 vt = _mm_add_ps(vz, _mm_mul_ps(vn, vminus_ln2_hi));
-    vt = _mm_add_ps(vt, _mm_mul_ps(vn, vminus_ln2_lo));
+    vp0 = _mm_add_ps(_mm_mul_ps(vx20, vp0), valpha_7);
+    vp1 = _mm_add_ps(_mm_mul_ps(vx21, vp1), valpha_7);
 
-    __m128 vp = _mm_mul_ps(vt, vc2);
-    vp = _mm_add_ps(vt, _mm_mul_ps(vp, vt));
+    vp0 = _mm_add_ps(_mm_mul_ps(vx20, vp0), valpha_5);
+    vp1 = _mm_add_ps(_mm_mul_ps(vx21, vp1), valpha_5);
 
-    const __m128 vy = _mm_add_ps(vs, _mm_mul_ps(vs, vp));
+    vp0 = _mm_add_ps(_mm_mul_ps(vx20, vp0), valpha_3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vx21, vp1), valpha_3);
 
-    __m128 vf = _mm_div_ps(vy, _mm_add_ps(vy, vone));
-    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
-    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx)));
-    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+    vp0 = _mm_add_ps(_mm_mul_ps(vx20, vp0), valpha_1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vx21, vp1), valpha_1);
 
-    _mm_storeu_ps(output, vf);
-    output += 4;
+    vp0 = _mm_mul_ps(vx0, vp0);
+    vp1 = _mm_mul_ps(vx1, vp1);
+
+    __m128 vq0 = _mm_add_ps(_mm_mul_ps(vx20, vbeta_6), vbeta_4);
+    __m128 vq1 = _mm_add_ps(_mm_mul_ps(vx21, vbeta_6), vbeta_4);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vx20, vq0), vbeta_2);
+    vq1 = _mm_add_ps(_mm_mul_ps(vx21, vq1), vbeta_2);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vx20, vq0), vbeta_0);
+    vq1 = _mm_add_ps(_mm_mul_ps(vx21, vq1), vbeta_0);
+
+    const __m128 vy0 = _mm_div_ps(vp0, vq0);
+    const __m128 vy1 = _mm_div_ps(vp1, vq1);
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
   }
-  if XNN_UNLIKELY(batch != 0) {
-    const __m128 vx = _mm_loadu_ps(input);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    __m128 vx = _mm_loadu_ps(input);
+    input += 4;
 
-    const __m128 vz = _mm_or_ps(vx, vsign_mask);
+    vx = _mm_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm_min_ps(vx, vsat_cutoff);
 
-    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
-    const __m128i ve = _mm_slli_epi32(_mm_castps_si128(vn), 17);
+    const __m128 vx2 = _mm_mul_ps(vx, vx);
 
-    const __m128i vidx = _mm_slli_epi32(_mm_and_si128(_mm_castps_si128(vn), vindex_mask), 2);
-    #if XNN_ARCH_X86_64
-      const uint64_t vidx_lo = (uint64_t) _mm_cvtsi128_si64(vidx);
-      const uint64_t vidx_hi = (uint64_t) _mm_cvtsi128_si64(_mm_unpackhi_epi64(vidx, vidx));
-      const __m128i vl_ll   = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) vidx_lo)));
-      const __m128i vl_hl = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) vidx_hi)));
-      const __m128i vl_lh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) (vidx_lo >> 32))));
-      const __m128i vl_lo = _mm_unpacklo_epi32(vl_ll, vl_lh);
-      const __m128i vl_hh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) (vidx_hi >> 32))));
-      const __m128i vl_hi = _mm_unpacklo_epi32(vl_hl, vl_hh);
-    #else  // !XNN_ARCH_X86_64
-      const __m128i vl_ll = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_cvtsi128_si32(vidx))));
-      const __m128i vl_hl = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_extract_epi16(vidx, 4))));
-      const __m128i vl_lh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_extract_epi16(vidx, 2))));
-      const __m128i vl_lo = _mm_unpacklo_epi32(vl_ll, vl_lh);
-      const __m128i vl_hh = _mm_cvtsi32_si128(*((const int*) ((uintptr_t) xnn_table_exp2minus_k_over_64 + (uint32_t) _mm_extract_epi16(vidx, 6))));
-      const __m128i vl_hi = _mm_unpacklo_epi32(vl_hl, vl_hh);
-    #endif  // XNN_ARCH_X86_64
-    const __m128i vl = _mm_unpacklo_epi64(vl_lo, vl_hi);
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vx2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_1);
+    vp = _mm_mul_ps(vx, vp);
 
-    const __m128 vs = _mm_castsi128_ps(_mm_add_epi32(vl, ve));
-    vn = _mm_sub_ps(vn, vmagic_bias);
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vx2, vbeta_6), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vx2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vx2, vq), vbeta_0);
 
-    __m128 vt = _mm_add_ps(vz, _mm_mul_ps(vn, vminus_ln2_hi));
-    vt = _mm_add_ps(vt, _mm_mul_ps(vn, vminus_ln2_lo));
+    const __m128 vy = _mm_div_ps(vp, vq);
 
-    __m128 vp = _mm_mul_ps(vt, vc2);
-    vp = _mm_add_ps(vt, _mm_mul_ps(vp, vt));
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    __m128 vx = _mm_loadu_ps(input);
 
-    const __m128 vy = _mm_add_ps(vs, _mm_mul_ps(vs, vp));
+    vx = _mm_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm_min_ps(vx, vsat_cutoff);
 
-    __m128 vf = _mm_div_ps(vy, _mm_add_ps(vy, vone));
-    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
-    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(vx)));
-    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+    const __m128 vx2 = _mm_mul_ps(vx, vx);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vx2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vx2, vp), valpha_1);
+    vp = _mm_mul_ps(vx, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vx2, vbeta_6), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vx2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vx2, vq), vbeta_0);
 
+    const __m128 vy = _mm_div_ps(vp, vq);
+
+    __m128 vh = vy;
     if (batch & (2 * sizeof(float))) {
-      _mm_storel_pi((__m64*) output, vf);
-      vf = _mm_movehl_ps(vf, vf);
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
       output += 2;
     }
     if (batch & (1 * sizeof(float))) {
-      _mm_store_ss(output, vf);
+      _mm_store_ss(output, vh);
     }
   }
 }
@@ -4714,6 +5510,287 @@ void xnn_qc8_igemm_minmax_fp32_ukernel_3x4c8__sse2_ld64(
   } while (nc != 0);
 }
 
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4c8__sse2_ld64(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const __m128 vinput_scale0 = _mm_set1_ps(quantization_params[0].scale);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    __m128i vacc0x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point0);
+    __m128i vacc0x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point0);
+    __m128i vacc0x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point0);
+    __m128i vacc0x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point0);
+    w = (const int32_t*) w + 4;
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+      const __m128i vxa0 = _mm_srai_epi16(_mm_unpacklo_epi8(va0, va0), 8);
+      a0 += 8;
+
+      const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+      const __m128i vxb0 = _mm_srai_epi16(_mm_unpacklo_epi8(vb0, vb0), 8);
+
+      vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+      const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 8));
+      const __m128i vxb1 = _mm_srai_epi16(_mm_unpacklo_epi8(vb1, vb1), 8);
+
+      vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+      const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 16));
+      const __m128i vxb2 = _mm_srai_epi16(_mm_unpacklo_epi8(vb2, vb2), 8);
+
+      vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+      const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 24));
+      const __m128i vxb3 = _mm_srai_epi16(_mm_unpacklo_epi8(vb3, vb3), 8);
+
+      vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+
+      w = (const void*) ((const int8_t*) w + 32);
+      k += 8 * sizeof(int8_t);
+    }
+
+    const __m128i vacc0x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x0, vacc0x2), _mm_unpackhi_epi32(vacc0x0, vacc0x2));
+    const __m128i vacc0x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x1, vacc0x3), _mm_unpackhi_epi32(vacc0x1, vacc0x3));
+
+    const __m128i vacc0x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x02, vacc0x13), _mm_unpackhi_epi32(vacc0x02, vacc0x13));
+
+    __m128 vout0x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0x0123), vinput_scale0);
+
+    const __m128 vfilter_scale0123 = _mm_loadu_ps((const float*) w);
+    const __m128 vbias0123 = _mm_loadu_ps((const float*) w + 4);
+    w = (const void*) ((const float*) w + 8);
+    vout0x0123 = _mm_add_ps(_mm_mul_ps(vout0x0123, vfilter_scale0123), vbias0123);
+
+    const __m128 voutput_min = _mm_load_ps(params->sse.min);
+    vout0x0123 = _mm_max_ps(vout0x0123, voutput_min);
+
+    const __m128 voutput_max = _mm_load_ps(params->sse.max);
+    vout0x0123 = _mm_min_ps(vout0x0123, voutput_max);
+
+    if XNN_LIKELY(nc >= 4) {
+      _mm_storeu_ps(c0, vout0x0123);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vout0x0123);
+
+        vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vout0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_3x4c8__sse2_ld64(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 3);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const int8_t* a2 = (const int8_t*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+
+  // Rows beyond mr alias the previous row, so their quantization parameters must alias as well.
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const __m128 vinput_scale0 = _mm_set1_ps(quantization_params[0].scale);
+  const int32_t vinput_zero_point1 = quantization_params[min(mr - 1, 1)].zero_point;
+  const __m128 vinput_scale1 = _mm_set1_ps(quantization_params[min(mr - 1, 1)].scale);
+  const int32_t vinput_zero_point2 = quantization_params[min(mr - 1, 2)].zero_point;
+  const __m128 vinput_scale2 = _mm_set1_ps(quantization_params[min(mr - 1, 2)].scale);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    __m128i vacc0x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point0);
+    __m128i vacc0x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point0);
+    __m128i vacc0x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point0);
+    __m128i vacc0x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point0);
+    __m128i vacc1x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point1);
+    __m128i vacc1x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point1);
+    __m128i vacc1x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point1);
+    __m128i vacc1x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point1);
+    __m128i vacc2x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point2);
+    __m128i vacc2x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point2);
+    __m128i vacc2x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point2);
+    __m128i vacc2x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point2);
+    w = (const int32_t*) w + 4;
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+      const __m128i vxa0 = _mm_srai_epi16(_mm_unpacklo_epi8(va0, va0), 8);
+      a0 += 8;
+      const __m128i va1 = _mm_loadl_epi64((const __m128i*) a1);
+      const __m128i vxa1 = _mm_srai_epi16(_mm_unpacklo_epi8(va1, va1), 8);
+      a1 += 8;
+      const __m128i va2 = _mm_loadl_epi64((const __m128i*) a2);
+      const __m128i vxa2 = _mm_srai_epi16(_mm_unpacklo_epi8(va2, va2), 8);
+      a2 += 8;
+
+      const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+      const __m128i vxb0 = _mm_srai_epi16(_mm_unpacklo_epi8(vb0, vb0), 8);
+
+      vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+      vacc1x0 = _mm_add_epi32(vacc1x0, _mm_madd_epi16(vxa1, vxb0));
+      vacc2x0 = _mm_add_epi32(vacc2x0, _mm_madd_epi16(vxa2, vxb0));
+      const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 8));
+      const __m128i vxb1 = _mm_srai_epi16(_mm_unpacklo_epi8(vb1, vb1), 8);
+
+      vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+      vacc1x1 = _mm_add_epi32(vacc1x1, _mm_madd_epi16(vxa1, vxb1));
+      vacc2x1 = _mm_add_epi32(vacc2x1, _mm_madd_epi16(vxa2, vxb1));
+      const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 16));
+      const __m128i vxb2 = _mm_srai_epi16(_mm_unpacklo_epi8(vb2, vb2), 8);
+
+      vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+      vacc1x2 = _mm_add_epi32(vacc1x2, _mm_madd_epi16(vxa1, vxb2));
+      vacc2x2 = _mm_add_epi32(vacc2x2, _mm_madd_epi16(vxa2, vxb2));
+      const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 24));
+      const __m128i vxb3 = _mm_srai_epi16(_mm_unpacklo_epi8(vb3, vb3), 8);
+
+      vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+      vacc1x3 = _mm_add_epi32(vacc1x3, _mm_madd_epi16(vxa1, vxb3));
+      vacc2x3 = _mm_add_epi32(vacc2x3, _mm_madd_epi16(vxa2, vxb3));
+
+      w = (const void*) ((const int8_t*) w + 32);
+      k += 8 * sizeof(int8_t);
+    }
+
+    const __m128i vacc0x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x0, vacc0x2), _mm_unpackhi_epi32(vacc0x0, vacc0x2));
+    const __m128i vacc0x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x1, vacc0x3), _mm_unpackhi_epi32(vacc0x1, vacc0x3));
+    const __m128i vacc1x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc1x0, vacc1x2), _mm_unpackhi_epi32(vacc1x0, vacc1x2));
+    const __m128i vacc1x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc1x1, vacc1x3), _mm_unpackhi_epi32(vacc1x1, vacc1x3));
+    const __m128i vacc2x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc2x0, vacc2x2), _mm_unpackhi_epi32(vacc2x0, vacc2x2));
+    const __m128i vacc2x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc2x1, vacc2x3), _mm_unpackhi_epi32(vacc2x1, vacc2x3));
+
+    const __m128i vacc0x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x02, vacc0x13), _mm_unpackhi_epi32(vacc0x02, vacc0x13));
+    const __m128i vacc1x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc1x02, vacc1x13), _mm_unpackhi_epi32(vacc1x02, vacc1x13));
+    const __m128i vacc2x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc2x02, vacc2x13), _mm_unpackhi_epi32(vacc2x02, vacc2x13));
+
+    __m128 vout0x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0x0123), vinput_scale0);
+    __m128 vout1x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc1x0123), vinput_scale1);
+    __m128 vout2x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc2x0123), vinput_scale2);
+
+    const __m128 vfilter_scale0123 = _mm_loadu_ps((const float*) w);
+    const __m128 vbias0123 = _mm_loadu_ps((const float*) w + 4);
+    w = (const void*) ((const float*) w + 8);
+    vout0x0123 = _mm_add_ps(_mm_mul_ps(vout0x0123, vfilter_scale0123), vbias0123);
+    vout1x0123 = _mm_add_ps(_mm_mul_ps(vout1x0123, vfilter_scale0123), vbias0123);
+    vout2x0123 = _mm_add_ps(_mm_mul_ps(vout2x0123, vfilter_scale0123), vbias0123);
+
+    const __m128 voutput_min = _mm_load_ps(params->sse.min);
+    vout0x0123 = _mm_max_ps(vout0x0123, voutput_min);
+    vout1x0123 = _mm_max_ps(vout1x0123, voutput_min);
+    vout2x0123 = _mm_max_ps(vout2x0123, voutput_min);
+
+    const __m128 voutput_max = _mm_load_ps(params->sse.max);
+    vout0x0123 = _mm_min_ps(vout0x0123, voutput_max);
+    vout1x0123 = _mm_min_ps(vout1x0123, voutput_max);
+    vout2x0123 = _mm_min_ps(vout2x0123, voutput_max);
+
+    if XNN_LIKELY(nc >= 4) {
+      _mm_storeu_ps(c0, vout0x0123);
+      _mm_storeu_ps(c1, vout1x0123);
+      _mm_storeu_ps(c2, vout2x0123);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const int8_t*) ((uintptr_t) a1 - kc);
+      a2 = (const int8_t*) ((uintptr_t) a2 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vout0x0123);
+        _mm_storel_pi((__m64*) c1, vout1x0123);
+        _mm_storel_pi((__m64*) c2, vout2x0123);
+
+        vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+        vout1x0123 = _mm_movehl_ps(vout1x0123, vout1x0123);
+        vout2x0123 = _mm_movehl_ps(vout2x0123, vout2x0123);
+
+        c0 += 2;
+        c1 += 2;
+        c2 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vout0x0123);
+        _mm_store_ss(c1, vout1x0123);
+        _mm_store_ss(c2, vout2x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_qs8_dwconv_minmax_fp32_ukernel_25p8c__sse2_mul16_add16(
     size_t channels,
     size_t output_width,
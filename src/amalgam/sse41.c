@@ -4,11 +4,13 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 
 #include <immintrin.h>
 
 #include <xnnpack/common.h>
 #include <xnnpack/dwconv.h>
+#include <xnnpack/embedding.h>
 #include <xnnpack/gavgpool.h>
 #include <xnnpack/gemm.h>
 #include <xnnpack/ibilinear.h>
@@ -16,7 +18,9 @@
 #include <xnnpack/intrinsics-polyfill.h>
 #include <xnnpack/math.h>
 #include <xnnpack/maxpool.h>
+#include <xnnpack/prefetch.h>
 #include <xnnpack/prelu.h>
+#include <xnnpack/rnorm.h>
 #include <xnnpack/unaligned.h>
 #include <xnnpack/vadd.h>
 #include <xnnpack/vcvt.h>
@@ -984,6 +988,103 @@ void xnn_f32_vsigmoid_ukernel__sse41_rr2_lut64_p2_div_x8(
   }
 }
 
+void xnn_qc4_f32_embedding_ukernel__sse41_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const __m128 vrow_scale = _mm_load1_ps(row_scale + index);
+
+      // Sign-extend the bytes to 16 bits, then extract the signed low and high nibbles with shifts and interleave them
+      // back into element order.
+      const __m128i vb = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i));
+      const __m128i vlo = _mm_srai_epi16(_mm_slli_epi16(vb, 12), 12);
+      const __m128i vhi = _mm_srai_epi16(vb, 4);
+      const __m128i vx01234567 = _mm_unpacklo_epi16(vlo, vhi);
+      const __m128i vx89ABCDEF = _mm_unpackhi_epi16(vlo, vhi);
+
+      const __m128 vx0 = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(vx01234567));
+      const __m128 vx1 = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(vx01234567, 8)));
+      const __m128 vx2 = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(vx89ABCDEF));
+      const __m128 vx3 = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(vx89ABCDEF, 8)));
+
+      vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx0, vrow_scale));
+      vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vx1, vrow_scale));
+      vacc2 = _mm_add_ps(vacc2, _mm_mul_ps(vx2, vrow_scale));
+      vacc3 = _mm_add_ps(vacc3, _mm_mul_ps(vx3, vrow_scale));
+    }
+    _mm_storeu_ps(output + 0, _mm_mul_ps(vacc0, vscale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(vacc1, vscale));
+    _mm_storeu_ps(output + 8, _mm_mul_ps(vacc2, vscale));
+    _mm_storeu_ps(output + 12, _mm_mul_ps(vacc3, vscale));
+    output += 16;
+    offset += 8;
+  }
+  if (channels >= 8) {
+    __m128 vacc_lo = _mm_setzero_ps();
+    __m128 vacc_hi = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const __m128 vrow_scale = _mm_load1_ps(row_scale + index);
+
+      const __m128i vb = _mm_cvtepi8_epi16(_mm_cvtsi32_si128((int) unaligned_load_s32(i)));
+      const __m128i vx01234567 = _mm_unpacklo_epi16(_mm_srai_epi16(_mm_slli_epi16(vb, 12), 12), _mm_srai_epi16(vb, 4));
+
+      const __m128 vx_lo = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(vx01234567));
+      const __m128 vx_hi = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(vx01234567, 8)));
+      vacc_lo = _mm_add_ps(vacc_lo, _mm_mul_ps(vx_lo, vrow_scale));
+      vacc_hi = _mm_add_ps(vacc_hi, _mm_mul_ps(vx_hi, vrow_scale));
+    }
+    _mm_storeu_ps(output, _mm_mul_ps(vacc_lo, vscale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(vacc_hi, vscale));
+    output += 8;
+    offset += 4;
+    channels -= 8;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (size_t c = 0; c < channels; c++) {
+    const uint32_t shift = (uint32_t) (c & 1) * 4;
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const uint8_t* i = (const uint8_t*) ((uintptr_t) table + index * table_stride + offset + (c >> 1));
+      const int32_t vx = math_asr_s32((int32_t) ((uint32_t) *i << (28 - shift)), 28);
+      vacc += (float) vx * row_scale[index];
+    }
+    *output++ = vacc * vscale_tail;
+  }
+}
+
 void xnn_qc8_dwconv_minmax_fp32_ukernel_25p8c__sse41_mul16(
     size_t channels,
     size_t output_width,
@@ -2341,6 +2442,85 @@ void xnn_qc8_dwconv_minmax_fp32_ukernel_9p8c__sse41_mul16(
   } while (--output_width != 0);
 }
 
+void xnn_qc8_f32_embedding_ukernel__sse41_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const __m128 vrow_scale = _mm_load1_ps(row_scale + index);
+
+      const __m128i vx = _mm_loadu_si128((const __m128i*) i);
+      const __m128 vx0 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(vx));
+      const __m128 vx1 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(vx, 4)));
+      const __m128 vx2 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(vx, 8)));
+      const __m128 vx3 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(vx, 12)));
+
+      vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx0, vrow_scale));
+      vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vx1, vrow_scale));
+      vacc2 = _mm_add_ps(vacc2, _mm_mul_ps(vx2, vrow_scale));
+      vacc3 = _mm_add_ps(vacc3, _mm_mul_ps(vx3, vrow_scale));
+    }
+    _mm_storeu_ps(output + 0, _mm_mul_ps(vacc0, vscale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(vacc1, vscale));
+    _mm_storeu_ps(output + 8, _mm_mul_ps(vacc2, vscale));
+    _mm_storeu_ps(output + 12, _mm_mul_ps(vacc3, vscale));
+    output += 16;
+    offset += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    __m128 vacc = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const __m128i vx = _mm_cvtsi32_si128((int) unaligned_load_s32(i));
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(vx)), _mm_load1_ps(row_scale + index)));
+    }
+    _mm_storeu_ps(output, _mm_mul_ps(vacc, vscale));
+    output += 4;
+    offset += 4;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      vacc += (float) (int32_t) *i * row_scale[index];
+    }
+    *output++ = vacc * vscale_tail;
+    offset += 1;
+  }
+}
+
 void xnn_qc8_gemm_minmax_fp32_ukernel_1x4c8__sse41_ld64(
     size_t mr,
     size_t nc,
@@ -2913,6 +3093,287 @@ void xnn_qc8_igemm_minmax_fp32_ukernel_3x4c8__sse41_ld64(
   } while (nc != 0);
 }
 
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4c8__sse41_ld64(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const __m128 vinput_scale0 = _mm_set1_ps(quantization_params[0].scale);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    __m128i vacc0x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point0);
+    __m128i vacc0x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point0);
+    __m128i vacc0x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point0);
+    __m128i vacc0x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point0);
+    w = (const int32_t*) w + 4;
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+      const __m128i vxa0 = _mm_cvtepi8_epi16(va0);
+      a0 += 8;
+
+      const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+      const __m128i vxb0 = _mm_cvtepi8_epi16(vb0);
+
+      vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+      const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 8));
+      const __m128i vxb1 = _mm_cvtepi8_epi16(vb1);
+
+      vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+      const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 16));
+      const __m128i vxb2 = _mm_cvtepi8_epi16(vb2);
+
+      vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+      const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 24));
+      const __m128i vxb3 = _mm_cvtepi8_epi16(vb3);
+
+      vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+
+      w = (const void*) ((const int8_t*) w + 32);
+      k += 8 * sizeof(int8_t);
+    }
+
+    const __m128i vacc0x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x0, vacc0x2), _mm_unpackhi_epi32(vacc0x0, vacc0x2));
+    const __m128i vacc0x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x1, vacc0x3), _mm_unpackhi_epi32(vacc0x1, vacc0x3));
+
+    const __m128i vacc0x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x02, vacc0x13), _mm_unpackhi_epi32(vacc0x02, vacc0x13));
+
+    __m128 vout0x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0x0123), vinput_scale0);
+
+    const __m128 vfilter_scale0123 = _mm_loadu_ps((const float*) w);
+    const __m128 vbias0123 = _mm_loadu_ps((const float*) w + 4);
+    w = (const void*) ((const float*) w + 8);
+    vout0x0123 = _mm_add_ps(_mm_mul_ps(vout0x0123, vfilter_scale0123), vbias0123);
+
+    const __m128 voutput_min = _mm_load_ps(params->sse.min);
+    vout0x0123 = _mm_max_ps(vout0x0123, voutput_min);
+
+    const __m128 voutput_max = _mm_load_ps(params->sse.max);
+    vout0x0123 = _mm_min_ps(vout0x0123, voutput_max);
+
+    if XNN_LIKELY(nc >= 4) {
+      _mm_storeu_ps(c0, vout0x0123);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vout0x0123);
+
+        vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vout0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_3x4c8__sse41_ld64(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 3);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const int8_t* a2 = (const int8_t*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+
+  // Rows beyond mr alias the previous row, so their quantization parameters must alias as well.
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const __m128 vinput_scale0 = _mm_set1_ps(quantization_params[0].scale);
+  const int32_t vinput_zero_point1 = quantization_params[min(mr - 1, 1)].zero_point;
+  const __m128 vinput_scale1 = _mm_set1_ps(quantization_params[min(mr - 1, 1)].scale);
+  const int32_t vinput_zero_point2 = quantization_params[min(mr - 1, 2)].zero_point;
+  const __m128 vinput_scale2 = _mm_set1_ps(quantization_params[min(mr - 1, 2)].scale);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    __m128i vacc0x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point0);
+    __m128i vacc0x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point0);
+    __m128i vacc0x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point0);
+    __m128i vacc0x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point0);
+    __m128i vacc1x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point1);
+    __m128i vacc1x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point1);
+    __m128i vacc1x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point1);
+    __m128i vacc1x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point1);
+    __m128i vacc2x0 = _mm_cvtsi32_si128(((const int32_t*) w)[0] * vinput_zero_point2);
+    __m128i vacc2x1 = _mm_cvtsi32_si128(((const int32_t*) w)[1] * vinput_zero_point2);
+    __m128i vacc2x2 = _mm_cvtsi32_si128(((const int32_t*) w)[2] * vinput_zero_point2);
+    __m128i vacc2x3 = _mm_cvtsi32_si128(((const int32_t*) w)[3] * vinput_zero_point2);
+    w = (const int32_t*) w + 4;
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+      const __m128i vxa0 = _mm_cvtepi8_epi16(va0);
+      a0 += 8;
+      const __m128i va1 = _mm_loadl_epi64((const __m128i*) a1);
+      const __m128i vxa1 = _mm_cvtepi8_epi16(va1);
+      a1 += 8;
+      const __m128i va2 = _mm_loadl_epi64((const __m128i*) a2);
+      const __m128i vxa2 = _mm_cvtepi8_epi16(va2);
+      a2 += 8;
+
+      const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+      const __m128i vxb0 = _mm_cvtepi8_epi16(vb0);
+
+      vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+      vacc1x0 = _mm_add_epi32(vacc1x0, _mm_madd_epi16(vxa1, vxb0));
+      vacc2x0 = _mm_add_epi32(vacc2x0, _mm_madd_epi16(vxa2, vxb0));
+      const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 8));
+      const __m128i vxb1 = _mm_cvtepi8_epi16(vb1);
+
+      vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+      vacc1x1 = _mm_add_epi32(vacc1x1, _mm_madd_epi16(vxa1, vxb1));
+      vacc2x1 = _mm_add_epi32(vacc2x1, _mm_madd_epi16(vxa2, vxb1));
+      const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 16));
+      const __m128i vxb2 = _mm_cvtepi8_epi16(vb2);
+
+      vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+      vacc1x2 = _mm_add_epi32(vacc1x2, _mm_madd_epi16(vxa1, vxb2));
+      vacc2x2 = _mm_add_epi32(vacc2x2, _mm_madd_epi16(vxa2, vxb2));
+      const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 24));
+      const __m128i vxb3 = _mm_cvtepi8_epi16(vb3);
+
+      vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+      vacc1x3 = _mm_add_epi32(vacc1x3, _mm_madd_epi16(vxa1, vxb3));
+      vacc2x3 = _mm_add_epi32(vacc2x3, _mm_madd_epi16(vxa2, vxb3));
+
+      w = (const void*) ((const int8_t*) w + 32);
+      k += 8 * sizeof(int8_t);
+    }
+
+    const __m128i vacc0x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x0, vacc0x2), _mm_unpackhi_epi32(vacc0x0, vacc0x2));
+    const __m128i vacc0x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x1, vacc0x3), _mm_unpackhi_epi32(vacc0x1, vacc0x3));
+    const __m128i vacc1x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc1x0, vacc1x2), _mm_unpackhi_epi32(vacc1x0, vacc1x2));
+    const __m128i vacc1x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc1x1, vacc1x3), _mm_unpackhi_epi32(vacc1x1, vacc1x3));
+    const __m128i vacc2x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc2x0, vacc2x2), _mm_unpackhi_epi32(vacc2x0, vacc2x2));
+    const __m128i vacc2x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc2x1, vacc2x3), _mm_unpackhi_epi32(vacc2x1, vacc2x3));
+
+    const __m128i vacc0x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x02, vacc0x13), _mm_unpackhi_epi32(vacc0x02, vacc0x13));
+    const __m128i vacc1x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc1x02, vacc1x13), _mm_unpackhi_epi32(vacc1x02, vacc1x13));
+    const __m128i vacc2x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc2x02, vacc2x13), _mm_unpackhi_epi32(vacc2x02, vacc2x13));
+
+    __m128 vout0x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0x0123), vinput_scale0);
+    __m128 vout1x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc1x0123), vinput_scale1);
+    __m128 vout2x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc2x0123), vinput_scale2);
+
+    const __m128 vfilter_scale0123 = _mm_loadu_ps((const float*) w);
+    const __m128 vbias0123 = _mm_loadu_ps((const float*) w + 4);
+    w = (const void*) ((const float*) w + 8);
+    vout0x0123 = _mm_add_ps(_mm_mul_ps(vout0x0123, vfilter_scale0123), vbias0123);
+    vout1x0123 = _mm_add_ps(_mm_mul_ps(vout1x0123, vfilter_scale0123), vbias0123);
+    vout2x0123 = _mm_add_ps(_mm_mul_ps(vout2x0123, vfilter_scale0123), vbias0123);
+
+    const __m128 voutput_min = _mm_load_ps(params->sse.min);
+    vout0x0123 = _mm_max_ps(vout0x0123, voutput_min);
+    vout1x0123 = _mm_max_ps(vout1x0123, voutput_min);
+    vout2x0123 = _mm_max_ps(vout2x0123, voutput_min);
+
+    const __m128 voutput_max = _mm_load_ps(params->sse.max);
+    vout0x0123 = _mm_min_ps(vout0x0123, voutput_max);
+    vout1x0123 = _mm_min_ps(vout1x0123, voutput_max);
+    vout2x0123 = _mm_min_ps(vout2x0123, voutput_max);
+
+    if XNN_LIKELY(nc >= 4) {
+      _mm_storeu_ps(c0, vout0x0123);
+      _mm_storeu_ps(c1, vout1x0123);
+      _mm_storeu_ps(c2, vout2x0123);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const int8_t*) ((uintptr_t) a1 - kc);
+      a2 = (const int8_t*) ((uintptr_t) a2 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vout0x0123);
+        _mm_storel_pi((__m64*) c1, vout1x0123);
+        _mm_storel_pi((__m64*) c2, vout2x0123);
+
+        vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+        vout1x0123 = _mm_movehl_ps(vout1x0123, vout1x0123);
+        vout2x0123 = _mm_movehl_ps(vout2x0123, vout2x0123);
+
+        c0 += 2;
+        c1 += 2;
+        c2 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vout0x0123);
+        _mm_store_ss(c1, vout1x0123);
+        _mm_store_ss(c2, vout2x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_qs8_dwconv_minmax_fp32_ukernel_25p8c__sse41_mul16_add16(
     size_t channels,
     size_t output_width,
@@ -5071,6 +5532,123 @@ void xnn_qs8_igemm_minmax_fp32_ukernel_3x4c8__sse41_ld64(
   } while (nc != 0);
 }
 
+void xnn_qs8_rnorm_ukernel__sse41_x16(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const __m128i vinput_zero_point8 = _mm_set1_epi16((short) vinput_zero_point);
+  const __m128i vone = _mm_set1_epi16(1);
+
+  // Statistics are exact: they are accumulated on zero-point-adjusted integers. The 32-bit sums of squares are
+  // flushed into 64-bit accumulators every 4096 iterations, before they could overflow.
+  const int8_t* i = input;
+  int64_t vsum = 0;
+  int64_t vsumsq = 0;
+  size_t c = channels;
+  while (c >= 16) {
+    __m128i vacc_sum = _mm_setzero_si128();
+    __m128i vacc_sumsq = _mm_setzero_si128();
+    size_t block = min(c >> 4, 4096);
+    c -= block << 4;
+    do {
+      const __m128i vx = _mm_loadu_si128((const __m128i*) i);
+      i += 16;
+
+      const __m128i vd_lo = _mm_sub_epi16(_mm_cvtepi8_epi16(vx), vinput_zero_point8);
+      const __m128i vd_hi = _mm_sub_epi16(_mm_cvtepi8_epi16(_mm_unpackhi_epi64(vx, vx)), vinput_zero_point8);
+
+      vacc_sum = _mm_add_epi32(vacc_sum, _mm_madd_epi16(_mm_add_epi16(vd_lo, vd_hi), vone));
+      vacc_sumsq = _mm_add_epi32(vacc_sumsq, _mm_madd_epi16(vd_lo, vd_lo));
+      vacc_sumsq = _mm_add_epi32(vacc_sumsq, _mm_madd_epi16(vd_hi, vd_hi));
+    } while (--block != 0);
+
+    vacc_sum = _mm_add_epi32(vacc_sum, _mm_shuffle_epi32(vacc_sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    vacc_sum = _mm_add_epi32(vacc_sum, _mm_shuffle_epi32(vacc_sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    vsum += (int64_t) _mm_cvtsi128_si32(vacc_sum);
+    vsumsq += (int64_t) _mm_cvtsi128_si32(vacc_sumsq) + (int64_t) _mm_extract_epi32(vacc_sumsq, 1) +
+      (int64_t) _mm_extract_epi32(vacc_sumsq, 2) + (int64_t) _mm_extract_epi32(vacc_sumsq, 3);
+  }
+  for (; c != 0; c -= 1) {
+    const int32_t vd = (int32_t) *i++ - vinput_zero_point;
+    vsum += (int64_t) vd;
+    vsumsq += (int64_t) (vd * vd);
+  }
+
+  const float vinv_n = 1.0f / (float) channels;
+  float vmean = 0.0f;
+  float vvar = (float) vsumsq * vinv_n;
+  if (params->scalar.subtract_mean) {
+    // n^2 * variance = n * sum(d^2) - sum(d)^2 is computed exactly in 64-bit integers.
+    const int64_t vscaled_var = (int64_t) channels * vsumsq - vsum * vsum;
+    vmean = (float) vsum * vinv_n;
+    vvar = (float) vscaled_var * (vinv_n * vinv_n);
+  }
+  const float vscale = params->scalar.inv_output_scale / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m128i vinput_zero_point32 = _mm_set1_epi32(vinput_zero_point);
+  const __m128 vmean4 = _mm_set1_ps(vmean);
+  const __m128 vscale4 = _mm_set1_ps(vscale);
+  const __m128i voutput_zero_point = _mm_set1_epi16((short) params->scalar.output_zero_point);
+  const __m128i voutput_min = _mm_set1_epi8((char) params->scalar.output_min);
+  const __m128i voutput_max = _mm_set1_epi8((char) params->scalar.output_max);
+  const float* gamma = weights;
+  const float* beta = weights + channels;
+  i = input;
+  int8_t* o = output;
+  for (c = channels; c >= 16; c -= 16) {
+    const __m128i vx = _mm_loadu_si128((const __m128i*) i);
+    i += 16;
+
+    const __m128i vx_lo = _mm_cvtepi8_epi16(vx);
+    const __m128i vx_hi = _mm_cvtepi8_epi16(_mm_unpackhi_epi64(vx, vx));
+    const __m128 vd0 = _mm_sub_ps(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(vx_lo), vinput_zero_point32)), vmean4);
+    const __m128 vd1 = _mm_sub_ps(
+      _mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vx_lo, vx_lo)), vinput_zero_point32)), vmean4);
+    const __m128 vd2 = _mm_sub_ps(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(vx_hi), vinput_zero_point32)), vmean4);
+    const __m128 vd3 = _mm_sub_ps(
+      _mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vx_hi, vx_hi)), vinput_zero_point32)), vmean4);
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(vd0, _mm_mul_ps(_mm_loadu_ps(gamma), vscale4)), _mm_loadu_ps(beta));
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(vd1, _mm_mul_ps(_mm_loadu_ps(gamma + 4), vscale4)), _mm_loadu_ps(beta + 4));
+    const __m128 vy2 = _mm_add_ps(_mm_mul_ps(vd2, _mm_mul_ps(_mm_loadu_ps(gamma + 8), vscale4)), _mm_loadu_ps(beta + 8));
+    const __m128 vy3 = _mm_add_ps(_mm_mul_ps(vd3, _mm_mul_ps(_mm_loadu_ps(gamma + 12), vscale4)), _mm_loadu_ps(beta + 12));
+    gamma += 16;
+    beta += 16;
+
+    const __m128i vy01 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy0), _mm_cvtps_epi32(vy1)), voutput_zero_point);
+    const __m128i vy23 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy2), _mm_cvtps_epi32(vy3)), voutput_zero_point);
+    __m128i vy = _mm_packs_epi16(vy01, vy23);
+    vy = _mm_max_epi8(vy, voutput_min);
+    vy = _mm_min_epi8(vy, voutput_max);
+
+    _mm_storeu_si128((__m128i*) o, vy);
+    o += 16;
+  }
+  if XNN_UNLIKELY(c != 0) {
+    const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+    const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+    const float vmagic_bias = params->scalar.magic_bias;
+    const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+    do {
+      const float vd = (float) ((int32_t) *i++ - vinput_zero_point) - vmean;
+      float vy = vd * (*gamma++ * vscale) + *beta++;
+      vy = math_max_f32(vy, voutput_min_less_zero_point);
+      vy = math_min_f32(vy, voutput_max_less_zero_point);
+      vy += vmagic_bias;
+      *o++ = (int8_t) ((int32_t) float_as_uint32(vy) - vmagic_bias_less_output_zero_point);
+    } while (--c != 0);
+  }
+}
+
 void xnn_qs8_vadd_minmax_ukernel__sse41_mul16_ld64_x8(
     size_t batch,
     const int8_t* input_a,
@@ -8,6 +8,7 @@
 #include <assert.h> // For assert.
 #include <stddef.h> // For size_t.
 #include <stdint.h> // For uint32_t.
+#include <string.h> // For memcmp, memcpy, memset.
 
 #include "xnnpack.h"
 #include "xnnpack/allocator.h"
@@ -306,7 +307,8 @@ enum xnn_status xnn_release_code_cache(struct xnn_code_cache* cache)
 enum xnn_status xnn_internal_init_weights_cache(
   struct xnn_weights_cache* cache,
   size_t num_buckets,
-  size_t buffer_size)
+  size_t buffer_size,
+  uint32_t memory_flags)
 {
   memset(cache, 0, sizeof(struct xnn_weights_cache));
 
@@ -316,7 +318,7 @@ enum xnn_status xnn_internal_init_weights_cache(
     goto error;
   }
 
-  status = xnn_allocate_weights_memory(&cache->cache.weights, buffer_size);
+  status = xnn_allocate_weights_memory(&cache->cache.weights, buffer_size, memory_flags);
   if (status != xnn_status_success) {
     goto error;
   }
@@ -335,7 +337,15 @@ error:
 
 enum xnn_status xnn_init_weights_cache_with_size(struct xnn_weights_cache* cache, size_t size)
 {
-  return xnn_internal_init_weights_cache(cache, XNN_CACHE_INITIAL_BUCKETS, size);
+  return xnn_init_weights_cache_with_memory_flags(cache, size, /*memory_flags=*/0);
+}
+
+enum xnn_status xnn_init_weights_cache_with_memory_flags(
+  struct xnn_weights_cache* cache,
+  size_t size,
+  uint32_t memory_flags)
+{
+  return xnn_internal_init_weights_cache(cache, XNN_CACHE_INITIAL_BUCKETS, size, memory_flags);
 }
 
 enum xnn_status xnn_init_weights_cache(struct xnn_weights_cache* cache)
@@ -490,3 +500,82 @@ size_t xnn_get_or_insert_weights_cache(struct xnn_weights_cache* cache, void* pt
 bool xnn_weights_cache_is_finalized(struct xnn_weights_cache* cache) {
   return cache->finalization_state != xnn_cache_state_not_finalized;
 }
+
+void xnn_init_indirection_cache(struct xnn_indirection_cache* cache)
+{
+  memset(cache, 0, sizeof(struct xnn_indirection_cache));
+}
+
+static void release_indirection_cache_entry_memory(struct xnn_indirection_cache_entry* entry)
+{
+  xnn_release_memory((void*) entry->buffer);
+  xnn_release_memory(entry);
+}
+
+void xnn_release_indirection_cache(struct xnn_indirection_cache* cache)
+{
+  if XNN_LIKELY(cache != NULL) {
+    struct xnn_indirection_cache_entry* entry = cache->entries;
+    while (entry != NULL) {
+      struct xnn_indirection_cache_entry* next = entry->next;
+      release_indirection_cache_entry_memory(entry);
+      entry = next;
+    }
+    cache->entries = NULL;
+  }
+}
+
+struct xnn_indirection_cache_entry* xnn_get_or_insert_indirection_cache(
+  struct xnn_indirection_cache* cache,
+  const struct xnn_indirection_cache_key* key,
+  size_t buffer_size,
+  bool* initialize)
+{
+  for (struct xnn_indirection_cache_entry* entry = cache->entries; entry != NULL; entry = entry->next) {
+    if (memcmp(&entry->key, key, sizeof(struct xnn_indirection_cache_key)) == 0) {
+      assert(entry->buffer_size == buffer_size);
+      entry->num_users += 1;
+      cache->hits += 1;
+      *initialize = false;
+      return entry;
+    }
+  }
+
+  struct xnn_indirection_cache_entry* entry = xnn_allocate_zero_memory(sizeof(struct xnn_indirection_cache_entry));
+  if (entry == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for indirection cache entry",
+      sizeof(struct xnn_indirection_cache_entry));
+    return NULL;
+  }
+  entry->buffer = xnn_allocate_memory(buffer_size);
+  if (entry->buffer == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for shared indirection buffer", buffer_size);
+    xnn_release_memory(entry);
+    return NULL;
+  }
+  memcpy(&entry->key, key, sizeof(struct xnn_indirection_cache_key));
+  entry->buffer_size = buffer_size;
+  entry->num_users = 1;
+  entry->next = cache->entries;
+  cache->entries = entry;
+  cache->misses += 1;
+  *initialize = true;
+  return entry;
+}
+
+void xnn_release_indirection_cache_entry(
+  struct xnn_indirection_cache* cache,
+  struct xnn_indirection_cache_entry* entry)
+{
+  assert(entry->num_users != 0);
+  if (--entry->num_users != 0) {
+    return;
+  }
+  for (struct xnn_indirection_cache_entry** link = &cache->entries; *link != NULL; link = &(*link)->next) {
+    if (*link == entry) {
+      *link = entry->next;
+      break;
+    }
+  }
+  release_indirection_cache_entry_memory(entry);
+}
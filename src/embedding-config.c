@@ -0,0 +1,201 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+#include <xnnpack/common.h>
+#include <xnnpack/config.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/microparams-init.h>
+
+
+static struct xnn_embedding_config f16_f32_embedding_config = {0};
+static struct xnn_embedding_config f32_embedding_config = {0};
+static struct xnn_embedding_config qc4_f32_embedding_config = {0};
+static struct xnn_embedding_config qc8_f32_embedding_config = {0};
+
+#if XNN_PLATFORM_WINDOWS
+  static INIT_ONCE init_guard_f16_f32_embedding = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_embedding = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_qc4_f32_embedding = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_qc8_f32_embedding = INIT_ONCE_STATIC_INIT;
+#else
+  static pthread_once_t init_guard_f16_f32_embedding = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_embedding = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_qc4_f32_embedding = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_qc8_f32_embedding = PTHREAD_ONCE_INIT;
+#endif
+
+static void init_f16_f32_embedding_config(void) {
+  #if XNN_ARCH_ARM || XNN_ARCH_ARM64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16) {
+      f16_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f16_f32_embedding_ukernel__neonfp16_c16;
+    } else {
+      f16_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f16_f32_embedding_ukernel__scalar_c4;
+    }
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_f16c) {
+      f16_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f16_f32_embedding_ukernel__f16c_c16;
+    } else {
+      f16_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f16_f32_embedding_ukernel__scalar_c4;
+    }
+  #else
+    f16_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f16_f32_embedding_ukernel__scalar_c4;
+  #endif
+  f16_f32_embedding_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_f32_embedding_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f32_embedding_ukernel__neon_c16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f32_embedding_ukernel__scalar_c4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f32_embedding_ukernel__neon_c16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f32_embedding_ukernel__sse_c16;
+  #else
+    f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_f32_embedding_ukernel__scalar_c4;
+  #endif
+  f32_embedding_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_qc4_f32_embedding_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      qc4_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc4_f32_embedding_ukernel__neon_c16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      qc4_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc4_f32_embedding_ukernel__scalar_c4;
+    }
+  #elif XNN_ARCH_ARM64
+    qc4_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc4_f32_embedding_ukernel__neon_c16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_sse4_1) {
+      qc4_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc4_f32_embedding_ukernel__sse41_c16;
+    } else {
+      qc4_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc4_f32_embedding_ukernel__scalar_c4;
+    }
+  #else
+    qc4_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc4_f32_embedding_ukernel__scalar_c4;
+  #endif
+  qc4_f32_embedding_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_qc8_f32_embedding_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      qc8_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc8_f32_embedding_ukernel__neon_c16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      qc8_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc8_f32_embedding_ukernel__scalar_c4;
+    }
+  #elif XNN_ARCH_ARM64
+    qc8_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc8_f32_embedding_ukernel__neon_c16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_sse4_1) {
+      qc8_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc8_f32_embedding_ukernel__sse41_c16;
+    } else {
+      qc8_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc8_f32_embedding_ukernel__scalar_c4;
+    }
+  #else
+    qc8_f32_embedding_config.ukernel = (xnn_embedding_ukernel_fn) xnn_qc8_f32_embedding_ukernel__scalar_c4;
+  #endif
+  qc8_f32_embedding_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+#if XNN_PLATFORM_WINDOWS
+  static BOOL CALLBACK init_f16_f32_embedding_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_f32_embedding_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_embedding_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_embedding_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_qc4_f32_embedding_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_qc4_f32_embedding_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_qc8_f32_embedding_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_qc8_f32_embedding_config();
+    return TRUE;
+  }
+#endif
+
+const struct xnn_embedding_config* xnn_init_f16_f32_embedding_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_f32_embedding, &init_f16_f32_embedding_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_f32_embedding, &init_f16_f32_embedding_config);
+  #endif
+  return &f16_f32_embedding_config;
+}
+
+const struct xnn_embedding_config* xnn_init_f32_embedding_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_embedding, &init_f32_embedding_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_embedding, &init_f32_embedding_config);
+  #endif
+  return &f32_embedding_config;
+}
+
+const struct xnn_embedding_config* xnn_init_qc4_f32_embedding_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_qc4_f32_embedding, &init_qc4_f32_embedding_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_qc4_f32_embedding, &init_qc4_f32_embedding_config);
+  #endif
+  return &qc4_f32_embedding_config;
+}
+
+const struct xnn_embedding_config* xnn_init_qc8_f32_embedding_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_qc8_f32_embedding, &init_qc8_f32_embedding_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_qc8_f32_embedding, &init_qc8_f32_embedding_config);
+  #endif
+  return &qc8_f32_embedding_config;
+}
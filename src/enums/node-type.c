@@ -54,22 +54,30 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Divide";
     case xnn_node_type_elu:
       return "ELU";
+    case xnn_node_type_embedding_lookup:
+      return "Embedding Lookup";
     case xnn_node_type_even_split2:
       return "Even Split2";
     case xnn_node_type_even_split3:
       return "Even Split3";
     case xnn_node_type_even_split4:
       return "Even Split4";
+    case xnn_node_type_exp:
+      return "Exp";
     case xnn_node_type_floor:
       return "Floor";
     case xnn_node_type_fully_connected:
       return "Fully Connected";
+    case xnn_node_type_gelu:
+      return "GELU";
     case xnn_node_type_global_average_pooling_1d:
       return "Global Average Pooling 1D";
     case xnn_node_type_global_average_pooling_2d:
       return "Global Average Pooling 2D";
     case xnn_node_type_hardswish:
       return "HardSwish";
+    case xnn_node_type_layer_norm:
+      return "Layer Norm";
     case xnn_node_type_leaky_relu:
       return "Leaky ReLU";
     case xnn_node_type_max_pooling_2d:
@@ -84,8 +92,12 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Negate";
     case xnn_node_type_prelu:
       return "PReLU";
+    case xnn_node_type_rms_norm:
+      return "RMS Norm";
     case xnn_node_type_sigmoid:
       return "Sigmoid";
+    case xnn_node_type_silu:
+      return "SiLU";
     case xnn_node_type_softmax:
       return "Softmax";
     case xnn_node_type_space_to_depth_2d:
@@ -98,6 +110,8 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Squared Difference";
     case xnn_node_type_static_constant_pad:
       return "Static Constant Pad";
+    case xnn_node_type_static_reduce:
+      return "Static Reduce";
     case xnn_node_type_static_reshape:
       return "Static Reshape";
     case xnn_node_type_static_resize_bilinear_2d:
@@ -108,6 +122,8 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Static Transpose";
     case xnn_node_type_subtract:
       return "Subtract";
+    case xnn_node_type_tanh:
+      return "Tanh";
     case xnn_node_type_unpooling_2d:
       return "Unpooling 2D";
   }
@@ -14,14 +14,15 @@
 #include <xnnpack/operator-type.h>
 
 
-static const uint16_t offset[127] = {
+static const uint16_t offset[151] = {
   0, 8, 22, 36, 50, 64, 78, 92, 119, 147, 175, 203, 230, 257, 275, 293, 318, 344, 360, 376, 391, 406, 428, 451, 474,
   497, 520, 543, 566, 584, 607, 625, 648, 672, 696, 720, 744, 768, 792, 816, 830, 845, 860, 886, 912, 938, 964, 996,
-  1028, 1054, 1081, 1108, 1125, 1142, 1156, 1170, 1184, 1200, 1216, 1242, 1268, 1294, 1320, 1354, 1388, 1422, 1456,
-  1490, 1524, 1544, 1564, 1585, 1606, 1627, 1648, 1672, 1696, 1719, 1742, 1760, 1778, 1796, 1814, 1833, 1852, 1871,
-  1890, 1907, 1924, 1940, 1956, 1984, 2012, 2040, 2068, 2095, 2122, 2140, 2158, 2176, 2194, 2209, 2225, 2241, 2259,
-  2277, 2295, 2321, 2348, 2375, 2392, 2409, 2431, 2453, 2482, 2511, 2530, 2549, 2568, 2587, 2602, 2617, 2636, 2656,
-  2676, 2697, 2718
+  1028, 1054, 1081, 1108, 1125, 1142, 1156, 1170, 1202, 1229, 1261, 1293, 1307, 1321, 1335, 1351, 1367, 1393, 1419,
+  1456, 1482, 1508, 1523, 1538, 1572, 1606, 1640, 1674, 1708, 1742, 1762, 1782, 1803, 1824, 1845, 1866, 1887, 1908,
+  1929, 1953, 1977, 2000, 2023, 2041, 2059, 2077, 2095, 2114, 2133, 2152, 2171, 2188, 2205, 2221, 2237, 2257, 2278,
+  2300, 2321, 2342, 2370, 2398, 2426, 2454, 2481, 2508, 2527, 2546, 2565, 2583, 2601, 2619, 2637, 2652, 2667, 2682,
+  2698, 2714, 2732, 2750, 2768, 2794, 2821, 2848, 2865, 2882, 2904, 2926, 2955, 2984, 3003, 3022, 3041, 3060, 3075,
+  3090, 3105, 3120, 3139, 3159, 3179, 3200, 3221
 };
 
 static const char data[] = 
@@ -80,13 +81,22 @@ static const char data[] =
   "Divide (ND, F32)\0"
   "ELU (NC, F16)\0"
   "ELU (NC, F32)\0"
+  "Embedding Lookup (NC, F16, F32)\0"
+  "Embedding Lookup (NC, F32)\0"
+  "Embedding Lookup (NC, QC4, F32)\0"
+  "Embedding Lookup (NC, QC8, F32)\0"
   "ELU (NC, QS8)\0"
+  "Exp (NC, F16)\0"
+  "Exp (NC, F32)\0"
   "Floor (NC, F16)\0"
   "Floor (NC, F32)\0"
   "Fully Connected (NC, F16)\0"
   "Fully Connected (NC, F32)\0"
+  "Fully Connected (NC, QD8, F32, QC8W)\0"
   "Fully Connected (NC, QS8)\0"
   "Fully Connected (NC, QU8)\0"
+  "GELU (NC, F16)\0"
+  "GELU (NC, F32)\0"
   "Global Average Pooling (NCW, F16)\0"
   "Global Average Pooling (NCW, F32)\0"
   "Global Average Pooling (NWC, F16)\0"
@@ -95,6 +105,9 @@ static const char data[] =
   "Global Average Pooling (NWC, QU8)\0"
   "HardSwish (NC, F16)\0"
   "HardSwish (NC, F32)\0"
+  "Layer Norm (NC, F16)\0"
+  "Layer Norm (NC, F32)\0"
+  "Layer Norm (NC, QS8)\0"
   "Leaky ReLU (NC, F16)\0"
   "Leaky ReLU (NC, F32)\0"
   "Leaky ReLU (NC, QS8)\0"
@@ -115,16 +128,26 @@ static const char data[] =
   "Negate (NC, F32)\0"
   "PReLU (NC, F16)\0"
   "PReLU (NC, F32)\0"
+  "Reduce L2 (ND, F32)\0"
+  "Reduce Max (ND, F32)\0"
+  "Reduce Mean (ND, F32)\0"
+  "Reduce Min (ND, F32)\0"
+  "Reduce Sum (ND, F32)\0"
   "Resize Bilinear (NCHW, F16)\0"
   "Resize Bilinear (NCHW, F32)\0"
   "Resize Bilinear (NHWC, F16)\0"
   "Resize Bilinear (NHWC, F32)\0"
   "Resize Bilinear (NHWC, S8)\0"
   "Resize Bilinear (NHWC, U8)\0"
+  "RMS Norm (NC, F16)\0"
+  "RMS Norm (NC, F32)\0"
+  "RMS Norm (NC, QS8)\0"
   "Sigmoid (NC, F16)\0"
   "Sigmoid (NC, F32)\0"
   "Sigmoid (NC, QS8)\0"
   "Sigmoid (NC, QU8)\0"
+  "SiLU (NC, F16)\0"
+  "SiLU (NC, F32)\0"
   "Slice (ND, X8)\0"
   "Slice (ND, X16)\0"
   "Slice (ND, X32)\0"
@@ -144,6 +167,8 @@ static const char data[] =
   "Subtract (ND, F32)\0"
   "Subtract (ND, QS8)\0"
   "Subtract (ND, QU8)\0"
+  "Tanh (NC, F16)\0"
+  "Tanh (NC, F32)\0"
   "Tanh (NC, QS8)\0"
   "Tanh (NC, QU8)\0"
   "Transpose (ND, X8)\0"
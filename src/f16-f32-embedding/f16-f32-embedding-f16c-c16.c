@@ -0,0 +1,74 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_f16_f32_embedding_ukernel__f16c_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m256 vscale = _mm256_broadcast_ss(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m256 vacc0 = _mm256_setzero_ps();
+    __m256 vacc1 = _mm256_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 = _mm256_add_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8))));
+    }
+    _mm256_storeu_ps(output, _mm256_mul_ps(vacc0, vscale));
+    _mm256_storeu_ps(output + 8, _mm256_mul_ps(vacc1, vscale));
+    output += 16;
+    offset += 16 * sizeof(uint16_t);
+  }
+  if (channels >= 8) {
+    __m256 vacc = _mm256_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = _mm256_add_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)));
+    }
+    _mm256_storeu_ps(output, _mm256_mul_ps(vacc, vscale));
+    output += 8;
+    offset += 8 * sizeof(uint16_t);
+    channels -= 8;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += _cvtsh_ss(*((const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset)));
+    }
+    *output++ = vacc * vscale_tail;
+    offset += sizeof(uint16_t);
+  }
+}
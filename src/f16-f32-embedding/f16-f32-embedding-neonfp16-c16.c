@@ -0,0 +1,96 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_f16_f32_embedding_ukernel__neonfp16_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      const float16x8_t vh0 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+      const float16x8_t vh1 = vreinterpretq_f16_u16(vld1q_u16(i));
+
+      vacc0 = vaddq_f32(vacc0, vcvt_f32_f16(vget_low_f16(vh0)));
+      vacc1 = vaddq_f32(vacc1, vcvt_f32_f16(vget_high_f16(vh0)));
+      vacc2 = vaddq_f32(vacc2, vcvt_f32_f16(vget_low_f16(vh1)));
+      vacc3 = vaddq_f32(vacc3, vcvt_f32_f16(vget_high_f16(vh1)));
+    }
+    vst1q_f32(output, vmulq_f32(vacc0, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc1, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc2, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc3, vscale)); output += 4;
+    offset += 16 * sizeof(uint16_t);
+  }
+  for (; channels >= 4; channels -= 4) {
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = vaddq_f32(vacc, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))));
+    }
+    vst1q_f32(output, vmulq_f32(vacc, vscale)); output += 4;
+    offset += 4 * sizeof(uint16_t);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    // Gather the remaining 1-3 elements of each row into the low lanes of a vector.
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      uint16x4_t vh = vmov_n_u16(0);
+      vh = vld1_lane_u16(i, vh, 0);
+      if (channels >= 2) {
+        vh = vld1_lane_u16(i + 1, vh, 1);
+        if (channels == 3) {
+          vh = vld1_lane_u16(i + 2, vh, 2);
+        }
+      }
+      vacc = vaddq_f32(vacc, vcvt_f32_f16(vreinterpret_f16_u16(vh)));
+    }
+    vacc = vmulq_f32(vacc, vscale);
+    float32x2_t vacc_lo = vget_low_f32(vacc);
+    if (channels & 2) {
+      vst1_f32(output, vacc_lo); output += 2;
+      vacc_lo = vget_high_f32(vacc);
+    }
+    if (channels & 1) {
+      vst1_lane_f32(output, vacc_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/math.h>
+#include <xnnpack/prefetch.h>
+
+
+// Same conversion as in the F16->F32 VCVT scalar micro-kernels, with the constants folded in.
+XNN_INLINE static float cvt_f16_f32(uint16_t h) {
+  const uint32_t vw = (uint32_t) h << 16;
+  const uint32_t vsign = vw & UINT32_C(0x80000000);
+  const uint32_t v2w = vw + vw;
+  const uint32_t vnorm = float_as_uint32(uint32_as_float((v2w >> 4) + UINT32_C(0x70000000)) * 0x1.0p-112f);
+  const uint32_t vdenorm = float_as_uint32(uint32_as_float((v2w >> 17) | UINT32_C(0x3F000000)) - 0.5f);
+  return uint32_as_float(vsign | (XNN_UNPREDICTABLE(v2w < UINT32_C(0x08000000)) ? vdenorm : vnorm));
+}
+
+void xnn_f16_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const uint16_t* i = (const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 += cvt_f16_f32(i[0]);
+      vacc1 += cvt_f16_f32(i[1]);
+      vacc2 += cvt_f16_f32(i[2]);
+      vacc3 += cvt_f16_f32(i[3]);
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 4 * sizeof(uint16_t);
+  }
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += cvt_f16_f32(*((const uint16_t*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset)));
+    }
+    *output++ = vacc * vscale;
+    offset += sizeof(uint16_t);
+  }
+}
@@ -0,0 +1,108 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f16_rnorm_ukernel__f16c_x16(
+    size_t channels,
+    const void* input,
+    const void* weights,
+    void* output,
+    const union xnn_f16_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(uint16_t);
+  const uint16_t* i = (const uint16_t*) input;
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated in FP32, relative to the first element to avoid catastrophic cancellation.
+  const float vshift = vsubtract_mean ? _cvtsh_ss(*i) : 0.0f;
+
+  const __m256 vshift8 = _mm256_set1_ps(vshift);
+  __m256 vsum0 = _mm256_setzero_ps();
+  __m256 vsum1 = _mm256_setzero_ps();
+  __m256 vsumsq0 = _mm256_setzero_ps();
+  __m256 vsumsq1 = _mm256_setzero_ps();
+  size_t c = channels;
+  for (; c >= 16 * sizeof(uint16_t); c -= 16 * sizeof(uint16_t)) {
+    const __m256 vd0 = _mm256_sub_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)), vshift8);
+    const __m256 vd1 = _mm256_sub_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8))), vshift8);
+    i += 16;
+
+    vsum0 = _mm256_add_ps(vsum0, vd0);
+    vsum1 = _mm256_add_ps(vsum1, vd1);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd0, vd0));
+    vsumsq1 = _mm256_add_ps(vsumsq1, _mm256_mul_ps(vd1, vd1));
+  }
+  if (c >= 8 * sizeof(uint16_t)) {
+    const __m256 vd = _mm256_sub_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i)), vshift8);
+    i += 8;
+
+    vsum0 = _mm256_add_ps(vsum0, vd);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd, vd));
+    c -= 8 * sizeof(uint16_t);
+  }
+  const __m256 vsum8 = _mm256_add_ps(vsum0, vsum1);
+  const __m256 vsumsq8 = _mm256_add_ps(vsumsq0, vsumsq1);
+  __m128 vsum = _mm_add_ps(_mm256_castps256_ps128(vsum8), _mm256_extractf128_ps(vsum8, 1));
+  __m128 vsumsq = _mm_add_ps(_mm256_castps256_ps128(vsumsq8), _mm256_extractf128_ps(vsumsq8, 1));
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_movehdup_ps(vsum));
+  vsumsq = _mm_add_ss(vsumsq, _mm_movehdup_ps(vsumsq));
+  float vsum_tail = _mm_cvtss_f32(vsum);
+  float vsumsq_tail = _mm_cvtss_f32(vsumsq);
+  for (; c != 0; c -= sizeof(uint16_t)) {
+    const float vd = _cvtsh_ss(*i++) - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m256 vmean8 = _mm256_set1_ps(vmean);
+  const __m256 vrstd8 = _mm256_set1_ps(vrstd);
+  const uint16_t* gamma = (const uint16_t*) weights;
+  const uint16_t* beta = gamma + n;
+  i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (c = channels; c >= 8 * sizeof(uint16_t); c -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+    const __m256 vscale = _mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) gamma)), vrstd8);
+    gamma += 8;
+    const __m256 vbeta = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) beta));
+    beta += 8;
+
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx, vmean8), vscale), vbeta);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  for (; c != 0; c -= sizeof(uint16_t)) {
+    const float vy = (_cvtsh_ss(*i++) - vmean) * (_cvtsh_ss(*gamma++) * vrstd) + _cvtsh_ss(*beta++);
+    *o++ = _cvtss_sh(vy, _MM_FROUND_TO_NEAREST_INT);
+  }
+}
@@ -0,0 +1,138 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f16_rnorm_ukernel__neonfp16arith_x16(
+    size_t channels,
+    const void* input,
+    const void* weights,
+    void* output,
+    const union xnn_f16_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(uint16_t);
+  const uint16_t* i = (const uint16_t*) input;
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated in FP32, relative to the first element to avoid catastrophic cancellation.
+  const float32x4_t vshift4 = vsubtract_mean ?
+    vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(i))) : vmovq_n_f32(0.0f);
+  const float vshift = vgetq_lane_f32(vshift4, 0);
+
+  float32x4_t vsum0 = vmovq_n_f32(0.0f);
+  float32x4_t vsum1 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq0 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq1 = vmovq_n_f32(0.0f);
+  size_t c = channels;
+  for (; c >= 16 * sizeof(uint16_t); c -= 16 * sizeof(uint16_t)) {
+    const float16x8_t vx01 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+    const float16x8_t vx23 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+
+    const float32x4_t vd0 = vsubq_f32(vcvt_f32_f16(vget_low_f16(vx01)), vshift4);
+    const float32x4_t vd1 = vsubq_f32(vcvt_f32_f16(vget_high_f16(vx01)), vshift4);
+    const float32x4_t vd2 = vsubq_f32(vcvt_f32_f16(vget_low_f16(vx23)), vshift4);
+    const float32x4_t vd3 = vsubq_f32(vcvt_f32_f16(vget_high_f16(vx23)), vshift4);
+
+    vsum0 = vaddq_f32(vsum0, vd0);
+    vsum1 = vaddq_f32(vsum1, vd1);
+    vsumsq0 = vfmaq_f32(vsumsq0, vd0, vd0);
+    vsumsq1 = vfmaq_f32(vsumsq1, vd1, vd1);
+    vsum0 = vaddq_f32(vsum0, vd2);
+    vsum1 = vaddq_f32(vsum1, vd3);
+    vsumsq0 = vfmaq_f32(vsumsq0, vd2, vd2);
+    vsumsq1 = vfmaq_f32(vsumsq1, vd3, vd3);
+  }
+  for (; c >= 4 * sizeof(uint16_t); c -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vd = vsubq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))), vshift4); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vd);
+    vsumsq0 = vfmaq_f32(vsumsq0, vd, vd);
+  }
+  if XNN_UNLIKELY(c != 0) {
+    // Load the remaining 1-3 elements into zeroed lanes, and cancel out the contribution of the padding lanes, which
+    // equals (0 - shift) for the sum and shift * shift for the sum of squares.
+    uint16x4_t vx = vmov_n_u16(0);
+    size_t num_padding = 4;
+    for (; c != 0; c -= sizeof(uint16_t)) {
+      vx = vext_u16(vx, vld1_dup_u16(i++), 1);
+      num_padding -= 1;
+    }
+    const float32x4_t vd = vsubq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vx)), vshift4);
+    vsum1 = vaddq_f32(vsum1, vd);
+    vsumsq1 = vfmaq_f32(vsumsq1, vd, vd);
+    vsum1 = vsetq_lane_f32(vgetq_lane_f32(vsum1, 0) + (float) num_padding * vshift, vsum1, 0);
+    vsumsq1 = vsetq_lane_f32(vgetq_lane_f32(vsumsq1, 0) - (float) num_padding * vshift * vshift, vsumsq1, 0);
+  }
+  const float32x4_t vsum4 = vaddq_f32(vsum0, vsum1);
+  const float32x4_t vsumsq4 = vaddq_f32(vsumsq0, vsumsq1);
+  float32x2_t vsum2 = vadd_f32(vget_low_f32(vsum4), vget_high_f32(vsum4));
+  float32x2_t vsumsq2 = vadd_f32(vget_low_f32(vsumsq4), vget_high_f32(vsumsq4));
+  vsum2 = vpadd_f32(vsum2, vsum2);
+  vsumsq2 = vpadd_f32(vsumsq2, vsumsq2);
+  const float vsum = vget_lane_f32(vsum2, 0);
+  const float vsumsq = vget_lane_f32(vsumsq2, 0);
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum * vinv_n;
+  const float vmeansq = vsumsq * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const float32x4_t vmean4 = vdupq_n_f32(vmean);
+  const float32x4_t vrstd4 = vdupq_n_f32(vrstd);
+  const uint16_t* gamma = (const uint16_t*) weights;
+  const uint16_t* beta = gamma + n;
+  i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (c = channels; c >= 8 * sizeof(uint16_t); c -= 8 * sizeof(uint16_t)) {
+    const float16x8_t vx = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+    const float16x8_t vgamma = vreinterpretq_f16_u16(vld1q_u16(gamma)); gamma += 8;
+    const float16x8_t vbeta = vreinterpretq_f16_u16(vld1q_u16(beta)); beta += 8;
+
+    const float32x4_t vscale_lo = vmulq_f32(vcvt_f32_f16(vget_low_f16(vgamma)), vrstd4);
+    const float32x4_t vscale_hi = vmulq_f32(vcvt_f32_f16(vget_high_f16(vgamma)), vrstd4);
+    const float32x4_t vy_lo = vfmaq_f32(
+      vcvt_f32_f16(vget_low_f16(vbeta)), vsubq_f32(vcvt_f32_f16(vget_low_f16(vx)), vmean4), vscale_lo);
+    const float32x4_t vy_hi = vfmaq_f32(
+      vcvt_f32_f16(vget_high_f16(vbeta)), vsubq_f32(vcvt_f32_f16(vget_high_f16(vx)), vmean4), vscale_hi);
+
+    vst1q_u16(o, vreinterpretq_u16_f16(vcombine_f16(vcvt_f16_f32(vy_lo), vcvt_f16_f32(vy_hi)))); o += 8;
+  }
+  for (; c >= 4 * sizeof(uint16_t); c -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))); i += 4;
+    const float32x4_t vscale = vmulq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(gamma))), vrstd4); gamma += 4;
+    const float32x4_t vbeta = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(beta))); beta += 4;
+
+    const float32x4_t vy = vfmaq_f32(vbeta, vsubq_f32(vx, vmean4), vscale);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy))); o += 4;
+  }
+  for (; c != 0; c -= sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(i++)));
+    const float32x4_t vgamma = vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(gamma++)));
+    const float32x4_t vbeta = vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(beta++)));
+
+    const float32x4_t vy = vfmaq_f32(vbeta, vsubq_f32(vx, vmean4), vmulq_f32(vgamma, vrstd4));
+
+    vst1_lane_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)), 0); o += 1;
+  }
+}
@@ -0,0 +1,130 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vapproxgelu/avx2-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vapproxgelu_ukernel__avx2_rational_13_6_div_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vc3 = _mm256_set1_ps(0x1.2444F2p-5f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.988454p-1f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+  const __m256 vneg_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.3E4B80p-52f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.C266FCp-43f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.7A6FFEp-34f);
+  const __m256 valpha_7 = _mm256_set1_ps(0x1.B80082p-25f);
+  const __m256 valpha_5 = _mm256_set1_ps(0x1.F28694p-17f);
+  const __m256 valpha_3 = _mm256_set1_ps(0x1.4E1BDAp-11f);
+  const __m256 valpha_1 = _mm256_set1_ps(0x1.40B3B8p-8f);
+  const __m256 vbeta_6 = _mm256_set1_ps(0x1.41A7B0p-20f);
+  const __m256 vbeta_4 = _mm256_set1_ps(0x1.F12BACp-14f);
+  const __m256 vbeta_2 = _mm256_set1_ps(0x1.29540Ap-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vu = _mm256_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm256_mul_ps(vx, vu);
+
+    vu = _mm256_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm256_min_ps(vu, vsat_cutoff);
+
+    const __m256 vu2 = _mm256_mul_ps(vu, vu);
+
+    __m256 vp = _mm256_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm256_mul_ps(vu, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m256 vt = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, vt, vhalfx);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vu = _mm256_fmadd_ps(vx2, vc3, vc1);
+    vu = _mm256_mul_ps(vx, vu);
+
+    vu = _mm256_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm256_min_ps(vu, vsat_cutoff);
+
+    const __m256 vu2 = _mm256_mul_ps(vu, vu);
+
+    __m256 vp = _mm256_fmadd_ps(vu2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vu2, vp, valpha_1);
+    vp = _mm256_mul_ps(vu, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vu2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vu2, vq, vbeta_0);
+
+    const __m256 vt = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, vt, vhalfx);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,243 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vapproxgelu/neonfp16arith-rational-13-6-nr1recps.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vapproxgelu_ukernel__neonfp16arith_rational_13_6_nr1recps_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vc3 = vmovq_n_f32(0x1.2444F2p-5f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.988454p-1f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    const float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    const float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+    const float32x4_t vx22 = vmulq_f32(vx2, vx2);
+    const float32x4_t vx23 = vmulq_f32(vx3, vx3);
+
+    float32x4_t vu0 = vfmaq_f32(vc1, vx20, vc3);
+    float32x4_t vu1 = vfmaq_f32(vc1, vx21, vc3);
+    float32x4_t vu2 = vfmaq_f32(vc1, vx22, vc3);
+    float32x4_t vu3 = vfmaq_f32(vc1, vx23, vc3);
+
+    vu0 = vmulq_f32(vx0, vu0);
+    vu1 = vmulq_f32(vx1, vu1);
+    vu2 = vmulq_f32(vx2, vu2);
+    vu3 = vmulq_f32(vx3, vu3);
+
+    vu0 = vmaxq_f32(vu0, vneg_sat_cutoff);
+    vu1 = vmaxq_f32(vu1, vneg_sat_cutoff);
+    vu2 = vmaxq_f32(vu2, vneg_sat_cutoff);
+    vu3 = vmaxq_f32(vu3, vneg_sat_cutoff);
+
+    vu0 = vminq_f32(vu0, vsat_cutoff);
+    vu1 = vminq_f32(vu1, vsat_cutoff);
+    vu2 = vminq_f32(vu2, vsat_cutoff);
+    vu3 = vminq_f32(vu3, vsat_cutoff);
+
+    const float32x4_t vu20 = vmulq_f32(vu0, vu0);
+    const float32x4_t vu21 = vmulq_f32(vu1, vu1);
+    const float32x4_t vu22 = vmulq_f32(vu2, vu2);
+    const float32x4_t vu23 = vmulq_f32(vu3, vu3);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vu20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vu21, valpha_13);
+    float32x4_t vp2 = vfmaq_f32(valpha_11, vu22, valpha_13);
+    float32x4_t vp3 = vfmaq_f32(valpha_11, vu23, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_9, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_9, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_7, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_7, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_7, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_5, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_5, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_5, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_3, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_3, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_3, vu23, vp3);
+
+    vp0 = vfmaq_f32(valpha_1, vu20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vu21, vp1);
+    vp2 = vfmaq_f32(valpha_1, vu22, vp2);
+    vp3 = vfmaq_f32(valpha_1, vu23, vp3);
+
+    vp0 = vmulq_f32(vu0, vp0);
+    vp1 = vmulq_f32(vu1, vp1);
+    vp2 = vmulq_f32(vu2, vp2);
+    vp3 = vmulq_f32(vu3, vp3);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_4, vu20, vbeta_6);
+    float32x4_t vq1 = vfmaq_f32(vbeta_4, vu21, vbeta_6);
+    float32x4_t vq2 = vfmaq_f32(vbeta_4, vu22, vbeta_6);
+    float32x4_t vq3 = vfmaq_f32(vbeta_4, vu23, vbeta_6);
+
+    vq0 = vfmaq_f32(vbeta_2, vu20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vu21, vq1);
+    vq2 = vfmaq_f32(vbeta_2, vu22, vq2);
+    vq3 = vfmaq_f32(vbeta_2, vu23, vq3);
+
+    vq0 = vfmaq_f32(vbeta_0, vu20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vu21, vq1);
+    vq2 = vfmaq_f32(vbeta_0, vu22, vq2);
+    vq3 = vfmaq_f32(vbeta_0, vu23, vq3);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+    float32x4_t vrq2 = vrecpeq_f32(vq2);
+    float32x4_t vrq3 = vrecpeq_f32(vq3);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+    vrq2 = vmulq_f32(vrq2, vrecpsq_f32(vrq2, vq2));
+    vrq3 = vmulq_f32(vrq3, vrecpsq_f32(vrq3, vq3));
+
+    const float32x4_t vt0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vt1 = vmulq_f32(vp1, vrq1);
+    const float32x4_t vt2 = vmulq_f32(vp2, vrq2);
+    const float32x4_t vt3 = vmulq_f32(vp3, vrq3);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+    const float32x4_t vhalfx2 = vmulq_f32(vx2, vhalf);
+    const float32x4_t vhalfx3 = vmulq_f32(vx3, vhalf);
+
+    const float32x4_t vy0 = vfmaq_f32(vhalfx0, vhalfx0, vt0);
+    const float32x4_t vy1 = vfmaq_f32(vhalfx1, vhalfx1, vt1);
+    const float32x4_t vy2 = vfmaq_f32(vhalfx2, vhalfx2, vt2);
+    const float32x4_t vy3 = vfmaq_f32(vhalfx3, vhalfx3, vt3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vfmaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vu2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vu2, vp);
+    vp = vfmaq_f32(valpha_7, vu2, vp);
+    vp = vfmaq_f32(valpha_5, vu2, vp);
+    vp = vfmaq_f32(valpha_3, vu2, vp);
+    vp = vfmaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vu2, vq);
+    vq = vfmaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, vt);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vfmaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vu2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vu2, vp);
+    vp = vfmaq_f32(valpha_7, vu2, vp);
+    vp = vfmaq_f32(valpha_5, vu2, vp);
+    vp = vfmaq_f32(valpha_3, vu2, vp);
+    vp = vfmaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vu2, vq);
+    vq = vfmaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, vt);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
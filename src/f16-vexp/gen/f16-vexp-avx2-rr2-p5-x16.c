@@ -0,0 +1,191 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vexp/avx2-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vexp_ukernel__avx2_rr2_p5_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vmagic_bias = _mm256_set1_ps(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m256 vzero_cutoff = _mm256_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m256 vinf_cutoff = _mm256_set1_ps(0x1.62E42Ep+6f);
+  const __m256 vlog2e = _mm256_set1_ps(0x1.715476p+0f);
+  const __m256 vminus_ln2_hi = _mm256_set1_ps(-0x1.62E43p-1f);
+  const __m256 vminus_ln2_lo = _mm256_set1_ps(0x1.05C61p-29f);
+  const __m256 vplus_inf = _mm256_set1_ps(INFINITY);
+  const __m256 vc5 = _mm256_set1_ps(0x1.0F9F9Cp-7f);
+  const __m256 vc4 = _mm256_set1_ps(0x1.573A1Ap-5f);
+  const __m256 vc3 = _mm256_set1_ps(0x1.555A80p-3f);
+  const __m256 vc2 = _mm256_set1_ps(0x1.FFFDC6p-2f);
+  const __m256 vc1 = _mm256_set1_ps(0x1.FFFFF6p-1f);
+  const __m256i vmin_exponent = _mm256_set1_epi32(0xC1000000);
+  const __m256i vmax_exponent = _mm256_set1_epi32(0x3F800000);
+  const __m256i vdefault_exponent = vmax_exponent;
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    __m256 vn0 = _mm256_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vx1, vlog2e, vmagic_bias);
+
+    __m256i veo0 = _mm256_slli_epi32(_mm256_castps_si256(vn0), 23);
+    __m256i veo1 = _mm256_slli_epi32(_mm256_castps_si256(vn1), 23);
+
+    __m256i ven0 = _mm256_max_epi32(veo0, vmin_exponent);
+    __m256i ven1 = _mm256_max_epi32(veo1, vmin_exponent);
+
+    ven0 = _mm256_min_epi32(ven0, vmax_exponent);
+    ven1 = _mm256_min_epi32(ven1, vmax_exponent);
+
+    veo0 = _mm256_sub_epi32(veo0, ven0);
+    veo1 = _mm256_sub_epi32(veo1, ven1);
+
+    const __m256 vsn0 = _mm256_castsi256_ps(_mm256_add_epi32(ven0, vdefault_exponent));
+    const __m256 vsn1 = _mm256_castsi256_ps(_mm256_add_epi32(ven1, vdefault_exponent));
+
+    const __m256 vso0 = _mm256_castsi256_ps(_mm256_add_epi32(veo0, vdefault_exponent));
+    const __m256 vso1 = _mm256_castsi256_ps(_mm256_add_epi32(veo1, vdefault_exponent));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vso0);
+    vt1 = _mm256_mul_ps(vt1, vso1);
+
+    __m256 vy0 = _mm256_mul_ps(vsn0, _mm256_fmadd_ps(vt0, vp0, vso0));
+    __m256 vy1 = _mm256_mul_ps(vsn1, _mm256_fmadd_ps(vt1, vp1, vso1));
+
+    vy0 = _mm256_andnot_ps(_mm256_cmp_ps(vx0, vzero_cutoff, _CMP_LT_OS), vy0);
+    vy1 = _mm256_andnot_ps(_mm256_cmp_ps(vx1, vzero_cutoff, _CMP_LT_OS), vy1);
+
+    vy0 = _mm256_blendv_ps(vy0, vplus_inf, _mm256_cmp_ps(vx0, vinf_cutoff, _CMP_GT_OS));
+    vy1 = _mm256_blendv_ps(vy1, vplus_inf, _mm256_cmp_ps(vx1, vinf_cutoff, _CMP_GT_OS));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vdefault_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vdefault_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS));
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,182 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vexp/neonfp16arith-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vexp_ukernel__neonfp16arith_rr2_p5_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const float32x4_t vzero_cutoff = vmovq_n_f32(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const float32x4_t vinf_cutoff = vmovq_n_f32(0x1.62E42Ep+6f);
+  const float32x4_t vlog2e = vmovq_n_f32(0x1.715476p+0f);
+  const float32x4_t vminus_ln2_hi = vmovq_n_f32(-0x1.62E400p-1f);
+  const float32x4_t vminus_ln2_lo = vmovq_n_f32(-0x1.7F7D1Cp-20f);
+  const float32x4_t vplus_inf = vmovq_n_f32(INFINITY);
+  const float32x4_t vc5 = vmovq_n_f32(0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.FFFFF6p-1f);
+  const int32x4_t vmin_exponent = vmovq_n_s32(-INT32_C(0x3F000000));
+  const int32x4_t vmax_exponent = vmovq_n_s32(INT32_C(0x3F800000));
+  const int32x4_t vdefault_exponent = vmax_exponent;
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    i += 8;
+
+    float32x4_t vn0 = vfmaq_f32(vmagic_bias, vx0, vlog2e);
+    float32x4_t vn1 = vfmaq_f32(vmagic_bias, vx1, vlog2e);
+
+    int32x4_t veo0 = vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23);
+    int32x4_t veo1 = vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23);
+
+    int32x4_t ven0 = vmaxq_s32(veo0, vmin_exponent);
+    int32x4_t ven1 = vmaxq_s32(veo1, vmin_exponent);
+
+    ven0 = vminq_s32(ven0, vmax_exponent);
+    ven1 = vminq_s32(ven1, vmax_exponent);
+
+    veo0 = vsubq_s32(veo0, ven0);
+    veo1 = vsubq_s32(veo1, ven1);
+
+    const float32x4_t vsn0 = vreinterpretq_f32_s32(vaddq_s32(ven0, vdefault_exponent));
+    const float32x4_t vsn1 = vreinterpretq_f32_s32(vaddq_s32(ven1, vdefault_exponent));
+
+    const float32x4_t vso0 = vreinterpretq_f32_s32(vaddq_s32(veo0, vdefault_exponent));
+    const float32x4_t vso1 = vreinterpretq_f32_s32(vaddq_s32(veo1, vdefault_exponent));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+
+    float32x4_t vt0 = vfmaq_f32(vx0, vn0, vminus_ln2_hi);
+    float32x4_t vt1 = vfmaq_f32(vx1, vn1, vminus_ln2_hi);
+
+    vt0 = vfmaq_f32(vt0, vn0, vminus_ln2_lo);
+    vt1 = vfmaq_f32(vt1, vn1, vminus_ln2_lo);
+
+    float32x4_t vp0 = vfmaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vfmaq_f32(vc4, vc5, vt1);
+
+    vp0 = vfmaq_f32(vc3, vp0, vt0);
+    vp1 = vfmaq_f32(vc3, vp1, vt1);
+
+    vp0 = vfmaq_f32(vc2, vp0, vt0);
+    vp1 = vfmaq_f32(vc2, vp1, vt1);
+
+    vp0 = vfmaq_f32(vc1, vp0, vt0);
+    vp1 = vfmaq_f32(vc1, vp1, vt1);
+
+    vt0 = vmulq_f32(vt0, vso0);
+    vt1 = vmulq_f32(vt1, vso1);
+
+    float32x4_t vy0 = vmulq_f32(vsn0, vfmaq_f32(vso0, vt0, vp0));
+    float32x4_t vy1 = vmulq_f32(vsn1, vfmaq_f32(vso1, vt1, vp1));
+
+    vy0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy0), vcltq_f32(vx0, vzero_cutoff)));
+    vy1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy1), vcltq_f32(vx1, vzero_cutoff)));
+
+    vy0 = vbslq_f32(vcgtq_f32(vx0, vinf_cutoff), vplus_inf, vy0);
+    vy1 = vbslq_f32(vcgtq_f32(vx1, vinf_cutoff), vplus_inf, vy1);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    o += 8;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vfmaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vfmaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vx, vlog2e);
+
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    int32x4_t ven = vmaxq_s32(veo, vmin_exponent);
+    ven = vminq_s32(ven, vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vdefault_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vdefault_exponent));
+
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vfmaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vfmaq_f32(vso, vt, vp));
+
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
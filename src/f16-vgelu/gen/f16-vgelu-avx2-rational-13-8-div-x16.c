@@ -0,0 +1,187 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vgelu/avx2-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vgelu_ukernel__avx2_rational_13_8_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vsqrt1_2 = _mm256_set1_ps(0x1.6A09E6p-1f);
+  const __m256 vneg_erf_cutoff = _mm256_set1_ps(-0x1.000000p+2f);
+  const __m256 verf_cutoff = _mm256_set1_ps(0x1.000000p+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.2BBE16p-32f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.DBFFDCp-26f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.19FEA2p-19f);
+  const __m256 valpha_7 = _mm256_set1_ps(-0x1.DD85A4p-15f);
+  const __m256 valpha_5 = _mm256_set1_ps(-0x1.8158C6p-11f);
+  const __m256 valpha_3 = _mm256_set1_ps(-0x1.8343ECp-9f);
+  const __m256 valpha_1 = _mm256_set1_ps(-0x1.07B7A8p-6f);
+  const __m256 vbeta_8 = _mm256_set1_ps(-0x1.E8C19Ap-17f);
+  const __m256 vbeta_6 = _mm256_set1_ps(-0x1.BF7A52p-13f);
+  const __m256 vbeta_4 = _mm256_set1_ps(-0x1.B9249Cp-10f);
+  const __m256 vbeta_2 = _mm256_set1_ps(-0x1.E337F0p-8f);
+  const __m256 vbeta_0 = _mm256_set1_ps(-0x1.D36D4Ep-7f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    __m256 vz0 = _mm256_mul_ps(vx0, vsqrt1_2);
+    __m256 vz1 = _mm256_mul_ps(vx1, vsqrt1_2);
+
+    vz0 = _mm256_max_ps(vz0, vneg_erf_cutoff);
+    vz1 = _mm256_max_ps(vz1, vneg_erf_cutoff);
+
+    vz0 = _mm256_min_ps(vz0, verf_cutoff);
+    vz1 = _mm256_min_ps(vz1, verf_cutoff);
+
+    const __m256 vz20 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vz21 = _mm256_mul_ps(vz1, vz1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vz20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vz21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vz20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vz21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vz0, vp0);
+    vp1 = _mm256_mul_ps(vz1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vz20, vbeta_8, vbeta_6);
+    __m256 vq1 = _mm256_fmadd_ps(vz21, vbeta_8, vbeta_6);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_4);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vz20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vz21, vq1, vbeta_0);
+
+    const __m256 verf0 = _mm256_div_ps(vp0, vq0);
+    const __m256 verf1 = _mm256_div_ps(vp1, vq1);
+
+    const __m256 vhalfx0 = _mm256_mul_ps(vx0, vhalf);
+    const __m256 vhalfx1 = _mm256_mul_ps(vx1, vhalf);
+
+    const __m256 vy0 = _mm256_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m256 vy1 = _mm256_fmadd_ps(vhalfx1, verf1, vhalfx1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vz = _mm256_mul_ps(vx, vsqrt1_2);
+    vz = _mm256_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm256_min_ps(vz, verf_cutoff);
+
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm256_mul_ps(vz, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_0);
+
+    const __m256 verf = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vz = _mm256_mul_ps(vx, vsqrt1_2);
+    vz = _mm256_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm256_min_ps(vz, verf_cutoff);
+
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vz2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vz2, vp, valpha_1);
+    vp = _mm256_mul_ps(vz, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vz2, vbeta_8, vbeta_6);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_4);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vz2, vq, vbeta_0);
+
+    const __m256 verf = _mm256_div_ps(vp, vq);
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
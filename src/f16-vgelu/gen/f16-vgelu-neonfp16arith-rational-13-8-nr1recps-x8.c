@@ -0,0 +1,188 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vgelu/neonfp16arith-rational-13-8-nr1recps.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vgelu_ukernel__neonfp16arith_rational_13_8_nr1recps_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vsqrt1_2 = vmovq_n_f32(0x1.6A09E6p-1f);
+  const float32x4_t vneg_erf_cutoff = vmovq_n_f32(-0x1.000000p+2f);
+  const float32x4_t verf_cutoff = vmovq_n_f32(0x1.000000p+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.2BBE16p-32f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.DBFFDCp-26f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.19FEA2p-19f);
+  const float32x4_t valpha_7 = vmovq_n_f32(-0x1.DD85A4p-15f);
+  const float32x4_t valpha_5 = vmovq_n_f32(-0x1.8158C6p-11f);
+  const float32x4_t valpha_3 = vmovq_n_f32(-0x1.8343ECp-9f);
+  const float32x4_t valpha_1 = vmovq_n_f32(-0x1.07B7A8p-6f);
+  const float32x4_t vbeta_8 = vmovq_n_f32(-0x1.E8C19Ap-17f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(-0x1.BF7A52p-13f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(-0x1.B9249Cp-10f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(-0x1.E337F0p-8f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(-0x1.D36D4Ep-7f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    i += 8;
+
+    float32x4_t vz0 = vmulq_f32(vx0, vsqrt1_2);
+    float32x4_t vz1 = vmulq_f32(vx1, vsqrt1_2);
+
+    vz0 = vmaxq_f32(vz0, vneg_erf_cutoff);
+    vz1 = vmaxq_f32(vz1, vneg_erf_cutoff);
+
+    vz0 = vminq_f32(vz0, verf_cutoff);
+    vz1 = vminq_f32(vz1, verf_cutoff);
+
+    const float32x4_t vz20 = vmulq_f32(vz0, vz0);
+    const float32x4_t vz21 = vmulq_f32(vz1, vz1);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vz20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vz21, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_7, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_5, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_3, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vz21, vp1);
+
+    vp0 = vfmaq_f32(valpha_1, vz20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vz21, vp1);
+
+    vp0 = vmulq_f32(vz0, vp0);
+    vp1 = vmulq_f32(vz1, vp1);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_6, vz20, vbeta_8);
+    float32x4_t vq1 = vfmaq_f32(vbeta_6, vz21, vbeta_8);
+
+    vq0 = vfmaq_f32(vbeta_4, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_4, vz21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_2, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vz21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_0, vz20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vz21, vq1);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    const float32x4_t verf0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t verf1 = vmulq_f32(vp1, vrq1);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+
+    const float32x4_t vy0 = vfmaq_f32(vhalfx0, vhalfx0, verf0);
+    const float32x4_t vy1 = vfmaq_f32(vhalfx1, vhalfx1, verf1);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    o += 8;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vz2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vz2, vp);
+    vp = vfmaq_f32(valpha_7, vz2, vp);
+    vp = vfmaq_f32(valpha_5, vz2, vp);
+    vp = vfmaq_f32(valpha_3, vz2, vp);
+    vp = vfmaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vfmaq_f32(vbeta_4, vz2, vq);
+    vq = vfmaq_f32(vbeta_2, vz2, vq);
+    vq = vfmaq_f32(vbeta_0, vz2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t verf = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    float32x4_t vz = vmulq_f32(vx, vsqrt1_2);
+    vz = vmaxq_f32(vz, vneg_erf_cutoff);
+    vz = vminq_f32(vz, verf_cutoff);
+
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vz2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vz2, vp);
+    vp = vfmaq_f32(valpha_7, vz2, vp);
+    vp = vfmaq_f32(valpha_5, vz2, vp);
+    vp = vfmaq_f32(valpha_3, vz2, vp);
+    vp = vfmaq_f32(valpha_1, vz2, vp);
+    vp = vmulq_f32(vz, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_6, vz2, vbeta_8);
+    vq = vfmaq_f32(vbeta_4, vz2, vq);
+    vq = vfmaq_f32(vbeta_2, vz2, vq);
+    vq = vfmaq_f32(vbeta_0, vz2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t verf = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
@@ -0,0 +1,229 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vsilu/neonfp16arith-rr2-p5-nr1recps.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vsilu_ukernel__neonfp16arith_rr2_p5_nr1recps_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmagic_bias = vmovq_n_f32(0x1.8000FEp23f);
+  const float32x4_t vminus_log2e = vmovq_n_f32(-0x1.715476p0f);
+  const float32x4_t vln2_hi = vmovq_n_f32(0x1.62E400p-1f);
+  const float32x4_t vln2_lo = vmovq_n_f32(0x1.7F7D1Cp-20f);
+  const float32x4_t vc5 = vmovq_n_f32(-0x1.0F9F9Cp-7f);
+  const float32x4_t vc4 = vmovq_n_f32(0x1.573A1Ap-5f);
+  const float32x4_t vc3 = vmovq_n_f32(-0x1.555A80p-3f);
+  const float32x4_t vc2 = vmovq_n_f32(0x1.FFFDC6p-2f);
+  const float32x4_t vc1 = vmovq_n_f32(-0x1.FFFFF6p-1f);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vdenorm_cutoff = vmovq_n_f32(0x1.5D589Ep+6f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    const float32x4_t vx2 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 8)));
+    const float32x4_t vx3 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 12)));
+    i += 16;
+
+    const float32x4_t vz0 = vabsq_f32(vx0);
+    const float32x4_t vz1 = vabsq_f32(vx1);
+    const float32x4_t vz2 = vabsq_f32(vx2);
+    const float32x4_t vz3 = vabsq_f32(vx3);
+
+    float32x4_t vn0 = vfmaq_f32(vmagic_bias, vz0, vminus_log2e);
+    float32x4_t vn1 = vfmaq_f32(vmagic_bias, vz1, vminus_log2e);
+    float32x4_t vn2 = vfmaq_f32(vmagic_bias, vz2, vminus_log2e);
+    float32x4_t vn3 = vfmaq_f32(vmagic_bias, vz3, vminus_log2e);
+
+    const float32x4_t vs0 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn0), 23));
+    const float32x4_t vs1 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn1), 23));
+    const float32x4_t vs2 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn2), 23));
+    const float32x4_t vs3 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn3), 23));
+
+    vn0 = vsubq_f32(vn0, vmagic_bias);
+    vn1 = vsubq_f32(vn1, vmagic_bias);
+    vn2 = vsubq_f32(vn2, vmagic_bias);
+    vn3 = vsubq_f32(vn3, vmagic_bias);
+
+    float32x4_t vt0 = vfmaq_f32(vz0, vn0, vln2_hi);
+    float32x4_t vt1 = vfmaq_f32(vz1, vn1, vln2_hi);
+    float32x4_t vt2 = vfmaq_f32(vz2, vn2, vln2_hi);
+    float32x4_t vt3 = vfmaq_f32(vz3, vn3, vln2_hi);
+
+    vt0 = vfmaq_f32(vt0, vn0, vln2_lo);
+    vt1 = vfmaq_f32(vt1, vn1, vln2_lo);
+    vt2 = vfmaq_f32(vt2, vn2, vln2_lo);
+    vt3 = vfmaq_f32(vt3, vn3, vln2_lo);
+
+    float32x4_t vp0 = vfmaq_f32(vc4, vc5, vt0);
+    float32x4_t vp1 = vfmaq_f32(vc4, vc5, vt1);
+    float32x4_t vp2 = vfmaq_f32(vc4, vc5, vt2);
+    float32x4_t vp3 = vfmaq_f32(vc4, vc5, vt3);
+
+    vp0 = vfmaq_f32(vc3, vp0, vt0);
+    vp1 = vfmaq_f32(vc3, vp1, vt1);
+    vp2 = vfmaq_f32(vc3, vp2, vt2);
+    vp3 = vfmaq_f32(vc3, vp3, vt3);
+
+    vp0 = vfmaq_f32(vc2, vp0, vt0);
+    vp1 = vfmaq_f32(vc2, vp1, vt1);
+    vp2 = vfmaq_f32(vc2, vp2, vt2);
+    vp3 = vfmaq_f32(vc2, vp3, vt3);
+
+    vp0 = vfmaq_f32(vc1, vp0, vt0);
+    vp1 = vfmaq_f32(vc1, vp1, vt1);
+    vp2 = vfmaq_f32(vc1, vp2, vt2);
+    vp3 = vfmaq_f32(vc1, vp3, vt3);
+
+    vt0 = vmulq_f32(vt0, vs0);
+    vt1 = vmulq_f32(vt1, vs1);
+    vt2 = vmulq_f32(vt2, vs2);
+    vt3 = vmulq_f32(vt3, vs3);
+
+    const float32x4_t ve0 = vfmaq_f32(vs0, vp0, vt0);
+    const float32x4_t ve1 = vfmaq_f32(vs1, vp1, vt1);
+    const float32x4_t ve2 = vfmaq_f32(vs2, vp2, vt2);
+    const float32x4_t ve3 = vfmaq_f32(vs3, vp3, vt3);
+
+    const float32x4_t ve10 = vaddq_f32(ve0, vone);
+    const float32x4_t ve11 = vaddq_f32(ve1, vone);
+    const float32x4_t ve12 = vaddq_f32(ve2, vone);
+    const float32x4_t ve13 = vaddq_f32(ve3, vone);
+
+    float32x4_t vre10 = vrecpeq_f32(ve10);
+    float32x4_t vre11 = vrecpeq_f32(ve11);
+    float32x4_t vre12 = vrecpeq_f32(ve12);
+    float32x4_t vre13 = vrecpeq_f32(ve13);
+
+    vre10 = vmulq_f32(vre10, vrecpsq_f32(vre10, ve10));
+    vre11 = vmulq_f32(vre11, vrecpsq_f32(vre11, ve11));
+    vre12 = vmulq_f32(vre12, vrecpsq_f32(vre12, ve12));
+    vre13 = vmulq_f32(vre13, vrecpsq_f32(vre13, ve13));
+
+    float32x4_t vf0 = vmulq_f32(ve0, vre10);
+    float32x4_t vf1 = vmulq_f32(ve1, vre11);
+    float32x4_t vf2 = vmulq_f32(ve2, vre12);
+    float32x4_t vf3 = vmulq_f32(ve3, vre13);
+
+    vf0 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf0), vcagtq_f32(vx0, vdenorm_cutoff)));
+    vf1 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf1), vcagtq_f32(vx1, vdenorm_cutoff)));
+    vf2 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf2), vcagtq_f32(vx2, vdenorm_cutoff)));
+    vf3 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf3), vcagtq_f32(vx3, vdenorm_cutoff)));
+
+    const uint32x4_t vm0 = vcltq_f32(vx0, vmovq_n_f32(0.0f));
+    const uint32x4_t vm1 = vcltq_f32(vx1, vmovq_n_f32(0.0f));
+    const uint32x4_t vm2 = vcltq_f32(vx2, vmovq_n_f32(0.0f));
+    const uint32x4_t vm3 = vcltq_f32(vx3, vmovq_n_f32(0.0f));
+
+    vf0 = vbslq_f32(vm0, vf0, vsubq_f32(vone, vf0));
+    vf1 = vbslq_f32(vm1, vf1, vsubq_f32(vone, vf1));
+    vf2 = vbslq_f32(vm2, vf2, vsubq_f32(vone, vf2));
+    vf3 = vbslq_f32(vm3, vf3, vsubq_f32(vone, vf3));
+
+    const float32x4_t vy0 = vmulq_f32(vx0, vf0);
+    const float32x4_t vy1 = vmulq_f32(vx1, vf1);
+    const float32x4_t vy2 = vmulq_f32(vx2, vf2);
+    const float32x4_t vy3 = vmulq_f32(vx3, vf3);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    vst1_u16(o + 8, vreinterpret_u16_f16(vcvt_f16_f32(vy2)));
+    vst1_u16(o + 12, vreinterpret_u16_f16(vcvt_f16_f32(vy3)));
+    o += 16;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vz, vn, vln2_hi);
+    vt = vfmaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vfmaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vre1 = vrecpeq_f32(ve1);
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    float32x4_t vf = vmulq_f32(ve, vre1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    const float32x4_t vz = vabsq_f32(vx);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vfmaq_f32(vz, vn, vln2_hi);
+    vt = vfmaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vfmaq_f32(vc4, vc5, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vfmaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vfmaq_f32(vs, vp, vt);
+    const float32x4_t ve1 = vaddq_f32(ve, vone);
+
+    float32x4_t vre1 = vrecpeq_f32(ve1);
+    vre1 = vmulq_f32(vre1, vrecpsq_f32(vre1, ve1));
+    float32x4_t vf = vmulq_f32(ve, vre1);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(vx, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(vx, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
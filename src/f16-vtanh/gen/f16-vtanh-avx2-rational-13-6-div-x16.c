@@ -0,0 +1,162 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vtanh/avx2-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vtanh_ukernel__avx2_rational_13_6_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vneg_sat_cutoff = _mm256_set1_ps(-0x1.F9F09Ep+2f);
+  const __m256 vsat_cutoff = _mm256_set1_ps(0x1.F9F09Ep+2f);
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.3E4B80p-52f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.C266FCp-43f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.7A6FFEp-34f);
+  const __m256 valpha_7 = _mm256_set1_ps(0x1.B80082p-25f);
+  const __m256 valpha_5 = _mm256_set1_ps(0x1.F28694p-17f);
+  const __m256 valpha_3 = _mm256_set1_ps(0x1.4E1BDAp-11f);
+  const __m256 valpha_1 = _mm256_set1_ps(0x1.40B3B8p-8f);
+  const __m256 vbeta_6 = _mm256_set1_ps(0x1.41A7B0p-20f);
+  const __m256 vbeta_4 = _mm256_set1_ps(0x1.F12BACp-14f);
+  const __m256 vbeta_2 = _mm256_set1_ps(0x1.29540Ap-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    vx0 = _mm256_max_ps(vx0, vneg_sat_cutoff);
+    vx1 = _mm256_max_ps(vx1, vneg_sat_cutoff);
+
+    vx0 = _mm256_min_ps(vx0, vsat_cutoff);
+    vx1 = _mm256_min_ps(vx1, vsat_cutoff);
+
+    const __m256 vx20 = _mm256_mul_ps(vx0, vx0);
+    const __m256 vx21 = _mm256_mul_ps(vx1, vx1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vx20, valpha_13, valpha_11);
+    __m256 vp1 = _mm256_fmadd_ps(vx21, valpha_13, valpha_11);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_9);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_9);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_7);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_7);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_5);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_5);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_3);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_3);
+
+    vp0 = _mm256_fmadd_ps(vx20, vp0, valpha_1);
+    vp1 = _mm256_fmadd_ps(vx21, vp1, valpha_1);
+
+    vp0 = _mm256_mul_ps(vx0, vp0);
+    vp1 = _mm256_mul_ps(vx1, vp1);
+
+    __m256 vq0 = _mm256_fmadd_ps(vx20, vbeta_6, vbeta_4);
+    __m256 vq1 = _mm256_fmadd_ps(vx21, vbeta_6, vbeta_4);
+
+    vq0 = _mm256_fmadd_ps(vx20, vq0, vbeta_2);
+    vq1 = _mm256_fmadd_ps(vx21, vq1, vbeta_2);
+
+    vq0 = _mm256_fmadd_ps(vx20, vq0, vbeta_0);
+    vq1 = _mm256_fmadd_ps(vx21, vq1, vbeta_0);
+
+    const __m256 vy0 = _mm256_div_ps(vp0, vq0);
+    const __m256 vy1 = _mm256_div_ps(vp1, vq1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    vx = _mm256_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm256_min_ps(vx, vsat_cutoff);
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vp = _mm256_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm256_mul_ps(vx, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m256 vy = _mm256_div_ps(vp, vq);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    vx = _mm256_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm256_min_ps(vx, vsat_cutoff);
+
+    const __m256 vx2 = _mm256_mul_ps(vx, vx);
+
+    __m256 vp = _mm256_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm256_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm256_mul_ps(vx, vp);
+
+    __m256 vq = _mm256_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm256_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m256 vy = _mm256_div_ps(vp, vq);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,163 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vtanh/neonfp16arith-rational-13-6-nr1recps.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vtanh_ukernel__neonfp16arith_rational_13_6_nr1recps_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    float32x4_t vx0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    float32x4_t vx1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i + 4)));
+    i += 8;
+
+    vx0 = vmaxq_f32(vx0, vneg_sat_cutoff);
+    vx1 = vmaxq_f32(vx1, vneg_sat_cutoff);
+
+    vx0 = vminq_f32(vx0, vsat_cutoff);
+    vx1 = vminq_f32(vx1, vsat_cutoff);
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vp0 = vfmaq_f32(valpha_11, vx20, valpha_13);
+    float32x4_t vp1 = vfmaq_f32(valpha_11, vx21, valpha_13);
+
+    vp0 = vfmaq_f32(valpha_9, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_9, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_7, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_7, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_5, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_5, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_3, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_3, vx21, vp1);
+
+    vp0 = vfmaq_f32(valpha_1, vx20, vp0);
+    vp1 = vfmaq_f32(valpha_1, vx21, vp1);
+
+    vp0 = vmulq_f32(vx0, vp0);
+    vp1 = vmulq_f32(vx1, vp1);
+
+    float32x4_t vq0 = vfmaq_f32(vbeta_4, vx20, vbeta_6);
+    float32x4_t vq1 = vfmaq_f32(vbeta_4, vx21, vbeta_6);
+
+    vq0 = vfmaq_f32(vbeta_2, vx20, vq0);
+    vq1 = vfmaq_f32(vbeta_2, vx21, vq1);
+
+    vq0 = vfmaq_f32(vbeta_0, vx20, vq0);
+    vq1 = vfmaq_f32(vbeta_0, vx21, vq1);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    const float32x4_t vy0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vy1 = vmulq_f32(vp1, vrq1);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy0)));
+    vst1_u16(o + 4, vreinterpret_u16_f16(vcvt_f16_f32(vy1)));
+    o += 8;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    i += 4;
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vx2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vx2, vp);
+    vp = vfmaq_f32(valpha_7, vx2, vp);
+    vp = vfmaq_f32(valpha_5, vx2, vp);
+    vp = vfmaq_f32(valpha_3, vx2, vp);
+    vp = vfmaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vx2, vq);
+    vq = vfmaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vy)));
+    o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vfmaq_f32(valpha_11, vx2, valpha_13);
+    vp = vfmaq_f32(valpha_9, vx2, vp);
+    vp = vfmaq_f32(valpha_7, vx2, vp);
+    vp = vfmaq_f32(valpha_5, vx2, vp);
+    vp = vfmaq_f32(valpha_3, vx2, vp);
+    vp = vfmaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vfmaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vfmaq_f32(vbeta_2, vx2, vq);
+    vq = vfmaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vy));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_f32_embedding_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 = vaddq_f32(vacc0, vld1q_f32(i)); i += 4;
+      vacc1 = vaddq_f32(vacc1, vld1q_f32(i)); i += 4;
+      vacc2 = vaddq_f32(vacc2, vld1q_f32(i)); i += 4;
+      vacc3 = vaddq_f32(vacc3, vld1q_f32(i));
+    }
+    vst1q_f32(output, vmulq_f32(vacc0, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc1, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc2, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc3, vscale)); output += 4;
+    offset += 16 * sizeof(float);
+  }
+  for (; channels >= 4; channels -= 4) {
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = vaddq_f32(vacc, vld1q_f32(i));
+    }
+    vst1q_f32(output, vmulq_f32(vacc, vscale)); output += 4;
+    offset += 4 * sizeof(float);
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      vacc += *((const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset));
+    }
+    *output++ = vacc * vscale_tail;
+    offset += sizeof(float);
+  }
+}
@@ -0,0 +1,80 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_f32_embedding_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      xnn_prefetch_to_l1((const int8_t*) i + 64);
+
+      vacc0 = _mm_add_ps(vacc0, _mm_loadu_ps(i + 0));
+      vacc1 = _mm_add_ps(vacc1, _mm_loadu_ps(i + 4));
+      vacc2 = _mm_add_ps(vacc2, _mm_loadu_ps(i + 8));
+      vacc3 = _mm_add_ps(vacc3, _mm_loadu_ps(i + 12));
+    }
+    _mm_storeu_ps(output + 0, _mm_mul_ps(vacc0, vscale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(vacc1, vscale));
+    _mm_storeu_ps(output + 8, _mm_mul_ps(vacc2, vscale));
+    _mm_storeu_ps(output + 12, _mm_mul_ps(vacc3, vscale));
+    output += 16;
+    offset += 16 * sizeof(float);
+  }
+  for (; channels >= 4; channels -= 4) {
+    __m128 vacc = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = _mm_add_ps(vacc, _mm_loadu_ps(i));
+    }
+    _mm_storeu_ps(output, _mm_mul_ps(vacc, vscale));
+    output += 4;
+    offset += 4 * sizeof(float);
+  }
+  for (; channels != 0; channels -= 1) {
+    __m128 vacc = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const float* i = (const float*) ((uintptr_t) table + (size_t) indices[r] * table_stride + offset);
+      vacc = _mm_add_ss(vacc, _mm_load_ss(i));
+    }
+    _mm_store_ss(output, _mm_mul_ss(vacc, vscale));
+    output += 1;
+    offset += sizeof(float);
+  }
+}
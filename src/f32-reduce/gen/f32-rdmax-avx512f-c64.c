@@ -0,0 +1,92 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdmax_ukernel__avx512f_c64(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 64; channels -= 64) {
+    const float* i = input;
+    __m512 vacc0 = _mm512_loadu_ps(output + 0);
+    __m512 vacc1 = _mm512_loadu_ps(output + 16);
+    __m512 vacc2 = _mm512_loadu_ps(output + 32);
+    __m512 vacc3 = _mm512_loadu_ps(output + 48);
+    size_t r = rows;
+    do {
+      const __m512 vx0 = _mm512_loadu_ps(i + 0);
+      const __m512 vx1 = _mm512_loadu_ps(i + 16);
+      const __m512 vx2 = _mm512_loadu_ps(i + 32);
+      const __m512 vx3 = _mm512_loadu_ps(i + 48);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm512_max_ps(vacc0, vx0);
+      vacc1 = _mm512_max_ps(vacc1, vx1);
+      vacc2 = _mm512_max_ps(vacc2, vx2);
+      vacc3 = _mm512_max_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm512_storeu_ps(output + 0, vacc0);
+    _mm512_storeu_ps(output + 16, vacc1);
+    _mm512_storeu_ps(output + 32, vacc2);
+    _mm512_storeu_ps(output + 48, vacc3);
+    output += 64;
+    input += 64;
+  }
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m512 vacc = _mm512_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm512_storeu_ps(output, vacc);
+    output += 16;
+    input += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1);
+    assert(channels <= 15);
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << channels) - UINT32_C(1)));
+
+    const float* i = input;
+    __m512 vacc = _mm512_maskz_loadu_ps(vmask, output);
+    size_t r = rows;
+    do {
+      const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm512_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm512_mask_storeu_ps(output, vmask, vacc);
+  }
+}
@@ -0,0 +1,73 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdmax_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vacc0 = output[0];
+    float vacc1 = output[1];
+    float vacc2 = output[2];
+    float vacc3 = output[3];
+    size_t r = rows;
+    do {
+      const float vx0 = i[0];
+      const float vx1 = i[1];
+      const float vx2 = i[2];
+      const float vx3 = i[3];
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = math_max_f32(vacc0, vx0);
+      vacc1 = math_max_f32(vacc1, vx1);
+      vacc2 = math_max_f32(vacc2, vx2);
+      vacc3 = math_max_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    output[0] = vacc0;
+    output[1] = vacc1;
+    output[2] = vacc2;
+    output[3] = vacc3;
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = *output;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = math_max_f32(vacc, vx);
+      } while (--r != 0);
+
+      *output++ = vacc;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
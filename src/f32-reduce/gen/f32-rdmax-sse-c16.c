@@ -0,0 +1,90 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdmax_ukernel__sse_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vacc0 = _mm_loadu_ps(output + 0);
+    __m128 vacc1 = _mm_loadu_ps(output + 4);
+    __m128 vacc2 = _mm_loadu_ps(output + 8);
+    __m128 vacc3 = _mm_loadu_ps(output + 12);
+    size_t r = rows;
+    do {
+      const __m128 vx0 = _mm_loadu_ps(i + 0);
+      const __m128 vx1 = _mm_loadu_ps(i + 4);
+      const __m128 vx2 = _mm_loadu_ps(i + 8);
+      const __m128 vx3 = _mm_loadu_ps(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm_max_ps(vacc0, vx0);
+      vacc1 = _mm_max_ps(vacc1, vx1);
+      vacc2 = _mm_max_ps(vacc2, vx2);
+      vacc3 = _mm_max_ps(vacc3, vx3);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output + 0, vacc0);
+    _mm_storeu_ps(output + 4, vacc1);
+    _mm_storeu_ps(output + 8, vacc2);
+    _mm_storeu_ps(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_loadu_ps(output);
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_max_ps(vacc, vx);
+    } while (--r != 0);
+
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_load_ss(output);
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_max_ss(vacc, vx);
+      } while (--r != 0);
+
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
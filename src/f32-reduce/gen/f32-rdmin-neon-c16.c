@@ -0,0 +1,90 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdmin_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vacc0 = vld1q_f32(output + 0);
+    float32x4_t vacc1 = vld1q_f32(output + 4);
+    float32x4_t vacc2 = vld1q_f32(output + 8);
+    float32x4_t vacc3 = vld1q_f32(output + 12);
+    size_t r = rows;
+    do {
+      const float32x4_t vx0 = vld1q_f32(i + 0);
+      const float32x4_t vx1 = vld1q_f32(i + 4);
+      const float32x4_t vx2 = vld1q_f32(i + 8);
+      const float32x4_t vx3 = vld1q_f32(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = vminq_f32(vacc0, vx0);
+      vacc1 = vminq_f32(vacc1, vx1);
+      vacc2 = vminq_f32(vacc2, vx2);
+      vacc3 = vminq_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    vst1q_f32(output + 0, vacc0);
+    vst1q_f32(output + 4, vacc1);
+    vst1q_f32(output + 8, vacc2);
+    vst1q_f32(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vacc = vld1q_f32(output);
+    size_t r = rows;
+    do {
+      const float32x4_t vx = vld1q_f32(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = vminq_f32(vacc, vx);
+    } while (--r != 0);
+
+    vst1q_f32(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = *output;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = math_min_f32(vacc, vx);
+      } while (--r != 0);
+
+      *output++ = vacc;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
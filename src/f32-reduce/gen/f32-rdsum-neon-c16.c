@@ -0,0 +1,97 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdsum_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    size_t r = rows;
+    do {
+      const float32x4_t vx0 = vld1q_f32(i + 0);
+      const float32x4_t vx1 = vld1q_f32(i + 4);
+      const float32x4_t vx2 = vld1q_f32(i + 8);
+      const float32x4_t vx3 = vld1q_f32(i + 12);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = vaddq_f32(vacc0, vx0);
+      vacc1 = vaddq_f32(vacc1, vx1);
+      vacc2 = vaddq_f32(vacc2, vx2);
+      vacc3 = vaddq_f32(vacc3, vx3);
+    } while (--r != 0);
+
+    vacc0 = vmlaq_f32(vld1q_f32(output + 0), vacc0, vscale);
+    vacc1 = vmlaq_f32(vld1q_f32(output + 4), vacc1, vscale);
+    vacc2 = vmlaq_f32(vld1q_f32(output + 8), vacc2, vscale);
+    vacc3 = vmlaq_f32(vld1q_f32(output + 12), vacc3, vscale);
+    vst1q_f32(output + 0, vacc0);
+    vst1q_f32(output + 4, vacc1);
+    vst1q_f32(output + 8, vacc2);
+    vst1q_f32(output + 12, vacc3);
+    output += 16;
+    input += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vacc = vmovq_n_f32(0.0f);
+    size_t r = rows;
+    do {
+      const float32x4_t vx = vld1q_f32(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = vaddq_f32(vacc, vx);
+    } while (--r != 0);
+
+    vacc = vmlaq_f32(vld1q_f32(output), vacc, vscale);
+    vst1q_f32(output, vacc);
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float vscale_lane = vgetq_lane_f32(vscale, 0);
+    do {
+      const float* i = input;
+      float vacc = 0.0f;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc += vx;
+      } while (--r != 0);
+
+      *output++ += vacc * vscale_lane;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
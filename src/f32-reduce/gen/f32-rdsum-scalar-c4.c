@@ -0,0 +1,74 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdsum_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vscale = params->scalar.scale;
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    size_t r = rows;
+    do {
+      const float vx0 = i[0];
+      const float vx1 = i[1];
+      const float vx2 = i[2];
+      const float vx3 = i[3];
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 += vx0;
+      vacc1 += vx1;
+      vacc2 += vx2;
+      vacc3 += vx3;
+    } while (--r != 0);
+
+    output[0] += vacc0 * vscale;
+    output[1] += vacc1 * vscale;
+    output[2] += vacc2 * vscale;
+    output[3] += vacc3 * vscale;
+    output += 4;
+    input += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vacc = 0.0f;
+      size_t r = rows;
+      do {
+        const float vx = *i;
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc += vx;
+      } while (--r != 0);
+
+      *output++ += vacc * vscale;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
@@ -0,0 +1,114 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rdop-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rdsumsq_ukernel__avx_c32(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vscale = _mm256_broadcast_ss(&params->scalar.scale);
+  for (; channels >= 32; channels -= 32) {
+    const float* i = input;
+    __m256 vacc0 = _mm256_setzero_ps();
+    __m256 vacc1 = _mm256_setzero_ps();
+    __m256 vacc2 = _mm256_setzero_ps();
+    __m256 vacc3 = _mm256_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m256 vx0 = _mm256_loadu_ps(i + 0);
+      const __m256 vx1 = _mm256_loadu_ps(i + 8);
+      const __m256 vx2 = _mm256_loadu_ps(i + 16);
+      const __m256 vx3 = _mm256_loadu_ps(i + 24);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vx0, vx0));
+      vacc1 = _mm256_add_ps(vacc1, _mm256_mul_ps(vx1, vx1));
+      vacc2 = _mm256_add_ps(vacc2, _mm256_mul_ps(vx2, vx2));
+      vacc3 = _mm256_add_ps(vacc3, _mm256_mul_ps(vx3, vx3));
+    } while (--r != 0);
+
+    vacc0 = _mm256_add_ps(_mm256_loadu_ps(output + 0), _mm256_mul_ps(vacc0, vscale));
+    vacc1 = _mm256_add_ps(_mm256_loadu_ps(output + 8), _mm256_mul_ps(vacc1, vscale));
+    vacc2 = _mm256_add_ps(_mm256_loadu_ps(output + 16), _mm256_mul_ps(vacc2, vscale));
+    vacc3 = _mm256_add_ps(_mm256_loadu_ps(output + 24), _mm256_mul_ps(vacc3, vscale));
+    _mm256_storeu_ps(output + 0, vacc0);
+    _mm256_storeu_ps(output + 8, vacc1);
+    _mm256_storeu_ps(output + 16, vacc2);
+    _mm256_storeu_ps(output + 24, vacc3);
+    output += 32;
+    input += 32;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const float* i = input;
+    __m256 vacc = _mm256_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m256 vx = _mm256_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vx, vx));
+    } while (--r != 0);
+
+    vacc = _mm256_add_ps(_mm256_loadu_ps(output), _mm256_mul_ps(vacc, vscale));
+    _mm256_storeu_ps(output, vacc);
+    output += 8;
+    input += 8;
+  }
+  if XNN_UNLIKELY(channels >= 4) {
+    const float* i = input;
+    __m128 vacc = _mm_setzero_ps();
+    size_t r = rows;
+    do {
+      const __m128 vx = _mm_loadu_ps(i);
+      i = (const float*) ((uintptr_t) i + input_stride);
+
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(vx, vx));
+    } while (--r != 0);
+
+    vacc = _mm_add_ps(_mm_loadu_ps(output), _mm_mul_ps(vacc, _mm256_castps256_ps128(vscale)));
+    _mm_storeu_ps(output, vacc);
+    output += 4;
+    input += 4;
+    channels -= 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      __m128 vacc = _mm_setzero_ps();
+      size_t r = rows;
+      do {
+        const __m128 vx = _mm_load_ss(i);
+        i = (const float*) ((uintptr_t) i + input_stride);
+
+        vacc = _mm_add_ss(vacc, _mm_mul_ss(vx, vx));
+      } while (--r != 0);
+
+      vacc = _mm_add_ss(_mm_load_ss(output), _mm_mul_ss(vacc, _mm256_castps256_ps128(vscale)));
+      _mm_store_ss(output, vacc);
+      output += 1;
+      input += 1;
+    } while (--channels != 0);
+  }
+}
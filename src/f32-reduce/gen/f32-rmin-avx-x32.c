@@ -0,0 +1,73 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rop-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rmin_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vacc0 = _mm256_broadcast_ss(output);
+  __m256 vacc1 = vacc0;
+  __m256 vacc2 = vacc0;
+  __m256 vacc3 = vacc0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vacc0 = _mm256_min_ps(vacc0, vx0);
+    vacc1 = _mm256_min_ps(vacc1, vx1);
+    vacc2 = _mm256_min_ps(vacc2, vx2);
+    vacc3 = _mm256_min_ps(vacc3, vx3);
+  }
+  vacc0 = _mm256_min_ps(vacc0, vacc1);
+  vacc2 = _mm256_min_ps(vacc2, vacc3);
+  vacc0 = _mm256_min_ps(vacc0, vacc2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vacc0 = _mm256_min_ps(vacc0, vx);
+  }
+  __m128 vacc = _mm_min_ps(_mm256_castps256_ps128(vacc0), _mm256_extractf128_ps(vacc0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vacc = _mm_min_ps(vacc, vx);
+  }
+  vacc = _mm_min_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_min_ss(vacc, _mm_movehdup_ps(vacc));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vacc = _mm_min_ss(vacc, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vacc);
+}
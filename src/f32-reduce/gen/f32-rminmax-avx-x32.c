@@ -0,0 +1,91 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rminmax-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rminmax_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vmin0 = _mm256_broadcast_ss(output);
+  __m256 vmax0 = _mm256_broadcast_ss(output + 1);
+  __m256 vmin1 = vmin0;
+  __m256 vmax1 = vmax0;
+  __m256 vmin2 = vmin0;
+  __m256 vmax2 = vmax0;
+  __m256 vmin3 = vmin0;
+  __m256 vmax3 = vmax0;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    const __m256 vx2 = _mm256_loadu_ps(input + 16);
+    const __m256 vx3 = _mm256_loadu_ps(input + 24);
+    input += 32;
+
+    vmin0 = _mm256_min_ps(vmin0, vx0);
+    vmax0 = _mm256_max_ps(vmax0, vx0);
+    vmin1 = _mm256_min_ps(vmin1, vx1);
+    vmax1 = _mm256_max_ps(vmax1, vx1);
+    vmin2 = _mm256_min_ps(vmin2, vx2);
+    vmax2 = _mm256_max_ps(vmax2, vx2);
+    vmin3 = _mm256_min_ps(vmin3, vx3);
+    vmax3 = _mm256_max_ps(vmax3, vx3);
+  }
+  vmin0 = _mm256_min_ps(vmin0, vmin1);
+  vmax0 = _mm256_max_ps(vmax0, vmax1);
+  vmin2 = _mm256_min_ps(vmin2, vmin3);
+  vmax2 = _mm256_max_ps(vmax2, vmax3);
+  vmin0 = _mm256_min_ps(vmin0, vmin2);
+  vmax0 = _mm256_max_ps(vmax0, vmax2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    vmin0 = _mm256_min_ps(vmin0, vx);
+    vmax0 = _mm256_max_ps(vmax0, vx);
+  }
+  __m128 vmin = _mm_min_ps(_mm256_castps256_ps128(vmin0), _mm256_extractf128_ps(vmin0, 1));
+  __m128 vmax = _mm_max_ps(_mm256_castps256_ps128(vmax0), _mm256_extractf128_ps(vmax0, 1));
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vmin = _mm_min_ps(vmin, vx);
+    vmax = _mm_max_ps(vmax, vx);
+  }
+  vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+  vmin = _mm_min_ss(vmin, _mm_movehdup_ps(vmin));
+  vmax = _mm_max_ss(vmax, _mm_movehdup_ps(vmax));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vmin = _mm_min_ss(vmin, vx);
+      vmax = _mm_max_ss(vmax, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vmin);
+  _mm_store_ss(output + 1, vmax);
+}
@@ -0,0 +1,84 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rminmax-neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rminmax_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vmin0 = vld1q_dup_f32(output);
+  float32x4_t vmax0 = vld1q_dup_f32(output + 1);
+  float32x4_t vmin1 = vmin0;
+  float32x4_t vmax1 = vmax0;
+  float32x4_t vmin2 = vmin0;
+  float32x4_t vmax2 = vmax0;
+  float32x4_t vmin3 = vmin0;
+  float32x4_t vmax3 = vmax0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vmin0 = vminq_f32(vmin0, vx0);
+    vmax0 = vmaxq_f32(vmax0, vx0);
+    vmin1 = vminq_f32(vmin1, vx1);
+    vmax1 = vmaxq_f32(vmax1, vx1);
+    vmin2 = vminq_f32(vmin2, vx2);
+    vmax2 = vmaxq_f32(vmax2, vx2);
+    vmin3 = vminq_f32(vmin3, vx3);
+    vmax3 = vmaxq_f32(vmax3, vx3);
+  }
+  vmin0 = vminq_f32(vmin0, vmin1);
+  vmax0 = vmaxq_f32(vmax0, vmax1);
+  vmin2 = vminq_f32(vmin2, vmin3);
+  vmax2 = vmaxq_f32(vmax2, vmax3);
+  vmin0 = vminq_f32(vmin0, vmin2);
+  vmax0 = vmaxq_f32(vmax0, vmax2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+
+    vmin0 = vminq_f32(vmin0, vx);
+    vmax0 = vmaxq_f32(vmax0, vx);
+  }
+  #if XNN_ARCH_ARM64
+    float vmin = vminvq_f32(vmin0);
+    float vmax = vmaxvq_f32(vmax0);
+  #else
+    const float32x2_t vmin_lo = vmin_f32(vget_low_f32(vmin0), vget_high_f32(vmin0));
+    const float32x2_t vmax_lo = vmax_f32(vget_low_f32(vmax0), vget_high_f32(vmax0));
+    float vmin = vget_lane_f32(vpmin_f32(vmin_lo, vmin_lo), 0);
+    float vmax = vget_lane_f32(vpmax_f32(vmax_lo, vmax_lo), 0);
+  #endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vmin = math_min_f32(vmin, vx);
+      vmax = math_max_f32(vmax, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  output[0] = vmin;
+  output[1] = vmax;
+}
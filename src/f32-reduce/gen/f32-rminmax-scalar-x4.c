@@ -0,0 +1,68 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rminmax-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rminmax_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vmin0 = output[0];
+  float vmax0 = output[1];
+  float vmin1 = vmin0;
+  float vmax1 = vmax0;
+  float vmin2 = vmin0;
+  float vmax2 = vmax0;
+  float vmin3 = vmin0;
+  float vmax3 = vmax0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vmin0 = math_min_f32(vmin0, vx0);
+    vmax0 = math_max_f32(vmax0, vx0);
+    vmin1 = math_min_f32(vmin1, vx1);
+    vmax1 = math_max_f32(vmax1, vx1);
+    vmin2 = math_min_f32(vmin2, vx2);
+    vmax2 = math_max_f32(vmax2, vx2);
+    vmin3 = math_min_f32(vmin3, vx3);
+    vmax3 = math_max_f32(vmax3, vx3);
+  }
+  vmin0 = math_min_f32(vmin0, vmin1);
+  vmax0 = math_max_f32(vmax0, vmax1);
+  vmin2 = math_min_f32(vmin2, vmin3);
+  vmax2 = math_max_f32(vmax2, vmax3);
+  vmin0 = math_min_f32(vmin0, vmin2);
+  vmax0 = math_max_f32(vmax0, vmax2);
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vmin0 = math_min_f32(vmin0, vx);
+      vmax0 = math_max_f32(vmax0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  output[0] = vmin0;
+  output[1] = vmax0;
+}
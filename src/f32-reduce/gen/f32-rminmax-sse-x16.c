@@ -0,0 +1,82 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rminmax-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rminmax_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m128 vmin0 = _mm_load1_ps(output);
+  __m128 vmax0 = _mm_load1_ps(output + 1);
+  __m128 vmin1 = vmin0;
+  __m128 vmax1 = vmax0;
+  __m128 vmin2 = vmin0;
+  __m128 vmax2 = vmax0;
+  __m128 vmin3 = vmin0;
+  __m128 vmax3 = vmax0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    vmin0 = _mm_min_ps(vmin0, vx0);
+    vmax0 = _mm_max_ps(vmax0, vx0);
+    vmin1 = _mm_min_ps(vmin1, vx1);
+    vmax1 = _mm_max_ps(vmax1, vx1);
+    vmin2 = _mm_min_ps(vmin2, vx2);
+    vmax2 = _mm_max_ps(vmax2, vx2);
+    vmin3 = _mm_min_ps(vmin3, vx3);
+    vmax3 = _mm_max_ps(vmax3, vx3);
+  }
+  vmin0 = _mm_min_ps(vmin0, vmin1);
+  vmax0 = _mm_max_ps(vmax0, vmax1);
+  vmin2 = _mm_min_ps(vmin2, vmin3);
+  vmax2 = _mm_max_ps(vmax2, vmax3);
+  vmin0 = _mm_min_ps(vmin0, vmin2);
+  vmax0 = _mm_max_ps(vmax0, vmax2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    vmin0 = _mm_min_ps(vmin0, vx);
+    vmax0 = _mm_max_ps(vmax0, vx);
+  }
+  vmin0 = _mm_min_ps(vmin0, _mm_movehl_ps(vmin0, vmin0));
+  vmax0 = _mm_max_ps(vmax0, _mm_movehl_ps(vmax0, vmax0));
+  vmin0 = _mm_min_ss(vmin0, _mm_shuffle_ps(vmin0, vmin0, _MM_SHUFFLE(1, 1, 1, 1)));
+  vmax0 = _mm_max_ss(vmax0, _mm_shuffle_ps(vmax0, vmax0, _MM_SHUFFLE(1, 1, 1, 1)));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vx = _mm_load_ss(input);
+      input += 1;
+
+      vmin0 = _mm_min_ss(vmin0, vx);
+      vmax0 = _mm_max_ss(vmax0, vx);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  _mm_store_ss(output, vmin0);
+  _mm_store_ss(output + 1, vmax0);
+}
@@ -0,0 +1,67 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rop-neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rsum_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vacc0 = vmovq_n_f32(0.0f);
+  float32x4_t vacc1 = vacc0;
+  float32x4_t vacc2 = vacc0;
+  float32x4_t vacc3 = vacc0;
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vacc0 = vaddq_f32(vacc0, vx0);
+    vacc1 = vaddq_f32(vacc1, vx1);
+    vacc2 = vaddq_f32(vacc2, vx2);
+    vacc3 = vaddq_f32(vacc3, vx3);
+  }
+  vacc0 = vaddq_f32(vacc0, vacc1);
+  vacc2 = vaddq_f32(vacc2, vacc3);
+  vacc0 = vaddq_f32(vacc0, vacc2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+
+    vacc0 = vaddq_f32(vacc0, vx);
+  }
+  #if XNN_ARCH_ARM64
+    float vacc = vaddvq_f32(vacc0);
+  #else
+    const float32x2_t vacc_lo = vadd_f32(vget_low_f32(vacc0), vget_high_f32(vacc0));
+    float vacc = vget_lane_f32(vpadd_f32(vacc_lo, vacc_lo), 0);
+  #endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc += vx;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output += vacc * params->scalar.scale;
+}
@@ -0,0 +1,55 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-reduce/rop-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rsum_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vacc0 = 0.0f;
+  float vacc1 = vacc0;
+  float vacc2 = vacc0;
+  float vacc3 = vacc0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    vacc0 += vx0;
+    vacc1 += vx1;
+    vacc2 += vx2;
+    vacc3 += vx3;
+  }
+  vacc0 += vacc1;
+  vacc2 += vacc3;
+  vacc0 += vacc2;
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      vacc0 += vx;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  *output += vacc0 * params->scalar.scale;
+}
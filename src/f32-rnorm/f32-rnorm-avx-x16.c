@@ -0,0 +1,123 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f32_rnorm_ukernel__avx_x16(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const __m256 vshift8 = _mm256_set1_ps(vshift);
+  __m256 vsum0 = _mm256_setzero_ps();
+  __m256 vsum1 = _mm256_setzero_ps();
+  __m256 vsumsq0 = _mm256_setzero_ps();
+  __m256 vsumsq1 = _mm256_setzero_ps();
+  size_t c = channels;
+  for (; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m256 vd0 = _mm256_sub_ps(_mm256_loadu_ps(i), vshift8);
+    const __m256 vd1 = _mm256_sub_ps(_mm256_loadu_ps(i + 8), vshift8);
+    i += 16;
+
+    vsum0 = _mm256_add_ps(vsum0, vd0);
+    vsum1 = _mm256_add_ps(vsum1, vd1);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd0, vd0));
+    vsumsq1 = _mm256_add_ps(vsumsq1, _mm256_mul_ps(vd1, vd1));
+  }
+  if (c >= 8 * sizeof(float)) {
+    const __m256 vd = _mm256_sub_ps(_mm256_loadu_ps(i), vshift8);
+    i += 8;
+
+    vsum0 = _mm256_add_ps(vsum0, vd);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vd, vd));
+    c -= 8 * sizeof(float);
+  }
+  const __m256 vsum8 = _mm256_add_ps(vsum0, vsum1);
+  const __m256 vsumsq8 = _mm256_add_ps(vsumsq0, vsumsq1);
+  __m128 vsum = _mm_add_ps(_mm256_castps256_ps128(vsum8), _mm256_extractf128_ps(vsum8, 1));
+  __m128 vsumsq = _mm_add_ps(_mm256_castps256_ps128(vsumsq8), _mm256_extractf128_ps(vsumsq8, 1));
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_movehdup_ps(vsum));
+  vsumsq = _mm_add_ss(vsumsq, _mm_movehdup_ps(vsumsq));
+  float vsum_tail = _mm_cvtss_f32(vsum);
+  float vsumsq_tail = _mm_cvtss_f32(vsumsq);
+  for (; c != 0; c -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m256 vmean8 = _mm256_set1_ps(vmean);
+  const __m256 vrstd8 = _mm256_set1_ps(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(i);
+    const __m256 vx1 = _mm256_loadu_ps(i + 8);
+    i += 16;
+    const __m256 vscale0 = _mm256_mul_ps(_mm256_loadu_ps(gamma), vrstd8);
+    const __m256 vscale1 = _mm256_mul_ps(_mm256_loadu_ps(gamma + 8), vrstd8);
+    gamma += 16;
+
+    const __m256 vy0 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx0, vmean8), vscale0), _mm256_loadu_ps(beta));
+    const __m256 vy1 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx1, vmean8), vscale1), _mm256_loadu_ps(beta + 8));
+    beta += 16;
+
+    _mm256_storeu_ps(o, vy0);
+    _mm256_storeu_ps(o + 8, vy1);
+    o += 16;
+  }
+  if (c >= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(i);
+    i += 8;
+    const __m256 vscale = _mm256_mul_ps(_mm256_loadu_ps(gamma), vrstd8);
+    gamma += 8;
+
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(vx, vmean8), vscale), _mm256_loadu_ps(beta));
+    beta += 8;
+
+    _mm256_storeu_ps(o, vy);
+    o += 8;
+    c -= 8 * sizeof(float);
+  }
+  for (; c != 0; c -= sizeof(float)) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
@@ -0,0 +1,129 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f32_rnorm_ukernel__avx512f_x32(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const __m512 vshift16 = _mm512_set1_ps(vshift);
+  __m512 vsum0 = _mm512_setzero_ps();
+  __m512 vsum1 = _mm512_setzero_ps();
+  __m512 vsumsq0 = _mm512_setzero_ps();
+  __m512 vsumsq1 = _mm512_setzero_ps();
+  size_t c = channels;
+  for (; c >= 32 * sizeof(float); c -= 32 * sizeof(float)) {
+    const __m512 vd0 = _mm512_sub_ps(_mm512_loadu_ps(i), vshift16);
+    const __m512 vd1 = _mm512_sub_ps(_mm512_loadu_ps(i + 16), vshift16);
+    i += 32;
+
+    vsum0 = _mm512_add_ps(vsum0, vd0);
+    vsum1 = _mm512_add_ps(vsum1, vd1);
+    vsumsq0 = _mm512_fmadd_ps(vd0, vd0, vsumsq0);
+    vsumsq1 = _mm512_fmadd_ps(vd1, vd1, vsumsq1);
+  }
+  for (; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m512 vd = _mm512_sub_ps(_mm512_loadu_ps(i), vshift16);
+    i += 16;
+
+    vsum0 = _mm512_add_ps(vsum0, vd);
+    vsumsq0 = _mm512_fmadd_ps(vd, vd, vsumsq0);
+  }
+  if XNN_UNLIKELY(c != 0) {
+    assert(c >= 1 * sizeof(float));
+    assert(c <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on c).
+    c >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << c) - UINT32_C(1)));
+
+    const __m512 vd = _mm512_maskz_sub_ps(vmask, _mm512_maskz_loadu_ps(vmask, i), vshift16);
+    vsum1 = _mm512_add_ps(vsum1, vd);
+    vsumsq1 = _mm512_fmadd_ps(vd, vd, vsumsq1);
+  }
+  const float vsum = _mm512_reduce_add_ps(_mm512_add_ps(vsum0, vsum1));
+  const float vsumsq = _mm512_reduce_add_ps(_mm512_add_ps(vsumsq0, vsumsq1));
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum * vinv_n;
+  const float vmeansq = vsumsq * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m512 vmean16 = _mm512_set1_ps(vmean);
+  const __m512 vrstd16 = _mm512_set1_ps(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 32 * sizeof(float); c -= 32 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(i);
+    const __m512 vx1 = _mm512_loadu_ps(i + 16);
+    i += 32;
+    const __m512 vscale0 = _mm512_mul_ps(_mm512_loadu_ps(gamma), vrstd16);
+    const __m512 vscale1 = _mm512_mul_ps(_mm512_loadu_ps(gamma + 16), vrstd16);
+    gamma += 32;
+
+    const __m512 vy0 = _mm512_fmadd_ps(_mm512_sub_ps(vx0, vmean16), vscale0, _mm512_loadu_ps(beta));
+    const __m512 vy1 = _mm512_fmadd_ps(_mm512_sub_ps(vx1, vmean16), vscale1, _mm512_loadu_ps(beta + 16));
+    beta += 32;
+
+    _mm512_storeu_ps(o, vy0);
+    _mm512_storeu_ps(o + 16, vy1);
+    o += 32;
+  }
+  for (; c >= 16 * sizeof(float); c -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(i);
+    i += 16;
+    const __m512 vscale = _mm512_mul_ps(_mm512_loadu_ps(gamma), vrstd16);
+    gamma += 16;
+
+    const __m512 vy = _mm512_fmadd_ps(_mm512_sub_ps(vx, vmean16), vscale, _mm512_loadu_ps(beta));
+    beta += 16;
+
+    _mm512_storeu_ps(o, vy);
+    o += 16;
+  }
+  if XNN_UNLIKELY(c != 0) {
+    assert(c >= 1 * sizeof(float));
+    assert(c <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on c).
+    c >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << c) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, i);
+    const __m512 vscale = _mm512_mul_ps(_mm512_maskz_loadu_ps(vmask, gamma), vrstd16);
+    const __m512 vy = _mm512_fmadd_ps(_mm512_sub_ps(vx, vmean16), vscale, _mm512_maskz_loadu_ps(vmask, beta));
+    _mm512_mask_storeu_ps(o, vmask, vy);
+  }
+}
@@ -0,0 +1,114 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f32_rnorm_ukernel__neon_x8(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const float32x4_t vshift4 = vdupq_n_f32(vshift);
+  float32x4_t vsum0 = vmovq_n_f32(0.0f);
+  float32x4_t vsum1 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq0 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq1 = vmovq_n_f32(0.0f);
+  size_t c = channels;
+  for (; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const float32x4_t vd0 = vsubq_f32(vld1q_f32(i), vshift4); i += 4;
+    const float32x4_t vd1 = vsubq_f32(vld1q_f32(i), vshift4); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vd0);
+    vsum1 = vaddq_f32(vsum1, vd1);
+    vsumsq0 = vmlaq_f32(vsumsq0, vd0, vd0);
+    vsumsq1 = vmlaq_f32(vsumsq1, vd1, vd1);
+  }
+  if (c >= 4 * sizeof(float)) {
+    const float32x4_t vd = vsubq_f32(vld1q_f32(i), vshift4); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vd);
+    vsumsq0 = vmlaq_f32(vsumsq0, vd, vd);
+    c -= 4 * sizeof(float);
+  }
+  const float32x4_t vsum4 = vaddq_f32(vsum0, vsum1);
+  const float32x4_t vsumsq4 = vaddq_f32(vsumsq0, vsumsq1);
+  float32x2_t vsum2 = vadd_f32(vget_low_f32(vsum4), vget_high_f32(vsum4));
+  float32x2_t vsumsq2 = vadd_f32(vget_low_f32(vsumsq4), vget_high_f32(vsumsq4));
+  vsum2 = vpadd_f32(vsum2, vsum2);
+  vsumsq2 = vpadd_f32(vsumsq2, vsumsq2);
+  float vsum_tail = vget_lane_f32(vsum2, 0);
+  float vsumsq_tail = vget_lane_f32(vsumsq2, 0);
+  for (; c != 0; c -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const float32x4_t vmean4 = vdupq_n_f32(vmean);
+  const float32x4_t vrstd4 = vdupq_n_f32(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(i); i += 4;
+    const float32x4_t vx1 = vld1q_f32(i); i += 4;
+    const float32x4_t vscale0 = vmulq_f32(vld1q_f32(gamma), vrstd4); gamma += 4;
+    const float32x4_t vscale1 = vmulq_f32(vld1q_f32(gamma), vrstd4); gamma += 4;
+    const float32x4_t vbeta0 = vld1q_f32(beta); beta += 4;
+    const float32x4_t vbeta1 = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vy0 = vmlaq_f32(vbeta0, vsubq_f32(vx0, vmean4), vscale0);
+    const float32x4_t vy1 = vmlaq_f32(vbeta1, vsubq_f32(vx1, vmean4), vscale1);
+
+    vst1q_f32(o, vy0); o += 4;
+    vst1q_f32(o, vy1); o += 4;
+  }
+  if (c >= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(i); i += 4;
+    const float32x4_t vscale = vmulq_f32(vld1q_f32(gamma), vrstd4); gamma += 4;
+    const float32x4_t vbeta = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vy = vmlaq_f32(vbeta, vsubq_f32(vx, vmean4), vscale);
+
+    vst1q_f32(o, vy); o += 4;
+    c -= 4 * sizeof(float);
+  }
+  for (; c != 0; c -= sizeof(float)) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
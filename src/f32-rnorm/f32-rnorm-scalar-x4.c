@@ -0,0 +1,96 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f32_rnorm_ukernel__scalar_x4(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  float vsum0 = 0.0f;
+  float vsum1 = 0.0f;
+  float vsumsq0 = 0.0f;
+  float vsumsq1 = 0.0f;
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const float vd0 = i[0] - vshift;
+    const float vd1 = i[1] - vshift;
+    const float vd2 = i[2] - vshift;
+    const float vd3 = i[3] - vshift;
+    i += 4;
+
+    vsum0 += vd0;
+    vsum1 += vd1;
+    vsumsq0 += vd0 * vd0;
+    vsumsq1 += vd1 * vd1;
+    vsum0 += vd2;
+    vsum1 += vd3;
+    vsumsq0 += vd2 * vd2;
+    vsumsq1 += vd3 * vd3;
+  }
+  for (; channels != 0; channels -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum0 += vd;
+    vsumsq0 += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = (vsum0 + vsum1) * vinv_n;
+  const float vmeansq = (vsumsq0 + vsumsq1) * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (; n >= 4; n -= 4) {
+    const float vx0 = i[0];
+    const float vx1 = i[1];
+    const float vx2 = i[2];
+    const float vx3 = i[3];
+    i += 4;
+
+    const float vscale0 = gamma[0] * vrstd;
+    const float vscale1 = gamma[1] * vrstd;
+    const float vscale2 = gamma[2] * vrstd;
+    const float vscale3 = gamma[3] * vrstd;
+    gamma += 4;
+
+    o[0] = (vx0 - vmean) * vscale0 + beta[0];
+    o[1] = (vx1 - vmean) * vscale1 + beta[1];
+    o[2] = (vx2 - vmean) * vscale2 + beta[2];
+    o[3] = (vx3 - vmean) * vscale3 + beta[3];
+    beta += 4;
+    o += 4;
+  }
+  for (; n != 0; n -= 1) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_f32_rnorm_ukernel__sse_x8(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const size_t n = channels / sizeof(float);
+  const uint32_t vsubtract_mean = params->scalar.subtract_mean;
+  // Statistics are accumulated relative to the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = vsubtract_mean ? *input : 0.0f;
+
+  const float* i = input;
+  const __m128 vshift4 = _mm_set1_ps(vshift);
+  __m128 vsum0 = _mm_setzero_ps();
+  __m128 vsum1 = _mm_setzero_ps();
+  __m128 vsumsq0 = _mm_setzero_ps();
+  __m128 vsumsq1 = _mm_setzero_ps();
+  size_t c = channels;
+  for (; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const __m128 vd0 = _mm_sub_ps(_mm_loadu_ps(i), vshift4);
+    const __m128 vd1 = _mm_sub_ps(_mm_loadu_ps(i + 4), vshift4);
+    i += 8;
+
+    vsum0 = _mm_add_ps(vsum0, vd0);
+    vsum1 = _mm_add_ps(vsum1, vd1);
+    vsumsq0 = _mm_add_ps(vsumsq0, _mm_mul_ps(vd0, vd0));
+    vsumsq1 = _mm_add_ps(vsumsq1, _mm_mul_ps(vd1, vd1));
+  }
+  if (c >= 4 * sizeof(float)) {
+    const __m128 vd = _mm_sub_ps(_mm_loadu_ps(i), vshift4);
+    i += 4;
+
+    vsum0 = _mm_add_ps(vsum0, vd);
+    vsumsq0 = _mm_add_ps(vsumsq0, _mm_mul_ps(vd, vd));
+    c -= 4 * sizeof(float);
+  }
+  __m128 vsum = _mm_add_ps(vsum0, vsum1);
+  __m128 vsumsq = _mm_add_ps(vsumsq0, vsumsq1);
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_shuffle_ps(vsum, vsum, _MM_SHUFFLE(1, 1, 1, 1)));
+  vsumsq = _mm_add_ss(vsumsq, _mm_shuffle_ps(vsumsq, vsumsq, _MM_SHUFFLE(1, 1, 1, 1)));
+  float vsum_tail = _mm_cvtss_f32(vsum);
+  float vsumsq_tail = _mm_cvtss_f32(vsumsq);
+  for (; c != 0; c -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum_tail += vd;
+    vsumsq_tail += vd * vd;
+  }
+
+  const float vinv_n = 1.0f / (float) n;
+  const float vmean_shifted = vsum_tail * vinv_n;
+  const float vmeansq = vsumsq_tail * vinv_n;
+  float vmean = 0.0f;
+  float vvar = vmeansq;
+  if (vsubtract_mean) {
+    vmean = vshift + vmean_shifted;
+    vvar = math_max_f32(vmeansq - vmean_shifted * vmean_shifted, 0.0f);
+  }
+  const float vrstd = 1.0f / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m128 vmean4 = _mm_set1_ps(vmean);
+  const __m128 vrstd4 = _mm_set1_ps(vrstd);
+  const float* gamma = weights;
+  const float* beta = weights + n;
+  i = input;
+  float* o = output;
+  for (c = channels; c >= 8 * sizeof(float); c -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(i);
+    const __m128 vx1 = _mm_loadu_ps(i + 4);
+    i += 8;
+    const __m128 vscale0 = _mm_mul_ps(_mm_loadu_ps(gamma), vrstd4);
+    const __m128 vscale1 = _mm_mul_ps(_mm_loadu_ps(gamma + 4), vrstd4);
+    gamma += 8;
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx0, vmean4), vscale0), _mm_loadu_ps(beta));
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx1, vmean4), vscale1), _mm_loadu_ps(beta + 4));
+    beta += 8;
+
+    _mm_storeu_ps(o, vy0);
+    _mm_storeu_ps(o + 4, vy1);
+    o += 8;
+  }
+  if (c >= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(i);
+    i += 4;
+    const __m128 vscale = _mm_mul_ps(_mm_loadu_ps(gamma), vrstd4);
+    gamma += 4;
+
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(vx, vmean4), vscale), _mm_loadu_ps(beta));
+    beta += 4;
+
+    _mm_storeu_ps(o, vy);
+    o += 4;
+    c -= 4 * sizeof(float);
+  }
+  for (; c != 0; c -= sizeof(float)) {
+    *o++ = (*i++ - vmean) * (*gamma++ * vrstd) + *beta++;
+  }
+}
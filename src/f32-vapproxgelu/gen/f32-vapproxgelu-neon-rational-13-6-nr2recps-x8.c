@@ -0,0 +1,200 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vapproxgelu/neon-rational-13-6.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vapproxgelu_ukernel__neon_rational_13_6_nr2recps_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vc3 = vmovq_n_f32(0x1.2444F2p-5f);
+  const float32x4_t vc1 = vmovq_n_f32(0x1.988454p-1f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input);
+    const float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vu0 = vmlaq_f32(vc1, vx20, vc3);
+    float32x4_t vu1 = vmlaq_f32(vc1, vx21, vc3);
+
+    vu0 = vmulq_f32(vx0, vu0);
+    vu1 = vmulq_f32(vx1, vu1);
+
+    vu0 = vmaxq_f32(vu0, vneg_sat_cutoff);
+    vu1 = vmaxq_f32(vu1, vneg_sat_cutoff);
+
+    vu0 = vminq_f32(vu0, vsat_cutoff);
+    vu1 = vminq_f32(vu1, vsat_cutoff);
+
+    const float32x4_t vu20 = vmulq_f32(vu0, vu0);
+    const float32x4_t vu21 = vmulq_f32(vu1, vu1);
+
+    float32x4_t vp0 = vmlaq_f32(valpha_11, vu20, valpha_13);
+    float32x4_t vp1 = vmlaq_f32(valpha_11, vu21, valpha_13);
+
+    vp0 = vmlaq_f32(valpha_9, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_9, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_7, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_7, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_5, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_5, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_3, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_3, vu21, vp1);
+
+    vp0 = vmlaq_f32(valpha_1, vu20, vp0);
+    vp1 = vmlaq_f32(valpha_1, vu21, vp1);
+
+    vp0 = vmulq_f32(vu0, vp0);
+    vp1 = vmulq_f32(vu1, vp1);
+
+    float32x4_t vq0 = vmlaq_f32(vbeta_4, vu20, vbeta_6);
+    float32x4_t vq1 = vmlaq_f32(vbeta_4, vu21, vbeta_6);
+
+    vq0 = vmlaq_f32(vbeta_2, vu20, vq0);
+    vq1 = vmlaq_f32(vbeta_2, vu21, vq1);
+
+    vq0 = vmlaq_f32(vbeta_0, vu20, vq0);
+    vq1 = vmlaq_f32(vbeta_0, vu21, vq1);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    const float32x4_t vt0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vt1 = vmulq_f32(vp1, vrq1);
+
+    const float32x4_t vhalfx0 = vmulq_f32(vx0, vhalf);
+    const float32x4_t vhalfx1 = vmulq_f32(vx1, vhalf);
+
+    const float32x4_t vy0 = vmlaq_f32(vhalfx0, vhalfx0, vt0);
+    const float32x4_t vy1 = vmlaq_f32(vhalfx1, vhalfx1, vt1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vmlaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vu2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vu2, vp);
+    vp = vmlaq_f32(valpha_7, vu2, vp);
+    vp = vmlaq_f32(valpha_5, vu2, vp);
+    vp = vmlaq_f32(valpha_3, vu2, vp);
+    vp = vmlaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vu2, vq);
+    vq = vmlaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, vt);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vu = vmlaq_f32(vc1, vx2, vc3);
+    vu = vmulq_f32(vx, vu);
+
+    vu = vmaxq_f32(vu, vneg_sat_cutoff);
+    vu = vminq_f32(vu, vsat_cutoff);
+
+    const float32x4_t vu2 = vmulq_f32(vu, vu);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vu2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vu2, vp);
+    vp = vmlaq_f32(valpha_7, vu2, vp);
+    vp = vmlaq_f32(valpha_5, vu2, vp);
+    vp = vmlaq_f32(valpha_3, vu2, vp);
+    vp = vmlaq_f32(valpha_1, vu2, vp);
+    vp = vmulq_f32(vu, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vu2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vu2, vq);
+    vq = vmlaq_f32(vbeta_0, vu2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vt = vmulq_f32(vp, vrq);
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, vt);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,80 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vapproxgelu/scalar-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x1(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vc3 = 0x1.2444F2p-5f;
+  const float vc1 = 0x1.988454p-1f;
+  const float vhalf = 0.5f;
+  const float vneg_sat_cutoff = -0x1.F9F09Ep+2f;
+  const float vsat_cutoff = 0x1.F9F09Ep+2f;
+  const float valpha_13 = -0x1.3E4B80p-52f;
+  const float valpha_11 = 0x1.C266FCp-43f;
+  const float valpha_9 = -0x1.7A6FFEp-34f;
+  const float valpha_7 = 0x1.B80082p-25f;
+  const float valpha_5 = 0x1.F28694p-17f;
+  const float valpha_3 = 0x1.4E1BDAp-11f;
+  const float valpha_1 = 0x1.40B3B8p-8f;
+  const float vbeta_6 = 0x1.41A7B0p-20f;
+  const float vbeta_4 = 0x1.F12BACp-14f;
+  const float vbeta_2 = 0x1.29540Ap-9f;
+  const float vbeta_0 = 0x1.40B3BAp-8f;
+
+  do {
+    const float vx = *input++;
+
+    const float vx2 = vx * vx;
+
+    float vu = vx2 * vc3 + vc1;
+    vu = vx * vu;
+
+    vu = math_max_f32(vu, vneg_sat_cutoff);
+    vu = math_min_f32(vu, vsat_cutoff);
+
+    const float vu2 = vu * vu;
+
+    float vp = vu2 * valpha_13 + valpha_11;
+    vp = vu2 * vp + valpha_9;
+    vp = vu2 * vp + valpha_7;
+    vp = vu2 * vp + valpha_5;
+    vp = vu2 * vp + valpha_3;
+    vp = vu2 * vp + valpha_1;
+    vp = vu * vp;
+
+    float vq = vu2 * vbeta_6 + vbeta_4;
+    vq = vu2 * vq + vbeta_2;
+    vq = vu2 * vq + vbeta_0;
+
+    const float vt = vp / vq;
+
+    const float vhalfx = vx * vhalf;
+    const float vy = vhalfx * vt + vhalfx;
+
+    *output++ = vy;
+
+    batch -= sizeof(float);
+  } while (batch != 0);
+}
@@ -0,0 +1,148 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vapproxgelu/scalar-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x2(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vc3 = 0x1.2444F2p-5f;
+  const float vc1 = 0x1.988454p-1f;
+  const float vhalf = 0.5f;
+  const float vneg_sat_cutoff = -0x1.F9F09Ep+2f;
+  const float vsat_cutoff = 0x1.F9F09Ep+2f;
+  const float valpha_13 = -0x1.3E4B80p-52f;
+  const float valpha_11 = 0x1.C266FCp-43f;
+  const float valpha_9 = -0x1.7A6FFEp-34f;
+  const float valpha_7 = 0x1.B80082p-25f;
+  const float valpha_5 = 0x1.F28694p-17f;
+  const float valpha_3 = 0x1.4E1BDAp-11f;
+  const float valpha_1 = 0x1.40B3B8p-8f;
+  const float vbeta_6 = 0x1.41A7B0p-20f;
+  const float vbeta_4 = 0x1.F12BACp-14f;
+  const float vbeta_2 = 0x1.29540Ap-9f;
+  const float vbeta_0 = 0x1.40B3BAp-8f;
+
+  for (; batch >= 2 * sizeof(float); batch -= 2 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    input += 2;
+
+    const float vx20 = vx0 * vx0;
+    const float vx21 = vx1 * vx1;
+
+    float vu0 = vx20 * vc3 + vc1;
+    float vu1 = vx21 * vc3 + vc1;
+
+    vu0 = vx0 * vu0;
+    vu1 = vx1 * vu1;
+
+    vu0 = math_max_f32(vu0, vneg_sat_cutoff);
+    vu1 = math_max_f32(vu1, vneg_sat_cutoff);
+
+    vu0 = math_min_f32(vu0, vsat_cutoff);
+    vu1 = math_min_f32(vu1, vsat_cutoff);
+
+    const float vu20 = vu0 * vu0;
+    const float vu21 = vu1 * vu1;
+
+    float vp0 = vu20 * valpha_13 + valpha_11;
+    float vp1 = vu21 * valpha_13 + valpha_11;
+
+    vp0 = vu20 * vp0 + valpha_9;
+    vp1 = vu21 * vp1 + valpha_9;
+
+    vp0 = vu20 * vp0 + valpha_7;
+    vp1 = vu21 * vp1 + valpha_7;
+
+    vp0 = vu20 * vp0 + valpha_5;
+    vp1 = vu21 * vp1 + valpha_5;
+
+    vp0 = vu20 * vp0 + valpha_3;
+    vp1 = vu21 * vp1 + valpha_3;
+
+    vp0 = vu20 * vp0 + valpha_1;
+    vp1 = vu21 * vp1 + valpha_1;
+
+    vp0 = vu0 * vp0;
+    vp1 = vu1 * vp1;
+
+    float vq0 = vu20 * vbeta_6 + vbeta_4;
+    float vq1 = vu21 * vbeta_6 + vbeta_4;
+
+    vq0 = vu20 * vq0 + vbeta_2;
+    vq1 = vu21 * vq1 + vbeta_2;
+
+    vq0 = vu20 * vq0 + vbeta_0;
+    vq1 = vu21 * vq1 + vbeta_0;
+
+    const float vt0 = vp0 / vq0;
+    const float vt1 = vp1 / vq1;
+
+    const float vhalfx0 = vx0 * vhalf;
+    const float vhalfx1 = vx1 * vhalf;
+
+    const float vy0 = vhalfx0 * vt0 + vhalfx0;
+    const float vy1 = vhalfx1 * vt1 + vhalfx1;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output += 2;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      const float vx2 = vx * vx;
+
+      float vu = vx2 * vc3 + vc1;
+      vu = vx * vu;
+
+      vu = math_max_f32(vu, vneg_sat_cutoff);
+      vu = math_min_f32(vu, vsat_cutoff);
+
+      const float vu2 = vu * vu;
+
+      float vp = vu2 * valpha_13 + valpha_11;
+      vp = vu2 * vp + valpha_9;
+      vp = vu2 * vp + valpha_7;
+      vp = vu2 * vp + valpha_5;
+      vp = vu2 * vp + valpha_3;
+      vp = vu2 * vp + valpha_1;
+      vp = vu * vp;
+
+      float vq = vu2 * vbeta_6 + vbeta_4;
+      vq = vu2 * vq + vbeta_2;
+      vq = vu2 * vq + vbeta_0;
+
+      const float vt = vp / vq;
+
+      const float vhalfx = vx * vhalf;
+      const float vy = vhalfx * vt + vhalfx;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
@@ -0,0 +1,120 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vapproxgelu/sse2-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vapproxgelu_ukernel__sse2_rational_13_6_div_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vc3 = _mm_set1_ps(0x1.2444F2p-5f);
+  const __m128 vc1 = _mm_set1_ps(0x1.988454p-1f);
+  const __m128 vhalf = _mm_set1_ps(0.5f);
+  const __m128 vneg_sat_cutoff = _mm_set1_ps(-0x1.F9F09Ep+2f);
+  const __m128 vsat_cutoff = _mm_set1_ps(0x1.F9F09Ep+2f);
+  const __m128 valpha_13 = _mm_set1_ps(-0x1.3E4B80p-52f);
+  const __m128 valpha_11 = _mm_set1_ps(0x1.C266FCp-43f);
+  const __m128 valpha_9 = _mm_set1_ps(-0x1.7A6FFEp-34f);
+  const __m128 valpha_7 = _mm_set1_ps(0x1.B80082p-25f);
+  const __m128 valpha_5 = _mm_set1_ps(0x1.F28694p-17f);
+  const __m128 valpha_3 = _mm_set1_ps(0x1.4E1BDAp-11f);
+  const __m128 valpha_1 = _mm_set1_ps(0x1.40B3B8p-8f);
+  const __m128 vbeta_6 = _mm_set1_ps(0x1.41A7B0p-20f);
+  const __m128 vbeta_4 = _mm_set1_ps(0x1.F12BACp-14f);
+  const __m128 vbeta_2 = _mm_set1_ps(0x1.29540Ap-9f);
+  const __m128 vbeta_0 = _mm_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    const __m128 vx2 = _mm_mul_ps(vx, vx);
+
+    __m128 vu = _mm_add_ps(_mm_mul_ps(vx2, vc3), vc1);
+    vu = _mm_mul_ps(vx, vu);
+
+    vu = _mm_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm_min_ps(vu, vsat_cutoff);
+
+    const __m128 vu2 = _mm_mul_ps(vu, vu);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vu2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_1);
+    vp = _mm_mul_ps(vu, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vu2, vbeta_6), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_0);
+
+    const __m128 vt = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, vt), vhalfx);
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    const __m128 vx2 = _mm_mul_ps(vx, vx);
+
+    __m128 vu = _mm_add_ps(_mm_mul_ps(vx2, vc3), vc1);
+    vu = _mm_mul_ps(vx, vu);
+
+    vu = _mm_max_ps(vu, vneg_sat_cutoff);
+    vu = _mm_min_ps(vu, vsat_cutoff);
+
+    const __m128 vu2 = _mm_mul_ps(vu, vu);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vu2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vu2, vp), valpha_1);
+    vp = _mm_mul_ps(vu, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vu2, vbeta_6), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vu2, vq), vbeta_0);
+
+    const __m128 vt = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, vt), vhalfx);
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
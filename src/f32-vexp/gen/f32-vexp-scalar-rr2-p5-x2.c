@@ -0,0 +1,156 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/scalar-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vexp_ukernel__scalar_rr2_p5_x2(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vmagic_bias = 0x1.800000p+23f;
+  // The smallest x for which expf(x) is non-zero.
+  const float vzero_cutoff = -0x1.9FE368p+6f;
+  // The largest x for which expf(x) is finite.
+  const float vinf_cutoff = 0x1.62E42Ep+6f;
+  const float vlog2e = 0x1.715476p+0f;
+  const float vminus_ln2_hi = -0x1.62E400p-1f;
+  const float vminus_ln2_lo = -0x1.7F7D1Cp-20f;
+  const float vplus_inf = INFINITY;
+  const float vc5 = 0x1.0F9F9Cp-7f;
+  const float vc4 = 0x1.573A1Ap-5f;
+  const float vc3 = 0x1.555A80p-3f;
+  const float vc2 = 0x1.FFFDC6p-2f;
+  const float vc1 = 0x1.FFFFF6p-1f;
+  const int32_t vmin_exponent = -INT32_C(0x3F000000);
+  const int32_t vmax_exponent = INT32_C(0x3F800000);
+  const uint32_t vdefault_exponent = UINT32_C(0x3F800000);
+
+  for (; batch >= 2 * sizeof(float); batch -= 2 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    input += 2;
+
+    float vn0 = vx0 * vlog2e + vmagic_bias;
+    float vn1 = vx1 * vlog2e + vmagic_bias;
+
+    int32_t veo0 = (int32_t) (float_as_uint32(vn0) << 23);
+    int32_t veo1 = (int32_t) (float_as_uint32(vn1) << 23);
+
+    int32_t ven0 = math_max_s32(veo0, vmin_exponent);
+    int32_t ven1 = math_max_s32(veo1, vmin_exponent);
+
+    ven0 = math_min_s32(ven0, vmax_exponent);
+    ven1 = math_min_s32(ven1, vmax_exponent);
+
+    veo0 -= ven0;
+    veo1 -= ven1;
+
+    const float vsn0 = uint32_as_float((uint32_t) ven0 + vdefault_exponent);
+    const float vsn1 = uint32_as_float((uint32_t) ven1 + vdefault_exponent);
+
+    const float vso0 = uint32_as_float((uint32_t) veo0 + vdefault_exponent);
+    const float vso1 = uint32_as_float((uint32_t) veo1 + vdefault_exponent);
+
+    vn0 -= vmagic_bias;
+    vn1 -= vmagic_bias;
+
+    float vt0 = vn0 * vminus_ln2_hi + vx0;
+    float vt1 = vn1 * vminus_ln2_hi + vx1;
+
+    vt0 = vn0 * vminus_ln2_lo + vt0;
+    vt1 = vn1 * vminus_ln2_lo + vt1;
+
+    float vp0 = vc5 * vt0 + vc4;
+    float vp1 = vc5 * vt1 + vc4;
+
+    vp0 = vp0 * vt0 + vc3;
+    vp1 = vp1 * vt1 + vc3;
+
+    vp0 = vp0 * vt0 + vc2;
+    vp1 = vp1 * vt1 + vc2;
+
+    vp0 = vp0 * vt0 + vc1;
+    vp1 = vp1 * vt1 + vc1;
+
+    vt0 *= vso0;
+    vt1 *= vso1;
+
+    float vy0 = vsn0 * (vt0 * vp0 + vso0);
+    float vy1 = vsn1 * (vt1 * vp1 + vso1);
+
+    if XNN_UNPREDICTABLE(vx0 < vzero_cutoff) {
+      vy0 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx1 < vzero_cutoff) {
+      vy1 = 0.0f;
+    }
+
+    if XNN_UNPREDICTABLE(vx0 > vinf_cutoff) {
+      vy0 = vplus_inf;
+    }
+    if XNN_UNPREDICTABLE(vx1 > vinf_cutoff) {
+      vy1 = vplus_inf;
+    }
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output += 2;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      float vn = vx * vlog2e + vmagic_bias;
+
+      int32_t veo = (int32_t) (float_as_uint32(vn) << 23);
+      int32_t ven = math_max_s32(veo, vmin_exponent);
+      ven = math_min_s32(ven, vmax_exponent);
+      veo -= ven;
+      const float vsn = uint32_as_float((uint32_t) ven + vdefault_exponent);
+      const float vso = uint32_as_float((uint32_t) veo + vdefault_exponent);
+
+      vn -= vmagic_bias;
+
+      float vt = vn * vminus_ln2_hi + vx;
+      vt = vn * vminus_ln2_lo + vt;
+
+      float vp = vc5 * vt + vc4;
+      vp = vp * vt + vc3;
+      vp = vp * vt + vc2;
+      vp = vp * vt + vc1;
+
+      vt *= vso;
+      float vy = vsn * (vt * vp + vso);
+
+      if XNN_UNPREDICTABLE(vx < vzero_cutoff) {
+        vy = 0.0f;
+      }
+      if XNN_UNPREDICTABLE(vx > vinf_cutoff) {
+        vy = vplus_inf;
+      }
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
@@ -0,0 +1,120 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/sse2-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vexp_ukernel__sse2_rr2_p5_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vmagic_bias = _mm_set1_ps(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m128 vzero_cutoff = _mm_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m128 vinf_cutoff = _mm_set1_ps(0x1.62E42Ep+6f);
+  const __m128 vlog2e = _mm_set1_ps(0x1.715476p+0f);
+  const __m128 vminus_ln2_hi = _mm_set1_ps(-0x1.62E400p-1f);
+  const __m128 vminus_ln2_lo = _mm_set1_ps(-0x1.7F7D1Cp-20f);
+  const __m128 vplus_inf = _mm_set1_ps(INFINITY);
+  const __m128 vc5 = _mm_set1_ps(0x1.0F9F9Cp-7f);
+  const __m128 vc4 = _mm_set1_ps(0x1.573A1Ap-5f);
+  const __m128 vc3 = _mm_set1_ps(0x1.555A80p-3f);
+  const __m128 vc2 = _mm_set1_ps(0x1.FFFDC6p-2f);
+  const __m128 vc1 = _mm_set1_ps(0x1.FFFFF6p-1f);
+  const __m128i vmin_exponent = _mm_set1_epi32(0xC1000000);
+  const __m128i vmax_exponent = _mm_set1_epi32(0x3F800000);
+  const __m128i vdefault_exponent = vmax_exponent;
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vdefault_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vdefault_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
@@ -0,0 +1,186 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/sse2-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vexp_ukernel__sse2_rr2_p5_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vmagic_bias = _mm_set1_ps(0x1.800000p+23f);
+  // The smallest x for which expf(x) is non-zero.
+  const __m128 vzero_cutoff = _mm_set1_ps(-0x1.9FE368p+6f);
+  // The largest x for which expf(x) is finite.
+  const __m128 vinf_cutoff = _mm_set1_ps(0x1.62E42Ep+6f);
+  const __m128 vlog2e = _mm_set1_ps(0x1.715476p+0f);
+  const __m128 vminus_ln2_hi = _mm_set1_ps(-0x1.62E400p-1f);
+  const __m128 vminus_ln2_lo = _mm_set1_ps(-0x1.7F7D1Cp-20f);
+  const __m128 vplus_inf = _mm_set1_ps(INFINITY);
+  const __m128 vc5 = _mm_set1_ps(0x1.0F9F9Cp-7f);
+  const __m128 vc4 = _mm_set1_ps(0x1.573A1Ap-5f);
+  const __m128 vc3 = _mm_set1_ps(0x1.555A80p-3f);
+  const __m128 vc2 = _mm_set1_ps(0x1.FFFDC6p-2f);
+  const __m128 vc1 = _mm_set1_ps(0x1.FFFFF6p-1f);
+  const __m128i vmin_exponent = _mm_set1_epi32(0xC1000000);
+  const __m128i vmax_exponent = _mm_set1_epi32(0x3F800000);
+  const __m128i vdefault_exponent = vmax_exponent;
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    __m128 vn0 = _mm_add_ps(_mm_mul_ps(vx0, vlog2e), vmagic_bias);
+    __m128 vn1 = _mm_add_ps(_mm_mul_ps(vx1, vlog2e), vmagic_bias);
+
+    __m128i veo0 = _mm_slli_epi32(_mm_castps_si128(vn0), 23);
+    __m128i veo1 = _mm_slli_epi32(_mm_castps_si128(vn1), 23);
+
+    __m128i ven0 = _mm_max_epi16(veo0, vmin_exponent);
+    __m128i ven1 = _mm_max_epi16(veo1, vmin_exponent);
+
+    ven0 = _mm_min_epi16(ven0, vmax_exponent);
+    ven1 = _mm_min_epi16(ven1, vmax_exponent);
+
+    veo0 = _mm_sub_epi32(veo0, ven0);
+    veo1 = _mm_sub_epi32(veo1, ven1);
+
+    const __m128 vsn0 = _mm_castsi128_ps(_mm_add_epi32(ven0, vdefault_exponent));
+    const __m128 vsn1 = _mm_castsi128_ps(_mm_add_epi32(ven1, vdefault_exponent));
+
+    const __m128 vso0 = _mm_castsi128_ps(_mm_add_epi32(veo0, vdefault_exponent));
+    const __m128 vso1 = _mm_castsi128_ps(_mm_add_epi32(veo1, vdefault_exponent));
+
+    vn0 = _mm_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm_sub_ps(vn1, vmagic_bias);
+
+    __m128 vt0 = _mm_add_ps(_mm_mul_ps(vn0, vminus_ln2_hi), vx0);
+    __m128 vt1 = _mm_add_ps(_mm_mul_ps(vn1, vminus_ln2_hi), vx1);
+
+    vt0 = _mm_add_ps(_mm_mul_ps(vn0, vminus_ln2_lo), vt0);
+    vt1 = _mm_add_ps(_mm_mul_ps(vn1, vminus_ln2_lo), vt1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vc5, vt0), vc4);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vc5, vt1), vc4);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc3);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc2);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc2);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vp0, vt0), vc1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vp1, vt1), vc1);
+
+    vt0 = _mm_mul_ps(vt0, vso0);
+    vt1 = _mm_mul_ps(vt1, vso1);
+
+    __m128 vy0 = _mm_mul_ps(vsn0, _mm_add_ps(_mm_mul_ps(vt0, vp0), vso0));
+    __m128 vy1 = _mm_mul_ps(vsn1, _mm_add_ps(_mm_mul_ps(vt1, vp1), vso1));
+
+    vy0 = _mm_andnot_ps(_mm_cmplt_ps(vx0, vzero_cutoff), vy0);
+    vy1 = _mm_andnot_ps(_mm_cmplt_ps(vx1, vzero_cutoff), vy1);
+
+    const __m128 vm0 = _mm_cmpgt_ps(vx0, vinf_cutoff);
+    const __m128 vm1 = _mm_cmpgt_ps(vx1, vinf_cutoff);
+
+    vy0 = _mm_or_ps(_mm_and_ps(vplus_inf, vm0), _mm_andnot_ps(vm0, vy0));
+    vy1 = _mm_or_ps(_mm_and_ps(vplus_inf, vm1), _mm_andnot_ps(vm1, vy1));
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vdefault_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vdefault_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vdefault_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/scalar-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vsqrt1_2 = 0x1.6A09E6p-1f;
+  const float vneg_erf_cutoff = -0x1.000000p+2f;
+  const float verf_cutoff = 0x1.000000p+2f;
+  const float valpha_13 = -0x1.2BBE16p-32f;
+  const float valpha_11 = 0x1.DBFFDCp-26f;
+  const float valpha_9 = -0x1.19FEA2p-19f;
+  const float valpha_7 = -0x1.DD85A4p-15f;
+  const float valpha_5 = -0x1.8158C6p-11f;
+  const float valpha_3 = -0x1.8343ECp-9f;
+  const float valpha_1 = -0x1.07B7A8p-6f;
+  const float vbeta_8 = -0x1.E8C19Ap-17f;
+  const float vbeta_6 = -0x1.BF7A52p-13f;
+  const float vbeta_4 = -0x1.B9249Cp-10f;
+  const float vbeta_2 = -0x1.E337F0p-8f;
+  const float vbeta_0 = -0x1.D36D4Ep-7f;
+  const float vhalf = 0.5f;
+
+  do {
+    const float vx = *input++;
+
+    float vz = vx * vsqrt1_2;
+    vz = math_max_f32(vz, vneg_erf_cutoff);
+    vz = math_min_f32(vz, verf_cutoff);
+
+    const float vz2 = vz * vz;
+
+    float vp = vz2 * valpha_13 + valpha_11;
+    vp = vz2 * vp + valpha_9;
+    vp = vz2 * vp + valpha_7;
+    vp = vz2 * vp + valpha_5;
+    vp = vz2 * vp + valpha_3;
+    vp = vz2 * vp + valpha_1;
+    vp = vz * vp;
+
+    float vq = vz2 * vbeta_8 + vbeta_6;
+    vq = vz2 * vq + vbeta_4;
+    vq = vz2 * vq + vbeta_2;
+    vq = vz2 * vq + vbeta_0;
+
+    const float verf = vp / vq;
+
+    const float vhalfx = vx * vhalf;
+    const float vy = vhalfx * verf + vhalfx;
+
+    *output++ = vy;
+
+    batch -= sizeof(float);
+  } while (batch != 0);
+}
@@ -0,0 +1,182 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/scalar-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vsqrt1_2 = 0x1.6A09E6p-1f;
+  const float vneg_erf_cutoff = -0x1.000000p+2f;
+  const float verf_cutoff = 0x1.000000p+2f;
+  const float valpha_13 = -0x1.2BBE16p-32f;
+  const float valpha_11 = 0x1.DBFFDCp-26f;
+  const float valpha_9 = -0x1.19FEA2p-19f;
+  const float valpha_7 = -0x1.DD85A4p-15f;
+  const float valpha_5 = -0x1.8158C6p-11f;
+  const float valpha_3 = -0x1.8343ECp-9f;
+  const float valpha_1 = -0x1.07B7A8p-6f;
+  const float vbeta_8 = -0x1.E8C19Ap-17f;
+  const float vbeta_6 = -0x1.BF7A52p-13f;
+  const float vbeta_4 = -0x1.B9249Cp-10f;
+  const float vbeta_2 = -0x1.E337F0p-8f;
+  const float vbeta_0 = -0x1.D36D4Ep-7f;
+  const float vhalf = 0.5f;
+
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    float vz0 = vx0 * vsqrt1_2;
+    float vz1 = vx1 * vsqrt1_2;
+    float vz2 = vx2 * vsqrt1_2;
+    float vz3 = vx3 * vsqrt1_2;
+
+    vz0 = math_max_f32(vz0, vneg_erf_cutoff);
+    vz1 = math_max_f32(vz1, vneg_erf_cutoff);
+    vz2 = math_max_f32(vz2, vneg_erf_cutoff);
+    vz3 = math_max_f32(vz3, vneg_erf_cutoff);
+
+    vz0 = math_min_f32(vz0, verf_cutoff);
+    vz1 = math_min_f32(vz1, verf_cutoff);
+    vz2 = math_min_f32(vz2, verf_cutoff);
+    vz3 = math_min_f32(vz3, verf_cutoff);
+
+    const float vz20 = vz0 * vz0;
+    const float vz21 = vz1 * vz1;
+    const float vz22 = vz2 * vz2;
+    const float vz23 = vz3 * vz3;
+
+    float vp0 = vz20 * valpha_13 + valpha_11;
+    float vp1 = vz21 * valpha_13 + valpha_11;
+    float vp2 = vz22 * valpha_13 + valpha_11;
+    float vp3 = vz23 * valpha_13 + valpha_11;
+
+    vp0 = vz20 * vp0 + valpha_9;
+    vp1 = vz21 * vp1 + valpha_9;
+    vp2 = vz22 * vp2 + valpha_9;
+    vp3 = vz23 * vp3 + valpha_9;
+
+    vp0 = vz20 * vp0 + valpha_7;
+    vp1 = vz21 * vp1 + valpha_7;
+    vp2 = vz22 * vp2 + valpha_7;
+    vp3 = vz23 * vp3 + valpha_7;
+
+    vp0 = vz20 * vp0 + valpha_5;
+    vp1 = vz21 * vp1 + valpha_5;
+    vp2 = vz22 * vp2 + valpha_5;
+    vp3 = vz23 * vp3 + valpha_5;
+
+    vp0 = vz20 * vp0 + valpha_3;
+    vp1 = vz21 * vp1 + valpha_3;
+    vp2 = vz22 * vp2 + valpha_3;
+    vp3 = vz23 * vp3 + valpha_3;
+
+    vp0 = vz20 * vp0 + valpha_1;
+    vp1 = vz21 * vp1 + valpha_1;
+    vp2 = vz22 * vp2 + valpha_1;
+    vp3 = vz23 * vp3 + valpha_1;
+
+    vp0 = vz0 * vp0;
+    vp1 = vz1 * vp1;
+    vp2 = vz2 * vp2;
+    vp3 = vz3 * vp3;
+
+    float vq0 = vz20 * vbeta_8 + vbeta_6;
+    float vq1 = vz21 * vbeta_8 + vbeta_6;
+    float vq2 = vz22 * vbeta_8 + vbeta_6;
+    float vq3 = vz23 * vbeta_8 + vbeta_6;
+
+    vq0 = vz20 * vq0 + vbeta_4;
+    vq1 = vz21 * vq1 + vbeta_4;
+    vq2 = vz22 * vq2 + vbeta_4;
+    vq3 = vz23 * vq3 + vbeta_4;
+
+    vq0 = vz20 * vq0 + vbeta_2;
+    vq1 = vz21 * vq1 + vbeta_2;
+    vq2 = vz22 * vq2 + vbeta_2;
+    vq3 = vz23 * vq3 + vbeta_2;
+
+    vq0 = vz20 * vq0 + vbeta_0;
+    vq1 = vz21 * vq1 + vbeta_0;
+    vq2 = vz22 * vq2 + vbeta_0;
+    vq3 = vz23 * vq3 + vbeta_0;
+
+    const float verf0 = vp0 / vq0;
+    const float verf1 = vp1 / vq1;
+    const float verf2 = vp2 / vq2;
+    const float verf3 = vp3 / vq3;
+
+    const float vhalfx0 = vx0 * vhalf;
+    const float vhalfx1 = vx1 * vhalf;
+    const float vhalfx2 = vx2 * vhalf;
+    const float vhalfx3 = vx3 * vhalf;
+
+    const float vy0 = vhalfx0 * verf0 + vhalfx0;
+    const float vy1 = vhalfx1 * verf1 + vhalfx1;
+    const float vy2 = vhalfx2 * verf2 + vhalfx2;
+    const float vy3 = vhalfx3 * verf3 + vhalfx3;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+
+      float vz = vx * vsqrt1_2;
+      vz = math_max_f32(vz, vneg_erf_cutoff);
+      vz = math_min_f32(vz, verf_cutoff);
+
+      const float vz2 = vz * vz;
+
+      float vp = vz2 * valpha_13 + valpha_11;
+      vp = vz2 * vp + valpha_9;
+      vp = vz2 * vp + valpha_7;
+      vp = vz2 * vp + valpha_5;
+      vp = vz2 * vp + valpha_3;
+      vp = vz2 * vp + valpha_1;
+      vp = vz * vp;
+
+      float vq = vz2 * vbeta_8 + vbeta_6;
+      vq = vz2 * vq + vbeta_4;
+      vq = vz2 * vq + vbeta_2;
+      vq = vz2 * vq + vbeta_0;
+
+      const float verf = vp / vq;
+
+      const float vhalfx = vx * vhalf;
+      const float vy = vhalfx * verf + vhalfx;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
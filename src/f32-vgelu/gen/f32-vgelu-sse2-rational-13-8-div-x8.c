@@ -0,0 +1,177 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/sse2-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128 vsqrt1_2 = _mm_set1_ps(0x1.6A09E6p-1f);
+  const __m128 vneg_erf_cutoff = _mm_set1_ps(-0x1.000000p+2f);
+  const __m128 verf_cutoff = _mm_set1_ps(0x1.000000p+2f);
+  const __m128 valpha_13 = _mm_set1_ps(-0x1.2BBE16p-32f);
+  const __m128 valpha_11 = _mm_set1_ps(0x1.DBFFDCp-26f);
+  const __m128 valpha_9 = _mm_set1_ps(-0x1.19FEA2p-19f);
+  const __m128 valpha_7 = _mm_set1_ps(-0x1.DD85A4p-15f);
+  const __m128 valpha_5 = _mm_set1_ps(-0x1.8158C6p-11f);
+  const __m128 valpha_3 = _mm_set1_ps(-0x1.8343ECp-9f);
+  const __m128 valpha_1 = _mm_set1_ps(-0x1.07B7A8p-6f);
+  const __m128 vbeta_8 = _mm_set1_ps(-0x1.E8C19Ap-17f);
+  const __m128 vbeta_6 = _mm_set1_ps(-0x1.BF7A52p-13f);
+  const __m128 vbeta_4 = _mm_set1_ps(-0x1.B9249Cp-10f);
+  const __m128 vbeta_2 = _mm_set1_ps(-0x1.E337F0p-8f);
+  const __m128 vbeta_0 = _mm_set1_ps(-0x1.D36D4Ep-7f);
+  const __m128 vhalf = _mm_set1_ps(0.5f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    __m128 vz0 = _mm_mul_ps(vx0, vsqrt1_2);
+    __m128 vz1 = _mm_mul_ps(vx1, vsqrt1_2);
+
+    vz0 = _mm_max_ps(vz0, vneg_erf_cutoff);
+    vz1 = _mm_max_ps(vz1, vneg_erf_cutoff);
+
+    vz0 = _mm_min_ps(vz0, verf_cutoff);
+    vz1 = _mm_min_ps(vz1, verf_cutoff);
+
+    const __m128 vz20 = _mm_mul_ps(vz0, vz0);
+    const __m128 vz21 = _mm_mul_ps(vz1, vz1);
+
+    __m128 vp0 = _mm_add_ps(_mm_mul_ps(vz20, valpha_13), valpha_11);
+    __m128 vp1 = _mm_add_ps(_mm_mul_ps(vz21, valpha_13), valpha_11);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_9);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_9);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_7);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_7);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_5);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_5);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_3);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_3);
+
+    vp0 = _mm_add_ps(_mm_mul_ps(vz20, vp0), valpha_1);
+    vp1 = _mm_add_ps(_mm_mul_ps(vz21, vp1), valpha_1);
+
+    vp0 = _mm_mul_ps(vz0, vp0);
+    vp1 = _mm_mul_ps(vz1, vp1);
+
+    __m128 vq0 = _mm_add_ps(_mm_mul_ps(vz20, vbeta_8), vbeta_6);
+    __m128 vq1 = _mm_add_ps(_mm_mul_ps(vz21, vbeta_8), vbeta_6);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vz20, vq0), vbeta_4);
+    vq1 = _mm_add_ps(_mm_mul_ps(vz21, vq1), vbeta_4);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vz20, vq0), vbeta_2);
+    vq1 = _mm_add_ps(_mm_mul_ps(vz21, vq1), vbeta_2);
+
+    vq0 = _mm_add_ps(_mm_mul_ps(vz20, vq0), vbeta_0);
+    vq1 = _mm_add_ps(_mm_mul_ps(vz21, vq1), vbeta_0);
+
+    const __m128 verf0 = _mm_div_ps(vp0, vq0);
+    const __m128 verf1 = _mm_div_ps(vp1, vq1);
+
+    const __m128 vhalfx0 = _mm_mul_ps(vx0, vhalf);
+    const __m128 vhalfx1 = _mm_mul_ps(vx1, vhalf);
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(vhalfx0, verf0), vhalfx0);
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(vhalfx1, verf1), vhalfx1);
+
+    _mm_storeu_ps(output, vy0);
+    _mm_storeu_ps(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    __m128 vz = _mm_mul_ps(vx, vsqrt1_2);
+    vz = _mm_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm_min_ps(vz, verf_cutoff);
+
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vz2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_1);
+    vp = _mm_mul_ps(vz, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vz2, vbeta_8), vbeta_6);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_0);
+
+    const __m128 verf = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, verf), vhalfx);
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    __m128 vz = _mm_mul_ps(vx, vsqrt1_2);
+    vz = _mm_max_ps(vz, vneg_erf_cutoff);
+    vz = _mm_min_ps(vz, verf_cutoff);
+
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vz2, valpha_13), valpha_11);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_9);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_7);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_5);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_3);
+    vp = _mm_add_ps(_mm_mul_ps(vz2, vp), valpha_1);
+    vp = _mm_mul_ps(vz, vp);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vz2, vbeta_8), vbeta_6);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_4);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_2);
+    vq = _mm_add_ps(_mm_mul_ps(vz2, vq), vbeta_0);
+
+    const __m128 verf = _mm_div_ps(vp, vq);
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, verf), vhalfx);
+
+    __m128 vh = vy;
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vh);
+      vh = _mm_movehl_ps(vh, vh);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vh);
+    }
+  }
+}
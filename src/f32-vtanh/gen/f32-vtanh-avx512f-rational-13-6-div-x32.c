@@ -0,0 +1,151 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/avx512f-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__avx512f_rational_13_6_div_x32(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vneg_sat_cutoff = _mm512_set1_ps(-0x1.F9F09Ep+2f);
+  const __m512 vsat_cutoff = _mm512_set1_ps(0x1.F9F09Ep+2f);
+  const __m512 valpha_13 = _mm512_set1_ps(-0x1.3E4B80p-52f);
+  const __m512 valpha_11 = _mm512_set1_ps(0x1.C266FCp-43f);
+  const __m512 valpha_9 = _mm512_set1_ps(-0x1.7A6FFEp-34f);
+  const __m512 valpha_7 = _mm512_set1_ps(0x1.B80082p-25f);
+  const __m512 valpha_5 = _mm512_set1_ps(0x1.F28694p-17f);
+  const __m512 valpha_3 = _mm512_set1_ps(0x1.4E1BDAp-11f);
+  const __m512 valpha_1 = _mm512_set1_ps(0x1.40B3B8p-8f);
+  const __m512 vbeta_6 = _mm512_set1_ps(0x1.41A7B0p-20f);
+  const __m512 vbeta_4 = _mm512_set1_ps(0x1.F12BACp-14f);
+  const __m512 vbeta_2 = _mm512_set1_ps(0x1.29540Ap-9f);
+  const __m512 vbeta_0 = _mm512_set1_ps(0x1.40B3BAp-8f);
+
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    __m512 vx0 = _mm512_loadu_ps(input);
+    __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    vx0 = _mm512_max_ps(vx0, vneg_sat_cutoff);
+    vx1 = _mm512_max_ps(vx1, vneg_sat_cutoff);
+
+    vx0 = _mm512_min_ps(vx0, vsat_cutoff);
+    vx1 = _mm512_min_ps(vx1, vsat_cutoff);
+
+    const __m512 vx20 = _mm512_mul_ps(vx0, vx0);
+    const __m512 vx21 = _mm512_mul_ps(vx1, vx1);
+
+    __m512 vp0 = _mm512_fmadd_ps(vx20, valpha_13, valpha_11);
+    __m512 vp1 = _mm512_fmadd_ps(vx21, valpha_13, valpha_11);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_9);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_9);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_7);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_7);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_5);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_5);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_3);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_3);
+
+    vp0 = _mm512_fmadd_ps(vx20, vp0, valpha_1);
+    vp1 = _mm512_fmadd_ps(vx21, vp1, valpha_1);
+
+    vp0 = _mm512_mul_ps(vx0, vp0);
+    vp1 = _mm512_mul_ps(vx1, vp1);
+
+    __m512 vq0 = _mm512_fmadd_ps(vx20, vbeta_6, vbeta_4);
+    __m512 vq1 = _mm512_fmadd_ps(vx21, vbeta_6, vbeta_4);
+
+    vq0 = _mm512_fmadd_ps(vx20, vq0, vbeta_2);
+    vq1 = _mm512_fmadd_ps(vx21, vq1, vbeta_2);
+
+    vq0 = _mm512_fmadd_ps(vx20, vq0, vbeta_0);
+    vq1 = _mm512_fmadd_ps(vx21, vq1, vbeta_0);
+
+    const __m512 vy0 = _mm512_div_ps(vp0, vq0);
+    const __m512 vy1 = _mm512_div_ps(vp1, vq1);
+
+    _mm512_storeu_ps(output, vy0);
+    _mm512_storeu_ps(output + 16, vy1);
+    output += 32;
+  }
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    vx = _mm512_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm512_min_ps(vx, vsat_cutoff);
+
+    const __m512 vx2 = _mm512_mul_ps(vx, vx);
+
+    __m512 vp = _mm512_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm512_mul_ps(vx, vp);
+
+    __m512 vq = _mm512_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m512 vy = _mm512_div_ps(vp, vq);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(float));
+    assert(batch <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on batch).
+    batch >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    vx = _mm512_max_ps(vx, vneg_sat_cutoff);
+    vx = _mm512_min_ps(vx, vsat_cutoff);
+
+    const __m512 vx2 = _mm512_mul_ps(vx, vx);
+
+    __m512 vp = _mm512_fmadd_ps(vx2, valpha_13, valpha_11);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_9);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_7);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_5);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_3);
+    vp = _mm512_fmadd_ps(vx2, vp, valpha_1);
+    vp = _mm512_mul_ps(vx, vp);
+
+    __m512 vq = _mm512_fmadd_ps(vx2, vbeta_6, vbeta_4);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_2);
+    vq = _mm512_fmadd_ps(vx2, vq, vbeta_0);
+
+    const __m512 vy = _mm512_div_ps(vp, vq);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
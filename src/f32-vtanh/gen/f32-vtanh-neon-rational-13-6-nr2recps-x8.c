@@ -0,0 +1,166 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/neon-rational-13-6.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__neon_rational_13_6_nr2recps_x8(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vneg_sat_cutoff = vmovq_n_f32(-0x1.F9F09Ep+2f);
+  const float32x4_t vsat_cutoff = vmovq_n_f32(0x1.F9F09Ep+2f);
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.3E4B80p-52f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.C266FCp-43f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.7A6FFEp-34f);
+  const float32x4_t valpha_7 = vmovq_n_f32(0x1.B80082p-25f);
+  const float32x4_t valpha_5 = vmovq_n_f32(0x1.F28694p-17f);
+  const float32x4_t valpha_3 = vmovq_n_f32(0x1.4E1BDAp-11f);
+  const float32x4_t valpha_1 = vmovq_n_f32(0x1.40B3B8p-8f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(0x1.41A7B0p-20f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(0x1.F12BACp-14f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(0x1.29540Ap-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(0x1.40B3BAp-8f);
+
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    float32x4_t vx0 = vld1q_f32(input);
+    float32x4_t vx1 = vld1q_f32(input + 4);
+    input += 8;
+
+    vx0 = vmaxq_f32(vx0, vneg_sat_cutoff);
+    vx1 = vmaxq_f32(vx1, vneg_sat_cutoff);
+
+    vx0 = vminq_f32(vx0, vsat_cutoff);
+    vx1 = vminq_f32(vx1, vsat_cutoff);
+
+    const float32x4_t vx20 = vmulq_f32(vx0, vx0);
+    const float32x4_t vx21 = vmulq_f32(vx1, vx1);
+
+    float32x4_t vp0 = vmlaq_f32(valpha_11, vx20, valpha_13);
+    float32x4_t vp1 = vmlaq_f32(valpha_11, vx21, valpha_13);
+
+    vp0 = vmlaq_f32(valpha_9, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_9, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_7, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_7, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_5, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_5, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_3, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_3, vx21, vp1);
+
+    vp0 = vmlaq_f32(valpha_1, vx20, vp0);
+    vp1 = vmlaq_f32(valpha_1, vx21, vp1);
+
+    vp0 = vmulq_f32(vx0, vp0);
+    vp1 = vmulq_f32(vx1, vp1);
+
+    float32x4_t vq0 = vmlaq_f32(vbeta_4, vx20, vbeta_6);
+    float32x4_t vq1 = vmlaq_f32(vbeta_4, vx21, vbeta_6);
+
+    vq0 = vmlaq_f32(vbeta_2, vx20, vq0);
+    vq1 = vmlaq_f32(vbeta_2, vx21, vq1);
+
+    vq0 = vmlaq_f32(vbeta_0, vx20, vq0);
+    vq1 = vmlaq_f32(vbeta_0, vx21, vq1);
+
+    float32x4_t vrq0 = vrecpeq_f32(vq0);
+    float32x4_t vrq1 = vrecpeq_f32(vq1);
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    vrq0 = vmulq_f32(vrq0, vrecpsq_f32(vrq0, vq0));
+    vrq1 = vmulq_f32(vrq1, vrecpsq_f32(vrq1, vq1));
+
+    const float32x4_t vy0 = vmulq_f32(vp0, vrq0);
+    const float32x4_t vy1 = vmulq_f32(vp1, vrq1);
+
+    vst1q_f32(output, vy0);
+    vst1q_f32(output + 4, vy1);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    float32x4_t vx = vld1q_f32(input);
+    input += 4;
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vx2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vx2, vp);
+    vp = vmlaq_f32(valpha_7, vx2, vp);
+    vp = vmlaq_f32(valpha_5, vx2, vp);
+    vp = vmlaq_f32(valpha_3, vx2, vp);
+    vp = vmlaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vx2, vq);
+    vq = vmlaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    vst1q_f32(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    float32x4_t vx = vld1q_f32(input);
+
+    vx = vmaxq_f32(vx, vneg_sat_cutoff);
+    vx = vminq_f32(vx, vsat_cutoff);
+
+    const float32x4_t vx2 = vmulq_f32(vx, vx);
+
+    float32x4_t vp = vmlaq_f32(valpha_11, vx2, valpha_13);
+    vp = vmlaq_f32(valpha_9, vx2, vp);
+    vp = vmlaq_f32(valpha_7, vx2, vp);
+    vp = vmlaq_f32(valpha_5, vx2, vp);
+    vp = vmlaq_f32(valpha_3, vx2, vp);
+    vp = vmlaq_f32(valpha_1, vx2, vp);
+    vp = vmulq_f32(vx, vp);
+
+    float32x4_t vq = vmlaq_f32(vbeta_4, vx2, vbeta_6);
+    vq = vmlaq_f32(vbeta_2, vx2, vq);
+    vq = vmlaq_f32(vbeta_0, vx2, vq);
+
+    float32x4_t vrq = vrecpeq_f32(vq);
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    vrq = vmulq_f32(vrq, vrecpsq_f32(vrq, vq));
+    const float32x4_t vy = vmulq_f32(vp, vrq);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
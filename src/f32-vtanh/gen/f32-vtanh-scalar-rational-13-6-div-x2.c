@@ -0,0 +1,122 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/scalar-rational-13-6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x2(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const float vneg_sat_cutoff = -0x1.F9F09Ep+2f;
+  const float vsat_cutoff = 0x1.F9F09Ep+2f;
+  const float valpha_13 = -0x1.3E4B80p-52f;
+  const float valpha_11 = 0x1.C266FCp-43f;
+  const float valpha_9 = -0x1.7A6FFEp-34f;
+  const float valpha_7 = 0x1.B80082p-25f;
+  const float valpha_5 = 0x1.F28694p-17f;
+  const float valpha_3 = 0x1.4E1BDAp-11f;
+  const float valpha_1 = 0x1.40B3B8p-8f;
+  const float vbeta_6 = 0x1.41A7B0p-20f;
+  const float vbeta_4 = 0x1.F12BACp-14f;
+  const float vbeta_2 = 0x1.29540Ap-9f;
+  const float vbeta_0 = 0x1.40B3BAp-8f;
+
+  for (; batch >= 2 * sizeof(float); batch -= 2 * sizeof(float)) {
+    float vx0 = input[0];
+    float vx1 = input[1];
+    input += 2;
+
+    vx0 = math_max_f32(vx0, vneg_sat_cutoff);
+    vx1 = math_max_f32(vx1, vneg_sat_cutoff);
+
+    vx0 = math_min_f32(vx0, vsat_cutoff);
+    vx1 = math_min_f32(vx1, vsat_cutoff);
+
+    const float vx20 = vx0 * vx0;
+    const float vx21 = vx1 * vx1;
+
+    float vp0 = vx20 * valpha_13 + valpha_11;
+    float vp1 = vx21 * valpha_13 + valpha_11;
+
+    vp0 = vx20 * vp0 + valpha_9;
+    vp1 = vx21 * vp1 + valpha_9;
+
+    vp0 = vx20 * vp0 + valpha_7;
+    vp1 = vx21 * vp1 + valpha_7;
+
+    vp0 = vx20 * vp0 + valpha_5;
+    vp1 = vx21 * vp1 + valpha_5;
+
+    vp0 = vx20 * vp0 + valpha_3;
+    vp1 = vx21 * vp1 + valpha_3;
+
+    vp0 = vx20 * vp0 + valpha_1;
+    vp1 = vx21 * vp1 + valpha_1;
+
+    vp0 = vx0 * vp0;
+    vp1 = vx1 * vp1;
+
+    float vq0 = vx20 * vbeta_6 + vbeta_4;
+    float vq1 = vx21 * vbeta_6 + vbeta_4;
+
+    vq0 = vx20 * vq0 + vbeta_2;
+    vq1 = vx21 * vq1 + vbeta_2;
+
+    vq0 = vx20 * vq0 + vbeta_0;
+    vq1 = vx21 * vq1 + vbeta_0;
+
+    const float vy0 = vp0 / vq0;
+    const float vy1 = vp1 / vq1;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output += 2;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      float vx = *input++;
+
+      vx = math_max_f32(vx, vneg_sat_cutoff);
+      vx = math_min_f32(vx, vsat_cutoff);
+
+      const float vx2 = vx * vx;
+
+      float vp = vx2 * valpha_13 + valpha_11;
+      vp = vx2 * vp + valpha_9;
+      vp = vx2 * vp + valpha_7;
+      vp = vx2 * vp + valpha_5;
+      vp = vx2 * vp + valpha_3;
+      vp = vx2 * vp + valpha_1;
+      vp = vx * vp;
+
+      float vq = vx2 * vbeta_6 + vbeta_4;
+      vq = vx2 * vq + vbeta_2;
+      vq = vx2 * vq + vbeta_0;
+
+      const float vy = vp / vq;
+
+      *output++ = vy;
+
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
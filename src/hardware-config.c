@@ -108,6 +108,22 @@ static void init_hardware_config(void) {
     }
   #endif
 
+  // Conservative defaults for platforms where the cache hierarchy can not be detected.
+  hardware_config.l1_data_cache_bytes = 32 * 1024;
+  hardware_config.l2_cache_bytes = 256 * 1024;
+  #if !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV && !(XNN_ARCH_ARM64 && XNN_PLATFORM_WINDOWS)
+    const struct cpuinfo_cache* l1d_cache = cpuinfo_get_l1d_cache(0);
+    if (l1d_cache != NULL && l1d_cache->size != 0) {
+      hardware_config.l1_data_cache_bytes = l1d_cache->size;
+    }
+    const struct cpuinfo_cache* l2_cache = cpuinfo_get_l2_cache(0);
+    if (l2_cache != NULL && l2_cache->size != 0) {
+      hardware_config.l2_cache_bytes = l2_cache->size;
+    }
+  #endif  // !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV && !(XNN_ARCH_ARM64 && XNN_PLATFORM_WINDOWS)
+  xnn_log_debug("L1 data cache: %zu bytes, L2 cache: %zu bytes",
+    hardware_config.l1_data_cache_bytes, hardware_config.l2_cache_bytes);
+
   #if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
     // Unlike most other architectures, on x86/x86-64 when floating-point instructions
     // have no NaN arguments, but produce NaN output, the output NaN has sign bit set.
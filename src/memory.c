@@ -22,8 +22,12 @@
 #include <unistd.h>
 #endif
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
@@ -55,10 +59,55 @@ static size_t get_page_size() {
   return system_page_size;
 }
 
-// Maps `size` bytes of memory, returns pointer to allocation, NULL if failed.
-static void* allocate_buffer(size_t size) {
+// Size of explicit huge pages if the system doesn't report it, 2MB.
+#define XNN_DEFAULT_HUGE_PAGE_SIZE 2097152
+
+static size_t system_huge_page_size = 0;
+
+static size_t get_huge_page_size() {
+  if (system_huge_page_size == 0) {
+    system_huge_page_size = XNN_DEFAULT_HUGE_PAGE_SIZE;
+    #if XNN_PLATFORM_LINUX
+      FILE* meminfo = fopen("/proc/meminfo", "r");
+      if (meminfo != NULL) {
+        char line[256];
+        while (fgets(line, sizeof(line), meminfo) != NULL) {
+          unsigned long huge_page_kilobytes = 0;
+          if (sscanf(line, "Hugepagesize: %lu kB", &huge_page_kilobytes) == 1 && huge_page_kilobytes != 0) {
+            system_huge_page_size = (size_t) huge_page_kilobytes * 1024;
+            break;
+          }
+        }
+        fclose(meminfo);
+      }
+    #endif
+  }
+  assert(is_po2(system_huge_page_size));
+  return system_huge_page_size;
+}
+
+// Size of pages of a buffer, which is mapped with explicit huge pages if `hugetlb` is true.
+static size_t get_buffer_page_size(bool hugetlb) {
+  return hugetlb ? get_huge_page_size() : get_page_size();
+}
+
+// Faults in pages of newly mapped memory by writing to them.
+static void prefault_memory(void* start, size_t size) {
+  const size_t page_size = get_page_size();
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    ((volatile uint8_t*) start)[offset] = 0;
+  }
+}
+
+// Maps `size` bytes of memory with memory policy `flags`, returns pointer to allocation, NULL if failed. Writes the
+// size of the mapping, which is rounded up to the huge page size for explicit huge pages, to `capacity_out`, and whether
+// the mapping is backed by explicit huge pages to `hugetlb_out`.
+static void* allocate_buffer(size_t size, uint32_t flags, size_t* capacity_out, bool* hugetlb_out) {
   xnn_log_debug("allocating buffer of size %zu", size);
   assert(size % get_page_size() == 0);
+  *capacity_out = size;
+  *hugetlb_out = false;
+  bool populated = false;
 #if XNN_PLATFORM_WINDOWS
   void* p = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
   if (p == NULL) {
@@ -68,15 +117,45 @@ static void* allocate_buffer(size_t size) {
   }
 #else
   #if XNN_PLATFORM_QURT
-    void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    int map_flags = MAP_PRIVATE | MAP_ANON;
   #else
-    void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    int map_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+  #endif
+  #if XNN_PLATFORM_LINUX
+    if (flags & XNN_FLAG_HUGE_PAGES) {
+      const size_t huge_page_aligned_size = round_up_po2(size, get_huge_page_size());
+      const int huge_page_map_flags = map_flags | MAP_HUGETLB | (flags & XNN_FLAG_PREFAULT_MEMORY ? MAP_POPULATE : 0);
+      void* p = mmap(NULL, huge_page_aligned_size, PROT_READ | PROT_WRITE, huge_page_map_flags, -1, 0);
+      if (p != MAP_FAILED) {
+        *capacity_out = huge_page_aligned_size;
+        *hugetlb_out = true;
+        return p;
+      }
+      xnn_log_info("failed to allocate %zu bytes of huge pages, error code: %d, falling back to regular pages",
+                   huge_page_aligned_size, errno);
+    }
+    // Transparent huge pages are requested after mapping, so such mappings are pre-faulted only after the request.
+    if ((flags & (XNN_FLAG_PREFAULT_MEMORY | XNN_FLAG_TRANSPARENT_HUGE_PAGES)) == XNN_FLAG_PREFAULT_MEMORY) {
+      map_flags |= MAP_POPULATE;
+      populated = true;
+    }
   #endif
+  void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, map_flags, -1, 0);
   if (p == MAP_FAILED) {
     xnn_log_error("failed to allocate %zu bytes for code/weights buffer, error code: %d", size, errno);
     return NULL;
   }
+  #if XNN_PLATFORM_LINUX
+    if (flags & XNN_FLAG_TRANSPARENT_HUGE_PAGES) {
+      if (madvise(p, size, MADV_HUGEPAGE) == -1) {
+        xnn_log_info("failed to advise transparent huge pages for %zu bytes, error code: %d", size, errno);
+      }
+    }
+  #endif
 #endif
+  if ((flags & XNN_FLAG_PREFAULT_MEMORY) && !populated) {
+    prefault_memory(p, size);
+  }
   return p;
 }
 
@@ -100,33 +179,44 @@ static enum xnn_status release_memory(void* start, size_t capacity) {
 // Resize a buffer at old_pointer of size old_bytes to new_size. The actual new size of the resized buffer is written to
 // new_capacity_out, which can be >= new_size due to page alignment requirements.
 // Returns a pointer to a buffer which might be the same as old_pointer if we can remap virtual memory, otherwise we
-// allocate a new buffer and copy contents of old_buffer over.
+// allocate a new buffer with memory policy `flags` and copy contents of old_buffer over. `hugetlb` specifies whether
+// the old buffer is backed by explicit huge pages, and is updated for the new buffer.
 static void* resize_buffer(
-  void* old_pointer, size_t old_size, size_t old_capacity, size_t new_size, size_t* new_capacity_out)
+  void* old_pointer, size_t old_size, size_t old_capacity, size_t new_size, uint32_t flags,
+  size_t* new_capacity_out, bool* hugetlb)
 {
-  const size_t new_capacity = round_up_po2(new_size, get_page_size());
+  size_t new_capacity = round_up_po2(new_size, get_page_size());
   #if XNN_PLATFORM_LINUX
-    void* new_pointer = mremap(old_pointer, old_size, new_capacity, MREMAP_MAYMOVE, NULL);
-    if (new_pointer == MAP_FAILED) {
-      xnn_log_error("mremap failed with errno: %d", errno);
-      return NULL;
-    }
-    xnn_log_debug("resize_buffer: remap, old capacity %zu to new capacity %zu", old_capacity, new_capacity);
-  #else
-    void* new_pointer = allocate_buffer(new_capacity);
-    if (new_pointer == NULL) {
-      xnn_log_error("allocate_buffer failed");
-      return NULL;
-    }
-    memcpy(new_pointer, old_pointer, old_size);
-    // Release old code_buffer.
-    const enum xnn_status status = release_memory(old_pointer, old_capacity);
-    if (status != xnn_status_success) {
-      xnn_log_error("releasing old buffer failed, this could be a leak of %zu bytes", old_capacity);
-      // Log but proceed as per normal since we successfully allocated a new memory that can be used by the caller.
+    // Mappings of explicit huge pages are copied rather than remapped, as not all kernels can grow them.
+    if (!*hugetlb) {
+      void* new_pointer = mremap(old_pointer, old_size, new_capacity, MREMAP_MAYMOVE, NULL);
+      if (new_pointer == MAP_FAILED) {
+        xnn_log_error("mremap failed with errno: %d", errno);
+        return NULL;
+      }
+      xnn_log_debug("resize_buffer: remap, old capacity %zu to new capacity %zu", old_capacity, new_capacity);
+      if (flags & XNN_FLAG_PREFAULT_MEMORY) {
+        const size_t remapped_size = round_up_po2(old_size, get_page_size());
+        prefault_memory((void*) ((uintptr_t) new_pointer + remapped_size), new_capacity - remapped_size);
+      }
+      *new_capacity_out = new_capacity;
+      return new_pointer;
     }
-    xnn_log_debug("resize_buffer: allocate memory, old capacity %zu to new capacity %zu", old_capacity, new_capacity);
   #endif
+
+  void* new_pointer = allocate_buffer(new_capacity, flags, &new_capacity, hugetlb);
+  if (new_pointer == NULL) {
+    xnn_log_error("allocate_buffer failed");
+    return NULL;
+  }
+  memcpy(new_pointer, old_pointer, old_size);
+  // Release old code_buffer.
+  const enum xnn_status status = release_memory(old_pointer, old_capacity);
+  if (status != xnn_status_success) {
+    xnn_log_error("releasing old buffer failed, this could be a leak of %zu bytes", old_capacity);
+    // Log but proceed as per normal since we successfully allocated a new memory that can be used by the caller.
+  }
+  xnn_log_debug("resize_buffer: allocate memory, old capacity %zu to new capacity %zu", old_capacity, new_capacity);
   *new_capacity_out = new_capacity;
   return new_pointer;
 }
@@ -134,20 +224,20 @@ static void* resize_buffer(
 enum xnn_status xnn_allocate_code_memory(struct xnn_code_buffer* buffer, size_t size) {
   memset(buffer, 0, sizeof(struct xnn_code_buffer));
   const size_t page_aligned_size = round_up_po2(size, get_page_size());
-  buffer->start = allocate_buffer(page_aligned_size);
+  bool hugetlb = false;
+  buffer->start = allocate_buffer(page_aligned_size, /*flags=*/0, &buffer->capacity, &hugetlb);
   if (buffer->start == NULL) {
     return xnn_status_out_of_memory;
   }
 
   buffer->size = 0;
-  buffer->capacity = page_aligned_size;
   return xnn_status_success;
 }
 
-// Releases unused memory. Will write the new capacity to `capacity`.
-static enum xnn_status release_unused_memory(size_t size, void* start, size_t* capacity) {
+// Releases unused memory of a buffer with pages of `page_size` bytes. Will write the new capacity to `capacity`.
+static enum xnn_status release_unused_memory(size_t size, void* start, size_t* capacity, size_t page_size) {
   // Release all unused pages.
-  const size_t page_aligned_size = round_up_po2(size, get_page_size());
+  const size_t page_aligned_size = round_up_po2(size, page_size);
   const uint8_t* mem_start = (uint8_t*) start;
   const uint8_t* unused_start = mem_start + page_aligned_size;
   assert(*capacity >= page_aligned_size);
@@ -235,7 +325,7 @@ static enum xnn_status set_memory_permission(void* start, size_t size, enum xnn_
 
 #if XNN_PLATFORM_JIT
 enum xnn_status xnn_finalize_code_memory(struct xnn_code_buffer* buffer) {
-  const enum xnn_status status = release_unused_memory(buffer->size, buffer->start, &buffer->capacity);
+  const enum xnn_status status = release_unused_memory(buffer->size, buffer->start, &buffer->capacity, get_page_size());
   if (status != xnn_status_success) {
     return status;
   }
@@ -290,8 +380,10 @@ enum xnn_status xnn_reserve_code_memory(struct xnn_code_buffer* buffer, size_t m
   xnn_log_debug("reserving code memory of size %zu", min_available_size);
 
   size_t new_capacity = 0;
-  void* new_start =
-    resize_buffer(buffer->start, buffer->size, buffer->capacity, buffer->size + min_available_size, &new_capacity);
+  bool hugetlb = false;
+  void* new_start = resize_buffer(
+    buffer->start, buffer->size, buffer->capacity, buffer->size + min_available_size, /*flags=*/0, &new_capacity,
+    &hugetlb);
   if (new_start == NULL) {
     xnn_log_error("failed to reserve code memory");
     return xnn_status_out_of_memory;
@@ -301,16 +393,16 @@ enum xnn_status xnn_reserve_code_memory(struct xnn_code_buffer* buffer, size_t m
   return xnn_status_success;
 }
 
-enum xnn_status xnn_allocate_weights_memory(struct xnn_weights_buffer* buffer, size_t size) {
+enum xnn_status xnn_allocate_weights_memory(struct xnn_weights_buffer* buffer, size_t size, uint32_t flags) {
   memset(buffer, 0, sizeof(struct xnn_weights_buffer));
   const size_t page_aligned_size = round_up_po2(size, get_page_size());
-  buffer->start = allocate_buffer(page_aligned_size);
+  buffer->start = allocate_buffer(page_aligned_size, flags, &buffer->capacity, &buffer->hugetlb);
   if (buffer->start == NULL) {
     return xnn_status_out_of_memory;
   }
 
   buffer->size = 0;
-  buffer->capacity = page_aligned_size;
+  buffer->flags = flags;
   return xnn_status_success;
 }
 
@@ -322,7 +414,7 @@ enum xnn_status xnn_release_weights_memory(struct xnn_weights_buffer* buffer) {
   if (status != xnn_status_success) {
     return status;
   }
-  memset(buffer, 0, sizeof(struct xnn_code_buffer));
+  memset(buffer, 0, sizeof(struct xnn_weights_buffer));
   return xnn_status_success;
 }
 
@@ -333,8 +425,9 @@ enum xnn_status xnn_reserve_weights_memory(struct xnn_weights_buffer* buffer, si
   }
 
   size_t new_capacity = 0;
-  void* new_start =
-    resize_buffer(buffer->start, buffer->size, buffer->capacity, buffer->size + min_available_size, &new_capacity);
+  void* new_start = resize_buffer(
+    buffer->start, buffer->size, buffer->capacity, buffer->size + min_available_size, buffer->flags, &new_capacity,
+    &buffer->hugetlb);
   if (new_start == NULL) {
     xnn_log_error("failed to reserve weights memory");
     return xnn_status_out_of_memory;
@@ -346,7 +439,8 @@ enum xnn_status xnn_reserve_weights_memory(struct xnn_weights_buffer* buffer, si
 }
 
 enum xnn_status xnn_finalize_weights_memory(struct xnn_weights_buffer* buffer) {
-  const enum xnn_status status = release_unused_memory(buffer->size, buffer->start, &buffer->capacity);
+  const size_t page_size = get_buffer_page_size(buffer->hugetlb);
+  const enum xnn_status status = release_unused_memory(buffer->size, buffer->start, &buffer->capacity, page_size);
   if (status != xnn_status_success) {
     return status;
   }
@@ -355,5 +449,55 @@ enum xnn_status xnn_finalize_weights_memory(struct xnn_weights_buffer* buffer) {
     return xnn_status_success;
   }
 
-  return set_memory_permission(buffer->start, buffer->size, xnn_memory_permission_read_only);
+  // Protection of explicit huge pages can only change for whole pages.
+  return set_memory_permission(
+    buffer->start, round_up_po2(buffer->size, page_size), xnn_memory_permission_read_only);
+}
+
+size_t xnn_get_weights_memory_huge_page_size(const struct xnn_weights_buffer* buffer) {
+  return xnn_get_mapped_memory_huge_page_size(buffer->start, buffer->capacity, buffer->hugetlb);
+}
+
+void* xnn_allocate_mapped_memory(size_t size, uint32_t flags, size_t* capacity_out, bool* hugetlb_out) {
+  return allocate_buffer(round_up_po2(size, get_page_size()), flags, capacity_out, hugetlb_out);
+}
+
+enum xnn_status xnn_release_mapped_memory(void* start, size_t capacity) {
+  if (capacity == 0) {
+    return xnn_status_success;
+  }
+  return release_memory(start, capacity);
+}
+
+size_t xnn_get_mapped_memory_huge_page_size(const void* start, size_t capacity, bool hugetlb) {
+  if (hugetlb) {
+    return capacity;
+  }
+
+  size_t huge_page_size = 0;
+  #if XNN_PLATFORM_LINUX
+    // Sum the transparent huge pages of all mappings that overlap the memory.
+    FILE* smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == NULL) {
+      xnn_log_warning("failed to open /proc/self/smaps, error code: %d", errno);
+      return 0;
+    }
+    const uintptr_t memory_start = (uintptr_t) start;
+    const uintptr_t memory_end = memory_start + capacity;
+    bool overlaps = false;
+    char line[512];
+    while (fgets(line, sizeof(line), smaps) != NULL) {
+      uintptr_t mapping_start = 0;
+      uintptr_t mapping_end = 0;
+      unsigned long huge_page_kilobytes = 0;
+      if (sscanf(line, "%" SCNxPTR "-%" SCNxPTR, &mapping_start, &mapping_end) == 2) {
+        overlaps = mapping_start < memory_end && memory_start < mapping_end;
+      } else if (overlaps && sscanf(line, "AnonHugePages: %lu kB", &huge_page_kilobytes) == 1) {
+        huge_page_size += (size_t) huge_page_kilobytes * 1024;
+      }
+    }
+    fclose(smaps);
+  #endif
+  // Mappings that extend beyond the memory can be counted in full, but not more than the memory itself.
+  return min(huge_page_size, capacity);
 }
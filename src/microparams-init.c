@@ -3306,6 +3306,69 @@ size_t xnn_init_f32_lrelu_wasmsimd_params(
 }
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
+size_t xnn_init_f32_scale_scalar_params(
+  union xnn_f32_scale_params params[XNN_MIN_ELEMENTS(1)],
+  float scale)
+{
+  params->scalar.scale = scale;
+  return sizeof(params->scalar);
+}
+
+size_t xnn_init_f16_rnorm_scalar_params(
+  union xnn_f16_rnorm_params params[XNN_MIN_ELEMENTS(1)],
+  float epsilon,
+  bool subtract_mean)
+{
+  assert(epsilon >= 0.0f);
+
+  params->scalar.epsilon = epsilon;
+  params->scalar.subtract_mean = (uint32_t) subtract_mean;
+  return sizeof(params->scalar);
+}
+
+size_t xnn_init_f32_rnorm_scalar_params(
+  union xnn_f32_rnorm_params params[XNN_MIN_ELEMENTS(1)],
+  float epsilon,
+  bool subtract_mean)
+{
+  assert(epsilon >= 0.0f);
+
+  params->scalar.epsilon = epsilon;
+  params->scalar.subtract_mean = (uint32_t) subtract_mean;
+  return sizeof(params->scalar);
+}
+
+size_t xnn_init_qs8_rnorm_scalar_params(
+  union xnn_qs8_rnorm_params params[XNN_MIN_ELEMENTS(1)],
+  float epsilon,
+  bool subtract_mean,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(epsilon >= 0.0f);
+  assert(input_scale > 0.0f);
+  assert(output_scale > 0.0f);
+  assert(output_min < output_max);
+
+  // Statistics are computed on the zero-point-adjusted integer input, so epsilon is rescaled to the same domain.
+  params->scalar.epsilon = epsilon / (input_scale * input_scale);
+  params->scalar.subtract_mean = (uint32_t) subtract_mean;
+  params->scalar.input_zero_point = (int32_t) input_zero_point;
+  params->scalar.inv_output_scale = 1.0f / output_scale;
+  params->scalar.output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  params->scalar.output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  params->scalar.magic_bias = 12582912.0f;
+  params->scalar.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+  params->scalar.output_zero_point = (int32_t) output_zero_point;
+  params->scalar.output_min = (int32_t) output_min;
+  params->scalar.output_max = (int32_t) output_max;
+  return sizeof(params->scalar);
+}
+
 size_t xnn_init_qs8_lrelu_scalar_select_params(
   union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)],
   float positive_scale,
@@ -3837,6 +3900,66 @@ size_t xnn_init_qu8_lrelu_wasmsimd_x86_params(
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+size_t xnn_init_f32_tanh_avx_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx.mask_table[i] = 0;
+  }
+  return sizeof(params->avx);
+}
+
+size_t xnn_init_f32_gelu_avx_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx.mask_table[i] = 0;
+  }
+  return sizeof(params->avx);
+}
+
+size_t xnn_init_f32_approxgelu_avx_params(
+  union xnn_f32_approxgelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx.mask_table[i] = 0;
+  }
+  return sizeof(params->avx);
+}
+
+size_t xnn_init_f32_silu_avx_params(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx.mask_table[i] = 0;
+  }
+  return sizeof(params->avx);
+}
+
+size_t xnn_init_f32_exp_avx_params(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx.mask_table[i] = 0;
+  }
+  return sizeof(params->avx);
+}
+
 size_t xnn_init_f32_sqrt_avx_params(
   union xnn_f32_sqrt_params params[XNN_MIN_ELEMENTS(1)])
 {
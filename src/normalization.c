@@ -250,3 +250,42 @@ void xnn_normalize_transpose_permutation(
   *normalized_element_size_out = normalized_element_size;
   *normalized_num_dims = output_dims;
 }
+
+void xnn_normalize_reduction(
+    size_t* num_reduction_axes_ptr,
+    size_t* reduction_axes,
+    size_t* num_input_dims_ptr,
+    size_t* input_dims)
+{
+  const size_t num_reduction_axes = *num_reduction_axes_ptr;
+  const size_t num_input_dims = *num_input_dims_ptr;
+
+  bool is_reduction_axis[XNN_MAX_TENSOR_DIMS];
+  memset(is_reduction_axis, 0, sizeof(is_reduction_axis));
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    is_reduction_axis[reduction_axes[i]] = true;
+  }
+
+  // Drop dimensions of size 1 and merge runs of adjacent dimensions with the same reduction status.
+  size_t num_normalized_dims = 0;
+  size_t num_normalized_axes = 0;
+  for (size_t i = 0; i < num_input_dims; i++) {
+    if (input_dims[i] == 1) {
+      continue;
+    }
+    if (num_normalized_dims != 0 &&
+        is_reduction_axis[i] == (num_normalized_axes != 0 &&
+                                 reduction_axes[num_normalized_axes - 1] == num_normalized_dims - 1))
+    {
+      input_dims[num_normalized_dims - 1] *= input_dims[i];
+    } else {
+      if (is_reduction_axis[i]) {
+        reduction_axes[num_normalized_axes++] = num_normalized_dims;
+      }
+      input_dims[num_normalized_dims++] = input_dims[i];
+    }
+  }
+
+  *num_reduction_axes_ptr = num_normalized_axes;
+  *num_input_dims_ptr = num_normalized_dims;
+}
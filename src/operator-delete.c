@@ -6,6 +6,7 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <stdbool.h>
 #include <stdlib.h>
 
 #include <xnnpack.h>
@@ -26,17 +27,27 @@ enum xnn_status xnn_delete_operator(xnn_operator_t op)
     return xnn_status_invalid_parameter;
   }
 
-  xnn_release_memory(op->indirection_buffer);
+  const bool owns_metadata = op->arena == NULL;
+  if (op->indirection_cache_entry != NULL) {
+    xnn_release_indirection_cache_entry(op->indirection_cache, op->indirection_cache_entry);
+  } else if (owns_metadata) {
+    xnn_release_memory(op->indirection_buffer);
+  }
   if (op->weights_cache == NULL) {
     xnn_release_simd_memory(op->packed_weights.pointer);
   }
-  if (op->num_post_operation_params != 0) {
+  if (op->num_post_operation_params != 0 && owns_metadata) {
     xnn_release_memory(op->post_operation_params);
   }
   xnn_release_simd_memory(op->zero_buffer);
+  xnn_release_memory(op->workspace);
   xnn_release_memory(op->pixelwise_buffer);
-  xnn_release_memory(op->subconvolution_buffer);
+  if (owns_metadata) {
+    xnn_release_memory(op->subconvolution_buffer);
+  }
   xnn_release_simd_memory(op->lookup_table);
-  xnn_release_simd_memory(op);
+  if (owns_metadata) {
+    xnn_release_simd_memory(op);
+  }
   return xnn_status_success;
 }
@@ -7,6 +7,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -19,6 +20,7 @@
 #include <xnnpack/math.h>
 #include <xnnpack/microkernel-type.h>
 #include <xnnpack/params.h>
+#include <xnnpack/prefetch.h>
 #include <xnnpack/compute.h>
 
 
@@ -343,6 +345,144 @@ void xnn_compute_gemm(
       context->fused_params);
 }
 
+void xnn_compute_blocked_gemm(
+    const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  assert(nr_block_size <= XNN_BLOCKED_GEMM_MAX_NC);
+  assert(context->k_scaled > context->kc_scaled);
+
+  const size_t k_scaled = context->k_scaled;
+  const size_t kc_scaled = context->kc_scaled;
+  const size_t a_stride = context->a_stride;
+  const size_t cm_stride = context->cm_stride;
+  const size_t mr = context->mr;
+  const size_t partial_stride = nr_block_size * sizeof(float);
+  float partial[XNN_MAX_MR * XNN_BLOCKED_GEMM_MAX_NC];
+
+  uintptr_t packed_w_block = (uintptr_t) context->packed_w;
+  for (size_t k = 0; k < k_scaled; k += kc_scaled) {
+    const size_t kc = min(k_scaled - k, kc_scaled);
+    const bool last_block = k + kc == k_scaled;
+    const void* w = (const void*) (packed_w_block +
+      nr_block_start * (last_block ? context->w_stride_last : context->w_stride));
+    for (size_t m = 0; m < mr_block_size; m += mr) {
+      const size_t mr_size = min(mr_block_size - m, mr);
+      const void* a = (const void*) ((uintptr_t) context->a + (mr_block_start + m) * a_stride + k);
+      float* c = (float*) ((uintptr_t) context->c + (mr_block_start + m) * cm_stride + nr_block_start * sizeof(float));
+      if (k == 0) {
+        context->ukernel(
+            mr_size, nr_block_size, kc, a, a_stride, w, c, cm_stride, context->cn_stride, &context->gemm_params);
+      } else {
+        context->ukernel(
+            mr_size, nr_block_size, kc, a, a_stride, w, partial, partial_stride, context->cn_stride,
+            &context->gemm_params);
+        const void* add_params = last_block ? &context->output_params : &context->add_params;
+        for (size_t i = 0; i < mr_size; i++) {
+          float* c_row = (float*) ((uintptr_t) c + i * cm_stride);
+          context->vadd(partial_stride, c_row, &partial[i * nr_block_size], c_row, add_params);
+        }
+      }
+    }
+    packed_w_block += context->wk_stride;
+  }
+}
+
+void xnn_compute_splitk_gemv(
+    const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t k_block_index,
+    size_t nr_block_start,
+    size_t nr_block_size)
+{
+  const size_t k = k_block_index * context->kc_scaled;
+  const size_t kc = min(context->k_scaled - k, context->kc_scaled);
+  const size_t w_stride = k + kc == context->k_scaled ? context->w_stride_last : context->w_stride;
+
+  context->ukernel(
+      1, nr_block_size, kc,
+      (const void*) ((uintptr_t) context->a + k),
+      context->a_stride,
+      (const void*) ((uintptr_t) context->packed_w + k_block_index * context->wk_stride + nr_block_start * w_stride),
+      (void*) ((uintptr_t) context->workspace + k_block_index * context->workspace_stride + nr_block_start * sizeof(float)),
+      context->workspace_stride,
+      context->cn_stride,
+      &context->gemm_params);
+}
+
+void xnn_compute_splitk_gemv_reduce(
+    const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t nr_block_start,
+    size_t nr_block_size)
+{
+  const size_t num_k_blocks = context->num_k_blocks;
+  const size_t workspace_stride = context->workspace_stride;
+  const size_t n = nr_block_size * sizeof(float);
+  assert(num_k_blocks >= 2);
+
+  const float* partial = context->workspace + nr_block_start;
+  float* c = context->c + nr_block_start;
+  context->vadd(
+      n, partial, (const float*) ((uintptr_t) partial + workspace_stride), c,
+      num_k_blocks == 2 ? &context->output_params : &context->add_params);
+  for (size_t k_block_index = 2; k_block_index < num_k_blocks; k_block_index++) {
+    context->vadd(
+        n, c, (const float*) ((uintptr_t) partial + k_block_index * workspace_stride), c,
+        k_block_index + 1 == num_k_blocks ? &context->output_params : &context->add_params);
+  }
+}
+
+void xnn_compute_qd8_quantize(
+    const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const float* input = (const float*) ((uintptr_t) context->input + batch_index * context->input_stride);
+  int8_t* a = (int8_t*) ((uintptr_t) context->a + batch_index * context->a_stride);
+
+  // The quantized range always includes zero, so that zero (e.g. padding) is represented exactly.
+  float minmax[2] = { 0.0f, 0.0f };
+  context->rminmax_ukernel(context->input_size, input, minmax, &context->rminmax_params);
+
+  float scale = (minmax[1] - minmax[0]) / 255.0f;
+  if (scale == 0.0f || !isfinite(scale)) {
+    scale = 1.0f;
+  }
+  const int32_t zero_point = math_max_s32(math_min_s32((int32_t) lrintf(-128.0f - minmax[0] / scale), INT8_MAX), INT8_MIN);
+
+  union xnn_f32_qs8_cvt_params cvt_params;
+  context->init_cvt_params(&cvt_params, 1.0f / scale, (int8_t) zero_point, INT8_MIN, INT8_MAX);
+  context->cvt_ukernel(context->input_size, input, a, &cvt_params);
+
+  context->quantization_params[batch_index].zero_point = zero_point;
+  context->quantization_params[batch_index].scale = scale;
+}
+
+void xnn_compute_qd8_gemm(
+    const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t a_stride  = context->a_stride;
+  const size_t cm_stride = context->cm_stride;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      context->k_scaled,
+      (const int8_t*) ((uintptr_t) context->a + mr_block_start * a_stride),
+      a_stride,
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+      (float*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start * sizeof(float))),
+      cm_stride,
+      context->cn_stride,
+      &context->params,
+      &context->quantization_params[mr_block_start]);
+}
+
 void xnn_compute_spmm(
     const struct spmm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -966,6 +1106,163 @@ void xnn_compute_prelu(
   context->ukernel(batch_range, context->n, x, x_stride, context->w, y, y_stride);
 }
 
+void xnn_compute_rnorm(
+    const struct rnorm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const void* x = (const void*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  void* y = (void*) ((uintptr_t) context->y + context->y_stride * batch_index);
+
+  context->ukernel(context->n, x, context->w, y, &context->params);
+}
+
+static void fill_reduce_output(
+    void* output,
+    size_t count,
+    uint32_t identity)
+{
+  uint32_t* o = (uint32_t*) output;
+  do {
+    *o++ = identity;
+  } while (--count != 0);
+}
+
+void xnn_compute_contiguous_reduce(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t chunk_index,
+    size_t output_idx0,
+    size_t output_idx1,
+    size_t output_idx2,
+    size_t output1_block_size,
+    size_t output2_block_size)
+{
+  assert(context->log2_element_size == 2);
+
+  // Input is laid out as [k0, r0, k1, r1, k2, r2], where r2 is contiguous and reduced by the micro-kernel.
+  const size_t* input_shape = context->input_shape;
+  const size_t* input_stride = context->input_stride;
+  const uint32_t log2_element_size = context->log2_element_size;
+  const size_t reduction_start = chunk_index * context->reduction_chunk_size;
+  const size_t reduction_size = min(context->reduction_chunk_size, input_shape[5] - reduction_start);
+
+  void* output = context->output;
+  if (context->workspace != NULL) {
+    output = (void*) ((uintptr_t) context->workspace + chunk_index * context->workspace_stride);
+  }
+  output = (void*) ((uintptr_t) output + output_idx0 * context->output_stride[0] + (output_idx2 << log2_element_size));
+  const void* input = (const void*) ((uintptr_t) context->input +
+    output_idx0 * input_stride[0] + output_idx2 * input_stride[4] + (reduction_start << log2_element_size));
+
+  for (size_t j = 0; j < output1_block_size; j++) {
+    void* o = (void*) ((uintptr_t) output + (output_idx1 + j) * context->output_stride[1]);
+    const void* i = (const void*) ((uintptr_t) input + (output_idx1 + j) * input_stride[2]);
+    fill_reduce_output(o, output2_block_size, context->identity);
+    for (size_t k = 0; k < output2_block_size; k++) {
+      for (size_t r0 = 0; r0 < input_shape[1]; r0++) {
+        for (size_t r1 = 0; r1 < input_shape[3]; r1++) {
+          context->ukernel.contiguous(
+            reduction_size << log2_element_size,
+            (const void*) ((uintptr_t) i + r0 * input_stride[1] + r1 * input_stride[3]),
+            o, &context->params);
+        }
+      }
+      i = (const void*) ((uintptr_t) i + input_stride[4]);
+      o = (void*) ((uintptr_t) o + ((size_t) 1 << log2_element_size));
+    }
+    if (context->workspace == NULL && context->finalize_ukernel != NULL) {
+      o = (void*) ((uintptr_t) output + (output_idx1 + j) * context->output_stride[1]);
+      context->finalize_ukernel(output2_block_size << log2_element_size, o, o, &context->finalize_params);
+    }
+  }
+}
+
+void xnn_compute_discontiguous_reduce(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t chunk_index,
+    size_t output_idx0,
+    size_t output_idx1,
+    size_t output_idx2,
+    size_t output1_block_size,
+    size_t output2_block_size)
+{
+  assert(context->log2_element_size == 2);
+
+  // Input is laid out as [r0, k0, r1, k1, r2, k2], where k2 is contiguous and r2 is reduced by the micro-kernel.
+  const size_t* input_shape = context->input_shape;
+  const size_t* input_stride = context->input_stride;
+  const uint32_t log2_element_size = context->log2_element_size;
+  const size_t reduction_start = chunk_index * context->reduction_chunk_size;
+  const size_t reduction_size = min(context->reduction_chunk_size, input_shape[4] - reduction_start);
+
+  void* output = context->output;
+  if (context->workspace != NULL) {
+    output = (void*) ((uintptr_t) context->workspace + chunk_index * context->workspace_stride);
+  }
+  output = (void*) ((uintptr_t) output + output_idx0 * context->output_stride[0] + (output_idx2 << log2_element_size));
+  const void* input = (const void*) ((uintptr_t) context->input +
+    output_idx0 * input_stride[1] + reduction_start * input_stride[4] + (output_idx2 << log2_element_size));
+
+  for (size_t j = 0; j < output1_block_size; j++) {
+    void* o = (void*) ((uintptr_t) output + (output_idx1 + j) * context->output_stride[1]);
+    const void* i = (const void*) ((uintptr_t) input + (output_idx1 + j) * input_stride[3]);
+    fill_reduce_output(o, output2_block_size, context->identity);
+    for (size_t r0 = 0; r0 < input_shape[0]; r0++) {
+      for (size_t r1 = 0; r1 < input_shape[2]; r1++) {
+        context->ukernel.discontiguous(
+          reduction_size, output2_block_size,
+          (const void*) ((uintptr_t) i + r0 * input_stride[0] + r1 * input_stride[2]), input_stride[4],
+          o, &context->params);
+      }
+    }
+    if (context->workspace == NULL && context->finalize_ukernel != NULL) {
+      context->finalize_ukernel(output2_block_size << log2_element_size, o, o, &context->finalize_params);
+    }
+  }
+}
+
+void xnn_compute_reduce_combine(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t output_start,
+    size_t output_range)
+{
+  const size_t offset = output_start << context->log2_element_size;
+  void* output = (void*) ((uintptr_t) context->output + offset);
+  const void* workspace = (const void*) ((uintptr_t) context->workspace + offset);
+
+  fill_reduce_output(output, output_range, context->identity);
+  context->combine_ukernel(
+    context->num_chunks, output_range, workspace, context->workspace_stride, output, &context->combine_params);
+  if (context->finalize_ukernel != NULL) {
+    context->finalize_ukernel(output_range << context->log2_element_size, output, output, &context->finalize_params);
+  }
+}
+
+void xnn_compute_embedding(
+    const struct embedding_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t bag_start,
+    size_t bag_range)
+{
+  const size_t bag_size = context->bag_size;
+  const int32_t* indices = context->indices + bag_start * bag_size;
+  float* output = (float*) ((uintptr_t) context->output + bag_start * context->output_stride);
+  for (size_t b = 0; b < bag_range; b++) {
+    // Rows of the next bag are selected by indices which hardware prefetchers can not predict: request their first
+    // cache lines while the current bag is accumulated.
+    if (b + 1 < bag_range) {
+      const int32_t* next_indices = indices + bag_size;
+      for (size_t r = 0; r < bag_size; r++) {
+        const size_t offset = (size_t) next_indices[r] * context->table_stride;
+        xnn_prefetch_to_l1((const void*) ((uintptr_t) context->table + offset));
+      }
+    }
+    context->ukernel(
+      bag_size, context->channels, indices, context->table, context->table_stride, context->table_scale,
+      output, &context->params.f32);
+    indices += bag_size;
+    output = (float*) ((uintptr_t) output + context->output_stride);
+  }
+}
+
 void xnn_compute_pad_5d(
     const struct pad_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t i, size_t j, size_t k, size_t l, size_t m)
@@ -1432,244 +1729,255 @@ void xnn_compute_vmulcaddc(
 #endif  // XNN_MAX_UARCH_TYPES > 1
 
 
-enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
-{
-  return xnn_run_operator_with_index(op, 0, 0, threadpool);
-}
-
-enum xnn_status xnn_run_operator_with_index(
-  xnn_operator_t op,
-  size_t opdata_index,
-  size_t operator_object_index,
+static void run_compute(
+  const struct compute_parameters compute[restrict XNN_MIN_ELEMENTS(1)],
+  void* context,
+  uint32_t flags,
   pthreadpool_t threadpool)
 {
-  switch (op->state) {
-    case xnn_run_state_invalid:
-      xnn_log_error("failed to run operator: operator was not successfully setup");
-      return xnn_status_invalid_state;
-    case xnn_run_state_ready:
-      xnn_log_debug("running operator %zu:%zu (%s %s)", opdata_index,
-                    operator_object_index,
-                    xnn_operator_type_to_string(op->type),
-                    xnn_microkernel_type_to_string(op->ukernel.type));
-      break;
-    case xnn_run_state_skip:
-      xnn_log_debug("skip running operator %zu:%zu (%s %s)", opdata_index,
-                    operator_object_index,
-                    xnn_operator_type_to_string(op->type),
-                    xnn_microkernel_type_to_string(op->ukernel.type));
-      return xnn_status_success;
-  }
-
-  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
-  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
-    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
-  }
-  switch (op->compute.type) {
+  switch (compute->type) {
     case xnn_parallelization_type_invalid:
       break;
     case xnn_parallelization_type_1d:
-      assert(op->compute.range[0] != 0);
+      assert(compute->range[0] != 0);
       pthreadpool_parallelize_1d(
           threadpool,
-          op->compute.task_1d,
-          &op->context,
-          op->compute.range[0],
+          compute->task_1d,
+          context,
+          compute->range[0],
           flags);
       break;
     case xnn_parallelization_type_1d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_1d_tile_1d(
           threadpool,
-          op->compute.task_1d_tile_1d,
-          &op->context,
-          op->compute.range[0],
-          op->compute.tile[0],
+          compute->task_1d_tile_1d,
+          context,
+          compute->range[0],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
       pthreadpool_parallelize_2d(
           threadpool,
-          op->compute.task_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
+          compute->task_2d,
+          context,
+          compute->range[0], compute->range[1],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_2d_tile_1d(
           threadpool,
-          op->compute.task_2d_tile_1d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0],
+          compute->task_2d_tile_1d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d(
           threadpool,
-          op->compute.task_2d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_2d_tile_2d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
       pthreadpool_parallelize_3d(
           threadpool,
-          op->compute.task_3d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
+          compute->task_3d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d(
           threadpool,
-          op->compute.task_3d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_3d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
       pthreadpool_parallelize_4d(
           threadpool,
-          op->compute.task_4d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
+          compute->task_4d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d(
           threadpool,
-          op->compute.task_4d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_4d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_5d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
       pthreadpool_parallelize_5d(
           threadpool,
-          op->compute.task_5d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
+          compute->task_5d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
           flags);
       break;
     case xnn_parallelization_type_5d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_5d_tile_2d(
           threadpool,
-          op->compute.task_5d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_5d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_6d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.range[5] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->range[5] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_6d_tile_2d(
           threadpool,
-          op->compute.task_6d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4], op->compute.range[5],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_6d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4], compute->range[5],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #if XNN_MAX_UARCH_TYPES > 1
     case xnn_parallelization_type_2d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_2d_tile_2d_with_id,
-          &op->context,
+          compute->task_2d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_3d_tile_2d_with_id,
-          &op->context,
+          compute->task_3d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_4d_tile_2d_with_id,
-          &op->context,
+          compute->task_4d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #endif  // XNN_MAX_UARCH_TYPES > 1
     default:
       XNN_UNREACHABLE;
   }
+}
+
+enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+{
+  return xnn_run_operator_with_index(op, 0, 0, threadpool);
+}
+
+enum xnn_status xnn_run_operator_with_index(
+  xnn_operator_t op,
+  size_t opdata_index,
+  size_t operator_object_index,
+  pthreadpool_t threadpool)
+{
+  switch (op->state) {
+    case xnn_run_state_invalid:
+      xnn_log_error("failed to run operator: operator was not successfully setup");
+      return xnn_status_invalid_state;
+    case xnn_run_state_ready:
+      xnn_log_debug("running operator %zu:%zu (%s %s)", opdata_index,
+                    operator_object_index,
+                    xnn_operator_type_to_string(op->type),
+                    xnn_microkernel_type_to_string(op->ukernel.type));
+      break;
+    case xnn_run_state_skip:
+      xnn_log_debug("skip running operator %zu:%zu (%s %s)", opdata_index,
+                    operator_object_index,
+                    xnn_operator_type_to_string(op->type),
+                    xnn_microkernel_type_to_string(op->ukernel.type));
+      return xnn_status_success;
+  }
+
+  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
+    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+  }
+  run_compute(&op->compute, &op->context, flags, threadpool);
+  // Operators which need a second pass over the data (e.g. to combine partial results) schedule it in compute2.
+  run_compute(&op->compute2, &op->context, flags, threadpool);
   return xnn_status_success;
 }
@@ -458,13 +458,15 @@ enum xnn_status xnn_create_convolution2d_nchw_f16(
 
   status = xnn_status_out_of_memory;
 
-  convolution_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  convolution_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
   if (convolution_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
       sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
+  convolution_op->arena = arena;
 
   if (caches != NULL && ukernel_type != xnn_microkernel_type_spmm) {
     convolution_op->weights_cache = caches->weights_cache;
@@ -780,13 +782,15 @@ enum xnn_status xnn_create_convolution2d_nchw_f32(
 
   status = xnn_status_out_of_memory;
 
-  convolution_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  convolution_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
   if (convolution_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
       sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
+  convolution_op->arena = arena;
 
   if (caches != NULL && ukernel_type != xnn_microkernel_type_spmm) {
     convolution_op->weights_cache = caches->weights_cache;
@@ -675,17 +675,20 @@ static enum xnn_status create_convolution2d_nhwc(
 
   status = xnn_status_out_of_memory;
 
-  convolution_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  convolution_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
   if (convolution_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
       sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
+  convolution_op->arena = arena;
 
   if (caches != NULL) {
     convolution_op->weights_cache = caches->weights_cache;
     convolution_op->code_cache = caches->code_cache;
+    convolution_op->indirection_cache = caches->indirection_cache;
   }
 
   const size_t kernel_size = kernel_height * kernel_width;
@@ -1521,7 +1524,8 @@ enum xnn_status xnn_create_fused_convolution2d_nhwc_f32(
     .post_operations = post_operations,
   };
 
-  char* post_operation_params = allocate_and_initialize_post_operation_params(num_post_operations, post_operations);
+  char* post_operation_params = allocate_and_initialize_post_operation_params(
+    num_post_operations, post_operations, caches != NULL ? caches->arena : NULL);
 
   union xnn_f32_minmax_params gemm_params;
   if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
@@ -1699,6 +1703,73 @@ static enum xnn_status setup_gemm(
   return xnn_status_success;
 }
 
+// Points the operator at an indirection buffer shared through the indirection cache with operators of the same
+// geometry. If no operator initialized a buffer for this geometry yet, sets `initialize`, and the caller must initialize
+// the buffer from the input and zero buffer of this operator.
+static enum xnn_status acquire_shared_indirection_buffer(
+    xnn_operator_t convolution_op,
+    size_t tile,
+    size_t indirection_buffer_size,
+    bool* initialize)
+{
+  struct xnn_indirection_cache_key key;
+  memset(&key, 0, sizeof(key));
+  key.operator_type = convolution_op->type;
+  key.ukernel_type = convolution_op->ukernel.type;
+  key.input_height = convolution_op->input_height;
+  key.input_width = convolution_op->input_width;
+  key.input_pixel_stride = convolution_op->input_pixel_stride;
+  key.output_height = convolution_op->output_height;
+  key.output_width = convolution_op->output_width;
+  key.groups = convolution_op->groups;
+  key.group_input_channels = convolution_op->group_input_channels;
+  key.kernel_height = convolution_op->kernel_height;
+  key.kernel_width = convolution_op->kernel_width;
+  key.stride_height = convolution_op->stride_height;
+  key.stride_width = convolution_op->stride_width;
+  key.dilation_height = convolution_op->dilation_height;
+  key.dilation_width = convolution_op->dilation_width;
+  key.padding_top = convolution_op->padding_top;
+  key.padding_left = convolution_op->padding_left;
+  key.tile = tile;
+  // Zero buffers are filled with a single byte, and have the same size for the same operator type and channels.
+  if (convolution_op->zero_buffer != NULL) {
+    key.has_zero = true;
+    key.zero_byte = *((const uint8_t*) convolution_op->zero_buffer);
+  }
+
+  struct xnn_indirection_cache_entry* entry = xnn_get_or_insert_indirection_cache(
+    convolution_op->indirection_cache, &key, indirection_buffer_size, initialize);
+  if (entry == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator shared indirection buffer",
+      indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_out_of_memory;
+  }
+  if (convolution_op->indirection_cache_entry != NULL) {
+    xnn_release_indirection_cache_entry(convolution_op->indirection_cache, convolution_op->indirection_cache_entry);
+  }
+  if (*initialize) {
+    entry->input = convolution_op->input;
+    entry->zero = convolution_op->zero_buffer;
+    xnn_log_debug("allocated %zu bytes for shared indirection buffer in %s operator",
+      indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+  }
+  convolution_op->indirection_cache_entry = entry;
+  convolution_op->indirection_buffer = entry->buffer;
+  convolution_op->last_input = entry->input;
+  return xnn_status_success;
+}
+
+// Zero buffer that padding pointers in the indirection buffer of the operator point to.
+static inline void* indirection_zero_buffer(xnn_operator_t convolution_op)
+{
+  if (convolution_op->indirection_cache_entry != NULL) {
+    return convolution_op->indirection_cache_entry->zero;
+  }
+  return convolution_op->zero_buffer;
+}
+
 static enum xnn_status setup_igemm(
     xnn_operator_t convolution_op,
     uint32_t log2_input_element_size,
@@ -1749,21 +1820,33 @@ static enum xnn_status setup_igemm(
   if (input_height != convolution_op->last_input_height ||
       input_width != convolution_op->last_input_width)
   {
-    const void** indirection_buffer = (const void**) xnn_reallocate_memory((void*) convolution_op->indirection_buffer, indirection_buffer_size);
-    if (indirection_buffer == NULL) {
-      xnn_log_error(
-        "failed to allocate %zu bytes for %s operator indirection buffer",
+    bool initialize = true;
+    if (convolution_op->indirection_cache != NULL) {
+      const enum xnn_status status =
+        acquire_shared_indirection_buffer(convolution_op, mr, indirection_buffer_size, &initialize);
+      if (status != xnn_status_success) {
+        return status;
+      }
+    } else {
+      const void** indirection_buffer = (const void**) xnn_reallocate_arena_memory(
+        convolution_op->arena, (void*) convolution_op->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator indirection buffer",
+          indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+        return xnn_status_out_of_memory;
+      }
+      convolution_op->indirection_buffer = indirection_buffer;
+      convolution_op->last_input = convolution_op->input;
+      xnn_log_debug("allocated %zu bytes for indirection buffer in %s operator",
         indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
-      return xnn_status_out_of_memory;
     }
-    convolution_op->indirection_buffer = indirection_buffer;
-    convolution_op->last_input = convolution_op->input;
     convolution_op->last_input_height = input_height;
     convolution_op->last_input_width = input_width;
-    xnn_log_debug("allocated %zu bytes for indirection buffer in %s operator",
-      indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
 
-    xnn_indirection_init_conv2d(convolution_op, mr, log2_input_element_size);
+    if (initialize) {
+      xnn_indirection_init_conv2d(convolution_op, mr, log2_input_element_size);
+    }
   }
 
   const size_t group_input_channels = convolution_op->group_input_channels;
@@ -1777,7 +1860,7 @@ static enum xnn_status setup_igemm(
       .w_stride = w_stride,
       .indirect_a = convolution_op->indirection_buffer,
       .a_offset = (size_t) ((uintptr_t) convolution_op->input - (uintptr_t) convolution_op->last_input),
-      .zero = convolution_op->zero_buffer,
+      .zero = indirection_zero_buffer(convolution_op),
       .packed_w = packed_weights(convolution_op),
       .c = convolution_op->output,
       .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
@@ -1913,31 +1996,43 @@ static enum xnn_status setup_dwconv(
     const size_t indirection_buffer_size =
       sizeof(void*) * (tile_size - kernel_size + output_height * step_height);
 
-    const void** indirection_buffer =
-      (const void**) xnn_reallocate_memory(convolution_op->indirection_buffer, indirection_buffer_size);
-    if (indirection_buffer == NULL) {
-      xnn_log_error("failed to allocate %zu bytes for %s operator indirection buffer",
+    bool initialize = true;
+    if (convolution_op->indirection_cache != NULL) {
+      const enum xnn_status status =
+        acquire_shared_indirection_buffer(convolution_op, tile_size, indirection_buffer_size, &initialize);
+      if (status != xnn_status_success) {
+        return status;
+      }
+    } else {
+      const void** indirection_buffer =
+        (const void**) xnn_reallocate_arena_memory(
+          convolution_op->arena, convolution_op->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for %s operator indirection buffer",
+          indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+        return xnn_status_out_of_memory;
+      }
+      convolution_op->indirection_buffer = indirection_buffer;
+      convolution_op->last_input = convolution_op->input;
+      xnn_log_debug("allocated %zu bytes for indirection buffer in %s operator",
         indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
-      return xnn_status_out_of_memory;
     }
-    convolution_op->indirection_buffer = indirection_buffer;
-    xnn_log_debug("allocated %zu bytes for indirection buffer in %s operator",
-      indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
 
-    #if XNN_TEST_MODE
-      memset(convolution_op->indirection_buffer, 0, indirection_buffer_size);
-    #endif
+    if (initialize) {
+      #if XNN_TEST_MODE
+        memset(convolution_op->indirection_buffer, 0, indirection_buffer_size);
+      #endif
 
-    xnn_indirection_init_dwconv2d(convolution_op, step_height, step_width, tile_size, log2_input_element_size);
+      xnn_indirection_init_dwconv2d(convolution_op, step_height, step_width, tile_size, log2_input_element_size);
 
-    #if XNN_TEST_MODE
-      for (size_t i = 0; i < indirection_buffer_size / sizeof(void*); i++) {
-        // Indirection initialization should have set all indirection pointers, make sure none of them are NULL.
-        assert(convolution_op->indirection_buffer[i] != NULL);
-      }
-    #endif
+      #if XNN_TEST_MODE
+        for (size_t i = 0; i < indirection_buffer_size / sizeof(void*); i++) {
+          // Indirection initialization should have set all indirection pointers, make sure none of them are NULL.
+          assert(convolution_op->indirection_buffer[i] != NULL);
+        }
+      #endif
+    }
 
-    convolution_op->last_input = convolution_op->input;
     convolution_op->last_input_height = input_height;
     convolution_op->last_input_width = input_width;
   }
@@ -1957,7 +2052,7 @@ static enum xnn_status setup_dwconv(
       .output_height_stride = (output_width * convolution_op->output_pixel_stride) << log2_output_element_size,
       .output_width = output_width,
       .groups = groups,
-      .zero = convolution_op->zero_buffer,
+      .zero = indirection_zero_buffer(convolution_op),
       .output_increment = (convolution_op->output_pixel_stride - groups) << log2_output_element_size,
   };
   memcpy(&convolution_op->context.dwconv.params, &convolution_op->params, sizeof(convolution_op->context.dwconv.params));
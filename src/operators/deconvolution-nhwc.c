@@ -140,13 +140,15 @@ static enum xnn_status create_deconvolution2d_nhwc(
 
   status = xnn_status_out_of_memory;
 
-  deconvolution_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  deconvolution_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
   if (deconvolution_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
       sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
+  deconvolution_op->arena = arena;
 
   if (caches != NULL) {
     deconvolution_op->weights_cache = caches->weights_cache;
@@ -169,7 +171,7 @@ static enum xnn_status create_deconvolution2d_nhwc(
       (((kernel_size * k_stride) << log2_filter_element_size) + bias_element_size * subkernels);
 
     const size_t subconvolution_buffer_size = sizeof(struct subconvolution_params) * subkernels;
-    deconvolution_op->subconvolution_buffer = xnn_allocate_zero_memory(subconvolution_buffer_size);
+    deconvolution_op->subconvolution_buffer = xnn_allocate_zero_arena_memory(arena, subconvolution_buffer_size);
     if (deconvolution_op->subconvolution_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator subconvolution buffer",
@@ -702,7 +704,8 @@ static enum xnn_status setup_conv_path(
   if (input_height != deconvolution_op->last_input_height ||
       input_width != deconvolution_op->last_input_width)
   {
-    const void** indirection_buffer = (const void**) xnn_reallocate_memory(deconvolution_op->indirection_buffer, indirection_buffer_size);
+    const void** indirection_buffer = (const void**) xnn_reallocate_arena_memory(
+      deconvolution_op->arena, deconvolution_op->indirection_buffer, indirection_buffer_size);
     if (indirection_buffer == NULL) {
       xnn_log_error(
         "failed to allocate %zu bytes for %s operator indirection buffer",
@@ -930,7 +933,8 @@ static enum xnn_status setup_subconv2d_path(
         kernel_size * output_height * stride_width * round_up(divide_round_up(output_width, stride_width), mr);
 
       const void** indirection_buffer =
-        (const void**) xnn_reallocate_memory(deconvolution_op->indirection_buffer, indirection_buffer_size);
+        (const void**) xnn_reallocate_arena_memory(
+          deconvolution_op->arena, deconvolution_op->indirection_buffer, indirection_buffer_size);
       if (indirection_buffer == NULL) {
         xnn_log_error(
           "failed to allocate %zu bytes for %s operator indirection buffer",
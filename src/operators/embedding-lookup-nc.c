@@ -0,0 +1,351 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/config.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+// Target number of table elements gathered by a single task: small bags are grouped to amortize the task overhead.
+#define XNN_EMBEDDING_TASK_ELEMENTS 4096
+
+static enum xnn_status create_embedding_lookup_nc(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    size_t table_stride,
+    const float* table_scale,
+    enum xnn_embedding_pooling pooling,
+    uint32_t flags,
+    const struct xnn_embedding_config* embedding_config,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* embedding_op_out)
+{
+  xnn_operator_t embedding_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if (embedding_config == NULL || embedding_config->ukernel == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (num_embeddings == 0 || num_embeddings > (size_t) INT32_MAX) {
+    xnn_log_error(
+      "failed to create %s operator with %zu embeddings: number of embeddings must be in [1, %" PRId32 "] range",
+      xnn_operator_type_to_string(operator_type), num_embeddings, INT32_MAX);
+    goto error;
+  }
+
+  if (embedding_dim == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu embedding dimension: embedding dimension must be non-zero",
+      xnn_operator_type_to_string(operator_type), embedding_dim);
+    goto error;
+  }
+
+  switch (pooling) {
+    case xnn_embedding_pooling_none:
+    case xnn_embedding_pooling_sum:
+    case xnn_embedding_pooling_mean:
+      break;
+    default:
+      xnn_log_error(
+        "failed to create %s operator: invalid pooling mode %d",
+        xnn_operator_type_to_string(operator_type), (int) pooling);
+      goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  embedding_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (embedding_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  // The table is referenced, not copied: embedding tables are often hundreds of megabytes, and the caller keeps them
+  // alive for the lifetime of the operator.
+  embedding_op->channels = embedding_dim;
+  embedding_op->embedding.table = table;
+  embedding_op->embedding.table_stride = table_stride;
+  embedding_op->embedding.table_scale = table_scale;
+  embedding_op->embedding.pooling = pooling;
+
+  embedding_op->type = operator_type;
+  embedding_op->flags = flags;
+
+  embedding_op->state = xnn_run_state_invalid;
+
+  *embedding_op_out = embedding_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(embedding_op);
+  return status;
+}
+
+static bool is_valid_table_scale(
+    size_t num_embeddings,
+    const float* table_scale,
+    enum xnn_operator_type operator_type)
+{
+  if (table_scale == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: per-embedding scales are required for quantized tables",
+      xnn_operator_type_to_string(operator_type));
+    return false;
+  }
+  for (size_t i = 0; i < num_embeddings; i++) {
+    if (table_scale[i] <= 0.0f || !isnormal(table_scale[i])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g scale in embedding #%zu: scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(operator_type), table_scale[i], i);
+      return false;
+    }
+  }
+  return true;
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_f16_f32(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    enum xnn_embedding_pooling pooling,
+    uint32_t flags,
+    xnn_operator_t* embedding_op_out)
+{
+  return create_embedding_lookup_nc(
+    num_embeddings, embedding_dim,
+    table, embedding_dim * sizeof(uint16_t), /*table_scale=*/NULL,
+    pooling, flags,
+    xnn_init_f16_f32_embedding_config(),
+    xnn_operator_type_embedding_lookup_nc_f16_f32,
+    embedding_op_out);
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_f32(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const float* table,
+    enum xnn_embedding_pooling pooling,
+    uint32_t flags,
+    xnn_operator_t* embedding_op_out)
+{
+  return create_embedding_lookup_nc(
+    num_embeddings, embedding_dim,
+    table, embedding_dim * sizeof(float), /*table_scale=*/NULL,
+    pooling, flags,
+    xnn_init_f32_embedding_config(),
+    xnn_operator_type_embedding_lookup_nc_f32,
+    embedding_op_out);
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_qc4_f32(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    const float* table_scale,
+    enum xnn_embedding_pooling pooling,
+    uint32_t flags,
+    xnn_operator_t* embedding_op_out)
+{
+  if (!is_valid_table_scale(num_embeddings, table_scale, xnn_operator_type_embedding_lookup_nc_qc4_f32)) {
+    return xnn_status_invalid_parameter;
+  }
+
+  // Two 4-bit elements are packed per byte, and every row starts on a byte boundary.
+  return create_embedding_lookup_nc(
+    num_embeddings, embedding_dim,
+    table, (embedding_dim + 1) / 2, table_scale,
+    pooling, flags,
+    xnn_init_qc4_f32_embedding_config(),
+    xnn_operator_type_embedding_lookup_nc_qc4_f32,
+    embedding_op_out);
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_qc8_f32(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const int8_t* table,
+    const float* table_scale,
+    enum xnn_embedding_pooling pooling,
+    uint32_t flags,
+    xnn_operator_t* embedding_op_out)
+{
+  if (!is_valid_table_scale(num_embeddings, table_scale, xnn_operator_type_embedding_lookup_nc_qc8_f32)) {
+    return xnn_status_invalid_parameter;
+  }
+
+  return create_embedding_lookup_nc(
+    num_embeddings, embedding_dim,
+    table, embedding_dim * sizeof(int8_t), table_scale,
+    pooling, flags,
+    xnn_init_qc8_f32_embedding_config(),
+    xnn_operator_type_embedding_lookup_nc_qc8_f32,
+    embedding_op_out);
+}
+
+static enum xnn_status setup_embedding_lookup_nc(
+    xnn_operator_t embedding_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    float* output,
+    const struct xnn_embedding_config* embedding_config,
+    size_t num_threads)
+{
+  if (embedding_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(embedding_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  embedding_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (embedding_config == NULL) {
+    xnn_log_error("failed to setup %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (batch_size == 0 || bag_size == 0) {
+    embedding_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  // Without pooling, every index produces its own output row: it is gathered as a bag of a single row.
+  size_t num_bags = batch_size;
+  if (embedding_op->embedding.pooling == xnn_embedding_pooling_none) {
+    num_bags = batch_size * bag_size;
+    bag_size = 1;
+  }
+
+  const size_t embedding_dim = embedding_op->channels;
+  embedding_op->context.embedding = (struct embedding_context) {
+    .channels = embedding_dim,
+    .bag_size = bag_size,
+    .indices = indices,
+    .table = embedding_op->embedding.table,
+    .table_stride = embedding_op->embedding.table_stride,
+    .table_scale = embedding_op->embedding.table_scale,
+    .output = output,
+    .output_stride = embedding_dim * sizeof(float),
+    .ukernel = embedding_config->ukernel,
+  };
+  const float scale =
+    embedding_op->embedding.pooling == xnn_embedding_pooling_mean ? 1.0f / (float) bag_size : 1.0f;
+  embedding_config->init.f32(&embedding_op->context.embedding.params.f32, scale);
+
+  // Rows are gathered from random locations in the table, so each task should process enough elements to hide the
+  // latency of its first cache misses, while leaving enough tasks to balance the load across threads.
+  size_t bag_tile = max(XNN_EMBEDDING_TASK_ELEMENTS / (bag_size * embedding_dim), 1);
+  if (num_threads > 1) {
+    const size_t target_tiles_per_thread = 5;
+    bag_tile = min(bag_tile, divide_round_up(num_bags, num_threads * target_tiles_per_thread));
+  }
+  embedding_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+  embedding_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_embedding;
+  embedding_op->compute.range[0] = num_bags;
+  embedding_op->compute.tile[0] = bag_tile;
+  embedding_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_f16_f32(
+    xnn_operator_t embedding_op,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_op, xnn_operator_type_embedding_lookup_nc_f16_f32,
+    batch_size, bag_size, indices, output,
+    xnn_init_f16_f32_embedding_config(),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_f32(
+    xnn_operator_t embedding_op,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_op, xnn_operator_type_embedding_lookup_nc_f32,
+    batch_size, bag_size, indices, output,
+    xnn_init_f32_embedding_config(),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_qc4_f32(
+    xnn_operator_t embedding_op,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_op, xnn_operator_type_embedding_lookup_nc_qc4_f32,
+    batch_size, bag_size, indices, output,
+    xnn_init_qc4_f32_embedding_config(),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_qc8_f32(
+    xnn_operator_t embedding_op,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_op, xnn_operator_type_embedding_lookup_nc_qc8_f32,
+    batch_size, bag_size, indices, output,
+    xnn_init_qc8_f32_embedding_config(),
+    pthreadpool_get_threads_count(threadpool));
+}
@@ -18,14 +18,43 @@
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/common.h>
+#include <xnnpack/config.h>
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
+#include <xnnpack/microparams-init.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/operator-utils.h>
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
 
 
+// Returns the number of input channels in every block of K-blocked F32 GEMM weights, or 0 if the weights of a layer
+// with input_channels input channels should not be split along K.
+static size_t compute_f32_gemm_kc_block(
+    size_t input_channels,
+    const struct gemm_parameters* gemm_parameters,
+    const struct xnn_binary_elementwise_config* vadd_config)
+{
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || vadd_config == NULL || vadd_config->minmax.op_ukernel == NULL ||
+      gemm_parameters->init.f32 == NULL)
+  {
+    return 0;
+  }
+
+  // An nr x kc panel of packed weights takes up to half of the L1 data cache, leaving the rest for the mr x kc panel of
+  // inputs and for the outputs.
+  const size_t kr_sr = (size_t) (UINT32_C(1) << (gemm_parameters->log2_kr + gemm_parameters->log2_sr));
+  const size_t kc_block =
+    round_down_po2(hardware_config->l1_data_cache_bytes / 2 / (gemm_parameters->nr * sizeof(float)), kr_sr);
+  // Splitting pays off only if the layer spans several blocks, as every block after the first one adds a pass over the
+  // outputs.
+  if (kc_block == 0 || input_channels <= 2 * kc_block) {
+    return 0;
+  }
+  return kc_block;
+}
+
 static enum xnn_status create_fully_connected_nc(
     size_t input_channels,
     size_t output_channels,
@@ -40,6 +69,12 @@ static enum xnn_status create_fully_connected_nc(
     xnn_pack_gemm_goi_w_fn pack_gemm_goi_w,
     const void* packing_params,
     int packed_weights_padding_byte,
+    size_t extra_weights_bytes,
+    xnn_init_qc8_scale_params_fn init_scale_params,
+    const float* scale_params,
+    xnn_init_qc8_scale_params_fn init_extra_bias_params,
+    const float* extra_bias_params,
+    size_t kc_block,
     const void* params,
     size_t params_size,
     const struct gemm_parameters* gemm_parameters,
@@ -101,13 +136,15 @@ static enum xnn_status create_fully_connected_nc(
 
   status = xnn_status_out_of_memory;
 
-  fully_connected_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  fully_connected_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
   if (fully_connected_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
       sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
+  fully_connected_op->arena = arena;
 
   if (caches != NULL) {
     fully_connected_op->weights_cache = caches->weights_cache;
@@ -120,7 +157,20 @@ static enum xnn_status create_fully_connected_nc(
   const size_t n_stride = round_up(output_channels, nr);
   const size_t k_stride = round_up_po2(input_channels, kr * sr);
 
-  const size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size));
+  const size_t weights_stride = bias_element_size + (k_stride << log2_filter_element_size) + extra_weights_bytes;
+  size_t packed_weights_size = n_stride * weights_stride;
+  // K-blocked weights are packed as separate GEMM weights for every block of kc_block input channels. Only the first
+  // block holds the bias, the other blocks hold zeroes in its place.
+  const size_t num_k_blocks = kc_block != 0 ? divide_round_up(input_channels, kc_block) : 1;
+  const size_t last_kc_block = input_channels - (num_k_blocks - 1) * kc_block;
+  const size_t block_weights_stride = bias_element_size + (kc_block << log2_filter_element_size);
+  const size_t last_block_weights_stride =
+    bias_element_size + (round_up_po2(last_kc_block, kr * sr) << log2_filter_element_size);
+  if (num_k_blocks > 1) {
+    assert(extra_weights_bytes == 0);
+    assert(kc_block % (kr * sr) == 0);
+    packed_weights_size = n_stride * ((num_k_blocks - 1) * block_weights_stride + last_block_weights_stride);
+  }
   size_t aligned_total_weights_size = round_up_po2(packed_weights_size, XNN_ALLOCATION_ALIGNMENT);
   void* weights_ptr = xnn_get_pointer_to_write_weights(
       fully_connected_op, aligned_total_weights_size, packed_weights_padding_byte);
@@ -133,7 +183,52 @@ static enum xnn_status create_fully_connected_nc(
   xnn_log_debug("allocated %zu bytes for packed weights in %s operator",
     aligned_total_weights_size, xnn_operator_type_to_string(operator_type));
 
-  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+  if (num_k_blocks > 1) {
+    void* block_kernel = NULL;
+    if (!(flags & XNN_FLAG_TRANSPOSE_WEIGHTS)) {
+      // Rows of a block of the OI kernel are not contiguous, so they are gathered before packing.
+      const size_t block_kernel_size = (output_channels * kc_block) << log2_filter_element_size;
+      block_kernel = xnn_allocate_memory(block_kernel_size);
+      if (block_kernel == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator kernel block",
+          block_kernel_size, xnn_operator_type_to_string(operator_type));
+        goto error;
+      }
+    }
+    void* block_weights = weights_ptr;
+    for (size_t k_block = 0; k_block < num_k_blocks; k_block++) {
+      const size_t kc_start = k_block * kc_block;
+      const size_t kc = min(input_channels - kc_start, kc_block);
+      const void* block_bias = k_block == 0 ? bias : NULL;
+      if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+        pack_gemm_io_w(
+          output_channels, kc,
+          nr, kr, sr,
+          (const void*) ((uintptr_t) kernel + ((kc_start * output_channels) << log2_filter_element_size)),
+          block_bias,
+          block_weights,
+          packing_params);
+      } else {
+        for (size_t oc = 0; oc < output_channels; oc++) {
+          memcpy(
+            (void*) ((uintptr_t) block_kernel + ((oc * kc) << log2_filter_element_size)),
+            (const void*) ((uintptr_t) kernel + ((oc * input_channels + kc_start) << log2_filter_element_size)),
+            kc << log2_filter_element_size);
+        }
+        pack_gemm_goi_w(
+          1, output_channels, kc,
+          nr, kr, sr,
+          block_kernel, block_bias,
+          block_weights,
+          0 /* extra bytes */,
+          packing_params);
+      }
+      block_weights = (void*) ((uintptr_t) block_weights + n_stride * block_weights_stride);
+    }
+    xnn_release_memory(block_kernel);
+  } else if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    assert(extra_weights_bytes == 0);
     pack_gemm_io_w(
       output_channels, input_channels,
       nr, kr, sr,
@@ -146,10 +241,25 @@ static enum xnn_status create_fully_connected_nc(
       nr, kr, sr,
       kernel, bias,
       weights_ptr,
-      0 /* extra bytes */,
+      nr * extra_weights_bytes,
       packing_params);
   }
 
+  // Extra weights follow the filter elements of every block of nr output channels: first nr scales, then nr
+  // floating-point biases.
+  void* extra_weights =
+    (void*) ((uintptr_t) weights_ptr + nr * (bias_element_size + (k_stride << log2_filter_element_size)));
+  if (scale_params != NULL) {
+    assert(init_scale_params != NULL);
+    init_scale_params(output_channels, nr, nr * weights_stride, scale_params, extra_weights);
+  }
+  if (extra_bias_params != NULL) {
+    assert(init_extra_bias_params != NULL);
+    init_extra_bias_params(
+      output_channels, nr, nr * weights_stride, extra_bias_params,
+      (void*) ((uintptr_t) extra_weights + nr * sizeof(float)));
+  }
+
   if (use_weights_cache(fully_connected_op)) {
     fully_connected_op->packed_weights.offset = xnn_get_or_insert_weights_cache(
         fully_connected_op->weights_cache, weights_ptr, aligned_total_weights_size);
@@ -171,6 +281,7 @@ static enum xnn_status create_fully_connected_nc(
     .nr = nr,
     .kr = kr,
     .sr = sr,
+    .kc = num_k_blocks > 1 ? kc_block : 0,
   };
 
   assert(XNN_MAX_MR >= mr);
@@ -189,6 +300,123 @@ error:
   return status;
 }
 
+// Sets up F32 Fully Connected operators with K-blocked weights. Every task computes an mc x nc tile of outputs, with mc
+// rows of inputs of a block of input channels taking up to half of the L2 cache.
+static enum xnn_status setup_blocked_gemm(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t mr,
+  xnn_gemm_ukernel_fn gemm_ukernel,
+  size_t num_threads)
+{
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+  const size_t kr_sr = fully_connected_op->ukernel.gemm.kr * fully_connected_op->ukernel.gemm.sr;
+  const size_t kc_block = fully_connected_op->ukernel.gemm.kc;
+  const size_t num_k_blocks = divide_round_up(input_channels, kc_block);
+  const size_t last_kc_block = input_channels - (num_k_blocks - 1) * kc_block;
+  const size_t w_stride = sizeof(float) + kc_block * sizeof(float);
+
+  const struct xnn_binary_elementwise_config* vadd_config = xnn_init_f32_vadd_config();
+  assert(vadd_config != NULL);
+
+  fully_connected_op->context.blocked_gemm = (struct blocked_gemm_context) {
+    .k_scaled = input_channels * sizeof(float),
+    .kc_scaled = kc_block * sizeof(float),
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .packed_w = packed_weights(fully_connected_op),
+    .w_stride = w_stride,
+    .w_stride_last = sizeof(float) + round_up_po2(last_kc_block, kr_sr) * sizeof(float),
+    .wk_stride = round_up(output_channels, nr) * w_stride,
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .mr = mr,
+    .ukernel = gemm_ukernel,
+    .vadd = vadd_config->minmax.op_ukernel,
+    .gemm_params = fully_connected_op->params.f32_blocked_gemm.linear,
+    .add_params = fully_connected_op->params.f32_blocked_gemm.add_linear,
+    .output_params = fully_connected_op->params.f32_blocked_gemm.add_minmax,
+  };
+
+  #if XNN_TEST_MODE
+    const bool split_k = batch_size == 1;
+  #else
+    // With a single row of inputs, tiles of output channels alone may be too few to keep all threads busy. Then blocks
+    // of input channels are computed in parallel as well, and their partial results are reduced in a second pass.
+    const size_t target_tiles_per_thread = 5;
+    const bool split_k = batch_size == 1 && num_threads > 1 &&
+      divide_round_up(output_channels, nr) < num_threads * target_tiles_per_thread;
+  #endif
+  if (split_k) {
+    const size_t workspace_stride = output_channels * sizeof(float);
+    const size_t workspace_size = num_k_blocks * workspace_stride + XNN_EXTRA_BYTES;
+    void* workspace = xnn_reallocate_memory(fully_connected_op->workspace, workspace_size);
+    if (workspace == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->workspace = workspace;
+    fully_connected_op->context.blocked_gemm.workspace = workspace;
+    fully_connected_op->context.blocked_gemm.workspace_stride = workspace_stride;
+    fully_connected_op->context.blocked_gemm.num_k_blocks = num_k_blocks;
+
+    #if XNN_TEST_MODE
+      const size_t nc = nr;
+    #else
+      size_t nc = output_channels;
+      const size_t max_nc = divide_round_up(output_channels * num_k_blocks, num_threads * target_tiles_per_thread);
+      if (max_nc < nc) {
+        nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+      }
+    #endif
+    fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+    fully_connected_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_splitk_gemv;
+    fully_connected_op->compute.range[0] = num_k_blocks;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = nc;
+    fully_connected_op->compute2.type = xnn_parallelization_type_1d_tile_1d;
+    fully_connected_op->compute2.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_splitk_gemv_reduce;
+    fully_connected_op->compute2.range[0] = output_channels;
+    fully_connected_op->compute2.tile[0] = nc;
+    fully_connected_op->state = xnn_run_state_ready;
+    return xnn_status_success;
+  }
+
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  assert(hardware_config != NULL);
+  const size_t max_mc = max(hardware_config->l2_cache_bytes / 2 / (kc_block * sizeof(float)), mr);
+  const size_t mc = min(max_mc / mr * mr, round_up(batch_size, mr));
+
+  #if XNN_TEST_MODE
+    const size_t nc = nr;
+  #else
+    size_t nc = min(output_channels, XNN_BLOCKED_GEMM_MAX_NC / nr * nr);
+    if (num_threads > 1) {
+      const size_t num_other_tiles = divide_round_up(batch_size, mc);
+      const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+      if (max_nc < nc) {
+        nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+      }
+    }
+  #endif
+  fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_blocked_gemm;
+  fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
+  fully_connected_op->compute.range[0] = batch_size;
+  fully_connected_op->compute.range[1] = output_channels;
+  fully_connected_op->compute.tile[0] = mc;
+  fully_connected_op->compute.tile[1] = nc;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_fully_connected_nc(
   xnn_operator_t fully_connected_op,
   enum xnn_operator_type expected_operator_type,
@@ -251,6 +479,12 @@ static enum xnn_status setup_fully_connected_nc(
     mr = 1;
   }
 
+  const size_t kc_block = fully_connected_op->ukernel.gemm.kc;
+  if (kc_block != 0) {
+    return setup_blocked_gemm(
+      fully_connected_op, batch_size, input, output, mr, gemm_ukernel.function[XNN_UARCH_DEFAULT], num_threads);
+  }
+
   fully_connected_op->context.gemm = (struct gemm_context) {
     .k_scaled = input_channels << log2_input_element_size,
     .w_stride = bias_element_size +
@@ -358,6 +592,9 @@ enum xnn_status xnn_create_fully_connected_nc_f16(
     pack_gemm_io_w,
     pack_gemm_goi_w,
     NULL /* packing params */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
+    NULL /* init extra bias params */, NULL /* extra bias params */,
+    0 /* no K blocking */,
     &params, sizeof(params),
     &xnn_params.f16.gemm, &xnn_params.f16.gemm.minmax,
     XNN_INIT_FLAG_F16,
@@ -410,7 +647,9 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
   if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
     xnn_params.f32.gemm.init.f32(&params, output_min, output_max);
   }
-  return create_fully_connected_nc(
+  const struct xnn_binary_elementwise_config* vadd_config = xnn_init_f32_vadd_config();
+  const size_t kc_block = compute_f32_gemm_kc_block(input_channels, &xnn_params.f32.gemm, vadd_config);
+  const enum xnn_status status = create_fully_connected_nc(
     input_channels, output_channels,
     input_stride, output_stride,
     kernel, bias, flags,
@@ -419,12 +658,22 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     (xnn_pack_gemm_io_w_fn) xnn_pack_f32_gemm_io_w,
     (xnn_pack_gemm_goi_w_fn) xnn_pack_f32_gemm_goi_w,
     NULL /* packing params */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
+    NULL /* init extra bias params */, NULL /* extra bias params */,
+    kc_block,
     &params, sizeof(params),
     &xnn_params.f32.gemm, gemm_ukernels,
     XNN_INIT_FLAG_F32,
     xnn_operator_type_fully_connected_nc_f32,
     caches,
     fully_connected_op_out);
+  if (status == xnn_status_success && (*fully_connected_op_out)->ukernel.gemm.kc != 0) {
+    xnn_operator_t fully_connected_op = *fully_connected_op_out;
+    xnn_params.f32.gemm.init.f32(&fully_connected_op->params.f32_blocked_gemm.linear, -INFINITY, INFINITY);
+    vadd_config->init.f32_minmax(&fully_connected_op->params.f32_blocked_gemm.add_linear, -INFINITY, INFINITY);
+    vadd_config->init.f32_minmax(&fully_connected_op->params.f32_blocked_gemm.add_minmax, output_min, output_max);
+  }
+  return status;
 }
 
 enum xnn_status xnn_create_fully_connected_nc_qs8(
@@ -499,6 +748,9 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     (xnn_pack_gemm_io_w_fn) xnn_pack_qs8_gemm_io_w,
     (xnn_pack_gemm_goi_w_fn) xnn_pack_qs8_gemm_goi_w,
     &packing_params, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
+    NULL /* init extra bias params */, NULL /* extra bias params */,
+    0 /* no K blocking */,
     &params, sizeof(params),
     &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax,
     XNN_INIT_FLAG_QS8,
@@ -582,6 +834,9 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     (xnn_pack_gemm_io_w_fn) xnn_pack_qu8_gemm_io_w,
     (xnn_pack_gemm_goi_w_fn) xnn_pack_qu8_gemm_goi_w,
     &packing_params, kernel_zero_point /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
+    NULL /* init extra bias params */, NULL /* extra bias params */,
+    0 /* no K blocking */,
     &params, sizeof(params),
     &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
     XNN_INIT_FLAG_QU8,
@@ -590,6 +845,101 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     fully_connected_op_out);
 }
 
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w),
+        kernel_scale[output_channel], output_channel);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    xnn_log_error(
+      "failed to create %s operator: transposed weights are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w));
+    return xnn_status_unsupported_parameter;
+  }
+
+  const struct gemm_parameters* gemm_config = xnn_init_qd8_f32_qc8w_gemm_config();
+  const struct xnn_reduce_config* rminmax_config = xnn_init_f32_rminmax_config();
+  const struct xnn_unary_elementwise_config* f32_to_qs8_cvt_config = xnn_init_f32_to_qs8_cvt_config();
+  if (gemm_config == NULL || gemm_config->mr == 0 ||
+      rminmax_config == NULL || rminmax_config->ukernel == NULL || f32_to_qs8_cvt_config == NULL)
+  {
+    xnn_log_error(
+      "failed to create %s operator: unsupported hardware configuration",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w));
+    return xnn_status_unsupported_hardware;
+  }
+
+  union xnn_f32_minmax_params params;
+  if XNN_LIKELY(gemm_config->init.f32 != NULL) {
+    gemm_config->init.f32(&params, output_min, output_max);
+  }
+  // Packing with a unit input zero point and no integer bias stores the negated sums of the filter elements in place
+  // of the bias, and the micro-kernels scale them by the zero point of every row of inputs.
+  const struct xnn_qs8_packing_params packing_params = {
+    .input_zero_point = 1,
+  };
+  return create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, NULL /* bias */, flags,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    (xnn_pack_gemm_io_w_fn) xnn_pack_qs8_gemm_io_w,
+    (xnn_pack_gemm_goi_w_fn) xnn_pack_qs8_gemm_goi_w,
+    &packing_params, 0 /* packed weights padding byte */,
+    2 * sizeof(float) /* extra weights bytes */,
+    xnn_init_qc8_scale_fp32_params, kernel_scale,
+    xnn_init_qc8_scale_fp32_params, bias,
+    0 /* no K blocking */,
+    &params, sizeof(params),
+    gemm_config, &gemm_config->minmax,
+    XNN_INIT_FLAG_XNNPACK,
+    xnn_operator_type_fully_connected_nc_qd8_f32_qc8w,
+    caches,
+    fully_connected_op_out);
+}
+
 enum xnn_status xnn_setup_fully_connected_nc_f16(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -673,3 +1023,129 @@ enum xnn_status xnn_setup_fully_connected_nc_qu8(
     sizeof(fully_connected_op->params.qu8_conv_minmax),
     pthreadpool_get_threads_count(threadpool));
 }
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  const enum xnn_operator_type operator_type = xnn_operator_type_fully_connected_nc_qd8_f32_qc8w;
+  if (fully_connected_op->type != operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(operator_type),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    fully_connected_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  if (fully_connected_op->weights_cache != NULL &&
+      !xnn_weights_cache_is_finalized(fully_connected_op->weights_cache)) {
+    xnn_log_error("failed to setup %s operator: weights cache is not finalized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_invalid_state;
+  }
+
+  const struct xnn_reduce_config* rminmax_config = xnn_init_f32_rminmax_config();
+  const struct xnn_unary_elementwise_config* f32_to_qs8_cvt_config = xnn_init_f32_to_qs8_cvt_config();
+  assert(rminmax_config != NULL);
+  assert(f32_to_qs8_cvt_config != NULL);
+
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+
+  // The workspace holds the quantized rows of inputs followed by their quantization parameters.
+  const size_t quantized_input_size = round_up_po2(batch_size * input_channels + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+  const size_t workspace_size = quantized_input_size + batch_size * sizeof(struct xnn_qd8_quantization_params);
+  void* workspace = xnn_reallocate_memory(fully_connected_op->workspace, workspace_size);
+  if (workspace == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for %s operator workspace",
+      workspace_size, xnn_operator_type_to_string(operator_type));
+    return xnn_status_out_of_memory;
+  }
+  fully_connected_op->workspace = workspace;
+
+  fully_connected_op->batch_size = 1;
+  fully_connected_op->input_height = batch_size;
+  fully_connected_op->input_width = 1;
+  fully_connected_op->input = input;
+
+  fully_connected_op->output_height = batch_size;
+  fully_connected_op->output_width = 1;
+  fully_connected_op->output = output;
+
+  uint32_t mr = fully_connected_op->ukernel.gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+
+  struct xnn_hmp_gemm_ukernel gemm_ukernel = fully_connected_op->ukernel.gemm.gemm_cases[mr-1];
+  if (batch_size == 1 && fully_connected_op->ukernel.gemm.gemm_cases[0].function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernel = fully_connected_op->ukernel.gemm.gemm_cases[0];
+    mr = 1;
+  }
+
+  fully_connected_op->context.qd8_gemm = (struct qd8_gemm_context) {
+    .input_size = input_channels * sizeof(float),
+    .input = input,
+    .input_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .a = workspace,
+    .a_stride = input_channels,
+    .quantization_params = (struct xnn_qd8_quantization_params*) ((uintptr_t) workspace + quantized_input_size),
+    .rminmax_ukernel = rminmax_config->ukernel,
+    .cvt_ukernel = (xnn_f32_qs8_vcvt_ukernel_fn) f32_to_qs8_cvt_config->ukernel,
+    .init_cvt_params = f32_to_qs8_cvt_config->init.f32_qs8_cvt,
+    .k_scaled = input_channels,
+    .packed_w = packed_weights(fully_connected_op),
+    .w_stride = sizeof(int32_t) +
+        round_up_po2(input_channels, fully_connected_op->ukernel.gemm.kr * fully_connected_op->ukernel.gemm.sr) +
+        2 * sizeof(float),
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .ukernel = (xnn_qd8_f32_qc8w_gemm_ukernel_fn) gemm_ukernel.function[XNN_UARCH_DEFAULT],
+  };
+  if (rminmax_config->init.f32 != NULL) {
+    rminmax_config->init.f32(&fully_connected_op->context.qd8_gemm.rminmax_params, 1.0f);
+  }
+  memcpy(&fully_connected_op->context.qd8_gemm.params, &fully_connected_op->params.f32_minmax,
+    sizeof(fully_connected_op->params.f32_minmax));
+
+  fully_connected_op->compute.type = xnn_parallelization_type_1d;
+  fully_connected_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_qd8_quantize;
+  fully_connected_op->compute.range[0] = batch_size;
+
+  #if XNN_TEST_MODE
+    const size_t nc = nr;
+  #else
+    size_t nc = output_channels;
+    const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+    if (num_threads > 1) {
+      const size_t num_other_tiles = divide_round_up(batch_size, mr);
+      const size_t target_tiles_per_thread = 5;
+      const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+      if (max_nc < nc) {
+        nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+      }
+    }
+  #endif
+  fully_connected_op->compute2.type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute2.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_qd8_gemm;
+  fully_connected_op->compute2.range[0] = batch_size;
+  fully_connected_op->compute2.range[1] = output_channels;
+  fully_connected_op->compute2.tile[0] = mr;
+  fully_connected_op->compute2.tile[1] = nc;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
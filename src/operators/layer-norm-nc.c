@@ -0,0 +1,580 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/cache.h>
+#include <xnnpack/common.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/config.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/operator-utils.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params.h>
+
+
+static bool is_valid_epsilon(float epsilon, enum xnn_operator_type operator_type)
+{
+  if (!(epsilon >= 0.0f) || !isfinite(epsilon)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g epsilon: epsilon must be finite and non-negative",
+      xnn_operator_type_to_string(operator_type), epsilon);
+    return false;
+  }
+  return true;
+}
+
+static enum xnn_status create_rnorm_nc(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const void* gamma,
+    const void* beta,
+    uint32_t flags,
+    uint32_t log2_weights_element_size,
+    xnn_pack_rnorm_w_fn pack_rnorm_w,
+    const void* packing_params,
+    const struct xnn_rnorm_config* rnorm_config,
+    const void* params,
+    size_t params_size,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_caches_t caches,
+    xnn_operator_t* rnorm_op_out)
+{
+  xnn_operator_t rnorm_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags ||
+      rnorm_config == NULL || rnorm_config->ukernel == NULL)
+  {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), output_stride, channels);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  rnorm_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
+  if (rnorm_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+  rnorm_op->arena = arena;
+
+  if (caches != NULL) {
+    rnorm_op->weights_cache = caches->weights_cache;
+  }
+
+  // Scales (gamma) and offsets (beta) are packed back-to-back, so the micro-kernel streams them together with the input.
+  const size_t packed_weights_size = ((channels * 2) << log2_weights_element_size) + XNN_EXTRA_BYTES;
+  const size_t aligned_total_weights_size = round_up_po2(packed_weights_size, XNN_ALLOCATION_ALIGNMENT);
+  void* weights_ptr = xnn_get_pointer_to_write_weights(rnorm_op, aligned_total_weights_size, 0);
+  if (weights_ptr == NULL) {
+    xnn_log_error("failed to reserve or allocate %zu bytes for %s operator packed weights",
+      aligned_total_weights_size, xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+  xnn_log_debug("allocated %zu bytes for packed weights in %s operator",
+    aligned_total_weights_size, xnn_operator_type_to_string(operator_type));
+
+  pack_rnorm_w(channels, gamma, beta, weights_ptr, packing_params);
+
+  if (use_weights_cache(rnorm_op)) {
+    rnorm_op->packed_weights.offset = xnn_get_or_insert_weights_cache(
+        rnorm_op->weights_cache, weights_ptr, aligned_total_weights_size);
+  }
+
+  rnorm_op->channels = channels;
+  rnorm_op->input_pixel_stride = input_stride;
+  rnorm_op->output_pixel_stride = output_stride;
+  memcpy(&rnorm_op->params, params, params_size);
+
+  rnorm_op->type = operator_type;
+  rnorm_op->flags = flags;
+
+  rnorm_op->state = xnn_run_state_invalid;
+
+  *rnorm_op_out = rnorm_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(rnorm_op);
+  return status;
+}
+
+static enum xnn_status create_rnorm_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const void* gamma,
+    const void* beta,
+    bool subtract_mean,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_caches_t caches,
+    xnn_operator_t* rnorm_op_out)
+{
+  if (!is_valid_epsilon(epsilon, operator_type)) {
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_rnorm_config* rnorm_config = xnn_init_f16_rnorm_config();
+
+  union xnn_f16_rnorm_params params;
+  if (rnorm_config != NULL && rnorm_config->init.f16 != NULL) {
+    rnorm_config->init.f16(&params, epsilon, subtract_mean);
+  }
+
+  xnn_pack_rnorm_w_fn pack_rnorm_w = (xnn_pack_rnorm_w_fn) xnn_pack_f16_rnorm_w;
+  if (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) {
+    pack_rnorm_w = (xnn_pack_rnorm_w_fn) xnn_pack_f32_to_f16_rnorm_w;
+  }
+
+  return create_rnorm_nc(
+    channels, input_stride, output_stride, epsilon,
+    gamma, beta, flags,
+    1 /* log2(sizeof(uint16_t)) */,
+    pack_rnorm_w, /*packing_params=*/NULL,
+    rnorm_config, &params, sizeof(params),
+    XNN_INIT_FLAG_F16, operator_type,
+    caches,
+    rnorm_op_out);
+}
+
+static enum xnn_status create_rnorm_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const float* gamma,
+    const float* beta,
+    bool subtract_mean,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_caches_t caches,
+    xnn_operator_t* rnorm_op_out)
+{
+  if (!is_valid_epsilon(epsilon, operator_type)) {
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_rnorm_config* rnorm_config = xnn_init_f32_rnorm_config();
+
+  union xnn_f32_rnorm_params params;
+  if (rnorm_config != NULL && rnorm_config->init.f32 != NULL) {
+    rnorm_config->init.f32(&params, epsilon, subtract_mean);
+  }
+
+  return create_rnorm_nc(
+    channels, input_stride, output_stride, epsilon,
+    gamma, beta, flags,
+    2 /* log2(sizeof(float)) */,
+    (xnn_pack_rnorm_w_fn) xnn_pack_f32_rnorm_w, /*packing_params=*/NULL,
+    rnorm_config, &params, sizeof(params),
+    XNN_INIT_FLAG_F32, operator_type,
+    caches,
+    rnorm_op_out);
+}
+
+static enum xnn_status create_rnorm_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* gamma,
+    const float* beta,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    bool subtract_mean,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_caches_t caches,
+    xnn_operator_t* rnorm_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(operator_type), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(operator_type), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(operator_type), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (!is_valid_epsilon(epsilon, operator_type)) {
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_rnorm_config* rnorm_config = xnn_init_qs8_rnorm_config();
+
+  union xnn_qs8_rnorm_params params;
+  if (rnorm_config != NULL && rnorm_config->init.qs8 != NULL) {
+    rnorm_config->init.qs8(
+      &params, epsilon, subtract_mean,
+      input_zero_point, input_scale,
+      output_zero_point, output_scale, output_min, output_max);
+  }
+
+  const struct xnn_qs8_rnorm_packing_params packing_params = {
+    .output_scale = output_scale,
+  };
+  return create_rnorm_nc(
+    channels, input_stride, output_stride, epsilon,
+    gamma, beta, flags,
+    2 /* log2(sizeof(float)) */,
+    (xnn_pack_rnorm_w_fn) xnn_pack_qs8_rnorm_w, &packing_params,
+    rnorm_config, &params, sizeof(params),
+    XNN_INIT_FLAG_QS8, operator_type,
+    caches,
+    rnorm_op_out);
+}
+
+enum xnn_status xnn_create_layer_norm_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const void* gamma,
+    const void* beta,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* layer_norm_op_out)
+{
+  return create_rnorm_nc_f16(
+    channels, input_stride, output_stride, epsilon,
+    gamma, beta, /*subtract_mean=*/true, flags,
+    xnn_operator_type_layer_norm_nc_f16,
+    caches,
+    layer_norm_op_out);
+}
+
+enum xnn_status xnn_create_layer_norm_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const float* gamma,
+    const float* beta,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* layer_norm_op_out)
+{
+  return create_rnorm_nc_f32(
+    channels, input_stride, output_stride, epsilon,
+    gamma, beta, /*subtract_mean=*/true, flags,
+    xnn_operator_type_layer_norm_nc_f32,
+    caches,
+    layer_norm_op_out);
+}
+
+enum xnn_status xnn_create_layer_norm_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* gamma,
+    const float* beta,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* layer_norm_op_out)
+{
+  return create_rnorm_nc_qs8(
+    channels, input_stride, output_stride, epsilon,
+    input_zero_point, input_scale,
+    gamma, beta,
+    output_zero_point, output_scale, output_min, output_max,
+    /*subtract_mean=*/true, flags,
+    xnn_operator_type_layer_norm_nc_qs8,
+    caches,
+    layer_norm_op_out);
+}
+
+enum xnn_status xnn_create_rms_norm_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const void* gamma,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* rms_norm_op_out)
+{
+  return create_rnorm_nc_f16(
+    channels, input_stride, output_stride, epsilon,
+    gamma, /*beta=*/NULL, /*subtract_mean=*/false, flags,
+    xnn_operator_type_rms_norm_nc_f16,
+    caches,
+    rms_norm_op_out);
+}
+
+enum xnn_status xnn_create_rms_norm_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const float* gamma,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* rms_norm_op_out)
+{
+  return create_rnorm_nc_f32(
+    channels, input_stride, output_stride, epsilon,
+    gamma, /*beta=*/NULL, /*subtract_mean=*/false, flags,
+    xnn_operator_type_rms_norm_nc_f32,
+    caches,
+    rms_norm_op_out);
+}
+
+enum xnn_status xnn_create_rms_norm_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* gamma,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* rms_norm_op_out)
+{
+  return create_rnorm_nc_qs8(
+    channels, input_stride, output_stride, epsilon,
+    input_zero_point, input_scale,
+    gamma, /*beta=*/NULL,
+    output_zero_point, output_scale, output_min, output_max,
+    /*subtract_mean=*/false, flags,
+    xnn_operator_type_rms_norm_nc_qs8,
+    caches,
+    rms_norm_op_out);
+}
+
+static enum xnn_status setup_rnorm_nc(
+    xnn_operator_t rnorm_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct xnn_rnorm_config* rnorm_config,
+    const void* params,
+    size_t params_size)
+{
+  if (rnorm_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(rnorm_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  rnorm_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (rnorm_config == NULL) {
+    xnn_log_error("failed to setup %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (batch_size == 0) {
+    rnorm_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  if (rnorm_op->weights_cache != NULL && !xnn_weights_cache_is_finalized(rnorm_op->weights_cache)) {
+    xnn_log_error("failed to setup %s operator: weights cache is not finalized",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_invalid_state;
+  }
+
+  rnorm_op->context.rnorm = (struct rnorm_context) {
+    .n = rnorm_op->channels << log2_element_size,
+    .x = input,
+    .x_stride = rnorm_op->input_pixel_stride << log2_element_size,
+    .w = packed_weights(rnorm_op),
+    .y = output,
+    .y_stride = rnorm_op->output_pixel_stride << log2_element_size,
+    .ukernel = rnorm_config->ukernel,
+  };
+  memcpy(&rnorm_op->context.rnorm.params, params, params_size);
+
+  // Each row is normalized with a single micro-kernel call, which computes the statistics and applies them while the
+  // row is still resident in L1 cache.
+  rnorm_op->compute.type = xnn_parallelization_type_1d;
+  rnorm_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_rnorm;
+  rnorm_op->compute.range[0] = batch_size;
+  rnorm_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_layer_norm_nc_f16(
+    xnn_operator_t layer_norm_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_rnorm_nc(
+    layer_norm_op, xnn_operator_type_layer_norm_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    xnn_init_f16_rnorm_config(),
+    &layer_norm_op->params.f16_rnorm, sizeof(layer_norm_op->params.f16_rnorm));
+}
+
+enum xnn_status xnn_setup_layer_norm_nc_f32(
+    xnn_operator_t layer_norm_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_rnorm_nc(
+    layer_norm_op, xnn_operator_type_layer_norm_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    xnn_init_f32_rnorm_config(),
+    &layer_norm_op->params.f32_rnorm, sizeof(layer_norm_op->params.f32_rnorm));
+}
+
+enum xnn_status xnn_setup_layer_norm_nc_qs8(
+    xnn_operator_t layer_norm_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_rnorm_nc(
+    layer_norm_op, xnn_operator_type_layer_norm_nc_qs8,
+    batch_size, input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    xnn_init_qs8_rnorm_config(),
+    &layer_norm_op->params.qs8_rnorm, sizeof(layer_norm_op->params.qs8_rnorm));
+}
+
+enum xnn_status xnn_setup_rms_norm_nc_f16(
+    xnn_operator_t rms_norm_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_rnorm_nc(
+    rms_norm_op, xnn_operator_type_rms_norm_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    xnn_init_f16_rnorm_config(),
+    &rms_norm_op->params.f16_rnorm, sizeof(rms_norm_op->params.f16_rnorm));
+}
+
+enum xnn_status xnn_setup_rms_norm_nc_f32(
+    xnn_operator_t rms_norm_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_rnorm_nc(
+    rms_norm_op, xnn_operator_type_rms_norm_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    xnn_init_f32_rnorm_config(),
+    &rms_norm_op->params.f32_rnorm, sizeof(rms_norm_op->params.f32_rnorm));
+}
+
+enum xnn_status xnn_setup_rms_norm_nc_qs8(
+    xnn_operator_t rms_norm_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_rnorm_nc(
+    rms_norm_op, xnn_operator_type_rms_norm_nc_qs8,
+    batch_size, input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    xnn_init_qs8_rnorm_config(),
+    &rms_norm_op->params.qs8_rnorm, sizeof(rms_norm_op->params.qs8_rnorm));
+}
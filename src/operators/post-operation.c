@@ -11,7 +11,8 @@
 
 char* allocate_and_initialize_post_operation_params(
     size_t num_post_operations,
-    const struct xnn_post_operation* post_operations) {
+    const struct xnn_post_operation* post_operations,
+    struct xnn_arena* arena) {
 
   union {
     union xnn_f32_hswish_params hswish_params;
@@ -35,7 +36,7 @@ char* allocate_and_initialize_post_operation_params(
     }
   }
   // Copy all params compactly into post_operation_params.
-  char* post_operation_params = xnn_allocate_zero_memory(total_size);
+  char* post_operation_params = xnn_allocate_zero_arena_memory(arena, total_size);
   char* cur_params = post_operation_params;
   for (size_t i = 0; i < num_post_operations; i++) {
     const struct xnn_post_operation post_op = post_operations[i];
@@ -79,13 +79,15 @@ static enum xnn_status create_prelu_nc(
 
   status = xnn_status_out_of_memory;
 
-  prelu_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  struct xnn_arena* arena = caches != NULL ? caches->arena : NULL;
+  prelu_op = xnn_allocate_zero_arena_simd_memory(arena, sizeof(struct xnn_operator));
   if (prelu_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
       sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
+  prelu_op->arena = arena;
 
   if (caches != NULL) {
     prelu_op->weights_cache = caches->weights_cache;
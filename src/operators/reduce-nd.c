@@ -0,0 +1,426 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/config.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/normalization.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+// Minimum number of elements (for contiguous reductions) or matrix elements (for discontiguous reductions) processed
+// by a single chunk when the innermost reduced dimension is split across threads.
+#define XNN_REDUCE_MIN_CHUNK_ELEMENTS 4096
+
+// Target number of input elements processed by a single task when tiling the innermost kept dimension.
+#define XNN_REDUCE_TASK_ELEMENTS 16384
+
+static enum xnn_operator_type get_reduce_operator_type_f32(enum xnn_reduce_operator reduce_operator)
+{
+  switch (reduce_operator) {
+    case xnn_reduce_sum:
+      return xnn_operator_type_reduce_sum_nd_f32;
+    case xnn_reduce_mean:
+      return xnn_operator_type_reduce_mean_nd_f32;
+    case xnn_reduce_max:
+      return xnn_operator_type_reduce_max_nd_f32;
+    case xnn_reduce_min:
+      return xnn_operator_type_reduce_min_nd_f32;
+    case xnn_reduce_l2:
+      return xnn_operator_type_reduce_l2_nd_f32;
+    default:
+      return xnn_operator_type_invalid;
+  }
+}
+
+static void init_reduce_nd(
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t reduce_op)
+{
+  reduce_op->type = operator_type;
+  reduce_op->flags = flags;
+  reduce_op->state = xnn_run_state_invalid;
+}
+
+enum xnn_status xnn_create_reduce_nd_f32(
+    enum xnn_reduce_operator reduce_operator,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  xnn_operator_t reduce_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  const enum xnn_operator_type operator_type = get_reduce_operator_type_f32(reduce_operator);
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (operator_type == xnn_operator_type_invalid) {
+    xnn_log_error("failed to create Reduce (ND, F32) operator: invalid reduce operator %d", (int) reduce_operator);
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F32) != XNN_INIT_FLAG_F32) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  reduce_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (reduce_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  init_reduce_nd(flags, operator_type, reduce_op);
+
+  *reduce_op_out = reduce_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(reduce_op);
+  return status;
+}
+
+static enum xnn_status setup_reduce_nd(
+    xnn_operator_t reduce_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    size_t num_threads)
+{
+  const enum xnn_operator_type operator_type = reduce_op->type;
+  reduce_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_input_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu input dimensions: the number of input dimensions must not exceed %d",
+      xnn_operator_type_to_string(operator_type), num_input_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu reduction axes: the number of reduction axes must not exceed the number "
+      "of input dimensions (%zu)",
+      xnn_operator_type_to_string(operator_type), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    if (reduction_axes[i] >= num_input_dims) {
+      xnn_log_error(
+        "failed to setup %s operator with #%zu reduction axis of %zu: the index is out of bounds for a %zuD input shape",
+        xnn_operator_type_to_string(operator_type), i, reduction_axes[i], num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && reduction_axes[i] <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to setup %s operator with #%zu reduction axis of %zu: the reduction axes must be in ascending order "
+        "and unique",
+        xnn_operator_type_to_string(operator_type), i, reduction_axes[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  size_t num_elements = 1;
+  for (size_t i = 0; i < num_input_dims; i++) {
+    num_elements *= input_shape[i];
+  }
+  if (num_elements == 0) {
+    reduce_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const struct xnn_reduce_config* reduce_config = NULL;
+  const struct xnn_reduce_config* combine_config = NULL;
+  const struct xnn_unary_elementwise_config* finalize_config = NULL;
+  uint32_t identity = 0;  // +0.0f
+  switch (operator_type) {
+    case xnn_operator_type_reduce_sum_nd_f32:
+    case xnn_operator_type_reduce_mean_nd_f32:
+      reduce_config = xnn_init_f32_rsum_config();
+      combine_config = reduce_config;
+      break;
+    case xnn_operator_type_reduce_max_nd_f32:
+      reduce_config = xnn_init_f32_rmax_config();
+      combine_config = reduce_config;
+      identity = UINT32_C(0xFF800000);  // -inf
+      break;
+    case xnn_operator_type_reduce_min_nd_f32:
+      reduce_config = xnn_init_f32_rmin_config();
+      combine_config = reduce_config;
+      identity = UINT32_C(0x7F800000);  // +inf
+      break;
+    case xnn_operator_type_reduce_l2_nd_f32:
+      reduce_config = xnn_init_f32_rsumsq_config();
+      combine_config = xnn_init_f32_rsum_config();
+      finalize_config = xnn_init_f32_sqrt_config();
+      if (finalize_config == NULL) {
+        xnn_log_error("failed to setup %s operator: unsupported hardware configuration",
+          xnn_operator_type_to_string(operator_type));
+        return xnn_status_unsupported_hardware;
+      }
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (reduce_config == NULL || combine_config == NULL) {
+    xnn_log_error("failed to setup %s operator: unsupported hardware configuration",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  size_t normalized_reduction_axes[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_input_shape[XNN_MAX_TENSOR_DIMS];
+  memcpy(normalized_reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+  memcpy(normalized_input_shape, input_shape, num_input_dims * sizeof(size_t));
+  xnn_normalize_reduction(&num_reduction_axes, normalized_reduction_axes, &num_input_dims, normalized_input_shape);
+
+  if (num_reduction_axes == 0) {
+    // Nothing left to reduce: prepend a reduced dimension of size 1, so that the whole input is processed by a single
+    // discontiguous reduction over all channels.
+    if (num_input_dims == 0) {
+      normalized_input_shape[0] = 1;
+      num_input_dims = 1;
+    }
+    assert(num_input_dims == 1);
+    normalized_input_shape[1] = normalized_input_shape[0];
+    normalized_input_shape[0] = 1;
+    normalized_reduction_axes[0] = 0;
+    num_input_dims = 2;
+    num_reduction_axes = 1;
+  }
+
+  // Pad the normalized shape with leading 1s to XNN_MAX_TENSOR_DIMS dimensions. Kept and reduced dimensions alternate,
+  // so reduced dimensions land on odd indices for contiguous reductions and on even indices otherwise.
+  const bool contiguous_reduction =
+    normalized_reduction_axes[num_reduction_axes - 1] == num_input_dims - 1;
+  size_t shape[XNN_MAX_TENSOR_DIMS];
+  const size_t num_padding_dims = XNN_MAX_TENSOR_DIMS - num_input_dims;
+  for (size_t i = 0; i < num_padding_dims; i++) {
+    shape[i] = 1;
+  }
+  memcpy(&shape[num_padding_dims], normalized_input_shape, num_input_dims * sizeof(size_t));
+
+  struct reduce_context* context = &reduce_op->context.reduce;
+  memset(context, 0, sizeof(struct reduce_context));
+  context->input = input;
+  context->output = output;
+  context->log2_element_size = log2_element_size;
+  context->identity = identity;
+  memcpy(context->input_shape, shape, sizeof(shape));
+  size_t input_stride = (size_t) 1 << log2_element_size;
+  for (size_t i = XNN_MAX_TENSOR_DIMS; i != 0; i--) {
+    context->input_stride[i - 1] = input_stride;
+    input_stride *= shape[i - 1];
+  }
+
+  size_t num_reduced_elements = 1;
+  size_t kept_shape[3];
+  for (size_t i = 0; i < 3; i++) {
+    if (contiguous_reduction) {
+      kept_shape[i] = shape[i * 2];
+      num_reduced_elements *= shape[i * 2 + 1];
+    } else {
+      kept_shape[i] = shape[i * 2 + 1];
+      num_reduced_elements *= shape[i * 2];
+    }
+  }
+  const size_t num_outputs = kept_shape[0] * kept_shape[1] * kept_shape[2];
+  context->output_stride[1] = kept_shape[2] << log2_element_size;
+  context->output_stride[0] = (kept_shape[1] * kept_shape[2]) << log2_element_size;
+
+  const float scale = operator_type == xnn_operator_type_reduce_mean_nd_f32 ? 1.0f / (float) num_reduced_elements : 1.0f;
+  reduce_config->init.f32(&context->params.f32, scale);
+  combine_config->init.f32(&context->combine_params.f32, 1.0f);
+  if (finalize_config != NULL) {
+    context->finalize_ukernel = finalize_config->ukernel;
+    if (finalize_config->init.f32_sqrt != NULL) {
+      finalize_config->init.f32_sqrt(&context->finalize_params.f32_sqrt);
+    }
+  }
+  context->combine_ukernel = combine_config->rd_ukernel;
+
+  // Tile the innermost kept dimension so that each task does a reasonable amount of work, and split the innermost
+  // reduced dimension into chunks when there are too few kept elements to keep all threads busy.
+  const size_t reduction_size = contiguous_reduction ? shape[5] : shape[4];
+  size_t output2_tile = kept_shape[2];
+  if (contiguous_reduction) {
+    context->ukernel.contiguous = reduce_config->ukernel;
+    output2_tile = min(kept_shape[2], max(XNN_REDUCE_TASK_ELEMENTS / num_reduced_elements, 1));
+  } else {
+    context->ukernel.discontiguous = reduce_config->rd_ukernel;
+    const size_t channel_tile = reduce_config->channel_tile;
+    if (num_threads > 1) {
+      const size_t num_outer_tasks = kept_shape[0] * kept_shape[1];
+      if (num_outer_tasks < num_threads) {
+        const size_t target_tiles = divide_round_up(num_threads, num_outer_tasks);
+        output2_tile = min(kept_shape[2], round_up(divide_round_up(kept_shape[2], target_tiles), channel_tile));
+      }
+    }
+  }
+  const size_t num_tasks = kept_shape[0] * kept_shape[1] * divide_round_up(kept_shape[2], output2_tile);
+
+  size_t reduction_chunk_size = reduction_size;
+  if (num_threads > 1 && num_tasks < num_threads) {
+    // Elements of input consumed per unit of the innermost reduced dimension.
+    const size_t unit_elements = contiguous_reduction ? 1 : output2_tile;
+    const size_t min_chunk_size = divide_round_up(XNN_REDUCE_MIN_CHUNK_ELEMENTS, unit_elements);
+    const size_t target_chunks = divide_round_up(num_threads, num_tasks);
+    reduction_chunk_size = max(divide_round_up(reduction_size, target_chunks), min_chunk_size);
+    if (contiguous_reduction) {
+      // Keep chunks aligned to full SIMD vectors of the widest micro-kernel.
+      reduction_chunk_size = round_up_po2(reduction_chunk_size, 16);
+    }
+    reduction_chunk_size = min(reduction_chunk_size, reduction_size);
+  }
+  const size_t num_chunks = divide_round_up(reduction_size, reduction_chunk_size);
+  context->reduction_chunk_size = reduction_chunk_size;
+  context->num_chunks = num_chunks;
+
+  if (num_chunks > 1) {
+    context->workspace_stride = num_outputs << log2_element_size;
+    const size_t workspace_size = num_chunks * context->workspace_stride + XNN_EXTRA_BYTES;
+    void* workspace = xnn_reallocate_memory(reduce_op->workspace, workspace_size);
+    if (workspace == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(operator_type));
+      return xnn_status_out_of_memory;
+    }
+    reduce_op->workspace = workspace;
+    context->workspace = workspace;
+  }
+
+  reduce_op->compute.type = xnn_parallelization_type_4d_tile_2d;
+  reduce_op->compute.task_4d_tile_2d = contiguous_reduction ?
+    (pthreadpool_task_4d_tile_2d_t) xnn_compute_contiguous_reduce :
+    (pthreadpool_task_4d_tile_2d_t) xnn_compute_discontiguous_reduce;
+  reduce_op->compute.range[0] = num_chunks;
+  reduce_op->compute.range[1] = kept_shape[0];
+  reduce_op->compute.range[2] = kept_shape[1];
+  reduce_op->compute.range[3] = kept_shape[2];
+  reduce_op->compute.tile[0] = 1;
+  reduce_op->compute.tile[1] = output2_tile;
+
+  memset(&reduce_op->compute2, 0, sizeof(reduce_op->compute2));
+  if (num_chunks > 1) {
+    const size_t combine_tile = round_up_po2(divide_round_up(num_outputs, num_threads), 16);
+    reduce_op->compute2.type = xnn_parallelization_type_1d_tile_1d;
+    reduce_op->compute2.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_reduce_combine;
+    reduce_op->compute2.range[0] = num_outputs;
+    reduce_op->compute2.tile[0] = min(combine_tile, num_outputs);
+  }
+  reduce_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_reduce_nd_f32(
+    xnn_operator_t reduce_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  switch (reduce_op->type) {
+    case xnn_operator_type_reduce_sum_nd_f32:
+    case xnn_operator_type_reduce_mean_nd_f32:
+    case xnn_operator_type_reduce_max_nd_f32:
+    case xnn_operator_type_reduce_min_nd_f32:
+    case xnn_operator_type_reduce_l2_nd_f32:
+      break;
+    default:
+      xnn_log_error("failed to setup operator: operator type mismatch (expected Reduce (ND, F32), got %s)",
+        xnn_operator_type_to_string(reduce_op->type));
+      return xnn_status_invalid_parameter;
+  }
+
+  return setup_reduce_nd(
+    reduce_op,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(float)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_run_reduce_nd_f32(
+    enum xnn_reduce_operator reduce_operator,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    uint32_t flags,
+    pthreadpool_t threadpool)
+{
+  const enum xnn_operator_type operator_type = get_reduce_operator_type_f32(reduce_operator);
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to run %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_uninitialized;
+  }
+  if (operator_type == xnn_operator_type_invalid) {
+    xnn_log_error("failed to run Reduce (ND, F32) operator: invalid reduce operator %d", (int) reduce_operator);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_operator reduce_op;
+  memset(&reduce_op, 0, sizeof(reduce_op));
+
+  init_reduce_nd(flags, operator_type, &reduce_op);
+
+  enum xnn_status status = setup_reduce_nd(
+    &reduce_op,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(float)) */,
+    pthreadpool_get_threads_count(threadpool));
+
+  if (status == xnn_status_success) {
+    status = xnn_run_operator(&reduce_op, threadpool);
+  }
+  xnn_release_memory(reduce_op.workspace);
+  return status;
+}
@@ -935,6 +935,64 @@ enum xnn_status xnn_create_elu_nc_f32(
     elu_op_out);
 }
 
+enum xnn_status xnn_create_exp_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* exp_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_exp_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  const struct xnn_unary_elementwise_config* f16_exp_config = xnn_init_f16_exp_config();
+  if (f16_exp_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_exp_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f16_exp_params params;
+  if (f16_exp_config->init.f16_exp != NULL) {
+    f16_exp_config->init.f16_exp(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_exp_nc_f16,
+    f16_exp_config,
+    exp_op_out);
+}
+
+enum xnn_status xnn_create_exp_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* exp_op_out)
+{
+  const struct xnn_unary_elementwise_config* f32_exp_config = xnn_init_f32_exp_config();
+  if (f32_exp_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_exp_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_exp_params params;
+  if (f32_exp_config->init.f32_exp != NULL) {
+    f32_exp_config->init.f32_exp(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_exp_nc_f32,
+    f32_exp_config,
+    exp_op_out);
+}
+
 enum xnn_status xnn_create_floor_nc_f16(
     size_t channels,
     size_t input_stride,
@@ -976,6 +1034,104 @@ enum xnn_status xnn_create_floor_nc_f32(
     floor_op_out);
 }
 
+enum xnn_status xnn_create_gelu_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* gelu_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (flags & XNN_FLAG_TANH_APPROXIMATION) {
+    const struct xnn_unary_elementwise_config* f16_approxgelu_config = xnn_init_f16_approxgelu_config();
+    if (f16_approxgelu_config == NULL) {
+      xnn_log_error(
+          "failed to create %s operator: unsupported hardware configuration",
+          xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f16));
+      return xnn_status_unsupported_hardware;
+    }
+    union xnn_f16_approxgelu_params params;
+    if (f16_approxgelu_config->init.f16_approxgelu != NULL) {
+      f16_approxgelu_config->init.f16_approxgelu(&params);
+    }
+    return create_unary_elementwise_nc(
+      channels, input_stride, output_stride, flags,
+      &params, sizeof(params),
+      xnn_operator_type_gelu_nc_f16,
+      f16_approxgelu_config,
+      gelu_op_out);
+  }
+
+  const struct xnn_unary_elementwise_config* f16_gelu_config = xnn_init_f16_gelu_config();
+  if (f16_gelu_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f16_gelu_params params;
+  if (f16_gelu_config->init.f16_gelu != NULL) {
+    f16_gelu_config->init.f16_gelu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_gelu_nc_f16,
+    f16_gelu_config,
+    gelu_op_out);
+}
+
+enum xnn_status xnn_create_gelu_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* gelu_op_out)
+{
+  if (flags & XNN_FLAG_TANH_APPROXIMATION) {
+    const struct xnn_unary_elementwise_config* f32_approxgelu_config = xnn_init_f32_approxgelu_config();
+    if (f32_approxgelu_config == NULL) {
+      xnn_log_error(
+          "failed to create %s operator: unsupported hardware configuration",
+          xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f32));
+      return xnn_status_unsupported_hardware;
+    }
+    union xnn_f32_approxgelu_params params;
+    if (f32_approxgelu_config->init.f32_approxgelu != NULL) {
+      f32_approxgelu_config->init.f32_approxgelu(&params);
+    }
+    return create_unary_elementwise_nc(
+      channels, input_stride, output_stride, flags,
+      &params, sizeof(params),
+      xnn_operator_type_gelu_nc_f32,
+      f32_approxgelu_config,
+      gelu_op_out);
+  }
+
+  const struct xnn_unary_elementwise_config* f32_gelu_config = xnn_init_f32_gelu_config();
+  if (f32_gelu_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_gelu_params params;
+  if (f32_gelu_config->init.f32_gelu != NULL) {
+    f32_gelu_config->init.f32_gelu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_gelu_nc_f32,
+    f32_gelu_config,
+    gelu_op_out);
+}
+
 enum xnn_status xnn_create_hardswish_nc_f16(
     size_t channels,
     size_t input_stride,
@@ -1357,6 +1513,64 @@ enum xnn_status xnn_create_sigmoid_nc_f32(
     sigmoid_op_out);
 }
 
+enum xnn_status xnn_create_silu_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* silu_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_silu_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  const struct xnn_unary_elementwise_config* f16_silu_config = xnn_init_f16_silu_config();
+  if (f16_silu_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_silu_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f16_silu_params params;
+  if (f16_silu_config->init.f16_silu != NULL) {
+    f16_silu_config->init.f16_silu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_silu_nc_f16,
+    f16_silu_config,
+    silu_op_out);
+}
+
+enum xnn_status xnn_create_silu_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* silu_op_out)
+{
+  const struct xnn_unary_elementwise_config* f32_silu_config = xnn_init_f32_silu_config();
+  if (f32_silu_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_silu_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_silu_params params;
+  if (f32_silu_config->init.f32_silu != NULL) {
+    f32_silu_config->init.f32_silu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_silu_nc_f32,
+    f32_silu_config,
+    silu_op_out);
+}
+
 enum xnn_status xnn_create_square_nc_f16(
     size_t channels,
     size_t input_stride,
@@ -1439,6 +1653,64 @@ enum xnn_status xnn_create_square_root_nc_f32(
     sqrt_op_out);
 }
 
+enum xnn_status xnn_create_tanh_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  const struct xnn_unary_elementwise_config* f16_tanh_config = xnn_init_f16_tanh_config();
+  if (f16_tanh_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f16_tanh_params params;
+  if (f16_tanh_config->init.f16_tanh != NULL) {
+    f16_tanh_config->init.f16_tanh(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_tanh_nc_f16,
+    f16_tanh_config,
+    tanh_op_out);
+}
+
+enum xnn_status xnn_create_tanh_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out)
+{
+  const struct xnn_unary_elementwise_config* f32_tanh_config = xnn_init_f32_tanh_config();
+  if (f32_tanh_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_tanh_params params;
+  if (f32_tanh_config->init.f32_tanh != NULL) {
+    f32_tanh_config->init.f32_tanh(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_tanh_nc_f32,
+    f32_tanh_config,
+    tanh_op_out);
+}
+
 enum xnn_status xnn_create_truncation_nc_f16(
     size_t channels,
     size_t input_stride,
@@ -1848,6 +2120,38 @@ enum xnn_status xnn_setup_elu_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_exp_nc_f16(
+    xnn_operator_t exp_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_unary_elementwise_nc(
+    exp_op, xnn_operator_type_exp_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &exp_op->params.f16_exp, sizeof(exp_op->params.f16_exp),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_exp_nc_f32(
+    xnn_operator_t exp_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_unary_elementwise_nc(
+    exp_op, xnn_operator_type_exp_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &exp_op->params.f32_exp, sizeof(exp_op->params.f32_exp),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_floor_nc_f16(
     xnn_operator_t floor_op,
     size_t batch_size,
@@ -1880,6 +2184,56 @@ enum xnn_status xnn_setup_floor_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_gelu_nc_f16(
+    xnn_operator_t gelu_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (gelu_op->flags & XNN_FLAG_TANH_APPROXIMATION) {
+    return setup_unary_elementwise_nc(
+      gelu_op, xnn_operator_type_gelu_nc_f16,
+      batch_size, input, output,
+      1 /* log2(sizeof(uint16_t)) */,
+      1 /* log2(sizeof(uint16_t)) */,
+      &gelu_op->params.f16_approxgelu, sizeof(gelu_op->params.f16_approxgelu),
+      pthreadpool_get_threads_count(threadpool));
+  }
+  return setup_unary_elementwise_nc(
+    gelu_op, xnn_operator_type_gelu_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &gelu_op->params.f16_gelu, sizeof(gelu_op->params.f16_gelu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_gelu_nc_f32(
+    xnn_operator_t gelu_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (gelu_op->flags & XNN_FLAG_TANH_APPROXIMATION) {
+    return setup_unary_elementwise_nc(
+      gelu_op, xnn_operator_type_gelu_nc_f32,
+      batch_size, input, output,
+      2 /* log2(sizeof(float)) */,
+      2 /* log2(sizeof(float)) */,
+      &gelu_op->params.f32_approxgelu, sizeof(gelu_op->params.f32_approxgelu),
+      pthreadpool_get_threads_count(threadpool));
+  }
+  return setup_unary_elementwise_nc(
+    gelu_op, xnn_operator_type_gelu_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &gelu_op->params.f32_gelu, sizeof(gelu_op->params.f32_gelu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_hardswish_nc_f16(
     xnn_operator_t hardswish_op,
     size_t batch_size,
@@ -2040,6 +2394,38 @@ enum xnn_status xnn_setup_sigmoid_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_silu_nc_f16(
+    xnn_operator_t silu_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_unary_elementwise_nc(
+    silu_op, xnn_operator_type_silu_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &silu_op->params.f16_silu, sizeof(silu_op->params.f16_silu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_silu_nc_f32(
+    xnn_operator_t silu_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_unary_elementwise_nc(
+    silu_op, xnn_operator_type_silu_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &silu_op->params.f32_silu, sizeof(silu_op->params.f32_silu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_square_nc_f16(
     xnn_operator_t square_op,
     size_t batch_size,
@@ -2104,6 +2490,38 @@ enum xnn_status xnn_setup_square_root_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_tanh_nc_f16(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_unary_elementwise_nc(
+    tanh_op, xnn_operator_type_tanh_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &tanh_op->params.f16_tanh, sizeof(tanh_op->params.f16_tanh),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_unary_elementwise_nc(
+    tanh_op, xnn_operator_type_tanh_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &tanh_op->params.f32_tanh, sizeof(tanh_op->params.f32_tanh),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_truncation_nc_f16(
     xnn_operator_t truncation_op,
     size_t batch_size,
@@ -2673,6 +3091,40 @@ enum xnn_status xnn_run_elu_nc_f32(
     threadpool);
 }
 
+enum xnn_status xnn_run_exp_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool)
+{
+  const struct xnn_unary_elementwise_config* f32_exp_config = xnn_init_f32_exp_config();
+  if (f32_exp_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_exp_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_exp_params params;
+  if (f32_exp_config->init.f32_exp != NULL) {
+    f32_exp_config->init.f32_exp(&params);
+  }
+  return run_unary_elementwise_nc(
+    xnn_operator_type_exp_nc_f32,
+    channels,
+    input_stride, output_stride,
+    batch_size,
+    input, output,
+    f32_exp_config,
+    &params, sizeof(params),
+    2 /* log2(sizeof(float)) */, 2 /* log2(sizeof(float)) */,
+    flags,
+    threadpool);
+}
+
 enum xnn_status xnn_run_floor_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2707,6 +3159,65 @@ enum xnn_status xnn_run_floor_nc_f32(
     threadpool);
 }
 
+enum xnn_status xnn_run_gelu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool)
+{
+  if (flags & XNN_FLAG_TANH_APPROXIMATION) {
+    const struct xnn_unary_elementwise_config* f32_approxgelu_config = xnn_init_f32_approxgelu_config();
+    if (f32_approxgelu_config == NULL) {
+      xnn_log_error(
+          "failed to create %s operator: unsupported hardware configuration",
+          xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f32));
+      return xnn_status_unsupported_hardware;
+    }
+    union xnn_f32_approxgelu_params params;
+    if (f32_approxgelu_config->init.f32_approxgelu != NULL) {
+      f32_approxgelu_config->init.f32_approxgelu(&params);
+    }
+    return run_unary_elementwise_nc(
+      xnn_operator_type_gelu_nc_f32,
+      channels,
+      input_stride, output_stride,
+      batch_size,
+      input, output,
+      f32_approxgelu_config,
+      &params, sizeof(params),
+      2 /* log2(sizeof(float)) */, 2 /* log2(sizeof(float)) */,
+      flags,
+      threadpool);
+  }
+
+  const struct xnn_unary_elementwise_config* f32_gelu_config = xnn_init_f32_gelu_config();
+  if (f32_gelu_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_gelu_params params;
+  if (f32_gelu_config->init.f32_gelu != NULL) {
+    f32_gelu_config->init.f32_gelu(&params);
+  }
+  return run_unary_elementwise_nc(
+    xnn_operator_type_gelu_nc_f32,
+    channels,
+    input_stride, output_stride,
+    batch_size,
+    input, output,
+    f32_gelu_config,
+    &params, sizeof(params),
+    2 /* log2(sizeof(float)) */, 2 /* log2(sizeof(float)) */,
+    flags,
+    threadpool);
+}
+
 enum xnn_status xnn_run_hardswish_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -2850,6 +3361,40 @@ enum xnn_status xnn_run_sigmoid_nc_f32(
     threadpool);
 }
 
+enum xnn_status xnn_run_silu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool)
+{
+  const struct xnn_unary_elementwise_config* f32_silu_config = xnn_init_f32_silu_config();
+  if (f32_silu_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_silu_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_silu_params params;
+  if (f32_silu_config->init.f32_silu != NULL) {
+    f32_silu_config->init.f32_silu(&params);
+  }
+  return run_unary_elementwise_nc(
+    xnn_operator_type_silu_nc_f32,
+    channels,
+    input_stride, output_stride,
+    batch_size,
+    input, output,
+    f32_silu_config,
+    &params, sizeof(params),
+    2 /* log2(sizeof(float)) */, 2 /* log2(sizeof(float)) */,
+    flags,
+    threadpool);
+}
+
 enum xnn_status xnn_run_square_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2918,6 +3463,40 @@ enum xnn_status xnn_run_square_root_nc_f32(
     threadpool);
 }
 
+enum xnn_status xnn_run_tanh_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  uint32_t flags,
+  pthreadpool_t threadpool)
+{
+  const struct xnn_unary_elementwise_config* f32_tanh_config = xnn_init_f32_tanh_config();
+  if (f32_tanh_config == NULL) {
+    xnn_log_error(
+        "failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f32));
+    return xnn_status_unsupported_hardware;
+  }
+  union xnn_f32_tanh_params params;
+  if (f32_tanh_config->init.f32_tanh != NULL) {
+    f32_tanh_config->init.f32_tanh(&params);
+  }
+  return run_unary_elementwise_nc(
+    xnn_operator_type_tanh_nc_f32,
+    channels,
+    input_stride, output_stride,
+    batch_size,
+    input, output,
+    f32_tanh_config,
+    &params, sizeof(params),
+    2 /* log2(sizeof(float)) */, 2 /* log2(sizeof(float)) */,
+    flags,
+    threadpool);
+}
+
 enum xnn_status xnn_run_truncation_nc_f32(
   size_t channels,
   size_t input_stride,
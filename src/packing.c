@@ -48,17 +48,28 @@ void xnn_pack_f32_gemm_goi_w(
       }
       packed_weights += nr;
 
-      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
-        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
-          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
-            const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
-            if (kc_idx < kc) {
-              packed_weights[kr_block_offset] = k[(nr_block_start + nr_block_offset) * kc + kc_idx];
+      if (skr == 1) {
+        // Without interleaving of input channels, packing transposes an nr x kc block of the kernel.
+        const float* k_block = k + nr_block_start * kc;
+        for (size_t kc_idx = 0; kc_idx < kc; kc_idx++) {
+          for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+            packed_weights[nr_block_offset] = k_block[nr_block_offset * kc + kc_idx];
+          }
+          packed_weights += nr;
+        }
+      } else {
+        for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+          for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+            for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+              const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
+              if (kc_idx < kc) {
+                packed_weights[kr_block_offset] = k[(nr_block_start + nr_block_offset) * kc + kc_idx];
+              }
             }
+            packed_weights += kr;
           }
-          packed_weights += kr;
+          packed_weights += (nr - nr_block_size) * kr;
         }
-        packed_weights += (nr - nr_block_size) * kr;
       }
       packed_weights = (float*) ((uintptr_t) packed_weights + extra_bytes);
     }
@@ -271,21 +282,40 @@ void xnn_pack_qs8_gemm_goi_w(
       }
       packed_weights = (int32_t*) packed_weights + (nr - nr_block_size);
 
-      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
-        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
-          uint32_t ksum = 0;
-          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
-            const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
-            if (kc_idx < kc) {
-              const int8_t kv = k[(nr_block_start + nr_block_offset) * kc + kc_idx];
+      if (sr == 1) {
+        // Without shuffling, every group of kr input channels is a contiguous run of a row of the kernel.
+        for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+          const size_t kr_block_size = min(kc - kr_block_start, kr);
+          for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+            const int8_t* k_row = k + (nr_block_start + nr_block_offset) * kc + kr_block_start;
+            uint32_t ksum = 0;
+            for (size_t kr_block_offset = 0; kr_block_offset < kr_block_size; kr_block_offset++) {
+              const int8_t kv = k_row[kr_block_offset];
               ksum += (uint32_t) kv;
               ((int8_t*) packed_weights)[kr_block_offset] = kv;
             }
+            unaligned_indexed_store_u32(packed_b, nr_block_offset, unaligned_indexed_load_u32(packed_b, nr_block_offset) - ksum * izp);
+            packed_weights = (int8_t*) packed_weights + kr;
           }
-          unaligned_indexed_store_u32(packed_b, nr_block_offset, unaligned_indexed_load_u32(packed_b, nr_block_offset) - ksum * izp);
-          packed_weights = (int8_t*) packed_weights + kr;
+          packed_weights = (int8_t*) packed_weights + (nr - nr_block_size) * kr;
+        }
+      } else {
+        for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+          for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+            uint32_t ksum = 0;
+            for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+              const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
+              if (kc_idx < kc) {
+                const int8_t kv = k[(nr_block_start + nr_block_offset) * kc + kc_idx];
+                ksum += (uint32_t) kv;
+                ((int8_t*) packed_weights)[kr_block_offset] = kv;
+              }
+            }
+            unaligned_indexed_store_u32(packed_b, nr_block_offset, unaligned_indexed_load_u32(packed_b, nr_block_offset) - ksum * izp);
+            packed_weights = (int8_t*) packed_weights + kr;
+          }
+          packed_weights = (int8_t*) packed_weights + (nr - nr_block_size) * kr;
         }
-        packed_weights = (int8_t*) packed_weights + (nr - nr_block_size) * kr;
       }
       packed_weights = (void*) ((uintptr_t) packed_weights + extra_bytes);
     }
@@ -3490,6 +3520,72 @@ void xnn_pack_f32_to_f16_prelu_w(
   } while (--c != 0);
 }
 
+// Normalization weights are packed as c scales followed by c offsets. Missing scales (gamma) default to 1 and
+// missing offsets (beta) default to 0.
+void xnn_pack_f32_rnorm_w(
+  size_t c,
+  const float* gamma,
+  const float* beta,
+  float* packed_weights,
+  const void* params)
+{
+  assert(packed_weights != NULL);
+
+  for (size_t i = 0; i < c; i++) {
+    packed_weights[i] = gamma != NULL ? gamma[i] : 1.0f;
+    packed_weights[c + i] = beta != NULL ? beta[i] : 0.0f;
+  }
+}
+
+void xnn_pack_f16_rnorm_w(
+  size_t c,
+  const uint16_t* gamma,
+  const uint16_t* beta,
+  uint16_t* packed_weights,
+  const void* params)
+{
+  assert(packed_weights != NULL);
+
+  for (size_t i = 0; i < c; i++) {
+    packed_weights[i] = gamma != NULL ? gamma[i] : UINT16_C(0x3C00);
+    packed_weights[c + i] = beta != NULL ? beta[i] : 0;
+  }
+}
+
+void xnn_pack_f32_to_f16_rnorm_w(
+  size_t c,
+  const float* gamma,
+  const float* beta,
+  uint16_t* packed_weights,
+  const void* params)
+{
+  assert(packed_weights != NULL);
+
+  for (size_t i = 0; i < c; i++) {
+    packed_weights[i] = gamma != NULL ? fp16_ieee_from_fp32_value(gamma[i]) : UINT16_C(0x3C00);
+    packed_weights[c + i] = beta != NULL ? fp16_ieee_from_fp32_value(beta[i]) : 0;
+  }
+}
+
+void xnn_pack_qs8_rnorm_w(
+  size_t c,
+  const float* gamma,
+  const float* beta,
+  float* packed_weights,
+  const struct xnn_qs8_rnorm_packing_params* params)
+{
+  assert(packed_weights != NULL);
+  assert(params != NULL);
+  assert(params->output_scale > 0.0f);
+
+  // Offsets are pre-divided by the output scale. The output zero point is added by the micro-kernel after rounding.
+  const float inv_output_scale = 1.0f / params->output_scale;
+  for (size_t i = 0; i < c; i++) {
+    packed_weights[i] = gamma != NULL ? gamma[i] : 1.0f;
+    packed_weights[c + i] = beta != NULL ? beta[i] * inv_output_scale : 0.0f;
+  }
+}
+
 void xnn_analyze_f32_spmm_w(
   size_t group_output_channels,
   size_t group_input_channels,
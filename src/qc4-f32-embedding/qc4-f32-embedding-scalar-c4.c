@@ -0,0 +1,91 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/math.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_qc4_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const uint8_t* i = (const uint8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      // Sign-extend each nibble by shifting it into the top bits of a 32-bit word and arithmetically shifting it back.
+      const uint32_t vx01 = (uint32_t) i[0];
+      const uint32_t vx23 = (uint32_t) i[1];
+      vacc0 += (float) math_asr_s32((int32_t) (vx01 << 28), 28) * vrow_scale;
+      vacc1 += (float) math_asr_s32((int32_t) (vx01 << 24), 28) * vrow_scale;
+      vacc2 += (float) math_asr_s32((int32_t) (vx23 << 28), 28) * vrow_scale;
+      vacc3 += (float) math_asr_s32((int32_t) (vx23 << 24), 28) * vrow_scale;
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 2;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const uint8_t* i = (const uint8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const float vrow_scale = row_scale[index];
+
+      const uint32_t vx01 = (uint32_t) i[0];
+      vacc0 += (float) math_asr_s32((int32_t) (vx01 << 28), 28) * vrow_scale;
+      if (channels >= 2) {
+        vacc1 += (float) math_asr_s32((int32_t) (vx01 << 24), 28) * vrow_scale;
+        if (channels == 3) {
+          vacc2 += (float) math_asr_s32((int32_t) ((uint32_t) i[1] << 28), 28) * vrow_scale;
+        }
+      }
+    }
+    output[0] = vacc0 * vscale;
+    if (channels >= 2) {
+      output[1] = vacc1 * vscale;
+      if (channels == 3) {
+        output[2] = vacc2 * vscale;
+      }
+    }
+  }
+}
@@ -0,0 +1,94 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_qc8_f32_embedding_ukernel__neon_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    float32x4_t vacc0 = vmovq_n_f32(0.0f);
+    float32x4_t vacc1 = vmovq_n_f32(0.0f);
+    float32x4_t vacc2 = vmovq_n_f32(0.0f);
+    float32x4_t vacc3 = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      const int8x16_t vx = vld1q_s8(i);
+      const int16x8_t vx_lo = vmovl_s8(vget_low_s8(vx));
+      const int16x8_t vx_hi = vmovl_s8(vget_high_s8(vx));
+
+      vacc0 = vmlaq_n_f32(vacc0, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx_lo))), vrow_scale);
+      vacc1 = vmlaq_n_f32(vacc1, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx_lo))), vrow_scale);
+      vacc2 = vmlaq_n_f32(vacc2, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx_hi))), vrow_scale);
+      vacc3 = vmlaq_n_f32(vacc3, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx_hi))), vrow_scale);
+    }
+    vst1q_f32(output, vmulq_f32(vacc0, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc1, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc2, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc3, vscale)); output += 4;
+    offset += 16;
+  }
+  if (channels >= 8) {
+    float32x4_t vacc_lo = vmovq_n_f32(0.0f);
+    float32x4_t vacc_hi = vmovq_n_f32(0.0f);
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const float vrow_scale = row_scale[index];
+
+      const int16x8_t vx = vmovl_s8(vld1_s8(i));
+      vacc_lo = vmlaq_n_f32(vacc_lo, vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx))), vrow_scale);
+      vacc_hi = vmlaq_n_f32(vacc_hi, vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx))), vrow_scale);
+    }
+    vst1q_f32(output, vmulq_f32(vacc_lo, vscale)); output += 4;
+    vst1q_f32(output, vmulq_f32(vacc_hi, vscale)); output += 4;
+    offset += 8;
+    channels -= 8;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      vacc += (float) (int32_t) *i * row_scale[index];
+    }
+    *output++ = vacc * vscale_tail;
+    offset += 1;
+  }
+}
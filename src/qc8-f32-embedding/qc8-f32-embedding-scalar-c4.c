@@ -0,0 +1,71 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+
+
+void xnn_qc8_f32_embedding_ukernel__scalar_c4(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const float vscale = params->scalar.scale;
+  size_t offset = 0;
+  for (; channels >= 4; channels -= 4) {
+    float vacc0 = 0.0f;
+    float vacc1 = 0.0f;
+    float vacc2 = 0.0f;
+    float vacc3 = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const float vrow_scale = row_scale[index];
+
+      vacc0 += (float) (int32_t) i[0] * vrow_scale;
+      vacc1 += (float) (int32_t) i[1] * vrow_scale;
+      vacc2 += (float) (int32_t) i[2] * vrow_scale;
+      vacc3 += (float) (int32_t) i[3] * vrow_scale;
+    }
+    output[0] = vacc0 * vscale;
+    output[1] = vacc1 * vscale;
+    output[2] = vacc2 * vscale;
+    output[3] = vacc3 * vscale;
+    output += 4;
+    offset += 4;
+  }
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      vacc += (float) (int32_t) *i * row_scale[index];
+    }
+    *output++ = vacc * vscale;
+    offset += 1;
+  }
+}
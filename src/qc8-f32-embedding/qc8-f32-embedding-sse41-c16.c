@@ -0,0 +1,93 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/embedding.h>
+#include <xnnpack/prefetch.h>
+#include <xnnpack/unaligned.h>
+
+
+void xnn_qc8_f32_embedding_ukernel__sse41_c16(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(indices != NULL);
+  assert(table != NULL);
+  assert(row_scale != NULL);
+  assert(output != NULL);
+
+  // Rows are selected by data-dependent indices, which hardware prefetchers can not predict: request the first cache
+  // line of every row up front, and the next cache line of a row while the current one is accumulated.
+  for (size_t r = 0; r < rows; r++) {
+    xnn_prefetch_to_l1((const void*) ((uintptr_t) table + (size_t) indices[r] * table_stride));
+  }
+
+  const __m128 vscale = _mm_load1_ps(&params->scalar.scale);
+  size_t offset = 0;
+  for (; channels >= 16; channels -= 16) {
+    __m128 vacc0 = _mm_setzero_ps();
+    __m128 vacc1 = _mm_setzero_ps();
+    __m128 vacc2 = _mm_setzero_ps();
+    __m128 vacc3 = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      xnn_prefetch_to_l1(i + 64);
+      const __m128 vrow_scale = _mm_load1_ps(row_scale + index);
+
+      const __m128i vx = _mm_loadu_si128((const __m128i*) i);
+      const __m128 vx0 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(vx));
+      const __m128 vx1 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(vx, 4)));
+      const __m128 vx2 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(vx, 8)));
+      const __m128 vx3 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(vx, 12)));
+
+      vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vx0, vrow_scale));
+      vacc1 = _mm_add_ps(vacc1, _mm_mul_ps(vx1, vrow_scale));
+      vacc2 = _mm_add_ps(vacc2, _mm_mul_ps(vx2, vrow_scale));
+      vacc3 = _mm_add_ps(vacc3, _mm_mul_ps(vx3, vrow_scale));
+    }
+    _mm_storeu_ps(output + 0, _mm_mul_ps(vacc0, vscale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(vacc1, vscale));
+    _mm_storeu_ps(output + 8, _mm_mul_ps(vacc2, vscale));
+    _mm_storeu_ps(output + 12, _mm_mul_ps(vacc3, vscale));
+    output += 16;
+    offset += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    __m128 vacc = _mm_setzero_ps();
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      const __m128i vx = _mm_cvtsi32_si128((int) unaligned_load_s32(i));
+      vacc = _mm_add_ps(vacc, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(vx)), _mm_load1_ps(row_scale + index)));
+    }
+    _mm_storeu_ps(output, _mm_mul_ps(vacc, vscale));
+    output += 4;
+    offset += 4;
+  }
+  const float vscale_tail = params->scalar.scale;
+  for (; channels != 0; channels -= 1) {
+    float vacc = 0.0f;
+    for (size_t r = 0; r < rows; r++) {
+      const size_t index = (size_t) indices[r];
+      const int8_t* i = (const int8_t*) ((uintptr_t) table + index * table_stride + offset);
+      vacc += (float) (int32_t) *i * row_scale[index];
+    }
+    *output++ = vacc * vscale_tail;
+    offset += 1;
+  }
+}
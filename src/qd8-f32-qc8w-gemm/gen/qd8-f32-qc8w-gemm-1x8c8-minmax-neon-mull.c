@@ -0,0 +1,172 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qd8-f32-qc8w-gemm/c8-neon-mull.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x8c8__neon_mull(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8 * sizeof(int8_t));
+  const int8_t* a0 = a;
+  float* c0 = c;
+
+  const int32_t vinput_zero_point0 = quantization_params[0].zero_point;
+  const float32x4_t vinput_scale0 = vld1q_dup_f32(&quantization_params[0].scale);
+  const float32x4_t voutput_min = vld1q_dup_f32(&params->scalar.min);
+  const float32x4_t voutput_max = vld1q_dup_f32(&params->scalar.max);
+  do {
+    // The packed weights start with the negated sums of the weights of every column, which turn the dot products of
+    // the quantized inputs into dot products of the zero-point adjusted inputs.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    const int32_t vksum4 = ((const int32_t*) w)[4];
+    const int32_t vksum5 = ((const int32_t*) w)[5];
+    const int32_t vksum6 = ((const int32_t*) w)[6];
+    const int32_t vksum7 = ((const int32_t*) w)[7];
+    int32x4_t vacc0x0 = vsetq_lane_s32(vksum0 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x1 = vsetq_lane_s32(vksum1 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x2 = vsetq_lane_s32(vksum2 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x3 = vsetq_lane_s32(vksum3 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x4 = vsetq_lane_s32(vksum4 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x5 = vsetq_lane_s32(vksum5 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x6 = vsetq_lane_s32(vksum6 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    int32x4_t vacc0x7 = vsetq_lane_s32(vksum7 * vinput_zero_point0, vmovq_n_s32(0), 0);
+    w = (const void*) ((const int32_t*) w + 8);
+
+    size_t k = kc;
+    while (k != 0) {
+      const int8x8_t va0 = vld1_s8(a0); a0 += 8;
+
+      const int8x8_t vb0 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x0 = vmull_s8(vb0, va0);
+      vacc0x0 = vpadalq_s16(vacc0x0, vprod0x0);
+      const int8x8_t vb1 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x1 = vmull_s8(vb1, va0);
+      vacc0x1 = vpadalq_s16(vacc0x1, vprod0x1);
+      const int8x8_t vb2 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x2 = vmull_s8(vb2, va0);
+      vacc0x2 = vpadalq_s16(vacc0x2, vprod0x2);
+      const int8x8_t vb3 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x3 = vmull_s8(vb3, va0);
+      vacc0x3 = vpadalq_s16(vacc0x3, vprod0x3);
+      const int8x8_t vb4 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x4 = vmull_s8(vb4, va0);
+      vacc0x4 = vpadalq_s16(vacc0x4, vprod0x4);
+      const int8x8_t vb5 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x5 = vmull_s8(vb5, va0);
+      vacc0x5 = vpadalq_s16(vacc0x5, vprod0x5);
+      const int8x8_t vb6 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x6 = vmull_s8(vb6, va0);
+      vacc0x6 = vpadalq_s16(vacc0x6, vprod0x6);
+      const int8x8_t vb7 = vld1_s8(w); w = (const void*) ((uintptr_t) w + 8 * sizeof(int8_t));
+      const int16x8_t vprod0x7 = vmull_s8(vb7, va0);
+      vacc0x7 = vpadalq_s16(vacc0x7, vprod0x7);
+
+      k -= 8 * sizeof(int8_t);
+    }
+
+#if XNN_ARCH_ARM64
+    const int32x4_t vsum0x01 = vpaddq_s32(vacc0x0, vacc0x1);
+    const int32x4_t vsum0x23 = vpaddq_s32(vacc0x2, vacc0x3);
+    const int32x4_t vsum0x45 = vpaddq_s32(vacc0x4, vacc0x5);
+    const int32x4_t vsum0x67 = vpaddq_s32(vacc0x6, vacc0x7);
+
+    int32x4_t vacc0x0123 = vpaddq_s32(vsum0x01, vsum0x23);
+    int32x4_t vacc0x4567 = vpaddq_s32(vsum0x45, vsum0x67);
+#else
+    const int32x2_t vpsum0x0 = vadd_s32(vget_low_s32(vacc0x0), vget_high_s32(vacc0x0));
+    const int32x2_t vpsum0x1 = vadd_s32(vget_low_s32(vacc0x1), vget_high_s32(vacc0x1));
+    const int32x2_t vpsum0x2 = vadd_s32(vget_low_s32(vacc0x2), vget_high_s32(vacc0x2));
+    const int32x2_t vpsum0x3 = vadd_s32(vget_low_s32(vacc0x3), vget_high_s32(vacc0x3));
+    const int32x2_t vsum0x01 = vpadd_s32(vpsum0x0, vpsum0x1);
+    const int32x2_t vsum0x23 = vpadd_s32(vpsum0x2, vpsum0x3);
+    int32x4_t vacc0x0123 = vcombine_s32(vsum0x01, vsum0x23);
+    const int32x2_t vpsum0x4 = vadd_s32(vget_low_s32(vacc0x4), vget_high_s32(vacc0x4));
+    const int32x2_t vpsum0x5 = vadd_s32(vget_low_s32(vacc0x5), vget_high_s32(vacc0x5));
+    const int32x2_t vpsum0x6 = vadd_s32(vget_low_s32(vacc0x6), vget_high_s32(vacc0x6));
+    const int32x2_t vpsum0x7 = vadd_s32(vget_low_s32(vacc0x7), vget_high_s32(vacc0x7));
+    const int32x2_t vsum0x45 = vpadd_s32(vpsum0x4, vpsum0x5);
+    const int32x2_t vsum0x67 = vpadd_s32(vpsum0x6, vpsum0x7);
+    int32x4_t vacc0x4567 = vcombine_s32(vsum0x45, vsum0x67);
+#endif
+
+    float32x4_t vout0x0123 = vmulq_f32(vcvtq_f32_s32(vacc0x0123), vinput_scale0);
+    float32x4_t vout0x4567 = vmulq_f32(vcvtq_f32_s32(vacc0x4567), vinput_scale0);
+
+    const float32x4_t vfilter_scale0123 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x0123 = vmulq_f32(vout0x0123, vfilter_scale0123);
+    const float32x4_t vfilter_scale4567 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x4567 = vmulq_f32(vout0x4567, vfilter_scale4567);
+    const float32x4_t vbias0123 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x0123 = vaddq_f32(vout0x0123, vbias0123);
+    const float32x4_t vbias4567 = vld1q_f32((const float*) w); w = (const void*) ((const float*) w + 4);
+    vout0x4567 = vaddq_f32(vout0x4567, vbias4567);
+
+    vout0x0123 = vmaxq_f32(vout0x0123, voutput_min);
+    vout0x4567 = vmaxq_f32(vout0x4567, voutput_min);
+
+    vout0x0123 = vminq_f32(vout0x0123, voutput_max);
+    vout0x4567 = vminq_f32(vout0x4567, voutput_max);
+
+    if XNN_LIKELY(nc >= 8) {
+      vst1q_f32(c0, vout0x0123);
+      vst1q_f32(c0 + 4, vout0x4567);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        vst1q_f32(c0, vout0x0123); c0 += 4;
+
+        vout0x0123 = vout0x4567;
+      }
+      float32x2_t vout0x01 = vget_low_f32(vout0x0123);
+      if (nc & 2) {
+        vst1_f32(c0, vout0x01); c0 += 2;
+
+        vout0x01 = vget_high_f32(vout0x0123);
+      }
+      if (nc & 1) {
+        vst1_lane_f32(c0, vout0x01, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,125 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_qs8_rnorm_ukernel__neon_x16(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const int8x8_t vinput_zero_point8 = vdup_n_s8((int8_t) vinput_zero_point);
+
+  // Statistics are exact: they are accumulated on zero-point-adjusted integers. The 32-bit sums of squares are
+  // flushed into 64-bit accumulators every 4096 iterations, before they could overflow.
+  const int8_t* i = input;
+  int64_t vsum = 0;
+  int64_t vsumsq = 0;
+  size_t c = channels;
+  while (c >= 16) {
+    int32x4_t vacc_sum = vmovq_n_s32(0);
+    int32x4_t vacc_sumsq = vmovq_n_s32(0);
+    size_t block = min(c >> 4, 4096);
+    c -= block << 4;
+    do {
+      const int8x16_t vx = vld1q_s8(i); i += 16;
+
+      const int16x8_t vd_lo = vsubl_s8(vget_low_s8(vx), vinput_zero_point8);
+      const int16x8_t vd_hi = vsubl_s8(vget_high_s8(vx), vinput_zero_point8);
+
+      vacc_sum = vpadalq_s16(vacc_sum, vaddq_s16(vd_lo, vd_hi));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_low_s16(vd_lo), vget_low_s16(vd_lo));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_high_s16(vd_lo), vget_high_s16(vd_lo));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_low_s16(vd_hi), vget_low_s16(vd_hi));
+      vacc_sumsq = vmlal_s16(vacc_sumsq, vget_high_s16(vd_hi), vget_high_s16(vd_hi));
+    } while (--block != 0);
+
+    const int64x2_t vsum2 = vpaddlq_s32(vacc_sum);
+    const uint64x2_t vsumsq2 = vpaddlq_u32(vreinterpretq_u32_s32(vacc_sumsq));
+    vsum += vgetq_lane_s64(vsum2, 0) + vgetq_lane_s64(vsum2, 1);
+    vsumsq += (int64_t) (vgetq_lane_u64(vsumsq2, 0) + vgetq_lane_u64(vsumsq2, 1));
+  }
+  for (; c != 0; c -= 1) {
+    const int32_t vd = (int32_t) *i++ - vinput_zero_point;
+    vsum += (int64_t) vd;
+    vsumsq += (int64_t) (vd * vd);
+  }
+
+  const float vinv_n = 1.0f / (float) channels;
+  float vmean = 0.0f;
+  float vvar = (float) vsumsq * vinv_n;
+  if (params->scalar.subtract_mean) {
+    // n^2 * variance = n * sum(d^2) - sum(d)^2 is computed exactly in 64-bit integers.
+    const int64_t vscaled_var = (int64_t) channels * vsumsq - vsum * vsum;
+    vmean = (float) vsum * vinv_n;
+    vvar = (float) vscaled_var * (vinv_n * vinv_n);
+  }
+  const float vscale = params->scalar.inv_output_scale / sqrtf(vvar + params->scalar.epsilon);
+
+  const float32x4_t vmean4 = vdupq_n_f32(vmean);
+  const float32x4_t vscale4 = vdupq_n_f32(vscale);
+  const float32x4_t voutput_min_less_zero_point = vdupq_n_f32(params->scalar.output_min_less_zero_point);
+  const float32x4_t voutput_max_less_zero_point = vdupq_n_f32(params->scalar.output_max_less_zero_point);
+  const float32x4_t vmagic_bias = vdupq_n_f32(params->scalar.magic_bias);
+  const int32x4_t vmagic_bias_less_output_zero_point = vdupq_n_s32(params->scalar.magic_bias_less_output_zero_point);
+  const float* gamma = weights;
+  const float* beta = weights + channels;
+  i = input;
+  int8_t* o = output;
+  for (c = channels; c >= 8; c -= 8) {
+    const int16x8_t vd = vsubl_s8(vld1_s8(i), vinput_zero_point8); i += 8;
+
+    const float32x4_t vgamma0 = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vgamma1 = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vbeta0 = vld1q_f32(beta); beta += 4;
+    const float32x4_t vbeta1 = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vd0 = vsubq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vd))), vmean4);
+    const float32x4_t vd1 = vsubq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vd))), vmean4);
+
+    float32x4_t vy0 = vmlaq_f32(vbeta0, vd0, vmulq_f32(vgamma0, vscale4));
+    float32x4_t vy1 = vmlaq_f32(vbeta1, vd1, vmulq_f32(vgamma1, vscale4));
+
+    vy0 = vmaxq_f32(vy0, voutput_min_less_zero_point);
+    vy1 = vmaxq_f32(vy1, voutput_min_less_zero_point);
+    vy0 = vminq_f32(vy0, voutput_max_less_zero_point);
+    vy1 = vminq_f32(vy1, voutput_max_less_zero_point);
+
+    const int32x4_t vq0 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy0, vmagic_bias)), vmagic_bias_less_output_zero_point);
+    const int32x4_t vq1 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy1, vmagic_bias)), vmagic_bias_less_output_zero_point);
+
+    const int8x8_t vy = vmovn_s16(vcombine_s16(vmovn_s32(vq0), vmovn_s32(vq1)));
+    vst1_s8(o, vy); o += 8;
+  }
+  if XNN_UNLIKELY(c != 0) {
+    const float voutput_min = params->scalar.output_min_less_zero_point;
+    const float voutput_max = params->scalar.output_max_less_zero_point;
+    const float vmagic = params->scalar.magic_bias;
+    const int32_t vmagic_less_zero_point = params->scalar.magic_bias_less_output_zero_point;
+    do {
+      const float vd = (float) ((int32_t) *i++ - vinput_zero_point) - vmean;
+      float vy = vd * (*gamma++ * vscale) + *beta++;
+      vy = math_max_f32(vy, voutput_min);
+      vy = math_min_f32(vy, voutput_max);
+      vy += vmagic;
+      *o++ = (int8_t) ((int32_t) float_as_uint32(vy) - vmagic_less_zero_point);
+    } while (--c != 0);
+  }
+}
@@ -0,0 +1,110 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_qs8_rnorm_ukernel__scalar_x4(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+
+  // Statistics are exact: they are accumulated on zero-point-adjusted integers.
+  const int8_t* i = input;
+  int32_t vsum = 0;
+  int64_t vsumsq = 0;
+  size_t c = channels;
+  for (; c >= 4; c -= 4) {
+    const int32_t vd0 = (int32_t) i[0] - vinput_zero_point;
+    const int32_t vd1 = (int32_t) i[1] - vinput_zero_point;
+    const int32_t vd2 = (int32_t) i[2] - vinput_zero_point;
+    const int32_t vd3 = (int32_t) i[3] - vinput_zero_point;
+    i += 4;
+
+    vsum += vd0 + vd1 + vd2 + vd3;
+    vsumsq += (int64_t) (vd0 * vd0 + vd1 * vd1 + vd2 * vd2 + vd3 * vd3);
+  }
+  for (; c != 0; c -= 1) {
+    const int32_t vd = (int32_t) *i++ - vinput_zero_point;
+    vsum += vd;
+    vsumsq += (int64_t) (vd * vd);
+  }
+
+  const float vinv_n = 1.0f / (float) channels;
+  float vmean = 0.0f;
+  float vvar = (float) vsumsq * vinv_n;
+  if (params->scalar.subtract_mean) {
+    // n^2 * variance = n * sum(d^2) - sum(d)^2 is computed exactly in 64-bit integers.
+    const int64_t vscaled_var = (int64_t) channels * vsumsq - (int64_t) vsum * (int64_t) vsum;
+    vmean = (float) vsum * vinv_n;
+    vvar = (float) vscaled_var * (vinv_n * vinv_n);
+  }
+  const float vscale = params->scalar.inv_output_scale / sqrtf(vvar + params->scalar.epsilon);
+
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+  const float* gamma = weights;
+  const float* beta = weights + channels;
+  i = input;
+  int8_t* o = output;
+  for (c = channels; c >= 4; c -= 4) {
+    const float vd0 = (float) ((int32_t) i[0] - vinput_zero_point) - vmean;
+    const float vd1 = (float) ((int32_t) i[1] - vinput_zero_point) - vmean;
+    const float vd2 = (float) ((int32_t) i[2] - vinput_zero_point) - vmean;
+    const float vd3 = (float) ((int32_t) i[3] - vinput_zero_point) - vmean;
+    i += 4;
+
+    float vy0 = vd0 * (gamma[0] * vscale) + beta[0];
+    float vy1 = vd1 * (gamma[1] * vscale) + beta[1];
+    float vy2 = vd2 * (gamma[2] * vscale) + beta[2];
+    float vy3 = vd3 * (gamma[3] * vscale) + beta[3];
+    gamma += 4;
+    beta += 4;
+
+    vy0 = math_max_f32(vy0, voutput_min_less_zero_point);
+    vy1 = math_max_f32(vy1, voutput_min_less_zero_point);
+    vy2 = math_max_f32(vy2, voutput_min_less_zero_point);
+    vy3 = math_max_f32(vy3, voutput_min_less_zero_point);
+
+    vy0 = math_min_f32(vy0, voutput_max_less_zero_point);
+    vy1 = math_min_f32(vy1, voutput_max_less_zero_point);
+    vy2 = math_min_f32(vy2, voutput_max_less_zero_point);
+    vy3 = math_min_f32(vy3, voutput_max_less_zero_point);
+
+    vy0 += vmagic_bias;
+    vy1 += vmagic_bias;
+    vy2 += vmagic_bias;
+    vy3 += vmagic_bias;
+
+    o[0] = (int8_t) ((int32_t) float_as_uint32(vy0) - vmagic_bias_less_output_zero_point);
+    o[1] = (int8_t) ((int32_t) float_as_uint32(vy1) - vmagic_bias_less_output_zero_point);
+    o[2] = (int8_t) ((int32_t) float_as_uint32(vy2) - vmagic_bias_less_output_zero_point);
+    o[3] = (int8_t) ((int32_t) float_as_uint32(vy3) - vmagic_bias_less_output_zero_point);
+    o += 4;
+  }
+  for (; c != 0; c -= 1) {
+    const float vd = (float) ((int32_t) *i++ - vinput_zero_point) - vmean;
+    float vy = vd * (*gamma++ * vscale) + *beta++;
+    vy = math_max_f32(vy, voutput_min_less_zero_point);
+    vy = math_min_f32(vy, voutput_max_less_zero_point);
+    vy += vmagic_bias;
+    *o++ = (int8_t) ((int32_t) float_as_uint32(vy) - vmagic_bias_less_output_zero_point);
+  }
+}
@@ -0,0 +1,130 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/rnorm.h>
+
+
+void xnn_qs8_rnorm_ukernel__sse41_x16(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(weights != NULL);
+  assert(output != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const __m128i vinput_zero_point8 = _mm_set1_epi16((short) vinput_zero_point);
+  const __m128i vone = _mm_set1_epi16(1);
+
+  // Statistics are exact: they are accumulated on zero-point-adjusted integers. The 32-bit sums of squares are
+  // flushed into 64-bit accumulators every 4096 iterations, before they could overflow.
+  const int8_t* i = input;
+  int64_t vsum = 0;
+  int64_t vsumsq = 0;
+  size_t c = channels;
+  while (c >= 16) {
+    __m128i vacc_sum = _mm_setzero_si128();
+    __m128i vacc_sumsq = _mm_setzero_si128();
+    size_t block = min(c >> 4, 4096);
+    c -= block << 4;
+    do {
+      const __m128i vx = _mm_loadu_si128((const __m128i*) i);
+      i += 16;
+
+      const __m128i vd_lo = _mm_sub_epi16(_mm_cvtepi8_epi16(vx), vinput_zero_point8);
+      const __m128i vd_hi = _mm_sub_epi16(_mm_cvtepi8_epi16(_mm_unpackhi_epi64(vx, vx)), vinput_zero_point8);
+
+      vacc_sum = _mm_add_epi32(vacc_sum, _mm_madd_epi16(_mm_add_epi16(vd_lo, vd_hi), vone));
+      vacc_sumsq = _mm_add_epi32(vacc_sumsq, _mm_madd_epi16(vd_lo, vd_lo));
+      vacc_sumsq = _mm_add_epi32(vacc_sumsq, _mm_madd_epi16(vd_hi, vd_hi));
+    } while (--block != 0);
+
+    vacc_sum = _mm_add_epi32(vacc_sum, _mm_shuffle_epi32(vacc_sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    vacc_sum = _mm_add_epi32(vacc_sum, _mm_shuffle_epi32(vacc_sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    vsum += (int64_t) _mm_cvtsi128_si32(vacc_sum);
+    vsumsq += (int64_t) _mm_cvtsi128_si32(vacc_sumsq) + (int64_t) _mm_extract_epi32(vacc_sumsq, 1) +
+      (int64_t) _mm_extract_epi32(vacc_sumsq, 2) + (int64_t) _mm_extract_epi32(vacc_sumsq, 3);
+  }
+  for (; c != 0; c -= 1) {
+    const int32_t vd = (int32_t) *i++ - vinput_zero_point;
+    vsum += (int64_t) vd;
+    vsumsq += (int64_t) (vd * vd);
+  }
+
+  const float vinv_n = 1.0f / (float) channels;
+  float vmean = 0.0f;
+  float vvar = (float) vsumsq * vinv_n;
+  if (params->scalar.subtract_mean) {
+    // n^2 * variance = n * sum(d^2) - sum(d)^2 is computed exactly in 64-bit integers.
+    const int64_t vscaled_var = (int64_t) channels * vsumsq - vsum * vsum;
+    vmean = (float) vsum * vinv_n;
+    vvar = (float) vscaled_var * (vinv_n * vinv_n);
+  }
+  const float vscale = params->scalar.inv_output_scale / sqrtf(vvar + params->scalar.epsilon);
+
+  const __m128i vinput_zero_point32 = _mm_set1_epi32(vinput_zero_point);
+  const __m128 vmean4 = _mm_set1_ps(vmean);
+  const __m128 vscale4 = _mm_set1_ps(vscale);
+  const __m128i voutput_zero_point = _mm_set1_epi16((short) params->scalar.output_zero_point);
+  const __m128i voutput_min = _mm_set1_epi8((char) params->scalar.output_min);
+  const __m128i voutput_max = _mm_set1_epi8((char) params->scalar.output_max);
+  const float* gamma = weights;
+  const float* beta = weights + channels;
+  i = input;
+  int8_t* o = output;
+  for (c = channels; c >= 16; c -= 16) {
+    const __m128i vx = _mm_loadu_si128((const __m128i*) i);
+    i += 16;
+
+    const __m128i vx_lo = _mm_cvtepi8_epi16(vx);
+    const __m128i vx_hi = _mm_cvtepi8_epi16(_mm_unpackhi_epi64(vx, vx));
+    const __m128 vd0 = _mm_sub_ps(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(vx_lo), vinput_zero_point32)), vmean4);
+    const __m128 vd1 = _mm_sub_ps(
+      _mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vx_lo, vx_lo)), vinput_zero_point32)), vmean4);
+    const __m128 vd2 = _mm_sub_ps(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(vx_hi), vinput_zero_point32)), vmean4);
+    const __m128 vd3 = _mm_sub_ps(
+      _mm_cvtepi32_ps(_mm_sub_epi32(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vx_hi, vx_hi)), vinput_zero_point32)), vmean4);
+
+    const __m128 vy0 = _mm_add_ps(_mm_mul_ps(vd0, _mm_mul_ps(_mm_loadu_ps(gamma), vscale4)), _mm_loadu_ps(beta));
+    const __m128 vy1 = _mm_add_ps(_mm_mul_ps(vd1, _mm_mul_ps(_mm_loadu_ps(gamma + 4), vscale4)), _mm_loadu_ps(beta + 4));
+    const __m128 vy2 = _mm_add_ps(_mm_mul_ps(vd2, _mm_mul_ps(_mm_loadu_ps(gamma + 8), vscale4)), _mm_loadu_ps(beta + 8));
+    const __m128 vy3 = _mm_add_ps(_mm_mul_ps(vd3, _mm_mul_ps(_mm_loadu_ps(gamma + 12), vscale4)), _mm_loadu_ps(beta + 12));
+    gamma += 16;
+    beta += 16;
+
+    const __m128i vy01 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy0), _mm_cvtps_epi32(vy1)), voutput_zero_point);
+    const __m128i vy23 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy2), _mm_cvtps_epi32(vy3)), voutput_zero_point);
+    __m128i vy = _mm_packs_epi16(vy01, vy23);
+    vy = _mm_max_epi8(vy, voutput_min);
+    vy = _mm_min_epi8(vy, voutput_max);
+
+    _mm_storeu_si128((__m128i*) o, vy);
+    o += 16;
+  }
+  if XNN_UNLIKELY(c != 0) {
+    const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+    const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+    const float vmagic_bias = params->scalar.magic_bias;
+    const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+    do {
+      const float vd = (float) ((int32_t) *i++ - vinput_zero_point) - vmean;
+      float vy = vd * (*gamma++ * vscale) + *beta++;
+      vy = math_max_f32(vy, voutput_min_less_zero_point);
+      vy = math_min_f32(vy, voutput_max_less_zero_point);
+      vy += vmagic_bias;
+      *o++ = (int8_t) ((int32_t) float_as_uint32(vy) - vmagic_bias_less_output_zero_point);
+    } while (--c != 0);
+  }
+}
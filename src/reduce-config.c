@@ -0,0 +1,318 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+#include <xnnpack/common.h>
+#include <xnnpack/config.h>
+#include <xnnpack/microparams-init.h>
+#include <xnnpack/reduce.h>
+
+static struct xnn_reduce_config f32_rmax_config = {0};
+static struct xnn_reduce_config f32_rmin_config = {0};
+static struct xnn_reduce_config f32_rminmax_config = {0};
+static struct xnn_reduce_config f32_rsum_config = {0};
+static struct xnn_reduce_config f32_rsumsq_config = {0};
+
+#if XNN_PLATFORM_WINDOWS
+  static INIT_ONCE init_guard_f32_rmax = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_rmin = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_rminmax = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_rsum = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_rsumsq = INIT_ONCE_STATIC_INIT;
+#else
+  static pthread_once_t init_guard_f32_rmax = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_rmin = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_rminmax = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_rsum = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_rsumsq = PTHREAD_ONCE_INIT;
+#endif
+
+static void init_f32_rmax_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__neon_x16;
+      f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__neon_c16;
+      f32_rmax_config.channel_tile = 16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__scalar_x4;
+      f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__scalar_c4;
+      f32_rmax_config.channel_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__neon_x16;
+    f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__neon_c16;
+    f32_rmax_config.channel_tile = 16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__avx512f_x64;
+      f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__avx512f_c64;
+      f32_rmax_config.channel_tile = 64;
+    } else if (hardware_config->use_x86_avx) {
+      f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__avx_x32;
+      f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__avx_c32;
+      f32_rmax_config.channel_tile = 32;
+    } else {
+      f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__sse_x16;
+      f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__sse_c16;
+      f32_rmax_config.channel_tile = 16;
+    }
+  #else
+    f32_rmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__scalar_x4;
+    f32_rmax_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmax_ukernel__scalar_c4;
+    f32_rmax_config.channel_tile = 4;
+  #endif
+  f32_rmax_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_f32_rmin_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__neon_x16;
+      f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__neon_c16;
+      f32_rmin_config.channel_tile = 16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__scalar_x4;
+      f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__scalar_c4;
+      f32_rmin_config.channel_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__neon_x16;
+    f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__neon_c16;
+    f32_rmin_config.channel_tile = 16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__avx512f_x64;
+      f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__avx512f_c64;
+      f32_rmin_config.channel_tile = 64;
+    } else if (hardware_config->use_x86_avx) {
+      f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__avx_x32;
+      f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__avx_c32;
+      f32_rmin_config.channel_tile = 32;
+    } else {
+      f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__sse_x16;
+      f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__sse_c16;
+      f32_rmin_config.channel_tile = 16;
+    }
+  #else
+    f32_rmin_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__scalar_x4;
+    f32_rmin_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdmin_ukernel__scalar_c4;
+    f32_rmin_config.channel_tile = 4;
+  #endif
+  f32_rmin_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_f32_rminmax_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_rminmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rminmax_ukernel__neon_x16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_rminmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rminmax_ukernel__scalar_x4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_rminmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rminmax_ukernel__neon_x16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx) {
+      f32_rminmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rminmax_ukernel__avx_x32;
+    } else {
+      f32_rminmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rminmax_ukernel__sse_x16;
+    }
+  #else
+    f32_rminmax_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rminmax_ukernel__scalar_x4;
+  #endif
+  f32_rminmax_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_f32_rsum_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__neon_x16;
+      f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__neon_c16;
+      f32_rsum_config.channel_tile = 16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__scalar_x4;
+      f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__scalar_c4;
+      f32_rsum_config.channel_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__neon_x16;
+    f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__neon_c16;
+    f32_rsum_config.channel_tile = 16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__avx512f_x64;
+      f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__avx512f_c64;
+      f32_rsum_config.channel_tile = 64;
+    } else if (hardware_config->use_x86_avx) {
+      f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__avx_x32;
+      f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__avx_c32;
+      f32_rsum_config.channel_tile = 32;
+    } else {
+      f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__sse_x16;
+      f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__sse_c16;
+      f32_rsum_config.channel_tile = 16;
+    }
+  #else
+    f32_rsum_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsum_ukernel__scalar_x4;
+    f32_rsum_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsum_ukernel__scalar_c4;
+    f32_rsum_config.channel_tile = 4;
+  #endif
+  f32_rsum_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+static void init_f32_rsumsq_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__neon_x16;
+      f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__neon_c16;
+      f32_rsumsq_config.channel_tile = 16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__scalar_x4;
+      f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__scalar_c4;
+      f32_rsumsq_config.channel_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__neon_x16;
+    f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__neon_c16;
+    f32_rsumsq_config.channel_tile = 16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__avx512f_x64;
+      f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__avx512f_c64;
+      f32_rsumsq_config.channel_tile = 64;
+    } else if (hardware_config->use_x86_avx) {
+      f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__avx_x32;
+      f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__avx_c32;
+      f32_rsumsq_config.channel_tile = 32;
+    } else {
+      f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__sse_x16;
+      f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__sse_c16;
+      f32_rsumsq_config.channel_tile = 16;
+    }
+  #else
+    f32_rsumsq_config.ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rsumsq_ukernel__scalar_x4;
+    f32_rsumsq_config.rd_ukernel = (xnn_rdreduce_ukernel_fn) xnn_f32_rdsumsq_ukernel__scalar_c4;
+    f32_rsumsq_config.channel_tile = 4;
+  #endif
+  f32_rsumsq_config.init.f32 = xnn_init_f32_scale_scalar_params;
+}
+
+#if XNN_PLATFORM_WINDOWS
+  static BOOL CALLBACK init_f32_rmax_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_rmax_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_rmin_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_rmin_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_rminmax_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_rminmax_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_rsum_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_rsum_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_rsumsq_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_rsumsq_config();
+    return TRUE;
+  }
+#endif
+
+const struct xnn_reduce_config* xnn_init_f32_rmax_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_rmax, &init_f32_rmax_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_rmax, &init_f32_rmax_config);
+  #endif
+  return &f32_rmax_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_rmin_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_rmin, &init_f32_rmin_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_rmin, &init_f32_rmin_config);
+  #endif
+  return &f32_rmin_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_rminmax_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_rminmax, &init_f32_rminmax_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_rminmax, &init_f32_rminmax_config);
+  #endif
+  return &f32_rminmax_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_rsum_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_rsum, &init_f32_rsum_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_rsum, &init_f32_rsum_config);
+  #endif
+  return &f32_rsum_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_rsumsq_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_rsumsq, &init_f32_rsumsq_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_rsumsq, &init_f32_rsumsq_config);
+  #endif
+  return &f32_rsumsq_config;
+}
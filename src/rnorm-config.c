@@ -0,0 +1,168 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+#include <xnnpack/common.h>
+#include <xnnpack/config.h>
+#include <xnnpack/microparams-init.h>
+#include <xnnpack/rnorm.h>
+
+
+static struct xnn_rnorm_config f16_rnorm_config = {0};
+static struct xnn_rnorm_config f32_rnorm_config = {0};
+static struct xnn_rnorm_config qs8_rnorm_config = {0};
+
+#if XNN_PLATFORM_WINDOWS
+  static INIT_ONCE init_guard_f16_rnorm = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_rnorm = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_qs8_rnorm = INIT_ONCE_STATIC_INIT;
+#else
+  static pthread_once_t init_guard_f16_rnorm = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_rnorm = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_qs8_rnorm = PTHREAD_ONCE_INIT;
+#endif
+
+static void init_f16_rnorm_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f16_rnorm_ukernel__neonfp16arith_x16;
+      f16_rnorm_config.init.f16 = xnn_init_f16_rnorm_scalar_params;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_f16c) {
+      f16_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f16_rnorm_ukernel__f16c_x16;
+      f16_rnorm_config.init.f16 = xnn_init_f16_rnorm_scalar_params;
+    }
+  #endif
+}
+
+static void init_f32_rnorm_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__neon_x8;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__scalar_x4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__neon_x8;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__avx512f_x32;
+    } else if (hardware_config->use_x86_avx) {
+      f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__avx_x16;
+    } else {
+      f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__sse_x8;
+    }
+  #else
+    f32_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_f32_rnorm_ukernel__scalar_x4;
+  #endif
+  f32_rnorm_config.init.f32 = xnn_init_f32_rnorm_scalar_params;
+}
+
+static void init_qs8_rnorm_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      qs8_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_qs8_rnorm_ukernel__neon_x16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      qs8_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_qs8_rnorm_ukernel__scalar_x4;
+    }
+  #elif XNN_ARCH_ARM64
+    qs8_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_qs8_rnorm_ukernel__neon_x16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_sse4_1) {
+      qs8_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_qs8_rnorm_ukernel__sse41_x16;
+    } else {
+      qs8_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_qs8_rnorm_ukernel__scalar_x4;
+    }
+  #else
+    qs8_rnorm_config.ukernel = (xnn_rnorm_ukernel_fn) xnn_qs8_rnorm_ukernel__scalar_x4;
+  #endif
+  qs8_rnorm_config.init.qs8 = xnn_init_qs8_rnorm_scalar_params;
+}
+
+#if XNN_PLATFORM_WINDOWS
+  static BOOL CALLBACK init_f16_rnorm_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_rnorm_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_rnorm_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_rnorm_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_qs8_rnorm_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_qs8_rnorm_config();
+    return TRUE;
+  }
+#endif
+
+static bool is_f16_compatible_config(const struct xnn_hardware_config hardware_config[restrict XNN_MIN_ELEMENTS(1)]) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    return hardware_config->use_arm_neon_fp16_arith;
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    return hardware_config->use_x86_avx2;
+  #else
+    return false;
+  #endif
+}
+
+const struct xnn_rnorm_config* xnn_init_f16_rnorm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_rnorm, &init_f16_rnorm_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_rnorm, &init_f16_rnorm_config);
+  #endif
+  return &f16_rnorm_config;
+}
+
+const struct xnn_rnorm_config* xnn_init_f32_rnorm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_rnorm, &init_f32_rnorm_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_rnorm, &init_f32_rnorm_config);
+  #endif
+  return &f32_rnorm_config;
+}
+
+const struct xnn_rnorm_config* xnn_init_qs8_rnorm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_qs8_rnorm, &init_qs8_rnorm_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_qs8_rnorm, &init_qs8_rnorm_config);
+  #endif
+  return &qs8_rnorm_config;
+}
@@ -20,6 +20,7 @@
 #include <xnnpack/common.h>
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
+#include <xnnpack/memory.h>
 #include <xnnpack/memory-planner.h>
 #include <xnnpack/node-type.h>
 #include <xnnpack/operator.h>
@@ -40,6 +41,11 @@
 #endif
 
 enum xnn_status xnn_create_workspace(xnn_workspace_t* workspace_out)
+{
+  return xnn_create_workspace_with_memory_flags(/*memory_flags=*/0, workspace_out);
+}
+
+enum xnn_status xnn_create_workspace_with_memory_flags(uint32_t memory_flags, xnn_workspace_t* workspace_out)
 {
   if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
     xnn_log_error("failed to create workspace: XNNPACK is not initialized");
@@ -53,10 +59,47 @@ enum xnn_status xnn_create_workspace(xnn_workspace_t* workspace_out)
     return xnn_status_out_of_memory;
   }
   workspace->ref_count = 1;
+  workspace->memory_flags = memory_flags;
   *workspace_out = workspace;
   return xnn_status_success;
 }
 
+// Workspaces with a memory policy map their data directly from the system, rather than through the allocator.
+static void* allocate_workspace_data(xnn_workspace_t workspace, size_t size)
+{
+  void* data = NULL;
+  size_t capacity = size;
+  if (workspace->memory_flags == 0) {
+    data = xnn_allocate_simd_memory(size);
+  } else {
+    data = xnn_allocate_mapped_memory(size, workspace->memory_flags, &capacity, &workspace->hugetlb);
+  }
+  workspace->capacity = data != NULL ? capacity : 0;
+  return data;
+}
+
+static void release_workspace_data(xnn_workspace_t workspace)
+{
+  if (workspace->memory_flags == 0) {
+    xnn_release_simd_memory(workspace->data);
+  } else if (workspace->data != NULL) {
+    xnn_release_mapped_memory(workspace->data, workspace->capacity);
+  }
+  workspace->data = NULL;
+  workspace->capacity = 0;
+}
+
+enum xnn_status xnn_get_workspace_memory_stats(xnn_workspace_t workspace, struct xnn_memory_stats* stats_out)
+{
+  stats_out->allocated_bytes = workspace->capacity;
+  stats_out->huge_page_bytes = 0;
+  if (workspace->memory_flags != 0 && workspace->data != NULL) {
+    stats_out->huge_page_bytes =
+      xnn_get_mapped_memory_huge_page_size(workspace->data, workspace->capacity, workspace->hugetlb);
+  }
+  return xnn_status_success;
+}
+
 static inline void xnn_retain_workspace(xnn_workspace_t workspace)
 {
   workspace->ref_count++;
@@ -66,13 +109,21 @@ enum xnn_status xnn_release_workspace(xnn_workspace_t workspace)
 {
   assert(workspace->ref_count != 0);
   if (--workspace->ref_count == 0) {
-    xnn_release_simd_memory(workspace->data);
+    release_workspace_data(workspace);
     xnn_release_memory(workspace);
   }
   return xnn_status_success;
 }
 
 enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cache_t* weights_cache_out)
+{
+  return xnn_create_weights_cache_with_memory_flags(size, /*memory_flags=*/0, weights_cache_out);
+}
+
+enum xnn_status xnn_create_weights_cache_with_memory_flags(
+  size_t size,
+  uint32_t memory_flags,
+  xnn_weights_cache_t* weights_cache_out)
 {
   struct xnn_weights_cache* weights_cache = NULL;
   enum xnn_status status = xnn_status_uninitialized;
@@ -88,7 +139,7 @@ enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cach
     goto error;
   }
 
-  status = xnn_init_weights_cache_with_size(weights_cache, size);
+  status = xnn_init_weights_cache_with_memory_flags(weights_cache, size, memory_flags);
   if (status != xnn_status_success) {
     goto error;
   }
@@ -105,6 +156,16 @@ enum xnn_status xnn_create_weights_cache(xnn_weights_cache_t* weights_cache_out)
   return xnn_create_weights_cache_with_size(XNN_DEFAULT_WEIGHTS_BUFFER_SIZE, weights_cache_out);
 }
 
+enum xnn_status xnn_get_weights_cache_memory_stats(
+  xnn_weights_cache_t weights_cache,
+  struct xnn_memory_stats* stats_out)
+{
+  const struct xnn_weights_buffer* weights = &weights_cache->cache.weights;
+  stats_out->allocated_bytes = weights->capacity;
+  stats_out->huge_page_bytes = xnn_get_weights_memory_huge_page_size(weights);
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_delete_weights_cache(xnn_weights_cache_t weights_cache)
 {
   enum xnn_status status = xnn_release_weights_cache(weights_cache);
@@ -149,6 +210,81 @@ enum xnn_status xnn_create_runtime_v3(
   return status;
 }
 
+struct create_operators_context {
+  const struct xnn_node* nodes;
+  const struct xnn_value* values;
+  size_t num_values;
+  struct xnn_operator_data* opdata;
+  const struct xnn_caches* caches;
+  enum xnn_status* status;
+};
+
+static void create_operator(
+  const struct create_operators_context* context,
+  size_t node_index)
+{
+  const struct xnn_node* node = context->nodes + node_index;
+
+  // Ignore fused nodes
+  if (node->type != xnn_node_type_invalid) {
+    assert(node->create != NULL);
+    context->status[node_index] =
+      node->create(node, context->values, context->num_values, context->opdata + node_index, context->caches);
+    context->opdata[node_index].setup = node->setup;
+  }
+}
+
+// Creates operators for all nodes of the subgraph. Most of the creation time of large models goes into packing of
+// weights, which is independent between nodes, so nodes are created in parallel on the threadpool. Generated code is
+// emitted into a single code cache, so operators are created sequentially when JIT is used.
+static enum xnn_status create_operators(
+  const struct xnn_subgraph* subgraph,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches,
+  pthreadpool_t threadpool)
+{
+  const size_t num_nodes = subgraph->num_nodes;
+  enum xnn_status* status = xnn_allocate_memory(num_nodes * sizeof(enum xnn_status));
+  if (status == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for operator creation status", num_nodes * sizeof(enum xnn_status));
+    return xnn_status_out_of_memory;
+  }
+  for (size_t i = 0; i < num_nodes; i++) {
+    status[i] = xnn_status_success;
+  }
+
+  struct create_operators_context context = {
+    .nodes = subgraph->nodes,
+    .values = subgraph->values,
+    .num_values = subgraph->num_values,
+    .opdata = opdata,
+    .caches = caches,
+    .status = status,
+  };
+  if (caches->code_cache == NULL && pthreadpool_get_threads_count(threadpool) > 1) {
+    pthreadpool_parallelize_1d(
+      threadpool, (pthreadpool_task_1d_t) create_operator, &context, num_nodes, 0 /* flags */);
+  } else {
+    for (size_t i = 0; i < num_nodes; i++) {
+      create_operator(&context, i);
+      if (status[i] != xnn_status_success) {
+        break;
+      }
+    }
+  }
+
+  // Report the failure of the first node in the subgraph order, as sequential creation would.
+  enum xnn_status first_failure = xnn_status_success;
+  for (size_t i = 0; i < num_nodes; i++) {
+    if (status[i] != xnn_status_success) {
+      first_failure = status[i];
+      break;
+    }
+  }
+  xnn_release_memory(status);
+  return first_failure;
+}
+
 static enum xnn_status initialize_workspace_blobs(
     xnn_subgraph_t subgraph,
     xnn_runtime_t runtime,
@@ -170,9 +306,9 @@ static enum xnn_status initialize_workspace_blobs(
     void* old_workspace_data = runtime->workspace->data;
     if (runtime->workspace->size != 0) {
       // Free up the workspace's current data. Free first then allocate to keep peak memory usage low.
-      xnn_release_simd_memory(runtime->workspace->data);
+      release_workspace_data(runtime->workspace);
     }
-    void* new_workspace_data = xnn_allocate_simd_memory(mem_arena_size);
+    void* new_workspace_data = allocate_workspace_data(runtime->workspace, mem_arena_size);
     if (new_workspace_data == NULL) {
       xnn_log_error("failed to allocate %zu bytes for runtime workspace", mem_arena_size);
       return xnn_status_out_of_memory;
@@ -263,21 +399,27 @@ static void optimize_tensor_allocation_for_in_place_operations(
       case xnn_node_type_copy:
       case xnn_node_type_divide:
       case xnn_node_type_elu:
+      case xnn_node_type_exp:
       case xnn_node_type_floor:
+      case xnn_node_type_gelu:
       case xnn_node_type_hardswish:
+      case xnn_node_type_layer_norm:
       case xnn_node_type_leaky_relu:
       case xnn_node_type_maximum2:
       case xnn_node_type_minimum2:
       case xnn_node_type_multiply2:
       case xnn_node_type_negate:
       case xnn_node_type_prelu:
+      case xnn_node_type_rms_norm:
       case xnn_node_type_sigmoid:
+      case xnn_node_type_silu:
       case xnn_node_type_softmax:
       case xnn_node_type_square:
       case xnn_node_type_square_root:
       case xnn_node_type_squared_difference:
       case xnn_node_type_static_reshape:
       case xnn_node_type_subtract:
+      case xnn_node_type_tanh:
         // Valid operation types that can be optimized.
         break;
       default:
@@ -315,6 +457,33 @@ static void optimize_tensor_allocation_for_in_place_operations(
   }
 }
 
+// Overhead of an allocation from the arena for the metadata of an operator with packed weights: post-operation
+// parameters, subconvolution parameters, and allocation headers.
+#define XNN_ARENA_OPERATOR_SLACK 512
+
+// Estimates the size of the arena from the subgraph, so that operator creation rarely needs more than one block.
+// Indirection buffers, which are only sized at setup, get more blocks as needed.
+static size_t estimate_arena_size(const xnn_subgraph_t subgraph)
+{
+  size_t arena_size = sizeof(struct xnn_operator_data) * subgraph->num_nodes + sizeof(struct xnn_blob) * subgraph->num_values;
+  for (size_t i = 0; i < subgraph->num_nodes; i++) {
+    switch (subgraph->nodes[i].type) {
+      case xnn_node_type_convolution_2d:
+      case xnn_node_type_deconvolution_2d:
+      case xnn_node_type_depthwise_convolution_2d:
+      case xnn_node_type_fully_connected:
+      case xnn_node_type_layer_norm:
+      case xnn_node_type_prelu:
+      case xnn_node_type_rms_norm:
+        arena_size += sizeof(struct xnn_operator) + XNN_ARENA_OPERATOR_SLACK;
+        break;
+      default:
+        break;
+    }
+  }
+  return arena_size;
+}
+
 enum xnn_status xnn_create_runtime_v4(
   xnn_subgraph_t subgraph,
   xnn_weights_cache_t weights_cache,
@@ -338,7 +507,7 @@ enum xnn_status xnn_create_runtime_v4(
   }
 
   const uint32_t optimization_flags = XNN_FLAG_SPARSE_INFERENCE | XNN_FLAG_HINT_FP16_INFERENCE |
-    XNN_FLAG_FORCE_FP16_INFERENCE | XNN_FLAG_NO_OPERATOR_FUSION;
+    XNN_FLAG_FORCE_FP16_INFERENCE | XNN_FLAG_NO_OPERATOR_FUSION | XNN_FLAG_DYNAMIC_QUANTIZATION;
   status = xnn_subgraph_optimize(subgraph, flags & optimization_flags);
   if (status != xnn_status_success) {
     xnn_log_error("failed to optimize subgraph");
@@ -353,7 +522,13 @@ enum xnn_status xnn_create_runtime_v4(
     goto error;
   }
 
-  runtime->opdata = xnn_allocate_zero_memory(sizeof(struct xnn_operator_data) * subgraph->num_nodes);
+  status = xnn_init_arena(&runtime->arena, estimate_arena_size(subgraph));
+  if (status != xnn_status_success) {
+    goto error;
+  }
+  status = xnn_status_out_of_memory;
+
+  runtime->opdata = xnn_arena_allocate(&runtime->arena, sizeof(struct xnn_operator_data) * subgraph->num_nodes);
   if (runtime->opdata == NULL) {
     xnn_log_error("failed to allocate %zu bytes for opdata descriptors",
       sizeof(struct xnn_operator_data) * (size_t) subgraph->num_nodes);
@@ -382,31 +557,24 @@ enum xnn_status xnn_create_runtime_v4(
     goto error;
   }
 #endif
+  xnn_init_indirection_cache(&runtime->indirection_cache);
   const struct xnn_caches caches = {
     .code_cache = code_cache,
     .weights_cache = weights_cache,
+    .indirection_cache = &runtime->indirection_cache,
+    .arena = &runtime->arena,
   };
 
-  struct xnn_value* values = subgraph->values;
-  for (size_t i = 0; i < subgraph->num_nodes; i++) {
-    const struct xnn_node* node = subgraph->nodes + i;
-
-    // Ignore fused nodes
-    if (node->type != xnn_node_type_invalid) {
-      assert(node->create != NULL);
-      status = node->create(node, values, subgraph->num_values, runtime->opdata + i, &caches);
-      if (status != xnn_status_success) {
-        goto error;
-      }
-      runtime->opdata[i].setup = node->setup;
-    }
+  status = create_operators(subgraph, runtime->opdata, &caches, threadpool);
+  if (status != xnn_status_success) {
+    goto error;
   }
 
 #if XNN_PLATFORM_JIT && XNN_ENABLE_JIT
   xnn_finalize_code_memory(&code_cache->cache.code);
 #endif
 
-  runtime->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * subgraph->num_values);
+  runtime->blobs = xnn_arena_allocate(&runtime->arena, sizeof(struct xnn_blob) * subgraph->num_values);
   if (runtime->blobs == NULL) {
     xnn_log_error("failed to allocate %zu bytes for blob descriptors",
       sizeof(struct xnn_blob) * (size_t) subgraph->num_values);
@@ -478,6 +646,23 @@ error:
   return status;
 }
 
+static bool operator_blobs_moved(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs)
+{
+  for (size_t i = 0; i < XNN_MAX_RUNTIME_INPUTS; i++) {
+    if (blobs[opdata->inputs[i]].data != opdata->setup_inputs_data[i]) {
+      return true;
+    }
+  }
+  for (size_t i = 0; i < XNN_MAX_RUNTIME_OUTPUTS; i++) {
+    if (blobs[opdata->outputs[i]].data != opdata->setup_outputs_data[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
 enum xnn_status xnn_setup_runtime(
   xnn_runtime_t runtime,
   size_t num_external_values,
@@ -510,12 +695,19 @@ enum xnn_status xnn_setup_runtime(
   }
 
   for (size_t i = 0; i < runtime->num_ops; i++) {
-    const struct xnn_operator_data* opdata = &runtime->opdata[i];
+    struct xnn_operator_data* opdata = &runtime->opdata[i];
     if (opdata->operator_objects[0] == NULL) {
       // Operator was removed during optimization
       continue;
     }
 
+    // Shapes are fixed at runtime creation, so an operator which was set up with the same blobs is still set up. For
+    // models where only the first and the last operators touch external values, setup with new external values only
+    // sets up these operators.
+    if (opdata->is_set_up && !operator_blobs_moved(opdata, runtime->blobs)) {
+      continue;
+    }
+
     // Ensure that weights cache is finalized.
     struct xnn_weights_cache* weights_cache = opdata->operator_objects[0]->weights_cache;
     if (weights_cache != NULL && !xnn_weights_cache_is_finalized(weights_cache)) {
@@ -524,11 +716,19 @@ enum xnn_status xnn_setup_runtime(
     }
 
     assert(opdata->setup != NULL);
+    opdata->is_set_up = false;
     const enum xnn_status status = opdata->setup(opdata, runtime->blobs, runtime->num_blobs, runtime->threadpool);
     if (status != xnn_status_success) {
       xnn_log_error("failed to setup runtime: error in operator #%zu", i);
       return status;
     }
+    for (size_t j = 0; j < XNN_MAX_RUNTIME_INPUTS; j++) {
+      opdata->setup_inputs_data[j] = runtime->blobs[opdata->inputs[j]].data;
+    }
+    for (size_t j = 0; j < XNN_MAX_RUNTIME_OUTPUTS; j++) {
+      opdata->setup_outputs_data[j] = runtime->blobs[opdata->outputs[j]].data;
+    }
+    opdata->is_set_up = true;
   }
 
   return xnn_status_success;
@@ -715,7 +915,6 @@ enum xnn_status xnn_delete_runtime(
           xnn_delete_operator(runtime->opdata[i].operator_objects[j]);
         }
       }
-      xnn_release_memory(runtime->opdata);
 
       if (runtime->blobs != NULL) {
         // Release the buffers created during FP16 rewrite.
@@ -725,7 +924,6 @@ enum xnn_status xnn_delete_runtime(
             xnn_release_memory(blob->data);
           }
         }
-        xnn_release_memory(runtime->blobs);
       }
 
       if (runtime->workspace != NULL) {
@@ -749,6 +947,9 @@ enum xnn_status xnn_delete_runtime(
 #if XNN_PLATFORM_JIT && XNN_ENABLE_JIT
     xnn_release_code_cache(&runtime->code_cache);
 #endif
+    xnn_release_indirection_cache(&runtime->indirection_cache);
+    // Operator descriptors, opdata, and blobs live in the arena, so it goes last.
+    xnn_release_arena(&runtime->arena);
     xnn_release_memory(runtime);
   }
   return xnn_status_success;
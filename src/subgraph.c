@@ -119,6 +119,35 @@ void xnn_value_copy(
   dst_value->num_consumers = src_value->num_consumers;
 }
 
+float* xnn_value_dequantize_qcint8(const struct xnn_value* value)
+{
+  assert(value->datatype == xnn_datatype_qcint8);
+  assert(value->data != NULL);
+  assert(value->quantization.channel_dimension < value->shape.num_dims);
+
+  const size_t num_elements = xnn_shape_multiply_all_dims(&value->shape);
+  float* dequantized_data = xnn_allocate_memory(num_elements * sizeof(float));
+  if (dequantized_data == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for dequantized data of Value #%" PRIu32,
+      num_elements * sizeof(float), value->id);
+    return NULL;
+  }
+
+  const size_t channel_dimension = value->quantization.channel_dimension;
+  const size_t num_channels = value->shape.dim[channel_dimension];
+  size_t channel_stride = 1;
+  for (size_t i = channel_dimension + 1; i < value->shape.num_dims; i++) {
+    channel_stride *= value->shape.dim[i];
+  }
+
+  const int8_t* data = (const int8_t*) value->data;
+  const float* channelwise_scale = value->quantization.channelwise_scale;
+  for (size_t i = 0; i < num_elements; i++) {
+    dequantized_data[i] = (float) data[i] * channelwise_scale[(i / channel_stride) % num_channels];
+  }
+  return dequantized_data;
+}
+
 struct xnn_node* xnn_subgraph_new_node(xnn_subgraph_t subgraph)
 {
   struct xnn_node* nodes = subgraph->nodes;
@@ -453,12 +482,16 @@ uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node*
     case xnn_node_type_ceiling:
     case xnn_node_type_clamp:
     case xnn_node_type_elu:
+    case xnn_node_type_exp:
     case xnn_node_type_floor:
+    case xnn_node_type_gelu:
     case xnn_node_type_hardswish:
     case xnn_node_type_leaky_relu:
     case xnn_node_type_negate:
     case xnn_node_type_sigmoid:
+    case xnn_node_type_silu:
     case xnn_node_type_square:
+    case xnn_node_type_tanh:
       assert(node->num_inputs == 1);
       assert(node->num_outputs == 1);
       if (subgraph->values[node->inputs[0]].shape.num_dims == 4) {
@@ -723,12 +756,15 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_abs:
       case xnn_node_type_add2:
       case xnn_node_type_divide:
+      case xnn_node_type_exp:
+      case xnn_node_type_gelu:
       case xnn_node_type_maximum2:
       case xnn_node_type_minimum2:
       case xnn_node_type_multiply2:
       case xnn_node_type_concatenate2:
       case xnn_node_type_concatenate3:
       case xnn_node_type_concatenate4:
+      case xnn_node_type_silu:
       case xnn_node_type_squared_difference:
       case xnn_node_type_subtract:
       case xnn_node_type_average_pooling_2d:
@@ -748,10 +784,12 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_fully_connected:
       case xnn_node_type_global_average_pooling_2d:
       case xnn_node_type_hardswish:
+      case xnn_node_type_layer_norm:
       case xnn_node_type_leaky_relu:
       case xnn_node_type_max_pooling_2d:
       case xnn_node_type_negate:
       case xnn_node_type_prelu:
+      case xnn_node_type_rms_norm:
       case xnn_node_type_sigmoid:
       case xnn_node_type_softmax:
       case xnn_node_type_static_constant_pad:
@@ -760,6 +798,7 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_static_transpose:
       case xnn_node_type_square:
       case xnn_node_type_square_root:
+      case xnn_node_type_tanh:
         break;
       default:
         xnn_log_warning("FP16 rewrite aborted: node #%" PRIu32 " (%s) is not supported for FP16 inference",
@@ -769,7 +808,7 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
   }
 
   // Annotate Values to be converted to FP16 as FP16-compatible.
-  // Note that static weights in [Depthwise] Convolution, Fully Connected, and PReLU Nodes remain FP32,
+  // Note that static weights in [Depthwise] Convolution, Fully Connected, PReLU, and normalization Nodes remain FP32,
   // they will be converted to FP16 during weight repacking when the operator is created.
   for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
     struct xnn_node* node = &subgraph->nodes[n];
@@ -778,7 +817,9 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_deconvolution_2d:
       case xnn_node_type_depthwise_convolution_2d:
       case xnn_node_type_fully_connected:
+      case xnn_node_type_layer_norm:
       case xnn_node_type_prelu:
+      case xnn_node_type_rms_norm:
         subgraph->values[node->inputs[0]].fp16_compatible = true;
         subgraph->values[node->outputs[0]].fp16_compatible = true;
         break;
@@ -1191,6 +1232,40 @@ enum xnn_status xnn_subgraph_fusion(
   return xnn_status_success;
 }
 
+void xnn_subgraph_rewrite_for_dynamic_quantization(xnn_subgraph_t subgraph)
+{
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->compute_type != xnn_compute_type_fp32_qc8w) {
+      continue;
+    }
+
+    switch (node->type) {
+      case xnn_node_type_fully_connected:
+        if (node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+          continue;
+        }
+        break;
+      case xnn_node_type_convolution_2d:
+        // Only pointwise Convolutions map onto a GEMM over the pixels without an indirection buffer.
+        if (node->params.convolution_2d.groups != 1 ||
+            node->params.convolution_2d.kernel_height != 1 || node->params.convolution_2d.kernel_width != 1 ||
+            node->params.convolution_2d.subsampling_height != 1 || node->params.convolution_2d.subsampling_width != 1 ||
+            (node->params.convolution_2d.input_padding_top | node->params.convolution_2d.input_padding_right |
+             node->params.convolution_2d.input_padding_bottom | node->params.convolution_2d.input_padding_left) != 0 ||
+            (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING))
+        {
+          continue;
+        }
+        break;
+      default:
+        continue;
+    }
+    xnn_log_info("quantize inputs of %s Node #%" PRIu32 " at runtime", xnn_node_type_to_string(node->type), n);
+    node->compute_type = xnn_compute_type_qd8_to_fp32;
+  }
+}
+
 enum xnn_status xnn_subgraph_optimize(
   xnn_subgraph_t subgraph,
   uint32_t flags)
@@ -1219,6 +1294,10 @@ enum xnn_status xnn_subgraph_optimize(
     xnn_subgraph_fusion(subgraph);
   }
 
+  if (flags & XNN_FLAG_DYNAMIC_QUANTIZATION) {
+    xnn_subgraph_rewrite_for_dynamic_quantization(subgraph);
+  }
+
   if ((flags & XNN_FLAG_FORCE_FP16_INFERENCE) && !(xnn_params.init_flags & XNN_INIT_FLAG_F16)) {
     xnn_log_error("failed to force FP16 inference: hardware supports neither native nor emulated FP16 operators");
     return xnn_status_unsupported_hardware;
@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <xnnpack.h>
+#include <xnnpack/allocator.h>
 #include <xnnpack/log.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
@@ -167,6 +168,57 @@ static enum xnn_status create_convolution_operator(
         break;
 #endif  // XNN_NO_F16_OPERATORS
 #ifndef XNN_NO_QS8_OPERATORS
+      case xnn_compute_type_fp32_qc8w:
+      {
+        float* dequantized_filter_data = xnn_value_dequantize_qcint8(&values[filter_id]);
+        if (dequantized_filter_data == NULL) {
+          return xnn_status_out_of_memory;
+        }
+        status = xnn_create_convolution2d_nhwc_f32(
+          node->params.convolution_2d.input_padding_top,
+          node->params.convolution_2d.input_padding_right,
+          node->params.convolution_2d.input_padding_bottom,
+          node->params.convolution_2d.input_padding_left,
+          node->params.convolution_2d.kernel_height,
+          node->params.convolution_2d.kernel_width,
+          node->params.convolution_2d.subsampling_height,
+          node->params.convolution_2d.subsampling_width,
+          node->params.convolution_2d.dilation_height,
+          node->params.convolution_2d.dilation_width,
+          node->params.convolution_2d.groups,
+          node->params.convolution_2d.group_input_channels,
+          node->params.convolution_2d.group_output_channels,
+          node->params.convolution_2d.group_input_channels * node->params.convolution_2d.groups /* input_pixel_stride */,
+          node->params.convolution_2d.group_output_channels * node->params.convolution_2d.groups /* output_pixel_stride */,
+          dequantized_filter_data,
+          bias_data,
+          node->activation.output_min,
+          node->activation.output_max,
+          node->flags,
+          caches,
+          &opdata->operator_objects[0]);
+        xnn_release_memory(dequantized_filter_data);
+        break;
+      }
+      case xnn_compute_type_qd8_to_fp32:
+        // Pointwise Convolution is a Fully Connected operator over all pixels in the batch.
+        assert(node->params.convolution_2d.groups == 1);
+        assert(node->params.convolution_2d.kernel_height == 1);
+        assert(node->params.convolution_2d.kernel_width == 1);
+        status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
+          node->params.convolution_2d.group_input_channels,
+          node->params.convolution_2d.group_output_channels,
+          node->params.convolution_2d.group_input_channels /* input stride */,
+          node->params.convolution_2d.group_output_channels /* output stride */,
+          values[filter_id].quantization.channelwise_scale,
+          filter_data,
+          bias_data,
+          node->activation.output_min,
+          node->activation.output_max,
+          0 /* flags */,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
       case xnn_compute_type_qs8:
       {
         const float output_scale = values[output_id].quantization.scale;
@@ -355,6 +407,14 @@ static enum xnn_status setup_convolution_operator(
       break;
 #endif  // !defined(XNN_NO_F16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_fully_connected_nc_qd8_f32_qc8w:
+      return xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+        opdata->operator_objects[0],
+        opdata->batch_size * opdata->input_height * opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+      break;
     case xnn_operator_type_convolution_nhwc_qc8:
       return xnn_setup_convolution2d_nhwc_qc8(
         opdata->operator_objects[0],
@@ -424,6 +484,12 @@ static inline enum xnn_compute_type validate_datatypes_with_bias(
       {
         return xnn_compute_type_qc8;
       }
+      if (input_datatype == xnn_datatype_fp32 &&
+          bias_datatype == xnn_datatype_fp32 &&
+          output_datatype == xnn_datatype_fp32)
+      {
+        return xnn_compute_type_fp32_qc8w;
+      }
       break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
 #ifndef XNN_NO_QU8_OPERATORS
@@ -463,6 +529,9 @@ static inline enum xnn_compute_type validate_datatypes_without_bias(
       if (input_datatype == xnn_datatype_qint8 && output_datatype == xnn_datatype_qint8) {
         return xnn_compute_type_qc8;
       }
+      if (input_datatype == xnn_datatype_fp32 && output_datatype == xnn_datatype_fp32) {
+        return xnn_compute_type_fp32_qc8w;
+      }
       break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
 #ifndef XNN_NO_QU8_OPERATORS
@@ -769,8 +838,7 @@ enum xnn_status xnn_define_convolution_2d(
       return xnn_status_invalid_parameter;
     }
 
-    if (bias_value != NULL) {
-      assert(bias_value->datatype == xnn_datatype_qcint32);
+    if (bias_value != NULL && bias_value->datatype == xnn_datatype_qcint32) {
       if (bias_value->quantization.channel_dimension != 0) {
         xnn_log_error(
           "failed to define %s operator with bias ID #%" PRIu32 ": invalid channel dimension %zu",
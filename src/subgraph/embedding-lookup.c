@@ -0,0 +1,321 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_embedding_lookup_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 2);
+  const uint32_t table_id = node->inputs[0];
+  assert(table_id != XNN_INVALID_VALUE_ID);
+  assert(table_id < num_values);
+  const uint32_t indices_id = node->inputs[1];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_value* table_value = &values[table_id];
+  const struct xnn_value* indices_value = &values[indices_id];
+  assert(table_value->data != NULL);
+  assert(table_value->shape.num_dims == 2);
+  const size_t num_embeddings = table_value->shape.dim[0];
+  const size_t embedding_dim = table_value->shape.dim[1];
+  const enum xnn_embedding_pooling pooling = node->params.embedding_lookup.pooling;
+
+  enum xnn_status status;
+  switch (table_value->datatype) {
+    case xnn_datatype_fp16:
+      status = xnn_create_embedding_lookup_nc_f16_f32(
+        num_embeddings, embedding_dim, table_value->data, pooling,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    case xnn_datatype_fp32:
+      status = xnn_create_embedding_lookup_nc_f32(
+        num_embeddings, embedding_dim, table_value->data, pooling,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    case xnn_datatype_qcint4:
+      status = xnn_create_embedding_lookup_nc_qc4_f32(
+        num_embeddings, embedding_dim, table_value->data, table_value->quantization.channelwise_scale, pooling,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    case xnn_datatype_qcint8:
+      status = xnn_create_embedding_lookup_nc_qc8_f32(
+        num_embeddings, embedding_dim, table_value->data, table_value->quantization.channelwise_scale, pooling,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    // With pooling, the innermost dimension of the indices enumerates the rows of a bag; otherwise every index is a
+    // separate lookup.
+    const size_t num_indices = xnn_shape_multiply_all_dims(&indices_value->shape);
+    size_t bag_size = 1;
+    if (pooling != xnn_embedding_pooling_none) {
+      bag_size = indices_value->shape.dim[indices_value->shape.num_dims - 1];
+    }
+    opdata->batch_size = bag_size == 0 ? 0 : num_indices / bag_size;
+    opdata->input_width = bag_size;
+    opdata->inputs[0] = indices_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_embedding_lookup_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t indices_id = opdata->inputs[0];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* indices_blob = blobs + indices_id;
+  const int32_t* indices_data = indices_blob->data;
+  assert(indices_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  float* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_embedding_lookup_nc_f16_f32:
+      return xnn_setup_embedding_lookup_nc_f16_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        indices_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_embedding_lookup_nc_f32:
+      return xnn_setup_embedding_lookup_nc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        indices_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_embedding_lookup_nc_qc4_f32:
+      return xnn_setup_embedding_lookup_nc_qc4_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        indices_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_embedding_lookup_nc_qc8_f32:
+      return xnn_setup_embedding_lookup_nc_qc8_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        indices_data,
+        output_data,
+        threadpool);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_define_embedding_lookup(
+  xnn_subgraph_t subgraph,
+  enum xnn_embedding_pooling pooling,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const enum xnn_node_type node_type = xnn_node_type_embedding_lookup;
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(node_type)) != xnn_status_success) {
+    return status;
+  }
+
+  switch (pooling) {
+    case xnn_embedding_pooling_none:
+    case xnn_embedding_pooling_sum:
+    case xnn_embedding_pooling_mean:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator: invalid pooling mode %d",
+        xnn_node_type_to_string(node_type), (int) pooling);
+      return xnn_status_invalid_parameter;
+  }
+
+  if ((status = xnn_subgraph_check_nth_input_node_id(node_type, table_id, subgraph->num_values, 1)) !=
+      xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_value* table_value = &subgraph->values[table_id];
+  status = xnn_subgraph_check_nth_input_type_dense(node_type, table_id, table_value, 1);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (table_value->data == NULL) {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 ": non-static Value",
+      xnn_node_type_to_string(node_type), table_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (table_value->shape.num_dims != 2) {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 ": unsupported number of dimensions %zu (expected 2)",
+      xnn_node_type_to_string(node_type), table_id, table_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (table_value->datatype) {
+    case xnn_datatype_fp16:
+    case xnn_datatype_fp32:
+      break;
+    case xnn_datatype_qcint4:
+    case xnn_datatype_qcint8:
+      if (table_value->quantization.channel_dimension != 0) {
+        xnn_log_error(
+          "failed to define %s operator with table ID #%" PRIu32 ": invalid channel dimension %zu "
+          "(quantization scales must be per embedding)",
+          xnn_node_type_to_string(node_type), table_id, table_value->quantization.channel_dimension);
+        return xnn_status_invalid_parameter;
+      }
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with table ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), table_id,
+        xnn_datatype_to_string(table_value->datatype), table_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if ((status = xnn_subgraph_check_nth_input_node_id(node_type, indices_id, subgraph->num_values, 2)) !=
+      xnn_status_success)
+  {
+    return status;
+  }
+
+  const struct xnn_value* indices_value = &subgraph->values[indices_id];
+  status = xnn_subgraph_check_nth_input_type_dense(node_type, indices_id, indices_value, 2);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (indices_value->datatype != xnn_datatype_int32) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(node_type), indices_id,
+      xnn_datatype_to_string(indices_value->datatype), indices_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (pooling != xnn_embedding_pooling_none && indices_value->shape.num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": pooled lookups require at least 1D indices",
+      xnn_node_type_to_string(node_type), indices_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_output_node_id(node_type, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(node_type, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_value->datatype != xnn_datatype_fp32) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(node_type), output_id,
+      xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  // The output has the shape of the indices with the embedding dimension appended; pooling replaces the innermost
+  // dimension of the indices (the bag) with the embedding dimension.
+  const size_t num_outer_dims =
+    pooling == xnn_embedding_pooling_none ? indices_value->shape.num_dims : indices_value->shape.num_dims - 1;
+  if (output_value->shape.num_dims != num_outer_dims + 1) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": number of dimensions %zu does not match the expected "
+      "number of dimensions %zu",
+      xnn_node_type_to_string(node_type), output_id, output_value->shape.num_dims, num_outer_dims + 1);
+    return xnn_status_invalid_parameter;
+  }
+  for (size_t i = 0; i < num_outer_dims; i++) {
+    if (output_value->shape.dim[i] != indices_value->shape.dim[i]) {
+      xnn_log_error(
+        "failed to define %s operator with indices ID #%" PRIu32 " and output ID #%" PRIu32 ": "
+        "mismatch in dimension %zu (%zu != %zu)",
+        xnn_node_type_to_string(node_type), indices_id, output_id, i,
+        indices_value->shape.dim[i], output_value->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+  if (output_value->shape.dim[num_outer_dims] != table_value->shape.dim[1]) {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 " and output ID #%" PRIu32 ": "
+      "innermost output dimension %zu does not match the embedding dimension %zu",
+      xnn_node_type_to_string(node_type), table_id, output_id,
+      output_value->shape.dim[num_outer_dims], table_value->shape.dim[1]);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = node_type;
+  node->compute_type = xnn_compute_type_fp32;
+  node->params.embedding_lookup.pooling = pooling;
+  node->num_inputs = 2;
+  node->inputs[0] = table_id;
+  node->inputs[1] = indices_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_embedding_lookup_operator;
+  node->setup = setup_embedding_lookup_operator;
+
+  return xnn_status_success;
+}
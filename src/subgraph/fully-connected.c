@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <xnnpack.h>
+#include <xnnpack/allocator.h>
 #include <xnnpack/log.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
@@ -94,6 +95,43 @@ static enum xnn_status create_fully_connected_operator(
         &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_fp32_qc8w:
+    {
+      float* dequantized_filter_data = xnn_value_dequantize_qcint8(&values[filter_id]);
+      if (dequantized_filter_data == NULL) {
+        return xnn_status_out_of_memory;
+      }
+      status = xnn_create_fully_connected_nc_f32(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        dequantized_filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags /* flags */,
+        caches,
+        &opdata->operator_objects[0]);
+      xnn_release_memory(dequantized_filter_data);
+      break;
+    }
+    case xnn_compute_type_qd8_to_fp32:
+      assert(!(node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS));
+      status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        values[filter_id].quantization.channelwise_scale,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags /* flags */,
+        caches,
+        &opdata->operator_objects[0]);
+      break;
     case xnn_compute_type_qs8:
     {
       const float output_scale = values[output_id].quantization.scale;
@@ -195,6 +233,13 @@ static enum xnn_status setup_fully_connected_operator(
         output_data,
         threadpool);
 #ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_fully_connected_nc_qd8_f32_qc8w:
+      return xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
     case xnn_operator_type_fully_connected_nc_qs8:
       return xnn_setup_fully_connected_nc_qs8(
         opdata->operator_objects[0],
@@ -241,6 +286,14 @@ static inline enum xnn_compute_type validate_datatypes_with_bias(
         return xnn_compute_type_qs8;
       }
       break;
+    case xnn_datatype_qcint8:
+      if (input_datatype == xnn_datatype_fp32 &&
+          bias_datatype == xnn_datatype_fp32 &&
+          output_datatype == xnn_datatype_fp32)
+      {
+        return xnn_compute_type_fp32_qc8w;
+      }
+      break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_datatype_quint8:
@@ -275,6 +328,11 @@ static inline enum xnn_compute_type validate_datatypes_without_bias(
         return xnn_compute_type_qs8;
       }
       break;
+    case xnn_datatype_qcint8:
+      if (input_datatype == xnn_datatype_fp32 && output_datatype == xnn_datatype_fp32) {
+        return xnn_compute_type_fp32_qc8w;
+      }
+      break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_datatype_quint8:
@@ -371,6 +429,17 @@ enum xnn_status xnn_define_fully_connected(
           filter_value->quantization.zero_point, xnn_datatype_to_string(filter_value->datatype));
       }
       break;
+    case xnn_datatype_qcint8:
+      // Channelwise quantization must follow the output channels, which are the first dimension of the filter, or the
+      // last one with transposed weights.
+      if (filter_value->quantization.channel_dimension != ((flags & XNN_FLAG_TRANSPOSE_WEIGHTS) ? 1 : 0)) {
+        xnn_log_error(
+          "failed to define %s operator with filter ID #%" PRIu32 ": invalid channel dimension %zu",
+          xnn_node_type_to_string(xnn_node_type_fully_connected), filter_id,
+          filter_value->quantization.channel_dimension);
+        return xnn_status_invalid_parameter;
+      }
+      break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_datatype_quint8:
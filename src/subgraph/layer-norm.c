@@ -0,0 +1,484 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/normalization.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static size_t reduced_elements(
+  const struct xnn_node* node,
+  const struct xnn_shape* input_shape)
+{
+  size_t num_elements = 1;
+  for (size_t i = 0; i < node->params.normalization.num_reduction_axes; i++) {
+    num_elements *= input_shape->dim[node->params.normalization.reduction_axes[i]];
+  }
+  return num_elements;
+}
+
+static enum xnn_status create_rnorm_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs >= 2);
+  assert(node->num_inputs <= 3);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t gamma_id = node->inputs[1];
+  assert(gamma_id != XNN_INVALID_VALUE_ID);
+  assert(gamma_id < num_values);
+  const void* beta_data = NULL;
+  if (node->num_inputs > 2) {
+    const uint32_t beta_id = node->inputs[2];
+    assert(beta_id != XNN_INVALID_VALUE_ID);
+    assert(beta_id < num_values);
+    beta_data = values[beta_id].data;
+  }
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_value* input_value = &values[input_id];
+  const struct xnn_value* output_value = &values[output_id];
+  const size_t channels = reduced_elements(node, &input_value->shape);
+  const float epsilon = node->params.normalization.epsilon;
+  const void* gamma_data = values[gamma_id].data;
+
+  enum xnn_status status;
+  if (node->type == xnn_node_type_layer_norm) {
+    switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_compute_type_fp16:
+        status = xnn_create_layer_norm_nc_f16(
+          channels /* channels */, channels /* input stride */, channels /* output stride */,
+          epsilon, gamma_data, beta_data,
+          node->flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+      case xnn_compute_type_fp32:
+        status = xnn_create_layer_norm_nc_f32(
+          channels /* channels */, channels /* input stride */, channels /* output stride */,
+          epsilon, gamma_data, beta_data,
+          node->flags,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_compute_type_qs8:
+        status = xnn_create_layer_norm_nc_qs8(
+          channels /* channels */, channels /* input stride */, channels /* output stride */,
+          epsilon,
+          (int8_t) input_value->quantization.zero_point, input_value->quantization.scale,
+          gamma_data, beta_data,
+          (int8_t) output_value->quantization.zero_point, output_value->quantization.scale,
+          INT8_MIN, INT8_MAX,
+          node->flags,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      default:
+        XNN_UNREACHABLE;
+    }
+  } else {
+    assert(node->type == xnn_node_type_rms_norm);
+    switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_compute_type_fp16:
+        status = xnn_create_rms_norm_nc_f16(
+          channels /* channels */, channels /* input stride */, channels /* output stride */,
+          epsilon, gamma_data,
+          node->flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+      case xnn_compute_type_fp32:
+        status = xnn_create_rms_norm_nc_f32(
+          channels /* channels */, channels /* input stride */, channels /* output stride */,
+          epsilon, gamma_data,
+          node->flags,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_compute_type_qs8:
+        status = xnn_create_rms_norm_nc_qs8(
+          channels /* channels */, channels /* input stride */, channels /* output stride */,
+          epsilon,
+          (int8_t) input_value->quantization.zero_point, input_value->quantization.scale,
+          gamma_data,
+          (int8_t) output_value->quantization.zero_point, output_value->quantization.scale,
+          INT8_MIN, INT8_MAX,
+          node->flags,
+          caches,
+          &opdata->operator_objects[0]);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      default:
+        XNN_UNREACHABLE;
+    }
+  }
+  if (status == xnn_status_success) {
+    opdata->batch_size = xnn_shape_multiply_all_dims(&input_value->shape) / channels;
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_rnorm_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_layer_norm_nc_f16:
+      return xnn_setup_layer_norm_nc_f16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_rms_norm_nc_f16:
+      return xnn_setup_rms_norm_nc_f16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_layer_norm_nc_f32:
+      return xnn_setup_layer_norm_nc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_rms_norm_nc_f32:
+      return xnn_setup_rms_norm_nc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_layer_norm_nc_qs8:
+      return xnn_setup_layer_norm_nc_qs8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_rms_norm_nc_qs8:
+      return xnn_setup_rms_norm_nc_qs8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status check_rnorm_weights(
+  enum xnn_node_type node_type,
+  xnn_subgraph_t subgraph,
+  const char* weights_name,
+  uint32_t weights_id,
+  size_t expected_num_elements)
+{
+  if (weights_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(node_type), weights_name, weights_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* weights_value = &subgraph->values[weights_id];
+  if (weights_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(node_type), weights_name, weights_id, weights_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (weights_value->data == NULL) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": non-static Value",
+      xnn_node_type_to_string(node_type), weights_name, weights_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (weights_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), weights_name, weights_id,
+        xnn_datatype_to_string(weights_value->datatype), weights_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_elements = xnn_shape_multiply_all_dims(&weights_value->shape);
+  if (num_elements != expected_num_elements) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": "
+      "number of elements (%zu) does not match the number of reduced input elements (%zu)",
+      xnn_node_type_to_string(node_type), weights_name, weights_id, num_elements, expected_num_elements);
+    return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+static enum xnn_status define_rnorm(
+  xnn_subgraph_t subgraph,
+  enum xnn_node_type node_type,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(node_type)) != xnn_status_success) {
+    return status;
+  }
+
+  if (!(epsilon >= 0.0f) || !isfinite(epsilon)) {
+    xnn_log_error(
+      "failed to define %s operator with %.7g epsilon: epsilon must be finite and non-negative",
+      xnn_node_type_to_string(node_type), epsilon);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((status = xnn_subgraph_check_input_node_id(node_type, input_id, subgraph->num_values)) != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(node_type, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  if (num_reduction_axes == 0 || num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to define %s operator with %zu reduction axes: the number of reduction axes must be in [1, %zu] range",
+      xnn_node_type_to_string(node_type), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    if (reduction_axes[i] >= num_input_dims) {
+      xnn_log_error(
+        "failed to define %s operator with #%zu reduction axis of %zu: the index is out of bounds for a %zuD input shape",
+        xnn_node_type_to_string(node_type), i, reduction_axes[i], num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && reduction_axes[i] <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to define %s operator with #%zu reduction axis of %zu: the reduction axes must be in ascending order "
+        "and unique",
+        xnn_node_type_to_string(node_type), i, reduction_axes[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  // Normalization statistics are computed over contiguous rows, so the reduction must collapse to the innermost
+  // dimension once dimensions of size 1 are dropped and adjacent dimensions are merged.
+  size_t normalized_input_dims[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_reduction_axes[XNN_MAX_TENSOR_DIMS];
+  memcpy(normalized_input_dims, input_value->shape.dim, num_input_dims * sizeof(size_t));
+  memcpy(normalized_reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+  size_t num_normalized_input_dims = num_input_dims;
+  size_t num_normalized_reduction_axes = num_reduction_axes;
+  xnn_normalize_reduction(
+    &num_normalized_reduction_axes, normalized_reduction_axes, &num_normalized_input_dims, normalized_input_dims);
+  if (num_normalized_reduction_axes > 1 ||
+      (num_normalized_reduction_axes == 1 && normalized_reduction_axes[0] != num_normalized_input_dims - 1))
+  {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": only reductions over the innermost dimensions are supported",
+      xnn_node_type_to_string(node_type), input_id);
+    return xnn_status_unsupported_parameter;
+  }
+
+  size_t num_reduced_elements = 1;
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    num_reduced_elements *= input_value->shape.dim[reduction_axes[i]];
+  }
+
+  status = check_rnorm_weights(node_type, subgraph, "gamma", gamma_id, num_reduced_elements);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (beta_id != XNN_INVALID_VALUE_ID) {
+    status = check_rnorm_weights(node_type, subgraph, "beta", beta_id, num_reduced_elements);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
+  status = xnn_subgraph_check_output_node_id(node_type, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(node_type, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_subgraph_check_all_dims_match(node_type, input_id, input_value, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+  assert(compute_type != xnn_compute_type_invalid);
+
+  status = xnn_subgraph_check_datatype_matches(node_type, input_id, input_value, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = node_type;
+  node->compute_type = compute_type;
+  node->params.normalization.num_reduction_axes = num_reduction_axes;
+  memcpy(node->params.normalization.reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+  node->params.normalization.epsilon = epsilon;
+  node->num_inputs = 2;
+  node->inputs[0] = input_id;
+  node->inputs[1] = gamma_id;
+  if (beta_id != XNN_INVALID_VALUE_ID) {
+    node->num_inputs = 3;
+    node->inputs[2] = beta_id;
+  }
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_rnorm_operator;
+  node->setup = setup_rnorm_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_layer_norm(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_rnorm(
+    subgraph, xnn_node_type_layer_norm,
+    num_reduction_axes, reduction_axes, epsilon,
+    input_id, gamma_id, beta_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_rms_norm(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_rnorm(
+    subgraph, xnn_node_type_rms_norm,
+    num_reduction_axes, reduction_axes, epsilon,
+    input_id, gamma_id, XNN_INVALID_VALUE_ID, output_id, flags);
+}
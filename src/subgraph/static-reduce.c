@@ -0,0 +1,258 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_reduce_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      status = xnn_create_reduce_nd_f32(
+        node->params.reduce.reduce_operator,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+
+  if (status == xnn_status_success) {
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+    opdata->shape1 = values[input_id].shape;
+    opdata->shape2.num_dims = node->params.reduce.num_reduction_axes;
+    memcpy(opdata->shape2.dim, node->params.reduce.reduction_axes, opdata->shape2.num_dims * sizeof(size_t));
+  }
+
+  return status;
+}
+
+static enum xnn_status setup_reduce_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_reduce_l2_nd_f32:
+    case xnn_operator_type_reduce_max_nd_f32:
+    case xnn_operator_type_reduce_mean_nd_f32:
+    case xnn_operator_type_reduce_min_nd_f32:
+    case xnn_operator_type_reduce_sum_nd_f32:
+      return xnn_setup_reduce_nd_f32(
+        opdata->operator_objects[0],
+        opdata->shape2.num_dims, opdata->shape2.dim,
+        opdata->shape1.num_dims, opdata->shape1.dim,
+        input_data, output_data,
+        threadpool);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_define_static_reduce(
+  xnn_subgraph_t subgraph,
+  enum xnn_reduce_operator reduce_operator,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_static_reduce)) != xnn_status_success) {
+    return status;
+  }
+
+  switch (reduce_operator) {
+    case xnn_reduce_sum:
+    case xnn_reduce_mean:
+    case xnn_reduce_max:
+    case xnn_reduce_min:
+    case xnn_reduce_l2:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator: invalid reduce operator %d",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), (int) reduce_operator);
+      return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_input_node_id(xnn_node_type_static_reduce, input_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_static_reduce, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  if (num_reduction_axes == 0 || num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to define %s operator with %zu reduction axes: the number of reduction axes must be in [1, %zu] range",
+      xnn_node_type_to_string(xnn_node_type_static_reduce), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    if (reduction_axes[i] >= num_input_dims) {
+      xnn_log_error(
+        "failed to define %s operator with #%zu reduction axis of %zu: the index is out of bounds for a %zuD input shape",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), i, reduction_axes[i], num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && reduction_axes[i] <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to define %s operator with #%zu reduction axis of %zu: the reduction axes must be in ascending order "
+        "and unique",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), i, reduction_axes[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_static_reduce, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_static_reduce, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  // Reduced dimensions are either retained with length 1 (XNN_FLAG_KEEP_DIMS) or removed from the output shape.
+  const bool keep_dims = (flags & XNN_FLAG_KEEP_DIMS) != 0;
+  const size_t expected_output_dims = keep_dims ? num_input_dims : num_input_dims - num_reduction_axes;
+  if (output_value->shape.num_dims != expected_output_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": number of output dimensions, %zu, does not match the expected number of dimensions %zu",
+      xnn_node_type_to_string(xnn_node_type_static_reduce), input_id, output_id,
+      output_value->shape.num_dims, expected_output_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  size_t output_dim = 0;
+  size_t axis = 0;
+  for (size_t i = 0; i < num_input_dims; i++) {
+    const bool is_reduced = axis < num_reduction_axes && reduction_axes[axis] == i;
+    if (is_reduced) {
+      axis++;
+      if (!keep_dims) {
+        continue;
+      }
+    }
+    const size_t expected_dim = is_reduced ? 1 : input_value->shape.dim[i];
+    if (output_value->shape.dim[output_dim] != expected_dim) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": output dimension #%zu of %zu does not match the expected size %zu",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), input_id, output_id,
+        output_dim, output_value->shape.dim[output_dim], expected_dim);
+      return xnn_status_invalid_parameter;
+    }
+    output_dim++;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+  assert(compute_type != xnn_compute_type_invalid);
+
+  status = xnn_subgraph_check_datatype_matches(
+    xnn_node_type_static_reduce, input_id, input_value, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_static_reduce;
+  node->compute_type = compute_type;
+  node->params.reduce.reduce_operator = reduce_operator;
+  node->params.reduce.num_reduction_axes = num_reduction_axes;
+  memcpy(node->params.reduce.reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_reduce_operator;
+  node->setup = setup_reduce_operator;
+
+  return xnn_status_success;
+}
@@ -48,6 +48,7 @@ enum xnn_status xnn_define_tensor_value(
   switch (datatype) {
     case xnn_datatype_fp32:
     case xnn_datatype_fp16:
+    case xnn_datatype_int32:
       break;
     default:
       xnn_log_error("failed to create Dense Tensor value: unsupported datatype %s (%d)",
@@ -210,6 +211,7 @@ enum xnn_status xnn_define_channelwise_quantized_tensor_value(
   }
 
   switch (datatype) {
+    case xnn_datatype_qcint4:
     case xnn_datatype_qcint8:
     case xnn_datatype_qcint32:
       break;
@@ -294,6 +296,13 @@ size_t xnn_tensor_get_size(
 
   size_t size = 0;
   switch (value->datatype) {
+    case xnn_datatype_qcint4:
+    {
+      // Two elements are packed per byte, and every innermost row starts on a byte boundary.
+      assert(value->shape.num_dims != 0);
+      const size_t row_elements = value->shape.dim[value->shape.num_dims - 1];
+      return xnn_shape_multiply_non_channel_dims(&value->shape) * ((row_elements + 1) / 2);
+    }
     case xnn_datatype_fp16:
       size = 2;
       break;
@@ -307,6 +316,7 @@ size_t xnn_tensor_get_size(
       break;
     case xnn_datatype_qint32:
     case xnn_datatype_qcint32:
+    case xnn_datatype_int32:
       size = 4;
       break;
     case xnn_datatype_invalid:
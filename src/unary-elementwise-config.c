@@ -20,8 +20,11 @@
 
 
 static struct xnn_unary_elementwise_config f16_abs_config = {0};
+static struct xnn_unary_elementwise_config f16_approxgelu_config = {0};
 static struct xnn_unary_elementwise_config f16_clamp_config = {0};
 static struct xnn_unary_elementwise_config f16_elu_config = {0};
+static struct xnn_unary_elementwise_config f16_exp_config = {0};
+static struct xnn_unary_elementwise_config f16_gelu_config = {0};
 static struct xnn_unary_elementwise_config f16_hswish_config = {0};
 static struct xnn_unary_elementwise_config f16_lrelu_config = {0};
 static struct xnn_unary_elementwise_config f16_neg_config = {0};
@@ -30,12 +33,17 @@ static struct xnn_unary_elementwise_config f16_rndne_config = {0};
 static struct xnn_unary_elementwise_config f16_rndu_config = {0};
 static struct xnn_unary_elementwise_config f16_rndz_config = {0};
 static struct xnn_unary_elementwise_config f16_sigmoid_config = {0};
+static struct xnn_unary_elementwise_config f16_silu_config = {0};
 static struct xnn_unary_elementwise_config f16_sqr_config = {0};
 static struct xnn_unary_elementwise_config f16_sqrt_config = {0};
+static struct xnn_unary_elementwise_config f16_tanh_config = {0};
 static struct xnn_unary_elementwise_config f16_to_f32_cvt_config = {0};
 static struct xnn_unary_elementwise_config f32_abs_config = {0};
+static struct xnn_unary_elementwise_config f32_approxgelu_config = {0};
 static struct xnn_unary_elementwise_config f32_clamp_config = {0};
 static struct xnn_unary_elementwise_config f32_elu_config = {0};
+static struct xnn_unary_elementwise_config f32_exp_config = {0};
+static struct xnn_unary_elementwise_config f32_gelu_config = {0};
 static struct xnn_unary_elementwise_config f32_hswish_config = {0};
 static struct xnn_unary_elementwise_config f32_lrelu_config = {0};
 static struct xnn_unary_elementwise_config f32_neg_config = {0};
@@ -45,8 +53,10 @@ static struct xnn_unary_elementwise_config f32_rndne_config = {0};
 static struct xnn_unary_elementwise_config f32_rndu_config = {0};
 static struct xnn_unary_elementwise_config f32_rndz_config = {0};
 static struct xnn_unary_elementwise_config f32_sigmoid_config = {0};
+static struct xnn_unary_elementwise_config f32_silu_config = {0};
 static struct xnn_unary_elementwise_config f32_sqr_config = {0};
 static struct xnn_unary_elementwise_config f32_sqrt_config = {0};
+static struct xnn_unary_elementwise_config f32_tanh_config = {0};
 static struct xnn_unary_elementwise_config f32_to_f16_cvt_config = {0};
 static struct xnn_unary_elementwise_config f32_to_qs8_cvt_config = {0};
 static struct xnn_unary_elementwise_config f32_to_qu8_cvt_config = {0};
@@ -63,8 +73,11 @@ static struct xnn_unary_elementwise_config xx_copy_config = {0};
 
 #if XNN_PLATFORM_WINDOWS
   static INIT_ONCE init_guard_f16_abs = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f16_approxgelu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_clamp = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_elu = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f16_exp = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f16_gelu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_hswish = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_lrelu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_neg = INIT_ONCE_STATIC_INIT;
@@ -73,12 +86,17 @@ static struct xnn_unary_elementwise_config xx_copy_config = {0};
   static INIT_ONCE init_guard_f16_rndu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_rndz = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_sigmoid = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f16_silu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_sqr = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_sqrt = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f16_tanh = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f16_to_f32_cvt = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_abs = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_approxgelu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_clamp = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_elu = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_exp = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_gelu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_hswish = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_lrelu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_neg = INIT_ONCE_STATIC_INIT;
@@ -88,8 +106,10 @@ static struct xnn_unary_elementwise_config xx_copy_config = {0};
   static INIT_ONCE init_guard_f32_rndu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_rndz = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_sigmoid = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_silu = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_sqr = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_sqrt = INIT_ONCE_STATIC_INIT;
+  static INIT_ONCE init_guard_f32_tanh = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_to_f16_cvt = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_to_qs8_cvt = INIT_ONCE_STATIC_INIT;
   static INIT_ONCE init_guard_f32_to_qu8_cvt = INIT_ONCE_STATIC_INIT;
@@ -104,8 +124,11 @@ static struct xnn_unary_elementwise_config xx_copy_config = {0};
   static INIT_ONCE init_guard_xx_copy = INIT_ONCE_STATIC_INIT;
 #else
   static pthread_once_t init_guard_f16_abs = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f16_approxgelu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_clamp = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_elu = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f16_exp = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f16_gelu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_hswish = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_lrelu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_neg = PTHREAD_ONCE_INIT;
@@ -114,12 +137,17 @@ static struct xnn_unary_elementwise_config xx_copy_config = {0};
   static pthread_once_t init_guard_f16_rndu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_rndz = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_sigmoid = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f16_silu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_sqr = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_sqrt = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f16_tanh = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f16_to_f32_cvt = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_abs = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_approxgelu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_clamp = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_elu = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_exp = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_gelu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_hswish = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_lrelu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_neg = PTHREAD_ONCE_INIT;
@@ -129,8 +157,10 @@ static struct xnn_unary_elementwise_config xx_copy_config = {0};
   static pthread_once_t init_guard_f32_rndu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_rndz = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_sigmoid = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_silu = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_sqr = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_sqrt = PTHREAD_ONCE_INIT;
+  static pthread_once_t init_guard_f32_tanh = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_to_f16_cvt = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_to_qs8_cvt = PTHREAD_ONCE_INIT;
   static pthread_once_t init_guard_f32_to_qu8_cvt = PTHREAD_ONCE_INIT;
@@ -168,6 +198,24 @@ static void init_f16_abs_config(void) {
   #endif
 }
 
+static void init_f16_approxgelu_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vapproxgelu_ukernel__neonfp16arith_rational_13_6_nr1recps_x16;
+      f16_approxgelu_config.element_tile = 16;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vapproxgelu_ukernel__avx2_rational_13_6_div_x16;
+      f16_approxgelu_config.element_tile = 16;
+    }
+  #endif
+}
+
 static void init_f16_clamp_config(void) {
   #if XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -224,6 +272,42 @@ static void init_f16_elu_config(void) {
   #endif
 }
 
+static void init_f16_exp_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vexp_ukernel__neonfp16arith_rr2_p5_x16;
+      f16_exp_config.element_tile = 16;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vexp_ukernel__avx2_rr2_p5_x16;
+      f16_exp_config.element_tile = 16;
+    }
+  #endif
+}
+
+static void init_f16_gelu_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vgelu_ukernel__neonfp16arith_rational_13_8_nr1recps_x16;
+      f16_gelu_config.element_tile = 16;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vgelu_ukernel__avx2_rational_13_8_div_x16;
+      f16_gelu_config.element_tile = 16;
+    }
+  #endif
+}
+
 static void init_f16_hswish_config(void) {
   #if XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -430,6 +514,24 @@ static void init_f16_sigmoid_config(void) {
   #endif
 }
 
+static void init_f16_silu_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vsilu_ukernel__neonfp16arith_rr2_p5_nr1recps_x16;
+      f16_silu_config.element_tile = 16;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vsilu_ukernel__avx2_rr2_p5_div_x16;
+      f16_silu_config.element_tile = 16;
+    }
+  #endif
+}
+
 static void init_f16_sqr_config(void) {
   #if XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -480,6 +582,24 @@ static void init_f16_sqrt_config(void) {
   #endif
 }
 
+static void init_f16_tanh_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vtanh_ukernel__neonfp16arith_rational_13_6_nr1recps_x16;
+      f16_tanh_config.element_tile = 16;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f16_vtanh_ukernel__avx2_rational_13_6_div_x16;
+      f16_tanh_config.element_tile = 16;
+    }
+  #endif
+}
+
 static void init_f16_to_f32_cvt_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -587,6 +707,40 @@ static void init_f32_abs_config(void) {
   #endif
 }
 
+static void init_f32_approxgelu_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__neon_rational_13_6_nr2recps_x8;
+      f32_approxgelu_config.element_tile = 8;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x4;
+      f32_approxgelu_config.element_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__aarch64_neonfma_rational_13_6_div_x8;
+    f32_approxgelu_config.element_tile = 8;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__avx512f_rational_13_6_div_x32;
+      f32_approxgelu_config.element_tile = 32;
+    } else if (hardware_config->use_x86_fma3) {
+      f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__fma3_rational_13_6_div_x16;
+      f32_approxgelu_config.init.f32_approxgelu = xnn_init_f32_approxgelu_avx_params;
+      f32_approxgelu_config.element_tile = 16;
+    } else {
+      f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__sse2_rational_13_6_div_x8;
+      f32_approxgelu_config.element_tile = 8;
+    }
+  #else
+    f32_approxgelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x4;
+    f32_approxgelu_config.element_tile = 4;
+  #endif
+}
+
 static void init_f32_clamp_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -723,6 +877,74 @@ static void init_f32_elu_config(void) {
   #endif
 }
 
+static void init_f32_exp_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__neon_rr2_p5_x8;
+      f32_exp_config.element_tile = 8;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__scalar_rr2_p5_x4;
+      f32_exp_config.element_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8;
+    f32_exp_config.element_tile = 8;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32;
+      f32_exp_config.element_tile = 32;
+    } else if (hardware_config->use_x86_avx2) {
+      f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__avx2_rr2_p5_x16;
+      f32_exp_config.init.f32_exp = xnn_init_f32_exp_avx_params;
+      f32_exp_config.element_tile = 16;
+    } else {
+      f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__sse2_rr2_p5_x8;
+      f32_exp_config.element_tile = 8;
+    }
+  #else
+    f32_exp_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vexp_ukernel__scalar_rr2_p5_x4;
+    f32_exp_config.element_tile = 4;
+  #endif
+}
+
+static void init_f32_gelu_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8;
+      f32_gelu_config.element_tile = 8;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4;
+      f32_gelu_config.element_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__aarch64_neonfma_rational_13_8_div_x8;
+    f32_gelu_config.element_tile = 8;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32;
+      f32_gelu_config.element_tile = 32;
+    } else if (hardware_config->use_x86_fma3) {
+      f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__fma3_rational_13_8_div_x16;
+      f32_gelu_config.init.f32_gelu = xnn_init_f32_gelu_avx_params;
+      f32_gelu_config.element_tile = 16;
+    } else {
+      f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8;
+      f32_gelu_config.element_tile = 8;
+    }
+  #else
+    f32_gelu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4;
+    f32_gelu_config.element_tile = 4;
+  #endif
+}
+
 static void init_f32_hswish_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -1173,6 +1395,40 @@ static void init_f32_sigmoid_config(void) {
   #endif
 }
 
+static void init_f32_silu_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x8;
+      f32_silu_config.element_tile = 8;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4;
+      f32_silu_config.element_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__aarch64_neonfma_rr2_p5_div_x8;
+    f32_silu_config.element_tile = 8;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__avx512f_rr1_p5_scalef_div_x32;
+      f32_silu_config.element_tile = 32;
+    } else if (hardware_config->use_x86_avx2) {
+      f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__avx2_rr2_p5_div_x16;
+      f32_silu_config.init.f32_silu = xnn_init_f32_silu_avx_params;
+      f32_silu_config.element_tile = 16;
+    } else {
+      f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x8;
+      f32_silu_config.element_tile = 8;
+    }
+  #else
+    f32_silu_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4;
+    f32_silu_config.element_tile = 4;
+  #endif
+}
+
 static void init_f32_sqr_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -1250,6 +1506,40 @@ static void init_f32_sqrt_config(void) {
   #endif
 }
 
+static void init_f32_tanh_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__neon_rational_13_6_nr2recps_x8;
+      f32_tanh_config.element_tile = 8;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x4;
+      f32_tanh_config.element_tile = 4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__aarch64_neonfma_rational_13_6_div_x8;
+    f32_tanh_config.element_tile = 8;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+      f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__avx512f_rational_13_6_div_x32;
+      f32_tanh_config.element_tile = 32;
+    } else if (hardware_config->use_x86_fma3) {
+      f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__fma3_rational_13_6_div_x16;
+      f32_tanh_config.init.f32_tanh = xnn_init_f32_tanh_avx_params;
+      f32_tanh_config.element_tile = 16;
+    } else {
+      f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__sse2_rational_13_6_div_x8;
+      f32_tanh_config.element_tile = 8;
+    }
+  #else
+    f32_tanh_config.ukernel = (xnn_vunary_ukernel_fn) xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x4;
+    f32_tanh_config.element_tile = 4;
+  #endif
+}
+
 static void init_f32_to_f16_cvt_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -1980,6 +2270,11 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f16_approxgelu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_approxgelu_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f16_clamp_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f16_clamp_config();
     return TRUE;
@@ -1990,6 +2285,16 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f16_exp_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_exp_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f16_gelu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_gelu_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f16_hswish_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f16_hswish_config();
     return TRUE;
@@ -2030,6 +2335,11 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f16_silu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_silu_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f16_sqr_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f16_sqr_config();
     return TRUE;
@@ -2040,11 +2350,21 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f16_tanh_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f16_tanh_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f32_abs_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f32_abs_config();
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f32_approxgelu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_approxgelu_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f32_clamp_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f32_clamp_config();
     return TRUE;
@@ -2055,6 +2375,16 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f32_exp_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_exp_config();
+    return TRUE;
+  }
+
+  static BOOL CALLBACK init_f32_gelu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_gelu_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f32_hswish_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f32_hswish_config();
     return TRUE;
@@ -2100,6 +2430,11 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f32_silu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_silu_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_f32_sqr_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_f32_sqr_config();
     return TRUE;
@@ -2110,6 +2445,11 @@ static void init_xx_copy_config(void) {
     return TRUE;
   }
 
+  static BOOL CALLBACK init_f32_tanh_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
+    init_f32_tanh_config();
+    return TRUE;
+  }
+
   static BOOL CALLBACK init_qs8_lrelu_config_windows(PINIT_ONCE init_once, PVOID parameter, PVOID* context) {
     init_qs8_lrelu_config();
     return TRUE;
@@ -2200,6 +2540,19 @@ const struct xnn_unary_elementwise_config* xnn_init_f16_abs_config() {
   return &f16_abs_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f16_approxgelu_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_approxgelu, &init_f16_approxgelu_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_approxgelu, &init_f16_approxgelu_config);
+  #endif
+  return &f16_approxgelu_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f16_clamp_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
@@ -2226,6 +2579,32 @@ const struct xnn_unary_elementwise_config* xnn_init_f16_elu_config() {
   return &f16_elu_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f16_exp_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_exp, &init_f16_exp_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_exp, &init_f16_exp_config);
+  #endif
+  return &f16_exp_config;
+}
+
+const struct xnn_unary_elementwise_config* xnn_init_f16_gelu_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_gelu, &init_f16_gelu_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_gelu, &init_f16_gelu_config);
+  #endif
+  return &f16_gelu_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f16_hswish_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
@@ -2330,6 +2709,19 @@ const struct xnn_unary_elementwise_config* xnn_init_f16_sigmoid_config() {
   return &f16_sigmoid_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f16_silu_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_silu, &init_f16_silu_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_silu, &init_f16_silu_config);
+  #endif
+  return &f16_silu_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f16_sqr_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
@@ -2356,6 +2748,19 @@ const struct xnn_unary_elementwise_config* xnn_init_f16_sqrt_config() {
   return &f16_sqrt_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f16_tanh_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f16_tanh, &init_f16_tanh_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f16_tanh, &init_f16_tanh_config);
+  #endif
+  return &f16_tanh_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f16_to_f32_cvt_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
@@ -2382,6 +2787,19 @@ const struct xnn_unary_elementwise_config* xnn_init_f32_abs_config() {
   return &f32_abs_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f32_approxgelu_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_approxgelu, &init_f32_approxgelu_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_approxgelu, &init_f32_approxgelu_config);
+  #endif
+  return &f32_approxgelu_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f32_clamp_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
@@ -2408,6 +2826,32 @@ const struct xnn_unary_elementwise_config* xnn_init_f32_elu_config() {
   return &f32_elu_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f32_exp_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_exp, &init_f32_exp_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_exp, &init_f32_exp_config);
+  #endif
+  return &f32_exp_config;
+}
+
+const struct xnn_unary_elementwise_config* xnn_init_f32_gelu_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_gelu, &init_f32_gelu_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_gelu, &init_f32_gelu_config);
+  #endif
+  return &f32_gelu_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f32_hswish_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
@@ -2525,6 +2969,19 @@ const struct xnn_unary_elementwise_config* xnn_init_f32_sigmoid_config() {
   return &f32_sigmoid_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f32_silu_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_silu, &init_f32_silu_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_silu, &init_f32_silu_config);
+  #endif
+  return &f32_silu_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f32_sqr_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
@@ -2551,6 +3008,19 @@ const struct xnn_unary_elementwise_config* xnn_init_f32_sqrt_config() {
   return &f32_sqrt_config;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f32_tanh_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  #if XNN_PLATFORM_WINDOWS
+    InitOnceExecuteOnce(&init_guard_f32_tanh, &init_f32_tanh_config_windows, NULL, NULL);
+  #else
+    pthread_once(&init_guard_f32_tanh, &init_f32_tanh_config);
+  #endif
+  return &f32_tanh_config;
+}
+
 const struct xnn_unary_elementwise_config* xnn_init_f32_to_f16_cvt_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
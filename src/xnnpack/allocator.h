@@ -18,6 +18,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/common.h>
+#include <xnnpack/mutex.h>
 #include <xnnpack/params.h>
 
 
@@ -60,6 +61,59 @@ inline static void xnn_release_simd_memory(void* memory_pointer) {
   xnn_params.allocator.aligned_deallocate(xnn_params.allocator.context, memory_pointer);
 }
 
+// Bump allocator for memory which lives as long as a runtime: descriptors and metadata of operators, and buffers
+// allocated by operators at setup. Memory is carved out of large blocks and released all at once, when the arena is
+// released. Allocations are zero-initialized and aligned to XNN_ALLOCATION_ALIGNMENT. Arenas are thread-safe, as
+// operators of a runtime may be created in parallel.
+struct xnn_arena {
+  // Most recently allocated block, which links to the blocks allocated before it.
+  struct xnn_arena_block* block;
+  // Minimum size of new blocks, in bytes.
+  size_t block_size;
+  // Number of blocks allocated by the arena.
+  size_t num_blocks;
+  // Number of bytes handed out by the arena, including allocation headers.
+  size_t allocated_bytes;
+  struct xnn_mutex mutex;
+};
+
+// Initializes an arena with a first block of `initial_size` bytes. Subsequent blocks are allocated on demand, and are
+// at least as large as the first one.
+enum xnn_status xnn_init_arena(struct xnn_arena* arena, size_t initial_size);
+
+// Allocates `size` bytes from the arena. Returns NULL if the arena can not be grown.
+void* xnn_arena_allocate(struct xnn_arena* arena, size_t size);
+
+// Grows a memory allocation from the arena to `size` bytes, preserving its contents. The allocation is reused as is if
+// it is already large enough; otherwise a new allocation is made and the old one is only reclaimed with the arena.
+void* xnn_arena_reallocate(struct xnn_arena* arena, void* pointer, size_t size);
+
+// Releases all memory allocated from the arena.
+void xnn_release_arena(struct xnn_arena* arena);
+
+// Operator memory comes from the arena of the runtime which owns the operator if there is one, and from the allocator
+// otherwise. Memory allocated from an arena must not be released individually.
+inline static void* xnn_allocate_zero_arena_memory(struct xnn_arena* arena, size_t memory_size) {
+  if (arena != NULL) {
+    return xnn_arena_allocate(arena, memory_size);
+  }
+  return xnn_allocate_zero_memory(memory_size);
+}
+
+inline static void* xnn_allocate_zero_arena_simd_memory(struct xnn_arena* arena, size_t memory_size) {
+  if (arena != NULL) {
+    return xnn_arena_allocate(arena, memory_size);
+  }
+  return xnn_allocate_zero_simd_memory(memory_size);
+}
+
+inline static void* xnn_reallocate_arena_memory(struct xnn_arena* arena, void* memory_pointer, size_t memory_size) {
+  if (arena != NULL) {
+    return xnn_arena_reallocate(arena, memory_pointer, memory_size);
+  }
+  return xnn_reallocate_memory(memory_pointer, memory_size);
+}
+
 #if defined(__GNUC__) && defined(__BIGGEST_ALIGNMENT__) && (__BIGGEST_ALIGNMENT__ >= XNN_ALLOCATION_ALIGNMENT)
   #define XNN_SIMD_ALLOCA(size) __builtin_alloca((size))
 #elif (defined(__clang_major__) && (__clang_major__ >= 4)) || \
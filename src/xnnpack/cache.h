@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <stdbool.h>           // For bool.
 #include <stddef.h>            // For size_t.
 #include <stdint.h>            // For uint32_t.
 #include <xnnpack.h>           // For xnn_status.
@@ -93,6 +94,12 @@ struct xnn_weights_cache {
 
 enum xnn_status xnn_init_weights_cache(struct xnn_weights_cache* cache);
 enum xnn_status xnn_init_weights_cache_with_size(struct xnn_weights_cache* cache, size_t size);
+// Initializes the weights cache with memory policy `memory_flags` (XNN_FLAG_HUGE_PAGES, XNN_FLAG_TRANSPARENT_HUGE_PAGES,
+// and XNN_FLAG_PREFAULT_MEMORY) for the packed weights.
+enum xnn_status xnn_init_weights_cache_with_memory_flags(
+  struct xnn_weights_cache* cache,
+  size_t size,
+  uint32_t memory_flags);
 // Finalizes the weights cache, so that we cannot insert any more entries into the cache.
 enum xnn_status xnn_finalize_weights_cache(
   struct xnn_weights_cache* cache,
@@ -106,9 +113,78 @@ void* xnn_reserve_space_in_weights_cache(struct xnn_weights_cache* cache, size_t
 size_t xnn_get_or_insert_weights_cache(struct xnn_weights_cache* cache, void* ptr, size_t size);
 bool xnn_weights_cache_is_finalized(struct xnn_weights_cache* cache);
 
+// Geometry of the indirection buffer of a convolution operator. Operators with equal keys store the same pointers,
+// relative to their input, in their indirection buffers, and can share one buffer. Keys are compared bytewise, so they
+// must be zero-initialized, including padding, before fields are set.
+struct xnn_indirection_cache_key {
+  // enum xnn_operator_type of the operators.
+  uint32_t operator_type;
+  // enum xnn_microkernel_type of the operators, IGEMM and DWCONV micro-kernels use different layouts.
+  uint32_t ukernel_type;
+  size_t input_height;
+  size_t input_width;
+  size_t input_pixel_stride;
+  size_t output_height;
+  size_t output_width;
+  size_t groups;
+  size_t group_input_channels;
+  uint32_t kernel_height;
+  uint32_t kernel_width;
+  uint32_t stride_height;
+  uint32_t stride_width;
+  uint32_t dilation_height;
+  uint32_t dilation_width;
+  uint32_t padding_top;
+  uint32_t padding_left;
+  // MR of the IGEMM micro-kernel, or primary tile of the DWCONV micro-kernel.
+  size_t tile;
+  // Byte the zero buffer of the operators is filled with, if they have one.
+  uint32_t zero_byte;
+  bool has_zero;
+};
+
+struct xnn_indirection_cache_entry {
+  struct xnn_indirection_cache_key key;
+  const void** buffer;
+  size_t buffer_size;
+  // Input and zero buffer pointers the buffer was initialized with. Users offset pointers into the input by their own
+  // input pointer minus `input`, and must pass `zero` to micro-kernels to identify padding.
+  const void* input;
+  void* zero;
+  // Number of operators pointing at this entry.
+  size_t num_users;
+  struct xnn_indirection_cache_entry* next;
+};
+
+// A cache of indirection buffers shared by convolution operators within a runtime. Setup of operators is serialized
+// by the runtime, so the cache is not protected by a mutex.
+struct xnn_indirection_cache {
+  struct xnn_indirection_cache_entry* entries;
+  size_t hits;
+  size_t misses;
+};
+
+void xnn_init_indirection_cache(struct xnn_indirection_cache* cache);
+void xnn_release_indirection_cache(struct xnn_indirection_cache* cache);
+// Looks up an indirection buffer with geometry `key` and adds a user to it. If it is not found, a new entry with an
+// uninitialized buffer of `buffer_size` bytes is inserted, and `initialize` is set to true: the caller must initialize
+// the buffer, and set the input and zero pointers of the entry. Returns NULL if allocation fails.
+struct xnn_indirection_cache_entry* xnn_get_or_insert_indirection_cache(
+  struct xnn_indirection_cache* cache,
+  const struct xnn_indirection_cache_key* key,
+  size_t buffer_size,
+  bool* initialize);
+// Removes a user of `entry`, and frees the entry when it has no users left.
+void xnn_release_indirection_cache_entry(
+  struct xnn_indirection_cache* cache,
+  struct xnn_indirection_cache_entry* entry);
+
 struct xnn_caches {
   struct xnn_code_cache *code_cache;
   struct xnn_weights_cache *weights_cache;
+  struct xnn_indirection_cache *indirection_cache;
+  // Arena for operator descriptors and metadata, owned by the runtime.
+  struct xnn_arena *arena;
 };
 
 #ifdef __cplusplus
@@ -226,6 +226,103 @@ struct gemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+// Context for cache-blocked GEMM with the packed weights split along K into blocks of kc input channels.
+// Every task computes an mc x nc tile of the output one block of kc input channels at a time, so that
+// every nr x kc panel of packed weights is reused across all rows of the tile while it stays in cache. Partial results
+// of all blocks but the first are accumulated into the output with an addition micro-kernel.
+struct blocked_gemm_context {
+  // Total size of a row of A, in bytes.
+  size_t k_scaled;
+  // Size of a block of a row of A, in bytes. The last block may be shorter.
+  size_t kc_scaled;
+  const void* a;
+  size_t a_stride;
+  const void* packed_w;
+  // Stride of packed weights of one output channel in all blocks but the last.
+  size_t w_stride;
+  // Stride of packed weights of one output channel in the last block.
+  size_t w_stride_last;
+  // Stride between consecutive blocks of packed weights.
+  size_t wk_stride;
+  float* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  size_t mr;
+  xnn_gemm_ukernel_fn ukernel;
+  xnn_vbinary_ukernel_fn vadd;
+  union xnn_f32_minmax_params gemm_params;
+  union xnn_f32_minmax_params add_params;
+  union xnn_f32_minmax_params output_params;
+  // Split-K GEMV computes the partial results of every block of input channels in parallel into rows of the workspace,
+  // and then reduces them into the output.
+  float* workspace;
+  size_t workspace_stride;
+  size_t num_k_blocks;
+};
+
+// Maximum number of output channels in a tile of cache-blocked GEMM, bounded by the on-stack partial results buffer.
+#define XNN_BLOCKED_GEMM_MAX_NC 256
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_blocked_gemm(
+      const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_splitk_gemv(
+      const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t k_block_index,
+      size_t nr_block_start,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_splitk_gemv_reduce(
+      const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t nr_block_start,
+      size_t nr_block_size);
+#endif
+
+// Context for GEMM with dynamically quantized inputs, shared by the quantization pass and the GEMM pass.
+// Every row of fp32 inputs is quantized to int8 with its own asymmetric scale and zero point, and the GEMM
+// micro-kernel dequantizes the int32 accumulators with the row scale times the per-channel filter scale.
+struct qd8_gemm_context {
+  // Number of bytes in a row of fp32 inputs.
+  size_t input_size;
+  const float* input;
+  size_t input_stride;
+  // Quantized rows of inputs, input_size / sizeof(float) bytes each, a_stride bytes apart.
+  int8_t* a;
+  size_t a_stride;
+  // Quantization parameters of every row of inputs.
+  struct xnn_qd8_quantization_params* quantization_params;
+  xnn_reduce_ukernel_fn rminmax_ukernel;
+  xnn_f32_qs8_vcvt_ukernel_fn cvt_ukernel;
+  xnn_init_f32_qs8_cvt_params_fn init_cvt_params;
+  union xnn_f32_scale_params rminmax_params;
+  size_t k_scaled;
+  const void* packed_w;
+  size_t w_stride;
+  float* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  xnn_qd8_f32_qc8w_gemm_ukernel_fn ukernel;
+  union xnn_f32_minmax_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_qd8_quantize(
+      const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_qd8_gemm(
+      const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 // Context for Sparse Matrix-Dense Matrix Multiplication.
 // C [MxN] := A [MxK] * B [KxN] + bias [N]
 // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -929,17 +1026,25 @@ struct univector_strided_context {
   xnn_vunary_ukernel_fn ukernel;
   union {
     union xnn_f16_abs_params f16_abs;
+    union xnn_f16_approxgelu_params f16_approxgelu;
     union xnn_f16_default_params f16_default;
+    union xnn_f16_exp_params f16_exp;
     union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_f16_gelu_params f16_gelu;
     union xnn_f16_hswish_params f16_hswish;
     union xnn_f16_lrelu_params f16_lrelu;
     union xnn_f16_minmax_params f16_minmax;
     union xnn_f16_neg_params f16_neg;
     union xnn_f16_sigmoid_params f16_sigmoid;
+    union xnn_f16_silu_params f16_silu;
+    union xnn_f16_tanh_params f16_tanh;
     union xnn_f32_abs_params f32_abs;
+    union xnn_f32_approxgelu_params f32_approxgelu;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_exp_params f32_exp;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_hswish_params f32_hswish;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_minmax_params f32_minmax;
@@ -948,7 +1053,9 @@ struct univector_strided_context {
     union xnn_f32_qu8_cvt_params f32_qu8_cvt;
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
+    union xnn_f32_silu_params f32_silu;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     union xnn_qs8_cvt_params qs8_cvt;
     union xnn_qs16_qs8_cvt_params qs16_qs8_cvt;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
@@ -976,17 +1083,25 @@ struct univector_contiguous_context {
   xnn_vunary_ukernel_fn ukernel;
   union {
     union xnn_f16_abs_params f16_abs;
+    union xnn_f16_approxgelu_params f16_approxgelu;
     union xnn_f16_default_params f16_default;
+    union xnn_f16_exp_params f16_exp;
     union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_f16_gelu_params f16_gelu;
     union xnn_f16_hswish_params f16_hswish;
     union xnn_f16_lrelu_params f16_lrelu;
     union xnn_f16_minmax_params f16_minmax;
     union xnn_f16_neg_params f16_neg;
     union xnn_f16_sigmoid_params f16_sigmoid;
+    union xnn_f16_silu_params f16_silu;
+    union xnn_f16_tanh_params f16_tanh;
     union xnn_f32_abs_params f32_abs;
+    union xnn_f32_approxgelu_params f32_approxgelu;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_exp_params f32_exp;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_hswish_params f32_hswish;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_minmax_params f32_minmax;
@@ -995,7 +1110,9 @@ struct univector_contiguous_context {
     union xnn_f32_qu8_cvt_params f32_qu8_cvt;
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
+    union xnn_f32_silu_params f32_silu;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     union xnn_qs8_cvt_params qs8_cvt;
     union xnn_qs16_qs8_cvt_params qs16_qs8_cvt;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
@@ -1032,6 +1149,115 @@ struct prelu_context {
       size_t batch_range);
 #endif
 
+struct rnorm_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  const void* w;
+  void* y;
+  size_t y_stride;
+  xnn_rnorm_ukernel_fn ukernel;
+  union {
+    union xnn_f16_rnorm_params f16;
+    union xnn_f32_rnorm_params f32;
+    union xnn_qs8_rnorm_params qs8;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_rnorm(
+      const struct rnorm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
+struct reduce_context {
+  const void* input;
+  void* output;
+  // Slices of partial results, one per chunk of the innermost reduced dimension, or NULL when the reduction is not
+  // split and results are written to the output directly.
+  void* workspace;
+  // Normalized input shape, padded to XNN_MAX_TENSOR_DIMS dimensions with alternating kept and reduced dimensions.
+  // Reduced dimensions have odd indices for contiguous reductions and even indices for discontiguous reductions.
+  size_t input_shape[XNN_MAX_TENSOR_DIMS];
+  // Input strides in bytes.
+  size_t input_stride[XNN_MAX_TENSOR_DIMS];
+  // Output strides in bytes for the two outer kept dimensions. The innermost kept dimension is contiguous.
+  size_t output_stride[2];
+  // Number of elements (contiguous) or rows (discontiguous) of the innermost reduced dimension in each chunk.
+  size_t reduction_chunk_size;
+  size_t num_chunks;
+  size_t workspace_stride;
+  uint32_t log2_element_size;
+  // Bit pattern of the identity element of the reduction, used to initialize the output.
+  uint32_t identity;
+  union {
+    xnn_reduce_ukernel_fn contiguous;
+    xnn_rdreduce_ukernel_fn discontiguous;
+  } ukernel;
+  // Folds the partial results in the workspace into the output.
+  xnn_rdreduce_ukernel_fn combine_ukernel;
+  // Optional element-wise transformation of the reduced values, e.g. square root for the L2 norm.
+  xnn_vunary_ukernel_fn finalize_ukernel;
+  union {
+    union xnn_f32_scale_params f32;
+  } params;
+  union {
+    union xnn_f32_scale_params f32;
+  } combine_params;
+  union {
+    union xnn_f32_sqrt_params f32_sqrt;
+  } finalize_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_contiguous_reduce(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t chunk_index,
+      size_t output_idx0,
+      size_t output_idx1,
+      size_t output_idx2,
+      size_t output1_block_size,
+      size_t output2_block_size);
+
+  XNN_PRIVATE void xnn_compute_discontiguous_reduce(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t chunk_index,
+      size_t output_idx0,
+      size_t output_idx1,
+      size_t output_idx2,
+      size_t output1_block_size,
+      size_t output2_block_size);
+
+  XNN_PRIVATE void xnn_compute_reduce_combine(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t output_start,
+      size_t output_range);
+#endif
+
+struct embedding_context {
+  size_t channels;
+  // Number of indices in each bag; every bag produces one row of outputs.
+  size_t bag_size;
+  const int32_t* indices;
+  const void* table;
+  size_t table_stride;
+  // Per-row dequantization scales, or NULL for floating-point tables.
+  const float* table_scale;
+  float* output;
+  size_t output_stride;
+  xnn_embedding_ukernel_fn ukernel;
+  union {
+    union xnn_f32_scale_params f32;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_embedding(
+      const struct embedding_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t bag_start,
+      size_t bag_range);
+#endif
+
 struct vmulcaddc_context {
   size_t n;
   const void* x;
@@ -57,6 +57,9 @@ struct xnn_hardware_config {
   bool use_wasm_pshufb;
   bool use_wasm_sdot;
 #endif  // XNN_ARCH_WASMRELAXEDSIMD
+  // Size of the L1 data cache and of the L2 cache of the first core, used to size blocks of cache-blocked operators.
+  size_t l1_data_cache_bytes;
+  size_t l2_cache_bytes;
 };
 
 XNN_INTERNAL const struct xnn_hardware_config* xnn_init_hardware_config();
@@ -146,17 +149,25 @@ struct xnn_unary_elementwise_config {
   union {
     xnn_init_f16_f32_cvt_params_fn f16_f32_cvt;
     xnn_init_f16_abs_params_fn f16_abs;
+    xnn_init_f16_approxgelu_params_fn f16_approxgelu;
     xnn_init_f16_elu_params_fn f16_elu;
+    xnn_init_f16_exp_params_fn f16_exp;
+    xnn_init_f16_gelu_params_fn f16_gelu;
     xnn_init_f16_hswish_params_fn f16_hswish;
     xnn_init_f16_lrelu_params_fn f16_lrelu;
     xnn_init_f16_neg_params_fn f16_neg;
     xnn_init_f16_minmax_params_fn f16_minmax;
     xnn_init_f16_sigmoid_params_fn f16_sigmoid;
+    xnn_init_f16_silu_params_fn f16_silu;
     xnn_init_f16_sqrt_params_fn f16_sqrt;
+    xnn_init_f16_tanh_params_fn f16_tanh;
     xnn_init_f32_abs_params_fn f32_abs;
+    xnn_init_f32_approxgelu_params_fn f32_approxgelu;
     xnn_init_f32_default_params_fn f32_default;
     xnn_init_f32_elu_params_fn f32_elu;
+    xnn_init_f32_exp_params_fn f32_exp;
     xnn_init_f32_f16_cvt_params_fn f32_f16_cvt;
+    xnn_init_f32_gelu_params_fn f32_gelu;
     xnn_init_f32_hswish_params_fn f32_hswish;
     xnn_init_f32_lrelu_params_fn f32_lrelu;
     xnn_init_f32_minmax_params_fn f32_minmax;
@@ -165,7 +176,9 @@ struct xnn_unary_elementwise_config {
     xnn_init_f32_qu8_cvt_params_fn f32_qu8_cvt;
     xnn_init_f32_rnd_params_fn f32_rnd;
     xnn_init_f32_sigmoid_params_fn f32_sigmoid;
+    xnn_init_f32_silu_params_fn f32_silu;
     xnn_init_f32_sqrt_params_fn f32_sqrt;
+    xnn_init_f32_tanh_params_fn f32_tanh;
     xnn_init_qs16_qs8_cvt_params_fn qs16_qs8_cvt;
     xnn_init_qs8_cvt_params_fn qs8_cvt;
     xnn_init_qs8_f32_cvt_params_fn qs8_f32_cvt;
@@ -183,8 +196,11 @@ struct xnn_unary_elementwise_config {
 };
 
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_abs_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_approxgelu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_clamp_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_elu_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_exp_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_gelu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_hswish_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_lrelu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_neg_config();
@@ -194,12 +210,17 @@ XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_rndne_confi
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_rndu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_rndz_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_sigmoid_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_silu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_sqr_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_sqrt_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_tanh_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f16_to_f32_cvt_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_abs_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_approxgelu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_clamp_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_elu_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_exp_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_gelu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_hswish_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_lrelu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_neg_config();
@@ -209,8 +230,10 @@ XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_rndne_confi
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_rndu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_rndz_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_sigmoid_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_silu_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_sqr_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_sqrt_config();
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_tanh_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_to_f16_cvt_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_to_qs8_cvt_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_to_qu8_cvt_config();
@@ -224,6 +247,57 @@ XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_s8_clamp_config
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_u8_clamp_config();
 XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_xx_copy_config();
 
+struct xnn_rnorm_config {
+  xnn_rnorm_ukernel_fn ukernel;
+  union {
+    xnn_init_f16_rnorm_params_fn f16;
+    xnn_init_f32_rnorm_params_fn f32;
+    xnn_init_qs8_rnorm_params_fn qs8;
+  } init;
+};
+
+XNN_INTERNAL const struct xnn_rnorm_config* xnn_init_f16_rnorm_config();
+XNN_INTERNAL const struct xnn_rnorm_config* xnn_init_f32_rnorm_config();
+XNN_INTERNAL const struct xnn_rnorm_config* xnn_init_qs8_rnorm_config();
+
+struct xnn_reduce_config {
+  // Reduces a contiguous run of elements into one output element.
+  xnn_reduce_ukernel_fn ukernel;
+  // Reduces strided rows of elements into a row of output elements.
+  xnn_rdreduce_ukernel_fn rd_ukernel;
+  union {
+    xnn_init_f32_scale_params_fn f32;
+  } init;
+  // Number of channels processed in one tile of the discontiguous micro-kernel.
+  uint8_t channel_tile;
+};
+
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rmax_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rmin_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rminmax_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rsum_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rsumsq_config();
+
+struct xnn_embedding_config {
+  // Sums the rows of a table selected by a bag of indices into a row of fp32 outputs.
+  xnn_embedding_ukernel_fn ukernel;
+  union {
+    xnn_init_f32_scale_params_fn f32;
+  } init;
+};
+
+XNN_INTERNAL const struct xnn_embedding_config* xnn_init_f16_f32_embedding_config();
+XNN_INTERNAL const struct xnn_embedding_config* xnn_init_f32_embedding_config();
+XNN_INTERNAL const struct xnn_embedding_config* xnn_init_qc4_f32_embedding_config();
+XNN_INTERNAL const struct xnn_embedding_config* xnn_init_qc8_f32_embedding_config();
+
+// GEMM parameters are defined in params.h, which includes this header.
+struct gemm_parameters;
+
+// GEMM micro-kernels for dynamically quantized int8 inputs and channelwise quantized int8 weights with fp32 outputs.
+// The micro-kernels are stored in gemm_parameters.minmax.gemm and have the xnn_qd8_f32_qc8w_gemm_ukernel_fn type.
+XNN_INTERNAL const struct gemm_parameters* xnn_init_qd8_f32_qc8w_gemm_config();
+
 struct xnn_xx_fill_config {
   xnn_fill_ukernel_fn ukernel;
   // Number of rows of inputs processed in one tile.
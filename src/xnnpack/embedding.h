@@ -0,0 +1,56 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/microparams.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// EMBEDDING micro-kernels gather `rows` rows of `channels` elements from a table, selected by `indices`, dequantize
+// them and sum them into a single output row:
+//   output[c] = params->scalar.scale * sum(row_scale[indices[r]] * table[indices[r]][c])
+// where table rows are `table_stride` bytes apart and row_scale is 1 for floating-point tables. The output is
+// overwritten, not accumulated into. A gather without pooling calls the micro-kernel with a single row.
+#define DECLARE_EMBEDDING_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t rows,                                  \
+      size_t channels,                              \
+      const int32_t* indices,                       \
+      const void* table,                            \
+      size_t table_stride,                          \
+      const float* row_scale,                       \
+      float* output,                                \
+      const union xnn_f32_scale_params* params);
+
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_f16_f32_embedding_ukernel__f16c_c16)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_f16_f32_embedding_ukernel__neonfp16_c16)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_f16_f32_embedding_ukernel__scalar_c4)
+
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_f32_embedding_ukernel__neon_c16)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_f32_embedding_ukernel__scalar_c4)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_f32_embedding_ukernel__sse_c16)
+
+// QC8 tables store one signed byte per element. QC4 tables store two signed 4-bit elements per byte, the
+// even-numbered element in the low nibble, and each row starts on a byte boundary.
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_qc4_f32_embedding_ukernel__neon_c16)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_qc4_f32_embedding_ukernel__scalar_c4)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_qc4_f32_embedding_ukernel__sse41_c16)
+
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_qc8_f32_embedding_ukernel__neon_c16)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_qc8_f32_embedding_ukernel__scalar_c4)
+DECLARE_EMBEDDING_UKERNEL_FUNCTION(xnn_qc8_f32_embedding_ukernel__sse41_c16)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -5,7 +5,9 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <xnnpack.h>
@@ -53,10 +55,14 @@ struct xnn_weights_buffer {
   size_t size;
   // Maximum capacity of this buffer pointed to by `code`. This is the size of the allcoated memory.
   size_t capacity;
+  // Memory policy of the buffer: XNN_FLAG_HUGE_PAGES, XNN_FLAG_TRANSPARENT_HUGE_PAGES, and XNN_FLAG_PREFAULT_MEMORY.
+  uint32_t flags;
+  // Whether the buffer is mapped with explicit huge pages, its capacity is then a multiple of the huge page size.
+  bool hugetlb;
 };
 
-// Allocates a weights region and associates it with `buffer`.
-enum xnn_status xnn_allocate_weights_memory(struct xnn_weights_buffer* buffer, size_t size);
+// Allocates a weights region with memory policy `flags` and associates it with `buffer`.
+enum xnn_status xnn_allocate_weights_memory(struct xnn_weights_buffer* buffer, size_t size, uint32_t flags);
 // Free all memory associated with `buffer`.
 enum xnn_status xnn_release_weights_memory(struct xnn_weights_buffer* buffer);
 // Ensure that buffer has at least min_available_size bytes free (i.e. buffer->capacity - buffer->size >= min_available_size), grows if not.
@@ -64,6 +70,18 @@ enum xnn_status xnn_reserve_weights_memory(struct xnn_weights_buffer* buffer, si
 // Releases unused memory in `buffer`, and sets used memory to read-only. The address of allocated memory (`buffer->start`)
 // is fixed after this call. This should only be called after all the weights have been written.
 enum xnn_status xnn_finalize_weights_memory(struct xnn_weights_buffer* buffer);
+// Returns the number of bytes of `buffer` backed by huge pages, explicit or transparent.
+size_t xnn_get_weights_memory_huge_page_size(const struct xnn_weights_buffer* buffer);
+
+// Maps at least `size` bytes with memory policy `flags`, for large buffers which bypass the allocator, e.g. runtime
+// workspaces. Writes the size of the mapping to `capacity_out`, and whether it is backed by explicit huge pages to
+// `hugetlb_out`. Returns NULL if mapping fails.
+void* xnn_allocate_mapped_memory(size_t size, uint32_t flags, size_t* capacity_out, bool* hugetlb_out);
+// Unmaps memory allocated by xnn_allocate_mapped_memory.
+enum xnn_status xnn_release_mapped_memory(void* start, size_t capacity);
+// Returns the number of bytes of memory allocated by xnn_allocate_mapped_memory backed by huge pages, explicit or
+// transparent.
+size_t xnn_get_mapped_memory_huge_page_size(const void* start, size_t capacity, bool hugetlb);
 
 #ifdef __cplusplus
 }  // extern "C"
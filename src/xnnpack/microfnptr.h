@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -150,6 +151,19 @@ typedef void (*xnn_qc8_gemm_minmax_ukernel_fn)(
     size_t cn_stride,
     const union xnn_qc8_conv_minmax_params* params);
 
+typedef void (*xnn_qd8_f32_qc8w_gemm_ukernel_fn)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params* params,
+    const struct xnn_qd8_quantization_params* quantization_params);
+
 typedef void (*xnn_qs8_gemm_minmax_ukernel_fn)(
     size_t mr,
     size_t nr,
@@ -1184,6 +1198,80 @@ typedef void (*xnn_f32_raddstoreexpminusmax_ukernel_fn)(
     float* sum,
     const union xnn_f32_expminus_params* params);
 
+// RNORM: Reduce statistics & NORMalize (Layer/RMS normalization of a row)
+
+typedef void (*xnn_rnorm_ukernel_fn)(
+    size_t channels,
+    const void* input,
+    const void* weights,
+    void* output,
+    const void* params);
+
+typedef void (*xnn_f16_rnorm_ukernel_fn)(
+    size_t channels,
+    const void* input,
+    const void* weights,
+    void* output,
+    const union xnn_f16_rnorm_params* params);
+
+typedef void (*xnn_f32_rnorm_ukernel_fn)(
+    size_t channels,
+    const float* input,
+    const float* weights,
+    float* output,
+    const union xnn_f32_rnorm_params* params);
+
+typedef void (*xnn_qs8_rnorm_ukernel_fn)(
+    size_t channels,
+    const int8_t* input,
+    const float* weights,
+    int8_t* output,
+    const union xnn_qs8_rnorm_params* params);
+
+// RSUM/RSUMSQ/RMIN/RMAX: Reduce a contiguous row and accumulate into the output
+
+typedef void (*xnn_reduce_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    const void* params);
+
+typedef void (*xnn_f32_reduce_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_scale_params* params);
+
+// RDSUM/RDSUMSQ/RDMIN/RDMAX: Reduce Discontiguous rows (strided) and accumulate into the output
+
+typedef void (*xnn_rdreduce_ukernel_fn)(
+    size_t rows,
+    size_t channels,
+    const void* input,
+    size_t input_stride,
+    void* output,
+    const void* params);
+
+typedef void (*xnn_f32_rdreduce_ukernel_fn)(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_scale_params* params);
+
+// EMBEDDING: gather and sum rows of an EMBEDDING table selected by indices
+
+typedef void (*xnn_embedding_ukernel_fn)(
+    size_t rows,
+    size_t channels,
+    const int32_t* indices,
+    const void* table,
+    size_t table_stride,
+    const float* row_scale,
+    float* output,
+    const union xnn_f32_scale_params* params);
+
 // VUNARY: Vector UNARY elementwise
 
 typedef void (*xnn_vunary_ukernel_fn)(
@@ -1392,6 +1480,76 @@ typedef void (*xnn_f32_vsigmoid_ukernel_fn)(
     float* output,
     const union xnn_f32_sigmoid_params* params);
 
+// VTANH: Vector TANH elementwise
+
+typedef void (*xnn_f16_vtanh_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_tanh_params* params);
+
+typedef void (*xnn_f32_vtanh_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_tanh_params* params);
+
+// VGELU: Vector GELU elementwise (exact erf-based form)
+
+typedef void (*xnn_f16_vgelu_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_gelu_params* params);
+
+typedef void (*xnn_f32_vgelu_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_gelu_params* params);
+
+// VAPPROXGELU: Vector approximate GELU elementwise (tanh-based form)
+
+typedef void (*xnn_f16_vapproxgelu_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_approxgelu_params* params);
+
+typedef void (*xnn_f32_vapproxgelu_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_approxgelu_params* params);
+
+// VSILU: Vector SILU (x * sigmoid(x)) elementwise
+
+typedef void (*xnn_f16_vsilu_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_silu_params* params);
+
+typedef void (*xnn_f32_vsilu_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_silu_params* params);
+
+// VEXP: Vector EXPonential elementwise
+
+typedef void (*xnn_f16_vexp_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params* params);
+
+typedef void (*xnn_f32_vexp_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* output,
+    const union xnn_f32_exp_params* params);
+
 // VSQR: Vector SQuaRe elementwise
 
 typedef void (*xnn_f16_vsqr_ukernel_fn)(
@@ -2022,6 +2180,31 @@ typedef size_t (*xnn_init_f32_lrelu_params_fn)(
   union xnn_f32_lrelu_params params[XNN_MIN_ELEMENTS(1)],
   float slope);
 
+typedef size_t (*xnn_init_f32_scale_params_fn)(
+  union xnn_f32_scale_params params[XNN_MIN_ELEMENTS(1)],
+  float scale);
+
+typedef size_t (*xnn_init_f16_rnorm_params_fn)(
+  union xnn_f16_rnorm_params params[XNN_MIN_ELEMENTS(1)],
+  float epsilon,
+  bool subtract_mean);
+
+typedef size_t (*xnn_init_f32_rnorm_params_fn)(
+  union xnn_f32_rnorm_params params[XNN_MIN_ELEMENTS(1)],
+  float epsilon,
+  bool subtract_mean);
+
+typedef size_t (*xnn_init_qs8_rnorm_params_fn)(
+  union xnn_qs8_rnorm_params params[XNN_MIN_ELEMENTS(1)],
+  float epsilon,
+  bool subtract_mean,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max);
+
 typedef size_t (*xnn_init_qs8_lrelu_params_fn)(
   union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)],
   float positive_slope,
@@ -2105,6 +2288,36 @@ typedef size_t (*xnn_init_f16_sqrt_params_fn)(
 typedef size_t (*xnn_init_f32_sqrt_params_fn)(
   union xnn_f32_sqrt_params params[XNN_MIN_ELEMENTS(1)]);
 
+typedef size_t (*xnn_init_f16_tanh_params_fn)(
+  union xnn_f16_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f32_tanh_params_fn)(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f16_gelu_params_fn)(
+  union xnn_f16_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f32_gelu_params_fn)(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f16_approxgelu_params_fn)(
+  union xnn_f16_approxgelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f32_approxgelu_params_fn)(
+  union xnn_f32_approxgelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f16_silu_params_fn)(
+  union xnn_f16_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f32_silu_params_fn)(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f16_exp_params_fn)(
+  union xnn_f16_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef size_t (*xnn_init_f32_exp_params_fn)(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
 typedef void (*xnn_init_qc8_scale_params_fn)(
   size_t channels,
   size_t channels_tile,
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -583,6 +584,47 @@ DECLARE_INIT_F32_LRELU_PARAMS_FUNCTION(xnn_init_f32_lrelu_scalar_params)
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
 
+#define DECLARE_INIT_F32_SCALE_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_f32_scale_params params[XNN_MIN_ELEMENTS(1)], \
+    float scale);
+
+DECLARE_INIT_F32_SCALE_PARAMS_FUNCTION(xnn_init_f32_scale_scalar_params)
+
+
+#define DECLARE_INIT_F16_RNORM_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_f16_rnorm_params params[XNN_MIN_ELEMENTS(1)], \
+    float epsilon,                                          \
+    bool subtract_mean);
+
+DECLARE_INIT_F16_RNORM_PARAMS_FUNCTION(xnn_init_f16_rnorm_scalar_params)
+
+
+#define DECLARE_INIT_F32_RNORM_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_f32_rnorm_params params[XNN_MIN_ELEMENTS(1)], \
+    float epsilon,                                          \
+    bool subtract_mean);
+
+DECLARE_INIT_F32_RNORM_PARAMS_FUNCTION(xnn_init_f32_rnorm_scalar_params)
+
+
+#define DECLARE_INIT_QS8_RNORM_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_qs8_rnorm_params params[XNN_MIN_ELEMENTS(1)], \
+    float epsilon,                                          \
+    bool subtract_mean,                                     \
+    int8_t input_zero_point,                                \
+    float input_scale,                                      \
+    int8_t output_zero_point,                               \
+    float output_scale,                                     \
+    int8_t output_min,                                      \
+    int8_t output_max);
+
+DECLARE_INIT_QS8_RNORM_PARAMS_FUNCTION(xnn_init_qs8_rnorm_scalar_params)
+
+
 #define DECLARE_INIT_QS8_LRELU_PARAMS_FUNCTION(fn_name)     \
   XNN_INTERNAL size_t fn_name(                              \
     union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)], \
@@ -648,6 +690,51 @@ DECLARE_INIT_QU8_LRELU_PARAMS_FUNCTION(xnn_init_qu8_lrelu_scalar_select_params)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#define DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_avx_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_avx_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_APPROXGELU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL size_t fn_name(                                    \
+    union xnn_f32_approxgelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_APPROXGELU_PARAMS_FUNCTION(xnn_init_f32_approxgelu_avx_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL size_t fn_name(                              \
+    union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(xnn_init_f32_silu_avx_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL size_t fn_name(                             \
+    union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(xnn_init_f32_exp_avx_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #define DECLARE_INIT_F16_CHW_PARAMS_FUNCTION(fn_name)     \
   XNN_INTERNAL size_t fn_name(                            \
     union xnn_f16_chw_params params[XNN_MIN_ELEMENTS(1)], \
@@ -119,6 +119,13 @@ union xnn_f32_minmax_params {
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 };
 
+// Dynamically quantized inputs: per-row quantization parameters computed at runtime.
+
+struct xnn_qd8_quantization_params {
+  int32_t zero_point;
+  float scale;
+};
+
 union xnn_s8_minmax_params {
   struct {
     int32_t min;
@@ -2132,6 +2139,49 @@ union xnn_f32_rnd_params {
 };
 
 
+// RNorm (Reduce & Normalize): used by RNORM microkernels for Layer Normalization and RMS Normalization.
+
+union xnn_f16_rnorm_params {
+  struct {
+    float epsilon;
+    uint32_t subtract_mean;
+  } scalar;
+};
+
+union xnn_f32_rnorm_params {
+  struct {
+    float epsilon;
+    uint32_t subtract_mean;
+  } scalar;
+};
+
+union xnn_qs8_rnorm_params {
+  struct {
+    // Epsilon divided by the square of the input scale.
+    float epsilon;
+    uint32_t subtract_mean;
+    int32_t input_zero_point;
+    float inv_output_scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+    int32_t output_zero_point;
+    int32_t output_min;
+    int32_t output_max;
+  } scalar;
+};
+
+
+// Scale: used by RSUM/RDSUM microkernels for Sum and Mean reductions.
+
+union xnn_f32_scale_params {
+  struct {
+    float scale;
+  } scalar;
+};
+
+
 // Sigmoid: used by VSIGMOID microkernels.
 
 union xnn_f16_sigmoid_params {
@@ -2388,6 +2438,81 @@ union xnn_f32_sqrt_params {
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 };
 
+// TanH (Hyperbolic Tangent): used by VTANH microkernels.
+
+union xnn_f16_tanh_params {
+  char _; // Dummy member variable to comply with the C standard
+};
+
+union xnn_f32_tanh_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    int32_t mask_table[14];
+  } avx;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// GELU (Gaussian Error Linear Unit) in the exact erf form: used by VGELU microkernels.
+
+union xnn_f16_gelu_params {
+  char _; // Dummy member variable to comply with the C standard
+};
+
+union xnn_f32_gelu_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    int32_t mask_table[14];
+  } avx;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// Approximate GELU (Gaussian Error Linear Unit) in the tanh form: used by VAPPROXGELU microkernels.
+
+union xnn_f16_approxgelu_params {
+  char _; // Dummy member variable to comply with the C standard
+};
+
+union xnn_f32_approxgelu_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    int32_t mask_table[14];
+  } avx;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// SiLU (Sigmoid Linear Unit, a.k.a. Swish): used by VSILU microkernels.
+
+union xnn_f16_silu_params {
+  char _; // Dummy member variable to comply with the C standard
+};
+
+union xnn_f32_silu_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    int32_t mask_table[14];
+  } avx;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// Exp (Exponential): used by VEXP microkernels.
+
+union xnn_f16_exp_params {
+  char _; // Dummy member variable to comply with the C standard
+};
+
+union xnn_f32_exp_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    int32_t mask_table[14];
+  } avx;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
 // CHW: used by CONV/DWCONV microkernels in CHW layout with Min+Max parameters.
 
 union xnn_f16_chw_params {
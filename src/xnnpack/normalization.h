@@ -45,6 +45,17 @@ void xnn_normalize_transpose_permutation(
     size_t* normalized_input_stride,
     size_t* normalized_output_stride);
 
+// Normalizes a reduction over the given axes of a tensor in place.
+// Reduction axes must be sorted in increasing order and must not repeat. Dimensions of size 1 are removed, and adjacent
+// dimensions which are either both reduced or both kept are merged into a single dimension.
+// E.g. Given input shape { 2, 3, 4, 5 } with reduction axes { 2, 3 }, the normalized input shape is { 6, 20 } with
+// reduction axes { 1 }.
+void xnn_normalize_reduction(
+    size_t* num_reduction_axes_ptr,
+    size_t* reduction_axes,
+    size_t* num_input_dims_ptr,
+    size_t* input_dims);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
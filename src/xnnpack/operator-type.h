@@ -72,13 +72,22 @@ enum xnn_operator_type {
   xnn_operator_type_divide_nd_f32,
   xnn_operator_type_elu_nc_f16,
   xnn_operator_type_elu_nc_f32,
+  xnn_operator_type_embedding_lookup_nc_f16_f32,
+  xnn_operator_type_embedding_lookup_nc_f32,
+  xnn_operator_type_embedding_lookup_nc_qc4_f32,
+  xnn_operator_type_embedding_lookup_nc_qc8_f32,
   xnn_operator_type_elu_nc_qs8,
+  xnn_operator_type_exp_nc_f16,
+  xnn_operator_type_exp_nc_f32,
   xnn_operator_type_floor_nc_f16,
   xnn_operator_type_floor_nc_f32,
   xnn_operator_type_fully_connected_nc_f16,
   xnn_operator_type_fully_connected_nc_f32,
+  xnn_operator_type_fully_connected_nc_qd8_f32_qc8w,
   xnn_operator_type_fully_connected_nc_qs8,
   xnn_operator_type_fully_connected_nc_qu8,
+  xnn_operator_type_gelu_nc_f16,
+  xnn_operator_type_gelu_nc_f32,
   xnn_operator_type_global_average_pooling_ncw_f16,
   xnn_operator_type_global_average_pooling_ncw_f32,
   xnn_operator_type_global_average_pooling_nwc_f16,
@@ -87,6 +96,9 @@ enum xnn_operator_type {
   xnn_operator_type_global_average_pooling_nwc_qu8,
   xnn_operator_type_hardswish_nc_f16,
   xnn_operator_type_hardswish_nc_f32,
+  xnn_operator_type_layer_norm_nc_f16,
+  xnn_operator_type_layer_norm_nc_f32,
+  xnn_operator_type_layer_norm_nc_qs8,
   xnn_operator_type_leaky_relu_nc_f16,
   xnn_operator_type_leaky_relu_nc_f32,
   xnn_operator_type_leaky_relu_nc_qs8,
@@ -107,16 +119,26 @@ enum xnn_operator_type {
   xnn_operator_type_negate_nc_f32,
   xnn_operator_type_prelu_nc_f16,
   xnn_operator_type_prelu_nc_f32,
+  xnn_operator_type_reduce_l2_nd_f32,
+  xnn_operator_type_reduce_max_nd_f32,
+  xnn_operator_type_reduce_mean_nd_f32,
+  xnn_operator_type_reduce_min_nd_f32,
+  xnn_operator_type_reduce_sum_nd_f32,
   xnn_operator_type_resize_bilinear_nchw_f16,
   xnn_operator_type_resize_bilinear_nchw_f32,
   xnn_operator_type_resize_bilinear_nhwc_f16,
   xnn_operator_type_resize_bilinear_nhwc_f32,
   xnn_operator_type_resize_bilinear_nhwc_s8,
   xnn_operator_type_resize_bilinear_nhwc_u8,
+  xnn_operator_type_rms_norm_nc_f16,
+  xnn_operator_type_rms_norm_nc_f32,
+  xnn_operator_type_rms_norm_nc_qs8,
   xnn_operator_type_sigmoid_nc_f16,
   xnn_operator_type_sigmoid_nc_f32,
   xnn_operator_type_sigmoid_nc_qs8,
   xnn_operator_type_sigmoid_nc_qu8,
+  xnn_operator_type_silu_nc_f16,
+  xnn_operator_type_silu_nc_f32,
   xnn_operator_type_slice_nd_x8,
   xnn_operator_type_slice_nd_x16,
   xnn_operator_type_slice_nd_x32,
@@ -136,6 +158,8 @@ enum xnn_operator_type {
   xnn_operator_type_subtract_nd_f32,
   xnn_operator_type_subtract_nd_qs8,
   xnn_operator_type_subtract_nd_qu8,
+  xnn_operator_type_tanh_nc_f16,
+  xnn_operator_type_tanh_nc_f32,
   xnn_operator_type_tanh_nc_qs8,
   xnn_operator_type_tanh_nc_qu8,
   xnn_operator_type_transpose_nd_x8,
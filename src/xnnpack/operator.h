@@ -58,6 +58,8 @@ struct xnn_ukernel_gemm {
   uint8_t nr;
   uint8_t kr;
   uint8_t sr;
+  // Number of input channels in every block of K-blocked packed weights, or 0 if the weights are not split along K.
+  size_t kc;
 };
 
 struct xnn_ukernel_igemm {
@@ -184,7 +186,19 @@ struct xnn_operator {
 
   uint32_t block_size;
 
+  // Embedding table of embedding lookup operators. The table is referenced, not copied.
+  struct {
+    const void* table;
+    size_t table_stride;
+    // Per-row dequantization scales of quantized tables.
+    const float* table_scale;
+    enum xnn_embedding_pooling pooling;
+  } embedding;
+
   void* zero_buffer;
+  // Scratch memory reallocated on setup: partial results of a reduction split across threads, or the quantized rows of
+  // inputs of an operator with dynamically quantized inputs.
+  void* workspace;
   void* lookup_table;
   void* pixelwise_buffer;
   struct subconvolution_params* subconvolution_buffer;
@@ -192,20 +206,32 @@ struct xnn_operator {
 
   union {
     union xnn_f16_abs_params f16_abs;
+    union xnn_f16_approxgelu_params f16_approxgelu;
+    union xnn_f16_exp_params f16_exp;
     union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_f16_gelu_params f16_gelu;
     union xnn_f16_hswish_params f16_hswish;
     union xnn_f16_elu_params f16_elu;
     union xnn_f16_lrelu_params f16_lrelu;
     union xnn_f16_neg_params f16_neg;
+    union xnn_f16_rnorm_params f16_rnorm;
     union xnn_f16_sigmoid_params f16_sigmoid;
+    union xnn_f16_silu_params f16_silu;
+    union xnn_f16_tanh_params f16_tanh;
     union xnn_f32_abs_params f32_abs;
+    union xnn_f32_approxgelu_params f32_approxgelu;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_exp_params f32_exp;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_neg_params f32_neg;
     union xnn_f32_rnd_params f32_rnd;
+    union xnn_f32_rnorm_params f32_rnorm;
     union xnn_f32_sigmoid_params f32_sigmoid;
+    union xnn_f32_silu_params f32_silu;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     // Parameters for Global Average Pooling in CHW layout
     union xnn_f16_gavgpool_params f16_gavgpool;
     union xnn_f32_gavgpool_params f32_gavgpool;
@@ -224,6 +250,14 @@ struct xnn_operator {
     };
     union xnn_f16_chw_params f16_chw;
     union xnn_f32_chw_params f32_chw;
+    // K-blocked GEMM accumulates partial results of every block of input channels in the output, so only the
+    // addition of the partial results of the last block clamps the output.
+    struct {
+      union xnn_f32_minmax_params minmax;
+      union xnn_f32_minmax_params linear;
+      union xnn_f32_minmax_params add_linear;
+      union xnn_f32_minmax_params add_minmax;
+    } f32_blocked_gemm;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
     union xnn_f32_qs8_cvt_params f32_qs8_cvt;
     union xnn_f32_qu8_cvt_params f32_qu8_cvt;
@@ -263,6 +297,7 @@ struct xnn_operator {
       union xnn_qu8_avgpool_minmax_params qu8_gavgpool;
     };
     union xnn_qs8_lrelu_params qs8_lrelu;
+    union xnn_qs8_rnorm_params qs8_rnorm;
     union xnn_qu8_lrelu_params qu8_lrelu;
     union xnn_s8_minmax_params s8_minmax;
     union xnn_u8_minmax_params u8_minmax;
@@ -277,11 +312,13 @@ struct xnn_operator {
   union {
     struct argmax_pooling_context argmax_pooling;
     struct average_pooling_context average_pooling;
+    struct blocked_gemm_context blocked_gemm;
     struct channel_shuffle_context channel_shuffle;
     struct conv2d_context conv2d;
     struct dwconv2d_context dwconv2d;
     struct dwconv_context dwconv;
     struct elementwise_binary_context elementwise_binary;
+    struct embedding_context embedding;
     struct gemm_context gemm;
     struct global_average_pooling_nwc_context global_average_pooling_nwc;
     struct global_average_pooling_ncw_context global_average_pooling_ncw;
@@ -292,6 +329,9 @@ struct xnn_operator {
     struct pad_context pad;
     struct pixelwise_average_pooling_context pixelwise_average_pooling;
     struct prelu_context prelu;
+    struct qd8_gemm_context qd8_gemm;
+    struct reduce_context reduce;
+    struct rnorm_context rnorm;
     struct resize_bilinear_context resize_bilinear;
     struct resize_bilinear_chw_context resize_bilinear_chw;
     struct slice_context slice;
@@ -309,6 +349,13 @@ struct xnn_operator {
 
   struct xnn_code_cache* code_cache;
   struct xnn_weights_cache* weights_cache;
+  // Cache of indirection buffers shared with other operators, and the entry indirection_buffer points into. When the
+  // entry is not NULL, the operator doesn't own its indirection buffer.
+  struct xnn_indirection_cache* indirection_cache;
+  struct xnn_indirection_cache_entry* indirection_cache_entry;
+  // Arena of the runtime which owns the operator. When not NULL, the operator descriptor, indirection buffer,
+  // subconvolution buffer, and post-operation parameters are allocated from the arena and released with it.
+  struct xnn_arena* arena;
   enum xnn_run_state state;
 };
 
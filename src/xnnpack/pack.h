@@ -29,6 +29,10 @@ struct xnn_qs8_packing_params {
   int8_t input_zero_point;
 };
 
+struct xnn_qs8_rnorm_packing_params {
+  float output_scale;
+};
+
 
 typedef void (*xnn_pack_gemm_goi_w_fn)(
   size_t g,
@@ -932,6 +936,41 @@ XNN_INTERNAL void xnn_pack_f32_to_f16_prelu_w(
   const float* s,
   uint16_t* packed_weights);
 
+typedef void (*xnn_pack_rnorm_w_fn)(
+  size_t c,
+  const void* gamma,
+  const void* beta,
+  void* packed_weights,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_f32_rnorm_w(
+  size_t c,
+  const float* gamma,
+  const float* beta,
+  float* packed_weights,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_f16_rnorm_w(
+  size_t c,
+  const uint16_t* gamma,
+  const uint16_t* beta,
+  uint16_t* packed_weights,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_f32_to_f16_rnorm_w(
+  size_t c,
+  const float* gamma,
+  const float* beta,
+  uint16_t* packed_weights,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_qs8_rnorm_w(
+  size_t c,
+  const float* gamma,
+  const float* beta,
+  float* packed_weights,
+  const struct xnn_qs8_rnorm_packing_params* params);
+
 // Sparse packing functions.
 
 struct xnn_spmm_packing_params {
@@ -7,6 +7,8 @@
 
 #include <stddef.h>
 
+struct xnn_arena;
+
 // Operators that can be applied post convolution.
 enum xnn_post_operation_type {
   xnn_post_operation_type_none,
@@ -28,10 +30,11 @@ extern "C" {
 #endif
 
 // Allocate space for params required for post_operations and initialize all params.
-// This allocation will be freed when the operator holding these params is deleted.
+// This allocation will be freed when the operator holding these params is deleted, or with the arena if one is given.
 char* allocate_and_initialize_post_operation_params(
     size_t num_post_operations,
-    const struct xnn_post_operation* post_operations);
+    const struct xnn_post_operation* post_operations,
+    struct xnn_arena* arena);
 
 #ifdef __cplusplus
 }  // extern "C"
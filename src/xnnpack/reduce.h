@@ -0,0 +1,97 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/microparams.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Contiguous reductions fold batch bytes of input into a single output element. Sums (RSUM, RSUMSQ) are multiplied by
+// params->scalar.scale and added to the output, extrema (RMIN, RMAX) are combined with the current output value.
+// RMINMAX combines both extrema at once, with the minimum in output[0] and the maximum in output[1].
+#define DECLARE_F32_REDUCE_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                         \
+      size_t batch,                                  \
+      const float* input,                            \
+      float* output,                                 \
+      const union xnn_f32_scale_params* params);
+
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__avx_x32)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__avx512f_x64)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__neon_x16)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__scalar_x4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmax_ukernel__sse_x16)
+
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__avx_x32)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__avx512f_x64)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__neon_x16)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__scalar_x4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__sse_x16)
+
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_x32)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__neon_x16)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__scalar_x4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__sse_x16)
+
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx_x32)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx512f_x64)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__neon_x16)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__scalar_x4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__sse_x16)
+
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsumsq_ukernel__avx_x32)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsumsq_ukernel__avx512f_x64)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsumsq_ukernel__neon_x16)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsumsq_ukernel__scalar_x4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rsumsq_ukernel__sse_x16)
+
+
+// Discontiguous reductions fold rows of channels elements, input_stride bytes apart, into channels output elements,
+// with the same accumulation rules as the contiguous reductions.
+#define DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                           \
+      size_t rows,                                     \
+      size_t channels,                                 \
+      const float* input,                              \
+      size_t input_stride,                             \
+      float* output,                                   \
+      const union xnn_f32_scale_params* params);
+
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel__sse_c16)
+
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel__sse_c16)
+
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsum_ukernel__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsum_ukernel__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsum_ukernel__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsum_ukernel__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsum_ukernel__sse_c16)
+
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsumsq_ukernel__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsumsq_ukernel__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsumsq_ukernel__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsumsq_ukernel__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdsumsq_ukernel__sse_c16)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -0,0 +1,66 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/microparams.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// RNORM micro-kernels normalize a single row of `channels` bytes in two passes: the first pass computes the mean and
+// variance (or the mean square for RMS normalization) of the row, and the second pass computes
+//   output[c] = (input[c] - mean) / sqrt(variance + epsilon) * gamma[c] + beta[c]
+// where gamma and beta are packed back-to-back in the weights.
+
+#define DECLARE_F16_RNORM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t channels,                              \
+      const void* input,                            \
+      const void* weights,                          \
+      void* output,                                 \
+      const union xnn_f16_rnorm_params* params);
+
+DECLARE_F16_RNORM_UKERNEL_FUNCTION(xnn_f16_rnorm_ukernel__f16c_x16)
+DECLARE_F16_RNORM_UKERNEL_FUNCTION(xnn_f16_rnorm_ukernel__neonfp16arith_x16)
+
+
+#define DECLARE_F32_RNORM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t channels,                              \
+      const float* input,                           \
+      const float* weights,                         \
+      float* output,                                \
+      const union xnn_f32_rnorm_params* params);
+
+DECLARE_F32_RNORM_UKERNEL_FUNCTION(xnn_f32_rnorm_ukernel__avx_x16)
+DECLARE_F32_RNORM_UKERNEL_FUNCTION(xnn_f32_rnorm_ukernel__avx512f_x32)
+DECLARE_F32_RNORM_UKERNEL_FUNCTION(xnn_f32_rnorm_ukernel__neon_x8)
+DECLARE_F32_RNORM_UKERNEL_FUNCTION(xnn_f32_rnorm_ukernel__scalar_x4)
+DECLARE_F32_RNORM_UKERNEL_FUNCTION(xnn_f32_rnorm_ukernel__sse_x8)
+
+
+#define DECLARE_QS8_RNORM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t channels,                              \
+      const int8_t* input,                          \
+      const float* weights,                         \
+      int8_t* output,                               \
+      const union xnn_qs8_rnorm_params* params);
+
+DECLARE_QS8_RNORM_UKERNEL_FUNCTION(xnn_qs8_rnorm_ukernel__neon_x16)
+DECLARE_QS8_RNORM_UKERNEL_FUNCTION(xnn_qs8_rnorm_ukernel__scalar_x4)
+DECLARE_QS8_RNORM_UKERNEL_FUNCTION(xnn_qs8_rnorm_ukernel__sse41_x16)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
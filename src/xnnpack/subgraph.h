@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <xnnpack.h>
+#include <xnnpack/allocator.h>
 #include <xnnpack/common.h>
 #include <xnnpack/cache.h>
 #include <xnnpack/node-type.h>
@@ -194,6 +195,10 @@ enum xnn_compute_type {
   xnn_compute_type_fp16_to_fp32,
   xnn_compute_type_qs8_to_fp32,
   xnn_compute_type_qu8_to_fp32,
+  // FP32 inputs and outputs with channelwise quantized INT8 weights, dequantized when the operator is created.
+  xnn_compute_type_fp32_qc8w,
+  // FP32 inputs quantized to INT8 at runtime, channelwise quantized INT8 weights, and FP32 outputs.
+  xnn_compute_type_qd8_to_fp32,
 };
 
 struct xnn_node {
@@ -266,14 +271,27 @@ struct xnn_node {
     struct {
       float alpha;
     } elu;
+    struct {
+      enum xnn_embedding_pooling pooling;
+    } embedding_lookup;
     struct {
       float negative_slope;
     } leaky_relu;
+    struct {
+      size_t num_reduction_axes;
+      size_t reduction_axes[XNN_MAX_TENSOR_DIMS];
+      float epsilon;
+    } normalization;
     struct {
       size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
       size_t post_paddings[XNN_MAX_TENSOR_DIMS];
       uint32_t padding_value;
     } static_pad;
+    struct {
+      enum xnn_reduce_operator reduce_operator;
+      size_t num_reduction_axes;
+      size_t reduction_axes[XNN_MAX_TENSOR_DIMS];
+    } reduce;
     struct {
       struct xnn_shape new_shape;
     } static_reshape;
@@ -355,6 +373,11 @@ struct xnn_operator_data {
   uint32_t inputs[XNN_MAX_RUNTIME_INPUTS];
   uint32_t outputs[XNN_MAX_RUNTIME_OUTPUTS];
   xnn_timestamp end_ts[XNN_MAX_OPERATOR_OBJECTS];
+  // Data of the input and output blobs at the last successful setup of the operator. Operators are set up again only if
+  // any of their blobs moved since.
+  bool is_set_up;
+  const void* setup_inputs_data[XNN_MAX_RUNTIME_INPUTS];
+  const void* setup_outputs_data[XNN_MAX_RUNTIME_OUTPUTS];
 };
 
 struct xnn_subgraph {
@@ -390,6 +413,12 @@ struct xnn_runtime {
   struct xnn_code_cache code_cache;
 #endif // XNN_PLATFORM_JIT
 
+  // Indirection buffers shared by convolution operators of the runtime.
+  struct xnn_indirection_cache indirection_cache;
+
+  // Memory for operator descriptors, opdata, blobs, and other metadata which lives as long as the runtime.
+  struct xnn_arena arena;
+
   pthreadpool_t threadpool;
 
   bool profiling;
@@ -424,12 +453,19 @@ enum xnn_status xnn_subgraph_optimize(xnn_subgraph_t subgraph, uint32_t flags);
 void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph);
 // Rewrites subgraph for FP16, returns true if success, false if rewrite failed.
 bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph);
+// Rewrites Fully Connected and 1x1 Convolution Nodes with channelwise quantized weights to quantize their inputs at
+// runtime.
+void xnn_subgraph_rewrite_for_dynamic_quantization(xnn_subgraph_t subgraph);
 
 void xnn_node_clear(struct xnn_node* node);
 void xnn_value_clear(struct xnn_value* value);
 
 void xnn_value_copy(struct xnn_value* dst_value, const struct xnn_value* src_value);
 
+// Dequantizes the data of a static channelwise quantized INT8 Value into a newly allocated FP32 buffer, which the
+// caller must release with xnn_release_memory. Returns NULL if the allocation fails.
+float* xnn_value_dequantize_qcint8(const struct xnn_value* value);
+
 void xnn_init_convert_node(
   struct xnn_node* node,
   enum xnn_compute_type compute_type,
@@ -440,6 +476,12 @@ void xnn_init_convert_node(
 struct xnn_workspace {
   void* data;
   size_t size;
+  // Size of the allocation of data, which can exceed size when data is mapped with a memory policy.
+  size_t capacity;
+  // Memory policy of data: XNN_FLAG_HUGE_PAGES, XNN_FLAG_TRANSPARENT_HUGE_PAGES, and XNN_FLAG_PREFAULT_MEMORY.
+  uint32_t memory_flags;
+  // Whether data is backed by explicit huge pages.
+  bool hugetlb;
   struct xnn_runtime* first_user;
   // Workspace will be destroyed in xnn_delete_runtime or xnn_delete_workspace if num_users reaches 0.
   size_t ref_count;
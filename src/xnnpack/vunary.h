@@ -1187,6 +1187,211 @@ DECLARE_U8_VCLAMP_UKERNEL_FUNCTION(xnn_u8_vclamp_ukernel__wasmsimd_x64)
 DECLARE_U64_U32_VSQRTSHIFT_UKERNEL_FUNCTION(xnn_u64_u32_vsqrtshift_ukernel__scalar_cvtu32_sqrt_cvtu32f64_x1)
 
 
+#define DECLARE_F16_VTANH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const void* x,                                \
+      void* y,                                      \
+      const union xnn_f16_tanh_params* params);
+
+DECLARE_F16_VTANH_UKERNEL_FUNCTION(xnn_f16_vtanh_ukernel__avx2_rational_13_6_div_x8)
+DECLARE_F16_VTANH_UKERNEL_FUNCTION(xnn_f16_vtanh_ukernel__avx2_rational_13_6_div_x16)
+
+DECLARE_F16_VTANH_UKERNEL_FUNCTION(xnn_f16_vtanh_ukernel__neonfp16arith_rational_13_6_nr1recps_x8)
+DECLARE_F16_VTANH_UKERNEL_FUNCTION(xnn_f16_vtanh_ukernel__neonfp16arith_rational_13_6_nr1recps_x16)
+
+
+#define DECLARE_F16_VGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const void* x,                                \
+      void* y,                                      \
+      const union xnn_f16_gelu_params* params);
+
+DECLARE_F16_VGELU_UKERNEL_FUNCTION(xnn_f16_vgelu_ukernel__avx2_rational_13_8_div_x8)
+DECLARE_F16_VGELU_UKERNEL_FUNCTION(xnn_f16_vgelu_ukernel__avx2_rational_13_8_div_x16)
+
+DECLARE_F16_VGELU_UKERNEL_FUNCTION(xnn_f16_vgelu_ukernel__neonfp16arith_rational_13_8_nr1recps_x8)
+DECLARE_F16_VGELU_UKERNEL_FUNCTION(xnn_f16_vgelu_ukernel__neonfp16arith_rational_13_8_nr1recps_x16)
+
+
+#define DECLARE_F16_VAPPROXGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                              \
+      size_t n,                                           \
+      const void* x,                                      \
+      void* y,                                            \
+      const union xnn_f16_approxgelu_params* params);
+
+DECLARE_F16_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f16_vapproxgelu_ukernel__avx2_rational_13_6_div_x8)
+DECLARE_F16_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f16_vapproxgelu_ukernel__avx2_rational_13_6_div_x16)
+
+DECLARE_F16_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f16_vapproxgelu_ukernel__neonfp16arith_rational_13_6_nr1recps_x8)
+DECLARE_F16_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f16_vapproxgelu_ukernel__neonfp16arith_rational_13_6_nr1recps_x16)
+
+
+#define DECLARE_F16_VSILU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const void* x,                                \
+      void* y,                                      \
+      const union xnn_f16_silu_params* params);
+
+DECLARE_F16_VSILU_UKERNEL_FUNCTION(xnn_f16_vsilu_ukernel__avx2_rr2_p5_div_x8)
+DECLARE_F16_VSILU_UKERNEL_FUNCTION(xnn_f16_vsilu_ukernel__avx2_rr2_p5_div_x16)
+
+DECLARE_F16_VSILU_UKERNEL_FUNCTION(xnn_f16_vsilu_ukernel__neonfp16arith_rr2_p5_nr1recps_x8)
+DECLARE_F16_VSILU_UKERNEL_FUNCTION(xnn_f16_vsilu_ukernel__neonfp16arith_rr2_p5_nr1recps_x16)
+
+
+#define DECLARE_F16_VEXP_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t n,                                    \
+      const void* x,                               \
+      void* y,                                     \
+      const union xnn_f16_exp_params* params);
+
+DECLARE_F16_VEXP_UKERNEL_FUNCTION(xnn_f16_vexp_ukernel__avx2_rr2_p5_x8)
+DECLARE_F16_VEXP_UKERNEL_FUNCTION(xnn_f16_vexp_ukernel__avx2_rr2_p5_x16)
+
+DECLARE_F16_VEXP_UKERNEL_FUNCTION(xnn_f16_vexp_ukernel__neonfp16arith_rr2_p5_x8)
+DECLARE_F16_VEXP_UKERNEL_FUNCTION(xnn_f16_vexp_ukernel__neonfp16arith_rr2_p5_x16)
+
+
+#define DECLARE_F32_VTANH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_tanh_params* params);
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__aarch64_neonfma_rational_13_6_div_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__aarch64_neonfma_rational_13_6_div_x8)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx512f_rational_13_6_div_x16)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx512f_rational_13_6_div_x32)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__fma3_rational_13_6_div_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__fma3_rational_13_6_div_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_rational_13_6_nr2recps_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_rational_13_6_nr2recps_x8)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x1)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x2)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_rational_13_6_div_x4)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_rational_13_6_div_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_rational_13_6_div_x8)
+
+
+#define DECLARE_F32_VGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_gelu_params* params);
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__aarch64_neonfma_rational_13_8_div_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__aarch64_neonfma_rational_13_8_div_x8)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__fma3_rational_13_8_div_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__fma3_rational_13_8_div_x16)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8)
+
+
+#define DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                              \
+      size_t n,                                           \
+      const float* x,                                     \
+      float* y,                                           \
+      const union xnn_f32_approxgelu_params* params);
+
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__aarch64_neonfma_rational_13_6_div_x4)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__aarch64_neonfma_rational_13_6_div_x8)
+
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__avx512f_rational_13_6_div_x16)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__avx512f_rational_13_6_div_x32)
+
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__fma3_rational_13_6_div_x8)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__fma3_rational_13_6_div_x16)
+
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__neon_rational_13_6_nr2recps_x4)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__neon_rational_13_6_nr2recps_x8)
+
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x1)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x2)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__scalar_rational_13_6_div_x4)
+
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__sse2_rational_13_6_div_x4)
+DECLARE_F32_VAPPROXGELU_UKERNEL_FUNCTION(xnn_f32_vapproxgelu_ukernel__sse2_rational_13_6_div_x8)
+
+
+#define DECLARE_F32_VSILU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_silu_params* params);
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__aarch64_neonfma_rr2_p5_div_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__aarch64_neonfma_rr2_p5_div_x8)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx2_rr2_p5_div_x8)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx2_rr2_p5_div_x16)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx512f_rr1_p5_scalef_div_x16)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx512f_rr1_p5_scalef_div_x32)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x8)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x1)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x2)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x8)
+
+
+#define DECLARE_F32_VEXP_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t n,                                    \
+      const float* x,                              \
+      float* y,                                    \
+      const union xnn_f32_exp_params* params);
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x16)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neon_rr2_p5_x4)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neon_rr2_p5_x8)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__scalar_rr2_p5_x1)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8)
+
+
 #define DECLARE_XX_VUNARY_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                        \
       size_t size,                                  \
@@ -907,4 +907,122 @@ TEST_F(ConvolutionTestF32, matches_operator_api)
     ASSERT_EQ(subgraph_output[i], operator_output[i]);
   }
 }
+
+TEST_F(ConvolutionTestF32, shares_indirection_buffer)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  // Two padded 3x3 convolutions of the same input, which differ only in weights, have the same indirection buffer.
+  const uint32_t padding = 1;
+  const uint32_t kernel_size = 3;
+  const std::array<size_t, 4> shared_input_dims = {{batch_size, input_height, input_width, group_input_channels}};
+  const std::array<size_t, 4> shared_filter_dims = {{
+    group_output_channels, kernel_size, kernel_size, group_input_channels}};
+  const std::array<size_t, 1> shared_bias_dims = {{group_output_channels}};
+  const std::array<size_t, 4> shared_output_dims = {{batch_size, input_height, input_width, group_output_channels}};
+  std::vector<float> shared_input(
+    XNN_EXTRA_BYTES / sizeof(float) + batch_size * input_height * input_width * group_input_channels);
+  std::generate(shared_input.begin(), shared_input.end(), [&]() { return f32dist(rng); });
+  std::array<std::vector<float>, 2> filters;
+  std::array<std::vector<float>, 2> biases;
+  std::array<std::vector<float>, 2> operator_outputs;
+  std::array<std::vector<float>, 2> subgraph_outputs;
+  for (size_t i = 0; i < 2; i++) {
+    filters[i].resize(group_output_channels * kernel_size * kernel_size * group_input_channels);
+    std::generate(filters[i].begin(), filters[i].end(), [&]() { return f32dist(rng); });
+    biases[i].resize(group_output_channels);
+    std::generate(biases[i].begin(), biases[i].end(), [&]() { return f32dist(rng); });
+    operator_outputs[i].resize(batch_size * input_height * input_width * group_output_channels);
+    subgraph_outputs[i].assign(operator_outputs[i].size(), nanf(""));
+  }
+
+  // Call operator API.
+  for (size_t i = 0; i < 2; i++) {
+    xnn_operator_t op = nullptr;
+    const xnn_status status = xnn_create_convolution2d_nhwc_f32(
+      padding, padding, padding, padding, kernel_size, kernel_size, /*subsampling_height=*/1, /*subsampling_width=*/1,
+      /*dilation_height=*/1, /*dilation_width=*/1, /*groups=*/1, group_input_channels, group_output_channels,
+      group_input_channels, group_output_channels, filters[i].data(), biases[i].data(), output_min, output_max,
+      /*flags=*/0, nullptr, &op);
+    std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+
+    if (status == xnn_status_unsupported_hardware) {
+      GTEST_SKIP();
+    }
+
+    ASSERT_EQ(xnn_status_success, status);
+    ASSERT_NE(nullptr, op);
+    ASSERT_EQ(
+      xnn_status_success, xnn_setup_convolution2d_nhwc_f32(
+                            op, batch_size, input_height, input_width, shared_input.data(),
+                            operator_outputs[i].data(), /*threadpool=*/nullptr));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+  }
+
+  // Call subgraph API.
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, shared_input_dims.size(), shared_input_dims.data(), nullptr,
+                          /*external_id=*/0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  ASSERT_NE(input_id, XNN_INVALID_NODE_ID);
+
+  std::array<uint32_t, 2> output_ids;
+  for (size_t i = 0; i < 2; i++) {
+    uint32_t filter_id = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, xnn_datatype_fp32, shared_filter_dims.size(), shared_filter_dims.data(),
+                            filters[i].data(), XNN_INVALID_VALUE_ID, /*flags=*/0, &filter_id));
+
+    uint32_t bias_id = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, xnn_datatype_fp32, shared_bias_dims.size(), shared_bias_dims.data(),
+                            biases[i].data(), XNN_INVALID_VALUE_ID, /*flags=*/0, &bias_id));
+
+    output_ids[i] = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, xnn_datatype_fp32, shared_output_dims.size(), shared_output_dims.data(), nullptr,
+                            /*external_id=*/1 + i, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_ids[i]));
+    ASSERT_NE(output_ids[i], XNN_INVALID_NODE_ID);
+    ASSERT_EQ(
+      xnn_status_success,
+      xnn_define_convolution_2d(
+        subgraph, padding, padding, padding, padding, kernel_size, kernel_size, /*subsampling_height=*/1,
+        /*subsampling_width=*/1, /*dilation_height=*/1, /*dilation_width=*/1, /*groups=*/1, group_input_channels,
+        group_output_channels, output_min, output_max, input_id, filter_id, bias_id, output_ids[i], /*flags=*/0));
+  }
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  std::array<xnn_external_value, 3> external = {
+    xnn_external_value{input_id, shared_input.data()},
+    xnn_external_value{output_ids[0], subgraph_outputs[0].data()},
+    xnn_external_value{output_ids[1], subgraph_outputs[1].data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  ASSERT_EQ(size_t(2), runtime->num_ops);
+  const xnn_operator_t op0 = runtime->opdata[0].operator_objects[0];
+  const xnn_operator_t op1 = runtime->opdata[1].operator_objects[0];
+  ASSERT_NE(nullptr, op0->indirection_buffer);
+  ASSERT_EQ(op0->indirection_buffer, op1->indirection_buffer);
+  ASSERT_EQ(size_t(1), runtime->indirection_cache.misses);
+  ASSERT_EQ(size_t(1), runtime->indirection_cache.hits);
+
+  // Check outputs match.
+  for (size_t i = 0; i < 2; i++) {
+    for (size_t j = 0; j < operator_outputs[i].size(); j++) {
+      ASSERT_EQ(subgraph_outputs[i][j], operator_outputs[i][j]);
+    }
+  }
+}
 }  // namespace xnnpack
@@ -733,3 +733,75 @@ TEST_F(DeconvolutionTestF32, matches_operator_api)
     ASSERT_EQ(subgraph_output[i], operator_output[i]);
   }
 }
+
+TEST_F(DeconvolutionTestF32, allocates_metadata_from_runtime_arena)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+  std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+  std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+                          /*external_id=*/0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t kernel_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, kernel_dims.size(), kernel_dims.data(), kernel.data(),
+                          /*external_id=*/1, /*flags=*/0, &kernel_id));
+  uint32_t bias_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), bias.data(),
+                          /*external_id=*/2, /*flags=*/0, &bias_id));
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+                          /*external_id=*/3, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_deconvolution_2d(
+      subgraph, padding_top, padding_right, padding_bottom, padding_left, adjustment_height, adjustment_width,
+      kernel_height, kernel_width, upsampling_height, upsampling_width, dilation_height, dilation_width, groups,
+      group_input_channels, group_output_channels, output_min, output_max, input_id, kernel_id, bias_id, output_id,
+      /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  // The operator descriptor comes from the arena, which is sized ahead of time for the subgraph.
+  ASSERT_EQ(size_t(1), runtime->num_ops);
+  const xnn_operator_t op = runtime->opdata[0].operator_objects[0];
+  ASSERT_NE(nullptr, op);
+  ASSERT_EQ(&runtime->arena, op->arena);
+  ASSERT_EQ(size_t(1), runtime->arena.num_blocks);
+
+  std::vector<float> other_output(subgraph_output.size());
+  std::array<xnn_external_value, 2> external = {
+    xnn_external_value{input_id, input.data()}, xnn_external_value{output_id, subgraph_output.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  const void** indirection_buffer = op->indirection_buffer;
+  const size_t allocated_bytes = runtime->arena.allocated_bytes;
+
+  // Setting up again with the same shapes reuses the indirection buffer allocated from the arena.
+  external[1].data = other_output.data();
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  ASSERT_EQ(indirection_buffer, op->indirection_buffer);
+  ASSERT_EQ(allocated_bytes, runtime->arena.allocated_bytes);
+
+  for (size_t i = 0; i < subgraph_output.size(); i++) {
+    ASSERT_EQ(subgraph_output[i], other_output[i]);
+  }
+}
@@ -0,0 +1,312 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "embedding-lookup-operator-tester.h"
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, no_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(1)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestF16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, no_pooling_with_bags) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(4)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestF16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, sum_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestF16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, mean_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_mean)
+      .TestF16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, large_embedding_dim) {
+  for (size_t embedding_dim = 1000; embedding_dim < 5000; embedding_dim += 1333) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(2)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestF16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, multithreaded) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(37)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .num_threads(4)
+      .TestF16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F16_F32, zero_batch) {
+  EmbeddingLookupOperatorTester()
+    .batch_size(0)
+    .bag_size(3)
+    .embedding_dim(17)
+    .pooling(xnn_embedding_pooling_sum)
+    .TestF16();
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, no_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(1)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestF32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, no_pooling_with_bags) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(4)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestF32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, sum_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestF32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, mean_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_mean)
+      .TestF32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, large_embedding_dim) {
+  for (size_t embedding_dim = 1000; embedding_dim < 5000; embedding_dim += 1333) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(2)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestF32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, multithreaded) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(37)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .num_threads(4)
+      .TestF32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_F32, zero_batch) {
+  EmbeddingLookupOperatorTester()
+    .batch_size(0)
+    .bag_size(3)
+    .embedding_dim(17)
+    .pooling(xnn_embedding_pooling_sum)
+    .TestF32();
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, no_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(1)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestQC4();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, no_pooling_with_bags) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(4)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestQC4();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, sum_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestQC4();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, mean_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_mean)
+      .TestQC4();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, large_embedding_dim) {
+  for (size_t embedding_dim = 1000; embedding_dim < 5000; embedding_dim += 1333) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(2)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestQC4();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, multithreaded) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(37)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .num_threads(4)
+      .TestQC4();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC4_F32, zero_batch) {
+  EmbeddingLookupOperatorTester()
+    .batch_size(0)
+    .bag_size(3)
+    .embedding_dim(17)
+    .pooling(xnn_embedding_pooling_sum)
+    .TestQC4();
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, no_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(1)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestQC8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, no_pooling_with_bags) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(4)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_none)
+      .TestQC8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, sum_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestQC8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, mean_pooling) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(3)
+      .bag_size(5)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_mean)
+      .TestQC8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, large_embedding_dim) {
+  for (size_t embedding_dim = 1000; embedding_dim < 5000; embedding_dim += 1333) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(2)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .TestQC8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, multithreaded) {
+  for (size_t embedding_dim = 1; embedding_dim < 100; embedding_dim += 7) {
+    EmbeddingLookupOperatorTester()
+      .batch_size(37)
+      .bag_size(3)
+      .embedding_dim(embedding_dim)
+      .pooling(xnn_embedding_pooling_sum)
+      .num_threads(4)
+      .TestQC8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_QC8_F32, zero_batch) {
+  EmbeddingLookupOperatorTester()
+    .batch_size(0)
+    .bag_size(3)
+    .embedding_dim(17)
+    .pooling(xnn_embedding_pooling_sum)
+    .TestQC8();
+}
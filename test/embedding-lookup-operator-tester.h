@@ -0,0 +1,277 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <fp16.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class EmbeddingLookupOperatorTester {
+ public:
+  inline EmbeddingLookupOperatorTester& batch_size(size_t batch_size) {
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline EmbeddingLookupOperatorTester& bag_size(size_t bag_size) {
+    this->bag_size_ = bag_size;
+    return *this;
+  }
+
+  inline size_t bag_size() const {
+    return this->bag_size_;
+  }
+
+  inline EmbeddingLookupOperatorTester& num_embeddings(size_t num_embeddings) {
+    assert(num_embeddings != 0);
+    this->num_embeddings_ = num_embeddings;
+    return *this;
+  }
+
+  inline size_t num_embeddings() const {
+    return this->num_embeddings_;
+  }
+
+  inline EmbeddingLookupOperatorTester& embedding_dim(size_t embedding_dim) {
+    assert(embedding_dim != 0);
+    this->embedding_dim_ = embedding_dim;
+    return *this;
+  }
+
+  inline size_t embedding_dim() const {
+    return this->embedding_dim_;
+  }
+
+  inline EmbeddingLookupOperatorTester& pooling(xnn_embedding_pooling pooling) {
+    this->pooling_ = pooling;
+    return *this;
+  }
+
+  inline xnn_embedding_pooling pooling() const {
+    return this->pooling_;
+  }
+
+  inline EmbeddingLookupOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads != 0);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
+  inline EmbeddingLookupOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  // Number of output rows: one per bag with pooling, one per index without.
+  inline size_t num_outputs() const {
+    return pooling() == xnn_embedding_pooling_none ? batch_size() * bag_size() : batch_size();
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<uint16_t> table(num_embeddings() * embedding_dim() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<float> dequantized_table(num_embeddings() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::transform(table.cbegin(), table.cbegin() + dequantized_table.size(), dequantized_table.begin(),
+        fp16_ieee_to_fp32_value);
+
+      xnn_operator_t embedding_op = nullptr;
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      const xnn_status status = xnn_create_embedding_lookup_nc_f16_f32(
+        num_embeddings(), embedding_dim(), table.data(), pooling(), 0, &embedding_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, embedding_op);
+
+      Test(embedding_op, xnn_setup_embedding_lookup_nc_f16_f32, dequantized_table.data(), embedding_dim(), rng);
+    }
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> table(num_embeddings() * embedding_dim() + XNN_EXTRA_BYTES / sizeof(float));
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return f32dist(rng); });
+
+      xnn_operator_t embedding_op = nullptr;
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_lookup_nc_f32(
+          num_embeddings(), embedding_dim(), table.data(), pooling(), 0, &embedding_op));
+      ASSERT_NE(nullptr, embedding_op);
+
+      Test(embedding_op, xnn_setup_embedding_lookup_nc_f32, table.data(), embedding_dim(), rng);
+    }
+  }
+
+  void TestQC8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_real_distribution<float> scale_dist(0.001f, 0.1f);
+
+    std::vector<int8_t> table(num_embeddings() * embedding_dim() + XNN_EXTRA_BYTES);
+    std::vector<float> table_scale(num_embeddings());
+    std::vector<float> dequantized_table(num_embeddings() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return (int8_t) i8dist(rng); });
+      std::generate(table_scale.begin(), table_scale.end(), [&]() { return scale_dist(rng); });
+      for (size_t n = 0; n < num_embeddings(); n++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          dequantized_table[n * embedding_dim() + c] = float(table[n * embedding_dim() + c]) * table_scale[n];
+        }
+      }
+
+      xnn_operator_t embedding_op = nullptr;
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_lookup_nc_qc8_f32(
+          num_embeddings(), embedding_dim(), table.data(), table_scale.data(), pooling(), 0, &embedding_op));
+      ASSERT_NE(nullptr, embedding_op);
+
+      Test(embedding_op, xnn_setup_embedding_lookup_nc_qc8_f32, dequantized_table.data(), embedding_dim(), rng);
+    }
+  }
+
+  void TestQC4() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i4dist(-8, 7);
+    std::uniform_real_distribution<float> scale_dist(0.01f, 1.0f);
+
+    const size_t table_stride = (embedding_dim() + 1) / 2;
+    std::vector<uint8_t> table(num_embeddings() * table_stride + XNN_EXTRA_BYTES);
+    std::vector<float> table_scale(num_embeddings());
+    std::vector<float> dequantized_table(num_embeddings() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() {
+        return (uint8_t) ((i4dist(rng) & 0xF) | ((i4dist(rng) & 0xF) << 4));
+      });
+      std::generate(table_scale.begin(), table_scale.end(), [&]() { return scale_dist(rng); });
+      for (size_t n = 0; n < num_embeddings(); n++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          const uint8_t b = table[n * table_stride + c / 2];
+          const int32_t nibble = (c % 2 == 0) ? (b & 0xF) : (b >> 4);
+          const int32_t q = nibble >= 8 ? nibble - 16 : nibble;
+          dequantized_table[n * embedding_dim() + c] = float(q) * table_scale[n];
+        }
+      }
+
+      xnn_operator_t embedding_op = nullptr;
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_lookup_nc_qc4_f32(
+          num_embeddings(), embedding_dim(), table.data(), table_scale.data(), pooling(), 0, &embedding_op));
+      ASSERT_NE(nullptr, embedding_op);
+
+      Test(embedding_op, xnn_setup_embedding_lookup_nc_qc4_f32, dequantized_table.data(), embedding_dim(), rng);
+    }
+  }
+
+ private:
+  typedef xnn_status (*setup_fn)(
+    xnn_operator_t embedding_op, size_t batch_size, size_t bag_size, const int32_t* indices, float* output,
+    pthreadpool_t threadpool);
+
+  // Runs the operator on random indices and compares against lookups in the dequantized table, then deletes the
+  // operator.
+  void Test(
+    xnn_operator_t embedding_op, setup_fn setup, const float* dequantized_table, size_t dequantized_stride,
+    std::mt19937& rng) const
+  {
+    // Smart pointer to automatically delete embedding_op.
+    std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_op(embedding_op, xnn_delete_operator);
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+    }
+
+    std::uniform_int_distribution<int32_t> index_dist(0, int32_t(num_embeddings() - 1));
+    std::vector<int32_t> indices(batch_size() * bag_size());
+    std::vector<float> output(num_outputs() * embedding_dim());
+    std::vector<double> output_ref(num_outputs() * embedding_dim());
+    std::generate(indices.begin(), indices.end(), [&]() { return index_dist(rng); });
+    std::fill(output.begin(), output.end(), std::nanf(""));
+
+    // Compute reference results.
+    std::fill(output_ref.begin(), output_ref.end(), 0.0);
+    const size_t rows_per_output = pooling() == xnn_embedding_pooling_none ? 1 : bag_size();
+    for (size_t i = 0; i < num_outputs(); i++) {
+      for (size_t r = 0; r < rows_per_output; r++) {
+        const float* row = dequantized_table + size_t(indices[i * rows_per_output + r]) * dequantized_stride;
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          output_ref[i * embedding_dim() + c] += double(row[c]);
+        }
+      }
+      if (pooling() == xnn_embedding_pooling_mean) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          output_ref[i * embedding_dim() + c] /= double(rows_per_output);
+        }
+      }
+    }
+
+    ASSERT_EQ(xnn_status_success,
+      setup(embedding_op, batch_size(), bag_size(), indices.data(), output.data(), auto_threadpool.get()));
+
+    ASSERT_EQ(xnn_status_success,
+      xnn_run_operator(embedding_op, auto_threadpool.get()));
+
+    // Verify results.
+    for (size_t i = 0; i < num_outputs(); i++) {
+      for (size_t c = 0; c < embedding_dim(); c++) {
+        const double y_ref = output_ref[i * embedding_dim() + c];
+        ASSERT_NEAR(output[i * embedding_dim() + c], y_ref, std::abs(y_ref) * 1.0e-5 + double(bag_size()) * 1.0e-6)
+          << "at output " << i << " / " << num_outputs() << ", channel " << c << " / " << embedding_dim()
+          << ", bag size " << bag_size();
+      }
+    }
+  }
+
+  size_t batch_size_{1};
+  size_t bag_size_{1};
+  size_t num_embeddings_{100};
+  size_t embedding_dim_{1};
+  xnn_embedding_pooling pooling_{xnn_embedding_pooling_none};
+  size_t num_threads_{1};
+  size_t iterations_{3};
+};
@@ -0,0 +1,287 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/node-type.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+class EmbeddingLookupTest : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    random_device = std::unique_ptr<std::random_device>(new std::random_device());
+    rng = std::mt19937((*random_device)());
+    dim_dist = std::uniform_int_distribution<size_t>(1, 9);
+    num_embeddings = dim_dist(rng) * 7;
+    embedding_dim = dim_dist(rng) * 5;
+    indices_dims = {dim_dist(rng), dim_dist(rng), dim_dist(rng)};
+    table_dims = {num_embeddings, embedding_dim};
+    pooled_output_dims = {indices_dims[0], indices_dims[1], embedding_dim};
+    batch_size = indices_dims[0] * indices_dims[1];
+    bag_size = indices_dims[2];
+    indices = std::vector<int32_t>(batch_size * bag_size);
+    table_scale = std::vector<float>(num_embeddings);
+    operator_output = std::vector<float>(batch_size * bag_size * embedding_dim);
+    subgraph_output = std::vector<float>(operator_output.size());
+
+    std::uniform_int_distribution<int32_t> index_dist(0, int32_t(num_embeddings - 1));
+    std::uniform_real_distribution<float> scale_dist(0.01f, 1.0f);
+    std::generate(indices.begin(), indices.end(), [&]() { return index_dist(rng); });
+    std::generate(table_scale.begin(), table_scale.end(), [&]() { return scale_dist(rng); });
+    std::fill(operator_output.begin(), operator_output.end(), nanf(""));
+    std::fill(subgraph_output.begin(), subgraph_output.end(), nanf(""));
+  }
+
+  std::unique_ptr<std::random_device> random_device;
+  std::mt19937 rng;
+  std::uniform_int_distribution<size_t> dim_dist;
+
+  std::vector<size_t> indices_dims;
+  std::vector<size_t> table_dims;
+  std::vector<size_t> pooled_output_dims;
+  std::vector<int32_t> indices;
+  std::vector<float> table_scale;
+  std::vector<float> operator_output;
+  std::vector<float> subgraph_output;
+  size_t num_embeddings;
+  size_t embedding_dim;
+  size_t batch_size;
+  size_t bag_size;
+};
+
+TEST_F(EmbeddingLookupTest, define)
+{
+  std::vector<int8_t> table(num_embeddings * embedding_dim);
+
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t table_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_channelwise_quantized_tensor_value(
+                          subgraph, xnn_datatype_qcint8, table_scale.data(), table_dims.size(), /*channel_dim=*/0,
+                          table_dims.data(), table.data(), XNN_INVALID_VALUE_ID, /*flags=*/0, &table_id));
+  ASSERT_NE(table_id, XNN_INVALID_NODE_ID);
+
+  uint32_t indices_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_int32, indices_dims.size(), indices_dims.data(), nullptr, 0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &indices_id));
+  ASSERT_NE(indices_id, XNN_INVALID_NODE_ID);
+
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, pooled_output_dims.size(), pooled_output_dims.data(), nullptr, 1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_NE(output_id, XNN_INVALID_NODE_ID);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_embedding_lookup(subgraph, xnn_embedding_pooling_sum, table_id, indices_id, output_id, /*flags=*/0));
+
+  ASSERT_EQ(subgraph->num_nodes, 1);
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(node->type, xnn_node_type_embedding_lookup);
+  ASSERT_EQ(node->compute_type, xnn_compute_type_fp32);
+  ASSERT_EQ(node->params.embedding_lookup.pooling, xnn_embedding_pooling_sum);
+  ASSERT_EQ(node->num_inputs, 2);
+  ASSERT_EQ(node->inputs[0], table_id);
+  ASSERT_EQ(node->inputs[1], indices_id);
+  ASSERT_EQ(node->num_outputs, 1);
+  ASSERT_EQ(node->outputs[0], output_id);
+  ASSERT_EQ(node->flags, 0);
+}
+
+TEST_F(EmbeddingLookupTest, rejects_non_static_table)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/3, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t table_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, table_dims.size(), table_dims.data(), nullptr, 2,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &table_id));
+
+  uint32_t indices_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_int32, indices_dims.size(), indices_dims.data(), nullptr, 0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &indices_id));
+
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, pooled_output_dims.size(), pooled_output_dims.data(), nullptr, 1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  ASSERT_EQ(
+    xnn_status_invalid_parameter,
+    xnn_define_embedding_lookup(subgraph, xnn_embedding_pooling_sum, table_id, indices_id, output_id, /*flags=*/0));
+}
+
+TEST_F(EmbeddingLookupTest, matches_operator_api_f32_mean_pooling)
+{
+  std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+  std::vector<float> table(num_embeddings * embedding_dim + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(table.begin(), table.end(), [&]() { return f32dist(rng); });
+
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  // Call operator API.
+  xnn_operator_t op = nullptr;
+  const xnn_status status = xnn_create_embedding_lookup_nc_f32(
+    num_embeddings, embedding_dim, table.data(), xnn_embedding_pooling_mean, /*flags=*/0, &op);
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_NE(nullptr, op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_setup_embedding_lookup_nc_f32(
+      op, batch_size, bag_size, indices.data(), operator_output.data(), /*threadpool=*/nullptr));
+
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+  // Call subgraph API.
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t table_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, table_dims.size(), table_dims.data(), table.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &table_id));
+  ASSERT_NE(table_id, XNN_INVALID_NODE_ID);
+
+  uint32_t indices_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_int32, indices_dims.size(), indices_dims.data(), nullptr,
+                          /*external_id=*/0, /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &indices_id));
+  ASSERT_NE(indices_id, XNN_INVALID_NODE_ID);
+
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, pooled_output_dims.size(), pooled_output_dims.data(), nullptr,
+                          /*external_id=*/1, /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_NE(output_id, XNN_INVALID_NODE_ID);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_embedding_lookup(subgraph, xnn_embedding_pooling_mean, table_id, indices_id, output_id, /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  std::array<xnn_external_value, 2> external = {
+    xnn_external_value{indices_id, indices.data()}, xnn_external_value{output_id, subgraph_output.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  ASSERT_EQ(
+    std::vector<float>(subgraph_output.cbegin(), subgraph_output.cbegin() + batch_size * embedding_dim),
+    std::vector<float>(operator_output.cbegin(), operator_output.cbegin() + batch_size * embedding_dim));
+}
+
+TEST_F(EmbeddingLookupTest, matches_operator_api_qc4_no_pooling)
+{
+  std::uniform_int_distribution<int32_t> u8dist(0, 255);
+  const size_t table_stride = (embedding_dim + 1) / 2;
+  std::vector<uint8_t> table(num_embeddings * table_stride + XNN_EXTRA_BYTES);
+  std::generate(table.begin(), table.end(), [&]() { return (uint8_t) u8dist(rng); });
+
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  // Call operator API.
+  xnn_operator_t op = nullptr;
+  const xnn_status status = xnn_create_embedding_lookup_nc_qc4_f32(
+    num_embeddings, embedding_dim, table.data(), table_scale.data(), xnn_embedding_pooling_none, /*flags=*/0, &op);
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_NE(nullptr, op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_setup_embedding_lookup_nc_qc4_f32(
+      op, batch_size, bag_size, indices.data(), operator_output.data(), /*threadpool=*/nullptr));
+
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+  // Call subgraph API.
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t table_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_channelwise_quantized_tensor_value(
+                          subgraph, xnn_datatype_qcint4, table_scale.data(), table_dims.size(), /*channel_dim=*/0,
+                          table_dims.data(), table.data(), XNN_INVALID_VALUE_ID, /*flags=*/0, &table_id));
+  ASSERT_NE(table_id, XNN_INVALID_NODE_ID);
+
+  uint32_t indices_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_int32, indices_dims.size(), indices_dims.data(), nullptr,
+                          /*external_id=*/0, /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &indices_id));
+  ASSERT_NE(indices_id, XNN_INVALID_NODE_ID);
+
+  const std::array<size_t, 4> output_dims = {indices_dims[0], indices_dims[1], indices_dims[2], embedding_dim};
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+                          /*external_id=*/1, /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_NE(output_id, XNN_INVALID_NODE_ID);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_embedding_lookup(subgraph, xnn_embedding_pooling_none, table_id, indices_id, output_id, /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  std::array<xnn_external_value, 2> external = {
+    xnn_external_value{indices_id, indices.data()}, xnn_external_value{output_id, subgraph_output.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  ASSERT_EQ(subgraph_output, operator_output);
+}
@@ -0,0 +1,230 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/microfnptr.h>
+
+
+class EmbeddingMicrokernelTester {
+ public:
+  inline EmbeddingMicrokernelTester& rows(size_t rows) {
+    assert(rows != 0);
+    this->rows_ = rows;
+    return *this;
+  }
+
+  inline size_t rows() const {
+    return this->rows_;
+  }
+
+  inline EmbeddingMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline EmbeddingMicrokernelTester& num_embeddings(size_t num_embeddings) {
+    assert(num_embeddings != 0);
+    this->num_embeddings_ = num_embeddings;
+    return *this;
+  }
+
+  inline size_t num_embeddings() const {
+    return this->num_embeddings_;
+  }
+
+  inline EmbeddingMicrokernelTester& table_stride(size_t table_stride) {
+    this->table_stride_ = table_stride;
+    return *this;
+  }
+
+  // Stride of the table rows, in elements. Defaults to the number of channels.
+  inline size_t table_stride() const {
+    if (this->table_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->table_stride_ >= channels());
+      return this->table_stride_;
+    }
+  }
+
+  inline EmbeddingMicrokernelTester& scale(float scale) {
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline EmbeddingMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF32(xnn_embedding_ukernel_fn embedding, xnn_init_f32_scale_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> table((num_embeddings() - 1) * table_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> dequantized_table(table.size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return f32dist(rng); });
+      std::copy(table.cbegin(), table.cend(), dequantized_table.begin());
+
+      Test(embedding, init_params, table.data(), table_stride() * sizeof(float), /*row_scale=*/nullptr,
+        dequantized_table.data(), rng);
+    }
+  }
+
+  void TestF16(xnn_embedding_ukernel_fn embedding, xnn_init_f32_scale_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<uint16_t> table(
+      (num_embeddings() - 1) * table_stride() + channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<float> dequantized_table(table.size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::transform(table.cbegin(), table.cend(), dequantized_table.begin(), fp16_ieee_to_fp32_value);
+
+      Test(embedding, init_params, table.data(), table_stride() * sizeof(uint16_t), /*row_scale=*/nullptr,
+        dequantized_table.data(), rng);
+    }
+  }
+
+  void TestQC8(xnn_embedding_ukernel_fn embedding, xnn_init_f32_scale_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_real_distribution<float> scale_dist(0.001f, 0.1f);
+
+    std::vector<int8_t> table((num_embeddings() - 1) * table_stride() + channels() + XNN_EXTRA_BYTES);
+    std::vector<float> row_scale(num_embeddings());
+    std::vector<float> dequantized_table(table.size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return (int8_t) i8dist(rng); });
+      std::generate(row_scale.begin(), row_scale.end(), [&]() { return scale_dist(rng); });
+      for (size_t n = 0; n < num_embeddings(); n++) {
+        for (size_t c = 0; c < channels(); c++) {
+          dequantized_table[n * table_stride() + c] = float(table[n * table_stride() + c]) * row_scale[n];
+        }
+      }
+
+      Test(embedding, init_params, table.data(), table_stride(), row_scale.data(), dequantized_table.data(), rng);
+    }
+  }
+
+  // QC4 rows hold two elements per byte and start on a byte boundary: the table stride is rounded up to an even
+  // number of elements.
+  void TestQC4(xnn_embedding_ukernel_fn embedding, xnn_init_f32_scale_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i4dist(-8, 7);
+    std::uniform_real_distribution<float> scale_dist(0.01f, 1.0f);
+
+    const size_t table_stride_bytes = (table_stride() + 1) / 2;
+    std::vector<uint8_t> table(num_embeddings() * table_stride_bytes + XNN_EXTRA_BYTES);
+    std::vector<float> row_scale(num_embeddings());
+    std::vector<float> dequantized_table(num_embeddings() * table_stride_bytes * 2);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() {
+        return (uint8_t) ((i4dist(rng) & 0xF) | ((i4dist(rng) & 0xF) << 4));
+      });
+      std::generate(row_scale.begin(), row_scale.end(), [&]() { return scale_dist(rng); });
+      for (size_t n = 0; n < num_embeddings(); n++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const uint8_t b = table[n * table_stride_bytes + c / 2];
+          const int32_t nibble = (c % 2 == 0) ? (b & 0xF) : (b >> 4);
+          const int32_t q = nibble >= 8 ? nibble - 16 : nibble;
+          dequantized_table[n * table_stride_bytes * 2 + c] = float(q) * row_scale[n];
+        }
+      }
+
+      Test(embedding, init_params, table.data(), table_stride_bytes, row_scale.data(), dequantized_table.data(), rng,
+        table_stride_bytes * 2);
+    }
+  }
+
+ private:
+  // Gathers random rows with the micro-kernel and compares against a sum of the dequantized table rows, laid out with
+  // dequantized_stride elements per row (table_stride() by default).
+  void Test(
+    xnn_embedding_ukernel_fn embedding, xnn_init_f32_scale_params_fn init_params,
+    const void* table, size_t table_stride_bytes, const float* row_scale,
+    const float* dequantized_table, std::mt19937& rng, size_t dequantized_stride = 0) const
+  {
+    if (dequantized_stride == 0) {
+      dequantized_stride = table_stride();
+    }
+    std::uniform_int_distribution<int32_t> index_dist(0, int32_t(num_embeddings() - 1));
+
+    std::vector<int32_t> indices(rows());
+    std::vector<float> output(channels());
+    std::vector<double> output_ref(channels());
+    std::generate(indices.begin(), indices.end(), [&]() { return index_dist(rng); });
+    std::fill(output.begin(), output.end(), std::nanf(""));
+
+    // Compute reference results.
+    std::fill(output_ref.begin(), output_ref.end(), 0.0);
+    for (size_t r = 0; r < rows(); r++) {
+      const float* row = dequantized_table + size_t(indices[r]) * dequantized_stride;
+      for (size_t c = 0; c < channels(); c++) {
+        output_ref[c] += double(row[c]);
+      }
+    }
+    for (double& y : output_ref) {
+      y *= double(scale());
+    }
+
+    // Prepare parameters.
+    union xnn_f32_scale_params params;
+    init_params(&params, scale());
+
+    // Call optimized micro-kernel.
+    embedding(rows(), channels(), indices.data(), table, table_stride_bytes, row_scale, output.data(), &params);
+
+    // Verify results.
+    for (size_t c = 0; c < channels(); c++) {
+      ASSERT_NEAR(output[c], output_ref[c], std::abs(output_ref[c]) * 1.0e-5 + double(rows()) * 1.0e-6)
+        << "at channel " << c << " / " << channels() << ", rows " << rows() << ", scale " << scale();
+    }
+  }
+
+  size_t rows_{1};
+  size_t channels_{1};
+  size_t num_embeddings_{32};
+  size_t table_stride_{0};
+  float scale_{1.0f};
+  size_t iterations_{15};
+};
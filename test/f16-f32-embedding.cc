@@ -0,0 +1,212 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/embedding.h>
+#include <xnnpack/microparams-init.h>
+#include "embedding-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    EmbeddingMicrokernelTester()
+      .channels(16)
+      .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t channels = 1; channels < 16; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t channels = 17; channels < 32; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, multiple_rows) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t rows = 2; rows <= 17; rows += 3) {
+      EmbeddingMicrokernelTester()
+        .rows(rows)
+        .channels(33)
+        .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, table_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .table_stride(83)
+        .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__NEONFP16_C16, scale) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.2f)
+        .TestF16(xnn_f16_f32_embedding_ukernel__neonfp16_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_F32_EMBEDDING__F16C_C16, channels_eq_16) {
+    TEST_REQUIRES_X86_F16C;
+    EmbeddingMicrokernelTester()
+      .channels(16)
+      .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F16_F32_EMBEDDING__F16C_C16, channels_div_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__F16C_C16, channels_lt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels < 16; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__F16C_C16, channels_gt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 17; channels < 32; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__F16C_C16, multiple_rows) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t rows = 2; rows <= 17; rows += 3) {
+      EmbeddingMicrokernelTester()
+        .rows(rows)
+        .channels(33)
+        .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__F16C_C16, table_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .table_stride(83)
+        .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F16_F32_EMBEDDING__F16C_C16, scale) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.2f)
+        .TestF16(xnn_f16_f32_embedding_ukernel__f16c_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, channels_eq_4) {
+  EmbeddingMicrokernelTester()
+    .channels(4)
+    .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    EmbeddingMicrokernelTester()
+      .channels(channels)
+      .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    EmbeddingMicrokernelTester()
+      .channels(channels)
+      .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    EmbeddingMicrokernelTester()
+      .channels(channels)
+      .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, multiple_rows) {
+  for (size_t rows = 2; rows <= 17; rows += 3) {
+    EmbeddingMicrokernelTester()
+      .rows(rows)
+      .channels(9)
+      .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, table_stride) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    EmbeddingMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .table_stride(23)
+      .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F16_F32_EMBEDDING__SCALAR_C4, scale) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    EmbeddingMicrokernelTester()
+      .rows(5)
+      .channels(channels)
+      .scale(0.2f)
+      .TestF16(xnn_f16_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
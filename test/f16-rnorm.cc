@@ -0,0 +1,164 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/microparams-init.h>
+#include <xnnpack/rnorm.h>
+#include "rnorm-microkernel-tester.h"
+
+
+#if XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+  TEST(F16_RNORM__NEONFP16ARITH_X16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    RNormMicrokernelTester()
+      .channels(16)
+      .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, rms) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, input_offset) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .input_offset(10.0f)
+        .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, epsilon) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    RNormMicrokernelTester()
+      .channels(49)
+      .epsilon(1.0f)
+      .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+  }
+
+  TEST(F16_RNORM__NEONFP16ARITH_X16, inplace) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_f16_rnorm_ukernel__neonfp16arith_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RNORM__F16C_X16, channels_eq_16) {
+    TEST_REQUIRES_X86_F16C;
+    RNormMicrokernelTester()
+      .channels(16)
+      .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+  }
+
+  TEST(F16_RNORM__F16C_X16, channels_div_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__F16C_X16, channels_lt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__F16C_X16, channels_gt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__F16C_X16, rms) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__F16C_X16, input_offset) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .input_offset(10.0f)
+        .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F16_RNORM__F16C_X16, epsilon) {
+    TEST_REQUIRES_X86_F16C;
+    RNormMicrokernelTester()
+      .channels(49)
+      .epsilon(1.0f)
+      .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+  }
+
+  TEST(F16_RNORM__F16C_X16, inplace) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_f16_rnorm_ukernel__f16c_x16, xnn_init_f16_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -0,0 +1,2029 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/microparams-init.h>
+#include <xnnpack/reduce.h>
+#include "reduce-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RMAX__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMAX__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmin_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMIN__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsum_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUM__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X16, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsum_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsumsq_ukernel__neon_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUMSQ__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__neon_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__neon_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__neon_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__NEON_X16, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsumsq_ukernel__neon_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rminmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMINMAX__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__neon_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__NEON_C16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdmax_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__NEON_C16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__NEON_C16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__NEON_C16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__NEON_C16, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdmax_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__NEON_C16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdmin_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__NEON_C16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__NEON_C16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__NEON_C16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__NEON_C16, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdmin_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__NEON_C16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdsum_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__NEON_C16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__NEON_C16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__NEON_C16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__NEON_C16, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdsum_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__NEON_C16, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsum_ukernel__neon_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__NEON_C16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdsumsq_ukernel__neon_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__NEON_C16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__neon_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__NEON_C16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__neon_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__NEON_C16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__neon_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__NEON_C16, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdsumsq_ukernel__neon_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__NEON_C16, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsumsq_ukernel__neon_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMAX__SSE_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMAX__SSE_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__SSE_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__SSE_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__SSE_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmin_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMIN__SSE_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__SSE_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__SSE_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsum_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUM__SSE_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X16, scale) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsum_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__SSE_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsumsq_ukernel__sse_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUMSQ__SSE_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__sse_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__SSE_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__sse_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__SSE_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__sse_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__SSE_X16, scale) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsumsq_ukernel__sse_x16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__SSE_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rminmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMINMAX__SSE_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__SSE_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__SSE_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__sse_x16, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__SSE_C16, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdmax_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__SSE_C16, channels_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__SSE_C16, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__SSE_C16, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__SSE_C16, input_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdmax_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__SSE_C16, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdmin_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__SSE_C16, channels_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__SSE_C16, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__SSE_C16, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__SSE_C16, input_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdmin_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__SSE_C16, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdsum_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__SSE_C16, channels_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__SSE_C16, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__SSE_C16, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__SSE_C16, input_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdsum_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__SSE_C16, scale) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsum_ukernel__sse_c16, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__SSE_C16, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(16)
+        .Test(xnn_f32_rdsumsq_ukernel__sse_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__SSE_C16, channels_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__sse_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__SSE_C16, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 16; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__sse_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__SSE_C16, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 17; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__sse_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__SSE_C16, input_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(83)
+        .Test(xnn_f32_rdsumsq_ukernel__sse_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__SSE_C16, scale) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsumsq_ukernel__sse_c16, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMAX__AVX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMAX__AVX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__AVX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__AVX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__AVX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rmin_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMIN__AVX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__AVX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__AVX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rsum_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUM__AVX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X32, scale) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size <= 160; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsum_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rsumsq_ukernel__avx_x32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUMSQ__AVX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__avx_x32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__avx_x32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__avx_x32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX_X32, scale) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size <= 160; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsumsq_ukernel__avx_x32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__AVX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rminmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMINMAX__AVX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__AVX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMINMAX__AVX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rminmax_ukernel__avx_x32, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX_C32, channels_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(32)
+        .Test(xnn_f32_rdmax_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX_C32, channels_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 64; channels < 320; channels += 32) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX_C32, channels_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX_C32, channels_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 33; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX_C32, input_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 160; channels += 31) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(163)
+        .Test(xnn_f32_rdmax_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX_C32, channels_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(32)
+        .Test(xnn_f32_rdmin_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX_C32, channels_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 64; channels < 320; channels += 32) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX_C32, channels_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX_C32, channels_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 33; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX_C32, input_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 160; channels += 31) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(163)
+        .Test(xnn_f32_rdmin_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX_C32, channels_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(32)
+        .Test(xnn_f32_rdsum_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX_C32, channels_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 64; channels < 320; channels += 32) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX_C32, channels_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX_C32, channels_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 33; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX_C32, input_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 160; channels += 31) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(163)
+        .Test(xnn_f32_rdsum_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX_C32, scale) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 160; channels += 31) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsum_ukernel__avx_c32, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX_C32, channels_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(32)
+        .Test(xnn_f32_rdsumsq_ukernel__avx_c32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX_C32, channels_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 64; channels < 320; channels += 32) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__avx_c32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX_C32, channels_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels < 32; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__avx_c32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX_C32, channels_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 33; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__avx_c32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX_C32, input_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 160; channels += 31) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(163)
+        .Test(xnn_f32_rdsumsq_ukernel__avx_c32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX_C32, scale) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 160; channels += 31) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsumsq_ukernel__avx_c32, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMAX__AVX512F_X64, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_rmax_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMAX__AVX512F_X64, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__AVX512F_X64, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMAX__AVX512F_X64, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmax_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__AVX512F_X64, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_rmin_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RMIN__AVX512F_X64, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__AVX512F_X64, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RMIN__AVX512F_X64, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmin_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X64, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_rsum_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUM__AVX512F_X64, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X64, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X64, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X64, scale) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 320; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX512F_X64, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_rsumsq_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(F32_RSUMSQ__AVX512F_X64, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX512F_X64, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX512F_X64, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsumsq_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RSUMSQ__AVX512F_X64, scale) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 320; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(0.25f)
+        .Test(xnn_f32_rsumsq_ukernel__avx512f_x64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX512F_C64, channels_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(64)
+        .Test(xnn_f32_rdmax_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX512F_C64, channels_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 128; channels < 640; channels += 64) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX512F_C64, channels_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX512F_C64, channels_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 65; channels < 128; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMAX__AVX512F_C64, input_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 320; channels += 63) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(323)
+        .Test(xnn_f32_rdmax_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX512F_C64, channels_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(64)
+        .Test(xnn_f32_rdmin_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX512F_C64, channels_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 128; channels < 640; channels += 64) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX512F_C64, channels_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX512F_C64, channels_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 65; channels < 128; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmin_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDMIN__AVX512F_C64, input_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 320; channels += 63) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(323)
+        .Test(xnn_f32_rdmin_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX512F_C64, channels_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(64)
+        .Test(xnn_f32_rdsum_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX512F_C64, channels_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 128; channels < 640; channels += 64) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX512F_C64, channels_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX512F_C64, channels_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 65; channels < 128; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsum_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX512F_C64, input_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 320; channels += 63) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(323)
+        .Test(xnn_f32_rdsum_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUM__AVX512F_C64, scale) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 320; channels += 63) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsum_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX512F_C64, channels_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t rows = 1; rows <= 5; rows++) {
+      ReduceMicrokernelTester()
+        .rows(rows)
+        .channels(64)
+        .Test(xnn_f32_rdsumsq_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX512F_C64, channels_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 128; channels < 640; channels += 64) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX512F_C64, channels_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels < 64; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX512F_C64, channels_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 65; channels < 128; channels++) {
+      ReduceMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdsumsq_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX512F_C64, input_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 320; channels += 63) {
+      ReduceMicrokernelTester()
+        .rows(7)
+        .channels(channels)
+        .input_stride(323)
+        .Test(xnn_f32_rdsumsq_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(F32_RDSUMSQ__AVX512F_C64, scale) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 320; channels += 63) {
+      ReduceMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.25f)
+        .Test(xnn_f32_rdsumsq_ukernel__avx512f_c64, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_RMAX__SCALAR_X4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(F32_RMAX__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMAX__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMAX__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMIN__SCALAR_X4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rmin_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(F32_RMIN__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmin_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMIN__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmin_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMIN__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmin_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rsum_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(F32_RSUM__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4, scale) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .scale(0.25f)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUMSQ__SCALAR_X4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rsumsq_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(F32_RSUMSQ__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsumsq_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUMSQ__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsumsq_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUMSQ__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsumsq_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RSUMSQ__SCALAR_X4, scale) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .scale(0.25f)
+      .Test(xnn_f32_rsumsq_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMINMAX__SCALAR_X4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rminmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(F32_RMINMAX__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rminmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMINMAX__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rminmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RMINMAX__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rminmax_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::MinMax, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMAX__SCALAR_C4, channels_eq_4) {
+  for (size_t rows = 1; rows <= 5; rows++) {
+    ReduceMicrokernelTester()
+      .rows(rows)
+      .channels(4)
+      .Test(xnn_f32_rdmax_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMAX__SCALAR_C4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmax_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMAX__SCALAR_C4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmax_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMAX__SCALAR_C4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmax_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMAX__SCALAR_C4, input_stride) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    ReduceMicrokernelTester()
+      .rows(7)
+      .channels(channels)
+      .input_stride(23)
+      .Test(xnn_f32_rdmax_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Max, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMIN__SCALAR_C4, channels_eq_4) {
+  for (size_t rows = 1; rows <= 5; rows++) {
+    ReduceMicrokernelTester()
+      .rows(rows)
+      .channels(4)
+      .Test(xnn_f32_rdmin_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMIN__SCALAR_C4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmin_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMIN__SCALAR_C4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmin_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMIN__SCALAR_C4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmin_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDMIN__SCALAR_C4, input_stride) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    ReduceMicrokernelTester()
+      .rows(7)
+      .channels(channels)
+      .input_stride(23)
+      .Test(xnn_f32_rdmin_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Min, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUM__SCALAR_C4, channels_eq_4) {
+  for (size_t rows = 1; rows <= 5; rows++) {
+    ReduceMicrokernelTester()
+      .rows(rows)
+      .channels(4)
+      .Test(xnn_f32_rdsum_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUM__SCALAR_C4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdsum_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUM__SCALAR_C4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdsum_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUM__SCALAR_C4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdsum_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUM__SCALAR_C4, input_stride) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    ReduceMicrokernelTester()
+      .rows(7)
+      .channels(channels)
+      .input_stride(23)
+      .Test(xnn_f32_rdsum_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUM__SCALAR_C4, scale) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    ReduceMicrokernelTester()
+      .rows(5)
+      .channels(channels)
+      .scale(0.25f)
+      .Test(xnn_f32_rdsum_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::Sum, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUMSQ__SCALAR_C4, channels_eq_4) {
+  for (size_t rows = 1; rows <= 5; rows++) {
+    ReduceMicrokernelTester()
+      .rows(rows)
+      .channels(4)
+      .Test(xnn_f32_rdsumsq_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUMSQ__SCALAR_C4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdsumsq_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUMSQ__SCALAR_C4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdsumsq_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUMSQ__SCALAR_C4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    ReduceMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdsumsq_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUMSQ__SCALAR_C4, input_stride) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    ReduceMicrokernelTester()
+      .rows(7)
+      .channels(channels)
+      .input_stride(23)
+      .Test(xnn_f32_rdsumsq_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(F32_RDSUMSQ__SCALAR_C4, scale) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    ReduceMicrokernelTester()
+      .rows(5)
+      .channels(channels)
+      .scale(0.25f)
+      .Test(xnn_f32_rdsumsq_ukernel__scalar_c4, ReduceMicrokernelTester::OpType::SumSquared, xnn_init_f32_scale_scalar_params);
+  }
+}
@@ -0,0 +1,379 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/microparams-init.h>
+#include <xnnpack/rnorm.h>
+#include "rnorm-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RNORM__NEON_X8, channels_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    RNormMicrokernelTester()
+      .channels(8)
+      .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__NEON_X8, channels_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 16; channels < 80; channels += 8) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__NEON_X8, channels_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 8; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__NEON_X8, channels_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 9; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__NEON_X8, rms) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 2) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__NEON_X8, input_offset) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 2) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .input_offset(10.0f)
+        .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__NEON_X8, epsilon) {
+    TEST_REQUIRES_ARM_NEON;
+    RNormMicrokernelTester()
+      .channels(25)
+      .epsilon(1.0f)
+      .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__NEON_X8, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 2) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_f32_rnorm_ukernel__neon_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RNORM__SSE_X8, channels_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    RNormMicrokernelTester()
+      .channels(8)
+      .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__SSE_X8, channels_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 16; channels < 80; channels += 8) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__SSE_X8, channels_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 8; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__SSE_X8, channels_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 9; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__SSE_X8, rms) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 2) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__SSE_X8, input_offset) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 2) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .input_offset(10.0f)
+        .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__SSE_X8, epsilon) {
+    TEST_REQUIRES_X86_SSE;
+    RNormMicrokernelTester()
+      .channels(25)
+      .epsilon(1.0f)
+      .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__SSE_X8, inplace) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 2) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_f32_rnorm_ukernel__sse_x8, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RNORM__AVX_X16, channels_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    RNormMicrokernelTester()
+      .channels(16)
+      .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__AVX_X16, channels_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX_X16, channels_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX_X16, channels_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX_X16, rms) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX_X16, input_offset) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .input_offset(10.0f)
+        .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX_X16, epsilon) {
+    TEST_REQUIRES_X86_AVX;
+    RNormMicrokernelTester()
+      .channels(49)
+      .epsilon(1.0f)
+      .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__AVX_X16, inplace) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_f32_rnorm_ukernel__avx_x16, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RNORM__AVX512F_X32, channels_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    RNormMicrokernelTester()
+      .channels(32)
+      .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, channels_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 64; channels < 320; channels += 32) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, channels_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels < 32; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, channels_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 33; channels < 64; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, rms) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 160; channels += 8) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, input_offset) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 160; channels += 8) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .input_offset(10.0f)
+        .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, epsilon) {
+    TEST_REQUIRES_X86_AVX512F;
+    RNormMicrokernelTester()
+      .channels(97)
+      .epsilon(1.0f)
+      .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+  }
+
+  TEST(F32_RNORM__AVX512F_X32, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels <= 160; channels += 8) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_f32_rnorm_ukernel__avx512f_x32, xnn_init_f32_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_RNORM__SCALAR_X4, channels_eq_4) {
+  RNormMicrokernelTester()
+    .channels(4)
+    .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+}
+
+TEST(F32_RNORM__SCALAR_X4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+  }
+}
+
+TEST(F32_RNORM__SCALAR_X4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+  }
+}
+
+TEST(F32_RNORM__SCALAR_X4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+  }
+}
+
+TEST(F32_RNORM__SCALAR_X4, rms) {
+  for (size_t channels = 1; channels <= 20; channels += 1) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .subtract_mean(false)
+      .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+  }
+}
+
+TEST(F32_RNORM__SCALAR_X4, input_offset) {
+  for (size_t channels = 1; channels <= 20; channels += 1) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .input_offset(10.0f)
+      .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+  }
+}
+
+TEST(F32_RNORM__SCALAR_X4, epsilon) {
+  RNormMicrokernelTester()
+    .channels(13)
+    .epsilon(1.0f)
+    .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+}
+
+TEST(F32_RNORM__SCALAR_X4, inplace) {
+  for (size_t channels = 1; channels <= 20; channels += 1) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .inplace(true)
+      .Test(xnn_f32_rnorm_ukernel__scalar_x4, xnn_init_f32_rnorm_scalar_params);
+  }
+}
@@ -0,0 +1,591 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-vexp.yaml
+//   Generator: tools/generate-vunary-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vunary.h>
+#include "vunary-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VEXP__NEON_RR2_P5_X4, batch_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnaryMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x4);
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X4, batch_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X4, batch_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X4, batch_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 4 + 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X4, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x4);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VEXP__NEON_RR2_P5_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x8);
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 8 + 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__NEON_RR2_P5_X8, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__neon_rr2_p5_x8);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X4, batch_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VUnaryMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4);
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X4, batch_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X4, batch_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X4, batch_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 4 + 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X4, inplace) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8);
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 8 + 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__NEONFMA_RR2_P5_X8, inplace) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VEXP__SSE2_RR2_P5_X4, batch_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnaryMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4);
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X4, batch_div_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X4, batch_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X4, batch_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 4 + 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4);
+    }
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X4, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VEXP__SSE2_RR2_P5_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8);
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 8 + 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8);
+    }
+  }
+
+  TEST(F32_VEXP__SSE2_RR2_P5_X8, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VEXP__AVX2_RR2_P5_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8, xnn_init_f32_exp_avx_params);
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X8, batch_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8, xnn_init_f32_exp_avx_params);
+    }
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8, xnn_init_f32_exp_avx_params);
+    }
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 8 + 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8, xnn_init_f32_exp_avx_params);
+    }
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X8, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8, xnn_init_f32_exp_avx_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VEXP__AVX2_RR2_P5_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX2;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16, xnn_init_f32_exp_avx_params);
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16, xnn_init_f32_exp_avx_params);
+    }
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16, xnn_init_f32_exp_avx_params);
+    }
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 16 + 1; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16, xnn_init_f32_exp_avx_params);
+    }
+  }
+
+  TEST(F32_VEXP__AVX2_RR2_P5_X16, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16, xnn_init_f32_exp_avx_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x16);
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x16);
+    }
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x16);
+    }
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 16 + 1; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x16);
+    }
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X16, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnaryMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32);
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32);
+    }
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32);
+    }
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 32 + 1; batch_size < 64; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32);
+    }
+  }
+
+  TEST(F32_VEXP__AVX512F_RR2_P5_SCALEF_X32, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 160; batch_size += 31) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vexp_ukernel__avx512f_rr2_p5_scalef_x32);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X1, batch_eq_1) {
+  VUnaryMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x1);
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X1, batch_gt_1) {
+  for (size_t batch_size = 1 + 1; batch_size < 10; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x1);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X1, inplace) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace(true)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x1);
+  }
+}
+
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X2, batch_eq_2) {
+  VUnaryMicrokernelTester()
+    .batch_size(2)
+    .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2);
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X2, batch_div_2) {
+  for (size_t batch_size = 4; batch_size < 20; batch_size += 2) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X2, batch_lt_2) {
+  for (size_t batch_size = 1; batch_size < 2; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X2, batch_gt_2) {
+  for (size_t batch_size = 2 + 1; batch_size < 4; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X2, inplace) {
+  for (size_t batch_size = 1; batch_size <= 10; batch_size += 1) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace(true)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2);
+  }
+}
+
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X4, batch_eq_4) {
+  VUnaryMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4);
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X4, batch_gt_4) {
+  for (size_t batch_size = 4 + 1; batch_size < 8; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4);
+  }
+}
+
+TEST(F32_VEXP__SCALAR_RR2_P5_X4, inplace) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace(true)
+      .Test(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4);
+  }
+}
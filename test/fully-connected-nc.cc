@@ -467,6 +467,129 @@ TEST(FULLY_CONNECTED_NC_F32, small_batch_without_bias) {
     .TestF32();
 }
 
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(37)
+    .qmin(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(37)
+    .qmax(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(37)
+    .output_stride(41)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_input_channels_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(4099)
+    .output_channels(37)
+    .qmin(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(4099)
+    .output_channels(37)
+    .qmax(128)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(4099)
+    .input_stride(4111)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(4099)
+    .output_channels(37)
+    .output_stride(41)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_input_channels_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_large_input_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(4099)
+    .output_channels(37)
+    .TestF32();
+}
+
 TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -488,6 +611,124 @@ TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch_transpose_weights) {
     .TestF32();
 }
 
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
 TEST(FULLY_CONNECTED_NC_F16, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
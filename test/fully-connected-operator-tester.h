@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <random>
 #include <vector>
@@ -676,6 +677,117 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void TestQD8F32QC8W() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+    ASSERT_FALSE(transpose_weights());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scaledist(0.5f, 2.0f);
+    auto w8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(-std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()),
+      std::ref(rng));
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<int8_t> kernel(output_channels() * input_channels());
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+    std::vector<float> output_tolerance(batch_size() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), std::ref(w8rng));
+      std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scaledist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results with unquantized inputs. Quantization moves every input by at most half of the
+      // quantization step of its row, which bounds the expected error of every output.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float* input_row = input.data() + i * input_stride();
+        const float row_min = std::min(0.0f, *std::min_element(input_row, input_row + input_channels()));
+        const float row_max = std::max(0.0f, *std::max_element(input_row, input_row + input_channels()));
+        const float input_scale = (row_max - row_min) / 255.0f;
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double acc = 0.0;
+          double abs_kernel_sum = 0.0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            acc += double(input_row[ic]) * double(kernel[oc * input_channels() + ic]);
+            abs_kernel_sum += std::abs(double(kernel[oc * input_channels() + ic]));
+          }
+          output_ref[i * output_channels() + oc] =
+            float(acc * double(kernel_scale[oc])) + (has_bias() ? bias[oc] : 0.0f);
+          output_tolerance[i * output_channels() + oc] =
+            float(abs_kernel_sum * double(kernel_scale[oc]) * double(input_scale)) +
+            1.0e-4f * std::abs(output_ref[i * output_channels() + oc]);
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel_scale.data(), kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          0 /* flags */,
+          nullptr /* caches */,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+              << "batch index = " << i << ", channel = " << c;
+          EXPECT_NEAR(output_ref[i * output_channels() + c],
+                      output[i * output_stride() + c],
+                      output_tolerance[i * output_channels() + c])
+              << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
   void TestF16() const {
     switch (weights_type()) {
       case WeightsType::Default:
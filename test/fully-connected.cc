@@ -583,3 +583,167 @@ TEST_F(FullyConnectedTestF32, matches_operator_api)
     ASSERT_EQ(subgraph_output[i], operator_output[i]);
   }
 }
+
+class FullyConnectedTestF32QC8W : public FullyConnectedTestBase<float> {
+protected:
+  FullyConnectedTestF32QC8W()
+  {
+    qc8_kernel = std::vector<int8_t>(input_channels * output_channels);
+    kernel_scale = std::vector<float>(output_channels);
+    std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return f32dist(rng); });
+  }
+
+  void GenerateInputsAndWeights()
+  {
+    std::uniform_real_distribution<float> input_dist(-1.0f, 1.0f);
+    std::generate(input.begin(), input.end(), [&]() { return input_dist(rng); });
+    std::generate(qc8_kernel.begin(), qc8_kernel.end(), [&]() { return static_cast<int8_t>(i8dist(rng)); });
+    std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return f32dist(rng); });
+    std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+    std::fill(operator_output.begin(), operator_output.end(), nanf(""));
+    std::fill(subgraph_output.begin(), subgraph_output.end(), nanf(""));
+  }
+
+  void DefineSubgraph(xnn_subgraph_t subgraph, uint32_t* input_id, uint32_t* output_id)
+  {
+    *input_id = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+                            /*external_id=*/0, XNN_VALUE_FLAG_EXTERNAL_INPUT, input_id));
+    ASSERT_NE(*input_id, XNN_INVALID_NODE_ID);
+
+    uint32_t kernel_id = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_channelwise_quantized_tensor_value(
+                            subgraph, xnn_datatype_qcint8, kernel_scale.data(), kernel_dims.size(),
+                            /*channel_dim=*/0, kernel_dims.data(), qc8_kernel.data(), /*external_id=*/1,
+                            /*flags=*/0, &kernel_id));
+
+    const std::array<size_t, 1> bias_dims = {output_channels};
+    uint32_t bias_id = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), bias.data(),
+                            /*external_id=*/2, /*flags=*/0, &bias_id));
+
+    *output_id = XNN_INVALID_NODE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+                            /*external_id=*/3, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, output_id));
+    ASSERT_NE(*output_id, XNN_INVALID_NODE_ID);
+
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_fully_connected(
+                            subgraph, output_min, output_max, *input_id, kernel_id, bias_id, *output_id,
+                            /*flags=*/0));
+  }
+
+  void RunSubgraph(uint32_t flags)
+  {
+    xnn_subgraph_t subgraph = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, /*flags=*/0, &subgraph));
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+    uint32_t input_id = XNN_INVALID_NODE_ID;
+    uint32_t output_id = XNN_INVALID_NODE_ID;
+    DefineSubgraph(subgraph, &input_id, &output_id);
+
+    xnn_runtime_t runtime = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, flags, &runtime));
+    ASSERT_NE(nullptr, runtime);
+    std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+    std::array<xnn_external_value, 2> external = {
+      xnn_external_value{input_id, input.data()}, xnn_external_value{output_id, subgraph_output.data()}};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  }
+
+  std::vector<int8_t> qc8_kernel;
+  std::vector<float> kernel_scale;
+};
+
+TEST_F(FullyConnectedTestF32QC8W, define)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  DefineSubgraph(subgraph, &input_id, &output_id);
+
+  ASSERT_EQ(subgraph->num_nodes, 1);
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(node->type, xnn_node_type_fully_connected);
+  ASSERT_EQ(node->compute_type, xnn_compute_type_fp32_qc8w);
+  ASSERT_EQ(node->num_inputs, 3);
+  ASSERT_EQ(node->inputs[0], input_id);
+  ASSERT_EQ(node->num_outputs, 1);
+  ASSERT_EQ(node->outputs[0], output_id);
+
+  xnn_subgraph_rewrite_for_dynamic_quantization(subgraph);
+  ASSERT_EQ(node->compute_type, xnn_compute_type_qd8_to_fp32);
+}
+
+TEST_F(FullyConnectedTestF32QC8W, matches_operator_api_with_dequantized_weights)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  GenerateInputsAndWeights();
+
+  // Without dynamic quantization, the weights are dequantized and the Node matches an FP32 operator.
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      kernel[oc * input_channels + ic] = float(qc8_kernel[oc * input_channels + ic]) * kernel_scale[oc];
+    }
+  }
+
+  xnn_operator_t op = nullptr;
+  const xnn_status status = xnn_create_fully_connected_nc_f32(
+    input_channels, output_channels, input_channels, output_channels, kernel.data(), bias.data(), output_min,
+    output_max, /*flags=*/0, nullptr, &op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_EQ(
+    xnn_status_success, xnn_setup_fully_connected_nc_f32(
+                          op, batch_size, input.data(), operator_output.data(), /*threadpool=*/nullptr));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+  RunSubgraph(/*flags=*/0);
+
+  for (size_t i = 0; i < operator_output.size(); i++) {
+    ASSERT_EQ(subgraph_output[i], operator_output[i]);
+  }
+}
+
+TEST_F(FullyConnectedTestF32QC8W, matches_operator_api_with_dynamic_quantization)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  GenerateInputsAndWeights();
+
+  xnn_operator_t op = nullptr;
+  const xnn_status status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
+    input_channels, output_channels, input_channels, output_channels, kernel_scale.data(), qc8_kernel.data(),
+    bias.data(), output_min, output_max, /*flags=*/0, nullptr, &op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_EQ(
+    xnn_status_success, xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+                          op, batch_size, input.data(), operator_output.data(), /*threadpool=*/nullptr));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+  RunSubgraph(XNN_FLAG_DYNAMIC_QUANTIZATION);
+
+  for (size_t i = 0; i < operator_output.size(); i++) {
+    ASSERT_EQ(subgraph_output[i], operator_output[i]);
+  }
+}
@@ -716,6 +716,110 @@ void GemmMicrokernelTester::Test(
   }
 }
 
+void GemmMicrokernelTester::Test(xnn_qd8_f32_qc8w_gemm_ukernel_fn gemm, xnn_init_f32_minmax_params_fn init_params) const
+{
+  ASSERT_LE(m(), mr());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  auto w8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(-std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  auto zprng = std::bind(std::uniform_int_distribution<int32_t>(-100, 100), std::ref(rng));
+  std::uniform_real_distribution<float> scaledist(0.5f, 2.0f);
+  std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+  std::vector<int8_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(int8_t));
+  std::vector<int8_t> b(n() * k());
+  std::vector<float> kernel_scale(n());
+  std::vector<float> bias(n());
+  std::vector<xnn_qd8_quantization_params> quantization_params(mr());
+  std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_w(
+    packed_n() * packed_k() + packed_n() * (sizeof(int32_t) + 2 * sizeof(float)) / sizeof(int8_t));
+  std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<float> c_ref(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    std::generate(a.begin(), a.end(), std::ref(i8rng));
+    std::generate(b.begin(), b.end(), std::ref(w8rng));
+    std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scaledist(rng); });
+    std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+    for (xnn_qd8_quantization_params& row_params : quantization_params) {
+      row_params.zero_point = zprng();
+      row_params.scale = scaledist(rng);
+    }
+    std::fill(c.begin(), c.end(), nanf(""));
+
+    // Negated column sums of the weights (input zero point 1, no bias) followed by the weights, filter scales, and
+    // biases, matching the layout produced by the Fully Connected operator.
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    const xnn_qs8_packing_params packing_params = { 1 };
+    xnn_pack_qs8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+      b.data(), nullptr, packed_w.data(), nr() * 2 * sizeof(float), &packing_params);
+    const size_t packed_stride = nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t) + 2 * sizeof(float));
+    void* extra_weights = (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t)));
+    xnn_init_qc8_scale_fp32_params(n(), nr(), packed_stride, kernel_scale.data(), extra_weights);
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_stride, bias.data(), (void*) ((uintptr_t) extra_weights + nr() * sizeof(float)));
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        int32_t acc = 0;
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          acc +=
+            (int32_t(a[m_index * a_stride() + k_index]) - quantization_params[m_index].zero_point) *
+            int32_t(b[n_index * k() + k_index]);
+        }
+        c_ref[m_index * n() + n_index] =
+          float(acc) * quantization_params[m_index].scale * kernel_scale[n_index] + bias[n_index];
+      }
+    }
+
+    const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+    const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+    const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                    : accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+    const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                      : accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+    xnn_f32_minmax_params params;
+    init_params(&params, c_min, c_max);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], c_max), c_min);
+      }
+    }
+
+    gemm(
+      m(), n(), k(),
+      a.data(), a_stride() * sizeof(int8_t),
+      packed_w.data(),
+      c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+      &params, quantization_params.data());
+
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        EXPECT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max);
+        EXPECT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min);
+        EXPECT_NEAR(
+            c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+            c_ref[i * n() + j],
+            std::max(1.0e-5f, std::abs(c_ref[i * n() + j]) * 1.0e-6f))
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x "
+            << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+            << ", input zero point = " << quantization_params[i].zero_point << ", input scale = " << quantization_params[i].scale;
+      }
+    }
+  }
+}
+
 void GemmMicrokernelTester::Test(xnn_bf16_gemm_minmax_ukernel_fn gemm_minmax, xnn_init_bf16_minmax_params_fn init_params) const
 {
   ASSERT_LE(m(), mr());
@@ -2701,7 +2805,7 @@ void GemmMicrokernelTester::Test(
     const float output_max = std::numeric_limits<float>::infinity();
 
     char *post_operation_params = allocate_and_initialize_post_operation_params(
-        post_operations.size(), post_operations.data());
+        post_operations.size(), post_operations.data(), /*arena=*/nullptr);
 
     struct xnn_code_buffer code_buffer;
     ASSERT_EQ(xnn_status_success, xnn_allocate_code_memory(&code_buffer, XNN_DEFAULT_CODE_BUFFER_SIZE));
@@ -2823,7 +2927,7 @@ void GemmMicrokernelTester::Test(
     PerformUnaryOperation(c_ref, post_operations);
 
     char *post_operation_params = allocate_and_initialize_post_operation_params(
-        post_operations.size(), post_operations.data());
+        post_operations.size(), post_operations.data(), /*arena=*/nullptr);
 
     const float* zero_pointer = (zero_index() != SIZE_MAX) ? a.data() : NULL;
 
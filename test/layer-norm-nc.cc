@@ -0,0 +1,437 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "layer-norm-operator-tester.h"
+
+TEST(LAYER_NORM_NC_F16, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F16, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F16, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F16, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F16, large_channels) {
+  for (size_t channels = 1000; channels < 5000; channels += 1333) {
+    LayerNormOperatorTester()
+      .batch_size(2)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F16, no_beta) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .has_beta(false)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F16, fp32_weights) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .weights_type(LayerNormOperatorTester::WeightsType::FP32)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(RMS_NORM_NC_F16, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(RMS_NORM_NC_F16, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(RMS_NORM_NC_F16, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(RMS_NORM_NC_F16, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(RMS_NORM_NC_F16, large_channels) {
+  for (size_t channels = 1000; channels < 5000; channels += 1333) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(2)
+      .channels(channels)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(RMS_NORM_NC_F16, fp32_weights) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .weights_type(LayerNormOperatorTester::WeightsType::FP32)
+      .iterations(3)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORM_NC_F32, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORM_NC_F32, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORM_NC_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORM_NC_F32, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORM_NC_F32, large_channels) {
+  for (size_t channels = 1000; channels < 5000; channels += 1333) {
+    LayerNormOperatorTester()
+      .batch_size(2)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORM_NC_F32, no_beta) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .has_beta(false)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(RMS_NORM_NC_F32, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(RMS_NORM_NC_F32, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(RMS_NORM_NC_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(RMS_NORM_NC_F32, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(RMS_NORM_NC_F32, large_channels) {
+  for (size_t channels = 1000; channels < 5000; channels += 1333) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(2)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, large_channels) {
+  for (size_t channels = 1000; channels < 5000; channels += 1333) {
+    LayerNormOperatorTester()
+      .batch_size(2)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, no_beta) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .has_beta(false)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, input_zero_point) {
+  for (int16_t input_zero_point = -128; input_zero_point <= 127; input_zero_point += 51) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(37)
+      .input_zero_point(input_zero_point)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(LAYER_NORM_NC_QS8, output_zero_point) {
+  for (int16_t output_zero_point = -128; output_zero_point <= 127; output_zero_point += 51) {
+    LayerNormOperatorTester()
+      .batch_size(3)
+      .channels(37)
+      .output_zero_point(output_zero_point)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, large_channels) {
+  for (size_t channels = 1000; channels < 5000; channels += 1333) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(2)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, input_zero_point) {
+  for (int16_t input_zero_point = -128; input_zero_point <= 127; input_zero_point += 51) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(37)
+      .input_zero_point(input_zero_point)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(RMS_NORM_NC_QS8, output_zero_point) {
+  for (int16_t output_zero_point = -128; output_zero_point <= 127; output_zero_point += 51) {
+    LayerNormOperatorTester()
+      .rms(true)
+      .batch_size(3)
+      .channels(37)
+      .output_zero_point(output_zero_point)
+      .iterations(3)
+      .TestQS8();
+  }
+}
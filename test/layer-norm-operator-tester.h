@@ -0,0 +1,415 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <fp16.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class LayerNormOperatorTester {
+ public:
+  enum class WeightsType {
+    Default,
+    FP32,
+  };
+
+  inline LayerNormOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline LayerNormOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline LayerNormOperatorTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->input_stride_ >= this->channels_);
+      return this->input_stride_;
+    }
+  }
+
+  inline LayerNormOperatorTester& output_stride(size_t output_stride) {
+    assert(output_stride != 0);
+    this->output_stride_ = output_stride;
+    return *this;
+  }
+
+  inline size_t output_stride() const {
+    if (this->output_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->output_stride_ >= this->channels_);
+      return this->output_stride_;
+    }
+  }
+
+  // RMS normalization: no mean subtraction and no offset.
+  inline LayerNormOperatorTester& rms(bool rms) {
+    this->rms_ = rms;
+    return *this;
+  }
+
+  inline bool rms() const {
+    return this->rms_;
+  }
+
+  inline LayerNormOperatorTester& has_beta(bool has_beta) {
+    this->has_beta_ = has_beta;
+    return *this;
+  }
+
+  inline bool has_beta() const {
+    return this->has_beta_ && !rms();
+  }
+
+  inline LayerNormOperatorTester& epsilon(float epsilon) {
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  inline float epsilon() const {
+    return this->epsilon_;
+  }
+
+  inline LayerNormOperatorTester& input_zero_point(int16_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int16_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline LayerNormOperatorTester& output_zero_point(int16_t output_zero_point) {
+    this->output_zero_point_ = output_zero_point;
+    return *this;
+  }
+
+  inline int16_t output_zero_point() const {
+    return this->output_zero_point_;
+  }
+
+  inline LayerNormOperatorTester& weights_type(WeightsType weights_type) {
+    this->weights_type_ = weights_type;
+    return *this;
+  }
+
+  inline WeightsType weights_type() const {
+    return this->weights_type_;
+  }
+
+  inline LayerNormOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+    auto f32wrng = std::uniform_real_distribution<float>(0.5f, 2.0f);
+
+    std::vector<uint16_t> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> gamma(channels());
+    std::vector<uint16_t> beta(channels());
+    std::vector<float> gamma_as_float(channels());
+    std::vector<float> beta_as_float(channels());
+    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32irng(rng) + 4.0f); });
+      std::generate(gamma.begin(), gamma.end(), [&]() { return fp16_ieee_from_fp32_value(f32wrng(rng)); });
+      std::generate(beta.begin(), beta.end(), [&]() { return fp16_ieee_from_fp32_value(f32irng(rng)); });
+      std::transform(gamma.cbegin(), gamma.cend(), gamma_as_float.begin(), fp16_ieee_to_fp32_value);
+      std::transform(beta.cbegin(), beta.cend(), beta_as_float.begin(), fp16_ieee_to_fp32_value);
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        std::vector<double> row(channels());
+        for (size_t c = 0; c < channels(); c++) {
+          row[c] = fp16_ieee_to_fp32_value(input[i * input_stride() + c]);
+        }
+        ComputeReference(row.data(), gamma_as_float.data(), beta_as_float.data(), &output_ref[i * channels()]);
+      }
+
+      // Create, setup, run, and destroy normalization operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t norm_op = nullptr;
+
+      const void* gamma_data = gamma.data();
+      const void* beta_data = has_beta() ? beta.data() : nullptr;
+      uint32_t flags = 0;
+      if (weights_type() == WeightsType::FP32) {
+        gamma_data = gamma_as_float.data();
+        beta_data = has_beta() ? beta_as_float.data() : nullptr;
+        flags |= XNN_FLAG_FP32_STATIC_WEIGHTS;
+      }
+      xnn_status status;
+      if (rms()) {
+        status = xnn_create_rms_norm_nc_f16(
+          channels(), input_stride(), output_stride(), epsilon(),
+          gamma_data, flags, nullptr, &norm_op);
+      } else {
+        status = xnn_create_layer_norm_nc_f16(
+          channels(), input_stride(), output_stride(), epsilon(),
+          gamma_data, beta_data, flags, nullptr, &norm_op);
+      }
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, norm_op);
+
+      // Smart pointer to automatically delete norm_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_norm_op(norm_op, xnn_delete_operator);
+
+      if (rms()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_rms_norm_nc_f16(norm_op, batch_size(), input.data(), output.data(), nullptr /* thread pool */));
+      } else {
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_layer_norm_nc_f16(norm_op, batch_size(), input.data(), output.data(), nullptr /* thread pool */));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(norm_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[i * output_stride() + c]),
+              output_ref[i * channels() + c],
+              std::max(1.0e-2f, std::abs(output_ref[i * channels() + c]) * 1.0e-2f))
+            << "at batch " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+  void TestF32() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+    auto f32wrng = std::uniform_real_distribution<float>(0.5f, 2.0f);
+
+    std::vector<float> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> gamma(channels());
+    std::vector<float> beta(channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32irng(rng) + 4.0f; });
+      std::generate(gamma.begin(), gamma.end(), [&]() { return f32wrng(rng); });
+      std::generate(beta.begin(), beta.end(), [&]() { return f32irng(rng); });
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        std::vector<double> row(input.cbegin() + i * input_stride(), input.cbegin() + i * input_stride() + channels());
+        ComputeReference(row.data(), gamma.data(), beta.data(), &output_ref[i * channels()]);
+      }
+
+      // Create, setup, run, and destroy normalization operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t norm_op = nullptr;
+
+      if (rms()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_rms_norm_nc_f32(
+            channels(), input_stride(), output_stride(), epsilon(),
+            gamma.data(), 0, nullptr, &norm_op));
+      } else {
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_layer_norm_nc_f32(
+            channels(), input_stride(), output_stride(), epsilon(),
+            gamma.data(), has_beta() ? beta.data() : nullptr, 0, nullptr, &norm_op));
+      }
+      ASSERT_NE(nullptr, norm_op);
+
+      // Smart pointer to automatically delete norm_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_norm_op(norm_op, xnn_delete_operator);
+
+      if (rms()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_rms_norm_nc_f32(norm_op, batch_size(), input.data(), output.data(), nullptr /* thread pool */));
+      } else {
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_layer_norm_nc_f32(norm_op, batch_size(), input.data(), output.data(), nullptr /* thread pool */));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(norm_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+              output[i * output_stride() + c],
+              output_ref[i * channels() + c],
+              std::max(1.0e-4f, std::abs(output_ref[i * channels() + c]) * 1.0e-4f))
+            << "at batch " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+  void TestQS8() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::uniform_int_distribution<int32_t>(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    auto f32irng = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+    auto f32wrng = std::uniform_real_distribution<float>(0.5f, 2.0f);
+
+    const float input_scale = 0.25f;
+    const float output_scale = 1.0f / 32.0f;
+    const int8_t output_min = std::numeric_limits<int8_t>::min();
+    const int8_t output_max = std::numeric_limits<int8_t>::max();
+
+    std::vector<int8_t> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<float> gamma(channels());
+    std::vector<float> beta(channels());
+    std::vector<int8_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8rng(rng); });
+      std::generate(gamma.begin(), gamma.end(), [&]() { return f32wrng(rng); });
+      std::generate(beta.begin(), beta.end(), [&]() { return f32irng(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        std::vector<double> row(channels());
+        for (size_t c = 0; c < channels(); c++) {
+          row[c] = double(int32_t(input[i * input_stride() + c]) - int32_t(input_zero_point())) * double(input_scale);
+        }
+        ComputeReference(row.data(), gamma.data(), beta.data(), &output_ref[i * channels()]);
+        for (size_t c = 0; c < channels(); c++) {
+          float y = output_ref[i * channels() + c] / output_scale + float(output_zero_point());
+          y = std::max<float>(y, float(output_min));
+          y = std::min<float>(y, float(output_max));
+          output_ref[i * channels() + c] = y;
+        }
+      }
+
+      // Create, setup, run, and destroy normalization operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t norm_op = nullptr;
+
+      if (rms()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_rms_norm_nc_qs8(
+            channels(), input_stride(), output_stride(), epsilon(),
+            int8_t(input_zero_point()), input_scale,
+            gamma.data(),
+            int8_t(output_zero_point()), output_scale, output_min, output_max,
+            0, nullptr, &norm_op));
+      } else {
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_layer_norm_nc_qs8(
+            channels(), input_stride(), output_stride(), epsilon(),
+            int8_t(input_zero_point()), input_scale,
+            gamma.data(), has_beta() ? beta.data() : nullptr,
+            int8_t(output_zero_point()), output_scale, output_min, output_max,
+            0, nullptr, &norm_op));
+      }
+      ASSERT_NE(nullptr, norm_op);
+
+      // Smart pointer to automatically delete norm_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_norm_op(norm_op, xnn_delete_operator);
+
+      if (rms()) {
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_rms_norm_nc_qs8(norm_op, batch_size(), input.data(), output.data(), nullptr /* thread pool */));
+      } else {
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_layer_norm_nc_qs8(norm_op, batch_size(), input.data(), output.data(), nullptr /* thread pool */));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(norm_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(float(int32_t(output[i * output_stride() + c])), output_ref[i * channels() + c], 0.6f)
+            << "at batch " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  void ComputeReference(const double* x, const float* gamma, const float* beta, float* y) const {
+    double sum = 0.0;
+    double sumsq = 0.0;
+    for (size_t c = 0; c < channels(); c++) {
+      sum += x[c];
+      sumsq += x[c] * x[c];
+    }
+    const double mean = rms() ? 0.0 : sum / double(channels());
+    const double variance = rms() ? sumsq / double(channels()) : std::max(sumsq / double(channels()) - mean * mean, 0.0);
+    const double rstd = 1.0 / std::sqrt(variance + double(epsilon()));
+    for (size_t c = 0; c < channels(); c++) {
+      y[c] = float((x[c] - mean) * rstd * double(gamma[c]) + (has_beta() ? double(beta[c]) : 0.0));
+    }
+  }
+
+  size_t batch_size_{1};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  size_t output_stride_{0};
+  bool rms_{false};
+  bool has_beta_{true};
+  float epsilon_{1.0e-5f};
+  int16_t input_zero_point_{0};
+  int16_t output_zero_point_{0};
+  WeightsType weights_type_{WeightsType::Default};
+  size_t iterations_{15};
+};
@@ -0,0 +1,248 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/node-type.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+class LayerNormTestF32 : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    random_device = std::unique_ptr<std::random_device>(new std::random_device());
+    rng = std::mt19937((*random_device)());
+    dim_dist = std::uniform_int_distribution<size_t>(1, 9);
+    input_dims = RandomShape(4);
+    batch_size = input_dims[0] * input_dims[1] * input_dims[2];
+    channels = input_dims[3];
+    weights_dims = {channels};
+    input = std::vector<float>(XNN_EXTRA_BYTES / sizeof(float) + NumElements(input_dims));
+    gamma = std::vector<float>(channels);
+    beta = std::vector<float>(channels);
+    operator_output = std::vector<float>(NumElements(input_dims));
+    subgraph_output = std::vector<float>(operator_output.size());
+  }
+
+  std::vector<size_t> RandomShape(size_t num_dims)
+  {
+    std::vector<size_t> dims(num_dims);
+    std::generate(dims.begin(), dims.end(), [&] { return dim_dist(rng); });
+    return dims;
+  }
+
+  size_t NumElements(std::vector<size_t>& dims)
+  {
+    return std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+  }
+
+  std::unique_ptr<std::random_device> random_device;
+  std::mt19937 rng;
+  std::uniform_int_distribution<size_t> dim_dist;
+
+  std::vector<size_t> input_dims;
+  std::vector<size_t> weights_dims;
+  std::vector<float> input;
+  std::vector<float> gamma;
+  std::vector<float> beta;
+  std::vector<float> operator_output;
+  std::vector<float> subgraph_output;
+  size_t channels;
+  size_t batch_size;
+  float epsilon = 1.0e-5f;
+};
+
+TEST_F(LayerNormTestF32, define)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  ASSERT_NE(input_id, XNN_INVALID_NODE_ID);
+
+  uint32_t gamma_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, weights_dims.size(), weights_dims.data(), gamma.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &gamma_id));
+  ASSERT_NE(gamma_id, XNN_INVALID_NODE_ID);
+
+  uint32_t beta_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, weights_dims.size(), weights_dims.data(), beta.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &beta_id));
+  ASSERT_NE(beta_id, XNN_INVALID_NODE_ID);
+
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_NE(output_id, XNN_INVALID_NODE_ID);
+
+  const std::array<size_t, 1> reduction_axes = {3};
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_layer_norm(
+      subgraph, reduction_axes.size(), reduction_axes.data(), epsilon, input_id, gamma_id, beta_id, output_id,
+      /*flags=*/0));
+
+  ASSERT_EQ(subgraph->num_nodes, 1);
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(node->type, xnn_node_type_layer_norm);
+  ASSERT_EQ(node->compute_type, xnn_compute_type_fp32);
+  ASSERT_EQ(node->params.normalization.num_reduction_axes, 1);
+  ASSERT_EQ(node->params.normalization.reduction_axes[0], 3);
+  ASSERT_EQ(node->params.normalization.epsilon, epsilon);
+  ASSERT_EQ(node->num_inputs, 3);
+  ASSERT_EQ(node->inputs[0], input_id);
+  ASSERT_EQ(node->inputs[1], gamma_id);
+  ASSERT_EQ(node->inputs[2], beta_id);
+  ASSERT_EQ(node->num_outputs, 1);
+  ASSERT_EQ(node->outputs[0], output_id);
+  ASSERT_EQ(node->flags, 0);
+}
+
+TEST_F(LayerNormTestF32, rejects_outer_reduction_axis)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  // Make sure the reduced and the innermost dimensions can not be merged away.
+  input_dims[1] = 2;
+  input_dims[3] = 3;
+  weights_dims = {input_dims[1]};
+  gamma.resize(input_dims[1]);
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+
+  uint32_t gamma_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, weights_dims.size(), weights_dims.data(), gamma.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &gamma_id));
+
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  const std::array<size_t, 1> reduction_axes = {1};
+  ASSERT_EQ(
+    xnn_status_unsupported_parameter,
+    xnn_define_rms_norm(
+      subgraph, reduction_axes.size(), reduction_axes.data(), epsilon, input_id, gamma_id, output_id,
+      /*flags=*/0));
+}
+
+TEST_F(LayerNormTestF32, matches_operator_api)
+{
+  std::uniform_real_distribution<float> f32idist(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> f32wdist(0.5f, 2.0f);
+  std::generate(input.begin(), input.end(), [&]() { return f32idist(rng); });
+  std::generate(gamma.begin(), gamma.end(), [&]() { return f32wdist(rng); });
+  std::generate(beta.begin(), beta.end(), [&]() { return f32idist(rng); });
+  std::fill(operator_output.begin(), operator_output.end(), nanf(""));
+  std::fill(subgraph_output.begin(), subgraph_output.end(), nanf(""));
+
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  // Call operator API.
+  xnn_operator_t op = nullptr;
+  const xnn_status status = xnn_create_layer_norm_nc_f32(
+    channels, channels, channels, epsilon, gamma.data(), beta.data(), /*flags=*/0, nullptr, &op);
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_NE(nullptr, op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_setup_layer_norm_nc_f32(op, batch_size, input.data(), operator_output.data(), /*threadpool=*/nullptr));
+
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+  // Call subgraph API.
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, /*external_id=*/0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  ASSERT_NE(input_id, XNN_INVALID_NODE_ID);
+
+  uint32_t gamma_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, weights_dims.size(), weights_dims.data(), gamma.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &gamma_id));
+  ASSERT_NE(gamma_id, XNN_INVALID_NODE_ID);
+
+  uint32_t beta_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, weights_dims.size(), weights_dims.data(), beta.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &beta_id));
+  ASSERT_NE(beta_id, XNN_INVALID_NODE_ID);
+
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, /*external_id=*/1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_NE(output_id, XNN_INVALID_NODE_ID);
+
+  const std::array<size_t, 1> reduction_axes = {3};
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_layer_norm(
+      subgraph, reduction_axes.size(), reduction_axes.data(), epsilon, input_id, gamma_id, beta_id, output_id,
+      /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  std::array<xnn_external_value, 2> external = {
+    xnn_external_value{input_id, input.data()}, xnn_external_value{output_id, subgraph_output.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  ASSERT_EQ(subgraph_output, operator_output);
+}
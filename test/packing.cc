@@ -6411,3 +6411,93 @@ TEST(PACK_F16_DWCONV_OKI_W, primary_tile_eq_kernel_size) {
 }
 
 
+
+TEST(PACK_F32_GEMM_GOI_W, kr_eq_1_sr_eq_1) {
+  const size_t g = 1;
+  const size_t nc = 3;
+  const size_t kc = 2;
+  const size_t nr = 2;
+  const size_t kr = 1;
+  const size_t sr = 1;
+
+  std::vector<float> b(g * nc);
+  std::iota(b.begin(), b.end(), 0.0f);  // b = [0, 1, 2]
+  std::vector<float> k(g * nc * kc);  // k = [3, 4, 5, 6, 7, 8]
+  std::iota(k.begin(), k.end(), static_cast<float>(b.size()));
+  std::vector<float> packed_weights(g * round_up(nc, nr) * (1 + round_up_po2(kc, kr * sr)));
+
+  xnn_pack_f32_gemm_goi_w(g, nc, kc, nr, kr, sr, k.data(), b.data(), packed_weights.data(), 0, nullptr);
+
+  const std::vector<float> expected = {
+    // bias first
+    0.0f, 1.0f,
+    // then weights, output channels first
+    3.0f, 5.0f,
+    4.0f, 6.0f,
+    // bias of the last block of output channels, padded with zeroes
+    2.0f, 0.0f,
+    // then weights
+    7.0f, 0.0f,
+    8.0f, 0.0f,
+  };
+  EXPECT_EQ(expected, packed_weights);
+}
+
+TEST(PACK_F32_GEMM_GOI_W, kr_gt_1) {
+  const size_t g = 1;
+  const size_t nc = 2;
+  const size_t kc = 3;
+  const size_t nr = 2;
+  const size_t kr = 2;
+  const size_t sr = 1;
+
+  std::vector<float> b(g * nc);
+  std::iota(b.begin(), b.end(), 0.0f);  // b = [0, 1]
+  std::vector<float> k(g * nc * kc);  // k = [2, 3, 4, 5, 6, 7]
+  std::iota(k.begin(), k.end(), static_cast<float>(b.size()));
+  std::vector<float> packed_weights(g * round_up(nc, nr) * (1 + round_up_po2(kc, kr * sr)));
+
+  xnn_pack_f32_gemm_goi_w(g, nc, kc, nr, kr, sr, k.data(), b.data(), packed_weights.data(), 0, nullptr);
+
+  const std::vector<float> expected = {
+    // bias first
+    0.0f, 1.0f,
+    // then weights, kr input channels of every output channel
+    2.0f, 3.0f, 5.0f, 6.0f,
+    // input channels beyond kc are padded with zeroes
+    4.0f, 0.0f, 7.0f, 0.0f,
+  };
+  EXPECT_EQ(expected, packed_weights);
+}
+
+TEST(PACK_QS8_GEMM_GOI_W, sr_eq_1) {
+  const size_t g = 1;
+  const size_t nc = 2;
+  const size_t kc = 3;
+  const size_t nr = 2;
+  const size_t kr = 2;
+  const size_t sr = 1;
+
+  std::vector<int32_t> b(g * nc);
+  std::iota(b.begin(), b.end(), 0);  // b = [0, 1]
+  std::vector<int8_t> k(g * nc * kc);  // k = [2, 3, 4, 5, 6, 7]
+  std::iota(k.begin(), k.end(), static_cast<int8_t>(b.size()));
+  std::vector<uint8_t> packed_weights(g * round_up(nc, nr) * (sizeof(int32_t) + round_up_po2(kc, kr * sr)));
+
+  xnn_qs8_packing_params params = {};
+  params.input_zero_point = 1;
+  xnn_pack_qs8_gemm_goi_w(g, nc, kc, nr, kr, sr, k.data(), b.data(), packed_weights.data(), 0, &params);
+
+  const std::vector<uint8_t> expected = {
+    // bias first
+    // 0 - (2 + 3 + 4) * 1 = -9 = 0xFFFFFFF7
+    0xF7, 0xFF, 0xFF, 0xFF,
+    // 1 - (5 + 6 + 7) * 1 = -17 = 0xFFFFFFEF
+    0xEF, 0xFF, 0xFF, 0xFF,
+    // then weights, kr input channels of every output channel
+    2, 3, 5, 6,
+    // input channels beyond kc are padded with zeroes
+    4, 0, 7, 0,
+  };
+  EXPECT_EQ(expected, packed_weights);
+}
@@ -0,0 +1,212 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/embedding.h>
+#include <xnnpack/microparams-init.h>
+#include "embedding-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(QC4_F32_EMBEDDING__NEON_C16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    EmbeddingMicrokernelTester()
+      .channels(16)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(QC4_F32_EMBEDDING__NEON_C16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__NEON_C16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__NEON_C16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__NEON_C16, multiple_rows) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 2; rows <= 17; rows += 3) {
+      EmbeddingMicrokernelTester()
+        .rows(rows)
+        .channels(33)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__NEON_C16, table_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .table_stride(83)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__NEON_C16, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.2f)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__neon_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE41;
+    EmbeddingMicrokernelTester()
+      .channels(16)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+  }
+
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, channels_div_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels < 16; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 17; channels < 32; channels++) {
+      EmbeddingMicrokernelTester()
+        .channels(channels)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, multiple_rows) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t rows = 2; rows <= 17; rows += 3) {
+      EmbeddingMicrokernelTester()
+        .rows(rows)
+        .channels(33)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, table_stride) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .table_stride(83)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+
+  TEST(QC4_F32_EMBEDDING__SSE41_C16, scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      EmbeddingMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .scale(0.2f)
+        .TestQC4(xnn_qc4_f32_embedding_ukernel__sse41_c16, xnn_init_f32_scale_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, channels_eq_4) {
+  EmbeddingMicrokernelTester()
+    .channels(4)
+    .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+}
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    EmbeddingMicrokernelTester()
+      .channels(channels)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    EmbeddingMicrokernelTester()
+      .channels(channels)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    EmbeddingMicrokernelTester()
+      .channels(channels)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, multiple_rows) {
+  for (size_t rows = 2; rows <= 17; rows += 3) {
+    EmbeddingMicrokernelTester()
+      .rows(rows)
+      .channels(9)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, table_stride) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    EmbeddingMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .table_stride(23)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
+
+TEST(QC4_F32_EMBEDDING__SCALAR_C4, scale) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    EmbeddingMicrokernelTester()
+      .rows(5)
+      .channels(channels)
+      .scale(0.2f)
+      .TestQC4(xnn_qc4_f32_embedding_ukernel__scalar_c4, xnn_init_f32_scale_scalar_params);
+  }
+}
@@ -0,0 +1,274 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/microparams-init.h>
+#include <xnnpack/rnorm.h>
+#include "rnorm-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(QS8_RNORM__NEON_X16, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    RNormMicrokernelTester()
+      .channels(16)
+      .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+  }
+
+  TEST(QS8_RNORM__NEON_X16, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__NEON_X16, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__NEON_X16, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__NEON_X16, rms) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__NEON_X16, input_zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (int16_t input_zero_point = -128; input_zero_point <= 127; input_zero_point += 51) {
+      RNormMicrokernelTester()
+        .channels(49)
+        .input_zero_point(input_zero_point)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__NEON_X16, output_zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (int16_t output_zero_point = -128; output_zero_point <= 127; output_zero_point += 51) {
+      RNormMicrokernelTester()
+        .channels(49)
+        .output_zero_point(output_zero_point)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__NEON_X16, channels_gt_accumulator_block) {
+    TEST_REQUIRES_ARM_NEON;
+    RNormMicrokernelTester()
+      .channels(131089)
+      .iterations(1)
+      .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+  }
+
+  TEST(QS8_RNORM__NEON_X16, epsilon) {
+    TEST_REQUIRES_ARM_NEON;
+    RNormMicrokernelTester()
+      .channels(49)
+      .epsilon(1.0f)
+      .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+  }
+
+  TEST(QS8_RNORM__NEON_X16, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_qs8_rnorm_ukernel__neon_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_RNORM__SSE41_X16, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE41;
+    RNormMicrokernelTester()
+      .channels(16)
+      .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, channels_div_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, rms) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .subtract_mean(false)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, input_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (int16_t input_zero_point = -128; input_zero_point <= 127; input_zero_point += 51) {
+      RNormMicrokernelTester()
+        .channels(49)
+        .input_zero_point(input_zero_point)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, output_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (int16_t output_zero_point = -128; output_zero_point <= 127; output_zero_point += 51) {
+      RNormMicrokernelTester()
+        .channels(49)
+        .output_zero_point(output_zero_point)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, channels_gt_accumulator_block) {
+    TEST_REQUIRES_X86_SSE41;
+    RNormMicrokernelTester()
+      .channels(131089)
+      .iterations(1)
+      .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, epsilon) {
+    TEST_REQUIRES_X86_SSE41;
+    RNormMicrokernelTester()
+      .channels(49)
+      .epsilon(1.0f)
+      .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+  }
+
+  TEST(QS8_RNORM__SSE41_X16, inplace) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 80; channels += 4) {
+      RNormMicrokernelTester()
+        .channels(channels)
+        .inplace(true)
+        .Test(xnn_qs8_rnorm_ukernel__sse41_x16, xnn_init_qs8_rnorm_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(QS8_RNORM__SCALAR_X4, channels_eq_4) {
+  RNormMicrokernelTester()
+    .channels(4)
+    .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+}
+
+TEST(QS8_RNORM__SCALAR_X4, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
+
+TEST(QS8_RNORM__SCALAR_X4, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
+
+TEST(QS8_RNORM__SCALAR_X4, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
+
+TEST(QS8_RNORM__SCALAR_X4, rms) {
+  for (size_t channels = 1; channels <= 20; channels += 1) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .subtract_mean(false)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
+
+TEST(QS8_RNORM__SCALAR_X4, input_zero_point) {
+  for (int16_t input_zero_point = -128; input_zero_point <= 127; input_zero_point += 51) {
+    RNormMicrokernelTester()
+      .channels(13)
+      .input_zero_point(input_zero_point)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
+
+TEST(QS8_RNORM__SCALAR_X4, output_zero_point) {
+  for (int16_t output_zero_point = -128; output_zero_point <= 127; output_zero_point += 51) {
+    RNormMicrokernelTester()
+      .channels(13)
+      .output_zero_point(output_zero_point)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
+
+TEST(QS8_RNORM__SCALAR_X4, epsilon) {
+  RNormMicrokernelTester()
+    .channels(13)
+    .epsilon(1.0f)
+    .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+}
+
+TEST(QS8_RNORM__SCALAR_X4, inplace) {
+  for (size_t channels = 1; channels <= 20; channels += 1) {
+    RNormMicrokernelTester()
+      .channels(channels)
+      .inplace(true)
+      .Test(xnn_qs8_rnorm_ukernel__scalar_x4, xnn_init_qs8_rnorm_scalar_params);
+  }
+}
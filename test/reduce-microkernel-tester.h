@@ -0,0 +1,219 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/microfnptr.h>
+
+
+class ReduceMicrokernelTester {
+ public:
+  enum class OpType {
+    Max,
+    Min,
+    Sum,
+    SumSquared,
+    // Minimum and maximum at once, in the first and second output element.
+    MinMax,
+  };
+
+  inline ReduceMicrokernelTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline ReduceMicrokernelTester& rows(size_t rows) {
+    assert(rows != 0);
+    this->rows_ = rows;
+    return *this;
+  }
+
+  inline size_t rows() const {
+    return this->rows_;
+  }
+
+  inline ReduceMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ReduceMicrokernelTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->input_stride_ >= channels());
+      return this->input_stride_;
+    }
+  }
+
+  inline ReduceMicrokernelTester& scale(float scale) {
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline ReduceMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_reduce_ukernel_fn reduce, OpType op_type, xnn_init_f32_scale_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> input(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      const float output_init = f32dist(rng);
+
+      // Prepare parameters.
+      union xnn_f32_scale_params params;
+      init_params(&params, scale());
+
+      if (op_type == OpType::MinMax) {
+        const float output_max_init = std::max(output_init, f32dist(rng));
+        const double output_min_ref = Accumulate(OpType::Min, input.data(), batch_size(), 1, output_init);
+        const double output_max_ref = Accumulate(OpType::Max, input.data(), batch_size(), 1, output_max_init);
+
+        float output[2] = {output_init, output_max_init};
+        reduce(batch_size() * sizeof(float), input.data(), output, &params);
+
+        ASSERT_EQ(output[0], output_min_ref) << "batch " << batch_size();
+        ASSERT_EQ(output[1], output_max_ref) << "batch " << batch_size();
+        continue;
+      }
+
+      // Compute reference results.
+      const double output_ref = Accumulate(op_type, input.data(), batch_size(), 1, output_init);
+
+      // Call optimized micro-kernel.
+      float output = output_init;
+      reduce(batch_size() * sizeof(float), input.data(), &output, &params);
+
+      // Verify results.
+      ASSERT_NEAR(output, output_ref, std::abs(output_ref) * 1.0e-5 + double(batch_size()) * 1.0e-6)
+        << "batch " << batch_size() << ", scale " << scale();
+    }
+  }
+
+  void Test(xnn_f32_rdreduce_ukernel_fn rdreduce, OpType op_type, xnn_init_f32_scale_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> input((rows() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(channels());
+    std::vector<float> output_init(channels());
+    std::vector<double> output_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(output_init.begin(), output_init.end(), [&]() { return f32dist(rng); });
+
+      // Compute reference results.
+      for (size_t c = 0; c < channels(); c++) {
+        output_ref[c] = Accumulate(op_type, input.data() + c, rows(), input_stride(), output_init[c]);
+      }
+
+      // Prepare parameters.
+      union xnn_f32_scale_params params;
+      init_params(&params, scale());
+
+      // Call optimized micro-kernel.
+      std::copy(output_init.cbegin(), output_init.cend(), output.begin());
+      rdreduce(rows(), channels(), input.data(), input_stride() * sizeof(float), output.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_NEAR(output[c], output_ref[c], std::abs(output_ref[c]) * 1.0e-5 + double(rows()) * 1.0e-6)
+          << "at channel " << c << " / " << channels() << ", rows " << rows() << ", scale " << scale();
+      }
+    }
+  }
+
+ private:
+  // Reference reduction of n elements with the given stride, accumulated into the initial output value.
+  double Accumulate(OpType op_type, const float* input, size_t n, size_t stride, float output_init) const {
+    switch (op_type) {
+      case OpType::Max:
+      {
+        float max_value = output_init;
+        for (size_t i = 0; i < n; i++) {
+          max_value = std::max(max_value, input[i * stride]);
+        }
+        return max_value;
+      }
+      case OpType::Min:
+      {
+        float min_value = output_init;
+        for (size_t i = 0; i < n; i++) {
+          min_value = std::min(min_value, input[i * stride]);
+        }
+        return min_value;
+      }
+      case OpType::Sum:
+      {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; i++) {
+          sum += double(input[i * stride]);
+        }
+        return double(output_init) + sum * double(scale());
+      }
+      case OpType::SumSquared:
+      {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; i++) {
+          sum += double(input[i * stride]) * double(input[i * stride]);
+        }
+        return double(output_init) + sum * double(scale());
+      }
+      case OpType::MinMax:
+        break;
+    }
+    return 0.0;
+  }
+
+  size_t batch_size_{1};
+  size_t rows_{1};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  float scale_{1.0f};
+  size_t iterations_{15};
+};
@@ -0,0 +1,230 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <pthreadpool.h>
+
+
+class ReduceNDOperatorTester {
+ public:
+  inline ReduceNDOperatorTester& operation(enum xnn_reduce_operator operation) {
+    this->operation_ = operation;
+    return *this;
+  }
+
+  inline enum xnn_reduce_operator operation() const {
+    return this->operation_;
+  }
+
+  inline ReduceNDOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return this->input_shape_;
+  }
+
+  inline size_t num_input_dims() const {
+    return this->input_shape_.size();
+  }
+
+  inline size_t num_input_elements() const {
+    return std::accumulate(
+      this->input_shape_.begin(), this->input_shape_.end(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline ReduceNDOperatorTester& reduction_axes(std::initializer_list<size_t> reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = std::vector<size_t>(reduction_axes);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& reduction_axes() const {
+    return this->reduction_axes_;
+  }
+
+  inline size_t num_reduction_axes() const {
+    return this->reduction_axes_.size();
+  }
+
+  inline ReduceNDOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads != 0);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
+  inline ReduceNDOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    // Pad the shape to XNN_MAX_TENSOR_DIMS dimensions and mark reduced dimensions.
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_dims;
+    std::array<bool, XNN_MAX_TENSOR_DIMS> is_reduced;
+    std::fill(input_dims.begin(), input_dims.end(), 1);
+    std::fill(is_reduced.begin(), is_reduced.end(), false);
+    const size_t num_padding_dims = XNN_MAX_TENSOR_DIMS - num_input_dims();
+    std::copy(input_shape().cbegin(), input_shape().cend(), input_dims.begin() + num_padding_dims);
+    for (size_t axis : reduction_axes()) {
+      is_reduced[num_padding_dims + axis] = true;
+    }
+
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_strides;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_strides;
+    size_t input_stride = 1;
+    size_t output_stride = 1;
+    size_t num_reduced_elements = 1;
+    for (size_t i = XNN_MAX_TENSOR_DIMS; i != 0; i--) {
+      input_strides[i - 1] = input_stride;
+      input_stride *= input_dims[i - 1];
+      output_strides[i - 1] = is_reduced[i - 1] ? 0 : output_stride;
+      if (is_reduced[i - 1]) {
+        num_reduced_elements *= input_dims[i - 1];
+      } else {
+        output_stride *= input_dims[i - 1];
+      }
+    }
+    const size_t num_output_elements = output_stride;
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+    }
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + num_input_elements());
+    std::vector<float> output(num_output_elements);
+    std::vector<double> output_ref(num_output_elements);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      switch (operation()) {
+        case xnn_reduce_max:
+          std::fill(output_ref.begin(), output_ref.end(), -std::numeric_limits<double>::infinity());
+          break;
+        case xnn_reduce_min:
+          std::fill(output_ref.begin(), output_ref.end(), std::numeric_limits<double>::infinity());
+          break;
+        default:
+          std::fill(output_ref.begin(), output_ref.end(), 0.0);
+          break;
+      }
+      for (size_t i = 0; i < input_dims[0]; i++) {
+        for (size_t j = 0; j < input_dims[1]; j++) {
+          for (size_t k = 0; k < input_dims[2]; k++) {
+            for (size_t l = 0; l < input_dims[3]; l++) {
+              for (size_t m = 0; m < input_dims[4]; m++) {
+                for (size_t n = 0; n < input_dims[5]; n++) {
+                  const double x = double(input[
+                    i * input_strides[0] + j * input_strides[1] + k * input_strides[2] +
+                    l * input_strides[3] + m * input_strides[4] + n * input_strides[5]]);
+                  double& y = output_ref[
+                    i * output_strides[0] + j * output_strides[1] + k * output_strides[2] +
+                    l * output_strides[3] + m * output_strides[4] + n * output_strides[5]];
+                  switch (operation()) {
+                    case xnn_reduce_max:
+                      y = std::max(y, x);
+                      break;
+                    case xnn_reduce_min:
+                      y = std::min(y, x);
+                      break;
+                    case xnn_reduce_l2:
+                      y += x * x;
+                      break;
+                    default:
+                      y += x;
+                      break;
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+      for (double& y : output_ref) {
+        if (operation() == xnn_reduce_mean) {
+          y /= double(num_reduced_elements);
+        } else if (operation() == xnn_reduce_l2) {
+          y = std::sqrt(y);
+        }
+      }
+
+      // Create, setup, run, and destroy a reduce operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      const xnn_status status = xnn_create_reduce_nd_f32(operation(), 0, &reduce_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_reduce_nd_f32(
+          reduce_op,
+          num_reduction_axes(), reduction_axes().data(),
+          num_input_dims(), input_shape().data(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < num_output_elements; i++) {
+        const double tolerance = std::abs(output_ref[i]) * 1.0e-5 +
+          (operation() == xnn_reduce_mean ? 1.0e-6 : double(num_reduced_elements) * 1.0e-6);
+        ASSERT_NEAR(output[i], output_ref[i], tolerance)
+          << "at output element " << i << " / " << num_output_elements
+          << ", reducing " << num_reduced_elements << " elements with " << num_threads() << " threads";
+      }
+    }
+  }
+
+ private:
+  enum xnn_reduce_operator operation_{xnn_reduce_sum};
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> reduction_axes_;
+  size_t num_threads_{1};
+  size_t iterations_{3};
+};
@@ -0,0 +1,423 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "reduce-nd-operator-tester.h"
+
+TEST(REDUCE_SUM_ND_F32, reduce_innermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({8, 13, 71})
+    .reduction_axes({2})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_outermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({71, 13, 8})
+    .reduction_axes({0})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_middle) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({5, 17, 9})
+    .reduction_axes({1})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_alternating) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({3, 4, 5, 6, 7})
+    .reduction_axes({1, 3})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_all) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({5, 7, 9})
+    .reduction_axes({0, 1, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_6d) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({2, 3, 4, 5, 3, 2})
+    .reduction_axes({0, 2, 5})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_unit_dims) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({1, 13, 1, 7})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_innermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({3, 20011})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_outermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({20011, 3})
+    .reduction_axes({0})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_middle_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_sum)
+    .input_shape({2, 4099, 19})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_innermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({8, 13, 71})
+    .reduction_axes({2})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_outermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({71, 13, 8})
+    .reduction_axes({0})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_middle) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({5, 17, 9})
+    .reduction_axes({1})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_alternating) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({3, 4, 5, 6, 7})
+    .reduction_axes({1, 3})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_all) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({5, 7, 9})
+    .reduction_axes({0, 1, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_6d) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({2, 3, 4, 5, 3, 2})
+    .reduction_axes({0, 2, 5})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_unit_dims) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({1, 13, 1, 7})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_innermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({3, 20011})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_outermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({20011, 3})
+    .reduction_axes({0})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_middle_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_mean)
+    .input_shape({2, 4099, 19})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_innermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({8, 13, 71})
+    .reduction_axes({2})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_outermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({71, 13, 8})
+    .reduction_axes({0})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_middle) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({5, 17, 9})
+    .reduction_axes({1})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_alternating) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({3, 4, 5, 6, 7})
+    .reduction_axes({1, 3})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_all) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({5, 7, 9})
+    .reduction_axes({0, 1, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_6d) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({2, 3, 4, 5, 3, 2})
+    .reduction_axes({0, 2, 5})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_unit_dims) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({1, 13, 1, 7})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_innermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({3, 20011})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_outermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({20011, 3})
+    .reduction_axes({0})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_middle_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_max)
+    .input_shape({2, 4099, 19})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_innermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({8, 13, 71})
+    .reduction_axes({2})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_outermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({71, 13, 8})
+    .reduction_axes({0})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_middle) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({5, 17, 9})
+    .reduction_axes({1})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_alternating) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({3, 4, 5, 6, 7})
+    .reduction_axes({1, 3})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_all) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({5, 7, 9})
+    .reduction_axes({0, 1, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_6d) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({2, 3, 4, 5, 3, 2})
+    .reduction_axes({0, 2, 5})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_unit_dims) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({1, 13, 1, 7})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_innermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({3, 20011})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_outermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({20011, 3})
+    .reduction_axes({0})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_MIN_ND_F32, reduce_middle_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_min)
+    .input_shape({2, 4099, 19})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_innermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({8, 13, 71})
+    .reduction_axes({2})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_outermost) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({71, 13, 8})
+    .reduction_axes({0})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_middle) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({5, 17, 9})
+    .reduction_axes({1})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_alternating) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({3, 4, 5, 6, 7})
+    .reduction_axes({1, 3})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_all) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({5, 7, 9})
+    .reduction_axes({0, 1, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_6d) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({2, 3, 4, 5, 3, 2})
+    .reduction_axes({0, 2, 5})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_unit_dims) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({1, 13, 1, 7})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_innermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({3, 20011})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_outermost_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({20011, 3})
+    .reduction_axes({0})
+    .num_threads(4)
+    .TestF32();
+}
+
+TEST(REDUCE_L2_ND_F32, reduce_middle_multithreaded) {
+  ReduceNDOperatorTester()
+    .operation(xnn_reduce_l2)
+    .input_shape({2, 4099, 19})
+    .reduction_axes({1})
+    .num_threads(4)
+    .TestF32();
+}
@@ -0,0 +1,75 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/normalization.h>
+
+#include <gtest/gtest.h>
+
+class ReduceNormalizationTester {
+ public:
+  inline ReduceNormalizationTester& input_shape(const std::vector<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = input_shape;
+    return *this;
+  }
+
+  inline std::vector<size_t> input_shape() const { return input_shape_; }
+
+  inline ReduceNormalizationTester& reduction_axes(const std::vector<size_t> reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = reduction_axes;
+    return *this;
+  }
+
+  inline std::vector<size_t> reduction_axes() const { return reduction_axes_; }
+
+  inline ReduceNormalizationTester& expected_input_shape(const std::vector<size_t> expected_input_shape) {
+    assert(expected_input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->expected_input_shape_ = expected_input_shape;
+    return *this;
+  }
+
+  inline std::vector<size_t> expected_input_shape() const { return expected_input_shape_; }
+
+  inline ReduceNormalizationTester& expected_reduction_axes(const std::vector<size_t> expected_reduction_axes) {
+    assert(expected_reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->expected_reduction_axes_ = expected_reduction_axes;
+    return *this;
+  }
+
+  inline std::vector<size_t> expected_reduction_axes() const { return expected_reduction_axes_; }
+
+  void Test() const {
+    std::vector<size_t> input_dims = input_shape();
+    std::vector<size_t> axes = reduction_axes();
+    size_t num_input_dims = input_dims.size();
+    size_t num_reduction_axes = axes.size();
+    input_dims.resize(XNN_MAX_TENSOR_DIMS);
+    axes.resize(XNN_MAX_TENSOR_DIMS);
+
+    xnn_normalize_reduction(&num_reduction_axes, axes.data(), &num_input_dims, input_dims.data());
+
+    EXPECT_EQ(expected_input_shape().size(), num_input_dims);
+    EXPECT_EQ(expected_reduction_axes().size(), num_reduction_axes);
+    input_dims.resize(num_input_dims);
+    axes.resize(num_reduction_axes);
+    EXPECT_EQ(expected_input_shape(), input_dims);
+    EXPECT_EQ(expected_reduction_axes(), axes);
+  }
+
+ private:
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> reduction_axes_;
+  std::vector<size_t> expected_input_shape_;
+  std::vector<size_t> expected_reduction_axes_;
+};
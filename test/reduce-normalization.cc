@@ -0,0 +1,82 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <xnnpack.h>
+#include <xnnpack/normalization.h>
+
+#include "reduce-normalization-tester.h"
+#include <gtest/gtest.h>
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_innermost) {
+  ReduceNormalizationTester()
+      .input_shape({2, 3, 4, 5})
+      .reduction_axes({3})
+      .expected_input_shape({24, 5})
+      .expected_reduction_axes({1})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_innermost_merged) {
+  ReduceNormalizationTester()
+      .input_shape({2, 3, 4, 5})
+      .reduction_axes({2, 3})
+      .expected_input_shape({6, 20})
+      .expected_reduction_axes({1})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_outermost) {
+  ReduceNormalizationTester()
+      .input_shape({2, 3, 4, 5})
+      .reduction_axes({0, 1})
+      .expected_input_shape({6, 20})
+      .expected_reduction_axes({0})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_all) {
+  ReduceNormalizationTester()
+      .input_shape({2, 3, 4, 5})
+      .reduction_axes({0, 1, 2, 3})
+      .expected_input_shape({120})
+      .expected_reduction_axes({0})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_alternating) {
+  ReduceNormalizationTester()
+      .input_shape({2, 3, 4, 5, 6})
+      .reduction_axes({1, 3})
+      .expected_input_shape({2, 3, 4, 5, 6})
+      .expected_reduction_axes({1, 3})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, drop_unit_dims) {
+  ReduceNormalizationTester()
+      .input_shape({1, 3, 1, 5, 1})
+      .reduction_axes({1, 4})
+      .expected_input_shape({3, 5})
+      .expected_reduction_axes({0})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, unit_dim_between_reduced_dims) {
+  ReduceNormalizationTester()
+      .input_shape({4, 3, 1, 5})
+      .reduction_axes({1, 3})
+      .expected_input_shape({4, 15})
+      .expected_reduction_axes({1})
+      .Test();
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, unit_dim_between_kept_dims) {
+  ReduceNormalizationTester()
+      .input_shape({4, 1, 3, 5})
+      .reduction_axes({1, 3})
+      .expected_input_shape({12, 5})
+      .expected_reduction_axes({1})
+      .Test();
+}
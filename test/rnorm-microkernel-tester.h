@@ -0,0 +1,282 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/microfnptr.h>
+#include <xnnpack/microparams-init.h>
+
+
+class RNormMicrokernelTester {
+ public:
+  inline RNormMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline RNormMicrokernelTester& subtract_mean(bool subtract_mean) {
+    this->subtract_mean_ = subtract_mean;
+    return *this;
+  }
+
+  inline bool subtract_mean() const {
+    return this->subtract_mean_;
+  }
+
+  inline RNormMicrokernelTester& input_offset(float input_offset) {
+    this->input_offset_ = input_offset;
+    return *this;
+  }
+
+  inline float input_offset() const {
+    return this->input_offset_;
+  }
+
+  inline RNormMicrokernelTester& epsilon(float epsilon) {
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  inline float epsilon() const {
+    return this->epsilon_;
+  }
+
+  inline RNormMicrokernelTester& input_zero_point(int16_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int16_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline RNormMicrokernelTester& output_zero_point(int16_t output_zero_point) {
+    this->output_zero_point_ = output_zero_point;
+    return *this;
+  }
+
+  inline int16_t output_zero_point() const {
+    return this->output_zero_point_;
+  }
+
+  inline RNormMicrokernelTester& inplace(bool inplace) {
+    this->inplace_ = inplace;
+    return *this;
+  }
+
+  inline bool inplace() const {
+    return this->inplace_;
+  }
+
+  inline RNormMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f16_rnorm_ukernel_fn rnorm, xnn_init_f16_rnorm_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> gammadist(0.5f, 2.0f);
+
+    std::vector<uint16_t> x(channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> w(2 * channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(channels() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng) + input_offset()); });
+      std::generate(w.begin(), w.begin() + channels(), [&]() { return fp16_ieee_from_fp32_value(gammadist(rng)); });
+      std::generate(w.begin() + channels(), w.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      if (inplace()) {
+        std::copy(x.cbegin(), x.cbegin() + channels(), y.begin());
+      } else {
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      double sum = 0.0;
+      double sumsq = 0.0;
+      for (size_t c = 0; c < channels(); c++) {
+        const double xc = fp16_ieee_to_fp32_value(x[c]);
+        sum += xc;
+        sumsq += xc * xc;
+      }
+      const double mean = subtract_mean() ? sum / double(channels()) : 0.0;
+      const double variance = subtract_mean() ? std::max(sumsq / double(channels()) - mean * mean, 0.0) : sumsq / double(channels());
+      const double rstd = 1.0 / std::sqrt(variance + double(epsilon()));
+      for (size_t c = 0; c < channels(); c++) {
+        y_ref[c] = float((double(fp16_ieee_to_fp32_value(x[c])) - mean) * rstd *
+          double(fp16_ieee_to_fp32_value(w[c])) + double(fp16_ieee_to_fp32_value(w[channels() + c])));
+      }
+
+      // Prepare parameters.
+      xnn_f16_rnorm_params params;
+      init_params(&params, epsilon(), subtract_mean());
+
+      // Call optimized micro-kernel.
+      rnorm(channels() * sizeof(uint16_t), x_data, w.data(), y.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_NEAR(fp16_ieee_to_fp32_value(y[c]), y_ref[c], std::max(1.0e-2f, std::abs(y_ref[c]) * 1.0e-2f))
+          << "at channel " << c << " / " << channels();
+      }
+    }
+  }
+
+  void Test(xnn_f32_rnorm_ukernel_fn rnorm, xnn_init_f32_rnorm_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> gammadist(0.5f, 2.0f);
+
+    std::vector<float> x(channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> w(2 * channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(channels() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), [&]() { return f32dist(rng) + input_offset(); });
+      std::generate(w.begin(), w.begin() + channels(), [&]() { return gammadist(rng); });
+      std::generate(w.begin() + channels(), w.end(), [&]() { return f32dist(rng); });
+      if (inplace()) {
+        std::copy(x.cbegin(), x.cbegin() + channels(), y.begin());
+      } else {
+        std::fill(y.begin(), y.end(), std::nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      double sum = 0.0;
+      double sumsq = 0.0;
+      for (size_t c = 0; c < channels(); c++) {
+        sum += double(x[c]);
+        sumsq += double(x[c]) * double(x[c]);
+      }
+      const double mean = subtract_mean() ? sum / double(channels()) : 0.0;
+      const double variance = subtract_mean() ? std::max(sumsq / double(channels()) - mean * mean, 0.0) : sumsq / double(channels());
+      const double rstd = 1.0 / std::sqrt(variance + double(epsilon()));
+      for (size_t c = 0; c < channels(); c++) {
+        y_ref[c] = (double(x[c]) - mean) * rstd * double(w[c]) + double(w[channels() + c]);
+      }
+
+      // Prepare parameters.
+      xnn_f32_rnorm_params params;
+      init_params(&params, epsilon(), subtract_mean());
+
+      // Call optimized micro-kernel.
+      rnorm(channels() * sizeof(float), x_data, w.data(), y.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_NEAR(y[c], y_ref[c], std::max(1.0e-4, std::abs(y_ref[c]) * 1.0e-4))
+          << "at channel " << c << " / " << channels();
+      }
+    }
+  }
+
+  void Test(xnn_qs8_rnorm_ukernel_fn rnorm, xnn_init_qs8_rnorm_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> gammadist(0.5f, 2.0f);
+
+    const float input_scale = 0.125f;
+    const float output_scale = 1.0f / 32.0f;
+    const int8_t output_min = std::numeric_limits<int8_t>::min();
+    const int8_t output_max = std::numeric_limits<int8_t>::max();
+
+    std::vector<int8_t> x(channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<float> w(2 * channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<int8_t> y(channels() + (inplace() ? XNN_EXTRA_BYTES / sizeof(int8_t) : 0));
+    std::vector<float> beta(channels());
+    std::vector<double> y_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), [&]() { return i8dist(rng); });
+      std::generate(beta.begin(), beta.end(), [&]() { return f32dist(rng); });
+      std::generate(w.begin(), w.begin() + channels(), [&]() { return gammadist(rng); });
+      // Offsets are packed pre-divided by the output scale.
+      for (size_t c = 0; c < channels(); c++) {
+        w[channels() + c] = beta[c] / output_scale;
+      }
+      if (inplace()) {
+        std::copy(x.cbegin(), x.cbegin() + channels(), y.begin());
+      } else {
+        std::fill(y.begin(), y.end(), INT8_C(0xA5));
+      }
+      const int8_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      double sum = 0.0;
+      double sumsq = 0.0;
+      for (size_t c = 0; c < channels(); c++) {
+        const double xc = double(int32_t(x[c]) - int32_t(input_zero_point())) * double(input_scale);
+        sum += xc;
+        sumsq += xc * xc;
+      }
+      const double mean = subtract_mean() ? sum / double(channels()) : 0.0;
+      const double variance = subtract_mean() ? std::max(sumsq / double(channels()) - mean * mean, 0.0) : sumsq / double(channels());
+      const double rstd = 1.0 / std::sqrt(variance + double(epsilon()));
+      for (size_t c = 0; c < channels(); c++) {
+        const double xc = double(int32_t(x[c]) - int32_t(input_zero_point())) * double(input_scale);
+        double yc = ((xc - mean) * rstd * double(w[c]) + double(beta[c])) / double(output_scale) +
+          double(output_zero_point());
+        yc = std::max<double>(yc, double(output_min));
+        yc = std::min<double>(yc, double(output_max));
+        y_ref[c] = yc;
+      }
+
+      // Prepare parameters.
+      xnn_qs8_rnorm_params params;
+      init_params(&params, epsilon(), subtract_mean(),
+        int8_t(input_zero_point()), input_scale,
+        int8_t(output_zero_point()), output_scale, output_min, output_max);
+
+      // Call optimized micro-kernel.
+      rnorm(channels() * sizeof(int8_t), x_data, w.data(), y.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_NEAR(double(int32_t(y[c])), y_ref[c], 0.6)
+          << "at channel " << c << " / " << channels() << ", x[" << c << "] = " << int32_t(x[c]);
+      }
+    }
+  }
+
+ private:
+  size_t channels_{1};
+  bool subtract_mean_{true};
+  float input_offset_{0.0f};
+  float epsilon_{1.0e-5f};
+  int16_t input_zero_point_{0};
+  int16_t output_zero_point_{0};
+  bool inplace_{false};
+  size_t iterations_{15};
+};
@@ -114,13 +114,13 @@ TEST(WEIGHTS_CACHE, grow) {
 
 TEST(WEIGHTS_MEMORY, allocate_and_release) {
   xnn_weights_buffer b;
-  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE, /*flags=*/0));
   ASSERT_EQ(xnn_status_success, xnn_release_weights_memory(&b));
 }
 
 TEST(WEIGHTS_MEMORY, grow) {
   xnn_weights_buffer b;
-  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, 8));
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, 8, /*flags=*/0));
   // Allocations rounded to page size, so it might not be 8.
   size_t old_capacity = b.capacity;
 
@@ -154,10 +154,50 @@ TEST(WEIGHTS_MEMORY, grow) {
   ASSERT_EQ(xnn_status_success, xnn_release_weights_memory(&b));
 }
 
+TEST(WEIGHTS_MEMORY, grow_with_memory_flags) {
+  xnn_weights_buffer b;
+  const uint32_t flags = XNN_FLAG_HUGE_PAGES | XNN_FLAG_TRANSPARENT_HUGE_PAGES | XNN_FLAG_PREFAULT_MEMORY;
+  // Explicit huge pages are not available on all systems, allocation falls back to regular pages.
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, 8, flags));
+  ASSERT_EQ(flags, b.flags);
+  ASSERT_LE(xnn_get_weights_memory_huge_page_size(&b), b.capacity);
+
+  std::string junk = "1234";
+  std::memcpy(b.start, junk.data(), junk.length());
+  b.size = b.capacity;
+  const size_t old_capacity = b.capacity;
+  ASSERT_EQ(xnn_status_success, xnn_reserve_weights_memory(&b, 4));
+  ASSERT_LT(old_capacity, b.capacity);
+  ASSERT_LE(xnn_get_weights_memory_huge_page_size(&b), b.capacity);
+
+  // Check that after growing, the contents remain.
+  std::string actual = std::string(static_cast<char*>(b.start), static_cast<char*>(b.start) + junk.length());
+  ASSERT_EQ(junk, actual);
+
+  ASSERT_EQ(xnn_status_success, xnn_finalize_weights_memory(&b));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_memory(&b));
+}
+
+TEST(WEIGHTS_CACHE, memory_stats) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  xnn_weights_cache_t cache = nullptr;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_create_weights_cache_with_memory_flags(
+      XNN_DEFAULT_WEIGHTS_BUFFER_SIZE, XNN_FLAG_TRANSPARENT_HUGE_PAGES | XNN_FLAG_PREFAULT_MEMORY, &cache));
+
+  xnn_memory_stats stats;
+  ASSERT_EQ(xnn_status_success, xnn_get_weights_cache_memory_stats(cache, &stats));
+  ASSERT_GE(stats.allocated_bytes, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE);
+  ASSERT_LE(stats.huge_page_bytes, stats.allocated_bytes);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(cache));
+}
+
 TEST(WEIGHTS_CACHE, finalize_empty) {
   xnn_weights_buffer b;
   const size_t initial_capacity = 1024 * 1024;  // 1MB.
-  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, initial_capacity));
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, initial_capacity, /*flags=*/0));
 
   ASSERT_EQ(0, b.size);
   ASSERT_EQ(initial_capacity, b.capacity);
@@ -172,7 +212,7 @@ TEST(WEIGHTS_CACHE, finalize_empty) {
 TEST(WEIGHTS_CACHE, finalize) {
   xnn_weights_buffer b;
   const size_t initial_capacity = 1024 * 1024;  // 1MB.
-  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, initial_capacity));
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, initial_capacity, /*flags=*/0));
   const size_t actual_capacity = b.capacity;
 
   const std::string junk = "1234";
@@ -195,7 +235,7 @@ TEST(WEIGHTS_CACHE, finalize) {
 
 TEST(WEIGHTS_CACHE, finalize_twice) {
   xnn_weights_buffer b;
-  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE, /*flags=*/0));
 
   const std::string junk = "1234";
   std::memcpy(b.start, junk.data(), junk.length());
@@ -215,7 +255,7 @@ TEST(WEIGHTS_CACHE, finalize_twice) {
 TEST(WEIGHTS_CACHE, finalize_capacity_smaller_than_page_aligned_size) {
   xnn_weights_buffer b;
   // Small capacity that is smaller than page sizes on all platforms.
-  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, 8));
+  ASSERT_EQ(xnn_status_success, xnn_allocate_weights_memory(&b, 8, /*flags=*/0));
 
   const std::string junk = "1234";
   std::memcpy(b.start, junk.data(), junk.length());
@@ -5,10 +5,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <xnnpack.h>
 #include <xnnpack/math.h>
@@ -265,6 +267,47 @@ TEST(WORKSPACE, workspace_no_growth)
   ASSERT_EQ(workspace->ref_count, 3);
 }
 
+TEST(WORKSPACE, workspace_with_memory_flags)
+{
+  xnn_initialize(/*allocator=*/nullptr);
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_create_workspace_with_memory_flags(
+      XNN_FLAG_HUGE_PAGES | XNN_FLAG_TRANSPARENT_HUGE_PAGES | XNN_FLAG_PREFAULT_MEMORY, &workspace));
+  std::unique_ptr<xnn_workspace, decltype(&xnn_release_workspace)> auto_workspace(workspace, xnn_release_workspace);
+
+  std::array<size_t, 4> dims = {2, 20, 20, 3};
+
+  xnn_subgraph_t subgraph = nullptr;
+  DefineGraph(&subgraph, dims);
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph, nullptr, workspace, nullptr, 0, &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  ASSERT_NE(nullptr, workspace->data);
+
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    xnn_blob* blob = &runtime->blobs[i];
+    if (blob->allocation_type == xnn_allocation_type_workspace) {
+      ASSERT_TRUE(BlobInWorkspace(blob, runtime->workspace));
+    }
+  }
+
+  std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + dims[0] * dims[1] * dims[2] * dims[3], 1.0f);
+  std::vector<float> output(dims[0] * dims[1] * dims[2] * dims[3]);
+  const std::array<xnn_external_value, 2> external = {
+    xnn_external_value{0, input.data()}, xnn_external_value{2, output.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  xnn_memory_stats stats;
+  ASSERT_EQ(xnn_status_success, xnn_get_workspace_memory_stats(workspace, &stats));
+  ASSERT_GE(stats.allocated_bytes, workspace->size);
+  ASSERT_LE(stats.huge_page_bytes, stats.allocated_bytes);
+}
+
 TEST(WORKSPACE, workspace_grow)
 {
   xnn_initialize(/*allocator=*/nullptr);
@@ -581,3 +624,101 @@ TEST(WORKSPACE, persistent_tensors_updated_correct_when_workspace_grows)
     }
   }
 }
+
+TEST(WORKSPACE, setup_with_moved_external_values_sets_up_only_affected_operators)
+{
+  xnn_initialize(/*allocator=*/nullptr);
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+  std::unique_ptr<xnn_workspace, decltype(&xnn_release_workspace)> auto_workspace(workspace, xnn_release_workspace);
+
+  std::array<size_t, 4> dims = {1, 2, 2, 3};
+  xnn_subgraph_t subgraph = nullptr;
+  DefineGraph(&subgraph, dims);
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph, nullptr, workspace, nullptr, 0, &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  ASSERT_EQ(runtime->num_ops, 2);
+
+  const size_t num_elements = dims[0] * dims[1] * dims[2] * dims[3];
+  std::vector<float> input(num_elements + XNN_EXTRA_BYTES / sizeof(float));
+  for (size_t i = 0; i < num_elements; i++) {
+    input[i] = static_cast<float>(i) - 6.0f;
+  }
+  std::vector<float> output1(num_elements);
+  std::vector<float> output2(num_elements, std::nanf(""));
+
+  std::array<xnn_external_value, 2> external = {
+    xnn_external_value{0, input.data()}, xnn_external_value{2, output1.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  ASSERT_TRUE(runtime->opdata[0].is_set_up);
+  ASSERT_TRUE(runtime->opdata[1].is_set_up);
+
+  // Moving the output only invalidates the setup of the operator which writes it.
+  external[1].data = output2.data();
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(runtime->opdata[0].setup_inputs_data[0], input.data());
+  ASSERT_EQ(runtime->opdata[1].setup_outputs_data[0], output2.data());
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  ASSERT_EQ(output1, output2);
+
+  // Changing the contents of the input at the same address does not need a new setup.
+  for (size_t i = 0; i < num_elements; i++) {
+    input[i] = -input[i];
+  }
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  ASSERT_EQ(output1, output2);
+}
+
+TEST(WORKSPACE, setup_after_workspace_grows_sets_up_operators_with_moved_blobs)
+{
+  xnn_initialize(/*allocator=*/nullptr);
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+  std::unique_ptr<xnn_workspace, decltype(&xnn_release_workspace)> auto_workspace(workspace, xnn_release_workspace);
+
+  std::array<size_t, 4> dims1 = {1, 2, 2, 3};
+  xnn_subgraph_t subgraph1 = nullptr;
+  DefineGraph(&subgraph1, dims1);
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph1(subgraph1, xnn_delete_subgraph);
+
+  xnn_runtime_t runtime1 = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, 0, &runtime1));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime1(runtime1, xnn_delete_runtime);
+
+  const size_t num_elements = dims1[0] * dims1[1] * dims1[2] * dims1[3];
+  std::vector<float> input(num_elements + XNN_EXTRA_BYTES / sizeof(float));
+  for (size_t i = 0; i < num_elements; i++) {
+    input[i] = static_cast<float>(i) - 6.0f;
+  }
+  std::vector<float> output_before(num_elements);
+  std::vector<float> output_after(num_elements, std::nanf(""));
+
+  std::array<xnn_external_value, 2> external = {
+    xnn_external_value{0, input.data()}, xnn_external_value{2, output_before.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime1, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime1));
+  const void* old_intermediate_data = runtime1->blobs[1].data;
+
+  // A larger graph sharing the workspace moves the intermediate tensor of the first runtime.
+  std::array<size_t, 4> dims2 = {4, 20, 20, 3};
+  xnn_subgraph_t subgraph2 = nullptr;
+  DefineGraph(&subgraph2, dims2);
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
+
+  xnn_runtime_t runtime2 = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, 0, &runtime2));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime2(runtime2, xnn_delete_runtime);
+  ASSERT_NE(runtime1->blobs[1].data, old_intermediate_data);
+
+  external[1].data = output_after.data();
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime1, external.size(), external.data()));
+  ASSERT_EQ(runtime1->opdata[0].setup_outputs_data[0], runtime1->blobs[1].data);
+  ASSERT_EQ(runtime1->opdata[1].setup_inputs_data[0], runtime1->blobs[1].data);
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime1));
+  ASSERT_EQ(output_before, output_after);
+}
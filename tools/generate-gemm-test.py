@@ -924,6 +924,8 @@ def generate_test_cases(ukernel, mr, nr, kr, sr, xw, k_block, init_fn,
   if jit:
     _, _, datatype, ukernel_type, _ = ukernel.split("_", 4)
     activation = None
+  elif ukernel.startswith("xnn_qd8_f32_qc8w_"):
+    _, datatype, _, _, ukernel_type, activation, _ = ukernel.split("_", 6)
   else:
     _, datatype, ukernel_type, activation, _ = ukernel.split("_", 4)
 
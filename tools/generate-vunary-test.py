@@ -27,13 +27,16 @@ parser.set_defaults(defines=list())
 
 
 def split_ukernel_name(name):
-  match = re.fullmatch(r"xnn_(s8|u8|f16|f32|u32|u64)(_(s8|u8|f16|f32|u32|u64))*_v(abs|clamp|elu|hswish|lrelu|neg|relu|rndd|rndne|rndu|rndz|sigmoid|sqr|sqrt|sqrtshift)_(fact_)?ukernel__(.+)_x(\d+)(v)?", name)
+  match = re.fullmatch(r"xnn_(s8|u8|f16|f32|u32|u64)(_(s8|u8|f16|f32|u32|u64))*_v(abs|approxgelu|clamp|elu|exp|gelu|hswish|lrelu|neg|relu|rndd|rndne|rndu|rndz|sigmoid|silu|sqr|sqrt|sqrtshift|tanh)_(fact_)?ukernel__(.+)_x(\d+)(v)?", name)
   if match is None:
     raise ValueError("Unexpected microkernel name: " + name)
   op_type = {
     "abs": "Abs",
+    "approxgelu": "ApproxGELU",
     "clamp": "Clamp",
     "elu": "ELU",
+    "exp": "Exp",
+    "gelu": "GELU",
     "hswish": "HardSwish",
     "lrelu": "LeakyReLU",
     "neg": "Negate",
@@ -43,9 +46,11 @@ def split_ukernel_name(name):
     "rndz": "RoundTowardsZero",
     "rndu": "RoundUp",
     "sigmoid": "Sigmoid",
+    "silu": "SiLU",
     "sqr": "Square",
     "sqrt": "SquareRoot",
     "sqrtshift": "SquareRootShift",
+    "tanh": "TanH",
   }[match.group(4)]
   batch_tile = int(match.group(7))
   vector_tile = bool(match.group(8))